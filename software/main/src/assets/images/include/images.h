@@ -2,12 +2,28 @@
 #define __IMAGES_H__
 
 #include "rgb565.h"
+#include "utils.h"
+
+#define IMAGE_ENCODING_RAW      0 // RGB565 pixels
+#define IMAGE_ENCODING_QOI565   1 // Byte stream produced by tools/imgconv.py
+
+// QOI565 ops
+#define IMAGE_QOI565_OP_MASK        0xC0
+#define IMAGE_QOI565_OP_INDEX       0x00 // 00iiiiii
+#define IMAGE_QOI565_OP_DIFF        0x40 // 01rrggbb, -2..1 per channel
+#define IMAGE_QOI565_OP_LUMA        0x80 // 10gggggg rrrrbbbb, green -32..31, red and blue -8..7 relative to green
+#define IMAGE_QOI565_OP_RUN         0xC0 // 11nnnnnn, 1..62 pixels
+#define IMAGE_QOI565_OP_RGB         0xFE // Followed by the RGB565 pixel, big endian
+#define IMAGE_QOI565_OP_LONG_RUN    0xFF // Followed by the pixel count - 1, big endian
+#define IMAGE_QOI565_INDEX_SIZE     64
 
 typedef struct
 {
-    rgb565_t *pPixels;
+    const void *pData;
+    uint32_t ulSize; // Bytes
     uint16_t usWidth;
     uint16_t usHeight;
+    uint8_t ubEncoding;
 } image_t;
 
 // Declare all images
@@ -1,3995 +1,1774 @@
 #include "images.h"
 
-static const rgb565_t pPixels[] =
+static const uint8_t pData[] QSPI_DATA =
 {
-    0x5475, 0x5475, 0x5475, 0x5475, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5475, 0x5475, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5C95, 0x5495, 0x5475, 0x5C95, 0x5475, 0x5475,
-    0x5475, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5494, 0x5494,
-    0x5494, 0x33B1, 0x33F2, 0x44B5, 0x3495, 0x3495, 0x34B5, 0x34B5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x24B5, 0x24B5, 0x2CB5, 0x2CB5, 0x2CB5, 0x24B5, 0x2495,
-    0x2495, 0x2495, 0x2495, 0x2495, 0x2495, 0x2495, 0x24B5, 0x24B5,
-    0x24B4, 0x24B5, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C94,
-    0x2C94, 0x2C94, 0x24B5, 0x1CB5, 0x24B4, 0x1CB4, 0x24B4, 0x24B4,
-    0x1CB4, 0x1CD4, 0x1CD4, 0x1CB3, 0x2493, 0x3472, 0x4C31, 0x5C10,
-    0x6410, 0x6BCF, 0x6BCF, 0x6410, 0x4470, 0x3CD1, 0x3CB2, 0x1BCF,
-    0x4513, 0x5D55, 0x6555, 0x6555, 0x6555, 0x6575, 0x4C91, 0x5513,
-    0x5D75, 0x5D55, 0x6555, 0x6555, 0x6575, 0x6555, 0x6555, 0x6576,
-    0x6596, 0x6575, 0x6576, 0x6596, 0x6576, 0x6576, 0x6556, 0x6556,
-    0x6576, 0x5D76, 0x5D76, 0x5D76, 0x5D55, 0x5D55, 0x5D75, 0x5534,
-    0x5D35, 0x5D35, 0x5D55, 0x5D56, 0x5D56, 0x5D35, 0x5D35, 0x5535,
-    0x5515, 0x5515, 0x5515, 0x5515, 0x5535, 0x5536, 0x5536, 0x5536,
-    0x5516, 0x5515, 0x5515, 0x5515, 0x5515, 0x4D15, 0x5515, 0x5535,
-    0x5535, 0x5515, 0x5515, 0x5515, 0x5535, 0x5535, 0x5555, 0x5556,
-    0x5535, 0x5535, 0x5535, 0x5555, 0x5475, 0x5475, 0x5475, 0x5475,
-    0x5495, 0x5495, 0x5495, 0x5475, 0x5495, 0x5495, 0x5475, 0x5475,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5475,
-    0x5475, 0x5475, 0x5475, 0x5475, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5494, 0x5494, 0x5474, 0x2B90, 0x33F2, 0x3C95,
-    0x3495, 0x2C95, 0x34B5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x24B5, 0x24B5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x24B5, 0x24B5, 0x2495, 0x2495, 0x2495, 0x2495,
-    0x2495, 0x2495, 0x24B5, 0x24B5, 0x24B4, 0x24B5, 0x2C95, 0x2C95,
-    0x2C95, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x24B5, 0x24B5,
-    0x24B5, 0x24B4, 0x24B4, 0x24B4, 0x1CD4, 0x1CB3, 0x1CB3, 0x24B3,
-    0x3472, 0x3C31, 0x53D0, 0x63AF, 0x73AF, 0x7BCF, 0x7B8E, 0x6B8E,
-    0x5470, 0x4470, 0x3450, 0x1BAE, 0x4D34, 0x5D75, 0x5D55, 0x6555,
-    0x6575, 0x6DB6, 0x6575, 0x6DB6, 0x5D76, 0x5D76, 0x6576, 0x6575,
-    0x6575, 0x5D75, 0x6576, 0x65B7, 0x6DB6, 0x6596, 0x6596, 0x6596,
-    0x6576, 0x6597, 0x6DB7, 0x6DB7, 0x65B7, 0x6596, 0x5D96, 0x5555,
-    0x4CF4, 0x4CD3, 0x4492, 0x4492, 0x4472, 0x4493, 0x4CD3, 0x54F4,
-    0x5535, 0x5D56, 0x5D56, 0x6576, 0x6577, 0x6577, 0x5D77, 0x5D77,
-    0x5D77, 0x5D77, 0x5D77, 0x5D56, 0x5D56, 0x5D56, 0x5D56, 0x5D56,
-    0x5D56, 0x5D56, 0x5D77, 0x5D77, 0x5D77, 0x5D56, 0x5D56, 0x5D56,
-    0x5D56, 0x5556, 0x5556, 0x5555, 0x5555, 0x5535, 0x5535, 0x4D35,
-    0x5475, 0x5475, 0x5495, 0x5495, 0x5475, 0x5495, 0x5495, 0x5475,
-    0x5475, 0x5475, 0x5475, 0x5475, 0x5475, 0x5495, 0x5475, 0x5475,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5475, 0x5475, 0x5475, 0x5475, 0x5475, 0x5475,
-    0x5495, 0x5475, 0x5495, 0x5495, 0x5495, 0x5494, 0x5494, 0x5494,
-    0x4C74, 0x2B70, 0x3413, 0x3C95, 0x3495, 0x3495, 0x34B5, 0x2C95,
-    0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x24B5, 0x24B5, 0x24B5, 0x2CB5, 0x24B5, 0x24B5, 0x24B5,
-    0x2495, 0x2495, 0x2495, 0x2495, 0x2495, 0x2495, 0x2494, 0x24B4,
-    0x24B5, 0x24B5, 0x2CB5, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2C95,
-    0x2CB5, 0x2CB5, 0x24B5, 0x24B5, 0x24B5, 0x1CB4, 0x1CD4, 0x1CD4,
-    0x24D3, 0x24B3, 0x2492, 0x3471, 0x4430, 0x5BCF, 0x738F, 0x8B6E,
-    0xB410, 0xBC31, 0xB3F0, 0x938E, 0x73CE, 0x540F, 0x33CE, 0x238D,
-    0x44D2, 0x5535, 0x5D35, 0x6576, 0x5D55, 0x5D75, 0x5D76, 0x5D75,
-    0x5575, 0x5556, 0x5D56, 0x6576, 0x6596, 0x6596, 0x6596, 0x6597,
-    0x6596, 0x6596, 0x65B7, 0x6597, 0x5D76, 0x5D56, 0x5D35, 0x5514,
-    0x4CD3, 0x3C92, 0x2C10, 0x23AF, 0x1B6E, 0x234E, 0x1B2D, 0x232D,
-    0x1B0D, 0x1B0D, 0x1B2D, 0x1B4E, 0x236F, 0x2BAF, 0x33D0, 0x3411,
-    0x3411, 0x3411, 0x3411, 0x3411, 0x3C32, 0x3C32, 0x3C32, 0x3412,
-    0x3C32, 0x3C32, 0x3C53, 0x3C52, 0x3C52, 0x3C53, 0x3C73, 0x4493,
-    0x4473, 0x4473, 0x4473, 0x3C73, 0x3C53, 0x3C52, 0x3452, 0x3452,
-    0x2C31, 0x2C31, 0x2C11, 0x23D0, 0x5475, 0x5475, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5475, 0x5475, 0x5475, 0x5475, 0x5475,
-    0x5475, 0x5495, 0x5475, 0x5475, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5475, 0x5475, 0x5475,
-    0x5475, 0x5475, 0x5475, 0x5C75, 0x5495, 0x5475, 0x5475, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x4C73, 0x234F, 0x3413, 0x3C95,
-    0x3495, 0x3495, 0x3495, 0x2C95, 0x34B5, 0x34B5, 0x2CB5, 0x2CB5,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2495, 0x2495, 0x24B5,
-    0x24B5, 0x2495, 0x2495, 0x24B5, 0x24B5, 0x2495, 0x2495, 0x2495,
-    0x2495, 0x2495, 0x2494, 0x2494, 0x2494, 0x24B5, 0x2CB5, 0x24B5,
-    0x24B5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x24B5,
-    0x24B5, 0x24B4, 0x1CD4, 0x1CD3, 0x24B3, 0x2CB2, 0x3C71, 0x4430,
-    0x5BAE, 0x7B8E, 0xA3CF, 0xC410, 0xDC72, 0xE472, 0xE472, 0xBBF0,
-    0x836D, 0x6BEE, 0x3B8C, 0x2B8C, 0x3471, 0x3CD3, 0x4CF4, 0x4D15,
-    0x4D14, 0x44F4, 0x44F4, 0x3CB3, 0x34B3, 0x3493, 0x3C72, 0x3C72,
-    0x3C92, 0x3472, 0x3452, 0x3432, 0x3411, 0x2C10, 0x2BF0, 0x23F0,
-    0x23D0, 0x1BD0, 0x1BAF, 0x1B8E, 0x134D, 0x0B0C, 0x030C, 0x0B0D,
-    0x130D, 0x12EC, 0x234E, 0x2B6E, 0x2B8F, 0x2B6F, 0x2B6F, 0x2B6F,
-    0x236F, 0x234F, 0x234F, 0x234F, 0x1B4F, 0x236F, 0x236F, 0x2390,
-    0x2BD1, 0x33F1, 0x33F1, 0x33F1, 0x33D1, 0x33D2, 0x33F2, 0x33F2,
-    0x33F2, 0x2BF1, 0x2BF1, 0x2BF1, 0x3412, 0x3412, 0x33F1, 0x33F1,
-    0x2BF1, 0x2BF1, 0x2BF1, 0x23F1, 0x2C11, 0x2C11, 0x2C11, 0x23F1,
-    0x5475, 0x5475, 0x5495, 0x5495, 0x5495, 0x5495, 0x5475, 0x5475,
-    0x5475, 0x5475, 0x5475, 0x5475, 0x5475, 0x5475, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x54B5, 0x54B5, 0x54B5,
-    0x5495, 0x5495, 0x5475, 0x5495, 0x5C75, 0x5475, 0x5475, 0x5C95,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x54B5,
-    0x4453, 0x1B4F, 0x3433, 0x3C75, 0x3495, 0x2C75, 0x3495, 0x3495,
-    0x3495, 0x34B5, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5,
-    0x2495, 0x24B5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x24B5, 0x24B4, 0x24B3, 0x24B3,
-    0x2492, 0x3471, 0x4C30, 0x63AE, 0x7B6D, 0xABAE, 0xD451, 0xEC92,
-    0xEC91, 0xE470, 0xEC71, 0xDC70, 0xA3AE, 0x83AD, 0x4B6B, 0x2B4B,
-    0x2C0F, 0x2411, 0x2C31, 0x2411, 0x2431, 0x2451, 0x2451, 0x2C52,
-    0x1C31, 0x1C11, 0x23F1, 0x1BD0, 0x1BD0, 0x13AF, 0x13B0, 0x1BB0,
-    0x1BD0, 0x1BAF, 0x1390, 0x13B0, 0x1BF0, 0x1C11, 0x2431, 0x2431,
-    0x2431, 0x2431, 0x3473, 0x3493, 0x2C12, 0x1B4F, 0x4453, 0x4C74,
-    0x4C54, 0x4C74, 0x4C74, 0x4C74, 0x4C94, 0x4C74, 0x4474, 0x4474,
-    0x4494, 0x4494, 0x4C95, 0x4C94, 0x4C95, 0x4C94, 0x4474, 0x4474,
-    0x4C95, 0x4C95, 0x4495, 0x4495, 0x4494, 0x3C94, 0x3C94, 0x4494,
-    0x44B4, 0x44B4, 0x4494, 0x4494, 0x3C94, 0x3C94, 0x3C94, 0x3C94,
-    0x3CD4, 0x3CD4, 0x3CD4, 0x3CB4, 0x5475, 0x5475, 0x5495, 0x5495,
-    0x5475, 0x5495, 0x5475, 0x5475, 0x5475, 0x5475, 0x5475, 0x5475,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x54B5, 0x5CB5, 0x5CB6, 0x5CB5, 0x5CB6, 0x5CB6, 0x5C95, 0x5C96,
-    0x5C96, 0x5C95, 0x5C95, 0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5CB6,
-    0x5CB5, 0x5495, 0x5495, 0x54B5, 0x3C33, 0x2370, 0x3454, 0x3475,
-    0x3475, 0x2C55, 0x2C75, 0x3495, 0x3495, 0x3495, 0x34B5, 0x2CB5,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C94, 0x2C94, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x24B5, 0x24B4, 0x24B3, 0x2CB2, 0x3492, 0x4410, 0x5BAE, 0x7B8D,
-    0xABAE, 0xD430, 0xEC91, 0xF491, 0xEC70, 0xEC70, 0xE44F, 0xE470,
-    0xD450, 0x938C, 0x5B6B, 0x3B8C, 0x23AE, 0x13AF, 0x13B0, 0x0B8F,
-    0x0BB0, 0x13D0, 0x13B0, 0x1C11, 0x13F1, 0x13F1, 0x1BF1, 0x2412,
-    0x2452, 0x2C73, 0x2C94, 0x34B4, 0x34B4, 0x3494, 0x34B4, 0x34B4,
-    0x2CB4, 0x2CD4, 0x34D4, 0x34D4, 0x34D4, 0x34D4, 0x34B4, 0x34B5,
-    0x2C33, 0x130F, 0x4454, 0x5475, 0x5475, 0x5475, 0x5475, 0x4C55,
-    0x4C75, 0x4475, 0x4C75, 0x4C95, 0x4475, 0x4495, 0x4C75, 0x4C75,
-    0x4C75, 0x4475, 0x4475, 0x4C75, 0x4475, 0x4474, 0x3C74, 0x3C74,
-    0x3C74, 0x3C74, 0x3C74, 0x3C94, 0x3C94, 0x3C94, 0x3C74, 0x3C94,
-    0x3C94, 0x3C94, 0x3494, 0x3494, 0x34B4, 0x34B4, 0x34B4, 0x34B4,
-    0x5475, 0x5475, 0x5495, 0x5495, 0x5475, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5C95, 0x5C95, 0x5C95, 0x5C95, 0x5C95,
-    0x5C95, 0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB6, 0x5CB6, 0x5CB5,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5C96,
-    0x5C96, 0x5C95, 0x5C95, 0x5C96, 0x5CB5, 0x5495, 0x5495, 0x54B5,
-    0x33F2, 0x2391, 0x3454, 0x3475, 0x3475, 0x2C75, 0x3475, 0x3495,
-    0x3495, 0x3495, 0x3495, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x2C95,
-    0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x3475, 0x3475, 0x2C95, 0x2C95, 0x24B5, 0x24B4, 0x2C93, 0x3C72,
-    0x4C51, 0x5BAF, 0x7B6D, 0xABCF, 0xD430, 0xEC90, 0xEC90, 0xEC4F,
-    0xEC6F, 0xEC90, 0xEC4F, 0xEC70, 0xEC91, 0xABAE, 0x73AD, 0x540E,
-    0x3CB1, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CD5, 0x2C94, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x34D5, 0x2CD5, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB5, 0x2CB4, 0x24B4, 0x2CD4, 0x2CD4, 0x2493,
-    0x2CB3, 0x2CB4, 0x2C94, 0x2C94, 0x2C54, 0x1330, 0x3C13, 0x4C54,
-    0x4C35, 0x5435, 0x4C55, 0x4C55, 0x4C75, 0x4475, 0x4475, 0x4475,
-    0x4475, 0x4475, 0x4C75, 0x4C75, 0x4C75, 0x4C75, 0x4C75, 0x4475,
-    0x4495, 0x3C95, 0x3C75, 0x3C74, 0x3474, 0x3494, 0x3494, 0x3C94,
-    0x3C94, 0x3494, 0x3C94, 0x3494, 0x3494, 0x3494, 0x34B4, 0x34B4,
-    0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x5475, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5C96, 0x5C96, 0x5C96, 0x5C96,
-    0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB5, 0x5CB6, 0x5C95, 0x5C95, 0x5475, 0x5495, 0x5C95,
-    0x5C95, 0x5495, 0x5495, 0x54B5, 0x2BB1, 0x23B1, 0x3C74, 0x3495,
-    0x3475, 0x3475, 0x3475, 0x3495, 0x3475, 0x3495, 0x3495, 0x2C95,
-    0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95,
-    0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x3475, 0x3476, 0x2C96, 0x2CB5,
-    0x2CB5, 0x2CB4, 0x3C73, 0x4C52, 0x63F0, 0x7B6E, 0xA3AF, 0xD451,
-    0xEC90, 0xEC6F, 0xEC6F, 0xEC6F, 0xEC70, 0xEC90, 0xEC70, 0xEC50,
-    0xEC51, 0xC3EF, 0x83AC, 0x640E, 0x4491, 0x2CB3, 0x2CD4, 0x2CF5,
-    0x2CB5, 0x2CD5, 0x2CD5, 0x2CB5, 0x24B4, 0x2CB5, 0x2CB5, 0x2CD5,
-    0x2CD4, 0x24D4, 0x24B4, 0x24B4, 0x24B4, 0x24B4, 0x24B4, 0x2494,
-    0x24B4, 0x2CF5, 0x24B4, 0x1C32, 0x2452, 0x34D4, 0x34D5, 0x34B5,
-    0x2C53, 0x0B0F, 0x33D3, 0x4C55, 0x5435, 0x5435, 0x5436, 0x4C55,
-    0x4C56, 0x4475, 0x4496, 0x4496, 0x4476, 0x4475, 0x4475, 0x4475,
-    0x4C75, 0x4C75, 0x4455, 0x4475, 0x4475, 0x3C75, 0x3C95, 0x3474,
-    0x3494, 0x3494, 0x3494, 0x3494, 0x34B4, 0x3494, 0x3494, 0x3494,
-    0x34B4, 0x34B4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x34B4,
-    0x5475, 0x5495, 0x5495, 0x5495, 0x5495, 0x5496, 0x5C96, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5C95,
-    0x5C95, 0x5C95, 0x5C95, 0x5CB5, 0x5C95, 0x5C95, 0x5CD5, 0x4C94,
-    0x1B4F, 0x2BD2, 0x3C75, 0x3475, 0x3475, 0x2C75, 0x3475, 0x3495,
-    0x3475, 0x3495, 0x3495, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95,
-    0x3476, 0x2C75, 0x2C96, 0x2C95, 0x2CB5, 0x2C73, 0x4452, 0x5BF1,
-    0x7B8F, 0x9B6E, 0xC410, 0xE491, 0xE470, 0xE46F, 0xEC6F, 0xEC6F,
-    0xEC70, 0xEC70, 0xF470, 0xF450, 0xF451, 0xDC30, 0x938C, 0x6BCD,
-    0x4471, 0x2CB3, 0x24B4, 0x24D5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x24D5, 0x24B5, 0x24D5, 0x24D4, 0x24D4, 0x24B5, 0x24B5,
-    0x24B4, 0x24B4, 0x24B4, 0x2CD4, 0x2CD4, 0x2CD4, 0x2493, 0x0BAF,
-    0x138F, 0x1BF1, 0x34B4, 0x34B4, 0x3474, 0x132F, 0x3391, 0x5455,
-    0x5435, 0x5435, 0x4C55, 0x4C75, 0x4C75, 0x4475, 0x4475, 0x4495,
-    0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475,
-    0x3C95, 0x3C95, 0x3495, 0x3494, 0x3495, 0x3495, 0x2CB4, 0x34B4,
-    0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5C96, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5C96, 0x5C96, 0x5CB6, 0x5C96, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5C95, 0x5C95, 0x5C95, 0x5C95, 0x5C95,
-    0x5474, 0x5474, 0x5CB5, 0x4432, 0x1B2F, 0x2BF2, 0x3475, 0x3475,
-    0x3475, 0x2C75, 0x3475, 0x3475, 0x3475, 0x3495, 0x3495, 0x2C95,
-    0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C96, 0x2C75, 0x2CB6, 0x2C95,
-    0x2C94, 0x3C73, 0x5411, 0x6B8F, 0x8B6E, 0xBBEF, 0xDC50, 0xEC70,
-    0xE46F, 0xE46F, 0xE46F, 0xEC70, 0xF470, 0xEC70, 0xEC70, 0xEC70,
-    0xF451, 0xE450, 0xABAD, 0x73AD, 0x4C50, 0x2CB3, 0x24B4, 0x24D5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CD5, 0x24D5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D4, 0x24B4, 0x2494, 0x2CD4,
-    0x2CD4, 0x2CB4, 0x2452, 0x0B6E, 0x02ED, 0x0B4E, 0x2C73, 0x2C94,
-    0x3494, 0x1350, 0x2350, 0x5475, 0x5435, 0x5435, 0x4C55, 0x4C75,
-    0x4475, 0x4475, 0x4495, 0x4495, 0x4475, 0x4475, 0x4475, 0x4475,
-    0x4475, 0x4475, 0x4475, 0x4475, 0x3C95, 0x3C95, 0x3495, 0x3495,
-    0x3495, 0x34B5, 0x2CB4, 0x2CB4, 0x34B4, 0x34B4, 0x34B4, 0x34B4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x2CD4, 0x2CD4, 0x2CD4,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5496, 0x5C96, 0x5C96, 0x5C96,
-    0x5C96, 0x5CB6, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6, 0x5C96, 0x5C96,
-    0x5C96, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5C94, 0x5C95, 0x5C95, 0x5C95, 0x5494, 0x5C94, 0x5CB5, 0x33D1,
-    0x1B2F, 0x3433, 0x3475, 0x3495, 0x3495, 0x3475, 0x3475, 0x3495,
-    0x3475, 0x3495, 0x3495, 0x2C95, 0x2C95, 0x2CB5, 0x34B5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CD5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2C95, 0x2C95, 0x2CB6, 0x2CB5, 0x3473, 0x4C52, 0x63B0, 0x7B6E,
-    0xABCF, 0xD450, 0xEC90, 0xEC4F, 0xEC6F, 0xEC6F, 0xE46F, 0xE46F,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xF451, 0xEC71, 0xBBEE, 0x838D,
-    0x5450, 0x34B2, 0x24B4, 0x24D5, 0x2CB5, 0x2CB6, 0x2CB5, 0x2CB5,
-    0x24B5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5,
-    0x24D4, 0x24D4, 0x24B4, 0x24D5, 0x24D4, 0x2CB4, 0x2473, 0x13D0,
-    0x136F, 0x13B0, 0x2C73, 0x2C94, 0x34B5, 0x1370, 0x1B2F, 0x5475,
-    0x5435, 0x5435, 0x4C55, 0x4C76, 0x4475, 0x4475, 0x4475, 0x4475,
-    0x4495, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475,
-    0x3C95, 0x3C95, 0x3495, 0x3495, 0x3495, 0x34B5, 0x2CB4, 0x34B4,
-    0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CD4, 0x2CD4, 0x2CD4, 0x2CD4, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5C95, 0x5495, 0x5495, 0x5C95, 0x5C95, 0x5C96,
-    0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5C94, 0x5C94, 0x5C94, 0x5C95, 0x5C95,
-    0x5494, 0x5CB5, 0x5CB4, 0x2B90, 0x1B4F, 0x3C74, 0x3475, 0x3495,
-    0x3475, 0x2C95, 0x3495, 0x3495, 0x3475, 0x3495, 0x3495, 0x2C95,
-    0x2C95, 0x2CB5, 0x34B5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2C95, 0x2C96, 0x24B5, 0x2C94,
-    0x3C52, 0x5C11, 0x736E, 0x9B8E, 0xCC70, 0xE470, 0xEC4F, 0xEC2F,
-    0xEC6F, 0xEC6F, 0xE470, 0xE470, 0xEC70, 0xEC71, 0xE470, 0xEC70,
-    0xEC50, 0xEC71, 0xD42F, 0x8B6C, 0x5C0F, 0x3C92, 0x24B3, 0x24D5,
-    0x24B6, 0x24B6, 0x2CB5, 0x24B5, 0x24D5, 0x24D5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D4, 0x24B4, 0x24D5,
-    0x24B4, 0x24B4, 0x2CD4, 0x2C73, 0x3494, 0x34B4, 0x2CB4, 0x2C94,
-    0x34B5, 0x1390, 0x1B30, 0x4C55, 0x5455, 0x5435, 0x4C56, 0x4C75,
-    0x4476, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475,
-    0x4475, 0x4475, 0x4475, 0x4475, 0x3C95, 0x3C95, 0x3C95, 0x3495,
-    0x3495, 0x34B5, 0x2CB4, 0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x34B4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x2CD4, 0x2CD4, 0x2CD4,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5475,
-    0x5475, 0x5495, 0x5C95, 0x5C95, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6,
-    0x5C96, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB4, 0x5CB4, 0x5C94,
-    0x5C94, 0x5C74, 0x5C94, 0x5C94, 0x5474, 0x5494, 0x4C73, 0x232E,
-    0x2370, 0x3C94, 0x3474, 0x3495, 0x2C75, 0x2C95, 0x3475, 0x3495,
-    0x3475, 0x3495, 0x3495, 0x2C95, 0x2C95, 0x2CB5, 0x2C95, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x24B6, 0x2CB5, 0x2474, 0x3453, 0x5431, 0x6BCF, 0x8B6E, 0xBC0F,
-    0xE491, 0xEC4F, 0xEC2F, 0xF44F, 0xF44F, 0xEC6F, 0xEC70, 0xEC91,
-    0xEC70, 0xEC91, 0xEC71, 0xEC71, 0xEC50, 0xEC71, 0xDC50, 0x934C,
-    0x63CF, 0x4472, 0x2CB3, 0x24D5, 0x24B6, 0x24B6, 0x24B5, 0x24D5,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5,
-    0x24F5, 0x24D5, 0x24D5, 0x24D5, 0x24B5, 0x24B5, 0x2CD5, 0x2CD5,
-    0x34B5, 0x34D5, 0x2CB5, 0x24B5, 0x2CD5, 0x1BD2, 0x1B2F, 0x4C55,
-    0x5456, 0x5436, 0x4C56, 0x4C56, 0x4476, 0x4476, 0x4476, 0x4476,
-    0x4476, 0x4475, 0x4476, 0x4475, 0x4476, 0x4475, 0x4476, 0x4475,
-    0x3C95, 0x3C95, 0x3C75, 0x3495, 0x3495, 0x3495, 0x2CB4, 0x34B4,
-    0x34B4, 0x34B4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5495, 0x5C95, 0x5C95, 0x5C95, 0x5C95, 0x5C95, 0x5C95,
-    0x5C96, 0x5C96, 0x5CB6, 0x5CB6, 0x5C96, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB5, 0x5C95, 0x5CB5, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x5CB4, 0x5CB4, 0x5CB4, 0x5C94, 0x5C94, 0x5453, 0x5474,
-    0x5474, 0x5494, 0x4C32, 0x1B0E, 0x23B0, 0x3C94, 0x3474, 0x3495,
-    0x2C75, 0x2C75, 0x2C75, 0x2C75, 0x3475, 0x3495, 0x2C95, 0x2C95,
-    0x2C95, 0x2CB5, 0x2C95, 0x2C95, 0x2CB5, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2495, 0x2CB5, 0x2C74, 0x4432,
-    0x63F0, 0x7B6E, 0xABAE, 0xDC71, 0xEC90, 0xEC4F, 0xF44F, 0xF470,
-    0xF450, 0xEC70, 0xEC91, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC50, 0xEC71, 0xE450, 0x9B4C, 0x63AE, 0x4C51, 0x2CB3, 0x24D5,
-    0x24B6, 0x1CB6, 0x1CD5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x1CD5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x2CD5, 0x2CB5, 0x34B5, 0x2CB4, 0x2CD5, 0x24D5,
-    0x2CD5, 0x1C13, 0x130F, 0x4C55, 0x5456, 0x5436, 0x4C56, 0x4C56,
-    0x4476, 0x4476, 0x4476, 0x4475, 0x4475, 0x4475, 0x4455, 0x4475,
-    0x4475, 0x4475, 0x4475, 0x4475, 0x3C75, 0x3C95, 0x3495, 0x3495,
-    0x3495, 0x3495, 0x2C94, 0x2CB4, 0x34B4, 0x34B4, 0x34B4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x5495, 0x5495, 0x5495, 0x5495, 0x5495, 0x5C95, 0x5C95, 0x5C95,
-    0x5C95, 0x5C95, 0x5C95, 0x5C96, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5C95, 0x5C95, 0x5CB5,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB5, 0x5CB5, 0x5C95, 0x5CB5, 0x5CB5, 0x5CB5, 0x5C94, 0x5C94,
-    0x5C95, 0x5C94, 0x4C13, 0x5453, 0x5474, 0x5494, 0x4412, 0x1B0E,
-    0x33F1, 0x3C74, 0x3474, 0x3495, 0x2C95, 0x2C75, 0x2C75, 0x2C75,
-    0x3495, 0x2C75, 0x2C75, 0x2C95, 0x2C95, 0x2CB5, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x2C95, 0x2CB5,
-    0x2495, 0x2CB5, 0x3474, 0x4C32, 0x73B0, 0x936E, 0xC40F, 0xEC91,
-    0xEC70, 0xEC4F, 0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC50,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE471, 0xEC91, 0xEC71, 0xAB6D,
-    0x6B6E, 0x5431, 0x34B4, 0x24D5, 0x1CD6, 0x1CB6, 0x1CD5, 0x1CD5,
-    0x24D5, 0x24D5, 0x24B5, 0x24B5, 0x24D5, 0x24B5, 0x24B5, 0x24D5,
-    0x24D5, 0x24B5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x2CB5, 0x2CB5,
-    0x34D5, 0x2CB5, 0x2CD5, 0x2CD5, 0x2CD5, 0x2453, 0x130F, 0x4C34,
-    0x5455, 0x5435, 0x4C55, 0x4C75, 0x4475, 0x4475, 0x4475, 0x4475,
-    0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475,
-    0x3C95, 0x3C95, 0x3495, 0x3495, 0x3495, 0x2C94, 0x2C94, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CD4, 0x2CB4, 0x2CB4, 0x2CB4, 0x5495, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5C95, 0x5C95, 0x5C95, 0x5C96, 0x5C96, 0x5C95, 0x5C95,
-    0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5C95, 0x5CB5, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5C95, 0x5C94,
-    0x5C94, 0x5C94, 0x5494, 0x5C94, 0x5C94, 0x5474, 0x43B1, 0x4C13,
-    0x5453, 0x5494, 0x3BD1, 0x1B0E, 0x3C32, 0x3C94, 0x3474, 0x3475,
-    0x2C75, 0x2C75, 0x2C75, 0x2C95, 0x2C95, 0x2C75, 0x2C75, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB5,
-    0x2C95, 0x2CB5, 0x2C95, 0x2C95, 0x2CB5, 0x2C94, 0x3C32, 0x5BF1,
-    0x838F, 0xAB8E, 0xDC50, 0xEC50, 0xEC4F, 0xEC70, 0xEC90, 0xEC90,
-    0xEC70, 0xEC50, 0xEC51, 0xEC71, 0xEC71, 0xE471, 0xEC91, 0xE471,
-    0xE471, 0xEC71, 0xEC71, 0xB38E, 0x736E, 0x5431, 0x34B3, 0x24D5,
-    0x1CD5, 0x14B6, 0x1CD5, 0x1CD5, 0x24D5, 0x24D5, 0x24B5, 0x2CD5,
-    0x24D5, 0x24B5, 0x24B5, 0x24D5, 0x24D5, 0x24D5, 0x2CD5, 0x24D5,
-    0x24B5, 0x24B5, 0x2CB5, 0x2CD5, 0x2CB5, 0x34D5, 0x24D5, 0x24D5,
-    0x2CD5, 0x2C74, 0x1B50, 0x3BF3, 0x5455, 0x5455, 0x4C55, 0x4C55,
-    0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475,
-    0x4475, 0x4475, 0x4475, 0x4495, 0x3C95, 0x3C95, 0x3495, 0x3494,
-    0x3495, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x5475, 0x5495, 0x5495, 0x5475, 0x5475, 0x5C95, 0x5C95, 0x5C96,
-    0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB6, 0x5CB6,
-    0x5CB5, 0x5CB5, 0x5C95, 0x5C94, 0x5C94, 0x5C94, 0x5494, 0x5474,
-    0x5C94, 0x5C94, 0x5474, 0x5494, 0x5474, 0x5494, 0x2B70, 0x232E,
-    0x3C74, 0x3C74, 0x3495, 0x3495, 0x2C95, 0x2C75, 0x2C95, 0x2C95,
-    0x2C95, 0x2C75, 0x2C75, 0x2C75, 0x2C95, 0x2C95, 0x2C95, 0x2CB5,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C94, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2C95, 0x3C73, 0x5432, 0x6B8F, 0x9B8F, 0xD431, 0xE450, 0xE44F,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE450, 0xC3EF,
-    0x7B4D, 0x5C31, 0x3CB3, 0x24F5, 0x1CD5, 0x1CD6, 0x1CD5, 0x1CD5,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24B5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x24D5, 0x24F5, 0x2CD5, 0x2CB5, 0x23B1, 0x2BD2,
-    0x4C75, 0x4C35, 0x4C55, 0x4C75, 0x4455, 0x4475, 0x4475, 0x4495,
-    0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x4475, 0x3C75,
-    0x3C95, 0x3CB5, 0x3495, 0x3495, 0x3495, 0x2C94, 0x2C94, 0x34B4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CD4, 0x2CB4, 0x2CB4, 0x2CB4, 0x5475, 0x5495, 0x5495, 0x5495,
-    0x5495, 0x5C95, 0x5C95, 0x5C95, 0x5C96, 0x5C96, 0x5C96, 0x5C96,
-    0x5C96, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x5CB4, 0x5C94, 0x5474, 0x5474, 0x5494, 0x5494, 0x5494,
-    0x5474, 0x4C73, 0x2B4F, 0x234F, 0x3C53, 0x3474, 0x3474, 0x3495,
-    0x2C96, 0x2C96, 0x2C96, 0x2C96, 0x2C95, 0x2C95, 0x2C75, 0x2C74,
-    0x2C75, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2495, 0x2495, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2CB4, 0x2CB5,
-    0x2CB5, 0x2495, 0x2495, 0x2C95, 0x3494, 0x4453, 0x63F1, 0x838F,
-    0xBBD0, 0xE451, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC50, 0xC3EF, 0x834D, 0x6410, 0x3CB3, 0x24F5,
-    0x1CD5, 0x1CD6, 0x1CD5, 0x24D6, 0x24D5, 0x24D5, 0x24D5, 0x24D4,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24B5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x2CD5, 0x2CD5, 0x2CB5, 0x2CD5, 0x24D5, 0x24D5,
-    0x2CD5, 0x2CD5, 0x23F2, 0x2BB2, 0x4C75, 0x4C35, 0x4C55, 0x4C55,
-    0x4455, 0x4475, 0x3C75, 0x3C95, 0x3C95, 0x3C75, 0x4475, 0x4475,
-    0x4475, 0x4475, 0x3C75, 0x3C95, 0x3495, 0x3495, 0x3495, 0x3494,
-    0x3494, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x5495, 0x5C95, 0x5C96, 0x5C96, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5C96, 0x5C96, 0x5C96, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB5, 0x5CB5, 0x64D5, 0x64D5,
-    0x5CB5, 0x5CB5, 0x5CB6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB4, 0x5C94,
-    0x5494, 0x5494, 0x54B4, 0x4C94, 0x4C94, 0x4453, 0x234F, 0x2390,
-    0x3C94, 0x3474, 0x3474, 0x2C75, 0x2C75, 0x2C75, 0x2C96, 0x2CB6,
-    0x34B6, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x3495, 0x2C95, 0x2C95,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2495, 0x2495, 0x2CB5, 0x2CB5, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB5, 0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x3C94, 0x4C32, 0x6BB0, 0x9BB0, 0xCC31, 0xEC92, 0xEC71, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC50, 0xEC71, 0xCC10,
-    0x8B4D, 0x6BEF, 0x3C92, 0x2CF4, 0x24D5, 0x24D5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x24B4, 0x24D4, 0x24D5, 0x24D5, 0x24B5, 0x24B5,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x2CD5,
-    0x2CD5, 0x2CD5, 0x2CF5, 0x24D5, 0x24D5, 0x2CD5, 0x2412, 0x2391,
-    0x4C75, 0x4C55, 0x4C55, 0x4C55, 0x4475, 0x4475, 0x3C95, 0x3C95,
-    0x3C95, 0x3C75, 0x3C75, 0x3C75, 0x3C75, 0x3C75, 0x3C75, 0x3C95,
-    0x3495, 0x3495, 0x3495, 0x3474, 0x3494, 0x2C94, 0x2C94, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x5C95, 0x5C96, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CD6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x5CB5, 0x5CB5, 0x64D6, 0x64D6,
-    0x64D6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB4, 0x5CB5, 0x54B4, 0x54B4, 0x4C94,
-    0x54B4, 0x4473, 0x1B2E, 0x23B0, 0x3C94, 0x3494, 0x3474, 0x3495,
-    0x2C95, 0x2C95, 0x2C95, 0x2CB6, 0x34B6, 0x2CB5, 0x2C95, 0x2C95,
-    0x2C75, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2495, 0x2C95, 0x2495, 0x2495, 0x2495, 0x24B5, 0x2CB5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2CB6, 0x2CB5, 0x2CB5, 0x34B5, 0x4453, 0x53F0, 0x7B8F, 0xB410,
-    0xDC72, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC50, 0xEC71, 0xD430, 0x934D, 0x6BCF, 0x4492, 0x2CD4,
-    0x24D5, 0x24D5, 0x24B5, 0x2CD5, 0x24D5, 0x24D5, 0x24D4, 0x24D4,
-    0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x24D5, 0x2CD5, 0x2CD5, 0x2CB5, 0x24F5, 0x24F5,
-    0x24D5, 0x2CB4, 0x2C33, 0x2391, 0x4C75, 0x4C55, 0x4C55, 0x4C55,
-    0x4475, 0x4495, 0x3C95, 0x3C95, 0x3C95, 0x3C95, 0x3C75, 0x3C75,
-    0x3C75, 0x3C95, 0x3C94, 0x3494, 0x3495, 0x3CB5, 0x3495, 0x2C74,
-    0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x5C96, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x64D6,
-    0x64B6, 0x64B6, 0x64B6, 0x64B6, 0x64B6, 0x64B6, 0x64B5, 0x64B5,
-    0x64B5, 0x64B5, 0x64B5, 0x64D5, 0x64D6, 0x5CB6, 0x64D6, 0x64D6,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CB4,
-    0x5CB4, 0x54B4, 0x54B4, 0x54D4, 0x54D5, 0x3C73, 0x130D, 0x23D0,
-    0x3473, 0x3473, 0x2C74, 0x2C95, 0x2CB5, 0x2C95, 0x2C95, 0x2CB5,
-    0x2CB6, 0x34B5, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2C95, 0x2C94, 0x2C95, 0x2C95, 0x2C95, 0x2C95, 0x2C95,
-    0x2C95, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CD5,
-    0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x3473,
-    0x4C32, 0x63AF, 0x93AF, 0xCC51, 0xE492, 0xEC71, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC50, 0xEC50, 0xF471, 0xDC50,
-    0x9B4D, 0x73AE, 0x4471, 0x2CD3, 0x2CD4, 0x24D5, 0x2CB5, 0x2CD5,
-    0x24D5, 0x24D5, 0x24D4, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5,
-    0x2CD5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x2CD5,
-    0x2CD5, 0x2CB5, 0x24D5, 0x24F5, 0x24D5, 0x2494, 0x2C74, 0x1B91,
-    0x4454, 0x4C55, 0x4C55, 0x4C55, 0x4475, 0x4475, 0x3C95, 0x3C95,
-    0x3495, 0x3495, 0x3C95, 0x3C95, 0x3C95, 0x3C95, 0x3495, 0x3494,
-    0x3494, 0x3CB5, 0x3494, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6, 0x5CB6,
-    0x64B6, 0x64B6, 0x64D6, 0x64D6, 0x64B6, 0x64B6, 0x64B6, 0x64B6,
-    0x64B6, 0x64B6, 0x64B5, 0x64B5, 0x64B5, 0x64D6, 0x64D6, 0x64D6,
-    0x64B6, 0x5CB6, 0x64B6, 0x5CB6, 0x5CB5, 0x5CB5, 0x64B5, 0x5CB5,
-    0x5CB5, 0x5CB5, 0x5CB5, 0x5CD5, 0x5CB5, 0x5CD5, 0x54D5, 0x54F5,
-    0x4CD4, 0x3C32, 0x132D, 0x2C11, 0x3C94, 0x3494, 0x2C94, 0x2C94,
-    0x2C95, 0x2C95, 0x2CB5, 0x2CB5, 0x34B5, 0x34B5, 0x34B5, 0x3495,
-    0x2C94, 0x2C94, 0x2C95, 0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2C94,
-    0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2C94,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB5, 0x2CB5, 0x2C95,
-    0x2C95, 0x2C95, 0x3474, 0x3C32, 0x5BF1, 0x7BAF, 0xB410, 0xE492,
-    0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC50, 0xEC30, 0xF471, 0xE451, 0xA32D, 0x736E, 0x4C51, 0x2CB3,
-    0x2CD4, 0x2CD5, 0x2CB5, 0x2CB5, 0x24B5, 0x24D5, 0x24D5, 0x24D5,
-    0x24D5, 0x24D5, 0x24D5, 0x24B5, 0x24B5, 0x24B5, 0x24B5, 0x24D5,
-    0x24D5, 0x24D5, 0x2CD5, 0x2CD5, 0x2CD5, 0x2CD5, 0x2CD5, 0x24D5,
-    0x24D5, 0x2CB4, 0x2C94, 0x1B91, 0x3C34, 0x4C55, 0x4C55, 0x4C55,
-    0x4475, 0x3C75, 0x3C95, 0x3CB5, 0x3495, 0x3495, 0x3495, 0x3C95,
-    0x3C95, 0x3495, 0x3494, 0x3494, 0x3494, 0x34B4, 0x3494, 0x2C94,
-    0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x5CB6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x64B6, 0x64B6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64B6, 0x64B6, 0x64D6, 0x64D6, 0x64B6, 0x64B6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64B5, 0x64B5, 0x64B5, 0x64B5,
-    0x5CB5, 0x64D5, 0x64D5, 0x5CB5, 0x5CB5, 0x5CB5, 0x5CD5, 0x5CD5,
-    0x5CD5, 0x5CF5, 0x5CD5, 0x54D4, 0x4CB4, 0x2BF0, 0x132D, 0x3431,
-    0x3CB3, 0x34B4, 0x3493, 0x2C94, 0x2C74, 0x2C94, 0x34B4, 0x34D5,
-    0x34D5, 0x34B4, 0x34B4, 0x34B4, 0x3494, 0x3494, 0x3494, 0x3494,
-    0x3494, 0x3494, 0x3494, 0x3494, 0x3494, 0x3494, 0x3494, 0x3494,
-    0x3494, 0x3494, 0x3494, 0x2C94, 0x34B4, 0x2CB4, 0x34B4, 0x34B4,
-    0x34B4, 0x3494, 0x34B5, 0x34D5, 0x34D5, 0x3494, 0x3C73, 0x5452,
-    0x6BCF, 0x9BEF, 0xCC71, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xEC30, 0xF471, 0xE451,
-    0xAB2D, 0x7B6E, 0x4C31, 0x2C93, 0x24B4, 0x2CD5, 0x2CB5, 0x2CB5,
-    0x24B5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24D5, 0x24B5, 0x24B5,
-    0x24B5, 0x24B5, 0x24B5, 0x24B5, 0x24B5, 0x24B5, 0x24B5, 0x2CD5,
-    0x2CD5, 0x2CF6, 0x24D5, 0x2CD5, 0x2CD5, 0x2CB5, 0x34B5, 0x1B91,
-    0x3C14, 0x4C55, 0x4C55, 0x4455, 0x4475, 0x3C75, 0x3C95, 0x3495,
-    0x3495, 0x3495, 0x3495, 0x3495, 0x3495, 0x3495, 0x3495, 0x34B5,
-    0x34B4, 0x34B4, 0x3494, 0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x5CB6, 0x5CD6, 0x5CD6, 0x5CB6,
-    0x5CB6, 0x5CD6, 0x64B6, 0x64B6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x5CB6, 0x5CB6, 0x5CB6, 0x64B6, 0x64D6, 0x64D6,
-    0x64B6, 0x64B6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64B5, 0x64B5, 0x64B5, 0x64B5, 0x5CB5, 0x64D5, 0x64D5, 0x5CD5,
-    0x5CB5, 0x5CB5, 0x64D5, 0x64D5, 0x5CD5, 0x5CD5, 0x54D4, 0x54B3,
-    0x4C93, 0x2BAF, 0x12EC, 0x2BF0, 0x3432, 0x3452, 0x3452, 0x2C52,
-    0x2C53, 0x2C53, 0x2C73, 0x2C73, 0x2C53, 0x2C52, 0x2C32, 0x2C32,
-    0x2412, 0x2412, 0x2412, 0x2412, 0x2411, 0x2411, 0x2411, 0x23F1,
-    0x23F1, 0x23F1, 0x23F1, 0x23F1, 0x23F1, 0x23F1, 0x2411, 0x2411,
-    0x2411, 0x2412, 0x2432, 0x2C32, 0x2C32, 0x2412, 0x2432, 0x2C53,
-    0x2C53, 0x2C11, 0x3BD0, 0x538F, 0x83AE, 0xB40F, 0xE4B1, 0xEC91,
-    0xEC70, 0xF471, 0xEC50, 0xEC50, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC51, 0xEC30, 0xF471, 0xE451, 0xAB4D, 0x834E, 0x5431, 0x3493,
-    0x2CB4, 0x2CD5, 0x2CB5, 0x2CB5, 0x2CB5, 0x24D5, 0x24D5, 0x24D5,
-    0x2CD5, 0x2CB5, 0x24B5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5, 0x2CB5,
-    0x2494, 0x24B4, 0x2494, 0x2CB5, 0x2CB5, 0x2CB5, 0x2494, 0x2CD5,
-    0x2CD5, 0x2CB5, 0x34B5, 0x23B1, 0x3C13, 0x4C55, 0x4C55, 0x4455,
-    0x4475, 0x3C74, 0x3C95, 0x3494, 0x34B5, 0x34B5, 0x3494, 0x3494,
-    0x3C94, 0x3494, 0x3C95, 0x3CB4, 0x3CB5, 0x3CB4, 0x34B4, 0x2C94,
-    0x2C94, 0x2C94, 0x2494, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x64D6, 0x64D6, 0x64D6, 0x5CB6, 0x5CB6, 0x5CD6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64B6, 0x64D6, 0x64D6, 0x64B6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64B6, 0x64D6, 0x64D6, 0x64B6, 0x64B5, 0x64B5, 0x64B5, 0x64B5,
-    0x64D5, 0x5CD5, 0x64D5, 0x64D5, 0x64B5, 0x5CB5, 0x64D5, 0x64D5,
-    0x5CD5, 0x64D5, 0x5CD4, 0x54B4, 0x4C73, 0x236E, 0x0AAB, 0x1B2D,
-    0x130C, 0x132D, 0x134D, 0x134E, 0x1B6E, 0x1B8F, 0x1B8F, 0x136F,
-    0x1B8F, 0x1B6F, 0x1B8F, 0x1B8F, 0x1B8F, 0x238F, 0x238F, 0x23AF,
-    0x238F, 0x23AF, 0x23AF, 0x23B0, 0x23B0, 0x23B0, 0x2BB0, 0x2BD0,
-    0x2BD0, 0x2BD0, 0x2BD0, 0x2BD0, 0x2BD0, 0x23B0, 0x1B6F, 0x134E,
-    0x1B4E, 0x132E, 0x134F, 0x136F, 0x136E, 0x1B2D, 0x2AAB, 0x52CB,
-    0x9B8E, 0xD471, 0xE491, 0xEC70, 0xEC70, 0xEC70, 0xEC51, 0xEC51,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC50, 0xF451, 0xF430, 0xEC51,
-    0xBB6E, 0x834D, 0x5C31, 0x3493, 0x2CB4, 0x2CD5, 0x2C94, 0x34B5,
-    0x2CD5, 0x34F5, 0x2CF5, 0x2CD4, 0x34D5, 0x2CB5, 0x2CD5, 0x2CB4,
-    0x34D5, 0x34D5, 0x34B5, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2C74, 0x0BB0, 0x13F1, 0x2CB4, 0x34D5, 0x34B4, 0x2C12,
-    0x3412, 0x4C75, 0x4C75, 0x4474, 0x4474, 0x3C54, 0x3C74, 0x3C94,
-    0x3494, 0x3CB5, 0x3C94, 0x3C94, 0x44B5, 0x3C94, 0x3C74, 0x3C94,
-    0x3CB4, 0x3CB4, 0x34B4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64F6, 0x64D6, 0x64B6, 0x64D6,
-    0x6CF6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x6CD6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D5, 0x64D5, 0x64D5, 0x64D5,
-    0x64D5, 0x64D5, 0x64D5, 0x64D5, 0x64F5, 0x5CD5, 0x5CB4, 0x54B4,
-    0x5493, 0x232D, 0x2B6E, 0x4C72, 0x3C31, 0x4451, 0x3C31, 0x4451,
-    0x4472, 0x4472, 0x4452, 0x4C93, 0x4493, 0x4C93, 0x4CB3, 0x4CB3,
-    0x4CB4, 0x4CB4, 0x4CB4, 0x4CD4, 0x54F4, 0x54F4, 0x54F4, 0x54F4,
-    0x54F4, 0x5D15, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x54F5, 0x54D4, 0x54D4, 0x4CB4, 0x44B4, 0x3CB3,
-    0x4493, 0x4C31, 0x5B8E, 0x7B0C, 0xB3CF, 0xDC70, 0xE470, 0xEC70,
-    0xEC90, 0xEC70, 0xF471, 0xF471, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xEC71, 0xEC71,
-    0xEC50, 0xF451, 0xF430, 0xEC51, 0xC3AF, 0x8B2D, 0x5BF0, 0x3C72,
-    0x2C73, 0x2C73, 0x2C94, 0x2C73, 0x2C73, 0x2C73, 0x2472, 0x2472,
-    0x2C93, 0x2C53, 0x2C73, 0x3493, 0x34B4, 0x34B4, 0x3494, 0x2C73,
-    0x2C93, 0x2C93, 0x2CB4, 0x34B4, 0x34B4, 0x2C53, 0x034E, 0x034E,
-    0x1C11, 0x2CB3, 0x3CD4, 0x2C32, 0x33F1, 0x4474, 0x4474, 0x4453,
-    0x4473, 0x3C73, 0x3C94, 0x3C94, 0x3473, 0x3C94, 0x3C94, 0x44B4,
-    0x4494, 0x3C93, 0x44B4, 0x3CB4, 0x3CB4, 0x3C94, 0x34B4, 0x34B4,
-    0x2C93, 0x2493, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x64D6, 0x64D6, 0x64D6, 0x64F6, 0x64F6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64F6, 0x64D6, 0x6CF6, 0x6CF6, 0x64D6,
-    0x6CD6, 0x6CD6, 0x6CD6, 0x6CD6, 0x64D6, 0x64D5, 0x64D6, 0x64D6,
-    0x64D6, 0x64D5, 0x64D5, 0x64D5, 0x5CB5, 0x5CB5, 0x64D5, 0x64D5,
-    0x64F5, 0x64D5, 0x64D5, 0x64D4, 0x5CB4, 0x230D, 0x4C51, 0x7596,
-    0x6D55, 0x6D35, 0x7596, 0x7DB7, 0x7597, 0x75B7, 0x7597, 0x6D96,
-    0x7597, 0x7597, 0x7597, 0x7597, 0x6D76, 0x6D76, 0x6D56, 0x6D56,
-    0x6556, 0x6556, 0x6556, 0x6555, 0x6535, 0x6556, 0x6D56, 0x6D76,
-    0x6D76, 0x6D76, 0x6D76, 0x6D76, 0x6D77, 0x7597, 0x7597, 0x7597,
-    0x75B7, 0x6DB7, 0x6597, 0x6576, 0x6D76, 0x7D14, 0x8C10, 0x934D,
-    0xCC0F, 0xE450, 0xE44F, 0xE46F, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC50, 0xF450, 0xF450, 0xEC71,
-    0xC38E, 0x8AEB, 0x534D, 0x2B6E, 0x1BAF, 0x138F, 0x1B90, 0x136F,
-    0x136F, 0x136F, 0x136E, 0x0B6E, 0x136E, 0x134E, 0x132E, 0x136E,
-    0x136F, 0x138F, 0x1B8F, 0x23D0, 0x2C31, 0x2C52, 0x2C72, 0x3493,
-    0x3493, 0x34B3, 0x2431, 0x2411, 0x2C72, 0x34B3, 0x3CD4, 0x3452,
-    0x2BF1, 0x4493, 0x4CB4, 0x4CB4, 0x4CD4, 0x4CB4, 0x4CD4, 0x44B4,
-    0x44D4, 0x44B4, 0x4493, 0x4493, 0x4473, 0x4473, 0x3C72, 0x3411,
-    0x2C11, 0x23D0, 0x2411, 0x2C93, 0x2CB4, 0x2CB4, 0x2CB4, 0x24B4,
-    0x2CB4, 0x2CB4, 0x2C94, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2C94, 0x64D6, 0x64F6, 0x64F6, 0x64F6,
-    0x64F7, 0x64F7, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D6, 0x64D6, 0x64D6, 0x64F6, 0x64D6, 0x64F6, 0x6CF6, 0x6CF6,
-    0x6CF6, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CF6, 0x6CD6,
-    0x6CD6, 0x6CD6, 0x6CD6, 0x6CF6, 0x64F6, 0x64D5, 0x64D5, 0x5CB5,
-    0x5CB4, 0x5CB5, 0x64D5, 0x64F5, 0x64D5, 0x64F5, 0x64D4, 0x64F5,
-    0x5C93, 0x2B0D, 0x5CB3, 0x7DB6, 0x7555, 0x7555, 0x64F4, 0x4C31,
-    0x64D3, 0x7D96, 0x7DB7, 0x7576, 0x7576, 0x7576, 0x7556, 0x7556,
-    0x7536, 0x7536, 0x7536, 0x6D36, 0x6D56, 0x6D56, 0x6D56, 0x6D35,
-    0x6535, 0x6D35, 0x6D56, 0x6D56, 0x6D36, 0x6D56, 0x6D56, 0x6D36,
-    0x6D36, 0x6D36, 0x6D35, 0x6515, 0x6515, 0x4C72, 0x33CF, 0x5492,
-    0x7514, 0x8492, 0x8B6D, 0xAB8D, 0xE450, 0xEC50, 0xE46F, 0xEC90,
-    0xEC91, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC50, 0xEC50, 0xF471, 0xCB6D, 0x92CB, 0x636D, 0x3BAE,
-    0x3410, 0x2C31, 0x3432, 0x3452, 0x3C52, 0x3C52, 0x3C92, 0x3C72,
-    0x3452, 0x3431, 0x3411, 0x3411, 0x2C11, 0x23D0, 0x1B6E, 0x134E,
-    0x136E, 0x136E, 0x138E, 0x1BAF, 0x23CF, 0x2C10, 0x2C31, 0x3451,
-    0x2C51, 0x2C51, 0x3472, 0x3431, 0x2BD0, 0x3C52, 0x4473, 0x4473,
-    0x4472, 0x4452, 0x3C52, 0x3C51, 0x3411, 0x3410, 0x2BD0, 0x2BAF,
-    0x33D0, 0x3C31, 0x3C31, 0x33F0, 0x3431, 0x1B8F, 0x1B8F, 0x2C72,
-    0x2CB3, 0x2CB3, 0x2CB4, 0x2493, 0x2CB4, 0x2CB4, 0x2C94, 0x2C94,
-    0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2C94,
-    0x64F7, 0x64F7, 0x64F7, 0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64F6,
-    0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64D6, 0x64F6, 0x64F6,
-    0x64F6, 0x64F6, 0x64D5, 0x64F6, 0x6D16, 0x6CF6, 0x6CF6, 0x6D16,
-    0x6D16, 0x6CF6, 0x6CF6, 0x64D6, 0x6CF6, 0x6CF6, 0x6CF6, 0x64D6,
-    0x64F6, 0x64D5, 0x64D5, 0x64B5, 0x5CB5, 0x64D5, 0x64D5, 0x64F5,
-    0x64D5, 0x6D16, 0x6CF5, 0x6CF5, 0x5452, 0x2B2D, 0x64F4, 0x7D76,
-    0x7555, 0x7D76, 0x64B3, 0x332D, 0x2B0C, 0x64B3, 0x7D76, 0x7D56,
-    0x7556, 0x7556, 0x7556, 0x7555, 0x7536, 0x7536, 0x7556, 0x7556,
-    0x6D56, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D15, 0x6515, 0x64F5, 0x5CD4,
-    0x6515, 0x4431, 0x1ACB, 0x438E, 0x7492, 0x83EF, 0x932C, 0xCC0F,
-    0xE470, 0xEC70, 0xEC70, 0xEC90, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC91, 0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xF471,
-    0xD3CE, 0x9AEB, 0x8C71, 0x7D14, 0x6D56, 0x5D76, 0x5D56, 0x5D56,
-    0x6576, 0x6556, 0x6596, 0x6596, 0x6556, 0x6556, 0x6556, 0x5D35,
-    0x5D35, 0x5515, 0x54F4, 0x4CD4, 0x4CB3, 0x3C72, 0x3430, 0x2C10,
-    0x2BEF, 0x23CF, 0x23AF, 0x23CF, 0x1BAF, 0x1BAF, 0x23CF, 0x238E,
-    0x1B6E, 0x2BAF, 0x2BCF, 0x33AF, 0x33AF, 0x2BAF, 0x2BAF, 0x33F0,
-    0x3411, 0x4472, 0x4CB3, 0x4CD3, 0x54D4, 0x5D15, 0x5514, 0x54F4,
-    0x5D56, 0x2C11, 0x136E, 0x2C52, 0x2C93, 0x2C93, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x64F6, 0x64F6, 0x64D6, 0x64D6,
-    0x64F6, 0x64F6, 0x6517, 0x6517, 0x64F6, 0x64F6, 0x6D16, 0x64F6,
-    0x6CF6, 0x6CF6, 0x6CF6, 0x64F6, 0x64F6, 0x6D16, 0x6D16, 0x64F6,
-    0x64F6, 0x6D16, 0x6CF6, 0x6CF6, 0x6CF6, 0x64D6, 0x64D5, 0x64D5,
-    0x64D5, 0x64D6, 0x64D6, 0x64D5, 0x64D5, 0x64D5, 0x64D5, 0x64D5,
-    0x64D5, 0x64D5, 0x5CB5, 0x5CB5, 0x64D5, 0x64F5, 0x6D15, 0x6D15,
-    0x5432, 0x332D, 0x7555, 0x7D76, 0x7555, 0x7555, 0x7D55, 0x64B3,
-    0x3B4D, 0x5C72, 0x7D55, 0x7535, 0x7535, 0x7555, 0x7556, 0x7535,
-    0x7535, 0x6D15, 0x6D15, 0x6D15, 0x6D35, 0x6D15, 0x6D15, 0x6D15,
-    0x6D15, 0x6515, 0x6515, 0x64F5, 0x64F4, 0x5CF4, 0x64F4, 0x64F4,
-    0x64F5, 0x64F5, 0x64D5, 0x5CD4, 0x6515, 0x5CF4, 0x4410, 0x53CF,
-    0x7C30, 0x8B6D, 0xAB8D, 0xDC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC50, 0xEC50, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xEC91, 0xEC91, 0xEC70,
-    0xEC70, 0xEC50, 0xE450, 0xEC70, 0xE40F, 0xA30B, 0x9451, 0x8514,
-    0x6D35, 0x5D35, 0x54F4, 0x5D15, 0x6536, 0x6D56, 0x6555, 0x6576,
-    0x6535, 0x6556, 0x6556, 0x6556, 0x6556, 0x6556, 0x6556, 0x6556,
-    0x6576, 0x6576, 0x5D75, 0x5D76, 0x6596, 0x6575, 0x5D55, 0x5D55,
-    0x5514, 0x4D14, 0x4D14, 0x4CD3, 0x4CD3, 0x4CF4, 0x54F4, 0x5CF4,
-    0x5CF4, 0x5CF4, 0x5D15, 0x6555, 0x6555, 0x6576, 0x6D97, 0x6DB7,
-    0x6576, 0x6576, 0x5D35, 0x5D35, 0x6DB7, 0x3431, 0x136E, 0x2C52,
-    0x2C93, 0x2C93, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x2C94, 0x2C94,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x5CD6, 0x5CD6, 0x64D6, 0x64D6, 0x64F6, 0x64F6, 0x64F6, 0x64F6,
-    0x64F6, 0x64F6, 0x6D16, 0x64F6, 0x6CF6, 0x6D16, 0x6D16, 0x6CF6,
-    0x64F6, 0x6516, 0x6D37, 0x6D36, 0x64F6, 0x64F6, 0x6D16, 0x64F6,
-    0x6CF6, 0x64D6, 0x64D5, 0x64B5, 0x64B5, 0x64B5, 0x64B5, 0x64B5,
-    0x64B5, 0x64B5, 0x64D5, 0x64D5, 0x64D5, 0x5CD5, 0x5CB4, 0x5CB4,
-    0x64F5, 0x64D4, 0x6CF5, 0x6CF5, 0x4BF0, 0x3B6E, 0x7D76, 0x7555,
-    0x7555, 0x7535, 0x7535, 0x7D96, 0x6CF4, 0x7535, 0x7535, 0x7555,
-    0x7535, 0x7556, 0x7556, 0x7556, 0x7536, 0x7536, 0x7536, 0x6D35,
-    0x6D16, 0x6D15, 0x6CF5, 0x64F5, 0x6515, 0x64F5, 0x64F4, 0x5CD4,
-    0x5CF4, 0x5CF5, 0x5CD4, 0x5CD4, 0x5CD4, 0x5CD5, 0x5CB4, 0x5CD4,
-    0x54B4, 0x5CF4, 0x64F4, 0x6C92, 0x83F0, 0x932C, 0xC3EF, 0xEC91,
-    0xEC90, 0xEC70, 0xEC70, 0xEC50, 0xEC51, 0xEC51, 0xEC70, 0xEC91,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91,
-    0xEC71, 0xEC71, 0xEC91, 0xEC70, 0xEC70, 0xEC50, 0xE450, 0xEC70,
-    0xE42F, 0xAB2B, 0x9410, 0x7CB3, 0x6CF4, 0x4CB3, 0x33D0, 0x234E,
-    0x4C32, 0x6D35, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6535, 0x6515, 0x5CF5, 0x5D15, 0x5D35, 0x5D55, 0x6576,
-    0x6556, 0x6D96, 0x6DB7, 0x6D97, 0x5D76, 0x5D96, 0x6576, 0x5D76,
-    0x5D76, 0x5D76, 0x6576, 0x6D76, 0x6D77, 0x6D76, 0x6556, 0x6576,
-    0x3C11, 0x33D0, 0x4472, 0x6556, 0x6556, 0x6576, 0x5D35, 0x5D35,
-    0x6576, 0x3431, 0x136E, 0x2C72, 0x34B3, 0x2C93, 0x2493, 0x2493,
-    0x2CB4, 0x2CB4, 0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x5CB5, 0x5CB5, 0x5CD5, 0x64D5,
-    0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64D5, 0x64F6, 0x64F6, 0x64F6,
-    0x64F6, 0x6D16, 0x6D16, 0x64F6, 0x5474, 0x4C32, 0x5C94, 0x6D37,
-    0x6516, 0x64F6, 0x6D16, 0x6D16, 0x6CF6, 0x6CF6, 0x6CF6, 0x64D5,
-    0x64B5, 0x64B5, 0x64B5, 0x64B5, 0x64D5, 0x64B5, 0x64B5, 0x64B5,
-    0x64D5, 0x5CD5, 0x5CB5, 0x5CB4, 0x6D36, 0x64F5, 0x64D4, 0x64F5,
-    0x3BAF, 0x43AF, 0x8596, 0x7D76, 0x7D76, 0x7514, 0x7514, 0x7555,
-    0x7555, 0x7535, 0x7555, 0x7535, 0x7555, 0x7556, 0x7556, 0x6D56,
-    0x6D36, 0x6D36, 0x6D35, 0x6D36, 0x6D36, 0x6D15, 0x6CF5, 0x64F5,
-    0x6515, 0x64F5, 0x64F5, 0x5CF5, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5,
-    0x5CD4, 0x5CD5, 0x5CD5, 0x5CD5, 0x54B4, 0x54B3, 0x64B3, 0x7451,
-    0x836E, 0xAB6D, 0xE491, 0xEC70, 0xE470, 0xEC70, 0xEC50, 0xEC50,
-    0xEC51, 0xEC51, 0xE450, 0xEC90, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC90, 0xE470, 0xE42F, 0xEC70, 0xEC50, 0xAB2C, 0x93EF, 0x84B2,
-    0x6D14, 0x6535, 0x4452, 0x1AED, 0x22ED, 0x64D4, 0x6536, 0x6535,
-    0x6535, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6535, 0x6515,
-    0x6535, 0x6535, 0x5D35, 0x5D35, 0x6535, 0x6556, 0x6D76, 0x6576,
-    0x6576, 0x5D76, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D36, 0x6536,
-    0x6536, 0x6536, 0x5D15, 0x5D15, 0x234E, 0x12CC, 0x2B8F, 0x5D15,
-    0x6535, 0x6556, 0x5D35, 0x5D35, 0x5D56, 0x3431, 0x1B8E, 0x2C52,
-    0x2C93, 0x2C93, 0x2CB3, 0x2CB4, 0x2CB4, 0x2C94, 0x2C94, 0x2C94,
-    0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2C94,
-    0x5CF5, 0x6515, 0x6516, 0x6516, 0x6536, 0x6536, 0x6D16, 0x6516,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516,
-    0x5494, 0x22ED, 0x3BB1, 0x64F6, 0x64F5, 0x64F6, 0x6D17, 0x6D16,
-    0x6D16, 0x6CF6, 0x6CF6, 0x64D6, 0x64D6, 0x64D6, 0x64D6, 0x64D6,
-    0x64D5, 0x64D5, 0x64B5, 0x64B5, 0x64D5, 0x64D5, 0x5CD5, 0x43F2,
-    0x5C94, 0x6D36, 0x5CB4, 0x64D4, 0x332E, 0x5411, 0x8597, 0x7D76,
-    0x7D55, 0x7555, 0x7535, 0x7535, 0x7555, 0x7555, 0x7555, 0x7555,
-    0x7555, 0x7555, 0x7556, 0x7556, 0x6D35, 0x6D15, 0x7536, 0x6D36,
-    0x6D15, 0x6D15, 0x64F6, 0x64F6, 0x64F5, 0x64F5, 0x64D5, 0x5CD5,
-    0x5CD5, 0x5CD5, 0x5CD5, 0x54D4, 0x5CD5, 0x5CF5, 0x54D5, 0x54D5,
-    0x4CB4, 0x5493, 0x6C72, 0x7BF0, 0x932D, 0xC3F0, 0xEC92, 0xEC50,
-    0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC50, 0xEC70, 0xEC70,
-    0xE430, 0xAB2C, 0x93AE, 0x8492, 0x6D14, 0x6535, 0x6556, 0x5493,
-    0x4411, 0x64F5, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6D35,
-    0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x5D15, 0x5D15, 0x5D35,
-    0x6536, 0x6556, 0x6556, 0x6556, 0x5D55, 0x5D35, 0x5D35, 0x5D15,
-    0x5D35, 0x5D35, 0x5D35, 0x6536, 0x6536, 0x6536, 0x6535, 0x6535,
-    0x4C93, 0x234E, 0x33AF, 0x5D35, 0x6556, 0x5D35, 0x6556, 0x5D35,
-    0x5D55, 0x3C31, 0x1B8E, 0x2C51, 0x2CB3, 0x2C92, 0x2CB3, 0x2CB4,
-    0x2C94, 0x2C94, 0x3495, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x4C72, 0x5493, 0x5CB4, 0x5CD4,
-    0x5CD4, 0x64F4, 0x6515, 0x6515, 0x64F5, 0x6D16, 0x6D36, 0x6D57,
-    0x6D36, 0x6D36, 0x6D36, 0x6D56, 0x6D36, 0x5473, 0x64F5, 0x6D36,
-    0x64F5, 0x6D16, 0x6D37, 0x64F6, 0x64D6, 0x64D6, 0x64D5, 0x64D5,
-    0x64B6, 0x64D6, 0x64D6, 0x64D5, 0x64F5, 0x64F5, 0x64D5, 0x5CB4,
-    0x64B5, 0x5CB5, 0x5474, 0x3390, 0x22ED, 0x5453, 0x64F5, 0x5CB4,
-    0x2AED, 0x6493, 0x85B7, 0x7D76, 0x7D55, 0x7D55, 0x7535, 0x7535,
-    0x7555, 0x7555, 0x7555, 0x7555, 0x7535, 0x7535, 0x7556, 0x7555,
-    0x6D15, 0x6D15, 0x6D15, 0x6D15, 0x6D15, 0x6515, 0x64F6, 0x64F6,
-    0x64F6, 0x64F5, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5, 0x54D5,
-    0x5CD5, 0x5CD5, 0x54D6, 0x54D6, 0x4CB4, 0x5C93, 0x7431, 0x838F,
-    0x9B2D, 0xD431, 0xEC71, 0xEC70, 0xEC50, 0xEC70, 0xEC71, 0xEC70,
-    0xEC50, 0xEC50, 0xEC70, 0xE470, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xB32C, 0x93CE, 0x8CD3,
-    0x7534, 0x6535, 0x6D56, 0x6515, 0x7556, 0x7576, 0x6515, 0x6535,
-    0x6535, 0x5CF4, 0x64F5, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x5D15, 0x5D15, 0x6536, 0x6536, 0x6536, 0x6556, 0x6535,
-    0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5D15, 0x6535,
-    0x6536, 0x6556, 0x6556, 0x6576, 0x6556, 0x4CB3, 0x4CD3, 0x5D55,
-    0x6556, 0x5D35, 0x5D55, 0x5D35, 0x5D35, 0x3C31, 0x136E, 0x2430,
-    0x2CB3, 0x2CB3, 0x2CB3, 0x2CB4, 0x2C94, 0x2C94, 0x3494, 0x2C94,
-    0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x338E, 0x338F, 0x33AF, 0x33AF, 0x3B8F, 0x3B8F, 0x3B8F, 0x338F,
-    0x3BB0, 0x3BB0, 0x43D0, 0x3BD0, 0x3BB0, 0x3BD0, 0x43D0, 0x43F1,
-    0x4C32, 0x4C52, 0x5473, 0x5473, 0x5473, 0x64D4, 0x6D16, 0x6D16,
-    0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6D16, 0x6D16, 0x6D16, 0x6D16,
-    0x64F5, 0x6515, 0x64F5, 0x64F5, 0x64F5, 0x64F5, 0x64D5, 0x4C11,
-    0x2B2D, 0x43F1, 0x64D4, 0x5472, 0x2B0D, 0x7515, 0x8597, 0x7D76,
-    0x7D55, 0x7D55, 0x7D55, 0x7555, 0x7555, 0x7555, 0x7555, 0x7535,
-    0x6D35, 0x6D35, 0x7536, 0x7536, 0x6D15, 0x6D15, 0x6D15, 0x6D15,
-    0x6D15, 0x64F5, 0x64D5, 0x64D5, 0x64D5, 0x5CD5, 0x5CD5, 0x5CD5,
-    0x54D5, 0x5CD5, 0x5CD5, 0x54D5, 0x54D5, 0x54D5, 0x54D5, 0x54D5,
-    0x54B4, 0x6493, 0x73F1, 0x834E, 0xB38F, 0xE451, 0xEC71, 0xEC70,
-    0xEC50, 0xEC50, 0xEC71, 0xEC71, 0xEC50, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC50, 0xB34C, 0x938E, 0x8CD2, 0x6CD3, 0x5D14, 0x6515, 0x6D36,
-    0x7556, 0x6D56, 0x6515, 0x6535, 0x5D15, 0x5CF4, 0x5CD4, 0x64F4,
-    0x64F5, 0x6515, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5D16, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x5D35, 0x5D35, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35,
-    0x5D35, 0x3C51, 0x136E, 0x2410, 0x2C92, 0x2CD3, 0x2CB3, 0x2C94,
-    0x2C94, 0x2C94, 0x3494, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x7555, 0x6D35, 0x6514, 0x64F4,
-    0x64D3, 0x5CB3, 0x5C72, 0x5451, 0x4C11, 0x43F0, 0x43AF, 0x3B8F,
-    0x3B6F, 0x336E, 0x334E, 0x334E, 0x2B2D, 0x334E, 0x2B2E, 0x2B2E,
-    0x334E, 0x334E, 0x336F, 0x3B8F, 0x43D0, 0x4BF1, 0x4C32, 0x5473,
-    0x5C94, 0x64D5, 0x64F5, 0x64F5, 0x6D36, 0x6515, 0x64F5, 0x6D15,
-    0x6D15, 0x6D15, 0x6D36, 0x6515, 0x5CB4, 0x6D35, 0x6515, 0x3BAF,
-    0x3B8E, 0x7D97, 0x7D97, 0x7D76, 0x7D35, 0x7D55, 0x7D55, 0x7555,
-    0x7555, 0x7556, 0x7556, 0x7555, 0x6D35, 0x6D35, 0x7536, 0x6D35,
-    0x6D15, 0x6D15, 0x6D15, 0x6D15, 0x6D35, 0x6515, 0x5CD5, 0x5CD5,
-    0x5CD5, 0x5CD5, 0x5CD5, 0x54D5, 0x54B5, 0x54D5, 0x5CB5, 0x5CB5,
-    0x54B5, 0x54B5, 0x4CB5, 0x54B5, 0x54B4, 0x6473, 0x7BD0, 0x932E,
-    0xD431, 0xE471, 0xEC70, 0xEC70, 0xEC50, 0xEC70, 0xEC70, 0xEC70,
-    0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xBB6D, 0x938D, 0x8C91,
-    0x64B2, 0x5D14, 0x5CF5, 0x6515, 0x6D36, 0x6D56, 0x6535, 0x6515,
-    0x5CF4, 0x5CF4, 0x64F5, 0x64F4, 0x5CF5, 0x5D15, 0x5CF5, 0x5CF5,
-    0x5D15, 0x5D15, 0x5D15, 0x6536, 0x6556, 0x6536, 0x6556, 0x6536,
-    0x6536, 0x6536, 0x5D36, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x6535, 0x6536, 0x6536, 0x6536, 0x5D15, 0x5D35, 0x5D35, 0x5D35,
-    0x5D55, 0x5D35, 0x5D15, 0x5D35, 0x5D35, 0x3C51, 0x136E, 0x23F0,
-    0x2CB3, 0x2CB3, 0x2CB3, 0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2C94,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x85B6, 0x7DB6, 0x7DB6, 0x85B7, 0x85D7, 0x85D7, 0x85B7, 0x7D96,
-    0x7D96, 0x7D96, 0x7D76, 0x7D76, 0x7D76, 0x7D96, 0x7576, 0x7575,
-    0x7555, 0x7555, 0x6D14, 0x64F3, 0x64B3, 0x5472, 0x5451, 0x4C31,
-    0x43F0, 0x43AF, 0x336E, 0x2B2D, 0x2AED, 0x2AED, 0x2B0D, 0x2B4E,
-    0x334E, 0x334E, 0x338F, 0x4411, 0x4C31, 0x4C52, 0x5CB3, 0x64F4,
-    0x64D4, 0x6D15, 0x4C31, 0x230C, 0x5472, 0x85D7, 0x7D76, 0x7D55,
-    0x7535, 0x7D56, 0x7D56, 0x7555, 0x7555, 0x7556, 0x7556, 0x7556,
-    0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x6D15, 0x6D15, 0x6D15, 0x6D15,
-    0x6536, 0x6515, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5,
-    0x54D5, 0x5CB6, 0x5CB6, 0x5CB5, 0x54B5, 0x54B5, 0x4CB5, 0x54B5,
-    0x5C94, 0x6C32, 0x836F, 0xAB6E, 0xE492, 0xE450, 0xEC50, 0xEC70,
-    0xEC70, 0xE470, 0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xBB8D, 0x936D, 0x8C51, 0x6492, 0x6514, 0x64F5, 0x6515,
-    0x7556, 0x6D56, 0x6535, 0x6535, 0x5CF5, 0x5CF4, 0x5CF4, 0x5CF4,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5D16, 0x5D16, 0x5D16, 0x6516,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D16, 0x5D15,
-    0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35,
-    0x5D35, 0x3C51, 0x136E, 0x23F0, 0x34B3, 0x2CB3, 0x2CB3, 0x2CB4,
-    0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x7D75, 0x7D95, 0x7D95, 0x7D96,
-    0x7D96, 0x7D96, 0x7D96, 0x7D96, 0x7D96, 0x8596, 0x8596, 0x85B6,
-    0x85B6, 0x85B6, 0x85B6, 0x7DB6, 0x7DB6, 0x7DB6, 0x85B6, 0x85D7,
-    0x85D7, 0x85D7, 0x85D7, 0x7DB7, 0x7D96, 0x7D96, 0x7576, 0x6D35,
-    0x64D4, 0x5C72, 0x5452, 0x4C31, 0x4410, 0x3BAF, 0x336E, 0x2B2D,
-    0x230C, 0x230C, 0x2B2D, 0x336E, 0x338E, 0x336E, 0x336E, 0x3BCF,
-    0x7555, 0x7DB7, 0x7D76, 0x7D76, 0x7D56, 0x7D56, 0x7D56, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x6D36, 0x6D36, 0x6D16,
-    0x6D15, 0x6D15, 0x6D15, 0x6D16, 0x6516, 0x5D16, 0x5CD5, 0x5CD5,
-    0x5CD5, 0x5CD5, 0x5CD5, 0x54D5, 0x5CD5, 0x5CD6, 0x5CD6, 0x5CB6,
-    0x54B6, 0x54B5, 0x4CB5, 0x54B5, 0x6474, 0x73F1, 0x8B2E, 0xC3D0,
-    0xEC71, 0xEC30, 0xEC50, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70,
-    0xF450, 0xF450, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xC38D, 0x932C, 0x8C30,
-    0x6C92, 0x5CD3, 0x5CF5, 0x6515, 0x6D56, 0x6D36, 0x6535, 0x6536,
-    0x5D15, 0x5D15, 0x5CD4, 0x5CD4, 0x5CD5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5D16, 0x5D16, 0x5D16, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x5D16, 0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x5D35, 0x5D15, 0x5D35, 0x5D35,
-    0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x3C51, 0x1B6E, 0x1BEF,
-    0x34B3, 0x2CB3, 0x2C93, 0x2CB4, 0x2CB4, 0x2CB4, 0x2C94, 0x3494,
-    0x34B4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x8595, 0x8595, 0x8595, 0x8595, 0x8596, 0x7D95, 0x8596, 0x8596,
-    0x8596, 0x8596, 0x8596, 0x8596, 0x8596, 0x85B6, 0x85B6, 0x85B6,
-    0x7D95, 0x7D75, 0x7D75, 0x85B6, 0x8596, 0x7D96, 0x7D96, 0x7DB6,
-    0x7DB6, 0x85D7, 0x8DF8, 0x8E18, 0x8E18, 0x8618, 0x85F8, 0x85F8,
-    0x85F7, 0x7DD7, 0x7576, 0x6D55, 0x64F4, 0x5CD3, 0x5472, 0x5451,
-    0x5472, 0x5492, 0x6D34, 0x7D76, 0x7DB7, 0x7D76, 0x7D76, 0x7556,
-    0x7D56, 0x7D56, 0x7D56, 0x7556, 0x7556, 0x7556, 0x7556, 0x7536,
-    0x6D36, 0x6D16, 0x6D36, 0x6D16, 0x6515, 0x6515, 0x6D16, 0x6516,
-    0x6516, 0x5CF6, 0x5CF6, 0x5CD6, 0x5CD6, 0x5CD5, 0x5CD5, 0x54D5,
-    0x5CD6, 0x5CD6, 0x5CB6, 0x5CB6, 0x54B6, 0x54B5, 0x4CB5, 0x5C94,
-    0x6C53, 0x83B0, 0xA34E, 0xDC52, 0xEC71, 0xEC4F, 0xF450, 0xEC70,
-    0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xF450, 0xF450, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xF470, 0xCBCE, 0x932C, 0x8C31, 0x7492, 0x5CD3, 0x64F5, 0x6515,
-    0x6D56, 0x6D56, 0x6536, 0x6535, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5D16, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6516, 0x6516, 0x5D16,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5D16, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x5D35, 0x5D35, 0x6536, 0x6536, 0x5D35, 0x5D15, 0x5D35, 0x5D35,
-    0x5D35, 0x3C72, 0x1B6E, 0x1BAF, 0x34B3, 0x2C93, 0x2CB3, 0x2CB4,
-    0x34B4, 0x2CB4, 0x2C94, 0x3494, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x8596, 0x7D95, 0x7D75, 0x7D75,
-    0x8575, 0x8595, 0x8595, 0x8596, 0x8596, 0x8596, 0x8595, 0x8595,
-    0x8596, 0x85B6, 0x85B6, 0x85B6, 0x8596, 0x7D95, 0x7D96, 0x7D95,
-    0x7D76, 0x7D96, 0x7D96, 0x7D75, 0x7D96, 0x7D96, 0x7D96, 0x7D96,
-    0x7596, 0x7576, 0x7576, 0x7576, 0x7596, 0x7575, 0x7575, 0x7596,
-    0x7575, 0x7596, 0x7575, 0x7576, 0x7D96, 0x7D76, 0x7D96, 0x7D76,
-    0x7535, 0x7556, 0x7535, 0x7556, 0x7556, 0x7556, 0x7536, 0x7536,
-    0x7536, 0x7536, 0x6D36, 0x6D16, 0x6D15, 0x6D16, 0x6D16, 0x6D16,
-    0x6515, 0x64F6, 0x6516, 0x6516, 0x6516, 0x6516, 0x64F6, 0x5CF6,
-    0x5CF6, 0x5CD6, 0x5CF5, 0x54D5, 0x5CD5, 0x5CB6, 0x5CB6, 0x5CD6,
-    0x54B6, 0x54B5, 0x54B5, 0x6474, 0x7C12, 0x8B6F, 0xBB8F, 0xEC72,
-    0xEC70, 0xEC4F, 0xF470, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC50,
-    0xEC50, 0xEC50, 0xEC50, 0xEC70, 0xE450, 0xE430, 0xE42F, 0xE40F,
-    0xDC0F, 0xE40F, 0xE430, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC50,
-    0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xCBEF, 0x92EC, 0x9410,
-    0x7492, 0x64F4, 0x6515, 0x6515, 0x6D56, 0x6D36, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5,
-    0x5D15, 0x5D15, 0x5D16, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6516, 0x6516, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D35, 0x5D15, 0x5D15,
-    0x5D35, 0x5D15, 0x5D15, 0x5D36, 0x5D56, 0x4492, 0x1B6E, 0x1BAE,
-    0x3493, 0x2C92, 0x2C93, 0x2C93, 0x34B4, 0x2CB4, 0x2C94, 0x3494,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x8596, 0x8596, 0x8596, 0x7D75, 0x8575, 0x8596, 0x8596, 0x8596,
-    0x8596, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596,
-    0x8596, 0x7D75, 0x7D75, 0x7D75, 0x7D76, 0x7D75, 0x7D76, 0x7D76,
-    0x7D76, 0x7D76, 0x7596, 0x7576, 0x7576, 0x7575, 0x7576, 0x7575,
-    0x7575, 0x7575, 0x7575, 0x7555, 0x7555, 0x7555, 0x7555, 0x7576,
-    0x7D76, 0x7D76, 0x7D76, 0x7556, 0x7536, 0x7535, 0x7535, 0x7536,
-    0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x6D36, 0x6D15, 0x6515,
-    0x6515, 0x6516, 0x64F6, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516,
-    0x6516, 0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x5CD6, 0x5CD5, 0x54D5,
-    0x54D5, 0x5CD6, 0x5CB6, 0x5CB6, 0x54B6, 0x54B5, 0x5C94, 0x6C73,
-    0x83F1, 0x930D, 0xD3F1, 0xEC51, 0xEC50, 0xEC6F, 0xE40F, 0xDBCE,
-    0xD38D, 0xD38D, 0xDBCE, 0xEC30, 0xF471, 0xF491, 0xEC50, 0xE450,
-    0xDBCE, 0xDBAE, 0xD3AE, 0xD38D, 0xD36D, 0xD38D, 0xD3AE, 0xD3AE,
-    0xE40F, 0xEC50, 0xF471, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC50,
-    0xF470, 0xD3EF, 0x9AEC, 0x8BCF, 0x7492, 0x64F4, 0x6515, 0x6515,
-    0x6D16, 0x6536, 0x6536, 0x6536, 0x6535, 0x5D15, 0x5D15, 0x5D15,
-    0x5D35, 0x5D15, 0x5515, 0x54F5, 0x5D15, 0x5D35, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6516, 0x6516, 0x6516,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x5D36, 0x5D36, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35,
-    0x5D35, 0x4CF4, 0x1B8E, 0x138E, 0x3493, 0x2C72, 0x2CB3, 0x2C93,
-    0x2CB4, 0x2CB4, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x8596, 0x8596, 0x8596, 0x8596,
-    0x8596, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596,
-    0x7D95, 0x7D75, 0x7D95, 0x7D75, 0x7D75, 0x7D55, 0x7D55, 0x7D55,
-    0x7D55, 0x7555, 0x7555, 0x7575, 0x7555, 0x7555, 0x7575, 0x7575,
-    0x7576, 0x7576, 0x7576, 0x7576, 0x7575, 0x7575, 0x7575, 0x7575,
-    0x7555, 0x7555, 0x7555, 0x7D76, 0x7D76, 0x7D76, 0x7D76, 0x7D56,
-    0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x6D36, 0x6D15, 0x6D15,
-    0x6D16, 0x6D15, 0x6515, 0x64F5, 0x64F6, 0x64F5, 0x64F5, 0x64F5,
-    0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x5CF6,
-    0x64D6, 0x5CD6, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD6, 0x5CD6, 0x5CB6,
-    0x54B6, 0x5495, 0x6494, 0x7432, 0x8B8F, 0xA34E, 0xE431, 0xF471,
-    0xEC70, 0xEC6F, 0xE42F, 0xE3CE, 0xDBAE, 0xD36D, 0xD36D, 0xD38D,
-    0xDBAD, 0xDBAE, 0xD3AE, 0xD3AE, 0xE3EF, 0xE40F, 0xEC30, 0xEC50,
-    0xEC50, 0xEC50, 0xE40F, 0xDBCE, 0xDBCE, 0xE42F, 0xEC70, 0xEC70,
-    0xEC50, 0xEC70, 0xEC70, 0xEC50, 0xF470, 0xD3EF, 0x9AEC, 0x93CF,
-    0x7492, 0x6CF4, 0x6D35, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x5D15, 0x5D35, 0x5D15, 0x5D35, 0x5D15, 0x5515, 0x5515,
-    0x5D15, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D36, 0x5D35, 0x5D35,
-    0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x4CF4, 0x23AF, 0x136E,
-    0x3492, 0x2C92, 0x2CB3, 0x2C93, 0x2CB4, 0x2CB4, 0x2C94, 0x2C94,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x8596, 0x8596, 0x8596, 0x8596, 0x85B6, 0x8596, 0x8596, 0x8596,
-    0x8596, 0x8596, 0x8596, 0x8596, 0x7D96, 0x7D76, 0x7D75, 0x7D75,
-    0x7D55, 0x7D55, 0x7535, 0x7535, 0x7555, 0x7555, 0x7555, 0x7555,
-    0x7555, 0x7555, 0x6D55, 0x7555, 0x7556, 0x7556, 0x7556, 0x7576,
-    0x7575, 0x7576, 0x7576, 0x7575, 0x7555, 0x7555, 0x7555, 0x7575,
-    0x7D76, 0x7D76, 0x7D76, 0x7D56, 0x7536, 0x7536, 0x7536, 0x6D56,
-    0x6D36, 0x6D35, 0x6D15, 0x6515, 0x6515, 0x6515, 0x6516, 0x6516,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x64F6,
-    0x64F6, 0x64F6, 0x5CF6, 0x5CF6, 0x64D6, 0x5CD5, 0x5CD5, 0x5CD5,
-    0x5CD5, 0x5CD6, 0x5CD6, 0x5CB6, 0x5CB6, 0x5C94, 0x6C73, 0x7C11,
-    0x8B2D, 0xC38F, 0xF492, 0xFC91, 0xF491, 0xEC70, 0xEC50, 0xEC30,
-    0xF471, 0xEC50, 0xEC30, 0xDBCE, 0xD38D, 0xD38D, 0xDBCE, 0xE430,
-    0xEC71, 0xF491, 0xF491, 0xF471, 0xEC50, 0xEC50, 0xEC50, 0xEC50,
-    0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xEC70,
-    0xEC70, 0xDBEF, 0xA30C, 0x93AF, 0x7C73, 0x6CF4, 0x6D35, 0x6536,
-    0x6536, 0x6536, 0x6556, 0x6536, 0x6536, 0x5D36, 0x5D36, 0x5D15,
-    0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x6556, 0x6556, 0x6556,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6515, 0x6516, 0x5D15,
-    0x5D16, 0x5D16, 0x5D16, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36,
-    0x5515, 0x5514, 0x2BF0, 0x136E, 0x2C72, 0x2C93, 0x2CB3, 0x2C93,
-    0x2CB4, 0x2CB4, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x8596, 0x85B6, 0x8596, 0x85B6,
-    0x85B6, 0x85B6, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596,
-    0x7D96, 0x7D96, 0x7D96, 0x7D75, 0x7D55, 0x7D55, 0x7535, 0x7535,
-    0x7555, 0x7555, 0x7535, 0x7535, 0x7535, 0x7535, 0x6D35, 0x6D55,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7576, 0x7575, 0x7555,
-    0x7555, 0x7555, 0x7555, 0x7D76, 0x7D76, 0x7D76, 0x7D76, 0x7556,
-    0x7536, 0x7536, 0x6D36, 0x6D36, 0x6D36, 0x6D35, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x64F6, 0x64F6, 0x5CF6, 0x5CF6,
-    0x5CD6, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD6, 0x5CD6, 0x5CB6,
-    0x5CD5, 0x6494, 0x7473, 0x83D0, 0xA36E, 0xD410, 0xEC71, 0xEC30,
-    0xEC50, 0xEC50, 0xEC50, 0xEC51, 0xEC30, 0xEC50, 0xEC50, 0xEC50,
-    0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xE430, 0xE430, 0xEC50,
-    0xEC51, 0xEC71, 0xEC71, 0xEC50, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xDC10, 0xA30C, 0x9BB0,
-    0x7C93, 0x6CF4, 0x6D36, 0x6536, 0x6516, 0x6536, 0x6536, 0x5D36,
-    0x5D36, 0x5D36, 0x5D36, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35,
-    0x6536, 0x6556, 0x6556, 0x6556, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6515, 0x6516, 0x6516, 0x5D16, 0x5D16, 0x5D16, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x5D36, 0x5D36, 0x5D36, 0x5D36,
-    0x5D36, 0x5D36, 0x5D36, 0x5D35, 0x5515, 0x5514, 0x3431, 0x138E,
-    0x2C52, 0x34B3, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x2C94, 0x2C94,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x85B6, 0x85B6, 0x85B6, 0x85B6, 0x85B6, 0x85B6, 0x85B6, 0x85B6,
-    0x8596, 0x7D76, 0x7D76, 0x7D76, 0x8596, 0x8596, 0x7D96, 0x7D76,
-    0x7D76, 0x7D55, 0x7D55, 0x7D55, 0x7555, 0x7555, 0x7535, 0x6D35,
-    0x6D15, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D55, 0x6D55, 0x6D35,
-    0x6D55, 0x6D55, 0x6D55, 0x6D55, 0x6D55, 0x6D55, 0x7575, 0x7D96,
-    0x7D96, 0x7D96, 0x7D96, 0x7556, 0x7536, 0x6D16, 0x6D36, 0x6D36,
-    0x6D36, 0x6515, 0x64F5, 0x64F5, 0x6515, 0x6515, 0x64F6, 0x6516,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x6516, 0x64F6,
-    0x64F6, 0x5CF6, 0x5CF6, 0x5CF5, 0x5CD6, 0x5CD5, 0x5CD5, 0x5CD5,
-    0x5CD5, 0x5CD5, 0x5CD6, 0x5CB6, 0x64D5, 0x6C94, 0x7C32, 0x8B6E,
-    0xB3AE, 0xE450, 0xEC50, 0xF471, 0xF471, 0xF491, 0xEC50, 0xEC50,
-    0xF471, 0xF471, 0xF491, 0xF4B1, 0xF491, 0xEC50, 0xE3EF, 0xDBCE,
-    0xDBCE, 0xD38D, 0xD38D, 0xDBCE, 0xDBEE, 0xE40F, 0xE42F, 0xEC50,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC70, 0xEC50,
-    0xF470, 0xE450, 0xAB0D, 0x9BAF, 0x8493, 0x6CF4, 0x6D36, 0x6536,
-    0x6516, 0x6536, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5535,
-    0x5D36, 0x5D35, 0x5D15, 0x5D15, 0x5D35, 0x6556, 0x6556, 0x6556,
-    0x6536, 0x6535, 0x6536, 0x6536, 0x6536, 0x6515, 0x6515, 0x6515,
-    0x6536, 0x6536, 0x5D16, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D36,
-    0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36,
-    0x5D15, 0x54F5, 0x3452, 0x138E, 0x3472, 0x34B3, 0x2C93, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x85B6, 0x85B6, 0x85B6, 0x85B6,
-    0x8596, 0x85B6, 0x85B6, 0x85B6, 0x8596, 0x7D76, 0x7D75, 0x7D76,
-    0x8596, 0x8596, 0x8596, 0x7D76, 0x7D76, 0x7D55, 0x7D55, 0x7D55,
-    0x7555, 0x7555, 0x7535, 0x6D35, 0x6D14, 0x6D14, 0x6D15, 0x6D35,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D55, 0x6D35, 0x6D34, 0x6D34,
-    0x6D34, 0x6D35, 0x7555, 0x7575, 0x7D96, 0x7D96, 0x7D76, 0x7556,
-    0x6D35, 0x6D15, 0x6516, 0x6536, 0x6515, 0x6515, 0x64F5, 0x6515,
-    0x64F5, 0x64F5, 0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64F6, 0x64F6,
-    0x64F6, 0x64F6, 0x5CF5, 0x5CF5, 0x64F6, 0x5CF6, 0x5CF5, 0x5CF5,
-    0x5CD6, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5, 0x5CD6, 0x5CB5,
-    0x64D5, 0x7493, 0x83F0, 0x936D, 0xC40F, 0xEC91, 0xF471, 0xF471,
-    0xEC10, 0xE3EF, 0xDBAE, 0xD38D, 0xD38E, 0xDBCE, 0xE42F, 0xEC70,
-    0xEC2F, 0xDBCE, 0xD3AD, 0xDBCE, 0xE40F, 0xE3EF, 0xDBEE, 0xDBCE,
-    0xD38D, 0xD38D, 0xDBAE, 0xE40F, 0xE450, 0xEC70, 0xEC91, 0xEC70,
-    0xEC50, 0xEC70, 0xEC91, 0xEC70, 0xF471, 0xEC71, 0xB30D, 0x9B8F,
-    0x8473, 0x6CF5, 0x6D36, 0x6536, 0x6516, 0x5D36, 0x5D36, 0x5D36,
-    0x5D36, 0x5D36, 0x5D36, 0x5536, 0x5D36, 0x5D35, 0x5D15, 0x5D15,
-    0x5D15, 0x6536, 0x6556, 0x6556, 0x6536, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6515, 0x6515, 0x6536, 0x6536, 0x6536, 0x5D16, 0x5D16,
-    0x6536, 0x6536, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36,
-    0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D35, 0x54F5, 0x3452, 0x1B8E,
-    0x3472, 0x34B3, 0x2C93, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x85B6, 0x85B6, 0x85B6, 0x8596, 0x8596, 0x8596, 0x8596, 0x8596,
-    0x8596, 0x8575, 0x8576, 0x8596, 0x8596, 0x85B6, 0x8596, 0x7D55,
-    0x7D75, 0x7D75, 0x7D55, 0x7D55, 0x7575, 0x7555, 0x7535, 0x6D34,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D55, 0x7555, 0x6D35,
-    0x6D55, 0x6D55, 0x6D34, 0x6D34, 0x6D34, 0x6D34, 0x6D34, 0x7555,
-    0x7575, 0x7555, 0x7555, 0x6D35, 0x6D15, 0x6D35, 0x6536, 0x6536,
-    0x6535, 0x6515, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5D16, 0x5D16,
-    0x5CF6, 0x5CF6, 0x64F6, 0x64F6, 0x64F6, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x54F5, 0x54F5, 0x5CF6, 0x5CD5, 0x5CD5, 0x5CD5,
-    0x5CD5, 0x5CD5, 0x5CB5, 0x5CB5, 0x64B4, 0x7453, 0x838F, 0xA38E,
-    0xDC70, 0xECB0, 0xEC91, 0xF450, 0xEBEF, 0xE3CF, 0xE3EF, 0xDC0F,
-    0xDBCE, 0xD38D, 0xD38D, 0xD38D, 0xD38D, 0xDBAE, 0xE42F, 0xF491,
-    0xFC91, 0xF471, 0xF491, 0xF490, 0xEC50, 0xE40F, 0xDBCE, 0xD3AD,
-    0xDBEE, 0xE42F, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xF470, 0xEC71, 0xB2ED, 0x9B6F, 0x8473, 0x6CF5, 0x6D36, 0x6536,
-    0x6516, 0x6536, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5536, 0x5536,
-    0x5D36, 0x5D36, 0x5D15, 0x5D15, 0x5D36, 0x6536, 0x6556, 0x6556,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6535, 0x5D15, 0x5D15, 0x5D15, 0x6535, 0x5D36, 0x5D36,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D16, 0x5D36, 0x5D36, 0x5D36,
-    0x5D35, 0x5515, 0x3431, 0x138E, 0x3472, 0x34B3, 0x2C93, 0x2CB3,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x85B6, 0x85B6, 0x8596, 0x85B6,
-    0x8596, 0x8596, 0x8596, 0x8596, 0x7D75, 0x7D75, 0x8576, 0x8596,
-    0x85B7, 0x85B7, 0x8596, 0x7D55, 0x7D76, 0x7D55, 0x7D55, 0x7555,
-    0x7555, 0x7555, 0x7535, 0x6D35, 0x6D35, 0x6D35, 0x6D15, 0x6D15,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D34,
-    0x6D34, 0x6D34, 0x6D35, 0x7555, 0x7555, 0x7555, 0x7555, 0x6D35,
-    0x6D35, 0x6535, 0x6536, 0x6536, 0x6535, 0x6515, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D16, 0x5D16, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6,
-    0x5CF6, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x54F5, 0x54F5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CD5, 0x5CD5, 0x54B5, 0x5CD5,
-    0x6494, 0x7C31, 0x8B4E, 0xB3AE, 0xE490, 0xEC6F, 0xEC70, 0xEC50,
-    0xEC30, 0xF451, 0xF491, 0xEC91, 0xEC70, 0xE450, 0xE42F, 0xDC0F,
-    0xE40F, 0xEC50, 0xF470, 0xF471, 0xF470, 0xEC50, 0xEC50, 0xEC70,
-    0xEC70, 0xF490, 0xEC70, 0xE42F, 0xE40F, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC71, 0xB30D, 0x9B8F,
-    0x8493, 0x6D15, 0x6D36, 0x6536, 0x6536, 0x5D36, 0x5D36, 0x5D36,
-    0x5D36, 0x5D36, 0x5536, 0x5536, 0x5D36, 0x5D36, 0x5D16, 0x5D15,
-    0x5D36, 0x6536, 0x6556, 0x6556, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6535, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D36, 0x5D36, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D16, 0x5D36, 0x5D36, 0x5535, 0x5515, 0x3431, 0x136E,
-    0x3472, 0x3493, 0x2C93, 0x2C93, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x8596, 0x8596, 0x8596, 0x85B6, 0x85B6, 0x85B6, 0x8596, 0x7D95,
-    0x7D76, 0x7D75, 0x7D76, 0x8596, 0x85B7, 0x8597, 0x7D76, 0x7D76,
-    0x7D56, 0x7D55, 0x7555, 0x7555, 0x7556, 0x7556, 0x7535, 0x6D35,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D55, 0x6D55, 0x6D35, 0x6D35, 0x6D35, 0x6D34, 0x6D55, 0x7555,
-    0x7576, 0x7576, 0x7556, 0x6D56, 0x6D36, 0x6535, 0x6536, 0x6536,
-    0x6535, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5D16, 0x5D16, 0x5D16,
-    0x5CF6, 0x5D16, 0x5CF5, 0x5CF6, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5D15, 0x5515, 0x54F6, 0x54F6, 0x5CF6, 0x5CF5, 0x5D15, 0x5D15,
-    0x5CF5, 0x5CF5, 0x54D5, 0x5CB4, 0x7493, 0x83AF, 0x9B2C, 0xD42F,
-    0xEC70, 0xEC4F, 0xEC50, 0xEC70, 0xEC91, 0xECB1, 0xE470, 0xEC70,
-    0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC70,
-    0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC70, 0xF490,
-    0xEC70, 0xE450, 0xEC50, 0xEC71, 0xEC71, 0xEC71, 0xE450, 0xEC70,
-    0xF471, 0xEC91, 0xB34D, 0x936D, 0x84B2, 0x6D34, 0x6535, 0x5D36,
-    0x5D16, 0x5D16, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5D36, 0x5536,
-    0x5D36, 0x5D36, 0x5D16, 0x5D36, 0x5D35, 0x6535, 0x6556, 0x6556,
-    0x6556, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x5D35, 0x5D15, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x54F5, 0x5D36, 0x5D15, 0x5D36, 0x5D36,
-    0x5515, 0x4CF4, 0x3431, 0x136E, 0x2C72, 0x34B3, 0x2C93, 0x2CB4,
-    0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x8596, 0x8596, 0x85B6, 0x85B6,
-    0x8596, 0x8596, 0x7D95, 0x7D75, 0x7D75, 0x7D75, 0x7D76, 0x7D96,
-    0x8597, 0x7D96, 0x7D76, 0x7D56, 0x7D56, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x6D35, 0x6D35, 0x6D35, 0x6D15, 0x6D35, 0x6D35,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D56, 0x6D55, 0x6D35, 0x6D35,
-    0x6D35, 0x6D35, 0x6D55, 0x7555, 0x7576, 0x7576, 0x7556, 0x7556,
-    0x6D36, 0x6D36, 0x6536, 0x6535, 0x6535, 0x6515, 0x5D15, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6, 0x5CF6, 0x54D5, 0x5CF6,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x54F5, 0x54F5, 0x54F6, 0x5CF6,
-    0x5CF6, 0x5CF5, 0x5D15, 0x5CF5, 0x5CD5, 0x5CF5, 0x54D5, 0x64D5,
-    0x7C32, 0x836E, 0xAB6D, 0xEC70, 0xF470, 0xEC2F, 0xEC70, 0xEC70,
-    0xE490, 0xE491, 0xE450, 0xEC71, 0xEC51, 0xEC50, 0xF491, 0xEC70,
-    0xEC70, 0xEC90, 0xEC91, 0xEC91, 0xF491, 0xE450, 0xEC91, 0xE470,
-    0xEC71, 0xECB1, 0xEC70, 0xEC50, 0xF470, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC91, 0xEC71, 0xEC70, 0xF471, 0xEC91, 0xB36D, 0x936D,
-    0x84D2, 0x6D54, 0x6535, 0x5D36, 0x5D16, 0x5D37, 0x5D36, 0x5D36,
-    0x5D36, 0x5D36, 0x5516, 0x5516, 0x5D36, 0x5516, 0x5D16, 0x5D15,
-    0x5D35, 0x6536, 0x6556, 0x6556, 0x6556, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D35, 0x5D15, 0x5D35,
-    0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D36, 0x5D36, 0x5D35, 0x5515, 0x4CD4, 0x2C30, 0x1B8E,
-    0x2C72, 0x3493, 0x2C93, 0x2CB4, 0x2CB4, 0x2CB4, 0x3494, 0x34B4,
-    0x2CB4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x85B6, 0x85B6, 0x85B6, 0x85B6, 0x8595, 0x7D95, 0x7D95, 0x7D95,
-    0x7D75, 0x7575, 0x7D76, 0x7D76, 0x7D76, 0x7D76, 0x7D76, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D55, 0x6D35, 0x6D35,
-    0x6515, 0x6515, 0x6D35, 0x6D36, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D55, 0x7556,
-    0x7556, 0x7576, 0x7556, 0x7556, 0x6D56, 0x6D36, 0x6535, 0x6515,
-    0x6536, 0x6536, 0x6515, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CD5,
-    0x5D16, 0x5D16, 0x54D5, 0x5CF6, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CD5, 0x5CD5, 0x5CD5, 0x6C94, 0x8412, 0x936E, 0xC3EF, 0xF4D2,
-    0xEC70, 0xF490, 0xE470, 0xE491, 0xE450, 0xE470, 0xEC71, 0xEC71,
-    0xF471, 0xF471, 0xEC50, 0xEC50, 0xEC70, 0xEC50, 0xEC70, 0xEC70,
-    0xE450, 0xEC91, 0xE470, 0xE471, 0xE471, 0xEC70, 0xEC70, 0xEC90,
-    0xEC90, 0xEC90, 0xEC91, 0xEC70, 0xE471, 0xEC91, 0xEC71, 0xEC50,
-    0xF471, 0xF4B2, 0xBB8E, 0x936D, 0x84D2, 0x7554, 0x6535, 0x5D36,
-    0x5D16, 0x5D37, 0x5D36, 0x5536, 0x5536, 0x5536, 0x5516, 0x5516,
-    0x5516, 0x5516, 0x5515, 0x5D15, 0x6536, 0x6556, 0x6556, 0x6556,
-    0x6556, 0x6556, 0x6556, 0x6556, 0x6536, 0x6536, 0x6535, 0x6535,
-    0x6535, 0x5D35, 0x5D15, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D35, 0x5D36, 0x5D15, 0x5515, 0x5D56, 0x5D56, 0x5D56,
-    0x5D35, 0x4CD3, 0x2C10, 0x1BAE, 0x2C72, 0x2C92, 0x34B4, 0x34B4,
-    0x2CB4, 0x2CB4, 0x34B4, 0x2CB4, 0x34B4, 0x34B4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x85B6, 0x85B6, 0x85B6, 0x85B6,
-    0x8595, 0x7D95, 0x7D95, 0x7D95, 0x7D75, 0x7575, 0x7555, 0x7576,
-    0x7D76, 0x7576, 0x7576, 0x7576, 0x7556, 0x7556, 0x6D55, 0x6D55,
-    0x6D55, 0x6D35, 0x6D35, 0x6515, 0x6515, 0x6515, 0x6D35, 0x6D36,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D35, 0x6D35, 0x6D35,
-    0x6D35, 0x6D35, 0x6D55, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x6D36, 0x6D35, 0x6515, 0x6D36, 0x6536, 0x64F5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CD5, 0x5D16, 0x5D16, 0x54D5, 0x5CF5,
-    0x5CD5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6, 0x5CF6,
-    0x5CF6, 0x5CF5, 0x5CF5, 0x5CD5, 0x5CF5, 0x5CB4, 0x6494, 0x7494,
-    0x8390, 0x930D, 0xDC71, 0xE470, 0xEC90, 0xECB1, 0xE4D1, 0xE4B1,
-    0xE4D2, 0xE4B2, 0xEC91, 0xEC51, 0xEC30, 0xF471, 0xF471, 0xF491,
-    0xEC70, 0xEC50, 0xEC91, 0xE470, 0xE491, 0xE4B2, 0xE4D2, 0xECD2,
-    0xE4B2, 0xDC50, 0xE470, 0xE44F, 0xEC70, 0xEC90, 0xEC91, 0xEC90,
-    0xE470, 0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xECB1, 0xC3AE, 0x934D,
-    0x8CD2, 0x7534, 0x6515, 0x5D16, 0x5D16, 0x5D37, 0x5D36, 0x5536,
-    0x5536, 0x5536, 0x5516, 0x5516, 0x5516, 0x5516, 0x5516, 0x5D15,
-    0x6536, 0x6556, 0x6556, 0x6536, 0x6536, 0x6556, 0x6556, 0x6556,
-    0x6536, 0x6536, 0x6535, 0x6535, 0x5D35, 0x5D35, 0x5D35, 0x5D35,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D35, 0x5D36, 0x5D15,
-    0x5D15, 0x5515, 0x54F4, 0x6556, 0x5D56, 0x4CF4, 0x2BF0, 0x1BAE,
-    0x2C71, 0x2C92, 0x2CB4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x85B6, 0x85B6, 0x85B6, 0x8596, 0x8595, 0x8595, 0x7D96, 0x7D96,
-    0x7D75, 0x7575, 0x7555, 0x7576, 0x7576, 0x7576, 0x7576, 0x7556,
-    0x7556, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D35, 0x6D35, 0x6515,
-    0x6515, 0x6515, 0x6535, 0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6D56,
-    0x6D56, 0x6D56, 0x6D36, 0x6D35, 0x6D35, 0x6D35, 0x6D56, 0x7556,
-    0x7556, 0x7536, 0x7556, 0x7556, 0x7556, 0x6D36, 0x6D36, 0x6535,
-    0x6536, 0x6515, 0x64F5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CD5,
-    0x5D16, 0x5D16, 0x54D5, 0x5CF5, 0x5CD5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF6, 0x5CF6, 0x54F6, 0x54F5, 0x54F5, 0x54F5,
-    0x54D4, 0x5CD4, 0x6CB4, 0x7C32, 0x830E, 0xB38F, 0xE471, 0xECD1,
-    0xECF2, 0xDCD1, 0xCC90, 0xBBEE, 0xC430, 0xE4D2, 0xECD2, 0xE450,
-    0xEC71, 0xF471, 0xEC70, 0xEC4F, 0xF490, 0xEC70, 0xE491, 0xE4D2,
-    0xDCB1, 0xD491, 0xC40F, 0xCC50, 0xE4B2, 0xECF3, 0xE4B1, 0xE470,
-    0xEC90, 0xEC90, 0xECB0, 0xEC90, 0xEC70, 0xEC91, 0xEC70, 0xEC70,
-    0xEC70, 0xF491, 0xCBCE, 0x934D, 0x8CB2, 0x7514, 0x6515, 0x5D16,
-    0x5D17, 0x5D37, 0x5D36, 0x5D36, 0x5516, 0x5516, 0x5516, 0x5516,
-    0x5516, 0x5536, 0x5516, 0x5D35, 0x6536, 0x6556, 0x6556, 0x6536,
-    0x6536, 0x6556, 0x6556, 0x6556, 0x6536, 0x6535, 0x6535, 0x6535,
-    0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D35,
-    0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x4472, 0x33D0, 0x4CD4,
-    0x5D35, 0x5514, 0x23CF, 0x1BAE, 0x3492, 0x2C92, 0x2CB4, 0x34B4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x34B4, 0x2CD4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x85B6, 0x85B6, 0x8595, 0x8595,
-    0x8596, 0x8596, 0x7D96, 0x7D95, 0x7575, 0x7575, 0x7575, 0x7575,
-    0x7576, 0x7576, 0x7576, 0x7576, 0x7556, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6535, 0x6515, 0x6515, 0x6515, 0x6535, 0x6D36,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6D36,
-    0x6D35, 0x6D35, 0x6D56, 0x7556, 0x7536, 0x7556, 0x7556, 0x7556,
-    0x7536, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6515, 0x64F5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CD5, 0x5D16, 0x5D16, 0x5CD5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6, 0x5CD6, 0x54F6,
-    0x5516, 0x5515, 0x5CF5, 0x5CF4, 0x5CF4, 0x5CB3, 0x6C93, 0x7BF1,
-    0x9B2E, 0xCC11, 0xE492, 0xECD2, 0xAB8C, 0x7A46, 0x61A5, 0x61C6,
-    0x61A6, 0x9AEB, 0xDC92, 0xE471, 0xE451, 0xEC71, 0xF491, 0xEC50,
-    0xEC90, 0xECB1, 0xED12, 0xC42F, 0x8268, 0x61A5, 0x6185, 0x71C7,
-    0x8269, 0xBC0F, 0xED13, 0xE4B1, 0xE490, 0xE48F, 0xECB0, 0xEC90,
-    0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC6F, 0xEC90, 0xCBEF, 0x934D,
-    0x8C91, 0x74F3, 0x6515, 0x5D16, 0x5D37, 0x5D37, 0x5D36, 0x5D16,
-    0x5D15, 0x5D16, 0x5D16, 0x5516, 0x5516, 0x5536, 0x5536, 0x5D36,
-    0x6536, 0x6556, 0x6D56, 0x6536, 0x6536, 0x6536, 0x6556, 0x6556,
-    0x6536, 0x6535, 0x6535, 0x6535, 0x5D35, 0x5D35, 0x5D35, 0x5D35,
-    0x5D35, 0x5D35, 0x5D15, 0x5D35, 0x5D35, 0x5D15, 0x5D35, 0x5D15,
-    0x5D35, 0x33F0, 0x12ED, 0x3411, 0x5515, 0x54F4, 0x1BAE, 0x1BCF,
-    0x34B2, 0x2C92, 0x2C93, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CD4, 0x2CD4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x85B6, 0x85B6, 0x8595, 0x8595, 0x8596, 0x8596, 0x7D96, 0x7D95,
-    0x7575, 0x7575, 0x7575, 0x7575, 0x7576, 0x7576, 0x7576, 0x6D76,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6535, 0x6535,
-    0x6515, 0x6515, 0x6D35, 0x6D36, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x6D35, 0x6D35, 0x6D56, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D36, 0x6D36, 0x6D35,
-    0x6516, 0x6516, 0x64F5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CD5,
-    0x5D16, 0x5D16, 0x5CF5, 0x5D16, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF6, 0x5CF6, 0x5CD6, 0x54F6, 0x5516, 0x5D15, 0x5CF4, 0x5CD3,
-    0x64D3, 0x74F3, 0x7C72, 0x838F, 0xAB2E, 0xDC32, 0xECF3, 0xA30A,
-    0x7A67, 0xA42E, 0xC594, 0xD5F6, 0xC554, 0x82CB, 0x8A8A, 0xDCB2,
-    0xE4B2, 0xE450, 0xEC70, 0xEC90, 0xE44F, 0xED12, 0xBC2E, 0x7A67,
-    0x936C, 0xC4F3, 0xCD75, 0xC514, 0xA3EF, 0x7208, 0xBBEF, 0xDCD2,
-    0xE4B0, 0xE490, 0xEC8F, 0xEC90, 0xEC70, 0xEC90, 0xEC70, 0xEC70,
-    0xEC6F, 0xE470, 0xCC0F, 0x934D, 0x8491, 0x6CF3, 0x5D15, 0x5D36,
-    0x5D36, 0x5D36, 0x5D16, 0x5D16, 0x5CF5, 0x5D15, 0x5516, 0x5516,
-    0x5516, 0x5516, 0x5516, 0x5D16, 0x5D36, 0x6556, 0x6D56, 0x6536,
-    0x6536, 0x6536, 0x6556, 0x6556, 0x6536, 0x6535, 0x6535, 0x6535,
-    0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D15,
-    0x5D35, 0x5D15, 0x5D35, 0x5D15, 0x5D35, 0x3C11, 0x12ED, 0x33F1,
-    0x5515, 0x4CD3, 0x1B6D, 0x23EF, 0x34B2, 0x2C92, 0x2C93, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x2CD4,
-    0x34B4, 0x34B4, 0x2CB4, 0x2CB4, 0x85B6, 0x85B6, 0x85B6, 0x8595,
-    0x8596, 0x8596, 0x7D96, 0x7D95, 0x7D75, 0x7575, 0x7575, 0x7576,
-    0x7576, 0x6D76, 0x6D76, 0x6D76, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6D36, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6D36, 0x6535,
-    0x6D35, 0x6D35, 0x6D56, 0x7576, 0x7556, 0x7556, 0x7536, 0x7536,
-    0x7556, 0x6D36, 0x6D36, 0x6515, 0x6515, 0x6516, 0x64F5, 0x64F5,
-    0x5D16, 0x5D16, 0x5CF6, 0x5CF5, 0x5D16, 0x5D16, 0x5CF5, 0x5D16,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6, 0x5CF6, 0x5CD6, 0x5CF6,
-    0x5D15, 0x5CF5, 0x6CD3, 0x6C92, 0x7C92, 0x8492, 0x9430, 0x9B6E,
-    0xC3B0, 0xEC93, 0xC3CE, 0x7A47, 0xCDB4, 0xFF9C, 0xF79C, 0xFFDD,
-    0xFFBE, 0xDE17, 0x7248, 0xC450, 0xDC91, 0xDC71, 0xE470, 0xE470,
-    0xE490, 0xE4F1, 0x8AC9, 0xC512, 0xFF1B, 0xFF9D, 0xFF7E, 0xFFBE,
-    0xFF1C, 0xB492, 0x7A48, 0xD4D1, 0xE4D1, 0xE4B0, 0xEC90, 0xE46F,
-    0xEC70, 0xEC91, 0xEC91, 0xEC70, 0xEC6F, 0xE46F, 0xCC0F, 0x9B6C,
-    0x8491, 0x6CD2, 0x6514, 0x5D35, 0x5D36, 0x5D16, 0x5D16, 0x5D15,
-    0x54F5, 0x5515, 0x5516, 0x5516, 0x5516, 0x5516, 0x5516, 0x5515,
-    0x5D36, 0x6556, 0x6D56, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6535, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D35,
-    0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D15,
-    0x5D35, 0x4493, 0x236F, 0x4472, 0x5D35, 0x44B3, 0x134D, 0x23EF,
-    0x3492, 0x2472, 0x2C93, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CD4, 0x2CD4, 0x2CD4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x85B6, 0x85B6, 0x85B6, 0x8596, 0x8596, 0x8595, 0x7D96, 0x7D95,
-    0x7D75, 0x7575, 0x7575, 0x7576, 0x7576, 0x6D56, 0x6D55, 0x6D55,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6536, 0x6535, 0x6535, 0x6536,
-    0x6D35, 0x6D36, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x7556, 0x6D56,
-    0x6D56, 0x6D56, 0x6535, 0x6535, 0x6D35, 0x6D35, 0x6D35, 0x7556,
-    0x7556, 0x7535, 0x7536, 0x7536, 0x7536, 0x6D36, 0x6D36, 0x6515,
-    0x6515, 0x6515, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6, 0x5CF6,
-    0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6,
-    0x5CF6, 0x5CF6, 0x5CF6, 0x64F6, 0x64F5, 0x6CD4, 0x7C52, 0x7BCF,
-    0x8BEF, 0x9BCF, 0xA38E, 0xAB2D, 0xDC10, 0xF4D3, 0x8A88, 0xB46F,
-    0xFF9C, 0xF79C, 0xC678, 0xCE99, 0xF7BE, 0xFF9D, 0x9BCE, 0xA3AE,
-    0xDCD2, 0xDC91, 0xDC50, 0xE470, 0xE4B1, 0xC44E, 0x934A, 0xFF5B,
-    0xFF9D, 0xE6FB, 0xE71C, 0xFFFF, 0xFFDF, 0xF71C, 0x7AEB, 0xBC70,
-    0xDCD1, 0xE4B0, 0xE470, 0xEC90, 0xEC90, 0xEC91, 0xEC91, 0xEC70,
-    0xEC6F, 0xDC4F, 0xD42F, 0x9B6C, 0x8C6F, 0x7CF2, 0x64F3, 0x5D35,
-    0x5D35, 0x5D36, 0x5515, 0x5515, 0x5515, 0x5515, 0x5516, 0x5516,
-    0x5516, 0x5515, 0x54F5, 0x5515, 0x5D15, 0x6536, 0x6D56, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6535, 0x6535, 0x5D35, 0x5D35,
-    0x5D15, 0x5D15, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D35,
-    0x5D35, 0x5D35, 0x5D15, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D35,
-    0x5D56, 0x4492, 0x134D, 0x2C30, 0x3492, 0x2C92, 0x2C93, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x2CD4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x85B6, 0x85B6, 0x85B6, 0x8596,
-    0x8596, 0x85B6, 0x7D96, 0x7D96, 0x7D96, 0x7576, 0x7576, 0x7576,
-    0x6D76, 0x6D55, 0x6D55, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6536, 0x6535, 0x6515, 0x6515, 0x6D35, 0x6D36, 0x6D36, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6536, 0x6535,
-    0x6535, 0x6D35, 0x6D55, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7536, 0x6D36, 0x6D36, 0x6D35, 0x6516, 0x6516, 0x64F6, 0x5CF5,
-    0x5CF5, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5CF6,
-    0x5CF6, 0x5CF5, 0x5CF5, 0x5CF6, 0x5D16, 0x5D16, 0x5CF6, 0x64D5,
-    0x6CD5, 0x7493, 0x83AF, 0x938E, 0xBC10, 0xBB8E, 0xAACB, 0xC32D,
-    0xF492, 0xECB2, 0x8268, 0xE616, 0xFF9C, 0xE71A, 0x52CA, 0x52CA,
-    0xE73C, 0xFFDE, 0xBCF3, 0x932C, 0xE513, 0xDC91, 0xE470, 0xE491,
-    0xECF1, 0xB3CC, 0xB46F, 0xFF9C, 0xEEFB, 0x630B, 0x73AE, 0xEF5D,
-    0xFFDF, 0xFFDF, 0x93AE, 0xAC0F, 0xDCF2, 0xDC90, 0xEC90, 0xEC70,
-    0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC6F, 0xE48F, 0xDC4F, 0x9B2B,
-    0x942F, 0x84B1, 0x74B2, 0x64F4, 0x6535, 0x5D36, 0x5515, 0x5515,
-    0x5515, 0x5515, 0x5516, 0x5516, 0x5536, 0x5515, 0x5515, 0x5515,
-    0x5D15, 0x6536, 0x6D56, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6535, 0x6535, 0x6535, 0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D35,
-    0x5D35, 0x5D15, 0x5D15, 0x5D35, 0x5D15, 0x5D35, 0x5D15, 0x5D35,
-    0x5D36, 0x5D35, 0x5D36, 0x6556, 0x6556, 0x3C52, 0x1B6E, 0x3471,
-    0x34B3, 0x2C92, 0x2C93, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CD4, 0x2CD4, 0x34B4, 0x34B4, 0x34B4, 0x34B4,
-    0x85B6, 0x85B6, 0x85B6, 0x8596, 0x8596, 0x7D96, 0x7D96, 0x7D96,
-    0x7D96, 0x7576, 0x7576, 0x7576, 0x6D56, 0x6D56, 0x6D56, 0x6556,
-    0x6D76, 0x6D56, 0x6556, 0x6536, 0x6535, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6535, 0x6D36, 0x6D36, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6536, 0x6555, 0x6555, 0x6535, 0x6D35, 0x6D35, 0x7556,
-    0x7556, 0x7556, 0x7536, 0x7536, 0x6D36, 0x6D35, 0x6D15, 0x6515,
-    0x6515, 0x6516, 0x5D16, 0x5D16, 0x5CF5, 0x5CF5, 0x5D16, 0x5D16,
-    0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6,
-    0x54F6, 0x5D17, 0x5CF6, 0x64F6, 0x74B5, 0x8452, 0x938F, 0xC431,
-    0xEC92, 0xDBAE, 0xBAAA, 0xDB8E, 0xF492, 0xE491, 0x7206, 0xB4B0,
-    0xC553, 0xA491, 0x20E2, 0x31A5, 0xDE99, 0xFFBD, 0xAC70, 0xA38D,
-    0xE513, 0xE4B2, 0xECB1, 0xEC91, 0xE4B1, 0xBBCD, 0xB42E, 0xFF7C,
-    0xDE58, 0x20E3, 0x3166, 0xDEDB, 0xF79E, 0xFF7D, 0x93AE, 0xABCE,
-    0xDCF2, 0xDC70, 0xEC91, 0xE450, 0xEC71, 0xEC70, 0xE470, 0xEC70,
-    0xEC4F, 0xF490, 0xE44F, 0xAB0A, 0x9B8C, 0x8BEE, 0x7C10, 0x7492,
-    0x64F4, 0x5D15, 0x4CF4, 0x4D15, 0x5515, 0x5515, 0x5516, 0x5516,
-    0x5536, 0x5515, 0x5515, 0x5515, 0x5D15, 0x6536, 0x6D56, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D15, 0x5D15, 0x5D15,
-    0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D56,
-    0x5D56, 0x3C51, 0x1B8E, 0x3492, 0x3CB3, 0x2C92, 0x2CB3, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CD4, 0x2CB4,
-    0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x85B6, 0x85B6, 0x85B6, 0x7D96,
-    0x7D96, 0x7D96, 0x7D96, 0x7D96, 0x7596, 0x7576, 0x7576, 0x6D56,
-    0x6D56, 0x6555, 0x6556, 0x6556, 0x6D76, 0x6556, 0x6556, 0x6535,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6D35, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6536, 0x6536, 0x6555,
-    0x6535, 0x6D35, 0x6D35, 0x7556, 0x7556, 0x7536, 0x7536, 0x7536,
-    0x6D35, 0x6D15, 0x6D15, 0x6515, 0x6516, 0x6516, 0x5D16, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF6, 0x5D16, 0x5CF6, 0x5D16, 0x5D16, 0x5CF6,
-    0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x5516, 0x5D16, 0x5D16, 0x64F6,
-    0x74B4, 0x7C11, 0x9B4E, 0xE472, 0xF451, 0xDB4C, 0xCACA, 0xEBEF,
-    0xF450, 0xDC50, 0x8247, 0x7247, 0x82EA, 0x72AA, 0x4165, 0x4185,
-    0x93CE, 0xCD54, 0x8AEB, 0xC450, 0xE4F2, 0xE491, 0xEC91, 0xEC70,
-    0xE490, 0xCC0E, 0x8288, 0xC4F2, 0x93CE, 0x28C2, 0x3124, 0x8C10,
-    0xA492, 0xB4D2, 0x6A07, 0xC471, 0xDCD2, 0xDC70, 0xE471, 0xEC50,
-    0xEC91, 0xEC71, 0xEC70, 0xEC70, 0xF450, 0xF470, 0xE3CE, 0xB2EA,
-    0xB36C, 0xA3AD, 0x8BCF, 0x7C31, 0x74D4, 0x5CF4, 0x4CD4, 0x4D15,
-    0x5515, 0x5515, 0x5516, 0x5516, 0x5516, 0x5515, 0x54F5, 0x5515,
-    0x5D36, 0x6536, 0x6556, 0x6536, 0x6535, 0x6535, 0x6535, 0x6536,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D35, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D36, 0x5D55, 0x4492, 0x1B8E, 0x3471,
-    0x34B2, 0x2C92, 0x2CB3, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CD4, 0x2CD4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x7DB6, 0x7D96, 0x7D96, 0x7D96, 0x7D96, 0x7D96, 0x7D96, 0x7596,
-    0x7575, 0x7576, 0x6D76, 0x6D55, 0x6556, 0x6555, 0x6556, 0x6576,
-    0x6556, 0x6556, 0x6535, 0x6535, 0x5D15, 0x5D15, 0x6515, 0x6515,
-    0x6515, 0x6535, 0x6515, 0x6515, 0x6535, 0x6D36, 0x6D36, 0x6536,
-    0x6536, 0x6535, 0x6535, 0x6535, 0x6535, 0x6D35, 0x6D35, 0x7556,
-    0x7536, 0x7536, 0x7556, 0x7536, 0x6D15, 0x6D15, 0x6D16, 0x6516,
-    0x6516, 0x6516, 0x5D16, 0x5CF5, 0x5CF5, 0x5CF5, 0x5D16, 0x5D16,
-    0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6,
-    0x5D16, 0x54F6, 0x5CF6, 0x6516, 0x74D5, 0x7BD0, 0xA34E, 0xE431,
-    0xE3AE, 0xD2EA, 0xE36C, 0xFC50, 0xEC70, 0xE491, 0xCC70, 0xCC90,
-    0xD4F2, 0xD513, 0xCCF3, 0xB42F, 0x82CA, 0x69E6, 0x8248, 0xDCD1,
-    0xDC91, 0xE470, 0xEC71, 0xEC70, 0xE470, 0xBB8D, 0x7A06, 0x8289,
-    0x934C, 0x934C, 0x8B4C, 0x936D, 0x82EB, 0x7228, 0x50C2, 0xC40F,
-    0xE4D2, 0xE491, 0xE471, 0xEC71, 0xEC91, 0xEC91, 0xEC91, 0xEC70,
-    0xFC71, 0xF42F, 0xD32B, 0xCB2B, 0xDC0F, 0xD470, 0xB410, 0x8BAF,
-    0x84B3, 0x64D4, 0x54F4, 0x4D15, 0x5536, 0x5516, 0x5516, 0x5516,
-    0x5516, 0x5515, 0x54F5, 0x5D15, 0x5D36, 0x6536, 0x6556, 0x6556,
-    0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D56,
-    0x5D55, 0x4CF4, 0x1B6E, 0x3451, 0x3492, 0x2C92, 0x2C93, 0x2C94,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x7D96, 0x7D96, 0x7596, 0x7596,
-    0x7596, 0x7596, 0x7576, 0x7575, 0x7576, 0x6D75, 0x6D55, 0x6555,
-    0x6556, 0x6576, 0x6576, 0x6576, 0x6556, 0x6535, 0x6535, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6536, 0x6536, 0x6536, 0x6536, 0x6535, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6D35, 0x6D36, 0x7536, 0x7536, 0x7536, 0x6D36,
-    0x6D16, 0x6515, 0x6516, 0x6516, 0x6516, 0x6516, 0x5D16, 0x5D16,
-    0x5CF5, 0x5D15, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16,
-    0x5D16, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF5, 0x5D16, 0x6516,
-    0x74D5, 0x7BF1, 0xAB6F, 0xEC51, 0xD32B, 0xC288, 0xEBED, 0xF44F,
-    0xEC70, 0xEC91, 0xE4D1, 0xDCD1, 0xDCD2, 0xDCD2, 0xE513, 0xF595,
-    0xE533, 0xBBEE, 0xD470, 0xECF2, 0xE470, 0xE470, 0xEC71, 0xEC50,
-    0xEC91, 0xDC50, 0xDC91, 0xDCB1, 0xE533, 0xE553, 0xED95, 0xDD13,
-    0xDD13, 0xCC91, 0x9AEA, 0xCC2F, 0xE4B1, 0xE491, 0xE471, 0xEC71,
-    0xEC71, 0xEC70, 0xEC91, 0xF470, 0xF450, 0xD34C, 0xD30B, 0xEBEE,
-    0xF470, 0xEC91, 0xDC72, 0x936E, 0x8472, 0x6CD4, 0x5CF5, 0x5515,
-    0x5536, 0x5536, 0x5536, 0x5536, 0x5516, 0x54F5, 0x5515, 0x5D15,
-    0x5D35, 0x6536, 0x6556, 0x6536, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6535,
-    0x6535, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D35, 0x5D35, 0x5D35,
-    0x5D35, 0x5D15, 0x5D35, 0x5D55, 0x5D35, 0x5535, 0x1B8E, 0x2C30,
-    0x3492, 0x2C92, 0x2C93, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2C94,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x7596, 0x7596, 0x7596, 0x7596, 0x7596, 0x7596, 0x7576, 0x6D75,
-    0x6D75, 0x6D75, 0x6D55, 0x6555, 0x6555, 0x6576, 0x6576, 0x6556,
-    0x6555, 0x5D55, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x6515,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536, 0x6536,
-    0x6535, 0x6515, 0x6515, 0x6515, 0x64F5, 0x6515, 0x6D15, 0x6D36,
-    0x7536, 0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x64F6, 0x6516, 0x6516,
-    0x6516, 0x6516, 0x5D16, 0x5CF5, 0x5CF5, 0x5D16, 0x5D16, 0x5D16,
-    0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5CF6, 0x5CF6,
-    0x5CF5, 0x5D16, 0x5D37, 0x5D16, 0x6CB5, 0x83F1, 0xA34E, 0xEC31,
-    0xCB0A, 0xCAE9, 0xFC70, 0xF44F, 0xEC2F, 0xE470, 0xE470, 0xD42F,
-    0xCBEE, 0xD40F, 0xD40F, 0xD3EE, 0xDC50, 0xECD1, 0xECF1, 0xE490,
-    0xE470, 0xEC90, 0xEC70, 0xEC50, 0xEC91, 0xEC91, 0xE4B2, 0xE491,
-    0xD42F, 0xD44F, 0xDC50, 0xD42F, 0xDC91, 0xECF2, 0xE491, 0xE470,
-    0xEC91, 0xE471, 0xEC91, 0xE471, 0xE470, 0xEC70, 0xEC70, 0xEC70,
-    0xDBCE, 0xC2EA, 0xE3CD, 0xFC90, 0xF42F, 0xEC4F, 0xE492, 0xA36E,
-    0x8411, 0x6CB3, 0x5CF4, 0x5515, 0x5516, 0x5516, 0x5536, 0x5536,
-    0x5515, 0x54F5, 0x5515, 0x5D15, 0x5D15, 0x6535, 0x6536, 0x6535,
-    0x6535, 0x6535, 0x6536, 0x6536, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x5D35, 0x5D15,
-    0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x5D35,
-    0x5D55, 0x5D55, 0x2C10, 0x23CF, 0x3492, 0x2C92, 0x2CB3, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x7596, 0x7596, 0x7596, 0x7596,
-    0x7596, 0x7596, 0x7576, 0x7575, 0x6D76, 0x6D75, 0x6555, 0x6555,
-    0x6556, 0x6576, 0x6576, 0x6556, 0x6556, 0x5D55, 0x5D35, 0x5D35,
-    0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6536, 0x6536, 0x6535, 0x6536, 0x6535, 0x6515, 0x6515,
-    0x64F5, 0x6515, 0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D16, 0x6516, 0x6516, 0x6516, 0x6516, 0x5D15, 0x5CF5, 0x5D15,
-    0x5D15, 0x5D15, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16, 0x5D16,
-    0x5D16, 0x5D16, 0x5CF6, 0x5CD6, 0x5CD5, 0x5D16, 0x5D36, 0x5CF6,
-    0x74D5, 0x8C53, 0xA32E, 0xE431, 0xC2A9, 0xDB4B, 0xFC6F, 0xEC2F,
-    0xEC50, 0xE450, 0xE44F, 0xDC2F, 0xD3CE, 0xD3CE, 0xCB8D, 0xD38D,
-    0xD3AD, 0xE450, 0xE470, 0xECB0, 0xEC91, 0xEC70, 0xEC50, 0xEC50,
-    0xEC50, 0xEC91, 0xEC71, 0xE450, 0xD3EE, 0xCB8C, 0xC36C, 0xC34C,
-    0xC36C, 0xD3CE, 0xDC2F, 0xEC91, 0xEC71, 0xE450, 0xECB2, 0xE471,
-    0xEC91, 0xEC91, 0xEC70, 0xEC50, 0xCB4C, 0xD36C, 0xF490, 0xF46F,
-    0xEC2E, 0xEC4F, 0xEC91, 0xABAF, 0x8410, 0x7493, 0x5CF5, 0x5515,
-    0x5516, 0x4D16, 0x4D16, 0x4D15, 0x5515, 0x54F5, 0x5515, 0x5D15,
-    0x5D15, 0x6535, 0x6536, 0x6536, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D55, 0x5D55, 0x4492, 0x136E,
-    0x2C51, 0x2C72, 0x34D4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x34B4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x7576, 0x7D76, 0x7D76, 0x7576, 0x7576, 0x7596, 0x7576, 0x7575,
-    0x6D76, 0x6D75, 0x6D75, 0x6556, 0x6556, 0x6576, 0x6556, 0x6556,
-    0x6555, 0x6555, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6535, 0x6535, 0x6515, 0x5D15, 0x6515, 0x6515, 0x6D35, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6516, 0x6516,
-    0x6516, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D16, 0x5D16, 0x5D16,
-    0x5D16, 0x5D16, 0x5CF6, 0x5D16, 0x5D16, 0x5CF6, 0x54F6, 0x5CF6,
-    0x5CF6, 0x5D16, 0x5D16, 0x64F6, 0x6CD5, 0x8473, 0xA34F, 0xCBAF,
-    0xBAA9, 0xF42F, 0xEC2F, 0xEC4F, 0xEC70, 0xE450, 0xE470, 0xEC70,
-    0xEC50, 0xEC70, 0xEC30, 0xEC50, 0xE40F, 0xE42F, 0xEC70, 0xF491,
-    0xEC71, 0xEC50, 0xE430, 0xEC30, 0xE410, 0xEC51, 0xEC71, 0xEC71,
-    0xEC50, 0xE450, 0xE42F, 0xE40F, 0xE42F, 0xE470, 0xEC91, 0xEC91,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xE42F,
-    0xCB6C, 0xE42F, 0xFC90, 0xF44F, 0xE3ED, 0xE42F, 0xE471, 0xA38E,
-    0x83F0, 0x6C93, 0x5CD5, 0x54F6, 0x5516, 0x4CF6, 0x4D16, 0x5516,
-    0x5515, 0x54F5, 0x5515, 0x5D35, 0x5D35, 0x6535, 0x6535, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D35,
-    0x5D55, 0x5D55, 0x5534, 0x1B6D, 0x23EF, 0x3493, 0x2CB3, 0x2CD4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x7D76, 0x7576, 0x7576, 0x7576,
-    0x7576, 0x7596, 0x7576, 0x6D75, 0x6D75, 0x6D76, 0x6556, 0x6556,
-    0x6556, 0x6576, 0x6556, 0x6556, 0x6555, 0x6535, 0x5D35, 0x5D35,
-    0x5D35, 0x5D15, 0x5D15, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6536, 0x6535, 0x6535, 0x6515, 0x5D15,
-    0x6515, 0x6515, 0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D16,
-    0x6D16, 0x6516, 0x6516, 0x6516, 0x6515, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5515, 0x5D15, 0x54F5, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6,
-    0x5CF6, 0x54F6, 0x54F6, 0x5CF6, 0x5CF5, 0x5CF6, 0x64F6, 0x64F6,
-    0x6CD5, 0x8473, 0x9B4F, 0xBB2D, 0xCB0C, 0xF450, 0xEC2F, 0xEC4F,
-    0xEC70, 0xE470, 0xE470, 0xE470, 0xEC70, 0xEC70, 0xEC70, 0xE42F,
-    0xD34C, 0xEC0F, 0xF491, 0xF491, 0xEC70, 0xEC91, 0xEC51, 0xE430,
-    0xDBAE, 0xD38E, 0xEC30, 0xEC50, 0xEC70, 0xEC91, 0xEC91, 0xEC91,
-    0xEC91, 0xEC91, 0xEC70, 0xEC50, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC91, 0xEC71, 0xE430, 0xD3EE, 0xEC70, 0xF450, 0xD32B,
-    0xDB8C, 0xF490, 0xDC50, 0x9B6D, 0x8410, 0x6CB3, 0x5CD5, 0x4CF6,
-    0x4D16, 0x4D16, 0x4D16, 0x4D15, 0x5515, 0x5515, 0x5D15, 0x5D35,
-    0x5D35, 0x5D35, 0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6535, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D35, 0x5D35, 0x5D55, 0x5D55, 0x5D35, 0x1B6E,
-    0x23CF, 0x3493, 0x2CB3, 0x2CD4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x7576, 0x7576, 0x7575, 0x7575, 0x7576, 0x7576, 0x7576, 0x6D75,
-    0x6D55, 0x6D55, 0x6555, 0x6555, 0x6576, 0x6576, 0x6556, 0x6556,
-    0x6535, 0x6535, 0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x5D15, 0x6535,
-    0x6535, 0x6535, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6536,
-    0x6535, 0x6535, 0x6515, 0x5D15, 0x6515, 0x6515, 0x6515, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6516, 0x6516, 0x6516,
-    0x6515, 0x6535, 0x5D36, 0x5D15, 0x5D15, 0x5D15, 0x54F5, 0x54F5,
-    0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x5CF6, 0x54D6, 0x5CD6,
-    0x5CD6, 0x5CD6, 0x5CF6, 0x64F6, 0x6CD5, 0x8452, 0x9B6F, 0xAAAB,
-    0xDBCE, 0xF450, 0xEC2F, 0xEC4F, 0xE450, 0xE470, 0xE470, 0xE470,
-    0xEC70, 0xEC70, 0xEC2F, 0xD38D, 0xDBAD, 0xEC2F, 0xF470, 0xEC70,
-    0xF491, 0xEC71, 0xEC70, 0xEC71, 0xE40F, 0xCB4C, 0xDBCE, 0xF491,
-    0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xEC70, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xE430,
-    0xDC2F, 0xEC70, 0xDBAD, 0xCAEA, 0xDB6C, 0xF491, 0xD450, 0x936D,
-    0x8451, 0x6CD3, 0x54F5, 0x4CF6, 0x4D16, 0x4D16, 0x4D16, 0x5515,
-    0x5516, 0x5D15, 0x5D15, 0x5D35, 0x5D35, 0x5D35, 0x6535, 0x6535,
-    0x6536, 0x6536, 0x6536, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6535, 0x6515, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x5D35, 0x5D35,
-    0x5D35, 0x5D55, 0x5D35, 0x238E, 0x1BAF, 0x3492, 0x2C93, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x7555, 0x7575, 0x7555, 0x7575,
-    0x7575, 0x7575, 0x6D75, 0x6D55, 0x6D55, 0x6555, 0x6555, 0x6555,
-    0x6576, 0x6576, 0x6556, 0x6556, 0x6535, 0x6535, 0x5D35, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x6535, 0x6535, 0x6535, 0x6535, 0x6515,
-    0x6515, 0x6535, 0x6535, 0x6556, 0x6535, 0x6535, 0x6515, 0x5D15,
-    0x6515, 0x6515, 0x6535, 0x6D35, 0x6D35, 0x6D35, 0x6D16, 0x6D15,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x6515, 0x6515, 0x5D16, 0x5D15,
-    0x5CF5, 0x54F5, 0x54F5, 0x54F5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6,
-    0x5CF6, 0x54D6, 0x54D6, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD6, 0x64F6,
-    0x6CB4, 0x8472, 0x9B6E, 0xB2EC, 0xEC30, 0xF450, 0xEC4F, 0xEC70,
-    0xEC50, 0xEC90, 0xE490, 0xE470, 0xE470, 0xE44F, 0xD38C, 0xCB6C,
-    0xEC4F, 0xEC4F, 0xEC2F, 0xF470, 0xEC50, 0xEC70, 0xEC91, 0xEC91,
-    0xE470, 0xD3CE, 0xCB4C, 0xF4B1, 0xEC91, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC50, 0xEC70, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC91, 0xEC71, 0xE450, 0xE450, 0xE42F, 0xD34B, 0xE38D,
-    0xD34C, 0xEC91, 0xC40F, 0x8B8D, 0x7C72, 0x64D4, 0x5515, 0x4D16,
-    0x4D16, 0x4D16, 0x5516, 0x5515, 0x5515, 0x5D15, 0x5D35, 0x5D35,
-    0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x5D35, 0x2BAF,
-    0x1B8E, 0x3472, 0x2C93, 0x2C94, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2C94,
-    0x7555, 0x7555, 0x7555, 0x6D55, 0x6D55, 0x6D55, 0x6D55, 0x6555,
-    0x6555, 0x6555, 0x6555, 0x6556, 0x6576, 0x6576, 0x6556, 0x6536,
-    0x6535, 0x6535, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x6515, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6515, 0x6535, 0x6535, 0x6535, 0x6536,
-    0x6535, 0x6535, 0x6515, 0x5D15, 0x6515, 0x6515, 0x6535, 0x6D35,
-    0x6D15, 0x6D15, 0x6D15, 0x6D15, 0x6516, 0x6516, 0x6516, 0x6516,
-    0x6515, 0x6515, 0x6536, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CD5, 0x54D5, 0x5CD6,
-    0x5CD6, 0x5CD6, 0x5CF6, 0x64F5, 0x6CB3, 0x8472, 0x9B4D, 0xC36D,
-    0xEC70, 0xEC6F, 0xEC70, 0xEC90, 0xEC70, 0xEC90, 0xEC90, 0xE490,
-    0xEC70, 0xDBEE, 0xD38C, 0xEC4F, 0xF450, 0xF450, 0xF450, 0xF470,
-    0xF470, 0xF491, 0xEC91, 0xE450, 0xEC50, 0xEC91, 0xCB6C, 0xE42F,
-    0xF491, 0xEC91, 0xEC70, 0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC90, 0xE40E, 0xE3CE, 0xEBCE, 0xCB2B, 0xECB2, 0xABAE, 0x83AE,
-    0x7492, 0x5CF4, 0x5515, 0x4D16, 0x4D16, 0x4D16, 0x5515, 0x5515,
-    0x5515, 0x5D15, 0x5D15, 0x5D35, 0x5D35, 0x5D35, 0x5D15, 0x5D15,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x6535, 0x5D55,
-    0x5D35, 0x5D35, 0x6555, 0x3410, 0x1B8E, 0x3472, 0x2C93, 0x2C94,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x7555, 0x6D55, 0x6D55, 0x6D55,
-    0x6D55, 0x6D55, 0x6D55, 0x6555, 0x6555, 0x6555, 0x6556, 0x6576,
-    0x6D76, 0x6576, 0x6556, 0x6556, 0x6556, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x6515, 0x6535, 0x6535, 0x6536, 0x6536, 0x6D36, 0x6536,
-    0x6536, 0x6535, 0x6536, 0x6536, 0x6535, 0x6535, 0x6515, 0x5D15,
-    0x6515, 0x6515, 0x6535, 0x6535, 0x6D35, 0x6D35, 0x6D36, 0x6D35,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x6515, 0x6515, 0x6536, 0x5D15,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6,
-    0x5CF6, 0x5CF5, 0x5CF5, 0x5CD6, 0x5CD6, 0x5CD6, 0x64F6, 0x64D5,
-    0x7493, 0x8C31, 0xA34D, 0xD3EF, 0xEC70, 0xEC70, 0xEC90, 0xEC90,
-    0xEC70, 0xEC70, 0xE470, 0xE470, 0xEC70, 0xD3AD, 0xE40F, 0xFCB1,
-    0xE3CE, 0xDBAD, 0xF450, 0xF471, 0xEC70, 0xE42F, 0xE42F, 0xEC70,
-    0xEC70, 0xF4B1, 0xD3AD, 0xDC0E, 0xF4B1, 0xEC91, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC4F, 0xF470, 0xEC0E,
-    0xD38D, 0xDC91, 0x938E, 0x7C10, 0x64B2, 0x54F4, 0x5515, 0x4D16,
-    0x4D16, 0x4D16, 0x5515, 0x5515, 0x54F5, 0x5D15, 0x5D15, 0x5D36,
-    0x5D35, 0x5D35, 0x5D15, 0x5D15, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D35, 0x5D35, 0x6535, 0x5D35, 0x5D35, 0x6576, 0x3C51,
-    0x1B8E, 0x3472, 0x2C93, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x7535, 0x6D35, 0x6D35, 0x6D55, 0x6D35, 0x6D35, 0x6535, 0x6555,
-    0x6535, 0x6D55, 0x6D56, 0x6D76, 0x6D56, 0x6D76, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6536, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6536, 0x6535, 0x6535,
-    0x6535, 0x6515, 0x6515, 0x6515, 0x6535, 0x6515, 0x6535, 0x6535,
-    0x6D35, 0x6D35, 0x6D36, 0x6D36, 0x6536, 0x6516, 0x6516, 0x6516,
-    0x6515, 0x6515, 0x6536, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6, 0x5CF5, 0x5CF5, 0x5CF6,
-    0x5CD6, 0x5CF6, 0x6516, 0x6CD4, 0x7C93, 0x8BF0, 0xAB6E, 0xE430,
-    0xEC50, 0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xEC70, 0xE470, 0xE470,
-    0xEC70, 0xDBCE, 0xDBAE, 0xE3CE, 0xD36D, 0xCB0B, 0xEC30, 0xF491,
-    0xEC50, 0xCB6D, 0xCB6D, 0xDC0F, 0xEC70, 0xEC70, 0xDBAE, 0xDBCE,
-    0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC91, 0xEC91, 0xEC71, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91,
-    0xEC90, 0xEC70, 0xF470, 0xF450, 0xE430, 0xC3EF, 0x8BAE, 0x7C71,
-    0x64D3, 0x4CF4, 0x5515, 0x4D16, 0x4CF5, 0x5516, 0x5515, 0x54F5,
-    0x54F5, 0x5CF5, 0x5D15, 0x5D36, 0x6535, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x5D15, 0x5D15, 0x6515, 0x6515, 0x6515, 0x6515, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D35, 0x6535,
-    0x5D35, 0x5D35, 0x6596, 0x4492, 0x1B8E, 0x3472, 0x2C73, 0x2CB3,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x6D35, 0x6D34, 0x6D34, 0x6D34,
-    0x6D35, 0x6534, 0x6D35, 0x6D55, 0x6535, 0x6D55, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6535, 0x6535, 0x6536, 0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6536, 0x6535, 0x6535, 0x6535, 0x6535, 0x6515, 0x6515, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x6515, 0x6535, 0x5D16, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF6, 0x54F6, 0x54F6, 0x54F6, 0x54F6, 0x5CF6, 0x6516, 0x6CB3,
-    0x8472, 0x8BAF, 0xBBAE, 0xEC71, 0xEC50, 0xF490, 0xEC90, 0xE470,
-    0xEC70, 0xEC70, 0xE470, 0xE470, 0xEC70, 0xE410, 0xCB4C, 0xD3AD,
-    0xE3CE, 0xCB4C, 0xE40F, 0xEC50, 0xD3AE, 0xD38D, 0xE42F, 0xD38D,
-    0xD3AD, 0xD3AD, 0xD3AD, 0xE42F, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC51, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC90, 0xEC70, 0xEC4F, 0xF490,
-    0xE470, 0xA38D, 0x7BCE, 0x74B2, 0x5CF4, 0x4CF4, 0x5515, 0x5516,
-    0x54F6, 0x5516, 0x5515, 0x54F5, 0x5CF5, 0x5D15, 0x5D15, 0x5D36,
-    0x6535, 0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x6515,
-    0x6515, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x6535, 0x6535, 0x5D35, 0x5D35, 0x6D96, 0x4CB3,
-    0x238E, 0x3472, 0x2C92, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x7535, 0x7535, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D55,
-    0x6D35, 0x6D35, 0x6D35, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6536, 0x6536, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6535, 0x6535, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6515, 0x6535,
-    0x6535, 0x6515, 0x6515, 0x6515, 0x6516, 0x6516, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x5D16, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D16, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x54F6,
-    0x5516, 0x5CF5, 0x64D4, 0x74B3, 0x8C31, 0x936E, 0xD430, 0xEC50,
-    0xEC70, 0xEC90, 0xEC90, 0xEC90, 0xEC70, 0xEC71, 0xEC91, 0xE470,
-    0xEC70, 0xEC70, 0xF491, 0xEC70, 0xF471, 0xDBCE, 0xCB6D, 0xD3AE,
-    0xCB6D, 0xE450, 0xEC91, 0xE450, 0xDC0F, 0xDBEF, 0xE42F, 0xF491,
-    0xEC91, 0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xEC51, 0xEC71, 0xEC71,
-    0xEC50, 0xE44F, 0xF470, 0xEC50, 0xBB8D, 0x936D, 0x7C10, 0x6CD3,
-    0x5D14, 0x5515, 0x5515, 0x5516, 0x5516, 0x5516, 0x54F5, 0x5CF5,
-    0x5CF5, 0x5D16, 0x5D15, 0x5D16, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x6515, 0x6515,
-    0x5CF5, 0x5D15, 0x6515, 0x6515, 0x6515, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5D15, 0x6535, 0x6535, 0x6535,
-    0x6536, 0x5D15, 0x6576, 0x5514, 0x1B8E, 0x3472, 0x2C92, 0x2C93,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2C94, 0x34B4, 0x34B4, 0x7555, 0x7555, 0x7535, 0x7555,
-    0x7555, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D55, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x7556, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D36, 0x6536, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6536, 0x6535, 0x6535, 0x6515, 0x6515, 0x6515, 0x6515, 0x6535,
-    0x6535, 0x6535, 0x6515, 0x6535, 0x6515, 0x6515, 0x6515, 0x6535,
-    0x6516, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D36, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x54F5, 0x54F5, 0x54F5,
-    0x5D15, 0x5515, 0x5515, 0x5515, 0x5516, 0x5D15, 0x6CF4, 0x7C93,
-    0x8BF0, 0xAB8E, 0xE451, 0xF450, 0xF470, 0xEC90, 0xEC90, 0xE470,
-    0xEC50, 0xE450, 0xE470, 0xE490, 0xE490, 0xE470, 0xEC91, 0xECB1,
-    0xEC91, 0xEC71, 0xDC0F, 0xDC0F, 0xDC30, 0xE450, 0xE471, 0xEC91,
-    0xEC71, 0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC51, 0xEC51, 0xEC71, 0xEC71, 0xE450, 0xE42F, 0xEC2F, 0xD3AD,
-    0xAB2B, 0x93AE, 0x7C91, 0x64D3, 0x5514, 0x5515, 0x5515, 0x54F6,
-    0x5CF6, 0x5CF6, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5D15, 0x6515, 0x6515, 0x5D15, 0x5D15, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x6535, 0x6535, 0x5D35, 0x6556, 0x6D76, 0x6556, 0x5D35,
-    0x23AE, 0x3472, 0x2C92, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2CB4, 0x2CB4, 0x2C94, 0x2C94, 0x2C94, 0x34B4, 0x34B4, 0x34B4,
-    0x7D55, 0x7D55, 0x7D55, 0x7555, 0x7555, 0x7535, 0x6D35, 0x6D35,
-    0x6D35, 0x6D35, 0x6D35, 0x6D36, 0x6D56, 0x7556, 0x7536, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D55, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x6535, 0x6535, 0x6535, 0x6516, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x5D36, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5515,
-    0x54F5, 0x54F5, 0x54F5, 0x54F5, 0x5515, 0x5515, 0x5515, 0x5515,
-    0x5515, 0x5D15, 0x6CD3, 0x8472, 0x938F, 0xC3F0, 0xEC71, 0xF430,
-    0xEC50, 0xEC70, 0xEC91, 0xEC91, 0xEC71, 0xEC71, 0xEC91, 0xECB1,
-    0xECB1, 0xE490, 0xECB1, 0xF4D2, 0xE450, 0xEC91, 0xE450, 0xE470,
-    0xEC91, 0xE471, 0xE471, 0xE491, 0xE450, 0xEC91, 0xEC91, 0xEC50,
-    0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xF471, 0xF471, 0xF471, 0xEC51, 0xEC71, 0xEC51, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC4F, 0xC38C, 0x92EA, 0x93EF, 0x7CD3, 0x5CF3,
-    0x5514, 0x5515, 0x54F5, 0x5CF5, 0x5CF6, 0x5CF5, 0x5D15, 0x5D15,
-    0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x6515, 0x6515, 0x6536, 0x6535, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x6535, 0x6535, 0x5D14,
-    0x5D15, 0x6D96, 0x6556, 0x6555, 0x23AF, 0x2C31, 0x3493, 0x2CB3,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4, 0x2C94, 0x2CB4, 0x2C94, 0x2C94,
-    0x2C94, 0x34B4, 0x34B4, 0x34B4, 0x7D76, 0x7D76, 0x7D56, 0x7D55,
-    0x7556, 0x7535, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D36,
-    0x7536, 0x7556, 0x7536, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D35,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D56, 0x6D36, 0x6D36, 0x6D36,
-    0x6536, 0x6535, 0x6535, 0x6535, 0x6515, 0x6515, 0x6515, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D36, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x54F5, 0x54F5,
-    0x5515, 0x5515, 0x5515, 0x5515, 0x5515, 0x5CD4, 0x7472, 0x8C11,
-    0xA36E, 0xDC51, 0xEC50, 0xF430, 0xEC4F, 0xEC70, 0xEC91, 0xE470,
-    0xEC71, 0xF491, 0xEC70, 0xE490, 0xE490, 0xDC70, 0xE4B1, 0xECD1,
-    0xE4B1, 0xE4B1, 0xE4B1, 0xECD2, 0xECD2, 0xE4B1, 0xDC70, 0xDC70,
-    0xE470, 0xE470, 0xE470, 0xEC91, 0xEC71, 0xEC91, 0xEC71, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xF471, 0xF471, 0xF471, 0xEC51,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC70, 0xF490, 0xD3EE,
-    0x9B0B, 0x8C10, 0x74D3, 0x5CF4, 0x5515, 0x5515, 0x54F5, 0x5CF5,
-    0x5CF6, 0x5CF5, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5CF5, 0x5D15, 0x5D15, 0x5D15,
-    0x6515, 0x6515, 0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5D15, 0x5D15,
-    0x5D15, 0x6535, 0x6535, 0x54F4, 0x3BF0, 0x54B3, 0x6555, 0x5D55,
-    0x2BCF, 0x2C10, 0x3493, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x2C94, 0x34B4, 0x34B4, 0x34B4,
-    0x8576, 0x7D76, 0x7D76, 0x7D55, 0x7D55, 0x7555, 0x7555, 0x6D35,
-    0x6D35, 0x6D35, 0x6D35, 0x6D55, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x6D56, 0x6D56, 0x6D35, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D36, 0x6D36, 0x6536, 0x6D36, 0x6536, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x5D36, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x54F5, 0x5515, 0x5515, 0x54F5,
-    0x5CF5, 0x64D4, 0x7C72, 0x8B8F, 0xB3AE, 0xEC71, 0xF450, 0xF450,
-    0xEC50, 0xE470, 0xEC70, 0xEC91, 0xF491, 0xEC91, 0xE470, 0xE4B1,
-    0xE4D1, 0xED12, 0xED12, 0xDC91, 0xD490, 0xC40E, 0xBBEE, 0xC42F,
-    0xCC70, 0xD4B2, 0xE513, 0xE4F3, 0xE4D2, 0xE491, 0xE471, 0xEC91,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xF471, 0xEC70, 0xEC70, 0xEC70, 0xF471, 0xF471,
-    0xEC71, 0xE450, 0xF490, 0xDC4F, 0x9B4C, 0x8C10, 0x6CB3, 0x5D14,
-    0x5515, 0x5515, 0x54F5, 0x54F5, 0x5CF6, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF4, 0x5CF4,
-    0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5CF4, 0x5CF5, 0x5D15, 0x5D15, 0x6535, 0x6535, 0x5CF4,
-    0x1AEC, 0x2B8E, 0x6555, 0x5D55, 0x3431, 0x23EF, 0x3493, 0x2CB3,
-    0x2CB4, 0x2CB4, 0x2CB4, 0x34B4, 0x3494, 0x34B4, 0x3494, 0x3494,
-    0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x7D76, 0x7D56, 0x7D55, 0x7D55,
-    0x7D55, 0x7555, 0x7535, 0x7535, 0x6D35, 0x6D35, 0x6D55, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7576, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6515, 0x6535, 0x6D36,
-    0x6536, 0x6535, 0x6535, 0x6535, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6515,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D16, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x54F5, 0x5515, 0x5D15, 0x64F5, 0x74D4, 0x8C72, 0x8B4E,
-    0xCBF0, 0xEC51, 0xF470, 0xF470, 0xEC70, 0xEC70, 0xEC71, 0xF4B1,
-    0xEC71, 0xE450, 0xECB1, 0xECF2, 0xECD2, 0xC3EE, 0xAB2B, 0x8206,
-    0x71A5, 0x8268, 0x8288, 0x7248, 0x7227, 0x7248, 0x932B, 0xBC2F,
-    0xDCD2, 0xE4F3, 0xECD3, 0xDC71, 0xE450, 0xE450, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xF471, 0xF471, 0xF471, 0xEC71, 0xE470, 0xF490, 0xDC50,
-    0x9B4D, 0x8C10, 0x6CB3, 0x5CF4, 0x5515, 0x5515, 0x5515, 0x54F5,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF5, 0x5CF4, 0x5CF4, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5CF4, 0x5CF4, 0x5D15,
-    0x5D15, 0x6535, 0x6535, 0x5D15, 0x234E, 0x2B6F, 0x6556, 0x6575,
-    0x4492, 0x1BAF, 0x3492, 0x34B3, 0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4,
-    0x3494, 0x3494, 0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x34B4,
-    0x7D55, 0x7D55, 0x7D55, 0x7D55, 0x7D55, 0x7555, 0x7535, 0x6D35,
-    0x6D35, 0x6D35, 0x6D35, 0x6D55, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7576, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D35, 0x6515, 0x6D35, 0x6D36, 0x6D56, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D16, 0x5D16, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5CF5,
-    0x64D4, 0x74B3, 0x8C31, 0x9B8F, 0xDC71, 0xEC30, 0xF450, 0xF470,
-    0xE450, 0xEC91, 0xE470, 0xEC51, 0xEC71, 0xF4B2, 0xF512, 0xDC70,
-    0x9A89, 0x6943, 0x4860, 0x4880, 0x61A4, 0xDDD5, 0xEE98, 0xDE36,
-    0xBD53, 0x9C4F, 0x7B2B, 0x6207, 0x82AA, 0xB3CF, 0xE4F3, 0xECF3,
-    0xE450, 0xE450, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC51,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xF471, 0xEC71,
-    0xEC91, 0xEC91, 0xF470, 0xE450, 0x9B4D, 0x8C30, 0x6CB3, 0x54D4,
-    0x54F5, 0x54F5, 0x5515, 0x54F5, 0x54F5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CD5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF4, 0x5CF4,
-    0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5CF5,
-    0x5CF5, 0x5CF4, 0x5CF4, 0x5D14, 0x5D14, 0x5D15, 0x5D15, 0x5D35,
-    0x4C93, 0x4C73, 0x6576, 0x6555, 0x4CB3, 0x1BAF, 0x3492, 0x34B3,
-    0x2CB3, 0x2CB4, 0x2CB4, 0x2CB4, 0x3494, 0x3494, 0x3494, 0x34B4,
-    0x34B4, 0x34B4, 0x34B4, 0x34B4, 0x7D55, 0x7D55, 0x7D55, 0x7D55,
-    0x7D56, 0x7D55, 0x7555, 0x6D35, 0x6D35, 0x6D35, 0x7535, 0x7555,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7576, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6D35, 0x6D35, 0x6D36,
-    0x6D36, 0x6535, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x5D15,
-    0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6, 0x5CF6,
-    0x5CF5, 0x5CF5, 0x5515, 0x5D15, 0x6CD4, 0x7C73, 0x8B8F, 0xB3F0,
-    0xEC92, 0xEC30, 0xEC30, 0xE44F, 0xE450, 0xF4D2, 0xEC91, 0xE450,
-    0xE450, 0xECB1, 0xC3AD, 0x7143, 0x5040, 0x50A1, 0x5903, 0x5964,
-    0x6227, 0xFF5B, 0xFFBC, 0xFFDD, 0xFFDD, 0xF77C, 0xEF1B, 0xC595,
-    0xA410, 0x7A49, 0xA32C, 0xE4F3, 0xE471, 0xE471, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xF450, 0xF450, 0xEC70, 0xEC71, 0xEC71, 0xEC91, 0xF470, 0xDC50,
-    0x9B4D, 0x8C10, 0x6CB3, 0x5CD4, 0x54F5, 0x54F5, 0x4CF5, 0x54F5,
-    0x54F5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF4, 0x5CF4, 0x5CF4, 0x5CF5, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5CF4, 0x5CF5, 0x5CF5, 0x5CF4,
-    0x5CF4, 0x5CF4, 0x5CF4, 0x6535, 0x6535, 0x6536, 0x6556, 0x5D55,
-    0x4CD3, 0x23CF, 0x3493, 0x2C73, 0x3493, 0x2CB4, 0x2C94, 0x3494,
-    0x3494, 0x3494, 0x3494, 0x34B4, 0x3494, 0x34B4, 0x34B4, 0x34B4,
-    0x8576, 0x7D55, 0x7D56, 0x7D56, 0x7D56, 0x7D56, 0x7535, 0x7535,
-    0x7535, 0x7535, 0x7535, 0x7535, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7576, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6515, 0x6515, 0x6D15, 0x6D36, 0x6D36, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6535,
-    0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6516, 0x5D16, 0x5D15, 0x5CF5, 0x5CF6, 0x5CF6, 0x5CF5,
-    0x5D16, 0x5CF5, 0x64F6, 0x64F6, 0x64F6, 0x5CF6, 0x5515, 0x5CF4,
-    0x6CB3, 0x8431, 0x9B4E, 0xDC52, 0xEC72, 0xEC71, 0xE44F, 0xE470,
-    0xEC70, 0xEC91, 0xE490, 0xE4B1, 0xECF2, 0xB30B, 0x60A1, 0x58A1,
-    0x60E2, 0x6964, 0x6184, 0x5144, 0x6AA9, 0xFF9C, 0xFFDD, 0xFFFE,
-    0xF7DE, 0xF7BE, 0xFFFF, 0xFFBE, 0xFF5C, 0x93AE, 0x48E2, 0xA32C,
-    0xED13, 0xECD2, 0xE471, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xF450, 0xF450, 0xEC30, 0xF471,
-    0xEC70, 0xEC91, 0xEC91, 0xDC50, 0x9B2D, 0x8BF0, 0x7493, 0x5CD4,
-    0x54F5, 0x54F5, 0x54F5, 0x54F5, 0x54F5, 0x5CD5, 0x54F5, 0x54F5,
-    0x54F5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF6, 0x5CF6,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x54F4, 0x54F4, 0x54F4,
-    0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5CF5,
-    0x5CF5, 0x5CF4, 0x5CF4, 0x5CF5, 0x5D15, 0x5D15, 0x6535, 0x6535,
-    0x6535, 0x5D15, 0x6555, 0x5D35, 0x5515, 0x238F, 0x3C73, 0x3C93,
-    0x3473, 0x3494, 0x3494, 0x3494, 0x3494, 0x3494, 0x3494, 0x3494,
-    0x3494, 0x3494, 0x3494, 0x3494, 0x8576, 0x7D55, 0x7D56, 0x7D56,
-    0x7D56, 0x7D56, 0x7535, 0x7535, 0x7535, 0x7535, 0x7535, 0x7535,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D35, 0x6515, 0x6D15, 0x6D36,
-    0x6D36, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6516, 0x6516, 0x5D16, 0x5D15,
-    0x5CF5, 0x5CF6, 0x64F6, 0x64F6, 0x5D16, 0x5CF5, 0x64F6, 0x5CD6,
-    0x64F6, 0x5CF5, 0x5515, 0x5CF4, 0x74B3, 0x83F0, 0xB3B0, 0xE452,
-    0xEC72, 0xEC71, 0xDC50, 0xDC50, 0xE470, 0xEC70, 0xECD2, 0xE4D1,
-    0xB34B, 0x6923, 0x60C2, 0x6943, 0x6944, 0x6964, 0x5943, 0x4923,
-    0x8B8C, 0xFF9C, 0xFFFE, 0xF7DE, 0xF7BE, 0xFFFF, 0xF7DF, 0xFFFF,
-    0xFFBE, 0x9C30, 0x40E2, 0x48C2, 0xB36C, 0xECD2, 0xEC91, 0xEC71,
-    0xE450, 0xEC71, 0xEC91, 0xEC91, 0xE470, 0xEC70, 0xF471, 0xF450,
-    0xF450, 0xF470, 0xEC50, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xDC71,
-    0xA34D, 0x93F0, 0x7473, 0x64D4, 0x5CF5, 0x54F5, 0x54F5, 0x54F5,
-    0x5CF5, 0x54D5, 0x54D5, 0x54D5, 0x54F5, 0x54D5, 0x54F5, 0x5CF5,
-    0x5CF6, 0x5CF6, 0x5CF6, 0x5CD6, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5CF4, 0x54F4, 0x54F4, 0x5CF5, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5D15, 0x5D15, 0x6535, 0x6536, 0x5D15, 0x5D15, 0x5D15,
-    0x5D35, 0x2BAF, 0x3C73, 0x3C73, 0x3C74, 0x3494, 0x3494, 0x3474,
-    0x3494, 0x3494, 0x34B4, 0x34B4, 0x3494, 0x3494, 0x3494, 0x3494,
-    0x8576, 0x7D55, 0x7D76, 0x7D76, 0x7D55, 0x7555, 0x7535, 0x7535,
-    0x7535, 0x7535, 0x7535, 0x7535, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D36,
-    0x6D35, 0x6515, 0x6D15, 0x6D15, 0x6D35, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6515, 0x6515, 0x5D35, 0x5D15, 0x5D16, 0x5CF6, 0x64F6, 0x64F6,
-    0x5D16, 0x5D16, 0x64F6, 0x5CF6, 0x64F6, 0x5CF5, 0x5D15, 0x6CF4,
-    0x7C92, 0x8BAF, 0xCC31, 0xE452, 0xE451, 0xE471, 0xE470, 0xE490,
-    0xE450, 0xF4D2, 0xE4D1, 0xAB0A, 0x60E2, 0x60E2, 0x7164, 0x6103,
-    0x6943, 0x6123, 0x6143, 0x5963, 0x9C0E, 0xFF9C, 0xFFFE, 0xF7FE,
-    0xF7FE, 0xF7FE, 0xF7FF, 0xFFFE, 0xFF9D, 0x8BAD, 0x4944, 0x5923,
-    0x6123, 0xC3CE, 0xECD2, 0xE450, 0xE470, 0xE450, 0xEC91, 0xEC71,
-    0xEC91, 0xEC70, 0xF471, 0xF450, 0xF450, 0xF471, 0xEC70, 0xEC70,
-    0xEC70, 0xEC91, 0xEC91, 0xDC71, 0xA34D, 0x8BD0, 0x7473, 0x64D4,
-    0x54F5, 0x54F5, 0x54F5, 0x54F5, 0x54F5, 0x5CF5, 0x54D5, 0x54D5,
-    0x54D5, 0x54D5, 0x54D5, 0x5CD5, 0x5CD6, 0x5CD6, 0x5CD6, 0x5CD5,
-    0x5CD5, 0x5CD5, 0x5CD5, 0x5CD5, 0x54F5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5CF5,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5CF5, 0x5D15, 0x5D15, 0x6535,
-    0x6535, 0x6515, 0x5D35, 0x5D14, 0x5D35, 0x2BAF, 0x3432, 0x3C73,
-    0x3C93, 0x3494, 0x3494, 0x3474, 0x3474, 0x3494, 0x3494, 0x3494,
-    0x3494, 0x3494, 0x3494, 0x3494, 0x8576, 0x7D55, 0x8576, 0x7D76,
-    0x7D55, 0x7555, 0x7535, 0x7535, 0x7555, 0x7535, 0x7535, 0x7555,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x6D56, 0x6D35,
-    0x6D56, 0x6D56, 0x6D36, 0x6D36, 0x6515, 0x6515, 0x6D15, 0x6D15,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6515, 0x6515, 0x6515, 0x6515, 0x5D35, 0x5D15,
-    0x5CF5, 0x5CF6, 0x5CF6, 0x5D16, 0x5CF5, 0x5D16, 0x64F6, 0x64F6,
-    0x6516, 0x5CF5, 0x64F4, 0x74F3, 0x8431, 0x938F, 0xD472, 0xEC72,
-    0xEC71, 0xE471, 0xE491, 0xE4B1, 0xECB2, 0xECF2, 0xA2CA, 0x58A1,
-    0x6102, 0x6943, 0x6964, 0x6943, 0x6923, 0x6964, 0x6164, 0x5143,
-    0x9BCD, 0xFFBC, 0xFFBC, 0xF7BD, 0xF7FE, 0xEFBD, 0xF7FE, 0xFFDE,
-    0xFF7C, 0x72EA, 0x5124, 0x6185, 0x6103, 0x7144, 0xCBAD, 0xF513,
-    0xE470, 0xE471, 0xEC71, 0xEC91, 0xEC91, 0xEC50, 0xEC70, 0xF471,
-    0xF471, 0xEC71, 0xEC70, 0xE470, 0xEC70, 0xEC91, 0xEC71, 0xDC50,
-    0xA34D, 0x8BD0, 0x7493, 0x5CB4, 0x5CF5, 0x54F5, 0x54F5, 0x54F5,
-    0x54F5, 0x54F5, 0x54F5, 0x54D5, 0x4C94, 0x54B4, 0x54D5, 0x54D5,
-    0x54B5, 0x54B5, 0x54B5, 0x54B5, 0x54D5, 0x54B5, 0x54D5, 0x54D5,
-    0x54D5, 0x54F5, 0x54F4, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5CF5, 0x5D15, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x5D15, 0x5D15, 0x6535, 0x5D15, 0x6535, 0x6535, 0x5D14,
-    0x5D35, 0x2BCF, 0x3411, 0x3C93, 0x3C73, 0x3C94, 0x3494, 0x3474,
-    0x3494, 0x34B4, 0x34B4, 0x3494, 0x3494, 0x3494, 0x3494, 0x3494,
-    0x8576, 0x7D55, 0x8576, 0x7D76, 0x7D55, 0x7555, 0x7535, 0x7535,
-    0x7555, 0x7555, 0x7535, 0x7555, 0x7556, 0x7556, 0x7536, 0x7556,
-    0x7556, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6D36,
-    0x6515, 0x6515, 0x6D16, 0x6D16, 0x6516, 0x6516, 0x6516, 0x6516,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x5D15, 0x5D15, 0x5CF5, 0x5CF5, 0x5CF6, 0x5D16,
-    0x5CF5, 0x5D15, 0x5CF5, 0x5CF5, 0x5D15, 0x5CD4, 0x6CF4, 0x7CB2,
-    0x8BEF, 0xB3F0, 0xDC72, 0xEC72, 0xE450, 0xE470, 0xECD2, 0xF513,
-    0xDC50, 0x9248, 0x58A1, 0x58C1, 0x6123, 0x6143, 0x6122, 0x6143,
-    0x6123, 0x6943, 0x6164, 0x5963, 0x7AC9, 0xF719, 0xFFFD, 0xFFFE,
-    0xFFFE, 0xF7FE, 0xF7DD, 0xFFDE, 0xEEDA, 0x6A28, 0x5124, 0x6124,
-    0x68E2, 0x6040, 0x7924, 0xCBAD, 0xF4D2, 0xEC91, 0xECB1, 0xEC91,
-    0xEC70, 0xEC50, 0xF471, 0xF491, 0xF471, 0xEC70, 0xEC91, 0xEC91,
-    0xEC91, 0xEC70, 0xEC50, 0xDC50, 0xA36E, 0x8BAF, 0x7473, 0x5CB4,
-    0x5CF5, 0x5515, 0x5515, 0x5D15, 0x5D15, 0x5CF5, 0x54F5, 0x54F5,
-    0x54F5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CD5, 0x5CF5,
-    0x5CD5, 0x5CD5, 0x5CD5, 0x5CF5, 0x5CF5, 0x5D15, 0x5D15, 0x5D15,
-    0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5, 0x5CF5,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x5D15,
-    0x5D15, 0x6535, 0x6535, 0x5CF4, 0x6535, 0x3410, 0x3410, 0x44B3,
-    0x3C73, 0x3C93, 0x3494, 0x3473, 0x3494, 0x3494, 0x3493, 0x3493,
-    0x3C93, 0x3494, 0x3C94, 0x3494, 0x8576, 0x7D75, 0x7D76, 0x7D76,
-    0x7D55, 0x7555, 0x7555, 0x7535, 0x7555, 0x7555, 0x7535, 0x7556,
-    0x7556, 0x7556, 0x7536, 0x7556, 0x7556, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6D36, 0x6D36, 0x6515, 0x6D35, 0x6D36, 0x6D16,
-    0x6516, 0x6516, 0x6516, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x5D15, 0x5D15,
-    0x5CF5, 0x5CF5, 0x5D16, 0x5D16, 0x5D16, 0x5D15, 0x5D16, 0x5CF5,
-    0x5CF5, 0x64D3, 0x74D3, 0x8451, 0x938E, 0xCC51, 0xE492, 0xEC71,
-    0xE471, 0xE491, 0xD40F, 0xBB2C, 0x7944, 0x5040, 0x60E2, 0x6123,
-    0x6943, 0x6143, 0x5902, 0x6123, 0x6964, 0x6143, 0x6143, 0x5963,
-    0x4943, 0x8B8C, 0xB512, 0xC5B4, 0xCDF6, 0xBD95, 0xB533, 0xB4D2,
-    0x936D, 0x5103, 0x60E3, 0x7104, 0x7904, 0x8945, 0x7903, 0x8965,
-    0xCBAE, 0xF4B2, 0xF4D2, 0xEC91, 0xF491, 0xEC71, 0xEC50, 0xEC71,
-    0xF471, 0xEC71, 0xEC91, 0xEC91, 0xEC70, 0xEC50, 0xEC50, 0xEC91,
-    0xAB8E, 0x8B8F, 0x7472, 0x64F4, 0x6535, 0x5D56, 0x6576, 0x6576,
-    0x6556, 0x6556, 0x5D55, 0x5D55, 0x6556, 0x6556, 0x6536, 0x6556,
-    0x6556, 0x6556, 0x6556, 0x6535, 0x6536, 0x6536, 0x6536, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6556, 0x6535, 0x5D35, 0x5D35,
-    0x5D15, 0x5D15, 0x5D15, 0x5D15, 0x6535, 0x5D15, 0x5D15, 0x5D35,
-    0x6535, 0x6535, 0x5D35, 0x5D15, 0x6515, 0x6535, 0x6535, 0x5D14,
-    0x5D14, 0x3C51, 0x2BD0, 0x4CD4, 0x3C52, 0x3473, 0x3473, 0x3473,
-    0x3493, 0x3C93, 0x3C93, 0x3C93, 0x3C93, 0x3C93, 0x3C93, 0x3C93,
-    0x8596, 0x7D75, 0x7D76, 0x7D76, 0x7D55, 0x7D55, 0x7555, 0x7555,
-    0x7555, 0x7555, 0x7535, 0x7556, 0x7556, 0x7556, 0x7536, 0x7556,
-    0x7556, 0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6D36, 0x6536,
-    0x6515, 0x6D36, 0x6D36, 0x6D16, 0x6516, 0x6516, 0x6516, 0x6516,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x5D15, 0x5D15, 0x5CF5, 0x64F6, 0x5D16, 0x5D16,
-    0x5D16, 0x5D16, 0x5D15, 0x5D15, 0x6514, 0x6CD3, 0x84B3, 0x8BEF,
-    0xA38D, 0xDC71, 0xE451, 0xE450, 0xE470, 0xDC2F, 0xA269, 0x60A2,
-    0x5020, 0x58A2, 0x6944, 0x6964, 0x6143, 0x6122, 0x6143, 0x6964,
-    0x6943, 0x6964, 0x6143, 0x6163, 0x5943, 0x40E1, 0x38C1, 0x4923,
-    0x5184, 0x40E3, 0x48E3, 0x4061, 0x5041, 0x6062, 0x78E4, 0x9145,
-    0xAA08, 0xBA8A, 0xBAAA, 0xAA28, 0x8985, 0xA269, 0xDBEF, 0xE450,
-    0xEC71, 0xEC71, 0xEC50, 0xEC50, 0xEC70, 0xEC71, 0xEC91, 0xEC70,
-    0xEC50, 0xEC70, 0xF470, 0xE471, 0xA32C, 0x72EC, 0x5BAF, 0x4BF0,
-    0x4431, 0x4472, 0x4492, 0x4CB2, 0x54D3, 0x54F4, 0x5D14, 0x5D35,
-    0x6535, 0x6555, 0x6535, 0x6555, 0x6D76, 0x6D96, 0x6D96, 0x6D96,
-    0x6D96, 0x6D96, 0x6D96, 0x6D96, 0x6D96, 0x6D96, 0x6D96, 0x6D76,
-    0x6D76, 0x6576, 0x6556, 0x6556, 0x6555, 0x6555, 0x6555, 0x6556,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6515, 0x5D14,
-    0x6514, 0x6534, 0x6D55, 0x5D14, 0x5CF3, 0x4C91, 0x2BCF, 0x4CD3,
-    0x3C51, 0x3C72, 0x3473, 0x3473, 0x3C93, 0x3C93, 0x3C93, 0x3C72,
-    0x3C93, 0x3C92, 0x3472, 0x3472, 0x8596, 0x8576, 0x7D76, 0x7D76,
-    0x7D56, 0x7D55, 0x7555, 0x7555, 0x7555, 0x7535, 0x7535, 0x7556,
-    0x7D56, 0x7556, 0x7556, 0x7556, 0x7556, 0x7536, 0x6D36, 0x6D56,
-    0x6D56, 0x6D36, 0x6D36, 0x6536, 0x6D35, 0x6D36, 0x6D36, 0x6D36,
-    0x6516, 0x6516, 0x6516, 0x6516, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6515, 0x6515, 0x6515, 0x6515, 0x5D15, 0x5D15,
-    0x5CF5, 0x64F6, 0x5D16, 0x5D16, 0x5CF5, 0x5CF5, 0x5D15, 0x6515,
-    0x6514, 0x6CD3, 0x8472, 0x8B6D, 0xBBAE, 0xE451, 0xE450, 0xEC90,
-    0xE470, 0xE470, 0xD3EF, 0xCBAE, 0x9A89, 0x60E3, 0x50A1, 0x58C2,
-    0x6103, 0x6923, 0x6123, 0x6943, 0x6923, 0x6103, 0x6923, 0x6143,
-    0x6164, 0x6143, 0x5902, 0x50E2, 0x58E3, 0x50A2, 0x6904, 0x7124,
-    0x8945, 0x8904, 0xA187, 0xC26B, 0xCAAB, 0xC2AA, 0xBA8A, 0xAA48,
-    0x99C6, 0x70A2, 0x8124, 0xA228, 0xD3CE, 0xE430, 0xEC50, 0xEC70,
-    0xEC70, 0xEC50, 0xEC70, 0xEC50, 0xEC50, 0xF450, 0xF450, 0xE471,
-    0xAB6D, 0x834D, 0x63EF, 0x4BF0, 0x4410, 0x3C10, 0x340F, 0x33EF,
-    0x33CF, 0x33CF, 0x33EF, 0x33EF, 0x3C30, 0x4450, 0x4C71, 0x4C71,
-    0x4C92, 0x54B2, 0x54D3, 0x5CF3, 0x5CF3, 0x5D13, 0x5D34, 0x5D34,
-    0x5D34, 0x5D34, 0x5D34, 0x5D34, 0x5D34, 0x5D14, 0x5D14, 0x5D14,
-    0x5D14, 0x5D14, 0x5D34, 0x6535, 0x6535, 0x6535, 0x6535, 0x6555,
-    0x6535, 0x6534, 0x5D14, 0x5D14, 0x6514, 0x6514, 0x6534, 0x5D13,
-    0x5CF3, 0x54D3, 0x33CF, 0x4CD3, 0x3C72, 0x3C92, 0x3C72, 0x3C72,
-    0x3452, 0x3431, 0x2BF0, 0x23CF, 0x23CF, 0x23AF, 0x1B6E, 0x1B6E,
-    0x8576, 0x8576, 0x7D76, 0x7D76, 0x7D56, 0x7D76, 0x7555, 0x7555,
-    0x7555, 0x7555, 0x7535, 0x7556, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7536, 0x6D35, 0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6536,
-    0x6535, 0x6536, 0x6D36, 0x6D36, 0x6D16, 0x6516, 0x6516, 0x6516,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6516, 0x6515, 0x6515, 0x5D15, 0x64F6, 0x64F6, 0x5CF6, 0x5CF5,
-    0x5D16, 0x5CF5, 0x5CF5, 0x5CF5, 0x64F4, 0x7CD3, 0x8C31, 0x934D,
-    0xD430, 0xEC50, 0xEC70, 0xE470, 0xE450, 0xE490, 0xF4D2, 0xF4F3,
-    0xECF3, 0xC3CE, 0x9269, 0x7185, 0x60E2, 0x5881, 0x58A1, 0x58C2,
-    0x6903, 0x68E3, 0x6903, 0x6903, 0x60E2, 0x6103, 0x6944, 0x7144,
-    0x7965, 0x91E7, 0xAA69, 0xB26A, 0xBA4A, 0xA9C8, 0xC229, 0xC229,
-    0xA986, 0xA166, 0x9145, 0xA208, 0xBB0B, 0xCB6D, 0xCBAD, 0xCB6D,
-    0xE42F, 0xEC91, 0xF491, 0xEC50, 0xEC50, 0xEC71, 0xEC70, 0xEC50,
-    0xEC50, 0xF470, 0xF470, 0xEC91, 0xB38D, 0x93AE, 0x84B2, 0x6CF4,
-    0x6514, 0x5D34, 0x5D34, 0x5533, 0x5D13, 0x54F3, 0x4CD2, 0x4CB2,
-    0x4CB2, 0x4CB2, 0x54D2, 0x4CB1, 0x4450, 0x4430, 0x4430, 0x3C0F,
-    0x3C0F, 0x3C0F, 0x340F, 0x33EF, 0x33EF, 0x33EF, 0x33EF, 0x3C0F,
-    0x3C0F, 0x3C0F, 0x33EF, 0x33EF, 0x33EF, 0x33EF, 0x3C30, 0x3C30,
-    0x4451, 0x4471, 0x4CB2, 0x54F3, 0x5CF3, 0x5D14, 0x6534, 0x6534,
-    0x5D14, 0x6534, 0x6D55, 0x6554, 0x6575, 0x6534, 0x33EF, 0x4CD2,
-    0x3430, 0x3431, 0x33F0, 0x2BCF, 0x23AF, 0x1B6E, 0x236E, 0x236E,
-    0x238E, 0x2BAE, 0x2BCF, 0x2BCF, 0x8576, 0x8576, 0x8576, 0x7D76,
-    0x7D56, 0x7D55, 0x7555, 0x7555, 0x7555, 0x7555, 0x7535, 0x7555,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7536, 0x6D36, 0x6D35,
-    0x6D36, 0x6D56, 0x6D36, 0x6536, 0x6535, 0x6536, 0x6D36, 0x6D36,
-    0x6D16, 0x6516, 0x6516, 0x6516, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6515, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x5D15, 0x5D15,
-    0x64F6, 0x64F6, 0x5D16, 0x5D16, 0x5CF5, 0x6515, 0x5CD5, 0x5CB3,
-    0x64B3, 0x7CB3, 0x8BCF, 0xABAE, 0xE471, 0xEC50, 0xEC70, 0xEC90,
-    0xEC90, 0xE470, 0xE471, 0xEC92, 0xE492, 0xECF3, 0xECF3, 0xD470,
-    0xBB8D, 0x9A89, 0x81A5, 0x6903, 0x68C2, 0x6082, 0x5881, 0x5861,
-    0x5040, 0x5860, 0x60A2, 0x68A2, 0x7924, 0x91A6, 0xA9E8, 0xA1A7,
-    0x9925, 0x90E4, 0x9925, 0x9945, 0xA1A6, 0xBA8A, 0xD34D, 0xE430,
-    0xF4B2, 0xF4D2, 0xFCF3, 0xF4D2, 0xF4B1, 0xFCB2, 0xF491, 0xEC50,
-    0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xF470, 0xF450, 0xEC70,
-    0xB38D, 0x93AE, 0x7C71, 0x64B2, 0x5CF3, 0x5513, 0x5D13, 0x5D33,
-    0x5D34, 0x5D34, 0x5D34, 0x5D33, 0x4450, 0x4470, 0x54D2, 0x5D33,
-    0x5D34, 0x5D33, 0x5D33, 0x5512, 0x54F2, 0x54F2, 0x54F2, 0x4CD2,
-    0x4CB2, 0x4CB2, 0x4C91, 0x4C91, 0x4C91, 0x4C91, 0x4491, 0x4491,
-    0x4471, 0x4471, 0x4491, 0x4491, 0x4471, 0x4471, 0x4491, 0x4CB2,
-    0x4CB2, 0x4CB2, 0x54B2, 0x4CB2, 0x54B2, 0x54D2, 0x54B2, 0x4C91,
-    0x4C71, 0x4C91, 0x3C0F, 0x4471, 0x3C30, 0x3C51, 0x3C51, 0x3C51,
-    0x4472, 0x4CB2, 0x4CD3, 0x5513, 0x5D34, 0x5D34, 0x6554, 0x6554,
-    0x8576, 0x8576, 0x8576, 0x7D76, 0x7D56, 0x7D55, 0x7555, 0x7535,
-    0x7555, 0x7555, 0x7555, 0x7555, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7536, 0x7555, 0x6D36, 0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6535,
-    0x6536, 0x6D36, 0x6D36, 0x6D36, 0x6535, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x6515, 0x6536, 0x6536, 0x6536, 0x6536, 0x6515, 0x6515,
-    0x6516, 0x6516, 0x6515, 0x64F5, 0x64F5, 0x64F6, 0x5CF6, 0x5CF6,
-    0x5CF5, 0x6516, 0x64F5, 0x64D4, 0x74B3, 0x7C31, 0x8B6E, 0xC410,
-    0xEC71, 0xEC50, 0xEC70, 0xECB0, 0xECB1, 0xE470, 0xE451, 0xE471,
-    0xE471, 0xE491, 0xDC91, 0xE491, 0xECD2, 0xF4F2, 0xECD2, 0xDC71,
-    0xD3EF, 0xBB4D, 0xAACA, 0xA289, 0x9A48, 0x9228, 0x9207, 0x91E7,
-    0x91C7, 0x9A07, 0xAA08, 0xA1E7, 0xAA08, 0xC2CA, 0xCB2C, 0xE3EF,
-    0xF471, 0xFCD2, 0xF4B2, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC71,
-    0xEC91, 0xF471, 0xEC51, 0xEC50, 0xEC50, 0xEC50, 0xEC71, 0xEC71,
-    0xEC50, 0xEC50, 0xF470, 0xEC91, 0xB38D, 0x93AE, 0x7C71, 0x64B2,
-    0x54D2, 0x54F3, 0x54F3, 0x5512, 0x5513, 0x54F3, 0x54F2, 0x4CD2,
-    0x238D, 0x1B0B, 0x234C, 0x3C50, 0x54F3, 0x5513, 0x5D34, 0x5513,
-    0x5D34, 0x5D34, 0x5D34, 0x5D34, 0x5D34, 0x5D34, 0x5D34, 0x5D34,
-    0x5D34, 0x5D34, 0x5D34, 0x5D54, 0x5D54, 0x5D54, 0x5D54, 0x5D54,
-    0x5D34, 0x5D34, 0x5D54, 0x5D34, 0x5D13, 0x5513, 0x54F3, 0x54D2,
-    0x54F3, 0x54F3, 0x54D2, 0x54D2, 0x54B1, 0x54D2, 0x54F3, 0x5513,
-    0x5513, 0x4CD3, 0x5D34, 0x5D55, 0x5D54, 0x6575, 0x6554, 0x5D34,
-    0x6534, 0x6534, 0x6534, 0x6534, 0x8576, 0x8576, 0x8576, 0x7D76,
-    0x7D76, 0x7D76, 0x7555, 0x7555, 0x7555, 0x7555, 0x7555, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7556, 0x7555, 0x7536, 0x6D56,
-    0x6D56, 0x6D56, 0x6536, 0x6535, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6535, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6535, 0x6535, 0x6515, 0x6515, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6515, 0x6515, 0x6516, 0x6516, 0x6515, 0x64F5,
-    0x64F5, 0x64F5, 0x5CF6, 0x5CF6, 0x64F5, 0x64D5, 0x64F5, 0x74F4,
-    0x7CD4, 0x8411, 0x9B8F, 0xD451, 0xE450, 0xEC30, 0xEC70, 0xEC90,
-    0xEC90, 0xEC90, 0xEC71, 0xEC71, 0xE471, 0xE451, 0xE470, 0xE470,
-    0xE471, 0xE471, 0xEC91, 0xEC91, 0xF4D3, 0xECB2, 0xECD2, 0xF4F3,
-    0xF4D3, 0xF4D2, 0xF4D2, 0xF4B2, 0xEC91, 0xEC91, 0xF471, 0xFC92,
-    0xFCB2, 0xFCF3, 0xF4B1, 0xFD13, 0xEC91, 0xEC91, 0xE470, 0xE450,
-    0xE450, 0xE450, 0xE471, 0xEC71, 0xEC71, 0xEC50, 0xEC51, 0xF471,
-    0xEC51, 0xEC71, 0xEC71, 0xEC70, 0xEC91, 0xEC70, 0xF470, 0xEC91,
-    0xAB6D, 0x8BAE, 0x7C91, 0x64D2, 0x5CF3, 0x5D13, 0x5D33, 0x5D33,
-    0x5D13, 0x5513, 0x54F3, 0x54F3, 0x3C50, 0x1B4C, 0x1B2C, 0x3C30,
-    0x4CD2, 0x4CD2, 0x54F3, 0x5513, 0x54F3, 0x4CF3, 0x54F3, 0x4CF3,
-    0x54F3, 0x4CF3, 0x54F3, 0x54F3, 0x4CF3, 0x4CF2, 0x4CF2, 0x4CF2,
-    0x4CF3, 0x4CF2, 0x4CF2, 0x4CF2, 0x4CF3, 0x4D13, 0x5513, 0x5534,
-    0x5D54, 0x5D54, 0x5D54, 0x5D54, 0x6554, 0x5D34, 0x5D34, 0x6574,
-    0x5D33, 0x5D33, 0x6574, 0x5D74, 0x5D34, 0x2BAE, 0x1B4D, 0x2B8D,
-    0x33CE, 0x4CB2, 0x6554, 0x5D13, 0x6513, 0x6513, 0x64F3, 0x5CF3,
-    0x8576, 0x8576, 0x8576, 0x7D76, 0x7D76, 0x7D76, 0x7555, 0x7555,
-    0x7555, 0x7555, 0x7555, 0x7555, 0x7556, 0x7556, 0x7556, 0x7556,
-    0x7535, 0x7535, 0x7536, 0x6D56, 0x6D35, 0x6D35, 0x6536, 0x6536,
-    0x6535, 0x6536, 0x6D36, 0x6536, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6535,
-    0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536, 0x6516, 0x6516,
-    0x6516, 0x6516, 0x6515, 0x64F5, 0x64F5, 0x6516, 0x6516, 0x6516,
-    0x6515, 0x64F5, 0x64D4, 0x6CB3, 0x7C72, 0x83AF, 0xABF0, 0xDC72,
-    0xE410, 0xEC50, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC51,
-    0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xE471, 0xE450,
-    0xE430, 0xE450, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xF4B1, 0xF491, 0xF471, 0xF471, 0xFC92, 0xF491, 0xE450, 0xE491,
-    0xE491, 0xEC91, 0xEC71, 0xEC91, 0xEC91, 0xEC71, 0xE470, 0xEC71,
-    0xEC91, 0xEC71, 0xEC51, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xE470, 0xEC91, 0xF491, 0xECB1, 0xABAE, 0x8BAE, 0x7450, 0x5CB2,
-    0x5CF3, 0x5513, 0x5513, 0x5533, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x3C71, 0x3C30, 0x4CD2, 0x4CF3, 0x4CD2, 0x54F3, 0x5513,
-    0x5513, 0x4CF3, 0x54F3, 0x4CF3, 0x4CF3, 0x4CF3, 0x54F3, 0x5513,
-    0x4D13, 0x4D13, 0x4CF3, 0x4CF3, 0x4CF3, 0x4CF3, 0x4CF3, 0x4CF2,
-    0x4D13, 0x4D13, 0x5513, 0x5533, 0x5534, 0x5534, 0x5534, 0x5534,
-    0x5D34, 0x5D34, 0x5D33, 0x5D54, 0x5D33, 0x5D33, 0x5D33, 0x5D54,
-    0x5D54, 0x2BCE, 0x130B, 0x1B2C, 0x1B2C, 0x3C30, 0x6574, 0x6554,
-    0x6D54, 0x6D54, 0x6D54, 0x6D54, 0x8556, 0x8556, 0x8576, 0x8576,
-    0x7D76, 0x7D76, 0x7555, 0x7555, 0x7535, 0x7535, 0x7535, 0x7555,
-    0x7555, 0x7556, 0x6D56, 0x6D56, 0x7535, 0x6D35, 0x6D35, 0x6D35,
-    0x6D35, 0x6D35, 0x6536, 0x6536, 0x6535, 0x6536, 0x6D36, 0x6536,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6516, 0x6516, 0x6516, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6516, 0x6516, 0x6515, 0x6515, 0x64F4, 0x64D4, 0x74B4,
-    0x8473, 0x838F, 0xBC31, 0xDC51, 0xEC51, 0xEC70, 0xEC91, 0xEC90,
-    0xEC70, 0xEC70, 0xEC71, 0xEC51, 0xEC71, 0xEC91, 0xEC91, 0xE450,
-    0xE42F, 0xE42F, 0xEC51, 0xEC71, 0xEC91, 0xEC71, 0xEC50, 0xEC30,
-    0xEC51, 0xF451, 0xEC51, 0xEC51, 0xEC71, 0xEC91, 0xEC71, 0xF471,
-    0xF491, 0xF491, 0xEC91, 0xE491, 0xE491, 0xE450, 0xE40F, 0xE3EF,
-    0xE410, 0xE450, 0xE470, 0xEC91, 0xE471, 0xEC71, 0xEC50, 0xEC51,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE450, 0xEC91, 0xE450, 0xDC70,
-    0xABAE, 0x8BCE, 0x7491, 0x5CD2, 0x5CF3, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x54F3, 0x54F3, 0x4CF3, 0x54F3, 0x4CF3, 0x4CF3, 0x4CF3,
-    0x4CF3, 0x4CF3, 0x5514, 0x5513, 0x4CF3, 0x4CF3, 0x4CF3, 0x4CF3,
-    0x4CF3, 0x4CF3, 0x5513, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13,
-    0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D33, 0x4D34, 0x4D33,
-    0x5534, 0x5534, 0x5513, 0x5534, 0x5513, 0x5514, 0x5513, 0x5533,
-    0x5513, 0x5533, 0x5513, 0x5D53, 0x5D54, 0x5513, 0x4491, 0x3C30,
-    0x3C0F, 0x4C91, 0x6554, 0x6D74, 0x6D74, 0x7574, 0x7595, 0x7595,
-    0x8556, 0x8556, 0x8576, 0x7D56, 0x7D56, 0x7D56, 0x7535, 0x7555,
-    0x7555, 0x7535, 0x7535, 0x7555, 0x7555, 0x7555, 0x6D55, 0x6D55,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6536, 0x6516, 0x6516,
-    0x6536, 0x6516, 0x6515, 0x6515, 0x6515, 0x6515, 0x64F5, 0x64F5,
-    0x6D35, 0x64F5, 0x6CF5, 0x7CD4, 0x8411, 0x93D0, 0xDCD4, 0xDC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xF471, 0xF471,
-    0xF4B2, 0xEC91, 0xEC50, 0xE42F, 0xDC0F, 0xDBCE, 0xDBCF, 0xDC0F,
-    0xE450, 0xEC70, 0xEC71, 0xEC71, 0xEC51, 0xEC30, 0xEC30, 0xEC50,
-    0xE450, 0xE451, 0xE450, 0xEC51, 0xEC30, 0xEC51, 0xE430, 0xDC0F,
-    0xD3CE, 0xE3EF, 0xEC30, 0xEC30, 0xF430, 0xF451, 0xEC71, 0xEC91,
-    0xE491, 0xEC91, 0xEC71, 0xEC91, 0xF491, 0xEC71, 0xE450, 0xE470,
-    0xE491, 0xEC91, 0xEC91, 0xECD2, 0xAB8E, 0x8BCF, 0x84F3, 0x5CD2,
-    0x54F3, 0x5513, 0x5513, 0x5513, 0x54F3, 0x5513, 0x5513, 0x4CF3,
-    0x4CF3, 0x5513, 0x4D13, 0x4CF3, 0x4CF3, 0x4CF3, 0x4D13, 0x4CF3,
-    0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4CF3, 0x4CF3,
-    0x4D13, 0x4D13, 0x4D13, 0x4513, 0x4513, 0x4D13, 0x4D14, 0x4D13,
-    0x4D34, 0x4D34, 0x4D34, 0x4D34, 0x4D34, 0x4D34, 0x4D13, 0x4D13,
-    0x4CF3, 0x5534, 0x5533, 0x5533, 0x5513, 0x5513, 0x5513, 0x4D12,
-    0x5533, 0x5D54, 0x5D34, 0x5D34, 0x5D34, 0x5D34, 0x5D13, 0x5CF2,
-    0x6533, 0x6D54, 0x6D74, 0x6D74, 0x8556, 0x8556, 0x8556, 0x7D56,
-    0x7D56, 0x7556, 0x7555, 0x7555, 0x7555, 0x7555, 0x7555, 0x7555,
-    0x7555, 0x7555, 0x6D55, 0x7555, 0x6D35, 0x6D35, 0x6D35, 0x6D35,
-    0x6D35, 0x6D35, 0x6536, 0x6D56, 0x6536, 0x6536, 0x6536, 0x6535,
-    0x6535, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6516, 0x6516, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6516, 0x6516, 0x6515, 0x64F5, 0x5CD4, 0x64F4, 0x74F4, 0x536F,
-    0x3187, 0x624A, 0xD4F3, 0xDC92, 0xE451, 0xEC71, 0xEC91, 0xE470,
-    0xEC50, 0xEC71, 0xF471, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC50, 0xE42F, 0xDC0F, 0xDBEF, 0xD3CE, 0xD3CE, 0xDBCE, 0xDBEE,
-    0xDBCF, 0xDBCF, 0xDBCF, 0xDBEF, 0xDC0F, 0xDBEF, 0xDBCF, 0xDBEF,
-    0xDBAF, 0xDBCF, 0xDBCF, 0xDBEF, 0xE3EF, 0xEC0F, 0xF430, 0xF451,
-    0xF451, 0xF471, 0xEC70, 0xE491, 0xE491, 0xE491, 0xEC71, 0xEC71,
-    0xF491, 0xEC71, 0xE450, 0xE471, 0xE471, 0xE471, 0xECF3, 0xD4B2,
-    0x61E7, 0x4A28, 0x74D2, 0x6513, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x5513, 0x5513, 0x4CF3, 0x4CF3, 0x4D13, 0x4CF2, 0x4CF3,
-    0x5513, 0x4CF3, 0x4CF3, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13,
-    0x4CF3, 0x4CF3, 0x4D13, 0x4D13, 0x4D13, 0x4513, 0x4D14, 0x4514,
-    0x4514, 0x4513, 0x4534, 0x4534, 0x4534, 0x4D34, 0x4D34, 0x4D14,
-    0x4D34, 0x4D34, 0x4D14, 0x4D14, 0x4CF3, 0x4D13, 0x4D13, 0x5513,
-    0x5533, 0x4D13, 0x5533, 0x5513, 0x4CF3, 0x4CF3, 0x5533, 0x5D34,
-    0x5D34, 0x5D33, 0x5CF2, 0x5D12, 0x5D12, 0x6532, 0x6533, 0x6533,
-    0x8576, 0x7D56, 0x7D56, 0x7D56, 0x7D56, 0x7535, 0x7556, 0x7555,
-    0x7555, 0x6D55, 0x7555, 0x7555, 0x6D55, 0x7555, 0x7555, 0x7535,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D36, 0x6D36, 0x6535, 0x6536,
-    0x6536, 0x6536, 0x6556, 0x6536, 0x6535, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6535, 0x6535, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6515, 0x6515, 0x64F6, 0x6516, 0x6516, 0x5D15, 0x5D15,
-    0x5CF4, 0x64D4, 0x6C93, 0x21A7, 0x0001, 0x2041, 0x8B0C, 0xE534,
-    0xE4F2, 0xE491, 0xE4B1, 0xE450, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xF471, 0xEC70,
-    0xE450, 0xE430, 0xE42F, 0xE40F, 0xE40F, 0xE42F, 0xE430, 0xE42F,
-    0xE430, 0xE430, 0xE40F, 0xE430, 0xEC30, 0xEC30, 0xEC31, 0xEC30,
-    0xEC50, 0xEC50, 0xF450, 0xF471, 0xEC71, 0xEC71, 0xEC71, 0xE491,
-    0xEC91, 0xE490, 0xEC91, 0xEC91, 0xEC91, 0xEC71, 0xE470, 0xEC91,
-    0xE472, 0xECF3, 0xD4D3, 0x6A28, 0x1840, 0x0881, 0x4BAD, 0x6513,
-    0x5512, 0x4D13, 0x4D13, 0x5513, 0x5513, 0x54F3, 0x54F3, 0x5513,
-    0x5513, 0x4D13, 0x4CF3, 0x4CF3, 0x4CF3, 0x4CF3, 0x4D13, 0x4D13,
-    0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4CF3, 0x4CF3, 0x4CF3, 0x4D14,
-    0x4D13, 0x4513, 0x4513, 0x4514, 0x4534, 0x4513, 0x4534, 0x4534,
-    0x4534, 0x4534, 0x4514, 0x4D34, 0x4D34, 0x4D14, 0x4D14, 0x44F4,
-    0x44F3, 0x4D14, 0x4D14, 0x5514, 0x5514, 0x5514, 0x5513, 0x5513,
-    0x5513, 0x5534, 0x5533, 0x5533, 0x5533, 0x5D33, 0x5D33, 0x5D33,
-    0x5D33, 0x6553, 0x6553, 0x6532, 0x8576, 0x7D56, 0x7D56, 0x7D56,
-    0x7D56, 0x7555, 0x7556, 0x7556, 0x7555, 0x6D55, 0x7555, 0x7555,
-    0x6D55, 0x6D55, 0x7555, 0x7555, 0x6D35, 0x6D35, 0x6D35, 0x6D35,
-    0x6D36, 0x6D36, 0x6535, 0x6535, 0x6536, 0x6536, 0x6536, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6515, 0x6515, 0x6535, 0x6515,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x64F6,
-    0x6516, 0x6516, 0x5D35, 0x5D35, 0x6514, 0x6CF4, 0x74B3, 0x1105,
-    0x0821, 0x1000, 0x3082, 0xA3AD, 0xE554, 0xE4F2, 0xE4B2, 0xE491,
-    0xE451, 0xE451, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xF471, 0xEC91, 0xEC91, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xF471, 0xF471, 0xF471, 0xF471, 0xF450, 0xF450, 0xF450, 0xEC71,
-    0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC91, 0xE470, 0xEC70, 0xEC91,
-    0xEC91, 0xE470, 0xE471, 0xECB2, 0xECF4, 0xCC71, 0x6A28, 0x1820,
-    0x0800, 0x0040, 0x330A, 0x6512, 0x5512, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x54F3, 0x5513, 0x5513, 0x4D13, 0x4D13, 0x4D13, 0x4D13,
-    0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13,
-    0x4D13, 0x4CF3, 0x4D14, 0x4D14, 0x4D14, 0x4513, 0x4513, 0x4534,
-    0x4534, 0x4513, 0x4534, 0x4534, 0x4534, 0x4514, 0x4514, 0x4D34,
-    0x4D34, 0x4D34, 0x4D14, 0x4514, 0x4514, 0x4D14, 0x4D14, 0x4D14,
-    0x5514, 0x5514, 0x5514, 0x5514, 0x5513, 0x5534, 0x5D34, 0x5D54,
-    0x5D53, 0x5D53, 0x5D53, 0x6573, 0x6573, 0x6D74, 0x6D94, 0x6D94,
-    0x8576, 0x7D56, 0x7D56, 0x7D55, 0x7535, 0x7535, 0x7535, 0x7555,
-    0x7555, 0x6D55, 0x7555, 0x7555, 0x6D55, 0x6D55, 0x7556, 0x7556,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D36, 0x6D35, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536,
-    0x6535, 0x6535, 0x6535, 0x6536, 0x6535, 0x6515, 0x6515, 0x6D35,
-    0x6D15, 0x6D15, 0x6D15, 0x6515, 0x6515, 0x6515, 0x6535, 0x6535,
-    0x6D15, 0x74F4, 0x84D3, 0x3A08, 0x0821, 0x0800, 0x1000, 0x38C3,
-    0x9B6D, 0xDD13, 0xE513, 0xDC91, 0xE471, 0xEC71, 0xF471, 0xEC71,
-    0xF471, 0xEC71, 0xEC71, 0xEC70, 0xE470, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC91, 0xEC71, 0xEC71,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xEC51, 0xEC51,
-    0xF471, 0xEC51, 0xF451, 0xEC51, 0xEC51, 0xEC71, 0xEC71, 0xF491,
-    0xEC70, 0xEC91, 0xEC70, 0xEC70, 0xEC71, 0xDC50, 0xE491, 0xED34,
-    0xC451, 0x7208, 0x1820, 0x0800, 0x0020, 0x0081, 0x3B2B, 0x5CD2,
-    0x5513, 0x5513, 0x5513, 0x54F3, 0x54F3, 0x5513, 0x5513, 0x4D13,
-    0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x4D13, 0x4D13, 0x4D14, 0x4D14,
-    0x4D14, 0x4D14, 0x4513, 0x4534, 0x4534, 0x4534, 0x4534, 0x4534,
-    0x4534, 0x4514, 0x4514, 0x4D34, 0x4D34, 0x4D34, 0x4514, 0x4514,
-    0x44F4, 0x4514, 0x4514, 0x4D14, 0x4D14, 0x4CF4, 0x4CF4, 0x4D13,
-    0x5513, 0x5534, 0x5D54, 0x5D74, 0x6595, 0x6595, 0x6DB5, 0x6DB5,
-    0x6D74, 0x7574, 0x7595, 0x7595, 0x8576, 0x7D56, 0x7D55, 0x7D56,
-    0x7535, 0x7535, 0x7535, 0x7535, 0x6D55, 0x6D55, 0x6D55, 0x6D55,
-    0x6D35, 0x6D55, 0x7556, 0x7556, 0x6D35, 0x6D35, 0x6D35, 0x6D35,
-    0x6D36, 0x6D35, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6556, 0x6556, 0x6536, 0x6536, 0x6D36, 0x6536,
-    0x6536, 0x6515, 0x6515, 0x6D15, 0x6D15, 0x6D15, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6D15, 0x74F4, 0x74B3, 0x8472, 0x7B6E,
-    0x4165, 0x1800, 0x1000, 0x1000, 0x3082, 0x8ACB, 0xD4F3, 0xE513,
-    0xDC71, 0xE491, 0xE450, 0xEC51, 0xF492, 0xEC71, 0xEC70, 0xE470,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC51, 0xEC51, 0xEC51, 0xEC51, 0xEC71, 0xEC51, 0xEC51, 0xF451,
-    0xF451, 0xEC51, 0xF471, 0xF491, 0xEC71, 0xEC70, 0xEC71, 0xEC50,
-    0xDC50, 0xECF3, 0xE513, 0xB3EF, 0x59A6, 0x2040, 0x0800, 0x0000,
-    0x0000, 0x1965, 0x53EE, 0x5CF3, 0x5513, 0x5534, 0x5514, 0x54F3,
-    0x54F3, 0x54F3, 0x5513, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x5513,
-    0x5513, 0x4D13, 0x4D13, 0x4D13, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x4D13, 0x4D13, 0x4D14, 0x4D14, 0x4D14, 0x4D14, 0x4513, 0x4513,
-    0x4534, 0x4534, 0x4534, 0x4534, 0x4534, 0x4534, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x44F4, 0x4513, 0x44F3,
-    0x44F3, 0x4CF3, 0x4CF3, 0x4CF3, 0x4D13, 0x5534, 0x5554, 0x5D74,
-    0x6595, 0x6595, 0x6DB5, 0x75D6, 0x7595, 0x7595, 0x7595, 0x75B5,
-    0x8576, 0x7D55, 0x7D55, 0x7555, 0x7535, 0x7535, 0x7535, 0x7535,
-    0x6D55, 0x6D35, 0x6D55, 0x6D55, 0x6D35, 0x6D35, 0x7556, 0x7556,
-    0x6D36, 0x6D35, 0x6D35, 0x6D35, 0x6D36, 0x6D35, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6D56, 0x6536, 0x6D36, 0x6D36, 0x6536, 0x6516, 0x6516, 0x6516,
-    0x6516, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515, 0x6CF5,
-    0x7493, 0x8C93, 0x838E, 0xAC31, 0xAC10, 0x5186, 0x1800, 0x1000,
-    0x1000, 0x2861, 0x7248, 0xCCD2, 0xE554, 0xE4D2, 0xE471, 0xE450,
-    0xEC51, 0xEC51, 0xEC71, 0xEC71, 0xEC50, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC51, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xEC51, 0xEC51, 0xEC51,
-    0xEC71, 0xEC71, 0xEC51, 0xEC51, 0xEC51, 0xEC51, 0xEC71, 0xEC71,
-    0xEC71, 0xEC50, 0xEC71, 0xECB2, 0xECF3, 0xDCF3, 0xA36D, 0x4102,
-    0x1020, 0x0800, 0x0820, 0x0000, 0x28E3, 0x630C, 0x74B2, 0x5CB2,
-    0x54F3, 0x5534, 0x5514, 0x54F3, 0x54F3, 0x54F3, 0x5513, 0x4D13,
-    0x4D13, 0x4D13, 0x4D13, 0x5513, 0x5513, 0x4D13, 0x4D13, 0x4D13,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x4D13, 0x4D13, 0x4D13,
-    0x4D14, 0x4D14, 0x4513, 0x4513, 0x4514, 0x4514, 0x4534, 0x4534,
-    0x4534, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x4514, 0x44F3, 0x44F3, 0x44F3, 0x44F3, 0x4513,
-    0x44F3, 0x4D14, 0x5534, 0x5554, 0x5534, 0x5D34, 0x5D54, 0x6575,
-    0x6D95, 0x6D95, 0x6D95, 0x6D95, 0x7D56, 0x7D55, 0x7D56, 0x7555,
-    0x7535, 0x7535, 0x7535, 0x7535, 0x6D55, 0x6D35, 0x6D55, 0x6D55,
-    0x6D35, 0x6D35, 0x6D55, 0x6D56, 0x6D36, 0x6D35, 0x6D35, 0x6D35,
-    0x6D36, 0x6D35, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6515, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6D36, 0x6536,
-    0x6536, 0x6516, 0x6515, 0x6515, 0x6516, 0x6516, 0x6516, 0x6515,
-    0x6535, 0x6535, 0x6D15, 0x74D4, 0x8473, 0x8BF0, 0x9B6E, 0xC451,
-    0xE554, 0xBC30, 0x5185, 0x1800, 0x1000, 0x1000, 0x1800, 0x59A6,
-    0xB430, 0xDD13, 0xD491, 0xE491, 0xDC50, 0xE450, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC51, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC51, 0xEC51, 0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xEC51,
-    0xEC50, 0xEC50, 0xEC50, 0xE470, 0xEC91, 0xE491, 0xECB2, 0xE4D2,
-    0xC430, 0x7A68, 0x30A1, 0x1000, 0x0820, 0x0820, 0x1020, 0x4185,
-    0x8B6D, 0x8BCF, 0x7431, 0x6CD3, 0x54F3, 0x4D34, 0x4D33, 0x4CF3,
-    0x4CF3, 0x54F3, 0x5513, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x5513,
-    0x5513, 0x4D13, 0x4D13, 0x4D13, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x4D13, 0x4D13, 0x4D13, 0x4D14, 0x4D14, 0x4513, 0x4513,
-    0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x44F3, 0x4513, 0x4514, 0x4514, 0x4514, 0x4D14, 0x4D14, 0x4D34,
-    0x5554, 0x5D54, 0x5D34, 0x5D34, 0x5D54, 0x5534, 0x5514, 0x5534,
-    0x7D56, 0x7D55, 0x7D56, 0x7555, 0x7535, 0x7535, 0x7535, 0x6D35,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x7556, 0x7556,
-    0x6D56, 0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6D35, 0x6515, 0x6515,
-    0x6535, 0x6535, 0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6515,
-    0x6535, 0x6535, 0x6536, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6D36, 0x6536, 0x6536, 0x6516, 0x6515, 0x6536,
-    0x6536, 0x6536, 0x6516, 0x6516, 0x6515, 0x6D15, 0x7514, 0x84D3,
-    0x9451, 0x936E, 0xB38E, 0xD431, 0xE4B2, 0xED33, 0xC490, 0x61E6,
-    0x1820, 0x1000, 0x1000, 0x1800, 0x3903, 0x934C, 0xDD34, 0xE534,
-    0xE4D2, 0xDC71, 0xE450, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91,
-    0xEC91, 0xEC71, 0xEC50, 0xEC50, 0xEC50, 0xEC71, 0xEC91, 0xECB1,
-    0xECF3, 0xED54, 0xDCD2, 0x9B2C, 0x5144, 0x2020, 0x1000, 0x0820,
-    0x0800, 0x1860, 0x6247, 0xBCB1, 0xCCB3, 0x8B2D, 0x73F0, 0x6C92,
-    0x54F3, 0x4D34, 0x4D33, 0x4D13, 0x4CF3, 0x4D13, 0x54F3, 0x54F3,
-    0x5513, 0x4D13, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x4D13, 0x4D13,
-    0x4D14, 0x4D14, 0x4513, 0x4513, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4D14, 0x4D34, 0x4514, 0x4D14, 0x5555, 0x5D75, 0x5D55, 0x5534,
-    0x4D34, 0x4D14, 0x4513, 0x44F3, 0x7D76, 0x7D56, 0x7D56, 0x7555,
-    0x7535, 0x7535, 0x7535, 0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D35,
-    0x6D35, 0x7556, 0x7556, 0x7556, 0x6D56, 0x6D35, 0x6D36, 0x6D36,
-    0x6D36, 0x6D35, 0x6D35, 0x6D35, 0x6535, 0x6515, 0x6515, 0x6515,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6536, 0x6D36, 0x6D36,
-    0x6536, 0x6536, 0x6535, 0x6536, 0x6536, 0x6516, 0x6516, 0x64F5,
-    0x64F5, 0x6CF4, 0x7CD4, 0x8CB2, 0x93AF, 0xA34D, 0xDC30, 0xEC51,
-    0xDC30, 0xE491, 0xE533, 0xCCF2, 0x7AAA, 0x2861, 0x1000, 0x1000,
-    0x1800, 0x30A2, 0x6A48, 0xBC91, 0xED75, 0xDCD2, 0xDC50, 0xE450,
-    0xEC70, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xE470, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xEC51, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC91, 0xEC71, 0xEC91, 0xEC91, 0xEC70, 0xEC50, 0xEC71,
-    0xEC91, 0xF4D2, 0xF513, 0xED34, 0xCCB1, 0x9B4C, 0x5985, 0x2860,
-    0x1800, 0x1000, 0x0800, 0x1020, 0x3102, 0x7AEA, 0xCCD2, 0xED34,
-    0xCC10, 0x930D, 0x8C31, 0x6CB2, 0x5CF3, 0x4D33, 0x4D33, 0x4D33,
-    0x4D13, 0x4D13, 0x54F3, 0x54F3, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x5513, 0x4D13, 0x4D13, 0x4D14, 0x4D14, 0x4513, 0x4513,
-    0x4534, 0x4534, 0x4514, 0x3D14, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x4513, 0x3D13, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x4514, 0x4514, 0x4534, 0x4534, 0x4D34, 0x4D34,
-    0x4D55, 0x5555, 0x5555, 0x5555, 0x4D34, 0x4534, 0x4534, 0x4534,
-    0x7D56, 0x7D55, 0x7D56, 0x7555, 0x7536, 0x7535, 0x6D35, 0x6D35,
-    0x6D15, 0x6D15, 0x6D35, 0x6D35, 0x6D56, 0x7556, 0x7556, 0x7556,
-    0x6D36, 0x6D36, 0x6D35, 0x6D15, 0x6D15, 0x6D15, 0x6D36, 0x6D36,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6535, 0x6535, 0x6535, 0x6535, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6536, 0x6535, 0x6515, 0x6535, 0x6535,
-    0x6515, 0x6515, 0x64F5, 0x6D15, 0x6CF4, 0x7CF4, 0x8CF3, 0x9450,
-    0x9B6D, 0xC40F, 0xE430, 0xEC30, 0xE470, 0xDC50, 0xDC71, 0xDD13,
-    0xD513, 0x932C, 0x4103, 0x2000, 0x1800, 0x1800, 0x2020, 0x4944,
-    0x9B6C, 0xDD33, 0xED54, 0xE4D2, 0xDC70, 0xE470, 0xE471, 0xEC91,
-    0xE470, 0xE470, 0xE450, 0xEC71, 0xF471, 0xEC51, 0xF471, 0xF471,
-    0xF471, 0xEC71, 0xEC51, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xE471, 0xEC91, 0xF4D3, 0xECD2, 0xE4B2, 0xCC30, 0x9B0B,
-    0x5144, 0x2861, 0x1020, 0x0800, 0x0800, 0x1000, 0x2861, 0x59C7,
-    0xAC0F, 0xDCF2, 0xECF3, 0xE491, 0xDC30, 0xA32D, 0x83EF, 0x6C91,
-    0x5CF2, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x5513,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x4D13, 0x4D13,
-    0x4D14, 0x4D14, 0x4514, 0x4514, 0x4514, 0x4514, 0x3D14, 0x3D14,
-    0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x3D13, 0x3D14, 0x3D14,
-    0x3D14, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4534, 0x4534, 0x4534, 0x4534, 0x4D35, 0x4D35, 0x4D35, 0x4D35,
-    0x4D35, 0x4555, 0x4554, 0x3D54, 0x7D56, 0x7D55, 0x7D56, 0x7555,
-    0x7536, 0x7535, 0x6D35, 0x6D35, 0x6D15, 0x6D15, 0x6D35, 0x6D35,
-    0x6D56, 0x7556, 0x7556, 0x7556, 0x6D36, 0x6D36, 0x6D35, 0x6D35,
-    0x6D15, 0x6D35, 0x6D36, 0x6D36, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6D35, 0x6D35, 0x6536, 0x6536,
-    0x6536, 0x6536, 0x6536, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6536,
-    0x6535, 0x6515, 0x6515, 0x6535, 0x6D35, 0x64F4, 0x6515, 0x64F4,
-    0x6CD3, 0x84F3, 0x9471, 0x93AE, 0xABAD, 0xD42F, 0xEC70, 0xEC50,
-    0xEC70, 0xEC91, 0xE491, 0xDC91, 0xDCB2, 0xDCF3, 0xB3CF, 0x61A6,
-    0x2861, 0x1800, 0x1000, 0x1800, 0x2881, 0x6A28, 0xABEF, 0xDD13,
-    0xED33, 0xE4D2, 0xDC71, 0xDC71, 0xE470, 0xE491, 0xE450, 0xEC91,
-    0xEC71, 0xEC51, 0xEC71, 0xE430, 0xEC51, 0xEC71, 0xEC71, 0xEC71,
-    0xE471, 0xEC91, 0xEC91, 0xEC91, 0xECD2, 0xED13, 0xED14, 0xDCB2,
-    0xBBAE, 0x8228, 0x48E3, 0x3041, 0x1800, 0x1000, 0x0800, 0x0800,
-    0x1840, 0x4945, 0x932C, 0xCCB2, 0xE534, 0xDCB1, 0xE450, 0xF491,
-    0xE451, 0xA32C, 0x8BEF, 0x6C91, 0x5CF2, 0x4D12, 0x4D13, 0x4D13,
-    0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5513, 0x4D13, 0x4CF3, 0x4D13, 0x4D14, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x3D14, 0x3D34, 0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x3D14,
-    0x3D14, 0x3D13, 0x3D13, 0x3D14, 0x3D14, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x3D14, 0x3D14, 0x4534, 0x4534, 0x4534, 0x4534,
-    0x4514, 0x4534, 0x4D15, 0x4514, 0x4534, 0x3D34, 0x3D34, 0x3D55,
-    0x7D55, 0x7D55, 0x7D56, 0x7556, 0x7556, 0x7535, 0x6D35, 0x6D35,
-    0x6D15, 0x6D15, 0x6D35, 0x6D35, 0x6D56, 0x7556, 0x7556, 0x7556,
-    0x6D36, 0x6D36, 0x6D35, 0x6D15, 0x6D15, 0x6D15, 0x6D15, 0x6D15,
-    0x6D15, 0x6D15, 0x6D35, 0x6515, 0x6515, 0x6515, 0x6515, 0x6515,
-    0x6D35, 0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6515, 0x5CF4, 0x6534, 0x6514, 0x74F3, 0x8492, 0x8BCE, 0x9B6C,
-    0xCC0F, 0xE470, 0xF4B1, 0xEC70, 0xE42F, 0xEC70, 0xEC71, 0xEC71,
-    0xE450, 0xE4B2, 0xED34, 0xD4B2, 0x82EA, 0x38E2, 0x1820, 0x1000,
-    0x1000, 0x1000, 0x38C3, 0x6A08, 0xA38D, 0xCC92, 0xE534, 0xF595,
-    0xED54, 0xE4B2, 0xD450, 0xE4B2, 0xECF3, 0xE492, 0xE492, 0xEC92,
-    0xE492, 0xECB2, 0xECD3, 0xECD3, 0xECD2, 0xECD3, 0xED13, 0xED14,
-    0xD4B2, 0xBC10, 0x8ACB, 0x5165, 0x3081, 0x2020, 0x1800, 0x1000,
-    0x0800, 0x0800, 0x1020, 0x2881, 0x6A28, 0xBC50, 0xE514, 0xE4B2,
-    0xE491, 0xE470, 0xEC70, 0xF470, 0xEC50, 0xAB4C, 0x83EE, 0x6C90,
-    0x5CF2, 0x5512, 0x5513, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x5513, 0x5514, 0x5514, 0x5513,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x4D13, 0x4D13, 0x4D13, 0x4D13,
-    0x4D14, 0x4514, 0x4514, 0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x3D14,
-    0x3D34, 0x3D34, 0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x3D14,
-    0x3D14, 0x3D14, 0x4514, 0x4514, 0x4514, 0x3D14, 0x3D14, 0x3D14,
-    0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x4534, 0x4534, 0x4514, 0x3D14,
-    0x3D34, 0x3D34, 0x3D35, 0x3D55, 0x7D56, 0x7D55, 0x7556, 0x7556,
-    0x7556, 0x7535, 0x6D35, 0x6D35, 0x6D15, 0x6D15, 0x6D35, 0x6D35,
-    0x6D36, 0x7556, 0x7556, 0x7556, 0x6D36, 0x6D36, 0x6D35, 0x6D35,
-    0x6D15, 0x6D15, 0x6D15, 0x6D15, 0x6D15, 0x6D15, 0x6D35, 0x6D35,
-    0x6515, 0x6515, 0x6515, 0x6515, 0x6D35, 0x6D35, 0x6D36, 0x6D36,
-    0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6536, 0x6D36, 0x6535,
-    0x6535, 0x6535, 0x6535, 0x6535, 0x6514, 0x6534, 0x6514, 0x6CF3,
-    0x7CB2, 0x83EF, 0x938D, 0xC40F, 0xECD1, 0xEC90, 0xF4B1, 0xF490,
-    0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xE451, 0xE471, 0xDCB2, 0xE533,
-    0xDD54, 0xAC70, 0x6AA9, 0x20C2, 0x0800, 0x0800, 0x0800, 0x1000,
-    0x30A2, 0x5186, 0x82CA, 0xABCE, 0xA38D, 0x7A07, 0x6165, 0x8228,
-    0xB3AE, 0xDCF3, 0xE514, 0xED34, 0xED55, 0xE514, 0xE514, 0xDCF3,
-    0xCC91, 0xB3CE, 0xA32C, 0x8A8A, 0x61A7, 0x40C3, 0x2041, 0x1000,
-    0x1000, 0x0800, 0x0800, 0x1000, 0x1840, 0x2882, 0x5A07, 0x9BCE,
-    0xD4F3, 0xE4F4, 0xE492, 0xE471, 0xE450, 0xEC6F, 0xF470, 0xF44F,
-    0xF470, 0xAB4C, 0x83AD, 0x7490, 0x5CD1, 0x5512, 0x4D13, 0x4D33,
-    0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x5513, 0x5513, 0x5513,
-    0x5514, 0x5514, 0x5514, 0x5514, 0x5513, 0x5513, 0x5513, 0x4D13,
-    0x4D13, 0x4D13, 0x4CF3, 0x4513, 0x4514, 0x4514, 0x3D14, 0x3D13,
-    0x3D14, 0x3D34, 0x3D14, 0x3514, 0x3D34, 0x3514, 0x3514, 0x3514,
-    0x3514, 0x3534, 0x3534, 0x3514, 0x3D14, 0x3D14, 0x3D14, 0x4534,
-    0x3D14, 0x3D14, 0x3D14, 0x3D34, 0x3D14, 0x3D14, 0x3D14, 0x3D14,
-    0x3D34, 0x3D34, 0x4515, 0x3D35, 0x3D35, 0x3D55, 0x3D55, 0x3D55,
-    0x7D76, 0x7D56, 0x7D55, 0x7555, 0x7555, 0x7535, 0x6D35, 0x6D35,
-    0x6D35, 0x6D35, 0x6D35, 0x6D35, 0x6D56, 0x7556, 0x7577, 0x7577,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D15, 0x6D15, 0x6D15, 0x6515, 0x6D35,
-    0x6D35, 0x6D35, 0x6D36, 0x6D36, 0x6D35, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6535, 0x6535, 0x6535, 0x6535,
-    0x6514, 0x6535, 0x6D14, 0x74D3, 0x8451, 0x8BAE, 0xB3EF, 0xDC91,
-    0xEC90, 0xEC70, 0xF490, 0xEC4F, 0xEC50, 0xE450, 0xEC71, 0xF4B2,
-    0xF513, 0xED14, 0xE514, 0xD4F2, 0xC4B2, 0xB491, 0x838D, 0x3144,
-    0x0000, 0x0000, 0x0000, 0x0800, 0x1041, 0x1000, 0x1820, 0x2040,
-    0x2020, 0x1800, 0x2000, 0x2000, 0x4924, 0x82CA, 0x8AEB, 0x82AA,
-    0x82AA, 0x7269, 0x7248, 0x61C6, 0x4924, 0x3061, 0x2820, 0x2000,
-    0x1800, 0x1000, 0x1000, 0x0800, 0x0800, 0x0800, 0x1840, 0x30E3,
-    0x7269, 0xAC10, 0xD4F3, 0xDD14, 0xE4D3, 0xE491, 0xEC92, 0xE450,
-    0xEC90, 0xE44F, 0xEC6F, 0xEC70, 0xF470, 0xB34C, 0x8B8C, 0x7C90,
-    0x64D1, 0x5512, 0x4D33, 0x4D33, 0x4D33, 0x4D13, 0x4D13, 0x4D13,
-    0x5513, 0x5513, 0x5513, 0x5513, 0x5514, 0x5514, 0x5514, 0x5514,
-    0x5514, 0x4D34, 0x4D34, 0x4D34, 0x4D13, 0x44F3, 0x44F3, 0x44F3,
-    0x44F3, 0x3D13, 0x3D14, 0x3D14, 0x3D14, 0x3D34, 0x3534, 0x3534,
-    0x3514, 0x3514, 0x3514, 0x3514, 0x3534, 0x3534, 0x3534, 0x3514,
-    0x3514, 0x3D14, 0x3D34, 0x3D34, 0x3D14, 0x3D34, 0x3D14, 0x3D34,
-    0x3D14, 0x3514, 0x3D34, 0x3D34, 0x3D34, 0x3D55, 0x4555, 0x3D35,
-    0x3D55, 0x3D55, 0x3D55, 0x3555, 0x7D76, 0x7D56, 0x7D55, 0x7555,
-    0x7555, 0x7535, 0x7535, 0x7535, 0x6D55, 0x6D55, 0x6D55, 0x6D55,
-    0x6D56, 0x7556, 0x7556, 0x7556, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D15, 0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6535,
-    0x6535, 0x6535, 0x6515, 0x6515, 0x6514, 0x6D14, 0x74B3, 0x7C51,
-    0x8BCF, 0xABEF, 0xD471, 0xE491, 0xEC50, 0xEC2F, 0xEC70, 0xE44F,
-    0xECB1, 0xF4F2, 0xF513, 0xED13, 0xCC50, 0xAB6D, 0x8269, 0x61C6,
-    0x4924, 0x28A2, 0x2081, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0800, 0x0800, 0x0820, 0x0800, 0x0800, 0x1000,
-    0x1800, 0x1820, 0x2020, 0x2020, 0x1800, 0x1800, 0x1000, 0x1000,
-    0x1000, 0x1000, 0x1000, 0x0800, 0x1000, 0x1000, 0x0800, 0x1000,
-    0x1860, 0x3944, 0x7AEA, 0xBC71, 0xDD34, 0xED75, 0xE4F3, 0xDC91,
-    0xE471, 0xE471, 0xEC91, 0xF491, 0xE44F, 0xEC90, 0xEC90, 0xEC4F,
-    0xF471, 0xC38D, 0x8B6C, 0x7C4F, 0x64D1, 0x5512, 0x4D33, 0x4D33,
-    0x4D33, 0x4D13, 0x4D13, 0x4D13, 0x5513, 0x5513, 0x5513, 0x5513,
-    0x5514, 0x5514, 0x5514, 0x4D14, 0x4D14, 0x4D14, 0x4D34, 0x4D34,
-    0x4D13, 0x4513, 0x44F3, 0x44F3, 0x4513, 0x3D14, 0x3D14, 0x3D14,
-    0x3D34, 0x3534, 0x3534, 0x3534, 0x3514, 0x3534, 0x3514, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3514, 0x3534, 0x3514, 0x3D34,
-    0x3D14, 0x3D34, 0x3D14, 0x3514, 0x3514, 0x3514, 0x3D34, 0x3D34,
-    0x3D34, 0x3D55, 0x3D55, 0x3D55, 0x3D55, 0x3D55, 0x3D55, 0x3555,
-    0x7D76, 0x7D76, 0x7D55, 0x7555, 0x7535, 0x7535, 0x7535, 0x7555,
-    0x6D55, 0x6D55, 0x6D55, 0x6D55, 0x6D56, 0x7556, 0x7556, 0x7556,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6535, 0x6535, 0x6535, 0x6515, 0x6535, 0x6514,
-    0x7514, 0x74B3, 0x7C31, 0x8BAF, 0xA38E, 0xCC31, 0xE4B2, 0xEC91,
-    0xEC70, 0xEC30, 0xF491, 0xF4F2, 0xE4D2, 0xC430, 0x92CA, 0x69A6,
-    0x3881, 0x2840, 0x2000, 0x1800, 0x1000, 0x1000, 0x0800, 0x0000,
-    0x0000, 0x0840, 0x10A1, 0x18E3, 0x2144, 0x2123, 0x0860, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x1000, 0x1000,
-    0x1000, 0x1020, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800,
-    0x1000, 0x2040, 0x30A2, 0x59C6, 0x934C, 0xC4B1, 0xDD13, 0xE4D3,
-    0xE4B2, 0xE491, 0xE471, 0xE450, 0xE470, 0xEC91, 0xE470, 0xEC90,
-    0xECB1, 0xECB0, 0xE470, 0xE44F, 0xFC91, 0xCBCE, 0x8B2B, 0x842F,
-    0x64B0, 0x54F2, 0x4D13, 0x4D33, 0x4D13, 0x4D13, 0x4D13, 0x5513,
-    0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D13, 0x4D14, 0x4D14,
-    0x4D14, 0x4D14, 0x4D33, 0x4D33, 0x4514, 0x4513, 0x44F3, 0x44F3,
-    0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3514, 0x3514, 0x3534, 0x3514, 0x3514, 0x3514,
-    0x3514, 0x3534, 0x3D34, 0x3D34, 0x3D34, 0x3D55, 0x3D55, 0x3D55,
-    0x3D54, 0x3D55, 0x3D55, 0x3D75, 0x7D76, 0x7D76, 0x7D55, 0x7555,
-    0x7535, 0x7535, 0x7535, 0x7555, 0x6D55, 0x6D55, 0x6D55, 0x6D56,
-    0x6D56, 0x7556, 0x7556, 0x7556, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D15, 0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6D35,
-    0x6536, 0x6535, 0x6536, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D35, 0x6D35, 0x6534, 0x6D14, 0x7CD3, 0x8451, 0x8BAF, 0xA38E,
-    0xCC31, 0xEC92, 0xE451, 0xEC70, 0xEC50, 0xEC50, 0xECB2, 0xDC70,
-    0x8A69, 0x4903, 0x2000, 0x1800, 0x1000, 0x1000, 0x1000, 0x0800,
-    0x0800, 0x0800, 0x0841, 0x2124, 0x39C7, 0x52A9, 0x630B, 0x5AEB,
-    0x5289, 0x31A5, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000,
-    0x0000, 0x0800, 0x0800, 0x0800, 0x0800, 0x0820, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x1081, 0x6289, 0x93AE, 0xAC50, 0xC4B2,
-    0xE554, 0xE4F3, 0xDC71, 0xE471, 0xE450, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xE470, 0xEC90, 0xE48F, 0xE490, 0xE470, 0xEC90, 0xEC70,
-    0xF471, 0xD3EF, 0x9B4C, 0x7BCE, 0x6C90, 0x54D1, 0x4CF3, 0x4513,
-    0x4D13, 0x4D13, 0x4D33, 0x4D33, 0x4D13, 0x4D13, 0x4D13, 0x4D13,
-    0x4D13, 0x4D14, 0x4D14, 0x4D14, 0x4514, 0x4534, 0x4534, 0x4534,
-    0x4534, 0x4513, 0x4513, 0x4513, 0x3D14, 0x3D14, 0x3D14, 0x3514,
-    0x3514, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x2D34, 0x3534, 0x3534, 0x2D34, 0x3534, 0x3514,
-    0x3534, 0x3534, 0x3514, 0x3514, 0x3D34, 0x3534, 0x3D34, 0x3D34,
-    0x3D34, 0x3D55, 0x3D55, 0x3D34, 0x3D34, 0x3D55, 0x3D55, 0x3D75,
-    0x7D76, 0x7D76, 0x7D56, 0x7555, 0x7535, 0x7535, 0x7555, 0x7555,
-    0x6D55, 0x6D55, 0x6D56, 0x6D56, 0x7556, 0x7556, 0x7556, 0x7577,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D35, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6D35, 0x6D35, 0x6D35,
-    0x6D35, 0x6D35, 0x6D36, 0x6D36, 0x6536, 0x6535, 0x6535, 0x6536,
-    0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6D35, 0x6D35, 0x6D34, 0x7D13,
-    0x8C92, 0x8BAF, 0x9B4E, 0xD432, 0xE472, 0xEC51, 0xEC71, 0xEC71,
-    0xE470, 0xE491, 0xD471, 0x71C6, 0x2840, 0x1800, 0x0800, 0x0820,
-    0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x1041, 0x3165, 0x528A,
-    0x630C, 0x5B0B, 0x4A69, 0x3186, 0x2124, 0x1061, 0x0000, 0x0000,
-    0x0000, 0x0000, 0x0820, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000,
-    0x0020, 0x0020, 0x0800, 0x0800, 0x0000, 0x0000, 0x0020, 0x1061,
-    0x72EB, 0xCD55, 0xE5D7, 0xE555, 0xE4D3, 0xDC51, 0xE471, 0xEC71,
-    0xEC70, 0xEC70, 0xE450, 0xE450, 0xE470, 0xE490, 0xEC90, 0xE490,
-    0xE4B0, 0xE490, 0xEC90, 0xEC90, 0xEC50, 0xDC2F, 0x9B4C, 0x83EE,
-    0x6C91, 0x54B1, 0x5513, 0x4513, 0x4533, 0x4D33, 0x4D52, 0x4D52,
-    0x4D33, 0x4D13, 0x4D13, 0x4D13, 0x4D14, 0x4D14, 0x4D14, 0x4514,
-    0x4534, 0x3D34, 0x4534, 0x4534, 0x4514, 0x4513, 0x44F3, 0x3D13,
-    0x3D14, 0x3514, 0x3514, 0x3514, 0x3514, 0x3514, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x2D34, 0x2D34, 0x3514, 0x3534, 0x3534, 0x3534, 0x3514, 0x3514,
-    0x3514, 0x3514, 0x3D34, 0x3D54, 0x3D34, 0x3D54, 0x3D55, 0x3D55,
-    0x3D54, 0x3D54, 0x3D54, 0x3D54, 0x7D76, 0x7D55, 0x7D55, 0x7555,
-    0x7535, 0x7535, 0x7555, 0x7555, 0x6D55, 0x7556, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x7536, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D35, 0x6D36, 0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6D36,
-    0x6D16, 0x6D35, 0x6D35, 0x6D35, 0x6D36, 0x6D35, 0x6D16, 0x6D36,
-    0x6536, 0x6535, 0x6535, 0x6D36, 0x6D36, 0x6D15, 0x6D36, 0x6D36,
-    0x6CF4, 0x74F4, 0x7CF3, 0x8491, 0x940F, 0xA38E, 0xCC10, 0xE452,
-    0xF472, 0xF471, 0xEC50, 0xEC91, 0xE450, 0xECD2, 0xB38D, 0x3840,
-    0x1800, 0x0800, 0x0000, 0x0020, 0x0040, 0x0040, 0x0000, 0x0000,
-    0x0800, 0x1041, 0x1882, 0x20E3, 0x1082, 0x1081, 0x0820, 0x0020,
-    0x0000, 0x0820, 0x0800, 0x1861, 0x30E3, 0x1840, 0x1000, 0x0000,
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A2, 0x20C3, 0x1861,
-    0x0820, 0x0000, 0x0000, 0x0820, 0x1861, 0x4144, 0x8B0C, 0xC472,
-    0xDCB3, 0xE492, 0xE471, 0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xEC70,
-    0xEC91, 0xEC91, 0xEC90, 0xEC90, 0xE4B0, 0xE490, 0xEC90, 0xEC90,
-    0xEC50, 0xDC30, 0xABAD, 0x8B8D, 0x7C70, 0x64B1, 0x54F2, 0x4D33,
-    0x4533, 0x4532, 0x4552, 0x4D52, 0x4D33, 0x4D13, 0x4513, 0x4513,
-    0x4D14, 0x4D14, 0x4D14, 0x4514, 0x3D34, 0x3D34, 0x3D34, 0x3D34,
-    0x4514, 0x4513, 0x4513, 0x3D13, 0x3D14, 0x3514, 0x3514, 0x3514,
-    0x3514, 0x3514, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x2D34, 0x2D34, 0x3534, 0x3534,
-    0x3514, 0x3514, 0x3514, 0x3514, 0x3D14, 0x3D34, 0x3D34, 0x3D34,
-    0x3D34, 0x3D54, 0x3D54, 0x3D54, 0x3D54, 0x3D54, 0x4555, 0x4555,
-    0x7D76, 0x7D55, 0x7D56, 0x7535, 0x7536, 0x7536, 0x7556, 0x7556,
-    0x7556, 0x7556, 0x7556, 0x7556, 0x6D56, 0x6D56, 0x6D36, 0x7536,
-    0x7536, 0x7536, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D35,
-    0x6515, 0x6D55, 0x6D35, 0x6CF4, 0x74F4, 0x84D3, 0x8450, 0x8BCF,
-    0xABCF, 0xD451, 0xEC92, 0xEC31, 0xEC10, 0xF450, 0xEC70, 0xEC91,
-    0xEC71, 0xE4B1, 0xAB4C, 0x3000, 0x1800, 0x0800, 0x0020, 0x0040,
-    0x0040, 0x0040, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x1000,
-    0x1020, 0x1020, 0x20E3, 0x0020, 0x0000, 0x0000, 0x1000, 0x6AAA,
-    0xBCB1, 0x934D, 0x7AEB, 0x28C3, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0020, 0x0861, 0x3185, 0x5249, 0x39A6, 0x18A2, 0x0820, 0x0800,
-    0x0800, 0x1000, 0x2041, 0x5986, 0xA38E, 0xE513, 0xE4B2, 0xE470,
-    0xE450, 0xE450, 0xEC70, 0xEC71, 0xEC91, 0xEC91, 0xEC70, 0xEC90,
-    0xEC90, 0xE490, 0xEC90, 0xEC91, 0xEC70, 0xE450, 0xCC0F, 0x9B4C,
-    0x83EE, 0x74B1, 0x5CF2, 0x5553, 0x4D54, 0x4533, 0x4533, 0x4533,
-    0x4D33, 0x4533, 0x4513, 0x44F3, 0x44F4, 0x44F4, 0x4514, 0x4514,
-    0x3D34, 0x3D34, 0x3D34, 0x4534, 0x4514, 0x3D13, 0x3D14, 0x3D14,
-    0x3514, 0x3514, 0x3514, 0x3514, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x2D34, 0x2D34, 0x3534, 0x3534, 0x3514, 0x3514, 0x3514, 0x3D34,
-    0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x4554, 0x4554, 0x4554,
-    0x4575, 0x4575, 0x4575, 0x4575, 0x7D56, 0x7555, 0x7555, 0x7536,
-    0x7536, 0x7556, 0x7556, 0x7556, 0x7536, 0x7556, 0x7556, 0x6D56,
-    0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x7536, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D35, 0x6535, 0x6D35, 0x6D34, 0x6D14, 0x74F3,
-    0x84B2, 0x7BEF, 0x8B8E, 0xB3EF, 0xD471, 0xE471, 0xEC51, 0xEC30,
-    0xEC30, 0xEC30, 0xEC50, 0xEC70, 0xE470, 0xE471, 0xCC30, 0x5944,
-    0x1800, 0x1000, 0x1040, 0x0820, 0x0000, 0x0800, 0x0800, 0x1000,
-    0x1000, 0x1000, 0x2040, 0x30E3, 0x51C7, 0x7B0C, 0x62CA, 0x0820,
-    0x0820, 0x0800, 0x28A1, 0xBCB1, 0xDD34, 0xD4F3, 0xD554, 0x51C7,
-    0x0800, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x1041, 0x3165,
-    0x62CB, 0x62CB, 0x3164, 0x1020, 0x0800, 0x0800, 0x0800, 0x1800,
-    0x38C2, 0x82CA, 0xD4F2, 0xE4D2, 0xDC70, 0xE450, 0xEC50, 0xEC71,
-    0xF471, 0xEC71, 0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC91, 0xEC70,
-    0xEC70, 0xEC70, 0xE470, 0xBBAD, 0x8B6C, 0x8450, 0x6CD2, 0x5513,
-    0x4D34, 0x4D54, 0x4533, 0x4533, 0x4D53, 0x4533, 0x4513, 0x4513,
-    0x4514, 0x4514, 0x4514, 0x4514, 0x3D14, 0x3D34, 0x3D14, 0x4534,
-    0x3D14, 0x3D14, 0x3514, 0x3514, 0x3514, 0x3514, 0x3514, 0x3514,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x2D34, 0x3535, 0x3534, 0x3534,
-    0x3514, 0x3514, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D34,
-    0x4534, 0x4554, 0x4554, 0x4575, 0x4575, 0x4575, 0x4D75, 0x4D75,
-    0x7D56, 0x7556, 0x7556, 0x7536, 0x7556, 0x7556, 0x7556, 0x7536,
-    0x7536, 0x7536, 0x7556, 0x7536, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D15, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6D16, 0x6D35, 0x6535, 0x6514,
-    0x6D54, 0x7513, 0x7CF3, 0x84B1, 0x83EF, 0x8B6D, 0xB3CF, 0xDC91,
-    0xEC91, 0xE40F, 0xF471, 0xF450, 0xEC30, 0xEC70, 0xE44F, 0xEC50,
-    0xE430, 0xE450, 0xECF3, 0xAB4C, 0x4903, 0x2020, 0x1820, 0x1820,
-    0x2060, 0x28A1, 0x30C2, 0x4965, 0x6207, 0x7AAA, 0x9B8D, 0xB471,
-    0xD555, 0xDDD7, 0x6269, 0x0000, 0x0000, 0x0800, 0x51C5, 0xD533,
-    0xD491, 0xDCB1, 0xD513, 0x61E7, 0x0800, 0x0000, 0x2904, 0x49E7,
-    0x1040, 0x0800, 0x1000, 0x1020, 0x20C2, 0x5A89, 0x62EB, 0x39A6,
-    0x1061, 0x0000, 0x0000, 0x0000, 0x1000, 0x2881, 0x8B0B, 0xD4D2,
-    0xDC91, 0xE470, 0xEC50, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC91, 0xEC90, 0xDC4F,
-    0xA36C, 0x838D, 0x7450, 0x64D2, 0x5513, 0x4D34, 0x4D54, 0x4533,
-    0x4D34, 0x4D33, 0x4513, 0x4513, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x3D14, 0x4534, 0x4534, 0x3D14, 0x3D14, 0x3514, 0x3534,
-    0x3534, 0x3534, 0x3514, 0x3514, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x2D34,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3514, 0x3514, 0x3D34, 0x3D34,
-    0x3D34, 0x3D34, 0x4534, 0x4534, 0x4534, 0x4554, 0x4554, 0x4575,
-    0x4575, 0x4D75, 0x4D75, 0x4D75, 0x7D76, 0x7556, 0x7556, 0x7536,
-    0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D56, 0x6D56, 0x6D56, 0x6D56,
-    0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6D36, 0x6D36, 0x6D16, 0x6D16,
-    0x6D15, 0x6D35, 0x6D34, 0x6D33, 0x74F2, 0x84F2, 0x8470, 0x83CE,
-    0x9BAD, 0xBC30, 0xDC71, 0xEC71, 0xEC50, 0xF430, 0xFC71, 0xEC0F,
-    0xEC70, 0xEC4F, 0xEC70, 0xEC70, 0xF491, 0xEC71, 0xECD2, 0xE4F3,
-    0xB3EE, 0x82CA, 0x7268, 0x7AA9, 0x934C, 0xA3EE, 0xBC51, 0xCCF3,
-    0xDD54, 0xDD54, 0xD513, 0xDD34, 0xE596, 0x936E, 0x1841, 0x0800,
-    0x0800, 0x1860, 0x938C, 0xDD13, 0xD450, 0xDC70, 0xDD13, 0x7249,
-    0x1000, 0x0800, 0x49C7, 0xB4D3, 0x6A69, 0x2881, 0x1000, 0x1000,
-    0x0800, 0x1041, 0x2903, 0x3985, 0x18A2, 0x0800, 0x0020, 0x0000,
-    0x0000, 0x1000, 0x40E3, 0xC470, 0xE4B2, 0xE471, 0xE450, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC90, 0xEC6F, 0xEC90, 0xCC0E, 0x932B, 0x7BCE, 0x7491,
-    0x5CF3, 0x4D14, 0x4D54, 0x4534, 0x4514, 0x4513, 0x4513, 0x4514,
-    0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4534, 0x4534, 0x4534,
-    0x3D14, 0x3D14, 0x3514, 0x3534, 0x3534, 0x3534, 0x3514, 0x3514,
-    0x3514, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x2D34, 0x2D34,
-    0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3514, 0x3514, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x4534, 0x4534,
-    0x4534, 0x4554, 0x4554, 0x4554, 0x4D75, 0x4D75, 0x4D75, 0x4D75,
-    0x7D56, 0x7556, 0x7556, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536,
-    0x7536, 0x7536, 0x7536, 0x7536, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D56, 0x6D56, 0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D16, 0x6D16, 0x6D16,
-    0x6D16, 0x6D36, 0x6D36, 0x6D15, 0x6515, 0x6D14, 0x7514, 0x7D13,
-    0x8491, 0x8C2F, 0x93AE, 0xA3CE, 0xCC70, 0xE4B1, 0xEC71, 0xEC50,
-    0xF470, 0xEC0F, 0xDB8D, 0xE40E, 0xF4B1, 0xE470, 0xE450, 0xEC70,
-    0xEC50, 0xEC50, 0xE450, 0xECD2, 0xED33, 0xDD12, 0xDD13, 0xDCF3,
-    0xE534, 0xED54, 0xE514, 0xE4F3, 0xDCD2, 0xD4B1, 0xCC70, 0xD4B2,
-    0xCCF3, 0x4944, 0x1000, 0x0800, 0x0800, 0x4985, 0xC4D1, 0xD4D1,
-    0xE4D1, 0xDC91, 0xE514, 0x7249, 0x1000, 0x1000, 0x4145, 0xD575,
-    0xCD13, 0x934C, 0x5144, 0x2000, 0x1000, 0x0800, 0x0000, 0x0820,
-    0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x2840, 0xBC2F,
-    0xE4D2, 0xE491, 0xE470, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC90, 0xE470, 0xE46F, 0xE46F,
-    0xE490, 0xBBAD, 0x938D, 0x840F, 0x6CB2, 0x5D13, 0x5534, 0x4D14,
-    0x4D14, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514, 0x4514,
-    0x4534, 0x3D34, 0x4534, 0x4534, 0x3D14, 0x3D14, 0x3514, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x2D34,
-    0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x2D34,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3514, 0x3D34, 0x3D34,
-    0x3D34, 0x4534, 0x4534, 0x4534, 0x4534, 0x4554, 0x4554, 0x4D55,
-    0x4D75, 0x4D75, 0x4D55, 0x4D55, 0x7556, 0x7556, 0x7536, 0x7536,
-    0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D35, 0x6D35, 0x6D36, 0x6D36,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D35, 0x6D35, 0x6D35,
-    0x6D15, 0x6D16, 0x6D16, 0x6516, 0x6516, 0x6536, 0x6D36, 0x6D15,
-    0x6D14, 0x74F4, 0x7CD3, 0x8CB2, 0x8C0F, 0x9B8D, 0xB3CE, 0xD470,
-    0xE4B1, 0xEC70, 0xEC70, 0xF450, 0xEC2F, 0xD32B, 0xD34B, 0xEC70,
-    0xEC70, 0xECB0, 0xE470, 0xEC70, 0xEC70, 0xEC50, 0xEC91, 0xE491,
-    0xE491, 0xDC90, 0xE4D1, 0xDC71, 0xDC71, 0xDC71, 0xD450, 0xDC71,
-    0xDC91, 0xDC71, 0xD491, 0xE533, 0x9B6D, 0x2840, 0x0800, 0x0800,
-    0x1840, 0x7B0B, 0xD533, 0xD470, 0xE490, 0xE4B1, 0xE513, 0x828A,
-    0x1800, 0x0800, 0x30A2, 0xC4D2, 0xD533, 0xE554, 0xC450, 0x6A07,
-    0x2040, 0x1000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0020,
-    0x0000, 0x0800, 0x30A2, 0xBC30, 0xE4D2, 0xE490, 0xE470, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70,
-    0xEC90, 0xE490, 0xE490, 0xE46F, 0xECB0, 0xE491, 0xAB8D, 0x836D,
-    0x7450, 0x6CF3, 0x5CF3, 0x5513, 0x4D14, 0x4514, 0x4514, 0x4514,
-    0x4514, 0x4514, 0x4514, 0x3D34, 0x3D34, 0x3D34, 0x4534, 0x4534,
-    0x3D14, 0x3D14, 0x3514, 0x2D34, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x2D34,
-    0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3D34, 0x3D34, 0x4534, 0x4554, 0x4534, 0x4554,
-    0x4554, 0x4554, 0x4D55, 0x4D55, 0x4D75, 0x4D75, 0x4D55, 0x4D55,
-    0x7D56, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7536,
-    0x7536, 0x7536, 0x7536, 0x6D35, 0x6D36, 0x6D35, 0x6D15, 0x6D35,
-    0x6D35, 0x6D35, 0x6D15, 0x6D15, 0x6D35, 0x6515, 0x6536, 0x6535,
-    0x6515, 0x6536, 0x6515, 0x6515, 0x6515, 0x6515, 0x64F5, 0x6516,
-    0x6515, 0x6515, 0x6535, 0x6D14, 0x6CD3, 0x7CD3, 0x8C71, 0x93AE,
-    0xA38D, 0xC3EF, 0xDC70, 0xE470, 0xE470, 0xEC70, 0xF450, 0xF450,
-    0xDB6C, 0xC2C9, 0xE3CD, 0xEC4F, 0xEC6F, 0xEC90, 0xEC90, 0xEC90,
-    0xEC70, 0xEC70, 0xEC70, 0xE491, 0xE491, 0xE490, 0xE470, 0xE470,
-    0xE470, 0xE450, 0xECB2, 0xEC91, 0xE471, 0xE4B1, 0xE4F2, 0xCCB1,
-    0x4944, 0x1000, 0x0800, 0x0820, 0x3903, 0xC4D2, 0xCCD1, 0xD490,
-    0xDC70, 0xE491, 0xE4F3, 0x82AA, 0x1000, 0x0800, 0x2861, 0xBCB1,
-    0xD4F2, 0xDCF2, 0xE533, 0xD4D1, 0x8B0B, 0x4123, 0x1800, 0x0800,
-    0x0800, 0x0000, 0x0000, 0x0000, 0x0820, 0x1000, 0x59A6, 0xD4B2,
-    0xDC91, 0xE470, 0xEC71, 0xEC70, 0xEC50, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC90, 0xE490, 0xE490, 0xE490,
-    0xEC90, 0xECD1, 0xD42F, 0xA36C, 0x83AD, 0x7C70, 0x6CD2, 0x5CD2,
-    0x4CF3, 0x4D34, 0x44F3, 0x4D14, 0x4D14, 0x4514, 0x4534, 0x3D34,
-    0x3D34, 0x3D34, 0x4534, 0x4514, 0x3D14, 0x3D14, 0x3514, 0x2D34,
-    0x2D34, 0x2D34, 0x3534, 0x3554, 0x3554, 0x3534, 0x2D34, 0x2D34,
-    0x2D34, 0x2D34, 0x2D14, 0x2D14, 0x2D34, 0x2D34, 0x2D34, 0x2D34,
-    0x3514, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3D34, 0x3D34,
-    0x4554, 0x4534, 0x4534, 0x4555, 0x4D55, 0x4D55, 0x4D55, 0x4D55,
-    0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x7D56, 0x7556, 0x7535, 0x7535,
-    0x7536, 0x7536, 0x7536, 0x7536, 0x7536, 0x7556, 0x7556, 0x6D36,
-    0x6D36, 0x6D35, 0x6D35, 0x6D35, 0x6D15, 0x6D15, 0x6D15, 0x6D15,
-    0x6D35, 0x6535, 0x6536, 0x6536, 0x5D15, 0x6535, 0x6535, 0x6515,
-    0x6535, 0x6535, 0x5D15, 0x6535, 0x6515, 0x6515, 0x64F4, 0x74D3,
-    0x7C92, 0x8410, 0x8B8E, 0xA36D, 0xCBCF, 0xEC71, 0xEC70, 0xEC90,
-    0xE44F, 0xEC50, 0xFC91, 0xE3CE, 0xCACA, 0xE3AD, 0xEC2F, 0xEC4F,
-    0xEC50, 0xEC70, 0xEC91, 0xEC70, 0xEC70, 0xEC91, 0xE490, 0xE470,
-    0xE470, 0xEC70, 0xEC71, 0xF471, 0xEC51, 0xEC50, 0xEC70, 0xE430,
-    0xE450, 0xDC71, 0xDCF2, 0x82CA, 0x2040, 0x0800, 0x0800, 0x1020,
-    0x7ACA, 0xDD34, 0xDCB2, 0xDCB1, 0xDC70, 0xDC70, 0xE514, 0x7A8A,
-    0x1000, 0x0800, 0x2861, 0xBC91, 0xD4D2, 0xDCB1, 0xDCB1, 0xED33,
-    0xE554, 0xB40F, 0x61E6, 0x30A1, 0x1000, 0x1000, 0x0800, 0x1000,
-    0x1000, 0x3081, 0xA38D, 0xE4F3, 0xE491, 0xE470, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC90,
-    0xEC90, 0xE490, 0xE490, 0xE490, 0xEC90, 0xEC91, 0xEC91, 0xCC0F,
-    0x936C, 0x83AD, 0x8471, 0x6CB2, 0x54F3, 0x4513, 0x4D13, 0x4513,
-    0x44F3, 0x4534, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x4534, 0x4514,
-    0x3D14, 0x3D14, 0x3514, 0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x3534,
-    0x3534, 0x3534, 0x2D34, 0x2D34, 0x2D34, 0x2D14, 0x2D14, 0x2D14,
-    0x2D34, 0x2D34, 0x2D34, 0x2D34, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x4534, 0x4534, 0x4554,
-    0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x4D75, 0x4D75, 0x4D75,
-    0x7556, 0x7556, 0x7536, 0x6D35, 0x6D36, 0x6D36, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6536, 0x6535,
-    0x6D36, 0x6D36, 0x6D36, 0x6D36, 0x6D16, 0x6516, 0x6516, 0x6536,
-    0x6556, 0x5D15, 0x5D15, 0x6536, 0x5D35, 0x5D55, 0x5D55, 0x5D55,
-    0x6535, 0x6514, 0x74F3, 0x8492, 0x83EF, 0x936D, 0xAB8E, 0xD410,
-    0xEC71, 0xEC50, 0xEC4F, 0xEC90, 0xE44F, 0xEC50, 0xEBEF, 0xCACA,
-    0xDB6C, 0xF470, 0xF470, 0xF470, 0xEC70, 0xEC70, 0xEC91, 0xEC91,
-    0xEC71, 0xEC91, 0xE491, 0xE470, 0xE450, 0xEC70, 0xF471, 0xF471,
-    0xEC50, 0xEC30, 0xEC50, 0xE42F, 0xE470, 0xE491, 0xCC91, 0x40E2,
-    0x0800, 0x0820, 0x0800, 0x2861, 0xB40F, 0xE4F3, 0xE492, 0xE4B1,
-    0xE491, 0xDC91, 0xDD14, 0x7249, 0x1000, 0x0800, 0x2861, 0xB450,
-    0xDCF3, 0xDCB1, 0xE4B1, 0xDC91, 0xDC91, 0xE533, 0xD4F2, 0x9BAD,
-    0x59C6, 0x30A1, 0x2861, 0x2861, 0x4924, 0x930C, 0xD4B2, 0xECD2,
-    0xE491, 0xE470, 0xEC70, 0xEC91, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xEC90, 0xEC90, 0xEC91,
-    0xEC90, 0xEC90, 0xF4B1, 0xECB1, 0xC3EE, 0x9B4C, 0x8B8D, 0x7C30,
-    0x64D2, 0x4CF2, 0x44F2, 0x4513, 0x4513, 0x4533, 0x3D13, 0x3D34,
-    0x3D34, 0x3D34, 0x3D34, 0x3D14, 0x3D14, 0x3D14, 0x3514, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x2D14, 0x2D14, 0x2D14, 0x3534, 0x2D34, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3514, 0x3D34, 0x3D34,
-    0x4534, 0x4534, 0x4534, 0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x4D55,
-    0x4D55, 0x4D55, 0x4D75, 0x4D75, 0x7576, 0x7556, 0x6D56, 0x6D56,
-    0x6D56, 0x6D56, 0x6D56, 0x6D56, 0x6D76, 0x6D56, 0x6556, 0x6556,
-    0x6556, 0x6556, 0x6556, 0x6556, 0x6536, 0x6536, 0x6536, 0x6536,
-    0x6536, 0x6516, 0x6536, 0x6536, 0x5CF6, 0x6556, 0x5D57, 0x5D56,
-    0x5D55, 0x5D75, 0x5D75, 0x6554, 0x6D34, 0x7D14, 0x84B2, 0x83CF,
-    0x934D, 0xB3CF, 0xDC71, 0xEC71, 0xF450, 0xF450, 0xEC4F, 0xEC2F,
-    0xEC70, 0xE40F, 0xCAEB, 0xD32C, 0xF470, 0xF490, 0xEC70, 0xF490,
-    0xEC90, 0xEC70, 0xEC70, 0xEC91, 0xEC71, 0xEC91, 0xE471, 0xE450,
-    0xE450, 0xEC50, 0xF451, 0xF451, 0xF451, 0xEC30, 0xEC50, 0xE470,
-    0xE491, 0xE513, 0x932B, 0x2020, 0x0800, 0x0000, 0x1000, 0x59C6,
-    0xD4B2, 0xE492, 0xE451, 0xE471, 0xE491, 0xDCB1, 0xDD13, 0x61E7,
-    0x0800, 0x0800, 0x2861, 0xB410, 0xDCB2, 0xE491, 0xE491, 0xE470,
-    0xDC71, 0xDCB1, 0xDCF2, 0xDD53, 0xCCD1, 0xA3AD, 0x9B6D, 0xA36D,
-    0xC430, 0xE4F3, 0xECD2, 0xE491, 0xEC70, 0xEC50, 0xEC70, 0xEC91,
-    0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC90,
-    0xE470, 0xC3CE, 0x9B4C, 0x838D, 0x7450, 0x5CD2, 0x54F2, 0x44F2,
-    0x4533, 0x3D13, 0x3D13, 0x4534, 0x4534, 0x3D34, 0x3D34, 0x3D34,
-    0x3D14, 0x3D14, 0x3513, 0x3514, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3534, 0x3534, 0x3534, 0x3514, 0x3514, 0x3514, 0x3514,
-    0x3514, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534,
-    0x3514, 0x3D34, 0x3D34, 0x3D34, 0x4534, 0x4534, 0x4534, 0x4D34,
-    0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x5575,
-    0x6D76, 0x6D76, 0x6D56, 0x6D56, 0x6D56, 0x6D76, 0x6577, 0x6576,
-    0x6D97, 0x6597, 0x6576, 0x5D56, 0x5D36, 0x5D36, 0x5D36, 0x5D56,
-    0x5D57, 0x6577, 0x6577, 0x6577, 0x6556, 0x6536, 0x6516, 0x6537,
-    0x5D37, 0x5D57, 0x5557, 0x5556, 0x5D96, 0x5D55, 0x5D34, 0x6D54,
-    0x7CF3, 0x8491, 0x83AE, 0x936D, 0xC40F, 0xDC71, 0xE471, 0xEC71,
-    0xEC70, 0xF490, 0xF470, 0xEC50, 0xEC0F, 0xCB0B, 0xCB0B, 0xF450,
-    0xF491, 0xEC70, 0xEC90, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xE471, 0xE471, 0xEC71, 0xEC71, 0xEC50, 0xEC31, 0xF431,
-    0xEC30, 0xE40F, 0xEC30, 0xEC91, 0xECD2, 0xD4B2, 0x5144, 0x1000,
-    0x0000, 0x0000, 0x2020, 0x9B6D, 0xE4F3, 0xE471, 0xDC30, 0xE470,
-    0xE471, 0xDC91, 0xD513, 0x5185, 0x0800, 0x0800, 0x2841, 0xB3EF,
-    0xDCB3, 0xE471, 0xEC91, 0xEC71, 0xE430, 0xE491, 0xE4F2, 0xDCD1,
-    0xDCF2, 0xDCD2, 0xE513, 0xE513, 0xE4D2, 0xE491, 0xEC91, 0xEC70,
-    0xEC71, 0xEC50, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC90,
-    0xEC70, 0xEC71, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC50, 0xEC50,
-    0xF491, 0xEC70, 0xEC70, 0xEC4F, 0xEC50, 0xEC51, 0xCBEF, 0xA38E,
-    0x83EF, 0x6C50, 0x64D1, 0x4CF1, 0x4D32, 0x4533, 0x4533, 0x3D13,
-    0x4514, 0x4534, 0x3D34, 0x3D34, 0x3D34, 0x3D13, 0x3513, 0x3513,
-    0x3514, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3534, 0x3514,
-    0x3514, 0x3514, 0x3514, 0x3514, 0x3514, 0x3534, 0x3534, 0x3534,
-    0x3534, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x4534,
-    0x4554, 0x4534, 0x4D34, 0x4D34, 0x4D54, 0x4D55, 0x4D55, 0x4D55,
-    0x4D34, 0x4D34, 0x4D34, 0x4D34, 0x6D97, 0x6D77, 0x6D76, 0x6576,
-    0x6577, 0x6577, 0x6597, 0x6597, 0x6597, 0x5D76, 0x5536, 0x5515,
-    0x5515, 0x5515, 0x5515, 0x54F5, 0x5516, 0x5536, 0x5556, 0x5556,
-    0x5D56, 0x5D56, 0x6557, 0x6558, 0x5537, 0x4D16, 0x4D57, 0x4D77,
-    0x4D35, 0x5514, 0x5CF3, 0x6C92, 0x7C30, 0x83AE, 0x9B8D, 0xC430,
-    0xECD2, 0xEC91, 0xE450, 0xEC91, 0xEC70, 0xEC70, 0xF470, 0xE3EF,
-    0xCB2B, 0xCAEB, 0xEC0F, 0xF471, 0xEC50, 0xF471, 0xEC91, 0xEC50,
-    0xEC91, 0xEC70, 0xEC71, 0xEC70, 0xEC91, 0xE470, 0xEC71, 0xEC91,
-    0xEC71, 0xEC50, 0xEC30, 0xEC51, 0xD36D, 0xD36D, 0xEC50, 0xE450,
-    0xED34, 0x92EB, 0x2020, 0x0800, 0x0000, 0x0800, 0x4944, 0xCCB1,
-    0xE4B2, 0xE471, 0xE450, 0xE450, 0xE451, 0xDC91, 0xD4F3, 0x4104,
-    0x0800, 0x0800, 0x2820, 0xBC10, 0xE4B2, 0xE451, 0xE471, 0xEC71,
-    0xEC50, 0xEC71, 0xE4B1, 0xE4B1, 0xDCB1, 0xDCB1, 0xE4B2, 0xE471,
-    0xDC50, 0xE450, 0xEC50, 0xEC70, 0xEC91, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC90, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xF470, 0xEC70, 0xF470, 0xF450,
-    0xEC30, 0xF471, 0xEC71, 0xCC50, 0xA3EF, 0x7B8D, 0x746F, 0x5CD1,
-    0x4CF1, 0x4532, 0x4533, 0x4513, 0x4534, 0x3D14, 0x3D34, 0x3D34,
-    0x3D34, 0x3D34, 0x3D13, 0x3D13, 0x3513, 0x3514, 0x3534, 0x3534,
-    0x3534, 0x3514, 0x3514, 0x3514, 0x3514, 0x3514, 0x3514, 0x3514,
-    0x3514, 0x3534, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D34,
-    0x3D34, 0x3D34, 0x4554, 0x4554, 0x4D54, 0x4D34, 0x4D34, 0x4D34,
-    0x4D34, 0x4D35, 0x5555, 0x5555, 0x5535, 0x4D34, 0x4D34, 0x4D34,
-    0x5CF4, 0x5CF4, 0x54F4, 0x54F5, 0x54F5, 0x5515, 0x5515, 0x4D15,
-    0x44F5, 0x44F4, 0x44D4, 0x44F5, 0x4D15, 0x4D36, 0x4D15, 0x4CF5,
-    0x44D5, 0x44D5, 0x3CD4, 0x3CF4, 0x44F4, 0x4D15, 0x5536, 0x5557,
-    0x4D17, 0x4537, 0x4577, 0x3D15, 0x44D4, 0x6535, 0x7D15, 0x7411,
-    0x836E, 0xABCE, 0xCC50, 0xE491, 0xE490, 0xEC90, 0xE490, 0xE490,
-    0xE450, 0xF471, 0xE3CE, 0xCB0B, 0xD32C, 0xEC0F, 0xF471, 0xE410,
-    0xF471, 0xF471, 0xEC51, 0xEC50, 0xEC71, 0xEC70, 0xEC70, 0xEC91,
-    0xEC91, 0xEC90, 0xEC91, 0xEC91, 0xEC70, 0xEC50, 0xEC50, 0xEC71,
-    0xCB4D, 0xCB6D, 0xEC71, 0xE491, 0xDCD2, 0x4903, 0x1000, 0x0000,
-    0x0000, 0x1040, 0x8B4B, 0xDD33, 0xDCB0, 0xE490, 0xEC91, 0xE450,
-    0xEC71, 0xE4B3, 0xCC92, 0x3082, 0x0000, 0x0820, 0x3040, 0xC450,
-    0xE4B2, 0xE471, 0xE471, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE491,
-    0xE491, 0xE4B1, 0xE450, 0xE450, 0xE470, 0xEC70, 0xEC91, 0xEC70,
-    0xEC91, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70,
-    0xEC70, 0xEC90, 0xEC90, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xF450, 0xF450, 0xF450, 0xF470, 0xF470, 0xEC50, 0xEC51, 0xEC92,
-    0xCC30, 0x936D, 0x7BCD, 0x6C8F, 0x54D0, 0x44F1, 0x3D12, 0x4554,
-    0x3D34, 0x3D34, 0x4514, 0x4534, 0x4534, 0x3D14, 0x3D33, 0x3D34,
-    0x3534, 0x3514, 0x3514, 0x3514, 0x3514, 0x3D14, 0x3D15, 0x3D15,
-    0x3D15, 0x3D14, 0x3D14, 0x3D14, 0x3D14, 0x3D34, 0x3D34, 0x3D34,
-    0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x4534, 0x4554, 0x4D54,
-    0x4D34, 0x4D34, 0x4D34, 0x4D34, 0x4D34, 0x5534, 0x5534, 0x4D34,
-    0x5555, 0x5554, 0x5534, 0x4D34, 0x6555, 0x6D55, 0x6556, 0x6556,
-    0x6556, 0x6576, 0x5D76, 0x5D56, 0x5D77, 0x65D7, 0x7639, 0x7E7A,
-    0x869B, 0x869B, 0x86BB, 0x8EBC, 0x869B, 0x7E3A, 0x65D8, 0x5576,
-    0x4D35, 0x4D35, 0x4D16, 0x4D36, 0x4D37, 0x4536, 0x3D15, 0x5576,
-    0x865A, 0x9E7A, 0x9515, 0x838E, 0xB410, 0xDC91, 0xE4B1, 0xE470,
-    0xE490, 0xE470, 0xE46F, 0xE470, 0xF4B1, 0xE40F, 0xCAEB, 0xD32C,
-    0xEBEF, 0xF470, 0xF471, 0xEC71, 0xEC51, 0xEC51, 0xEC51, 0xEC71,
-    0xEC71, 0xF491, 0xEC70, 0xEC71, 0xEC70, 0xEC90, 0xEC70, 0xE470,
-    0xE450, 0xE450, 0xEC70, 0xEC71, 0xE40F, 0xE410, 0xE451, 0xECF3,
-    0xB3EE, 0x2840, 0x0800, 0x0020, 0x0820, 0x3123, 0xC4D2, 0xD4D2,
-    0xE4B0, 0xE44F, 0xE450, 0xEC50, 0xE451, 0xE4D3, 0xABF0, 0x2020,
-    0x0000, 0x0800, 0x38A1, 0xC450, 0xE4B2, 0xE491, 0xEC91, 0xEC71,
-    0xEC51, 0xEC71, 0xEC71, 0xEC71, 0xECB1, 0xE490, 0xEC91, 0xEC91,
-    0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC51, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xF471, 0xF450, 0xF450, 0xF450,
-    0xEC70, 0xEC70, 0xF450, 0xEC50, 0xE451, 0xC40F, 0x8B2B, 0x7BED,
-    0x646F, 0x54D1, 0x4D32, 0x4554, 0x3D34, 0x3D34, 0x4514, 0x4D14,
-    0x4514, 0x4514, 0x3D34, 0x3D34, 0x3D34, 0x3D34, 0x3D14, 0x3D14,
-    0x3D14, 0x3D14, 0x3D15, 0x3D15, 0x3D15, 0x3D35, 0x3D15, 0x3D14,
-    0x3D14, 0x3D34, 0x3D34, 0x3D14, 0x3D34, 0x3D34, 0x4534, 0x4534,
-    0x4534, 0x4534, 0x4D54, 0x4D55, 0x4D55, 0x4D55, 0x4D55, 0x4D55,
-    0x5555, 0x5555, 0x5555, 0x5555, 0x5555, 0x5554, 0x5534, 0x4D34,
-    0xB73D, 0xB75D, 0xB75D, 0xB75D, 0xB77E, 0xB77E, 0xB77E, 0xAF7E,
-    0xB79E, 0xB7BE, 0xB7BF, 0xBFDF, 0xBFDF, 0xBFDF, 0xBFFF, 0xBFFF,
-    0xBFDF, 0xB7DF, 0xAF9E, 0xAF9E, 0xAF7E, 0xA75D, 0x9F3D, 0x973D,
-    0x973E, 0x971D, 0x8EBB, 0xAF3D, 0xC73C, 0xA575, 0x9BEF, 0xBC0F,
-    0xDC71, 0xE470, 0xE470, 0xEC90, 0xEC90, 0xE470, 0xE44F, 0xEC70,
-    0xEC0F, 0xCB0B, 0xD30C, 0xEBEF, 0xFC71, 0xF471, 0xEC50, 0xEC50,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC50, 0xEC50, 0xEC71, 0xEC71,
-    0xE430, 0xEC71, 0xE451, 0xE4D3, 0x7A69, 0x1000, 0x0000, 0x0020,
-    0x1020, 0x6248, 0xDD33, 0xDCD2, 0xDC70, 0xE470, 0xEC70, 0xEC50,
-    0xE471, 0xE4D3, 0x8B0C, 0x1000, 0x0000, 0x0800, 0x40C2, 0xCC71,
-    0xE491, 0xEC91, 0xEC71, 0xE470, 0xE471, 0xEC71, 0xEC71, 0xEC91,
-    0xEC71, 0xEC91, 0xEC71, 0xEC71, 0xEC50, 0xEC50, 0xEC50, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70,
-    0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC71,
-    0xEC71, 0xF470, 0xEC50, 0xEC50, 0xEC50, 0xEC4F, 0xEC70, 0xEC70,
-    0xEC50, 0xE490, 0xB3AD, 0x8B4B, 0x7BEE, 0x6CB1, 0x5D13, 0x44F3,
-    0x4534, 0x3D34, 0x4514, 0x4514, 0x4D14, 0x44F3, 0x4534, 0x4534,
-    0x4534, 0x4514, 0x4514, 0x3D14, 0x3D14, 0x3D14, 0x4514, 0x4515,
-    0x4515, 0x4515, 0x4515, 0x4515, 0x4534, 0x4534, 0x3D14, 0x3D34,
-    0x3D13, 0x4534, 0x4534, 0x4534, 0x4D34, 0x4D34, 0x4D55, 0x4D75,
-    0x4D55, 0x4D75, 0x4D55, 0x4D75, 0x4D55, 0x4D55, 0x4D55, 0x4D55,
-    0x4D55, 0x4D54, 0x4D34, 0x4534, 0xD7DF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xCFFF, 0xCFDF, 0xCFDF, 0xCFFF, 0xCFFF, 0xCFFF, 0xCFDF,
-    0xC7DF, 0xCFDF, 0xCFDF, 0xCFDF, 0xC7DF, 0xC7FF, 0xC7FF, 0xC7FF,
-    0xC7DF, 0xC7DF, 0xBFBF, 0xB7BF, 0xBFDF, 0xBFDF, 0xD7FF, 0xD73D,
-    0xA4F3, 0x8B4D, 0xBC0F, 0xDC71, 0xE450, 0xEC70, 0xE470, 0xEC90,
-    0xE470, 0xE470, 0xF491, 0xE42F, 0xCB0B, 0xDB6C, 0xEC0F, 0xFC71,
-    0xFC71, 0xF471, 0xEC51, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC50, 0xEC71, 0xE491, 0xDCD3,
-    0x5144, 0x1000, 0x0000, 0x0000, 0x2060, 0xA3CE, 0xD4D2, 0xDC91,
-    0xDC50, 0xE470, 0xEC70, 0xEC50, 0xE471, 0xDCD2, 0x7248, 0x0800,
-    0x0800, 0x1000, 0x5124, 0xD491, 0xE471, 0xEC71, 0xEC71, 0xE470,
-    0xE471, 0xE471, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC50, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC70, 0xF471, 0xEC70, 0xEC50,
-    0xEC70, 0xEC50, 0xEC70, 0xEC2F, 0xEC4F, 0xF490, 0xE42F, 0xAB6C,
-    0x8B6D, 0x7C0F, 0x6492, 0x54D2, 0x4D34, 0x3D14, 0x4534, 0x4D35,
-    0x4D14, 0x4D34, 0x4514, 0x4534, 0x4D34, 0x4534, 0x4514, 0x4513,
-    0x4514, 0x4514, 0x3D14, 0x3CF4, 0x3D14, 0x4515, 0x4515, 0x4515,
-    0x4515, 0x3D14, 0x3D34, 0x3D34, 0x3D34, 0x4534, 0x4555, 0x4D55,
-    0x4D55, 0x4555, 0x4555, 0x4555, 0x4535, 0x3D35, 0x3D35, 0x4535,
-    0x4535, 0x4535, 0x4515, 0x3D14, 0x4535, 0x4535, 0x4535, 0x4535,
-    0xDFDF, 0xDFDF, 0xDFDF, 0xDFFF, 0xD7FF, 0xD7DF, 0xD7DF, 0xD7DF,
-    0xD7FF, 0xD7FF, 0xD7DF, 0xD7DF, 0xD7DF, 0xD7FF, 0xD7FF, 0xDFFF,
-    0xD7FF, 0xCFDE, 0xCFFF, 0xCFFF, 0xC7DF, 0xC7BF, 0xCFDF, 0xC79E,
-    0xCF9F, 0xDFBF, 0xDEDC, 0xA452, 0x9B6E, 0xC3F0, 0xE472, 0xEC71,
-    0xE450, 0xEC70, 0xEC50, 0xEC70, 0xE450, 0xEC70, 0xE42F, 0xC32B,
-    0xC2EB, 0xEC0F, 0xFC91, 0xF471, 0xF451, 0xF471, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC71, 0xE471, 0xC3EF, 0x4082, 0x1000, 0x0800, 0x0800,
-    0x5185, 0xD534, 0xD491, 0xDC70, 0xE470, 0xE470, 0xEC50, 0xE450,
-    0xDC30, 0xDCD2, 0x61A6, 0x1000, 0x1000, 0x1000, 0x69E7, 0xD492,
-    0xE471, 0xEC70, 0xEC71, 0xE471, 0xE471, 0xE471, 0xEC71, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC70,
-    0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC2F,
-    0xEC2F, 0xF470, 0xEC70, 0xD40F, 0xAB8D, 0x8B8E, 0x7C71, 0x64B2,
-    0x44D2, 0x4534, 0x4D35, 0x4D35, 0x4D35, 0x4D34, 0x4D14, 0x4D34,
-    0x4534, 0x4534, 0x4534, 0x3D14, 0x3D14, 0x3D14, 0x3D35, 0x4535,
-    0x4535, 0x3D15, 0x3D15, 0x3D35, 0x3D35, 0x3D35, 0x3D34, 0x3534,
-    0x3535, 0x3D35, 0x3D35, 0x3D35, 0x3D35, 0x3535, 0x3535, 0x3535,
-    0x3535, 0x3535, 0x3515, 0x3515, 0x34F5, 0x34F5, 0x34F5, 0x34F5,
-    0x34F5, 0x34F5, 0x34F5, 0x3515, 0xDFDF, 0xDFDF, 0xDFDF, 0xDFDF,
-    0xDFDF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xDFDF,
-    0xDFDF, 0xDFFF, 0xDFDF, 0xDFDF, 0xDFFF, 0xD7DF, 0xD7FF, 0xCFDF,
-    0xCFDF, 0xD7DF, 0xD7FF, 0xDFDF, 0xEFDF, 0xE6DB, 0xAC51, 0xA32D,
-    0xCBD0, 0xEC52, 0xF451, 0xF451, 0xEC50, 0xEC70, 0xEC50, 0xEC50,
-    0xF490, 0xE42F, 0xCB4C, 0xC2EA, 0xE3EE, 0xF470, 0xF450, 0xEC30,
-    0xEC50, 0xEC50, 0xF471, 0xEC50, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xECB2, 0xBB8E,
-    0x3820, 0x1800, 0x1000, 0x1840, 0x936D, 0xE554, 0xDC71, 0xE451,
-    0xEC91, 0xEC50, 0xEC50, 0xEC70, 0xE471, 0xDCD2, 0x69C6, 0x2000,
-    0x1800, 0x2000, 0x9B0B, 0xDCB1, 0xE471, 0xEC71, 0xEC71, 0xE471,
-    0xE471, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC50, 0xEC70, 0xEC4F, 0xF470, 0xF490, 0xEC70, 0xEC90,
-    0xD430, 0xA36D, 0x83AE, 0x7471, 0x5492, 0x44F3, 0x4514, 0x3CD3,
-    0x3CD3, 0x3CB3, 0x3C92, 0x3C92, 0x3492, 0x34B2, 0x3CF3, 0x3D14,
-    0x4555, 0x3D56, 0x3D56, 0x3D36, 0x3D36, 0x3D36, 0x3D36, 0x3536,
-    0x3556, 0x3555, 0x3535, 0x2D35, 0x3515, 0x3515, 0x3536, 0x3D56,
-    0x3D56, 0x3D56, 0x3D56, 0x3D56, 0x3D76, 0x3D76, 0x3D77, 0x3D77,
-    0x3D77, 0x3D77, 0x4577, 0x4577, 0x4577, 0x3D77, 0x3D57, 0x3D36,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7DF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xDFFF, 0xDFDF, 0xD7DF,
-    0xD7DF, 0xD7DE, 0xD7FF, 0xCFDF, 0xD7FF, 0xD7FF, 0xDFBE, 0xF7FF,
-    0xEEFB, 0xA410, 0xA30C, 0xDC31, 0xEC92, 0xF451, 0xF451, 0xF451,
-    0xEC50, 0xEC50, 0xEC4F, 0xEC50, 0xF450, 0xD36C, 0xC2EA, 0xE3EE,
-    0xF470, 0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xF471, 0xF450,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC50, 0xEC71, 0xEC71, 0xCBEF, 0x58E3, 0x2800, 0x2000, 0x5144,
-    0xCCB2, 0xDCD2, 0xDC71, 0xE471, 0xEC91, 0xEC70, 0xEC70, 0xEC71,
-    0xEC91, 0xE4B2, 0x92EB, 0x3000, 0x2000, 0x48E3, 0xC430, 0xDCB2,
-    0xE491, 0xEC71, 0xEC71, 0xEC71, 0xE471, 0xE471, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC70,
-    0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC71,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xE40E,
-    0xDBCE, 0xEC6F, 0xF490, 0xEC70, 0xEC70, 0xCBEF, 0x82EB, 0x8410,
-    0x7513, 0x5514, 0x5575, 0x5596, 0x5596, 0x65D7, 0x5D96, 0x5D76,
-    0x5576, 0x4555, 0x3CF4, 0x34F4, 0x2CF4, 0x2D15, 0x2D36, 0x3557,
-    0x3577, 0x3577, 0x3598, 0x3577, 0x3557, 0x2D36, 0x2D56, 0x3557,
-    0x3556, 0x3D76, 0x4597, 0x4DF9, 0x5619, 0x5619, 0x5619, 0x55F9,
-    0x5619, 0x5E5A, 0x6EBC, 0x76FD, 0x7F1E, 0x7F3E, 0x873E, 0x873E,
-    0x7F3E, 0x7F1D, 0x76FD, 0x76DC, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7DF, 0xD7FF,
-    0xD7FF, 0xDFDE, 0xEFDE, 0xE71B, 0xAC71, 0x9AEB, 0xD410, 0xF4B2,
-    0xEC30, 0xF450, 0xF450, 0xEC30, 0xEC50, 0xEC50, 0xF470, 0xF450,
-    0xD36C, 0xCAEB, 0xDBAD, 0xF491, 0xEC70, 0xEC50, 0xEC50, 0xEC91,
-    0xEC70, 0xEC70, 0xF471, 0xF471, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC50, 0xE430, 0xE471,
-    0xBB8E, 0x8A69, 0x7A69, 0xABEE, 0xDD13, 0xDCB2, 0xE471, 0xE470,
-    0xEC70, 0xF491, 0xF470, 0xF471, 0xE470, 0xE4B1, 0xD471, 0x8228,
-    0x69A6, 0x9B2C, 0xDCD2, 0xE4B1, 0xE491, 0xEC71, 0xEC71, 0xEC71,
-    0xE471, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC90, 0xEC70, 0xEC70,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xF471, 0xEC70,
-    0xEC70, 0xF470, 0xEC70, 0xD3AD, 0xBAC9, 0xDBED, 0xEC6F, 0xEC4F,
-    0xF470, 0xEC71, 0xB36D, 0x8B4D, 0xAD96, 0xB6FC, 0x9F1C, 0x9F5D,
-    0x9F7E, 0xAFDF, 0xAFBF, 0xAFBF, 0xA79F, 0x975E, 0x8F1D, 0x7EBC,
-    0x665A, 0x55F8, 0x4DD8, 0x45D8, 0x45D8, 0x45D9, 0x45B8, 0x45B8,
-    0x45B8, 0x4DD9, 0x561A, 0x5E5A, 0x6EDC, 0x76DC, 0x7F1D, 0x873E,
-    0x8F5E, 0x8F5E, 0x875E, 0x873D, 0x8F5E, 0x8F9F, 0x9FBF, 0x9FDF,
-    0x9FDF, 0x9FBF, 0x9FBF, 0x9FBF, 0x9FDF, 0x9FDF, 0x9FBF, 0x97BF,
-    0xD7DF, 0xD7DF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FE, 0xDFDE, 0xE7DE, 0xE73C, 0xB4D2,
-    0xA32C, 0xD40F, 0xEC91, 0xEC70, 0xEC90, 0xEC91, 0xEC91, 0xEC50,
-    0xEC70, 0xEC70, 0xF470, 0xDBCE, 0xCAEA, 0xDB6D, 0xF470, 0xF470,
-    0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xF471, 0xF471,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xE430, 0xE431, 0xEC71, 0xECD3, 0xE4B2, 0xE513, 0xE513,
-    0xE4D2, 0xE4B2, 0xE471, 0xE471, 0xEC71, 0xF491, 0xF471, 0xF471,
-    0xEC91, 0xE491, 0xECF3, 0xDCD2, 0xD491, 0xE533, 0xE4B2, 0xDC91,
-    0xEC91, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC91,
-    0xEC70, 0xEC91, 0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xDBCE,
-    0xC30B, 0xDBCD, 0xEC6F, 0xEC6F, 0xF44F, 0xF471, 0xE410, 0xAB0D,
-    0xB473, 0xDEFC, 0xD7BF, 0xC7BF, 0xC7FF, 0xC7DF, 0xC7BF, 0xC7BF,
-    0xC7DF, 0xC7DF, 0xBFFF, 0xBFFF, 0xB7FF, 0xA7DF, 0x9F9F, 0x8F5E,
-    0x86FC, 0x7EDC, 0x7EDC, 0x7EDC, 0x86FD, 0x975E, 0x9F9F, 0xA7DF,
-    0xA7DF, 0xA7DF, 0xA7FF, 0xAFFF, 0xAFDF, 0xAFDF, 0xA7BF, 0xA7BF,
-    0xA7BF, 0xA7BF, 0xA7BF, 0xA79F, 0xA77F, 0xA77E, 0x9F7E, 0x9F7E,
-    0x9F7E, 0x9F7E, 0x9F7E, 0x9F7E, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xCFDF, 0xD7FF, 0xDFDE,
-    0xEFFF, 0xEF7C, 0xBD13, 0x932C, 0xCBEF, 0xEC91, 0xEC50, 0xEC70,
-    0xEC91, 0xEC90, 0xE470, 0xEC50, 0xEC70, 0xF470, 0xE3CE, 0xC2AA,
-    0xCB0B, 0xF430, 0xF450, 0xF450, 0xF490, 0xEC90, 0xEC91, 0xE470,
-    0xEC70, 0xEC70, 0xEC50, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE470, 0xEC71, 0xEC51, 0xEC51,
-    0xE471, 0xE492, 0xDC91, 0xDC91, 0xE491, 0xE491, 0xE471, 0xE471,
-    0xEC91, 0xF471, 0xF450, 0xF471, 0xEC71, 0xEC91, 0xE4B1, 0xE4B1,
-    0xE4D2, 0xE4B1, 0xE491, 0xE491, 0xEC91, 0xE471, 0xEC71, 0xEC91,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xF4B1, 0xEC70, 0xE42F, 0xE44F, 0xEC90, 0xEC4F,
-    0xF46F, 0xF450, 0xF451, 0xDBD0, 0x9ACD, 0xBCF4, 0xE73D, 0xCF5D,
-    0xCF7E, 0xC77E, 0xBF3E, 0xC77E, 0xC75D, 0xC77E, 0xC79E, 0xBF9E,
-    0xBFBF, 0xBFDF, 0xBFDF, 0xB7DF, 0xB7DF, 0xB7FF, 0xB7FF, 0xB7FF,
-    0xB7FF, 0xB7FF, 0xB7FF, 0xBFFF, 0xB7FF, 0xB7FF, 0xBFFF, 0xB7DF,
-    0xB7BF, 0xB7BF, 0xAF9F, 0xAF9F, 0xAF7E, 0xAF7E, 0xA75E, 0xA73D,
-    0x9F3D, 0x9F3D, 0x9F3D, 0x9F3E, 0x9F5E, 0x9F5E, 0x9F5E, 0x9F5E,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xCFFF, 0xCFFF, 0xCFFF, 0xCFFF,
-    0xC7FF, 0xCFFF, 0xD7DE, 0xDFBE, 0xEF9D, 0xC595, 0x930B, 0xC3CF,
-    0xEC92, 0xF471, 0xF491, 0xEC70, 0xEC90, 0xE470, 0xE450, 0xEC70,
-    0xEC70, 0xEC2F, 0xC2EA, 0xC2EA, 0xE3EF, 0xEC30, 0xEC50, 0xEC70,
-    0xEC70, 0xF4B1, 0xE42F, 0xDC0F, 0xEC50, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE471, 0xE491, 0xE491,
-    0xE491, 0xE491, 0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xF471,
-    0xEC71, 0xEC70, 0xE491, 0xE491, 0xE491, 0xE470, 0xE470, 0xE490,
-    0xE471, 0xE471, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC50, 0xEC50, 0xEC71, 0xF491, 0xEC70, 0xEC91, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xE48F, 0xE48F, 0xEC6F, 0xEC70, 0xF451, 0xF452,
-    0xC34E, 0x9B0D, 0xDE18, 0xE75D, 0xDFBE, 0xCF9E, 0xC77E, 0xC77E,
-    0xC75D, 0xC77E, 0xC77E, 0xC77E, 0xC77F, 0xC79F, 0xC79F, 0xC79F,
-    0xC7BF, 0xC7DF, 0xC7DF, 0xC7DF, 0xBFDF, 0xBFDF, 0xBFDF, 0xBFDF,
-    0xBFDF, 0xC7DF, 0xBFDF, 0xBFDF, 0xBFDF, 0xBFBF, 0xB79F, 0xAF7E,
-    0xA73E, 0xA73D, 0x9F1D, 0x9F1D, 0x9F1D, 0x9F1D, 0x971D, 0x971D,
-    0x973D, 0x8F3D, 0x8F3D, 0x8F3D, 0xCFFF, 0xCFFF, 0xCFFF, 0xCFFF,
-    0xD7FF, 0xCFDF, 0xD7DF, 0xCFDF, 0xCFDF, 0xCFDF, 0xCFDF, 0xC7DF,
-    0xC7DF, 0xC7DF, 0xC7DF, 0xC7DF, 0xBFDF, 0xC79E, 0xCF5D, 0xE77D,
-    0xCDD6, 0x934D, 0xC3EF, 0xEC92, 0xF451, 0xEC30, 0xEC71, 0xE470,
-    0xDC4F, 0xE470, 0xEC70, 0xEC70, 0xF470, 0xD34C, 0xC2CA, 0xE3CE,
-    0xEC50, 0xEC2F, 0xF470, 0xEC4F, 0xEC50, 0xF491, 0xC34C, 0xCB8D,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC71, 0xEC70, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71,
-    0xEC91, 0xE471, 0xE470, 0xE470, 0xE471, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC91, 0xEC50, 0xEC71, 0xF491,
-    0xEC70, 0xEC91, 0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xE490, 0xE490,
-    0xEC90, 0xEC70, 0xF451, 0xF451, 0xEC52, 0xA2CB, 0xA3CF, 0xEEFB,
-    0xE77D, 0xD79D, 0xCFDF, 0xC7BF, 0xCF9E, 0xCF9E, 0xCF9F, 0xCF9F,
-    0xCF9F, 0xCF9F, 0xC77F, 0xC77F, 0xC77E, 0xC79E, 0xC79F, 0xC7BF,
-    0xBFBF, 0xBFBF, 0xBFBF, 0xBFBF, 0xBFBF, 0xBFBF, 0xBFBF, 0xBF9F,
-    0xBF9F, 0xB79F, 0xAF7E, 0xAF5E, 0xA73D, 0x9F3D, 0x9F1D, 0x971D,
-    0x971D, 0x8F1D, 0x8F1D, 0x8F1D, 0x871D, 0x871D, 0x871D, 0x871D,
-    0xC7FF, 0xC7DF, 0xC7DF, 0xC7DF, 0xC7BF, 0xC7BF, 0xC7BF, 0xC79F,
-    0xBF9F, 0xBFBF, 0xBFBF, 0xBFBF, 0xB79E, 0xB7BF, 0xB7BF, 0xB7BF,
-    0xBFBF, 0xC79E, 0xDF7E, 0xD659, 0x938E, 0xB38E, 0xDC51, 0xEC71,
-    0xF471, 0xEC50, 0xEC70, 0xE470, 0xDC50, 0xE470, 0xEC90, 0xEC70,
-    0xDBCE, 0xBAAA, 0xD38D, 0xF450, 0xEC50, 0xEC70, 0xEC70, 0xEC50,
-    0xEC70, 0xEC70, 0xBB0B, 0xD38D, 0xEC70, 0xEC70, 0xE470, 0xEC91,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC70, 0xEC70,
-    0xEC70, 0xE430, 0xE42F, 0xEC70, 0xF491, 0xF491, 0xEC71, 0xEC70,
-    0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC91,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC91, 0xEC90, 0xEC90, 0xEC90, 0xEC91, 0xF471, 0xF451, 0xF451,
-    0xEC51, 0xD3CF, 0x9AEB, 0xCD33, 0xEF7C, 0xDFDE, 0xCFDF, 0xC7BE,
-    0xC7BF, 0xCFBF, 0xCFBF, 0xCFBF, 0xCFBF, 0xCFBF, 0xC79F, 0xC79F,
-    0xC79E, 0xC79E, 0xC79E, 0xBF9E, 0xBFBF, 0xBFBF, 0xB7BF, 0xB79F,
-    0xB79F, 0xB79F, 0xAF7E, 0xAF7E, 0xAF7E, 0xAF7E, 0xA75E, 0x9F5E,
-    0x9F3D, 0x973D, 0x8F1D, 0x8F1D, 0x871D, 0x871D, 0x871D, 0x871D,
-    0x7F1D, 0x7F1D, 0x7F1D, 0x7F1D, 0xBFBF, 0xBFBF, 0xBFBF, 0xBFBF,
-    0xBFBF, 0xBF9F, 0xB79F, 0xB77F, 0xB77E, 0xB77E, 0xB79E, 0xAF9E,
-    0xAF9E, 0xAF9E, 0xAF9E, 0xAF9E, 0xBF9E, 0xD79E, 0xE6FC, 0xA410,
-    0xA32C, 0xE492, 0xE450, 0xEC50, 0xF471, 0xF471, 0xEC71, 0xE491,
-    0xE491, 0xE490, 0xEC90, 0xE42F, 0xC2EA, 0xCB2B, 0xEC2F, 0xEC50,
-    0xE42F, 0xF491, 0xEC70, 0xEC70, 0xEC91, 0xE450, 0xDBAE, 0xE42F,
-    0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC91, 0xEC91, 0xEC71, 0xEC70, 0xE40F, 0xD36D, 0xD38D,
-    0xF471, 0xF491, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xF471, 0xEC51, 0xEC51, 0xEC51, 0xE471, 0xC3AD, 0x9B4C,
-    0xD617, 0xE79D, 0xCF9D, 0xC7BE, 0xC7BE, 0xBFBF, 0xC7BF, 0xC7BF,
-    0xC7BF, 0xC7BF, 0xC7BF, 0xC7BF, 0xC7BF, 0xC7BF, 0xBFBF, 0xBFBF,
-    0xB7BF, 0xB7BF, 0xAF9F, 0xAF7E, 0xA77E, 0xA75E, 0x9F5E, 0x9F3D,
-    0x9F5E, 0x9F5E, 0x973E, 0x973D, 0x973D, 0x8F3D, 0x8F1D, 0x871D,
-    0x7F1D, 0x7F1D, 0x771C, 0x771D, 0x771D, 0x771D, 0x771D, 0x771D,
-    0xAF9F, 0xAF9F, 0xAF9F, 0xAF9F, 0xAF9F, 0xAF9F, 0xAF7F, 0xAF7F,
-    0xAF9F, 0xAF9F, 0xAF9F, 0xAF9F, 0xAF9F, 0xA77E, 0xA77E, 0xAF7E,
-    0xBF3D, 0xDF1C, 0xC4F4, 0x9AEC, 0xD410, 0xE471, 0xEC50, 0xEC70,
-    0xF450, 0xF471, 0xEC71, 0xEC91, 0xEC91, 0xEC90, 0xF490, 0xD38C,
-    0xC2AA, 0xE40F, 0xEC30, 0xEC30, 0xEC70, 0xEC70, 0xEC91, 0xEC71,
-    0xEC70, 0xE450, 0xEC70, 0xEC91, 0xEC50, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC71, 0xEC70, 0xEC51, 0xEC51, 0xEC51, 0xEC70,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC91, 0xEC91, 0xEC71,
-    0xEC70, 0xE42F, 0xCB2C, 0xC30B, 0xDBCE, 0xF491, 0xF491, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xE42F, 0xE471, 0xA2EB, 0xA3EF, 0xDEB9, 0xD77D, 0xC77D,
-    0xBF9E, 0xB79F, 0xB79F, 0xB7BF, 0xB7BF, 0xB7BF, 0xB7BF, 0xB7BF,
-    0xB7BF, 0xB7BF, 0xAF9F, 0xAF7F, 0xAF7F, 0xAF7F, 0xA75F, 0x9F5E,
-    0x973E, 0x8F3D, 0x8F1D, 0x871D, 0x871D, 0x871D, 0x871D, 0x86FD,
-    0x871D, 0x871D, 0x7F1D, 0x7F1D, 0x7F1D, 0x76FD, 0x6EFC, 0x6EFD,
-    0x6EDD, 0x6EDD, 0x6EDD, 0x6EDD, 0xA77F, 0xA79F, 0xA79F, 0xA79F,
-    0xA77F, 0xA79F, 0xA77F, 0xA77F, 0xA77F, 0xA77F, 0xA77F, 0xA79F,
-    0xA77E, 0x9F5E, 0x9F5E, 0xB77E, 0xCF1D, 0xBD97, 0x9B2D, 0xC38F,
-    0xEC71, 0xEC50, 0xEC70, 0xEC4F, 0xEC70, 0xEC70, 0xEC70, 0xEC91,
-    0xEC70, 0xF491, 0xF450, 0xC2CA, 0xD32C, 0xF450, 0xEC50, 0xEC50,
-    0xEC70, 0xEC50, 0xEC71, 0xEC70, 0xEC50, 0xEC70, 0xEC70, 0xEC70,
-    0xEC50, 0xEC50, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xE470, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC30, 0xDB8D, 0xC2CB,
-    0xC2CA, 0xEC50, 0xF4B1, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xE44F, 0xE450, 0xF4B1, 0xCBCE,
-    0x92CA, 0xB4D3, 0xDF5C, 0xC73C, 0xAF3D, 0xA75E, 0xA77F, 0xA79F,
-    0xA77F, 0xA77F, 0x9F7F, 0x9F7F, 0x9F7F, 0x9F5E, 0x9F5E, 0x973E,
-    0x971E, 0x971E, 0x8EFE, 0x8EFE, 0x86FE, 0x7EFD, 0x7EDD, 0x76DD,
-    0x76DD, 0x76FD, 0x76FD, 0x76DD, 0x76FD, 0x76DD, 0x76DD, 0x76FD,
-    0x6EFD, 0x6EFD, 0x66FD, 0x66FC, 0x66DD, 0x66BD, 0x66DD, 0x66DD,
-    0x9F5F, 0x9F7F, 0x9F7F, 0x9F7F, 0x9F5F, 0x977F, 0x9F5F, 0x977F,
-    0x9F7F, 0x9F7F, 0x9F7F, 0x9F7F, 0x9F7F, 0x9F7E, 0xA77F, 0xB77E,
-    0xC67A, 0x93AF, 0xA32D, 0xDC31, 0xEC71, 0xEC70, 0xEC90, 0xEC8F,
-    0xEC90, 0xEC90, 0xE470, 0xEC70, 0xEC70, 0xF471, 0xDBAE, 0xC2CA,
-    0xE3EF, 0xF450, 0xF491, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC50,
-    0xEC50, 0xEC91, 0xE450, 0xEC70, 0xEC50, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xE470, 0xE470, 0xEC70, 0xEC70,
-    0xF471, 0xF450, 0xE3EF, 0xCB2C, 0xBAAA, 0xD36D, 0xF471, 0xF4B1,
-    0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC70,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xE490, 0xE490, 0xE490, 0xEC91,
-    0xEC90, 0xEC50, 0xEC70, 0xECB2, 0xB32D, 0x930C, 0xCDF8, 0xC6DB,
-    0x9EDB, 0x8F1D, 0x8F3D, 0x8F3E, 0x8F1E, 0x8F1E, 0x871E, 0x86FD,
-    0x86FD, 0x86FD, 0x86FD, 0x7EDD, 0x7EBD, 0x76BD, 0x76BD, 0x76BD,
-    0x76BD, 0x76DD, 0x76BD, 0x6EBD, 0x6EBD, 0x6EBD, 0x6EBD, 0x6EBD,
-    0x6EBD, 0x6EBD, 0x66BD, 0x66BD, 0x66DD, 0x66DD, 0x5EDD, 0x5EDC,
-    0x5EBC, 0x5EBC, 0x5EBC, 0x5EBC, 0x975F, 0x975F, 0x8F5F, 0x8F5F,
-    0x8F5F, 0x8F3F, 0x8F5F, 0x8F5F, 0x873E, 0x8F3E, 0x8F3E, 0x8F3E,
-    0x8F3E, 0x973D, 0x9F3D, 0xB6DB, 0x9472, 0x930C, 0xCC51, 0xE471,
-    0xE471, 0xF491, 0xE470, 0xEC90, 0xE470, 0xEC90, 0xEC90, 0xEC70,
-    0xEC50, 0xF430, 0xCB0B, 0xCB2C, 0xF491, 0xF470, 0xEC50, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xE450, 0xEC70, 0xEC71, 0xEC70, 0xEC91,
-    0xEC50, 0xEC70, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC91,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC50, 0xF471, 0xF450, 0xEC10,
-    0xD38D, 0xBAAA, 0xE40F, 0xEC50, 0xEC91, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC91, 0xE490, 0xE490, 0xE490, 0xEC91, 0xEC70, 0xF450, 0xF492,
-    0xDC31, 0x9ACC, 0x9BCF, 0xB618, 0x8E7A, 0x7EBB, 0x76DC, 0x76DC,
-    0x6EDD, 0x6EBD, 0x6EBC, 0x6EBC, 0x6EDD, 0x6EBC, 0x6EBC, 0x66BC,
-    0x669C, 0x66BD, 0x66BD, 0x66BD, 0x669D, 0x669D, 0x669D, 0x669D,
-    0x669D, 0x5E9D, 0x669D, 0x5E9D, 0x66BD, 0x5E9D, 0x5E9D, 0x5EBD,
-    0x5EBD, 0x56BD, 0x56DD, 0x56BC, 0x56BC, 0x569C, 0x569C, 0x569C,
-    0x873F, 0x873F, 0x875F, 0x7F3F, 0x7F1F, 0x7EFE, 0x7EFE, 0x7EFE,
-    0x771E, 0x771E, 0x76FE, 0x7F3E, 0x7F1D, 0x86FB, 0xA6DB, 0x9D54,
-    0x8B0C, 0xC3EF, 0xDC71, 0xE471, 0xE450, 0xEC50, 0xEC91, 0xEC90,
-    0xE490, 0xEC91, 0xEC71, 0xEC50, 0xF451, 0xE3CE, 0xC2CA, 0xE3EE,
-    0xF471, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE450, 0xE450, 0xF4B1, 0xEC71,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xF471, 0xF471, 0xEC70, 0xEC50, 0xC30B, 0xC30B, 0xEC50,
-    0xEC91, 0xE470, 0xEC70, 0xEC91, 0xEC70, 0xEC91, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xEC90,
-    0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xE471, 0xE471, 0xE490,
-    0xEC70, 0xEC50, 0xF451, 0xF451, 0xEC51, 0xCBF0, 0x8ACB, 0xA513,
-    0x9658, 0x7679, 0x5EBA, 0x56BB, 0x56BC, 0x569C, 0x569C, 0x569C,
-    0x569C, 0x5E9C, 0x569C, 0x569C, 0x569C, 0x569C, 0x569C, 0x569D,
-    0x5E9D, 0x5E9D, 0x5E9D, 0x569D, 0x569D, 0x569D, 0x569D, 0x567D,
-    0x569D, 0x569D, 0x4E7C, 0x4E9C, 0x4EBC, 0x4EBC, 0x4E9C, 0x4E9C,
-    0x4E7C, 0x4E7C, 0x4E7C, 0x4E7C, 0x6EFE, 0x6EFE, 0x6F1E, 0x6EFE,
-    0x6EFD, 0x6EDD, 0x6EBE, 0x6EDE, 0x6EDE, 0x6EDD, 0x6EDD, 0x76DD,
-    0x7EDC, 0x8EBB, 0x9DD7, 0x8BEF, 0xB3CE, 0xDC71, 0xEC92, 0xE450,
-    0xE430, 0xEC50, 0xEC91, 0xE470, 0xE491, 0xE471, 0xEC51, 0xF471,
-    0xF430, 0xD30C, 0xCB0B, 0xF471, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC50, 0xEC91, 0xEC71, 0xE430,
-    0xDC0F, 0xEC71, 0xEC71, 0xEC91, 0xEC70, 0xEC70, 0xEC71, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC50, 0xEC70,
-    0xF491, 0xD38D, 0xBAAA, 0xDBEF, 0xECB1, 0xE470, 0xE470, 0xEC90,
-    0xEC91, 0xEC70, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC51,
-    0xEC71, 0xEC71, 0xE471, 0xE471, 0xE470, 0xEC50, 0xF451, 0xF431,
-    0xEC71, 0xDC51, 0xAB6D, 0x93EF, 0x95D6, 0x7E58, 0x5679, 0x469B,
-    0x469B, 0x467B, 0x4EBC, 0x467B, 0x467B, 0x467C, 0x467C, 0x467C,
-    0x4E7C, 0x4E7C, 0x4E7C, 0x4E7C, 0x4E9C, 0x4E9C, 0x4E7C, 0x4E7C,
-    0x4E7C, 0x4E9C, 0x4E9D, 0x4E9D, 0x467C, 0x4E7D, 0x467C, 0x467C,
-    0x467C, 0x467C, 0x467C, 0x4E9D, 0x469C, 0x469C, 0x469C, 0x469C,
-    0x5EBE, 0x5EBD, 0x5EDD, 0x5EBC, 0x5EBC, 0x5E9C, 0x5E9D, 0x5E9D,
-    0x5E9D, 0x66BD, 0x66BD, 0x6E7B, 0x867B, 0x9E39, 0x9451, 0x9B4D,
-    0xD471, 0xECB2, 0xE471, 0xEC51, 0xEC50, 0xEC50, 0xEC71, 0xEC91,
-    0xE490, 0xEC70, 0xEC50, 0xF451, 0xEBEF, 0xCACA, 0xDB8E, 0xF491,
-    0xEC70, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xE450, 0xC34C, 0xDBCE, 0xEC71, 0xEC70, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC50, 0xEC70, 0xF471, 0xEC50, 0xEC70, 0xEC50, 0xCB6C, 0xC32C,
-    0xEC70, 0xE450, 0xEC70, 0xEC91, 0xEC70, 0xEC91, 0xEC91, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC91,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE491, 0xE471,
-    0xE470, 0xEC50, 0xF471, 0xEC30, 0xEC71, 0xECB2, 0xD451, 0x8B4D,
-    0x8CD3, 0x8618, 0x5E59, 0x467A, 0x3E7B, 0x469C, 0x469B, 0x469B,
-    0x467B, 0x469C, 0x469C, 0x469C, 0x4E9C, 0x4E9C, 0x467C, 0x467B,
-    0x467C, 0x467C, 0x465C, 0x465B, 0x463C, 0x463C, 0x463C, 0x3E3B,
-    0x465C, 0x465C, 0x465C, 0x467C, 0x469D, 0x467C, 0x3E7C, 0x3E7C,
-    0x469D, 0x469C, 0x3E7C, 0x3E7C, 0x56BE, 0x56BD, 0x56BD, 0x4E9C,
-    0x569C, 0x567C, 0x567C, 0x567C, 0x567C, 0x5E9D, 0x5E9C, 0x665B,
-    0x863A, 0x9D56, 0x934D, 0xC3CF, 0xE491, 0xE491, 0xE450, 0xEC50,
-    0xEC70, 0xEC50, 0xEC70, 0xEC91, 0xEC70, 0xEC71, 0xEC50, 0xF430,
-    0xE38E, 0xCAEB, 0xEC2F, 0xF471, 0xEC70, 0xEC50, 0xEC50, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xE430, 0xE42F, 0xBACA,
-    0xDBEF, 0xE450, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xE450, 0xEC70, 0xEC71,
-    0xEC50, 0xEC71, 0xEC50, 0xC32B, 0xD38D, 0xEC70, 0xEC50, 0xEC71,
-    0xEC70, 0xEC91, 0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xE491, 0xEC70, 0xEC50, 0xF491, 0xEC71,
-    0xEC51, 0xEC92, 0xE4B2, 0xABAF, 0x83CF, 0x8DB6, 0x6E39, 0x4E59,
-    0x465A, 0x469C, 0x467B, 0x4EBC, 0x469B, 0x467B, 0x465B, 0x465B,
-    0x3E3A, 0x3E1A, 0x3DFA, 0x3DD9, 0x35D9, 0x35B8, 0x2D98, 0x2D78,
-    0x2D78, 0x3578, 0x3599, 0x3599, 0x3599, 0x35B9, 0x35BA, 0x35FA,
-    0x3E3B, 0x3E5C, 0x3E5C, 0x3E7C, 0x469D, 0x3E7C, 0x365B, 0x2E3B,
-    0x569E, 0x4E9D, 0x4E9C, 0x4E7C, 0x4E7C, 0x4E7C, 0x567C, 0x567C,
-    0x4E7C, 0x567C, 0x567B, 0x665A, 0x8DF8, 0x8C31, 0xA34D, 0xE471,
-    0xE471, 0xEC91, 0xEC71, 0xEC50, 0xEC50, 0xF450, 0xF470, 0xEC70,
-    0xEC70, 0xEC71, 0xF450, 0xF430, 0xD32C, 0xD32C, 0xF450, 0xF471,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xE450, 0xE450, 0xD3AD, 0xE430, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xF471, 0xEC70, 0xFCD2, 0xD3AE,
-    0xBACA, 0xF491, 0xEC50, 0xEC50, 0xEC71, 0xEC71, 0xEC71, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC70, 0xEC91, 0xEC91, 0xEC71, 0xEC71, 0xEC92, 0xD451,
-    0x8B4D, 0x94D3, 0x8618, 0x5E18, 0x4E39, 0x3E19, 0x461A, 0x4619,
-    0x4619, 0x3DF9, 0x3DD9, 0x3DD9, 0x45D9, 0x45F9, 0x4E1A, 0x4E1A,
-    0x565B, 0x5E7B, 0x5E9B, 0x669C, 0x669C, 0x667C, 0x5E5B, 0x5E3B,
-    0x561A, 0x4E1A, 0x45FA, 0x3DD9, 0x35B9, 0x35B9, 0x35D9, 0x35FA,
-    0x361B, 0x2DFA, 0x25DA, 0x25B9, 0x4E7D, 0x4E7D, 0x4E7C, 0x4E7C,
-    0x4E7C, 0x4E7C, 0x4E7C, 0x4E5C, 0x4E5C, 0x4E5C, 0x4E5A, 0x6E5A,
-    0x8555, 0x7B6D, 0xC3EF, 0xEC71, 0xE470, 0xEC71, 0xEC70, 0xEC70,
-    0xEC50, 0xF450, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xF450, 0xEC10,
-    0xC2CB, 0xDB6D, 0xF470, 0xF471, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xE450,
-    0xEC50, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC71, 0xEC71, 0xEC50,
-    0xEC71, 0xF491, 0xF4B1, 0xEC50, 0xC30B, 0xDBAE, 0xF471, 0xEC50,
-    0xEC70, 0xEC71, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC70, 0xEC70,
-    0xEC91, 0xEC71, 0xEC51, 0xE492, 0xB3AE, 0x838E, 0x8DB6, 0x6DD7,
-    0x55F8, 0x5619, 0x667B, 0x669B, 0x6EDC, 0x6EDC, 0x76DD, 0x7EFD,
-    0x7F3E, 0x877F, 0x8F9F, 0x97BF, 0x97DF, 0x97DF, 0x97DF, 0x9FBF,
-    0x9FBF, 0x9FBF, 0x9FBF, 0x979F, 0x977F, 0x8F7F, 0x875F, 0x771E,
-    0x6EDD, 0x5E7B, 0x4E3A, 0x461A, 0x3DFA, 0x3DF9, 0x3DD9, 0x3DF9,
-    0x4E5D, 0x4E7C, 0x4E7C, 0x4E7C, 0x4E7C, 0x4E7C, 0x4E7D, 0x4E5D,
-    0x4E5C, 0x565B, 0x565A, 0x7618, 0x7C72, 0x8B4D, 0xDC71, 0xEC50,
-    0xEC71, 0xE450, 0xE470, 0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xF471,
-    0xEC70, 0xEC71, 0xF451, 0xEBEF, 0xBA8A, 0xE3CE, 0xF471, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91,
-    0xEC71, 0xEC50, 0xEC71, 0xE450, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC50, 0xEC70, 0xF491, 0xF491, 0xEC70, 0xEC70, 0xF491,
-    0xDBCE, 0xC2EB, 0xEC30, 0xF471, 0xEC50, 0xEC71, 0xEC71, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC91, 0xE470, 0xEC91, 0xEC71, 0xEC50, 0xEC71,
-    0xD42F, 0x932B, 0xA574, 0xB6FB, 0x9F5D, 0x9F9F, 0x9F9F, 0xA7BF,
-    0xA7BF, 0xA7BF, 0xA7BF, 0xAFBF, 0xAFDF, 0xAFDF, 0xAFDF, 0xAFDF,
-    0xAFBF, 0xAFBF, 0xAFBF, 0xB7DF, 0xB7DF, 0xB7DF, 0xB7DF, 0xB7BF,
-    0xAF9F, 0xA7BF, 0xA7BF, 0xA7DF, 0x9FDF, 0x97BF, 0x875E, 0x7F3D,
-    0x76FC, 0x76FC, 0x771D, 0x7F3D, 0x4E7C, 0x4E7C, 0x4E7C, 0x4E7C,
-    0x4E7C, 0x4E7C, 0x4E7D, 0x4E5D, 0x567D, 0x567B, 0x5E39, 0x75D7,
-    0x7BAF, 0xABAE, 0xEC91, 0xEC70, 0xEC70, 0xE470, 0xE470, 0xEC70,
-    0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xF451, 0xEBEF,
-    0xBA8A, 0xE3CF, 0xF471, 0xF471, 0xF471, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC91, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xEC70, 0xEC71, 0xE450,
-    0xEC71, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC71, 0xF471, 0xEC50,
-    0xF491, 0xEC71, 0xEC70, 0xEC70, 0xEC30, 0xC2CB, 0xD34D, 0xF450,
-    0xF471, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC70,
-    0xEC70, 0xEC50, 0xEC70, 0xEC70, 0xE490, 0xAB8C, 0x9C50, 0xDF7C,
-    0xC7BE, 0xB7DF, 0xBFDF, 0xBFDF, 0xBFDF, 0xBFBF, 0xBFBF, 0xBFBF,
-    0xBFDF, 0xBFDF, 0xBFDF, 0xBFDF, 0xBFBF, 0xBFBF, 0xC7BF, 0xC7DF,
-    0xC7DF, 0xC7DF, 0xC7DF, 0xC7BF, 0xBFDF, 0xBFDF, 0xBFBF, 0xB7BF,
-    0xB7DF, 0xAFFF, 0xAFDF, 0xAFFF, 0xAFFF, 0xAFDF, 0xAFFF, 0xAFFF,
-    0x4E9C, 0x4E9C, 0x4E9C, 0x4E9C, 0x4E9C, 0x4E9D, 0x569E, 0x569E,
-    0x569D, 0x5E7B, 0x6E59, 0x7514, 0x838E, 0xCC30, 0xEC91, 0xEC70,
-    0xEC70, 0xE471, 0xE470, 0xE470, 0xEC70, 0xEC70, 0xEC70, 0xEC71,
-    0xEC71, 0xEC71, 0xF451, 0xE3CF, 0xC28A, 0xEC10, 0xF451, 0xF471,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC50, 0xEC91, 0xEC91, 0xE470, 0xE470, 0xEC91,
-    0xEC71, 0xEC71, 0xEC50, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC50,
-    0xF471, 0xDBAE, 0xBAAA, 0xEC0F, 0xF491, 0xEC50, 0xEC91, 0xEC50,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xE470,
-    0xE46F, 0xD46F, 0x932B, 0xDE99, 0xD79D, 0xC7DE, 0xCFDF, 0xC79F,
-    0xCFBF, 0xCFBF, 0xCFBF, 0xCFBE, 0xCFBF, 0xCFDF, 0xCFDF, 0xCFDF,
-    0xCFDF, 0xCFDF, 0xCFDF, 0xCFDF, 0xCFDF, 0xCFDF, 0xCFDF, 0xCFDF,
-    0xCFDF, 0xCFDF, 0xC7DF, 0xC7DF, 0xC7DF, 0xC7DF, 0xC7FF, 0xC7FF,
-    0xC7FF, 0xC7FF, 0xC7FF, 0xC7FF, 0x569D, 0x4E9C, 0x4EBC, 0x4EBC,
-    0x4E9C, 0x4E9C, 0x4E9D, 0x4E9D, 0x56BD, 0x5E7B, 0x7639, 0x6C50,
-    0x936D, 0xDC71, 0xEC90, 0xEC70, 0xEC70, 0xE470, 0xE470, 0xE470,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xF471, 0xE3CF,
-    0xC2AA, 0xEC10, 0xF450, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91,
-    0xEC71, 0xE471, 0xE470, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xF450, 0xF450, 0xC2EB, 0xD36D,
-    0xF471, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71,
-    0xEC91, 0xEC90, 0xE470, 0xE490, 0xE46F, 0xDC8F, 0xAB2B, 0xCD33,
-    0xEF9D, 0xD79D, 0xD7DF, 0xCFBE, 0xD7BF, 0xD7BE, 0xD7DE, 0xCFBE,
-    0xD7DE, 0xD7DF, 0xD7DF, 0xD7DF, 0xD7DF, 0xD7DF, 0xD7DF, 0xD7DF,
-    0xD7DF, 0xD7DF, 0xD7DF, 0xD7FF, 0xD7DF, 0xD7DF, 0xD7DF, 0xD7DF,
-    0xD7DF, 0xD7FF, 0xD7FF, 0xD7FF, 0xCFFF, 0xCFFF, 0xCFFF, 0xD7FF,
-    0x569D, 0x4E7C, 0x4E9C, 0x4E9C, 0x4E9C, 0x4E7C, 0x467D, 0x4E9D,
-    0x4E7C, 0x665B, 0x7DD8, 0x6B8E, 0xABCE, 0xECB1, 0xEC70, 0xEC6F,
-    0xE470, 0xE470, 0xE470, 0xE470, 0xEC70, 0xEC70, 0xEC70, 0xEC71,
-    0xEC71, 0xEC71, 0xF471, 0xE3CF, 0xC2AA, 0xEBEF, 0xF450, 0xEC50,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xE450, 0xDC2F, 0xEC91, 0xECD2, 0xECB1, 0xECD2, 0xEC91,
-    0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50,
-    0xF450, 0xFC91, 0xDBAE, 0xC2EB, 0xEC0F, 0xEC70, 0xEC50, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xE490, 0xE490,
-    0xE48F, 0xEC90, 0xBB4C, 0xAB8D, 0xF75C, 0xE7BE, 0xDFFF, 0xD7DF,
-    0xDFDF, 0xD7DF, 0xD7DF, 0xD7DE, 0xD7DF, 0xDFDF, 0xDFFF, 0xDFDF,
-    0xDFFF, 0xDFDF, 0xDFDF, 0xDFFF, 0xDFFF, 0xDFFF, 0xD7FF, 0xDFFF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF,
-    0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0x567C, 0x4E5C, 0x4E7C, 0x4E7C,
-    0x4E7C, 0x467C, 0x467C, 0x467C, 0x465B, 0x663A, 0x7535, 0x738E,
-    0xC450, 0xEC70, 0xEC6F, 0xEC6F, 0xEC70, 0xE470, 0xE470, 0xE490,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xF471, 0xE3EF,
-    0xBA8A, 0xEBEF, 0xF450, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC91, 0xEC91, 0xEC71, 0xEC71, 0xE450, 0xEC91, 0xEC91,
-    0xD3EE, 0xD40F, 0xF4D2, 0xECB1, 0xEC91, 0xEC71, 0xEC71, 0xEC51,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC70, 0xEC50, 0xF471, 0xF450, 0xF471, 0xCB2C,
-    0xCB2C, 0xF471, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC91, 0xE490, 0xE490, 0xEC90, 0xEC90, 0xDBCE, 0x9AAA,
-    0xEE58, 0xF7DE, 0xE7FE, 0xDFFF, 0xDFFE, 0xDFDF, 0xDFFF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xE7FF, 0xE7FF, 0xE7FF, 0xDFFF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0x4E7D, 0x4E7C, 0x467C, 0x467C, 0x467C, 0x467C, 0x3E7D, 0x3E5C,
-    0x463B, 0x5DD9, 0x6C52, 0x8B8E, 0xDC91, 0xEC4F, 0xF470, 0xF470,
-    0xEC50, 0xEC50, 0xEC70, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xF471, 0xEC30, 0xBAAA, 0xE3EF, 0xF450, 0xF470,
-    0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xE470, 0xE470, 0xD3EE, 0x9A48, 0x9A47, 0x9A48, 0xB30B, 0xE491,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC50,
-    0xF471, 0xEC30, 0xF471, 0xE3CF, 0xBA89, 0xEC0F, 0xF491, 0xEC50,
-    0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE471, 0xE470,
-    0xEC71, 0xF471, 0xF471, 0xAAAA, 0xCD13, 0xFF9D, 0xE7DE, 0xE7FE,
-    0xE7FF, 0xE7FF, 0xDFFF, 0xDFFF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFE,
-    0xDFFF, 0xDFFF, 0xD7DF, 0xD7DF, 0x467C, 0x467C, 0x467C, 0x467C,
-    0x467C, 0x469D, 0x3E9D, 0x3E5C, 0x3DD9, 0x5536, 0x63AF, 0x9BCF,
-    0xE4B1, 0xEC70, 0xF470, 0xF450, 0xF450, 0xEC50, 0xEC70, 0xEC90,
-    0xEC91, 0xEC90, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC70,
-    0xBACA, 0xDBAD, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xEC90,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50,
-    0xEC50, 0xEC70, 0xEC50, 0xE450, 0xE471, 0xEC91, 0xB32B, 0x81C5,
-    0xCC0E, 0xA2C9, 0x89E6, 0xE470, 0xEC91, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xEC50, 0xF450, 0xF450, 0xF451,
-    0xCB2C, 0xCB0B, 0xF471, 0xF491, 0xEC50, 0xEC50, 0xEC50, 0xEC50,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xE471, 0xE471, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xE471, 0xE471, 0xE470, 0xF471, 0xEC30, 0xFC92, 0xBB4C,
-    0xB3CE, 0xFF5C, 0xEFDD, 0xE7FE, 0xE7FE, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xD7DF, 0xD7DF, 0xD7DE,
-    0x467C, 0x467C, 0x469D, 0x469D, 0x3E7D, 0x3E7D, 0x363C, 0x35FB,
-    0x3D78, 0x5D16, 0x6B4E, 0xB410, 0xE4B1, 0xEC90, 0xEC50, 0xF450,
-    0xF450, 0xF450, 0xEC70, 0xEC70, 0xEC90, 0xEC90, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xF491, 0xC30B, 0xD36C, 0xEC4F, 0xEC4F,
-    0xEC70, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xEC50, 0xE450,
-    0xE470, 0xE4B1, 0xD44F, 0x9A68, 0x9227, 0x9247, 0xBB8C, 0xE491,
-    0xE471, 0xE470, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC51,
-    0xEC50, 0xEC50, 0xEC50, 0xF471, 0xE3EF, 0xBAAA, 0xDBCE, 0xF491,
-    0xEC50, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC91, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xE491, 0xE490, 0xE490, 0xE490, 0xE490,
-    0xE471, 0xE471, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xF471, 0xEC30, 0xEC71, 0xCBCE, 0x9B2B, 0xEE99, 0xF7FE, 0xE7FE,
-    0xEFFE, 0xE7FE, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FE,
-    0xE7FE, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xD7DF, 0xD7DF, 0x469D, 0x469D, 0x469D, 0x469D,
-    0x3E7D, 0x2E3C, 0x25FB, 0x2579, 0x4599, 0x7557, 0x734E, 0xCC71,
-    0xE4B1, 0xEC70, 0xEC70, 0xF471, 0xF450, 0xF450, 0xEC50, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xF491,
-    0xC34B, 0xCB4B, 0xEC70, 0xE44F, 0xEC90, 0xEC90, 0xEC90, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC50, 0xEC70, 0xEC71, 0xE450, 0xE470, 0xD40F, 0xE4D1, 0xED12,
-    0xE4B1, 0xED12, 0xECD2, 0xDC70, 0xE470, 0xE470, 0xEC71, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xF471, 0xEC50, 0xF450, 0xEC50,
-    0xEC50, 0xCB2C, 0xC30B, 0xEC30, 0xEC51, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC91, 0xEC70, 0xE471, 0xE471, 0xEC71, 0xE491,
-    0xE490, 0xE490, 0xE470, 0xE470, 0xE471, 0xE471, 0xE471, 0xE471,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC51, 0xF471, 0xEC71, 0xDC30,
-    0x9AAA, 0xD5B5, 0xFFDD, 0xEFFE, 0xEFFE, 0xE7FE, 0xE7DF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FE, 0xE7FE, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0x361B, 0x3E3C, 0x3E5C, 0x363C, 0x2E1B, 0x261B, 0x261C, 0x35FC,
-    0x663C, 0x8598, 0x834E, 0xCC71, 0xE4B1, 0xE44F, 0xDC0F, 0xDBEE,
-    0xEC4F, 0xF470, 0xEC70, 0xEC71, 0xEC70, 0xEC50, 0xEC70, 0xEC70,
-    0xF490, 0xF470, 0xEC50, 0xF4B1, 0xE44F, 0xBB2B, 0xE44F, 0xE470,
-    0xEC8F, 0xEC6F, 0xEC90, 0xEC70, 0xEC50, 0xEC70, 0xEC70, 0xEC70,
-    0xF471, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC70, 0xEC70, 0xE450,
-    0xDC50, 0xB30A, 0x8A06, 0xB32B, 0xBB6C, 0xB32B, 0xA2A9, 0xCBAD,
-    0xE450, 0xE470, 0xEC71, 0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC91, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xF470, 0xEC50, 0xEC30, 0xF471, 0xEC10, 0xBA8A, 0xD36D,
-    0xF471, 0xF471, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xE470, 0xEC91,
-    0xEC71, 0xE471, 0xE471, 0xE490, 0xE490, 0xE490, 0xE470, 0xE470,
-    0xEC71, 0xE471, 0xE471, 0xE471, 0xE471, 0xE471, 0xEC71, 0xEC71,
-    0xEC50, 0xEC51, 0xF451, 0xEC91, 0xA2EB, 0xCCF2, 0xFFBD, 0xEFFE,
-    0xE7FE, 0xE7FF, 0xE7DF, 0xEFFF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xD7FF, 0xCFDF, 0xCFDE, 0x35FA, 0x35DA, 0x35D9, 0x2DFA,
-    0x2E1A, 0x261B, 0x2DFB, 0x35BA, 0x65BA, 0x74B5, 0x8B6E, 0xD470,
-    0xE4B0, 0xE44F, 0xC32B, 0xC30B, 0xEC0E, 0xEC4F, 0xEC70, 0xEC70,
-    0xEC71, 0xE450, 0xEC70, 0xF491, 0xF491, 0xF470, 0xEC70, 0xF4D1,
-    0xBB8C, 0x6922, 0xA2C8, 0xED10, 0xECCF, 0xE4AF, 0xE44E, 0xE46F,
-    0xEC90, 0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xF471, 0xEC70, 0xE450,
-    0xEC71, 0xEC91, 0xE450, 0xDC4F, 0xECD2, 0xDC70, 0xBB4C, 0xA2C9,
-    0x9207, 0x9A48, 0xB2EA, 0xDC2F, 0xE450, 0xE470, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC91, 0xEC90, 0xEC90, 0xEC70, 0xEC90, 0xEC90, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC50, 0xF471, 0xEC50,
-    0xEC50, 0xEC30, 0xCB2C, 0xBAAA, 0xEC30, 0xF491, 0xEC50, 0xEC50,
-    0xEC50, 0xEC70, 0xEC91, 0xE470, 0xEC71, 0xEC71, 0xE470, 0xEC70,
-    0xE490, 0xE490, 0xE470, 0xE470, 0xEC71, 0xEC71, 0xE471, 0xE471,
-    0xE471, 0xE471, 0xE470, 0xE470, 0xEC71, 0xF471, 0xF451, 0xF471,
-    0xB32C, 0xBC50, 0xFF9D, 0xF7DE, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7DF,
-    0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF, 0xE7FF,
-    0xE7FF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xCFFF, 0xCFDF, 0xCFDF, 0xCFDF, 0xC7BF, 0xC79E, 0xBF9E,
-    0x6F3E, 0x66FD, 0x56BC, 0x465A, 0x3E3A, 0x35FA, 0x35DA, 0x3D99,
-    0x6DB8, 0x7452, 0x9B8E, 0xE490, 0xEC90, 0xEC2F, 0xC2EA, 0xCB2C,
-    0xEC2F, 0xF450, 0xF470, 0xEC70, 0xEC71, 0xE450, 0xEC71, 0xEC71,
-    0xF491, 0xF471, 0xE450, 0xE4B1, 0x7184, 0x6183, 0x7A85, 0xABE9,
-    0xE52F, 0xE4EF, 0xE4CF, 0xE4AF, 0xE48F, 0xEC90, 0xEC50, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC92, 0xEC71, 0xE471, 0xE451, 0xE470,
-    0xE491, 0xECD2, 0xECD2, 0xE4B2, 0xE4B1, 0xECD2, 0xECB1, 0xEC91,
-    0xE470, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC91,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC90, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC91, 0xEC91, 0xEC91,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xE450, 0xEC91, 0xEC70, 0xEC30, 0xEC30, 0xE40F, 0xBAA9,
-    0xD36D, 0xF450, 0xF450, 0xEC70, 0xEC91, 0xEC70, 0xEC91, 0xE470,
-    0xEC71, 0xEC71, 0xE470, 0xEC70, 0xE490, 0xE490, 0xE471, 0xE471,
-    0xEC71, 0xE471, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE470, 0xEC70,
-    0xEC91, 0xF471, 0xF451, 0xF491, 0xC3AE, 0xA38D, 0xFF3C, 0xF7DE,
-    0xE7FF, 0xDFFF, 0xE7FF, 0xE7FF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF,
-    0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xD7FF, 0xCFFF, 0xCFDF, 0xC7DF, 0xC7BF, 0xBFBF, 0xBF9F, 0xBF9E,
-    0xB79E, 0xB79E, 0xAF7E, 0xAF7D, 0x8FDF, 0x8FDF, 0x8FDF, 0x87BF,
-    0x777E, 0x6F5E, 0x6F3E, 0x7EFD, 0xAF3E, 0x94D3, 0xA38D, 0xE470,
-    0xEC6F, 0xEC2F, 0xDBAE, 0xE3CE, 0xF450, 0xF44F, 0xEC4F, 0xEC70,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xE42F, 0xF491, 0xE450, 0xD470,
-    0x4080, 0x9BCB, 0xBD0D, 0x6A82, 0xA3E8, 0xD52D, 0xDD2F, 0xD48E,
-    0xDC8F, 0xE4AF, 0xEC90, 0xEC70, 0xEC70, 0xE430, 0xEC51, 0xEC92,
-    0xEC92, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xE491, 0xE491, 0xE491,
-    0xE491, 0xE491, 0xE491, 0xE471, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xEC70,
-    0xEC70, 0xEC91, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE471, 0xEC70, 0xEC70, 0xEC50,
-    0xEC50, 0xEC50, 0xF471, 0xD38D, 0xC2CA, 0xE3EE, 0xF470, 0xF470,
-    0xF490, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70,
-    0xEC70, 0xE490, 0xE491, 0xE491, 0xEC71, 0xE471, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC91, 0xF471, 0xF471, 0xEC71,
-    0xD3EF, 0x9AEB, 0xEEBA, 0xEFDE, 0xDFFF, 0xDFFF, 0xDFFF, 0xDFFF,
-    0xDFFF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF,
-    0xCFFF, 0xCFDF, 0xC7DF, 0xC7DF, 0xBFBF, 0xBFBF, 0xB7BE, 0xB79E,
-    0xAF7E, 0xAF5E, 0xA75D, 0xA75D, 0x9F5D, 0x9F5D, 0xA75D, 0x9F5D,
-    0xAFFF, 0xA7FF, 0xA7FF, 0x9FDF, 0x9FFF, 0x97FF, 0x9FFF, 0xAFBF,
-    0xCFBE, 0xA513, 0xAB6C, 0xEC90, 0xEC6F, 0xF46F, 0xF471, 0xF471,
-    0xF470, 0xEC70, 0xE44F, 0xE470, 0xEC91, 0xEC71, 0xEC51, 0xEC51,
-    0xF471, 0xF471, 0xECB2, 0xC3EE, 0x3060, 0x7B48, 0xCE91, 0xA54A,
-    0x6B63, 0x83A5, 0xB4CB, 0xD54F, 0xDD0F, 0xDCAF, 0xE46F, 0xEC70,
-    0xE450, 0xEC71, 0xE431, 0xE430, 0xEC51, 0xEC71, 0xEC71, 0xF491,
-    0xF491, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC91, 0xE471,
-    0xEC71, 0xEC71, 0xEC72, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC90,
-    0xEC90, 0xEC90, 0xEC90, 0xEC90, 0xEC90, 0xEC90, 0xEC90, 0xEC90,
-    0xEC70, 0xEC70, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xE471, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC50, 0xEC50, 0xF450, 0xF450, 0xF471, 0xEC50,
-    0xCB0B, 0xD34C, 0xF471, 0xF450, 0xEC30, 0xEC70, 0xEC91, 0xE471,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC91, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xE470, 0xEC70,
-    0xEC71, 0xEC71, 0xF471, 0xEC50, 0xDC10, 0x92AA, 0xDDF7, 0xEFBE,
-    0xDFFE, 0xD7FF, 0xD7FF, 0xD7FF, 0xD7FF, 0xCFFF, 0xCFFF, 0xC7FF,
-    0xC7FF, 0xC7DF, 0xC7DF, 0xC7DF, 0xBFDF, 0xBFBF, 0xB79E, 0xAF7E,
-    0xAF7E, 0xA77E, 0xA77E, 0x9F5E, 0x9F3D, 0x973D, 0x971D, 0x8F1D,
-    0x8F1D, 0x973D, 0x973D, 0x975D, 0xB7FF, 0xB7FF, 0xB7FF, 0xB7FF,
-    0xAFFF, 0xAFFF, 0xAFDF, 0xB79E, 0xD77D, 0xB513, 0xB38C, 0xF4B0,
-    0xF46F, 0xF46F, 0xEC70, 0xEC70, 0xF491, 0xF490, 0xE48F, 0xE490,
-    0xEC91, 0xE471, 0xEC51, 0xEC51, 0xF471, 0xEC91, 0xDC30, 0xB3AD,
-    0x30E0, 0x2140, 0x8D09, 0xBECF, 0xB62C, 0x7C25, 0x62E1, 0x8BA6,
-    0xBCCC, 0xDD4F, 0xED31, 0xE4B0, 0xE44F, 0xE450, 0xEC71, 0xEC51,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xF471, 0xF491, 0xEC91,
-    0xE470, 0xEC70, 0xEC91, 0xEC92, 0xEC71, 0xEC71, 0xEC72, 0xEC92,
-    0xEC91, 0xEC91, 0xEC90, 0xEC90, 0xEC70, 0xEC90, 0xEC90, 0xEC90,
-    0xEC90, 0xEC90, 0xEC70, 0xEC90, 0xEC70, 0xEC70, 0xEC90, 0xEC90,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC50, 0xEC50,
-    0xEC50, 0xF471, 0xEC70, 0xF470, 0xDBAE, 0xBACA, 0xE3CE, 0xF451,
-    0xF450, 0xF450, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xF471, 0xEC50,
-    0xDC10, 0x9AAB, 0xC554, 0xEF9D, 0xD7DE, 0xC7FF, 0xC7FF, 0xC7FF,
-    0xC7DF, 0xC7DF, 0xBFDE, 0xBFDE, 0xBFDF, 0xB7BF, 0xB7BF, 0xB7BF,
-    0xB7BF, 0xAF9F, 0xA77E, 0x9F5D, 0x9F3D, 0x973D, 0x975D, 0x973D,
-    0x8F3D, 0x8F3D, 0x871D, 0x871D, 0x871D, 0x871D, 0x873D, 0x873D,
-    0xB7FE, 0xB7FE, 0xB7DF, 0xB7DE, 0xB7DE, 0xB7BE, 0xB7BE, 0xBF9E,
-    0xDF7D, 0xBD34, 0xAB2B, 0xE44F, 0xF44F, 0xF470, 0xF470, 0xEC50,
-    0xE470, 0xECB0, 0xE490, 0xE470, 0xE471, 0xEC92, 0xF472, 0xEC51,
-    0xEC51, 0xD3AE, 0xAB2B, 0xA3AC, 0x2900, 0x4AE4, 0x4B43, 0x8569,
-    0xBEEE, 0xBEAD, 0xA589, 0x73A2, 0x62A0, 0x8B64, 0xBC6A, 0xDCEE,
-    0xE4F0, 0xE490, 0xE450, 0xE451, 0xE430, 0xEC70, 0xEC91, 0xEC70,
-    0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xEC71, 0xE471, 0xE471, 0xE471,
-    0xE471, 0xEC71, 0xEC91, 0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC90, 0xEC90, 0xEC90, 0xE490, 0xEC90, 0xE490,
-    0xEC90, 0xEC90, 0xEC90, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xEC70,
-    0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC50, 0xF491, 0xEC70, 0xEC70,
-    0xEC30, 0xBACA, 0xCB0B, 0xF430, 0xFC51, 0xF451, 0xF471, 0xEC71,
-    0xEC71, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xF471, 0xEC50, 0xE431, 0xA2CB, 0xBCD3, 0xE75C,
-    0xC7BE, 0xBFDE, 0xBFDE, 0xBFBE, 0xBFBE, 0xB7BE, 0xAF9E, 0xAF9E,
-    0xAF9F, 0xA79F, 0xA79E, 0xA77E, 0xA77E, 0x9F7E, 0x975E, 0x973E,
-    0x8F3D, 0x8F3D, 0x8F3E, 0x873D, 0x873D, 0x7F1D, 0x7F1D, 0x7F1D,
-    0x7F1D, 0x7F1D, 0x7F1D, 0x7F1D, 0xB7DE, 0xB7DE, 0xBFDE, 0xBFDE,
-    0xB7DE, 0xB7DE, 0xB7BE, 0xBF7D, 0xDF5D, 0xC595, 0x9B0B, 0xDC2F,
-    0xF450, 0xF450, 0xF470, 0xE450, 0xE46F, 0xECB0, 0xE490, 0xDC4F,
-    0xE450, 0xEC91, 0xEC91, 0xE430, 0xBB2C, 0xAB0B, 0xCC91, 0x8309,
-    0x4202, 0xBE71, 0x84EB, 0x32A1, 0x74A8, 0xB66E, 0xCF0F, 0xBE4C,
-    0xA527, 0x7381, 0x6AC0, 0x8B65, 0xC48C, 0xDCF0, 0xED12, 0xE4D1,
-    0xE490, 0xE470, 0xE44F, 0xE44F, 0xEC70, 0xEC70, 0xEC91, 0xEC50,
-    0xEC71, 0xE450, 0xE471, 0xEC91, 0xE471, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC90, 0xEC90,
-    0xEC90, 0xE490, 0xE490, 0xE490, 0xEC90, 0xE490, 0xEC90, 0xEC90,
-    0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70,
-    0xEC70, 0xEC90, 0xEC90, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC91, 0xEC91, 0xEC70,
-    0xEC71, 0xEC91, 0xEC70, 0xEC91, 0xEC50, 0xD36D, 0xBAAA, 0xE3AE,
-    0xFC51, 0xF451, 0xF450, 0xF471, 0xEC71, 0xEC70, 0xEC70, 0xEC71,
-    0xEC71, 0xE471, 0xEC71, 0xEC71, 0xE450, 0xEC70, 0xEC71, 0xEC91,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC50, 0xEC70, 0xF451,
-    0xEC51, 0xAACB, 0xB472, 0xDF3C, 0xBF9D, 0xAFBE, 0xAFBE, 0xAF9E,
-    0xAF9E, 0xAF7E, 0xA77E, 0x9F7E, 0x9F7E, 0x977E, 0x977E, 0x975E,
-    0x975E, 0x8F3D, 0x8F3D, 0x873D, 0x873E, 0x873E, 0x7F3E, 0x7F1D,
-    0x771D, 0x771D, 0x771D, 0x771D, 0x771D, 0x771D, 0x771D, 0x771D,
-    0xB7DE, 0xB7DE, 0xB7DE, 0xB7DE, 0xB7DE, 0xB7DE, 0xB7DE, 0xBFBE,
-    0xD77D, 0xD679, 0x9B2C, 0xCBCE, 0xF471, 0xF450, 0xF470, 0xEC6F,
-    0xEC6F, 0xEC8F, 0xE46F, 0xE450, 0xECB2, 0xEC91, 0xCBEE, 0xAB2B,
-    0xAB4B, 0xDD33, 0xDDB4, 0x41A2, 0x6BC7, 0xC6D3, 0x84AD, 0x42C7,
-    0x3A65, 0x5306, 0x950A, 0xC68E, 0xCEED, 0xC68A, 0xA566, 0x8403,
-    0x6280, 0x72C3, 0xAC0B, 0xD4CF, 0xE532, 0xE512, 0xE4D1, 0xDC50,
-    0xE471, 0xEC91, 0xEC91, 0xEC70, 0xEC90, 0xEC90, 0xE470, 0xEC90,
-    0xE470, 0xE470, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC50,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xE470, 0xE470, 0xEC90,
-    0xEC91, 0xEC90, 0xEC90, 0xE470, 0xEC70, 0xEC91, 0xEC71, 0xEC71,
-    0xEC91, 0xEC91, 0xEC70, 0xEC70, 0xEC70, 0xEC90, 0xEC70, 0xE470,
-    0xEC70, 0xE470, 0xEC70, 0xEC90, 0xEC70, 0xE470, 0xEC71, 0xEC71,
-    0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC71, 0xEC70, 0xEC71, 0xEC71,
-    0xEC91, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70,
-    0xE490, 0xEC90, 0xEC90, 0xECB1, 0xEC91, 0xEC70, 0xEC91, 0xE470,
-    0xEC50, 0xE42F, 0xD34C, 0xCAEB, 0xEBEF, 0xFC71, 0xF450, 0xF450,
-    0xEC70, 0xEC70, 0xEC71, 0xEC91, 0xEC71, 0xE450, 0xEC71, 0xE450,
-    0xE450, 0xE430, 0xEC50, 0xEC91, 0xEC71, 0xEC70, 0xEC71, 0xEC71,
-    0xEC50, 0xEC50, 0xF471, 0xF451, 0xF451, 0xAACC, 0xAC51, 0xD6FB,
-    0xB75D, 0xA79D, 0xA79E, 0x9F9E, 0x9F7E, 0x9F5D, 0x975D, 0x977E,
-    0x8F5E, 0x8F5E, 0x8F3E, 0x873D, 0x871D, 0x871D, 0x873D, 0x7F3D,
-    0x7F1D, 0x771D, 0x76FD, 0x76FD, 0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD,
-    0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD, 0xBFDF, 0xBFDE, 0xBFBE, 0xBFDE,
-    0xBFBE, 0xB7DE, 0xB7DE, 0xBFDE, 0xCF9E, 0xE71C, 0x9B8E, 0xBB6E,
-    0xEC71, 0xEC50, 0xF490, 0xF490, 0xF48F, 0xF4B0, 0xEC90, 0xE470,
-    0xD42F, 0xB36C, 0x9B2B, 0xB42E, 0xE616, 0xFF3B, 0xA4D0, 0x2140,
-    0xA5CF, 0xADF0, 0x530A, 0x8412, 0x83F2, 0x528A, 0x31C3, 0x6BA6,
-    0xADEC, 0xC68C, 0xC6AC, 0xC6AC, 0xADAA, 0x8405, 0x62A1, 0x6241,
-    0x8B47, 0xB44C, 0xDD30, 0xE532, 0xE4B1, 0xE4B1, 0xE470, 0xDC50,
-    0xE470, 0xE490, 0xEC90, 0xE46F, 0xEC90, 0xE470, 0xEC70, 0xEC71,
-    0xEC71, 0xE451, 0xEC51, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71,
-    0xEC70, 0xE470, 0xE470, 0xEC90, 0xEC90, 0xEC91, 0xEC91, 0xEC91,
-    0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91,
-    0xEC91, 0xEC91, 0xEC90, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC50, 0xEC50, 0xEC71, 0xEC71, 0xE470, 0xECB0, 0xEC90, 0xE44F,
-    0xE44F, 0xE470, 0xEC91, 0xEC70, 0xE450, 0xEC70, 0xE3EE, 0xC30B,
-    0xD36C, 0xF450, 0xFC70, 0xF450, 0xEC4F, 0xEC70, 0xEC91, 0xEC70,
-    0xEC71, 0xEC71, 0xEC91, 0xE430, 0xE42F, 0xEC70, 0xEC91, 0xEC70,
-    0xE430, 0xE450, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xF471, 0xF450,
-    0xF451, 0xAAEC, 0xA410, 0xCEDB, 0xAF3C, 0x9F7D, 0x977E, 0x975E,
-    0x975D, 0x8F3D, 0x8F3D, 0x8F5D, 0x873D, 0x873E, 0x7F3E, 0x7F3E,
-    0x7F1D, 0x7F3D, 0x7F3D, 0x771D, 0x771D, 0x76FD, 0x6EFD, 0x6EDC,
-    0x6EDC, 0x66DD, 0x66DD, 0x66FD, 0x66FD, 0x66FD, 0x66FD, 0x66FD,
-    0xBFBF, 0xBFBE, 0xBFBF, 0xBFBE, 0xBFBE, 0xB7BE, 0xB7DE, 0xBFDF,
-    0xC79E, 0xE77E, 0xBD14, 0x8A8A, 0xD3F0, 0xF4B2, 0xF491, 0xF490,
-    0xF48F, 0xEC8F, 0xDC0F, 0xB34C, 0x9AEA, 0xA3CD, 0xC532, 0xEEF9,
-    0xEF7B, 0xDF3A, 0x5B49, 0x42C6, 0xC6D3, 0x7C6C, 0x6B2F, 0x8395,
-    0x8BB7, 0x93D6, 0x72EF, 0x41C7, 0x4224, 0x73C8, 0xADCD, 0xBE8E,
-    0xC6CD, 0xC6ED, 0xA5A8, 0x8423, 0x6B21, 0x5A60, 0x7B04, 0xA3C9,
-    0xCCAF, 0xE532, 0xED12, 0xE4D1, 0xE4B0, 0xE4B0, 0xEC90, 0xE44F,
-    0xE44F, 0xEC90, 0xEC90, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC91, 0xEC90,
-    0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91,
-    0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC91, 0xEC71, 0xEC70,
-    0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC70, 0xEC71, 0xEC91, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC50,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70,
-    0xEC91, 0xEC70, 0xE450, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xE450,
-    0xEC90, 0xECD1, 0xF512, 0xD3CD, 0xBB0A, 0xD3CD, 0xEC4F, 0xF490,
-    0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC70, 0xEC71, 0xEC70, 0xD3CE,
-    0xCB4C, 0xDC0F, 0xEC70, 0xEC70, 0xEC50, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC70, 0xEC50, 0xEC31, 0xB2EC, 0x9BF0, 0xC6BA,
-    0xA71C, 0x975D, 0x8F5D, 0x8F3D, 0x873D, 0x873D, 0x871D, 0x7F3D,
-    0x7F1D, 0x771D, 0x771D, 0x771D, 0x771D, 0x771D, 0x771D, 0x771D,
-    0x6F1D, 0x6EFD, 0x66DD, 0x66DC, 0x66BC, 0x66DC, 0x66DC, 0x66DC,
-    0x66DC, 0x5EDC, 0x66DC, 0x5EDC, 0xBFBF, 0xBFBF, 0xBFBF, 0xBFBE,
-    0xBFBE, 0xB7BE, 0xB7DE, 0xB7DE, 0xC7BF, 0xD75D, 0xE6FC, 0xA3CF,
-    0xAB2D, 0xCBCF, 0xDC30, 0xD40E, 0xCBAC, 0xB32A, 0xA2EA, 0xABAD,
-    0xCD13, 0xEED9, 0xEF5B, 0xE77B, 0xD77B, 0xC6F8, 0x2203, 0x640A,
-    0xBEB3, 0x638A, 0x8393, 0x8B58, 0x9339, 0x937A, 0x9398, 0x8B94,
-    0x72EF, 0x41C6, 0x4224, 0x7408, 0xAE0C, 0xC6EE, 0xC6EC, 0xB66A,
-    0xB62A, 0xAD89, 0x8405, 0x62A1, 0x6A62, 0x8B06, 0xAC0A, 0xCCAE,
-    0xE531, 0xED31, 0xE4D0, 0xDC6F, 0xE48F, 0xE46F, 0xE44F, 0xE44F,
-    0xE450, 0xE430, 0xE431, 0xEC71, 0xEC71, 0xEC91, 0xEC91, 0xEC91,
-    0xEC91, 0xEC91, 0xEC70, 0xE470, 0xEC91, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC70, 0xEC71,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71, 0xEC70, 0xEC50, 0xEC70,
-    0xEC70, 0xEC70, 0xEC91, 0xEC70, 0xEC90, 0xEC90, 0xEC90, 0xEC90,
-    0xE470, 0xE490, 0xECD1, 0xED11, 0xED32, 0xDCD0, 0xD4AF, 0xB36A,
-    0x9AA7, 0xB349, 0xD40D, 0xEC8F, 0xEC90, 0xEC70, 0xEC70, 0xEC70,
-    0xEC70, 0xEC71, 0xEC50, 0xD3CE, 0xB2AA, 0xD38D, 0xEC50, 0xEC50,
-    0xEC50, 0xEC71, 0xEC71, 0xEC51, 0xEC71, 0xEC70, 0xEC50, 0xEC50,
-    0xEC31, 0xB30D, 0x93CF, 0xBE9A, 0x9F1C, 0x8F5D, 0x873D, 0x7F3D,
-    0x7F1D, 0x7F1D, 0x7F1D, 0x7F1D, 0x771D, 0x771D, 0x771D, 0x771D,
-    0x6EFD, 0x6F1D, 0x6F1D, 0x6EFD, 0x6EFD, 0x66FD, 0x66DC, 0x5EDC,
-    0x5EBC, 0x5EBC, 0x5EDC, 0x5EDC, 0x5EDC, 0x5EDC, 0x5EDC, 0x5EDC,
-    0xB7BE, 0xB7BE, 0xB7BF, 0xB7BF, 0xB7BE, 0xB7BE, 0xAFBE, 0xAFBE,
-    0xB79E, 0xC75D, 0xDF5E, 0xD639, 0xA3D0, 0x9B0C, 0x9AEB, 0x9AEB,
-    0xA32B, 0xB40E, 0xC513, 0xE678, 0xF77C, 0xE77C, 0xD77B, 0xC77B,
-    0xC77C, 0x95F5, 0x11C2, 0x8D4F, 0xAE12, 0x6B4C, 0x9396, 0x9339,
-    0x931A, 0x931B, 0x9339, 0x9358, 0x9BB8, 0x8B94, 0x628C, 0x49E6,
-    0x4A85, 0x73E7, 0xA5AB, 0xB64C, 0xB66B, 0xC6CC, 0xC6AB, 0xB609,
-    0x9D07, 0x7BA2, 0x5A80, 0x6261, 0x8B46, 0xB44C, 0xCCAF, 0xDD31,
-    0xE531, 0xE4F0, 0xE4B0, 0xE48F, 0xE490, 0xE470, 0xEC51, 0xEC71,
-    0xE471, 0xDC70, 0xDC4F, 0xE470, 0xE490, 0xE470, 0xE470, 0xEC90,
-    0xEC90, 0xEC70, 0xEC70, 0xEC90, 0xEC91, 0xEC91, 0xEC70, 0xEC70,
-    0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xF471, 0xF471,
-    0xEC51, 0xEC51, 0xEC51, 0xEC71, 0xEC71, 0xEC71, 0xEC71, 0xEC51,
-    0xEC71, 0xEC70, 0xEC70, 0xF471, 0xEC71, 0xEC70, 0xEC50, 0xEC70,
-    0xEC70, 0xEC71, 0xEC91, 0xEC91, 0xEC70, 0xE470, 0xEC90, 0xE470,
-    0xEC90, 0xEC90, 0xE4B0, 0xE4B0, 0xE4F0, 0xE531, 0xDCEF, 0xC48D,
-    0xA3A9, 0x7AA4, 0x6202, 0x7263, 0x9B67, 0x9B47, 0xBBA9, 0xE4AE,
-    0xEC8F, 0xEC4F, 0xEC70, 0xEC70, 0xEC70, 0xEC50, 0xEC71, 0xE430,
-    0xD38D, 0xE42F, 0xF491, 0xF491, 0xF471, 0xF471, 0xEC71, 0xEC71,
-    0xEC71, 0xEC70, 0xEC50, 0xEC50, 0xEC51, 0xB34D, 0x93CF, 0xB69A,
-    0x971C, 0x873D, 0x7F3D, 0x7F1D, 0x771D, 0x771D, 0x771D, 0x76FD,
-    0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD, 0x66FD,
-    0x66DD, 0x66DC, 0x5EDC, 0x5EBC, 0x56BB, 0x56BB, 0x5EBC, 0x5EBC,
-    0x5EBC, 0x5EBC, 0x5EBC, 0x5EBC, 0xAF9E, 0xAF9E, 0xA79E, 0xA79E,
-    0xAFBE, 0xAFBE, 0xA7BE, 0xA79E, 0xAF7E, 0xBF7E, 0xC75D, 0xE79E,
-    0xDE9B, 0xCD76, 0xC4F3, 0xC534, 0xD5F6, 0xDE99, 0xDF1B, 0xDF5C,
-    0xD77D, 0xC77C, 0xC7DD, 0xB79C, 0xC79D, 0x648F, 0x11C2, 0x9DD1,
-    0x950F, 0x6B0D, 0x9376, 0x9B1A, 0x9B3B, 0x9B3B, 0x9B3B, 0x9B3A,
-    0x92F8, 0x8AF6, 0x9396, 0x8B93, 0x730E, 0x5267, 0x4244, 0x52E4,
-    0x7426, 0x9549, 0xB62B, 0xC6ED, 0xCEED, 0xC68C, 0xB5EB, 0x94A7,
-    0x7B84, 0x62A2, 0x5A21, 0x6222, 0x82E6, 0x9BA9, 0xC46C, 0xD4EF,
-    0xE510, 0xED32, 0xF532, 0xED12, 0xE4B1, 0xDCB1, 0xDC90, 0xDC6F,
-    0xDC6F, 0xDC90, 0xE490, 0xE46F, 0xEC90, 0xE470, 0xE470, 0xE470,
-    0xE470, 0xE470, 0xE470, 0xE470, 0xEC70, 0xEC70, 0xEC50, 0xEC50,
-    0xEC50, 0xEC50, 0xEC50, 0xEC70, 0xEC50, 0xEC70, 0xEC50, 0xE450,
-    0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC50, 0xEC70,
-    0xEC70, 0xEC50, 0xE450, 0xE470, 0xE470, 0xE470, 0xE470, 0xE470,
-    0xE490, 0xE4B1, 0xECD1, 0xE4D1, 0xED11, 0xE4F1, 0xE510, 0xD4CE,
-    0xB3EA, 0x8B06, 0x6A42, 0x5A00, 0x6281, 0x7BC6, 0x9CEA, 0xC5CE,
-    0xD60F, 0x9386, 0x92E4, 0xCC0A, 0xECAF, 0xF490, 0xEC70, 0xEC70,
-    0xEC50, 0xEC50, 0xEC71, 0xEC50, 0xEC30, 0xEC70, 0xF471, 0xEC70,
-    0xEC50, 0xEC51, 0xEC51, 0xEC71, 0xEC71, 0xEC70, 0xEC50, 0xEC50,
-    0xEC51, 0xB36E, 0x93F0, 0xB699, 0x971B, 0x7F3C, 0x771D, 0x771D,
-    0x6F1D, 0x6F1D, 0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD, 0x6EFD,
-    0x66FD, 0x66FD, 0x66FD, 0x66DD, 0x5EDC, 0x5EDC, 0x5EBC, 0x56BC,
-    0x569B, 0x56BB, 0x56BB, 0x569B, 0x56BB, 0x569B, 0x569B, 0x569B,
-    0xA77D, 0x9F9E, 0x9F9E, 0x9F9E, 0xA79E, 0xA79E, 0xA79E, 0xA77E,
-    0xA79E, 0xA75D, 0xAF7D, 0xBF7D, 0xD77E, 0xDF3D, 0xE75D, 0xE75C,
-    0xDF7C, 0xCF5C, 0xC75C, 0xBF7C, 0xAF5C, 0xAF9D, 0xB7FE, 0xAF9D,
-    0xB75C, 0x434B, 0x2223, 0xB612, 0x8C6E, 0x6AED, 0x9336, 0x9AF9,
-    0x9B19, 0xA35A, 0x9B1A, 0x9B1B, 0x9B1A, 0x92F9, 0x9338, 0x9B77,
-    0x9BD6, 0x93D4, 0x8370, 0x5A8A, 0x4226, 0x3A03, 0x52E4, 0x7407,
-    0x952A, 0xADEC, 0xBE8E, 0xCEEF, 0xC6AE, 0xB5EB, 0x94A6, 0x73A3,
-    0x5AE1, 0x5240, 0x5221, 0x6A83, 0x7AE5, 0x9368, 0xAC0B, 0xC44D,
-    0xCC8F, 0xDCD1, 0xE511, 0xE4F1, 0xE511, 0xED12, 0xED11, 0xE4D0,
-    0xE4B0, 0xE490, 0xE490, 0xE490, 0xE490, 0xE490, 0xE490, 0xE490,
-    0xE470, 0xE470, 0xE470, 0xE470, 0xE450, 0xE470, 0xE471, 0xE471,
-    0xE471, 0xE471, 0xE471, 0xE471, 0xE470, 0xE470, 0xEC71, 0xEC91,
-    0xEC91, 0xE491, 0xE470, 0xE490, 0xE490, 0xE491, 0xE4B1, 0xECD1,
-    0xE4D1, 0xE4D1, 0xE4F1, 0xE4F1, 0xE511, 0xDCF1, 0xD4B0, 0xCC6E,
-    0xABAB, 0x9307, 0x7A84, 0x6242, 0x5A21, 0x5AC2, 0x8406, 0xA58B,
-    0xB66D, 0xBECE, 0xA62C, 0x84C6, 0x6B82, 0x5A60, 0x82E2, 0xAB46,
-    0xDC4D, 0xF490, 0xF490, 0xEC90, 0xEC50, 0xEC70, 0xEC50, 0xEC50,
-    0xEC70, 0xEC50, 0xEC50, 0xEC70, 0xEC51, 0xEC51, 0xEC71, 0xEC71,
-    0xEC91, 0xE470, 0xEC70, 0xEC50, 0xEC51, 0xB36D, 0x9410, 0xAE79,
-    0x8EDB, 0x771C, 0x76FD, 0x6EFD, 0x66FD, 0x66FD, 0x6EFD, 0x6EDD,
-    0x6EFD, 0x66DD, 0x66DD, 0x66DD, 0x66DD, 0x66DD, 0x66FD, 0x5EDD,
-    0x5EBC, 0x5EBC, 0x56BC, 0x56BB, 0x4EBB, 0x4EBB, 0x4EBB, 0x4EBB,
-    0x4EBB, 0x56BB, 0x56BB, 0x56BB, 0x9F7D, 0x9F9E, 0x979E, 0x979E,
-    0x9F7E, 0x9F7E, 0x9F7E, 0x9F7E, 0x9F7E, 0x9F7D, 0x9F7D, 0x9F5D,
-    0xB75D, 0xBF5D, 0xC73C, 0xBF3C, 0xB71B, 0xAF5C, 0xAF9D, 0xAFBE,
-    0x9F7E, 0xA7BE, 0xA7BE, 0xAF9D, 0xAF1C, 0x2247, 0x3284, 0xBE73,
-    0x7BED, 0x730E, 0x9357, 0x9B19, 0xA339, 0x9B19, 0x9B1A, 0x9B1B,
-    0x9AFB, 0x9B1B, 0x9B1A, 0x92F9, 0x9338, 0x9357, 0x9BB7, 0x93D6,
-    0x8BD3, 0x734F, 0x62EB, 0x4225, 0x31E2, 0x42A2, 0x5303, 0x7426,
-    0x9569, 0xB64C, 0xCF0E, 0xCF0F, 0xCECF, 0xB60D, 0xA56B, 0x9488,
-    0x6B44, 0x5A61, 0x5A20, 0x59E0, 0x61E2, 0x7224, 0x82A6, 0x9B69,
-    0xB3EB, 0xC44D, 0xCC8E, 0xDCCF, 0xE4F0, 0xE510, 0xED31, 0xED32,
-    0xF552, 0xF532, 0xED12, 0xED12, 0xECF2, 0xECF2, 0xECD1, 0xECD1,
-    0xECD2, 0xECD2, 0xECF2, 0xECD2, 0xECD2, 0xECD2, 0xECD2, 0xECD2,
-    0xECF2, 0xECF2, 0xECF2, 0xED12, 0xED12, 0xED32, 0xED32, 0xED32,
-    0xE511, 0xE4F1, 0xDCD0, 0xD4B0, 0xCC6F, 0xC42D, 0xB3CB, 0x9B49,
-    0x8AC7, 0x7A65, 0x6A03, 0x59C2, 0x59A0, 0x6262, 0x83A6, 0xA4EA,
-    0xBE0D, 0xC6AF, 0xBE8E, 0xA66C, 0x7506, 0x4BE1, 0x3B40, 0x4380,
-    0x6C21, 0x9D26, 0xC569, 0xA385, 0xB327, 0xDC0D, 0xEC90, 0xF491,
-    0xE450, 0xEC70, 0xEC50, 0xEC70, 0xEC70, 0xEC50, 0xEC50, 0xF471,
-    0xEC70, 0xEC51, 0xEC71, 0xEC71, 0xEC91, 0xE470, 0xEC70, 0xEC50,
-    0xEC70, 0xAB4D, 0x9410, 0xA659, 0x86BB, 0x76FC, 0x6EDC, 0x66DD,
-    0x66FD, 0x66FD, 0x66FD, 0x66DD, 0x66DD, 0x66DD, 0x66DD, 0x66DD,
-    0x5EDD, 0x66DD, 0x5EDD, 0x5EDC, 0x5EBC, 0x56BC, 0x56BC, 0x56BB,
-    0x4EBB, 0x4EBB, 0x4EBB, 0x4EBB, 0x4EBB, 0x4EBB, 0x4EBB, 0x56BB,
-    0x977E, 0x977E, 0x979E, 0x977E, 0x977E, 0x9F7E, 0x977E, 0x977D,
-    0x977D, 0x977D, 0x9F7E, 0x973D, 0x9F5E, 0xA73E, 0xAF3E, 0xA71C,
-    0x9F3C, 0x9F5D, 0x9F9E, 0x9F9E, 0x979E, 0x9F9E, 0x9F7E, 0xA77E,
-    0x9EBB, 0x11E5, 0x3284, 0xBE93, 0x7C0D, 0x6AEE, 0x9377, 0x931A,
-    0x9B1A, 0x9B19, 0x9B1A, 0x9B1A, 0x9B1B, 0x9AFB, 0x9AFA, 0x9AFA,
-    0x9B1A, 0x9B5A, 0x9B59, 0x9378, 0x9B98, 0x9BD6, 0x93D5, 0x8BD2,
-    0x83AF, 0x734B, 0x5AC7, 0x4263, 0x3221, 0x3A81, 0x5BA4, 0x7CA7,
-    0x9549, 0xB64D, 0xC6CE, 0xCEEF, 0xCECF, 0xCE6E, 0xBE0C, 0xAD6B,
-    0x9468, 0x8366, 0x72E4, 0x6A83, 0x6222, 0x59C1, 0x59A1, 0x61C2,
-    0x7A44, 0x8A85, 0x9B08, 0xA349, 0xAB8A, 0xB3AB, 0xBBCC, 0xBBCC,
-    0xBBED, 0xC42E, 0xCC4F, 0xD46F, 0xD470, 0xD490, 0xDC90, 0xDCB1,
-    0xDC90, 0xDC90, 0xD490, 0xD46F, 0xD48F, 0xD48F, 0xCC6F, 0xC42E,
-    0xBC0D, 0xB3CC, 0xABAB, 0x9B49, 0x92E7, 0x8AC6, 0x7224, 0x6182,
-    0x5161, 0x59A2, 0x6202, 0x6A63, 0x72E5, 0x83A7, 0x9C6A, 0xB54C,
-    0xC5EE, 0xD6AF, 0xCEAF, 0xADEB, 0x8D27, 0x6424, 0x4341, 0x32E0,
-    0x4380, 0x5462, 0x7585, 0x9667, 0xAEC9, 0xBECA, 0xCE4A, 0xBD08,
-    0xA324, 0xB327, 0xDC2E, 0xEC91, 0xEC70, 0xEC50, 0xEC70, 0xEC70,
-    0xEC70, 0xEC50, 0xEC50, 0xEC70, 0xEC70, 0xEC71, 0xEC71, 0xEC71,
-    0xEC71, 0xEC91, 0xEC70, 0xEC70, 0xE470, 0xAB6C, 0x8C0F, 0xA659,
-    0x86BB, 0x6EDC, 0x66DD, 0x66DD, 0x66DD, 0x66FD, 0x66FD, 0x66DD,
-    0x66DD, 0x5EDD, 0x5EDD, 0x5EDD, 0x5EDD, 0x5EDD, 0x5EDC, 0x56BC,
-    0x56BB, 0x56BC, 0x56BB, 0x4E9B, 0x4E9B, 0x4E9B, 0x56BC, 0x4E9B,
-    0x4EBB, 0x4EBB, 0x4EBB, 0x4EBB
+    0xFE, 0x54, 0x75, 0xC2, 0x6E, 0xC4, 0x20, 0xC0, 0x25, 0xD4, 0x7A, 0x25, 0x20, 0x28, 0x20, 0xC1,
+    0x25, 0xC3, 0x69, 0xC1, 0x99, 0xBC, 0xA2, 0x67, 0xA6, 0x45, 0x46, 0xC0, 0x6E, 0xC0, 0x5A, 0xC7,
+    0x5A, 0xC0, 0x1B, 0xC1, 0x18, 0x66, 0xC5, 0x18, 0xC0, 0x69, 0x18, 0x76, 0xC3, 0x69, 0xC1, 0x18,
+    0x5A, 0x11, 0x5A, 0x11, 0xC0, 0x0E, 0x6E, 0xC0, 0x65, 0x76, 0x9F, 0xB8, 0x9E, 0xD9, 0x9F, 0xB8,
+    0x7A, 0x71, 0xC0, 0x34, 0xA3, 0x15, 0xA3, 0x46, 0x67, 0x99, 0xBC, 0xAA, 0x32, 0xA2, 0x98, 0x7A,
+    0xC1, 0x6E, 0x99, 0xCB, 0xA4, 0x56, 0xA3, 0x67, 0x66, 0x09, 0xC0, 0x0E, 0x09, 0xC0, 0x6F, 0x6E,
+    0x0E, 0x15, 0x1A, 0x15, 0xC0, 0x66, 0xC0, 0x15, 0x5A, 0xC1, 0x06, 0xC0, 0x0B, 0x51, 0x7B, 0xC0,
+    0x06, 0x6B, 0xC0, 0x01, 0xC0, 0x5A, 0x66, 0xC2, 0x3E, 0x6B, 0xC1, 0x66, 0x39, 0xC2, 0x5A, 0x39,
+    0x3E, 0xC0, 0x39, 0xC1, 0x3E, 0xC0, 0x6E, 0x6B, 0x3E, 0xC1, 0x03, 0x20, 0xC2, 0x6E, 0xC1, 0x20,
+    0x25, 0xC0, 0x20, 0xC0, 0x25, 0xD5, 0x20, 0xC3, 0x25, 0xC4, 0x69, 0xC0, 0x66, 0x99, 0xAB, 0xA3,
+    0x67, 0xA5, 0x46, 0x5A, 0x16, 0x7E, 0x1B, 0xC4, 0x16, 0xC1, 0x1B, 0x18, 0xC0, 0x1B, 0xC1, 0x18,
+    0xC0, 0x66, 0xC4, 0x18, 0xC0, 0x11, 0x18, 0x16, 0xC1, 0x1B, 0x16, 0xC1, 0x1B, 0x18, 0xC1, 0x11,
+    0xC1, 0x5E, 0x07, 0xC0, 0x7A, 0x3F, 0x71, 0x9D, 0xEA, 0x9F, 0xB8, 0xA0, 0xA8, 0x7E, 0x61, 0x4A,
+    0xFE, 0x54, 0x70, 0x4A, 0x46, 0x9B, 0xAB, 0xAC, 0x22, 0xA2, 0x87, 0x06, 0x09, 0x0E, 0xA2, 0x77,
+    0x0E, 0x22, 0x12, 0xC0, 0x7A, 0x0E, 0xC0, 0x0B, 0x15, 0xA2, 0x67, 0x22, 0x1A, 0xC1, 0x15, 0x6F,
+    0x7E, 0xC0, 0x26, 0x1A, 0x5A, 0x03, 0x9D, 0xAA, 0x65, 0x51, 0xC0, 0x66, 0x6F, 0x1E, 0x7F, 0x3E,
+    0x0D, 0xC0, 0x15, 0x6B, 0xC0, 0x5A, 0xC3, 0x0D, 0xC5, 0x19, 0xC1, 0x0D, 0xC2, 0x5A, 0xC0, 0x03,
+    0xC0, 0x3E, 0xC0, 0x5A, 0x20, 0xC0, 0x25, 0xC0, 0x20, 0x25, 0xC0, 0x20, 0xC4, 0x25, 0x20, 0xC0,
+    0x25, 0xD0, 0x20, 0xC4, 0x25, 0x20, 0x25, 0xC1, 0x69, 0xC1, 0x56, 0x98, 0xCC, 0xA5, 0x46, 0xA4,
+    0x56, 0x5A, 0xC0, 0x6E, 0x56, 0xC0, 0x6E, 0xC1, 0x16, 0xC3, 0x18, 0xC1, 0x1B, 0x18, 0xC1, 0x66,
+    0xC4, 0x69, 0x6E, 0x18, 0xC0, 0x1B, 0x16, 0xC0, 0x1B, 0xC0, 0x16, 0x1B, 0xC0, 0x18, 0xC1, 0x59,
+    0x6E, 0xC0, 0x79, 0x66, 0x65, 0x9F, 0xB8, 0x9E, 0xC9, 0x9D, 0xEA, 0x9E, 0xDA, 0x9F, 0xC8, 0xA5,
+    0x85, 0x7F, 0x51, 0x9D, 0x79, 0xA2, 0x26, 0xA2, 0x27, 0x9E, 0x69, 0x41, 0xAA, 0x23, 0xA3, 0x78,
+    0x01, 0x15, 0x55, 0x0B, 0x6B, 0x0B, 0x5A, 0x67, 0x7A, 0x15, 0x1A, 0xC1, 0x6B, 0x1A, 0xC0, 0x26,
+    0x21, 0x12, 0x0D, 0x01, 0x55, 0x51, 0x41, 0x9C, 0xAA, 0x9D, 0xAA, 0x51, 0x76, 0x55, 0x7A, 0x56,
+    0xC0, 0x21, 0x6F, 0x7F, 0xA2, 0x76, 0x7F, 0xA2, 0x67, 0xC3, 0x7F, 0xC1, 0x56, 0x38, 0xC0, 0x6F,
+    0x69, 0xC0, 0x04, 0x6E, 0x7E, 0x66, 0xC1, 0x09, 0x04, 0x3D, 0x5A, 0xC0, 0x55, 0xC0, 0x66, 0x51,
+    0xA5, 0x98, 0xC0, 0x25, 0xC3, 0x20, 0xC4, 0x25, 0x20, 0xC0, 0x25, 0xCF, 0x20, 0xC4, 0x7A, 0x25,
+    0x20, 0xC0, 0x25, 0xC3, 0x54, 0x97, 0xCD, 0xA6, 0x46, 0xA4, 0x56, 0x19, 0xC1, 0x16, 0x7E, 0xC0,
+    0x1B, 0xC0, 0x16, 0xC3, 0x5A, 0xC0, 0x6E, 0xC0, 0x13, 0xC0, 0x18, 0xC0, 0x13, 0xC3, 0x69, 0xC1,
+    0x18, 0x1B, 0x18, 0xC0, 0x1B, 0xC4, 0x18, 0xC0, 0x69, 0x5E, 0x69, 0x76, 0x79, 0x9E, 0xC9, 0x71,
+    0x9C, 0xFA, 0x9F, 0xD9, 0xA2, 0xB7, 0xA2, 0xA7, 0xA3, 0x87, 0x7A, 0xC0, 0x9C, 0x7A, 0x9C, 0x59,
+    0xA4, 0x15, 0x9D, 0x59, 0x4A, 0xA7, 0x26, 0xA3, 0x67, 0x2A, 0x36, 0x69, 0x56, 0xC0, 0x51, 0x5A,
+    0x66, 0x75, 0xC0, 0x07, 0x3F, 0x3A, 0x66, 0x29, 0x1F, 0x66, 0x5A, 0x66, 0x5A, 0x65, 0x65, 0x51,
+    0x51, 0x5A, 0x7B, 0x7A, 0x65, 0xA3, 0x77, 0x7E, 0x6F, 0x66, 0xC1, 0x3C, 0x66, 0xC1, 0x5A, 0x3C,
+    0xC0, 0x6F, 0xA2, 0x77, 0x7E, 0xC1, 0x66, 0x6B, 0x6E, 0xC1, 0x59, 0xC1, 0x7F, 0xC0, 0x24, 0xC0,
+    0x21, 0xC1, 0x5A, 0x7E, 0xC1, 0x1E, 0x20, 0xC0, 0x25, 0xC2, 0x20, 0xC6, 0x25, 0xCD, 0x6E, 0xC1,
+    0x25, 0xC0, 0x20, 0x25, 0x76, 0x20, 0xC0, 0x28, 0x25, 0xC5, 0x2A, 0x9D, 0x99, 0x34, 0xA7, 0x45,
+    0xA2, 0x78, 0x5E, 0x56, 0x19, 0xC1, 0x6E, 0x5A, 0xC0, 0x66, 0xD0, 0x1B, 0xC0, 0x56, 0x6E, 0x1B,
+    0xC4, 0x16, 0xC1, 0x1B, 0x18, 0x69, 0x0A, 0xC0, 0x65, 0x9F, 0xB8, 0x9E, 0xD9, 0x9C, 0xFA, 0x9E,
+    0xD9, 0xA2, 0xC7, 0xA5, 0x86, 0xA2, 0x97, 0x69, 0x55, 0x7B, 0x49, 0x9A, 0x7C, 0xA0, 0x47, 0x9E,
+    0x38, 0x9F, 0x59, 0xA6, 0x26, 0xA0, 0x7A, 0x7E, 0x23, 0x6E, 0x6E, 0xC0, 0x7B, 0x45, 0x66, 0x76,
+    0x55, 0xC0, 0x55, 0x6B, 0x7A, 0x0F, 0x03, 0x57, 0x07, 0xA2, 0x76, 0x20, 0x28, 0xC2, 0xA2, 0x88,
+    0x0B, 0x9C, 0xBB, 0x34, 0xA8, 0x54, 0x7F, 0x66, 0x16, 0xC1, 0x6E, 0x16, 0x5A, 0xC0, 0x6E, 0xC0,
+    0x7B, 0x1B, 0x22, 0x1B, 0x13, 0xC0, 0x22, 0xC0, 0x5A, 0xC0, 0x18, 0x5A, 0xC0, 0x18, 0x6E, 0xC0,
+    0x18, 0xC0, 0x15, 0xC2, 0xA2, 0x66, 0xC1, 0x66, 0x9E, 0xDB, 0xC0, 0x6E, 0xC0, 0x20, 0x25, 0x20,
+    0xC4, 0x25, 0xCE, 0x2A, 0x7A, 0x6B, 0x2D, 0x34, 0xC0, 0x65, 0x6B, 0xC0, 0x28, 0xC0, 0x2F, 0xC2,
+    0x34, 0x2D, 0x25, 0xC0, 0x2A, 0x9C, 0x9A, 0x9A, 0xBB, 0xA7, 0x35, 0x6F, 0xC0, 0x56, 0x6E, 0x19,
+    0xC1, 0x6E, 0x5A, 0x66, 0xD0, 0x69, 0xC0, 0x16, 0x1B, 0xC4, 0x16, 0xC3, 0x5E, 0x69, 0x69, 0x79,
+    0x76, 0x9C, 0xEA, 0x9D, 0xE9, 0x9F, 0xD8, 0x32, 0xA4, 0x96, 0xA3, 0x86, 0x7A, 0x55, 0xC0, 0x55,
+    0x33, 0x46, 0x9A, 0x6A, 0x9F, 0x28, 0xA1, 0x38, 0xA1, 0x49, 0x00, 0x6B, 0x55, 0x6F, 0x7E, 0x07,
+    0xA3, 0x66, 0x56, 0xC0, 0x7A, 0x7F, 0xA2, 0x66, 0x7F, 0x0F, 0x7E, 0xC0, 0x66, 0x17, 0xC0, 0x5A,
+    0x6E, 0x7A, 0xC2, 0x17, 0x1E, 0x9C, 0xBA, 0x97, 0xED, 0xAA, 0x43, 0xA1, 0x98, 0xC2, 0x56, 0x6E,
+    0x5A, 0x1D, 0x22, 0x1A, 0x6E, 0x1D, 0xC1, 0x1A, 0xC0, 0x1D, 0x1A, 0x13, 0x5A, 0xC3, 0x15, 0xC1,
+    0x10, 0x15, 0xC1, 0x12, 0xC0, 0x17, 0xC2, 0x20, 0xC0, 0x25, 0xC0, 0x20, 0x25, 0xC4, 0x7A, 0xC4,
+    0x2F, 0xC3, 0x6E, 0xC0, 0x2D, 0xC3, 0x34, 0xC0, 0x2D, 0x34, 0xC4, 0x2D, 0x2F, 0xC0, 0x28, 0xC0,
+    0x2F, 0x2D, 0x25, 0xC0, 0x6E, 0x9A, 0xAB, 0x9D, 0x9A, 0x08, 0x6F, 0xC0, 0x5A, 0x14, 0x6E, 0xC2,
+    0x5A, 0xC0, 0x6E, 0xC2, 0x16, 0xCB, 0x1B, 0x16, 0xC1, 0x1B, 0xC0, 0x16, 0xC2, 0x14, 0xC0, 0x16,
+    0xC0, 0x5E, 0x69, 0x75, 0x9F, 0xB8, 0x9F, 0xB8, 0x9B, 0xFB, 0x9E, 0xE8, 0xA3, 0xB7, 0x23, 0xA3,
+    0x85, 0xC0, 0x61, 0x6E, 0x3B, 0x2A, 0x36, 0x6F, 0x32, 0xA0, 0x17, 0xA3, 0x16, 0xA5, 0x06, 0xA0,
+    0x6A, 0x6B, 0xC1, 0x6F, 0x61, 0x14, 0xC2, 0x6E, 0x7B, 0x20, 0x14, 0xC2, 0x6B, 0x14, 0x11, 0x19,
+    0xC0, 0x51, 0x0D, 0x14, 0x0F, 0xC0, 0x62, 0x97, 0xED, 0xA7, 0x64, 0xA2, 0x87, 0x67, 0x7A, 0x5E,
+    0xC0, 0x1D, 0x1A, 0xC3, 0x1D, 0xC3, 0x1A, 0x1F, 0x5A, 0x66, 0x10, 0x5A, 0x12, 0xC0, 0x15, 0xC0,
+    0x12, 0x15, 0x12, 0xC1, 0x6E, 0xC4, 0x9E, 0xEB, 0x25, 0xC5, 0x7B, 0xC7, 0x34, 0xCC, 0x2D, 0x34,
+    0xC3, 0x2D, 0x34, 0x28, 0xC0, 0x20, 0x25, 0x28, 0xC0, 0x25, 0xC0, 0x6E, 0x98, 0xBC, 0x5A, 0x10,
+    0x5F, 0x66, 0xC1, 0x19, 0x14, 0x19, 0xC0, 0x5A, 0xC0, 0x1B, 0xC3, 0x16, 0xC0, 0x1B, 0xC0, 0x16,
+    0xC2, 0x1B, 0xC9, 0x16, 0xC1, 0x14, 0x6B, 0x5E, 0x6D, 0xC0, 0x69, 0x9E, 0xC9, 0x9F, 0xB8, 0x9D,
+    0xE9, 0x9C, 0xFA, 0xA2, 0xB7, 0xA5, 0x95, 0x3B, 0x65, 0xC1, 0x6B, 0x3B, 0x36, 0x66, 0x6B, 0x9D,
+    0x69, 0x9E, 0x27, 0xA3, 0x17, 0xA4, 0x07, 0xA1, 0x49, 0x6F, 0x6F, 0x1B, 0x6E, 0xC0, 0x1B, 0x59,
+    0x1B, 0xC0, 0x20, 0x19, 0x5A, 0x11, 0xC3, 0x66, 0x11, 0x25, 0x11, 0x9C, 0xBA, 0x7E, 0xA4, 0x66,
+    0x23, 0x1E, 0x9D, 0xA9, 0x96, 0xEE, 0xA6, 0x76, 0x18, 0x76, 0xC0, 0x6B, 0x18, 0x6B, 0x1A, 0x6F,
+    0xC0, 0x66, 0x1A, 0xC1, 0x7A, 0xC0, 0x56, 0x1A, 0xC0, 0x5A, 0x6E, 0x55, 0x12, 0xC2, 0x6E, 0x12,
+    0xC1, 0x17, 0xC1, 0x14, 0xC2, 0x17, 0x9E, 0xEB, 0x6E, 0xC2, 0x6B, 0x7A, 0x6E, 0xC3, 0x2F, 0xC0,
+    0x34, 0xD5, 0x69, 0xC0, 0x28, 0xC2, 0x2D, 0x28, 0xC0, 0xA2, 0x66, 0x41, 0x96, 0xCD, 0xA4, 0x67,
+    0xA5, 0x56, 0x5A, 0xC0, 0x5A, 0x14, 0x6E, 0x14, 0x19, 0xC0, 0x5A, 0xC0, 0x6E, 0xC3, 0x16, 0xC7,
+    0x1B, 0xC9, 0x16, 0xC0, 0x77, 0x11, 0x6F, 0x16, 0x6E, 0x60, 0x9F, 0xC8, 0x9D, 0xEA, 0x9D, 0xF9,
+    0x9F, 0xD8, 0xA5, 0x85, 0xA4, 0x85, 0x65, 0x69, 0x7A, 0xC0, 0x36, 0xC0, 0x7A, 0x66, 0x6B, 0x9F,
+    0x68, 0x9B, 0x49, 0xA2, 0x17, 0xFE, 0x44, 0x71, 0xA2, 0x38, 0x5B, 0x6F, 0x1B, 0xC3, 0x1D, 0x66,
+    0x1D, 0x69, 0xC0, 0x18, 0xC0, 0x11, 0xC1, 0x7E, 0xC1, 0x51, 0x99, 0xCB, 0x76, 0xA3, 0x67, 0xA6,
+    0x55, 0xC0, 0x62, 0x96, 0xED, 0xA3, 0x97, 0xA6, 0x66, 0x66, 0xC0, 0x5E, 0x6E, 0xC0, 0x1A, 0xC0,
+    0x6E, 0x1A, 0xC6, 0x1C, 0xC0, 0x5A, 0x12, 0x19, 0xC0, 0x5D, 0x17, 0xC4, 0x14, 0xC4, 0x6E, 0x25,
+    0xC3, 0x7B, 0x6E, 0xC4, 0x2F, 0xC0, 0x34, 0x2F, 0x34, 0xCF, 0x2D, 0xC4, 0x28, 0xC3, 0x55, 0xC0,
+    0x2D, 0x9C, 0x99, 0x98, 0xBD, 0xA6, 0x45, 0xA4, 0x57, 0xC1, 0x5A, 0x14, 0xC1, 0x6E, 0xC0, 0x5A,
+    0xC0, 0x6E, 0xC3, 0x16, 0xC7, 0x1B, 0xC9, 0x16, 0xC0, 0x6B, 0x11, 0xA2, 0x67, 0x16, 0x0F, 0x09,
+    0x9D, 0xE9, 0x9C, 0xFA, 0x9F, 0xD8, 0xA4, 0xA5, 0xA3, 0x96, 0x36, 0x59, 0xC1, 0x36, 0x39, 0x36,
+    0xC1, 0x77, 0x49, 0x9B, 0x6A, 0xA0, 0x18, 0xFE, 0x4C, 0x50, 0xA3, 0x18, 0x5B, 0x6F, 0x1B, 0xC2,
+    0x6E, 0x1D, 0xC5, 0x69, 0x11, 0x0C, 0xA2, 0x76, 0xC0, 0x66, 0x9D, 0xA9, 0x99, 0xCB, 0x9C, 0xBB,
+    0xA3, 0x66, 0x03, 0x0F, 0x12, 0x96, 0xEE, 0xA0, 0xA8, 0xA9, 0x54, 0x62, 0xC0, 0x18, 0x6E, 0x1A,
+    0xC0, 0x1F, 0xC0, 0x1A, 0xC6, 0x5E, 0xC0, 0x5A, 0xC1, 0x1E, 0x14, 0xC0, 0x17, 0xC2, 0x14, 0xC2,
+    0x6E, 0xC2, 0x25, 0xC2, 0x6B, 0x7A, 0xC2, 0x6E, 0x2F, 0xC0, 0x34, 0xC0, 0x2F, 0xC1, 0x34, 0xCD,
+    0x2D, 0xC6, 0x65, 0x6B, 0xC1, 0x59, 0x21, 0x2D, 0x99, 0xAB, 0x9B, 0xAB, 0xA8, 0x34, 0xA2, 0x68,
+    0x6E, 0xC0, 0x14, 0xC0, 0x19, 0x14, 0x19, 0xC0, 0x5A, 0xC0, 0x1B, 0x7A, 0x1B, 0xC1, 0x16, 0xC7,
+    0x1B, 0xC3, 0x6E, 0x1B, 0xC5, 0x16, 0xC0, 0x22, 0x1B, 0x70, 0x9F, 0xC8, 0xFE, 0x63, 0xB0, 0x9E,
+    0xD8, 0xA3, 0xB6, 0xA4, 0x95, 0xA2, 0x96, 0x61, 0x6E, 0xC0, 0x5A, 0xC0, 0x36, 0xC2, 0x77, 0x5E,
+    0x9C, 0x69, 0x9D, 0x4A, 0xFE, 0x54, 0x50, 0xA3, 0x17, 0x11, 0x6F, 0x1B, 0x22, 0x1B, 0xC0, 0x5A,
+    0x1D, 0xC5, 0x69, 0xC0, 0x11, 0x1D, 0x16, 0x76, 0x51, 0x9B, 0xBA, 0x9D, 0xBA, 0x07, 0xA6, 0x55,
+    0x0F, 0x1E, 0x96, 0xED, 0x71, 0xAA, 0x54, 0x62, 0xC0, 0x5E, 0x6F, 0x1A, 0xC2, 0x6E, 0x1A, 0xC5,
+    0x1C, 0xC0, 0x19, 0xC1, 0x1E, 0x14, 0x7A, 0xC3, 0x14, 0xC2, 0x6E, 0xC2, 0x9E, 0xFB, 0xC4, 0x7A,
+    0x25, 0xC0, 0x28, 0xC0, 0x6B, 0xC5, 0x34, 0xCD, 0x2D, 0xC4, 0x21, 0xC1, 0x28, 0xC0, 0x59, 0x2D,
+    0x69, 0x97, 0xBD, 0x41, 0x10, 0x5B, 0x6E, 0x14, 0x5E, 0x19, 0xC0, 0x14, 0x19, 0xC0, 0x16, 0xC0,
+    0x1B, 0x7A, 0x1B, 0xC1, 0x16, 0xC6, 0x1B, 0xCC, 0x16, 0x6B, 0x5D, 0x0F, 0x9E, 0xC8, 0x9E, 0xE9,
+    0xFE, 0x73, 0x6E, 0xA1, 0xC7, 0xA7, 0x73, 0x33, 0x75, 0x66, 0xA2, 0x66, 0xC0, 0x33, 0xC0, 0x7A,
+    0x6B, 0x33, 0x36, 0x31, 0x3D, 0x9E, 0x78, 0x9A, 0x5B, 0xFE, 0x5C, 0x0F, 0xA4, 0x07, 0x0A, 0xA1,
+    0x79, 0x67, 0xC0, 0x1B, 0x18, 0x1D, 0xC7, 0x69, 0x11, 0x1D, 0x11, 0xC0, 0x7E, 0x03, 0x12, 0x17,
+    0x5A, 0x0F, 0x1E, 0x97, 0xDC, 0x9D, 0xCB, 0xA9, 0x54, 0x7A, 0x66, 0x5F, 0x6D, 0x5B, 0x1A, 0xC9,
+    0x5E, 0xC1, 0x5A, 0xC0, 0x1E, 0x14, 0x17, 0xC3, 0x14, 0xC2, 0x6E, 0xC2, 0x9E, 0xFB, 0xC5, 0x20,
+    0xC0, 0x25, 0x28, 0xC0, 0x6B, 0xC0, 0x6E, 0xC0, 0x2F, 0x34, 0xC1, 0x2D, 0xC0, 0x34, 0xC8, 0x2D,
+    0xC3, 0x26, 0xC0, 0x66, 0xC0, 0x66, 0x21, 0xC0, 0x56, 0x6E, 0x55, 0x96, 0xDD, 0xA2, 0x68, 0xA9,
+    0x23, 0x56, 0x6F, 0x56, 0x6E, 0x76, 0x19, 0x14, 0x19, 0xC0, 0x16, 0xC0, 0x6E, 0x16, 0x1B, 0xC1,
+    0x16, 0xC6, 0x1B, 0xCC, 0x5B, 0x1B, 0x51, 0x9F, 0xB8, 0x9F, 0xD7, 0x9D, 0xE9, 0x9D, 0xFA, 0xA5,
+    0x94, 0x3F, 0x70, 0x66, 0x7E, 0xC0, 0x5E, 0x6B, 0x6F, 0x36, 0x02, 0x3D, 0xC0, 0x31, 0x3D, 0x45,
+    0x98, 0x7C, 0xFE, 0x63, 0xCF, 0xFE, 0x44, 0x72, 0xA2, 0x37, 0xA1, 0x69, 0x1F, 0xC0, 0x69, 0x1D,
+    0xC7, 0x6E, 0x1D, 0xC1, 0x18, 0xC0, 0x7E, 0xC0, 0x76, 0x6E, 0x1B, 0x18, 0x20, 0x98, 0xED, 0x9B,
+    0xDA, 0xA9, 0x55, 0x7B, 0x66, 0x5E, 0xC0, 0x5E, 0xC3, 0x1A, 0x21, 0x1A, 0x21, 0x1A, 0x21, 0x1A,
+    0x5E, 0xC0, 0x66, 0x19, 0xC1, 0x5D, 0x7A, 0xC2, 0x14, 0xC7, 0x9F, 0xEA, 0xC4, 0x28, 0xC4, 0x6B,
+    0xC0, 0x34, 0xC0, 0x2F, 0x34, 0xC1, 0x69, 0x28, 0x2D, 0x34, 0xC7, 0x2D, 0xC3, 0x69, 0xC1, 0x66,
+    0xC0, 0x51, 0x6F, 0xC0, 0x6E, 0x9D, 0xA9, 0x97, 0xBD, 0xA5, 0x45, 0x15, 0x56, 0x6F, 0x11, 0xC2,
+    0x7A, 0x19, 0x16, 0xC1, 0x1B, 0x16, 0xC0, 0x1B, 0x16, 0xC7, 0x1B, 0xC1, 0x16, 0xC0, 0x1B, 0xC7,
+    0x56, 0x1B, 0x61, 0x9E, 0xD8, 0x9E, 0xE8, 0x9C, 0xFA, 0xA2, 0xC6, 0xA6, 0x85, 0xA1, 0x96, 0x2A,
+    0x7A, 0x39, 0x66, 0x36, 0x02, 0x36, 0x3D, 0xC2, 0x31, 0x3D, 0x2E, 0x98, 0x7C, 0xFE, 0x63, 0xAE,
+    0xA5, 0x06, 0xA3, 0x17, 0xA1, 0x69, 0x67, 0x5A, 0x6D, 0x1D, 0xC8, 0x1A, 0x1D, 0xC2, 0x20, 0x1B,
+    0x7A, 0x59, 0x20, 0x1D, 0x20, 0x9A, 0xCC, 0x98, 0xFC, 0x18, 0x22, 0x66, 0x5E, 0xC0, 0x5E, 0xC1,
+    0x69, 0xC1, 0x66, 0x1A, 0xC3, 0x5A, 0x6E, 0x19, 0xC2, 0x59, 0x14, 0x7A, 0xC1, 0x14, 0xC3, 0x6E,
+    0x14, 0xC1, 0x25, 0xC3, 0x28, 0xC4, 0x6B, 0x6E, 0xC0, 0x69, 0xC0, 0x34, 0xC2, 0x2D, 0x28, 0xC0,
+    0x2D, 0x34, 0xC6, 0x2D, 0xC0, 0x28, 0x2D, 0xC1, 0x65, 0xC0, 0x28, 0x21, 0x9C, 0xAB, 0xA2, 0x76,
+    0x6F, 0x6E, 0x9C, 0xAA, 0x23, 0xA7, 0x44, 0x10, 0x5A, 0x6F, 0x5A, 0x11, 0xC1, 0x19, 0x11, 0xC0,
+    0x16, 0xC0, 0x1B, 0x16, 0xCA, 0x1B, 0xC0, 0x16, 0xC6, 0x1B, 0xC0, 0x16, 0x1B, 0x13, 0x1B, 0x0D,
+    0x3E, 0xFE, 0x73, 0xB0, 0x9E, 0xE8, 0xA5, 0x94, 0x02, 0x65, 0x2A, 0x36, 0x3B, 0x36, 0xC0, 0x3D,
+    0x31, 0x3D, 0xC2, 0x5A, 0x02, 0x3D, 0x98, 0x8C, 0xA0, 0x09, 0xFE, 0x54, 0x31, 0x17, 0x4F, 0x5B,
+    0x66, 0x6D, 0xC0, 0x1D, 0xC0, 0x66, 0xC0, 0x1D, 0x18, 0xC0, 0x1D, 0xC0, 0x18, 0x1D, 0xC2, 0x1B,
+    0xC0, 0x7E, 0x1B, 0x20, 0xC1, 0x9C, 0xBA, 0x27, 0xA9, 0x64, 0x7F, 0x66, 0x5E, 0x6E, 0x5A, 0xCA,
+    0x5E, 0xC0, 0x19, 0xC1, 0x0F, 0xC0, 0x14, 0xC7, 0x6E, 0x14, 0xC1, 0x25, 0xC3, 0x28, 0xC1, 0x2F,
+    0xC0, 0x28, 0xC0, 0x34, 0xC0, 0x2D, 0xC0, 0x34, 0xC1, 0x2D, 0xC1, 0x28, 0x2D, 0x34, 0xC6, 0x2D,
+    0xC0, 0x28, 0x69, 0xC1, 0x1E, 0x21, 0xC0, 0x56, 0x9A, 0xCB, 0x00, 0xA2, 0x76, 0x1E, 0x9A, 0xBB,
+    0x9A, 0xAB, 0xA9, 0x33, 0xA3, 0x57, 0x56, 0x6B, 0x5A, 0xC1, 0x6E, 0xC0, 0x11, 0xC0, 0x16, 0xD6,
+    0x6E, 0x16, 0x1B, 0x16, 0xC0, 0x1B, 0x0F, 0x38, 0x9E, 0xE9, 0xFE, 0x83, 0x8F, 0xA0, 0xD7, 0xA6,
+    0x84, 0x31, 0x2A, 0x36, 0x6E, 0xC0, 0x36, 0x31, 0x6B, 0x3D, 0xC0, 0x5A, 0x02, 0x3A, 0xC0, 0x3D,
+    0xC0, 0x99, 0x8C, 0x9F, 0x19, 0xFE, 0x54, 0x31, 0xA4, 0x06, 0xA1, 0x59, 0x5A, 0x57, 0x1A, 0xC0,
+    0x1D, 0xC0, 0x66, 0x7E, 0x1D, 0x18, 0xC0, 0x1D, 0xC1, 0x20, 0x1D, 0x18, 0xC0, 0x1B, 0x20, 0x1B,
+    0x7E, 0x1D, 0xC0, 0x20, 0x0A, 0x97, 0xFD, 0xA5, 0x76, 0xA3, 0x87, 0xC0, 0x5A, 0xC0, 0x5E, 0xC9,
+    0x6E, 0x1C, 0xC0, 0x5A, 0x12, 0x19, 0x0F, 0xC0, 0x6E, 0xC7, 0x6E, 0x14, 0xC1, 0x9E, 0xFB, 0x6E,
+    0xC0, 0x20, 0xC0, 0x28, 0xC0, 0x2F, 0xC4, 0x34, 0xC1, 0x69, 0xCC, 0x34, 0xC0, 0x2D, 0xC0, 0x28,
+    0x21, 0xC1, 0x1E, 0x66, 0x21, 0xC0, 0x19, 0x1E, 0x19, 0x1E, 0x97, 0xCD, 0x50, 0xAA, 0x14, 0xC0,
+    0x5F, 0xC0, 0x16, 0x11, 0x16, 0xC1, 0x11, 0xC1, 0x16, 0xC1, 0x6E, 0x16, 0xCE, 0x0F, 0x16, 0x1B,
+    0xC4, 0x16, 0x9F, 0xB7, 0x9E, 0xD9, 0xFE, 0x6B, 0x8F, 0xA0, 0xE8, 0xA5, 0xA5, 0xA1, 0x96, 0x69,
+    0x36, 0xC2, 0x3D, 0xC8, 0x2E, 0x9D, 0x7A, 0x9B, 0x4B, 0xFE, 0x5C, 0x31, 0xA4, 0x06, 0xA2, 0x38,
+    0x56, 0x6B, 0x1A, 0xC0, 0x1D, 0xCC, 0x66, 0x1B, 0xC1, 0x1D, 0x22, 0x76, 0x1B, 0x98, 0xFC, 0x7F,
+    0xA5, 0x76, 0x62, 0x6E, 0x1D, 0x56, 0x6E, 0xC0, 0x1F, 0x1A, 0xC5, 0x5A, 0x6E, 0x6E, 0x19, 0xC1,
+    0x0F, 0xC0, 0x7E, 0x5A, 0xC6, 0x6E, 0x14, 0xC1, 0x9E, 0xFB, 0x25, 0xC2, 0x28, 0xC1, 0x2F, 0xC3,
+    0x34, 0xC1, 0x2D, 0xCC, 0x34, 0xC0, 0x2D, 0xC3, 0x26, 0x66, 0x56, 0xC0, 0x1E, 0xC1, 0x19, 0x59,
+    0x97, 0xDD, 0x5A, 0xA8, 0x34, 0x0D, 0xC0, 0x6F, 0x5B, 0xC2, 0x16, 0xC0, 0x11, 0x69, 0x11, 0x16,
+    0xC7, 0x5A, 0xC0, 0x16, 0xC8, 0x14, 0x1B, 0xC0, 0x13, 0xC0, 0x16, 0x12, 0x9E, 0xC9, 0x9D, 0xF9,
+    0x9D, 0xF9, 0xA2, 0xD7, 0xA4, 0x95, 0x7E, 0x69, 0xC3, 0x3D, 0xC8, 0x31, 0x0C, 0x9B, 0x5B, 0xFE,
+    0x64, 0x10, 0xFE, 0x3C, 0xB3, 0x22, 0x56, 0x6B, 0x1A, 0x7B, 0x69, 0xC1, 0x69, 0x1D, 0xC3, 0x66,
+    0x1D, 0xC2, 0x7A, 0xC0, 0x1B, 0x20, 0x1D, 0xC0, 0x20, 0xC0, 0x99, 0xEC, 0x72, 0xA6, 0x65, 0x62,
+    0x6E, 0xC0, 0x15, 0x6E, 0x5A, 0x1C, 0xC0, 0x17, 0x1A, 0xC2, 0x17, 0x1C, 0x19, 0xC1, 0x12, 0xC0,
+    0x5A, 0xC0, 0x14, 0xCB, 0x9F, 0xEA, 0x28, 0x2F, 0xC2, 0x6E, 0xC1, 0x2F, 0xC1, 0x34, 0xC6, 0x2D,
+    0xC0, 0x7E, 0xC0, 0x2D, 0xC0, 0x34, 0x6E, 0xC3, 0x2D, 0xC4, 0x26, 0x66, 0x5A, 0xC0, 0x6E, 0x56,
+    0xC0, 0x07, 0x37, 0xA2, 0x67, 0xA8, 0x34, 0x56, 0xC0, 0x11, 0xC1, 0x6F, 0x6E, 0x7A, 0x55, 0xC2,
+    0x19, 0x16, 0xC0, 0x6E, 0xC6, 0x56, 0xC0, 0x1B, 0xC0, 0x16, 0x1B, 0xC2, 0x16, 0x1B, 0xC4, 0x15,
+    0x3E, 0xFE, 0x6B, 0xB0, 0xA0, 0xE8, 0xA4, 0xA5, 0xA3, 0x96, 0x3D, 0x36, 0xC1, 0x3D, 0xC9, 0x31,
+    0x3D, 0x9D, 0x7A, 0x9A, 0x6B, 0xFE, 0x6B, 0xEF, 0xFE, 0x3C, 0x92, 0xA3, 0x37, 0x57, 0xC4, 0x65,
+    0x6E, 0x1D, 0xC0, 0x66, 0xC0, 0x1D, 0xC5, 0x20, 0xC1, 0x6E, 0x1D, 0xC0, 0x20, 0x9A, 0xDB, 0x9C,
+    0xCB, 0xA7, 0x65, 0x66, 0xC1, 0x1A, 0xC0, 0x1C, 0xC1, 0x17, 0xC4, 0x1C, 0x19, 0xC1, 0x0D, 0x12,
+    0x5A, 0xC0, 0x14, 0xCB, 0x9F, 0xFA, 0x2F, 0x34, 0xCB, 0x39, 0x7A, 0xC6, 0x2D, 0xC0, 0x3C, 0xC1,
+    0x39, 0xC1, 0x2D, 0xC5, 0x26, 0x2D, 0x23, 0xC0, 0x56, 0x23, 0x41, 0x96, 0xDD, 0xA4, 0x56, 0x15,
+    0x12, 0x66, 0x19, 0x5A, 0xC1, 0x22, 0x7A, 0x59, 0x16, 0xC0, 0x66, 0x16, 0xC6, 0x13, 0x16, 0x13,
+    0xC1, 0x6E, 0x1B, 0xC7, 0x22, 0x1B, 0xC0, 0x7A, 0x9D, 0xD9, 0x9D, 0xD8, 0xFE, 0x7B, 0x8F, 0xA4,
+    0xB5, 0xA3, 0xA7, 0x02, 0x36, 0xC2, 0x3D, 0xC9, 0x31, 0x3D, 0x9E, 0x79, 0x99, 0x7C, 0xFE, 0x6B,
+    0xCF, 0xFE, 0x44, 0x92, 0xA2, 0x38, 0x5B, 0xC0, 0x18, 0x20, 0x1D, 0xC0, 0x69, 0xC0, 0x1D, 0xC9,
+    0x20, 0xC0, 0x1B, 0xA2, 0x56, 0xC0, 0x1D, 0x14, 0x9C, 0xCB, 0x9B, 0xCB, 0xA7, 0x65, 0x66, 0xC1,
+    0x1A, 0x1F, 0x1C, 0xC2, 0x17, 0xC1, 0x1C, 0x15, 0x5A, 0x6B, 0x7E, 0x19, 0x55, 0x6E, 0xC2, 0x14,
+    0xCA, 0x2F, 0x34, 0xCC, 0x3C, 0x66, 0xC4, 0x69, 0xC3, 0x35, 0x3C, 0x34, 0x3C, 0xC0, 0x2D, 0xC5,
+    0x69, 0xC0, 0x5A, 0xC0, 0x6E, 0x6B, 0x9D, 0x89, 0x95, 0xED, 0xA6, 0x45, 0xA5, 0x56, 0xC0, 0x0A,
+    0x6F, 0x1B, 0x16, 0xC0, 0x1B, 0x6B, 0x1E, 0x16, 0xC6, 0x0F, 0x16, 0xC4, 0x1B, 0xC4, 0x20, 0x1B,
+    0xC5, 0x06, 0x9E, 0xD9, 0x9C, 0xF9, 0xA0, 0xE8, 0xA5, 0xA5, 0xA2, 0x97, 0x3D, 0x36, 0xC1, 0x3D,
+    0xC9, 0x31, 0xC0, 0x7F, 0x9F, 0x68, 0x98, 0x8D, 0xA3, 0x06, 0xFE, 0x44, 0x71, 0xA3, 0x27, 0x6B,
+    0x5B, 0x1B, 0x20, 0x1D, 0xC0, 0x69, 0x1D, 0xC3, 0x20, 0x1D, 0xC4, 0x20, 0xC0, 0x1B, 0x1D, 0x6E,
+    0x1D, 0x61, 0x0A, 0x99, 0xDC, 0xA6, 0x75, 0x18, 0xC1, 0x1A, 0xC0, 0x1C, 0xC0, 0x5A, 0xC0, 0x1C,
+    0xC2, 0x19, 0x69, 0xC0, 0x21, 0x12, 0x0F, 0xC0, 0x14, 0xCD, 0x34, 0xCA, 0x37, 0xC0, 0x3C, 0xC0,
+    0x37, 0xC4, 0x69, 0xC1, 0x3C, 0xC1, 0x37, 0x34, 0x37, 0x34, 0x2D, 0xC0, 0x30, 0x2D, 0xC2, 0x6E,
+    0x2D, 0x32, 0x2F, 0x6E, 0x55, 0x9B, 0xBB, 0x98, 0xBB, 0xA7, 0x45, 0x15, 0x12, 0x0F, 0xC0, 0x6B,
+    0xC0, 0x1B, 0xC0, 0x7A, 0xC1, 0x19, 0x0F, 0xC0, 0x16, 0x0F, 0xCB, 0x14, 0xC3, 0x1B, 0xC0, 0x16,
+    0xC1, 0x0D, 0x38, 0x33, 0x9E, 0xE8, 0xA3, 0xC6, 0x06, 0x02, 0x36, 0xC2, 0x3D, 0xC9, 0x31, 0x66,
+    0x00, 0x46, 0x97, 0x9D, 0xA2, 0x07, 0xFE, 0x4C, 0x51, 0xA3, 0x17, 0x6F, 0x20, 0x1B, 0xC0, 0x5A,
+    0x1D, 0xC4, 0x18, 0xC2, 0x1D, 0xC1, 0x20, 0xC3, 0x1D, 0xC0, 0x75, 0x0F, 0x0C, 0xA5, 0x76, 0xA1,
+    0x98, 0xC1, 0x1A, 0x17, 0x1C, 0x21, 0x56, 0xC1, 0x1C, 0xC0, 0x19, 0x69, 0xC1, 0x6E, 0x12, 0x0F,
+    0xC0, 0x14, 0xCD, 0xA0, 0xEA, 0x6E, 0xC3, 0x37, 0xC0, 0x6E, 0xC6, 0x37, 0xC0, 0x3C, 0xC0, 0x37,
+    0xC0, 0x3C, 0xC4, 0x30, 0xC2, 0x2D, 0x7E, 0xC0, 0x2D, 0xC1, 0x32, 0xC1, 0x6E, 0x32, 0x28, 0x56,
+    0x9A, 0xAA, 0x9A, 0xBB, 0xA8, 0x44, 0xA4, 0x56, 0x17, 0x65, 0x0F, 0x0A, 0x0F, 0x17, 0x6F, 0xC0,
+    0x17, 0xC1, 0x12, 0xCD, 0x0F, 0x17, 0x14, 0x17, 0xC1, 0x12, 0x6F, 0x23, 0xC0, 0x12, 0x09, 0x9F,
+    0xC8, 0x9C, 0xF9, 0xA1, 0xD7, 0xA4, 0xA6, 0x02, 0x36, 0xC1, 0x6B, 0xCB, 0x66, 0x2C, 0x00, 0x46,
+    0x97, 0xAD, 0xA2, 0x07, 0xFE, 0x4C, 0x31, 0xA3, 0x17, 0x5F, 0x7F, 0x1B, 0xC0, 0x5A, 0x1D, 0xC3,
+    0x18, 0xC7, 0x20, 0xC0, 0x6F, 0x1D, 0x20, 0xC0, 0x1B, 0x1E, 0x0C, 0xA4, 0x87, 0xA2, 0x87, 0xC0,
+    0x5A, 0x6E, 0x5A, 0x1C, 0x19, 0xC6, 0x1E, 0x69, 0xC0, 0x12, 0x0F, 0xC2, 0x14, 0xCB, 0x34, 0x39,
+    0xC0, 0x34, 0xC0, 0x39, 0x76, 0xC0, 0x3C, 0xC4, 0x34, 0xC1, 0x37, 0x3C, 0xC0, 0x37, 0xC0, 0x3C,
+    0xC4, 0x30, 0xC2, 0x2D, 0x7E, 0xC0, 0x32, 0x2D, 0xC0, 0x35, 0xC0, 0x32, 0xC0, 0x28, 0x65, 0x56,
+    0x99, 0xBB, 0x9A, 0xBB, 0xA8, 0x34, 0xA2, 0x78, 0x6E, 0xC0, 0x5A, 0x6B, 0xC0, 0x6E, 0xC0, 0x3E,
+    0x37, 0x66, 0xC0, 0x2A, 0xC2, 0x69, 0xC1, 0x66, 0xC5, 0x23, 0xC1, 0x2A, 0x6E, 0x32, 0xC0, 0x2A,
+    0x2F, 0x3E, 0xC0, 0x60, 0x9E, 0xC9, 0x9E, 0xD9, 0xA1, 0xD6, 0xA3, 0xB6, 0xA5, 0x95, 0x02, 0x36,
+    0x00, 0x55, 0xC0, 0x3D, 0xCA, 0x38, 0x65, 0x00, 0x46, 0x98, 0x9C, 0xA0, 0x39, 0xFE, 0x54, 0x31,
+    0xA3, 0x17, 0x5F, 0x20, 0x66, 0xC1, 0x1D, 0xC1, 0x20, 0x1B, 0x5A, 0x1B, 0xC3, 0x55, 0x11, 0x0C,
+    0x1B, 0xC1, 0x0C, 0x20, 0xC0, 0x1B, 0x7A, 0x98, 0xEC, 0xA3, 0x87, 0xA2, 0x88, 0xC0, 0x15, 0x6E,
+    0x59, 0x6F, 0x12, 0x1E, 0xC0, 0x12, 0xC0, 0x7A, 0x12, 0x1C, 0x6D, 0x21, 0x1A, 0x17, 0x0F, 0xC1,
+    0x0C, 0x7E, 0xCB, 0x3C, 0xC1, 0x34, 0xC0, 0x39, 0x3C, 0xC8, 0x66, 0x3C, 0xC0, 0x37, 0x3C, 0xC2,
+    0x37, 0x3C, 0xC0, 0x37, 0x30, 0xC2, 0x6E, 0x5A, 0x35, 0xC0, 0x30, 0x2D, 0x35, 0xC0, 0x32, 0x35,
+    0x59, 0x56, 0x51, 0x98, 0xBB, 0x9A, 0xBB, 0xA4, 0x66, 0x55, 0x6F, 0x6E, 0x6B, 0x7E, 0x6F, 0xC0,
+    0x56, 0x3E, 0x66, 0x3E, 0xC1, 0x7A, 0xC0, 0x6E, 0x01, 0x06, 0xC0, 0x6B, 0xC1, 0x7A, 0x6E, 0xC4,
+    0x0D, 0x39, 0x2A, 0x7A, 0x56, 0x6F, 0x36, 0x69, 0x21, 0x9C, 0xEA, 0xA1, 0xC7, 0xA6, 0xB5, 0xA7,
+    0x84, 0x3F, 0x75, 0xC1, 0x38, 0xC0, 0x3D, 0xC6, 0x02, 0x3D, 0xC1, 0x65, 0x7B, 0x65, 0x38, 0x99,
+    0x9C, 0x9F, 0x28, 0xFE, 0x5C, 0x31, 0x0B, 0x14, 0x20, 0x61, 0x7F, 0x20, 0x7E, 0x5A, 0x65, 0x7B,
+    0x1B, 0x20, 0x14, 0x23, 0xC0, 0x1E, 0x14, 0xC4, 0x0A, 0x9A, 0xAA, 0xA2, 0x77, 0x14, 0x23, 0x17,
+    0x9B, 0xCB, 0x7A, 0xA3, 0x88, 0xC0, 0x59, 0xC0, 0x56, 0x6E, 0x6E, 0x5A, 0x7F, 0x15, 0xC0, 0x7F,
+    0x15, 0x10, 0x15, 0x1A, 0xC0, 0x17, 0xC0, 0x14, 0xCE, 0x3C, 0xCE, 0x6E, 0x3C, 0x37, 0x3C, 0x7E,
+    0x3C, 0xC3, 0x7A, 0x3C, 0xC3, 0x69, 0xC6, 0x6E, 0x56, 0x65, 0x5A, 0x65, 0x95, 0xDD, 0xA2, 0x77,
+    0xA8, 0x44, 0x41, 0x7E, 0x31, 0x39, 0x6F, 0xC0, 0x66, 0xA2, 0x77, 0x5A, 0x14, 0x6E, 0xC0, 0x6B,
+    0xC1, 0x6E, 0x7E, 0xC3, 0x7F, 0x6E, 0xC0, 0x3C, 0xC4, 0x56, 0x65, 0xC0, 0x20, 0x5A, 0x59, 0x11,
+    0x9D, 0xC9, 0x9B, 0xFA, 0xFE, 0x7B, 0x0C, 0xA6, 0x95, 0xA5, 0x84, 0x7A, 0x36, 0x6E, 0x36, 0x7B,
+    0xC0, 0x5A, 0xC6, 0x02, 0x3D, 0xC1, 0x65, 0x7B, 0x2F, 0x5F, 0x9B, 0x8B, 0x9C, 0x5A, 0xFE, 0x5B,
+    0xF0, 0xA4, 0x06, 0x03, 0xC0, 0x6F, 0x03, 0xC1, 0x59, 0xC0, 0x7F, 0x62, 0x03, 0x7E, 0x6F, 0xC0,
+    0x12, 0x03, 0x08, 0xC0, 0x6F, 0x17, 0xC0, 0x3E, 0x98, 0xBB, 0xC0, 0xA6, 0x55, 0xA5, 0x55, 0xA1,
+    0x98, 0x9B, 0xBB, 0x71, 0xA4, 0x67, 0xC0, 0x07, 0x6E, 0x5A, 0x15, 0xC0, 0x55, 0x15, 0xC0, 0x1D,
+    0x66, 0x59, 0x1D, 0x1A, 0xC0, 0x15, 0x17, 0xC0, 0x08, 0x5A, 0x14, 0xCC, 0xA1, 0xE9, 0xC1, 0x6E,
+    0xC0, 0x3C, 0xCC, 0x01, 0x3C, 0x04, 0xC0, 0x3C, 0x3F, 0xC2, 0x3C, 0x35, 0x3C, 0xC1, 0x35, 0xC1,
+    0x56, 0xC0, 0x35, 0xC0, 0x3A, 0x35, 0xC0, 0x69, 0x26, 0x93, 0xEE, 0xAA, 0x32, 0xAA, 0x33, 0x51,
+    0x66, 0x20, 0x7F, 0x56, 0x6E, 0x27, 0x59, 0x27, 0xC2, 0x55, 0xC0, 0x66, 0xC0, 0x5A, 0xC1, 0x69,
+    0x66, 0x10, 0x13, 0x18, 0xC3, 0x6B, 0x27, 0xC1, 0x2C, 0x5A, 0x56, 0x65, 0x18, 0x9D, 0xD9, 0xFE,
+    0x8C, 0x10, 0x9A, 0xFB, 0xA6, 0x94, 0xA2, 0x97, 0x69, 0x6E, 0x36, 0xC0, 0x3D, 0xCC, 0x31, 0x7A,
+    0xC0, 0x3D, 0x99, 0xAC, 0x9B, 0x6A, 0xFE, 0x53, 0x4D, 0xA1, 0x28, 0xA2, 0x47, 0x56, 0x7B, 0x55,
+    0xC1, 0x69, 0x5A, 0x2F, 0x2A, 0x66, 0x2F, 0x36, 0x3B, 0x7A, 0xA2, 0x77, 0xA3, 0x66, 0x6F, 0x6E,
+    0x0B, 0xC0, 0x6E, 0x9C, 0xAA, 0x66, 0x3C, 0x10, 0x7F, 0x9C, 0xBA, 0x9D, 0xAA, 0x11, 0x7F, 0xC0,
+    0x6E, 0x20, 0x25, 0x56, 0x6E, 0x1D, 0x11, 0xC0, 0x66, 0xC0, 0x02, 0x9D, 0xAA, 0x5A, 0x12, 0x23,
+    0x08, 0x6F, 0xC1, 0x5A, 0x14, 0xC0, 0x0F, 0xC1, 0x14, 0xC4, 0x0F, 0xA2, 0xD8, 0x6E, 0xC1, 0x6B,
+    0xC0, 0x3C, 0xC7, 0x01, 0x3C, 0x01, 0x7A, 0xC7, 0x3F, 0xC2, 0x04, 0x01, 0x35, 0xC0, 0x2D, 0x69,
+    0x2D, 0x35, 0x6E, 0x35, 0x3A, 0x65, 0x3A, 0x9D, 0xA9, 0x94, 0xEE, 0xAD, 0x11, 0xA8, 0x43, 0x9D,
+    0xAA, 0xC0, 0x9D, 0x9A, 0x9A, 0xBB, 0xA5, 0x65, 0xA6, 0x55, 0x6F, 0x51, 0xC1, 0x66, 0xC0, 0x66,
+    0xC1, 0x5A, 0x6E, 0xC1, 0x07, 0x5A, 0x07, 0x13, 0xC0, 0x0E, 0x13, 0xC0, 0x0E, 0xC1, 0x07, 0x56,
+    0xC0, 0x9B, 0xAA, 0x9B, 0xAA, 0xA6, 0x65, 0xA4, 0x86, 0x9C, 0xEA, 0xFE, 0x8B, 0x6D, 0xA1, 0xB7,
+    0xA6, 0x95, 0x31, 0x5D, 0x7F, 0x6B, 0x65, 0x3D, 0xCC, 0x36, 0x31, 0xC0, 0x00, 0x98, 0xBC, 0x9B,
+    0x6B, 0xFE, 0x63, 0x6D, 0xA2, 0x17, 0xA3, 0x47, 0x2B, 0x7B, 0x6E, 0x7A, 0xC0, 0xA2, 0x66, 0x66,
+    0x3A, 0x65, 0x29, 0xC0, 0x5A, 0x12, 0x9D, 0xA9, 0x2A, 0x6E, 0xC0, 0x6E, 0x03, 0x7E, 0xA2, 0x77,
+    0x2B, 0x7E, 0x5A, 0xC0, 0x7F, 0x2E, 0x9D, 0xAA, 0x3D, 0x0C, 0xC0, 0x69, 0x66, 0x3D, 0x69, 0x29,
+    0x22, 0x15, 0x65, 0x7F, 0xA3, 0x66, 0xC0, 0x51, 0x2E, 0x9B, 0xAB, 0xC0, 0xA7, 0x34, 0x0D, 0xC0,
+    0x14, 0x55, 0x14, 0xC0, 0x66, 0xC1, 0x14, 0xC4, 0x0F, 0xA3, 0xC8, 0xC1, 0x01, 0xC8, 0x66, 0x01,
+    0xC2, 0x65, 0x01, 0x7E, 0x66, 0xC0, 0x09, 0xC0, 0x04, 0xC0, 0x3C, 0x04, 0xC1, 0x3C, 0x01, 0x35,
+    0xC0, 0x66, 0x5A, 0x35, 0xC0, 0x6E, 0x35, 0x09, 0x65, 0xC0, 0x9B, 0xAA, 0x97, 0xCC, 0xAE, 0x11,
+    0xA4, 0x76, 0x55, 0x1E, 0x9A, 0xBB, 0x94, 0xEE, 0x55, 0x22, 0x1E, 0x66, 0x16, 0xC1, 0x0F, 0x67,
+    0xC0, 0x16, 0xC0, 0x13, 0x65, 0xC9, 0x66, 0x5A, 0x3A, 0x55, 0x3F, 0x99, 0xBB, 0x95, 0xED, 0xA6,
+    0x75, 0xA8, 0x64, 0x9B, 0xFA, 0xFE, 0x93, 0x2C, 0xA7, 0x84, 0xA3, 0x86, 0x7A, 0xC0, 0x3B, 0x67,
+    0xCC, 0x6E, 0x36, 0xC0, 0x66, 0xC0, 0x7F, 0x9B, 0x9A, 0x99, 0x8C, 0xFE, 0x8C, 0x71, 0xA5, 0x16,
+    0x13, 0x4E, 0x66, 0xC0, 0x7E, 0x66, 0xA2, 0x66, 0xC0, 0x10, 0xC1, 0x55, 0xC0, 0x56, 0x65, 0x25,
+    0x65, 0x41, 0x50, 0x1F, 0x65, 0x0B, 0x66, 0x0B, 0x03, 0xC0, 0x0B, 0x61, 0x32, 0xA2, 0x87, 0x6E,
+    0x76, 0xC0, 0x09, 0xC0, 0x1D, 0x29, 0xA3, 0x76, 0x19, 0x6E, 0x7B, 0xA2, 0x77, 0x59, 0x2D, 0x0D,
+    0x26, 0x2F, 0xA7, 0x45, 0xA2, 0x67, 0xC0, 0x6F, 0xC3, 0x66, 0x14, 0xC6, 0xA2, 0xD8, 0xC0, 0x66,
+    0xC0, 0x01, 0xC0, 0x6F, 0xC0, 0x01, 0xC0, 0x7E, 0x01, 0x7A, 0xC1, 0x01, 0xC0, 0x09, 0xC0, 0x01,
+    0xC0, 0x09, 0x04, 0xC1, 0x3C, 0x35, 0xC1, 0x3C, 0xC0, 0x35, 0xC5, 0x56, 0xC0, 0x35, 0x6E, 0x7E,
+    0xC0, 0x99, 0xCC, 0x2A, 0xFE, 0x75, 0x55, 0x7F, 0x0F, 0xC0, 0x7A, 0x22, 0x95, 0xED, 0xA9, 0x34,
+    0x12, 0x56, 0xC0, 0x0F, 0x16, 0x0A, 0xC0, 0x02, 0xC1, 0x6E, 0x02, 0xC2, 0x3F, 0xC0, 0x3A, 0x69,
+    0x5A, 0x33, 0xC0, 0x3A, 0xC0, 0x35, 0x2B, 0x3F, 0x30, 0x99, 0xCB, 0x9E, 0xC9, 0xA3, 0xA6, 0xFE,
+    0x8B, 0x6D, 0xA1, 0xB7, 0xA6, 0x85, 0x36, 0xC2, 0x31, 0xC0, 0x3D, 0xC7, 0x6E, 0x3D, 0x02, 0xC0,
+    0x36, 0xC0, 0x31, 0x5A, 0x36, 0x9D, 0xAA, 0x98, 0x8C, 0xFE, 0x94, 0x51, 0xA6, 0x05, 0x07, 0x4A,
+    0x51, 0x7F, 0x7F, 0x7E, 0x59, 0x6F, 0x61, 0x10, 0xC5, 0x15, 0xC0, 0x59, 0x6B, 0x1A, 0x65, 0x56,
+    0xC0, 0x51, 0x5A, 0xC0, 0x61, 0xC0, 0x6F, 0x2D, 0x30, 0xC1, 0x3C, 0x09, 0xC0, 0x15, 0x7F, 0x6E,
+    0x15, 0xC0, 0x01, 0xC0, 0x29, 0x94, 0xDE, 0x9A, 0xAB, 0x37, 0x08, 0xC0, 0x6E, 0x14, 0xC1, 0x66,
+    0xC0, 0x14, 0xC6, 0xA1, 0xD9, 0xC0, 0x7A, 0xC0, 0x6E, 0xC4, 0x7E, 0x01, 0x7A, 0x09, 0xC0, 0x04,
+    0x01, 0x6E, 0x7F, 0x69, 0x01, 0xC0, 0x09, 0x01, 0x04, 0x3C, 0x35, 0x66, 0xC5, 0x35, 0xC1, 0x5A,
+    0x65, 0xC0, 0x3A, 0x65, 0x7F, 0xC0, 0x98, 0xCB, 0x9C, 0xAA, 0xB0, 0x00, 0x55, 0xC0, 0x0A, 0xC0,
+    0x23, 0x9B, 0xBB, 0x0A, 0xC0, 0x0F, 0x0A, 0x16, 0xC1, 0x11, 0xC1, 0x07, 0x09, 0x69, 0x3D, 0x3A,
+    0x3F, 0x3A, 0x33, 0x56, 0x6E, 0x6B, 0x2B, 0xC1, 0x32, 0x65, 0x2B, 0x56, 0x30, 0x33, 0x9D, 0xC9,
+    0xFE, 0x83, 0xF0, 0xFE, 0x93, 0x2C, 0xA6, 0x85, 0xA5, 0x85, 0x69, 0x66, 0xC0, 0x31, 0x6B, 0xC0,
+    0x36, 0x02, 0x66, 0xC5, 0x02, 0x3D, 0xC0, 0x02, 0x36, 0xC0, 0x31, 0x5A, 0x36, 0x51, 0x98, 0x9C,
+    0xFE, 0x94, 0x10, 0xA5, 0x06, 0xA2, 0x47, 0x9E, 0x69, 0x18, 0x9C, 0xAA, 0xA7, 0x65, 0xA8, 0x43,
+    0x5A, 0xC2, 0x6B, 0xC1, 0x04, 0x3F, 0x37, 0x6E, 0x6E, 0x6E, 0x7F, 0x10, 0xA2, 0x76, 0x29, 0x24,
+    0x12, 0x6E, 0x15, 0x12, 0xC1, 0x15, 0x7A, 0x6B, 0x18, 0x10, 0x15, 0x95, 0xEE, 0x51, 0x05, 0x10,
+    0xC0, 0x15, 0x01, 0xC0, 0x15, 0x96, 0xCD, 0x2F, 0xA8, 0x34, 0xA2, 0x77, 0x08, 0x5A, 0xC0, 0x14,
+    0xC0, 0x66, 0xC2, 0x14, 0xC4, 0xA0, 0xE9, 0xC0, 0x32, 0x35, 0x6F, 0xC2, 0x35, 0x01, 0xC2, 0x7E,
+    0xC0, 0x01, 0x9C, 0xAA, 0x3E, 0xA3, 0x77, 0xA5, 0x56, 0x55, 0x01, 0x09, 0xC0, 0x66, 0xC1, 0x35,
+    0x66, 0xC2, 0x35, 0x30, 0xC1, 0x35, 0x32, 0x2D, 0x26, 0x0E, 0x3A, 0x65, 0x3A, 0x96, 0xDC, 0x7A,
+    0xAF, 0x10, 0x1E, 0xC0, 0x9D, 0xA9, 0xC0, 0xA2, 0x67, 0xC0, 0x0A, 0x0F, 0x0A, 0x0F, 0x16, 0xC0,
+    0x13, 0x0E, 0xC0, 0x07, 0x0E, 0xC0, 0x65, 0x66, 0x3A, 0x3F, 0x3A, 0xC0, 0x37, 0x32, 0xC2, 0x69,
+    0x32, 0xC1, 0x23, 0x69, 0xA0, 0xA8, 0x9D, 0xD9, 0xFE, 0x83, 0x6E, 0xA0, 0xD7, 0xA9, 0x63, 0x75,
+    0x5A, 0x36, 0x31, 0xC0, 0x38, 0xC0, 0x59, 0x3B, 0x36, 0x6B, 0xC7, 0x36, 0xC0, 0x3B, 0x33, 0x61,
+    0x36, 0x31, 0x97, 0x9D, 0xFE, 0x93, 0xEF, 0xA6, 0x05, 0xA3, 0x27, 0x5F, 0x99, 0xBC, 0x95, 0xEE,
+    0x7A, 0xAF, 0x10, 0xA3, 0x57, 0x04, 0xC0, 0x0B, 0xC3, 0x04, 0x66, 0x04, 0xC0, 0x5A, 0xC0, 0x04,
+    0x6F, 0x7E, 0x5A, 0xC0, 0x5A, 0x01, 0xC2, 0x6B, 0x0B, 0xC1, 0x55, 0xC0, 0x92, 0xFF, 0x9C, 0xAA,
+    0xA6, 0x55, 0x3C, 0x7E, 0x10, 0x01, 0xC0, 0x6F, 0x97, 0xCC, 0x9B, 0xAA, 0xA6, 0x46, 0xA2, 0x67,
+    0xC0, 0x6E, 0x14, 0xC0, 0x66, 0xC3, 0x14, 0xC3, 0x0F, 0xA3, 0xB6, 0x3F, 0x06, 0xC0, 0x0B, 0xC0,
+    0x09, 0x06, 0xC7, 0x9C, 0xAA, 0x1A, 0xA6, 0x56, 0xAA, 0x33, 0x69, 0x01, 0x7F, 0x09, 0xC0, 0x66,
+    0xC0, 0x56, 0xC3, 0x35, 0xC0, 0x66, 0xC0, 0x35, 0xC0, 0x32, 0x99, 0xCC, 0xA5, 0x65, 0x0E, 0x9C,
+    0xAA, 0x7E, 0x93, 0xFF, 0xA7, 0x54, 0xAC, 0x22, 0x55, 0x65, 0x5A, 0x0A, 0xC0, 0x0F, 0xC4, 0x16,
+    0xC0, 0x07, 0x02, 0x11, 0x0E, 0x02, 0xC0, 0x01, 0xC0, 0x3A, 0xC0, 0x66, 0x32, 0xC2, 0x59, 0x32,
+    0x37, 0x56, 0xC0, 0x20, 0x75, 0x9F, 0xC8, 0x9C, 0xEA, 0xFE, 0x93, 0x2D, 0xA6, 0x85, 0xA5, 0x85,
+    0x60, 0xC5, 0x36, 0xC2, 0x3D, 0xC4, 0x6E, 0x3D, 0xC1, 0x36, 0x31, 0x36, 0xC0, 0x52, 0x98, 0x9C,
+    0xA4, 0x16, 0xFE, 0x84, 0x92, 0x3B, 0x5F, 0x6F, 0x17, 0x9C, 0xAA, 0x3A, 0x04, 0xC3, 0x07, 0x3F,
+    0x04, 0xC2, 0x56, 0xC0, 0x6E, 0x0B, 0x10, 0xC1, 0x59, 0x01, 0xC0, 0x3C, 0x01, 0xC1, 0x0B, 0xC1,
+    0x04, 0xC0, 0x9B, 0xAB, 0x96, 0xDD, 0xA3, 0x76, 0x01, 0x10, 0x01, 0x10, 0x01, 0x06, 0x97, 0xDD,
+    0x9B, 0x9A, 0xA6, 0x45, 0x0D, 0x65, 0x0D, 0x6B, 0x66, 0xC0, 0x7B, 0x0F, 0xC0, 0x14, 0xC5, 0x9E,
+    0xE8, 0x17, 0x26, 0x2B, 0xC0, 0x7E, 0x3F, 0xC0, 0x3A, 0x7F, 0x6E, 0x6F, 0x0E, 0xC1, 0x6E, 0x0E,
+    0x9A, 0xBB, 0x3A, 0x0E, 0x3A, 0x09, 0x6F, 0x51, 0x66, 0xC0, 0x35, 0xC0, 0x67, 0x3C, 0xC0, 0x35,
+    0x3A, 0xC0, 0x35, 0x26, 0x7B, 0x5A, 0x51, 0x99, 0xBB, 0x9B, 0xBA, 0xAB, 0x33, 0x3A, 0x26, 0xFE,
+    0x2A, 0xED, 0xAD, 0x21, 0xA9, 0x33, 0x1E, 0x65, 0xC0, 0x0A, 0xC0, 0x6E, 0xC2, 0x0A, 0xC0, 0x16,
+    0x0F, 0x52, 0xC3, 0x3F, 0x01, 0xC1, 0x3A, 0x56, 0xC3, 0x5A, 0x32, 0xC0, 0x5B, 0xC0, 0x20, 0x9F,
+    0xB8, 0x9D, 0xE9, 0x9B, 0xFB, 0x9D, 0xE9, 0xA8, 0x74, 0x3D, 0x69, 0x66, 0x36, 0x3D, 0x36, 0x31,
+    0xC0, 0x36, 0x5A, 0x36, 0xC0, 0x3D, 0xC5, 0x36, 0xC5, 0x31, 0x97, 0xAD, 0xFE, 0x93, 0xCE, 0xFE,
+    0x8C, 0xD3, 0xA3, 0x26, 0x04, 0x7F, 0x3F, 0x16, 0x6E, 0x3F, 0x04, 0xC0, 0x51, 0x3A, 0x3F, 0xC4,
+    0x5A, 0xC0, 0x0B, 0xC1, 0x10, 0x04, 0x5A, 0xC0, 0x3C, 0xC0, 0x66, 0xC0, 0x3C, 0x04, 0x0B, 0x10,
+    0xC0, 0x6E, 0x10, 0x9B, 0xAA, 0x6E, 0xA4, 0x66, 0x10, 0x01, 0x06, 0x01, 0xC0, 0x98, 0xCC, 0x9A,
+    0x9B, 0xA6, 0x44, 0xA4, 0x57, 0xC1, 0x14, 0x66, 0xC0, 0x7A, 0x0F, 0xC0, 0x14, 0xC5, 0xFE, 0x33,
+    0x8E, 0x6B, 0x0C, 0xC0, 0x76, 0xC1, 0x07, 0x7F, 0xC0, 0x7E, 0x5A, 0x16, 0x1B, 0x1E, 0x6F, 0xA2,
+    0x77, 0x6E, 0x7F, 0xC1, 0xA3, 0x76, 0x09, 0xC0, 0x6E, 0xC0, 0x09, 0xC4, 0x3A, 0x3F, 0x3A, 0xC2,
+    0x35, 0x9A, 0xBA, 0x99, 0xBB, 0x2A, 0x2E, 0x9D, 0x99, 0x95, 0xEE, 0xB0, 0x10, 0xA4, 0x66, 0x55,
+    0x65, 0xC1, 0x5A, 0xC2, 0x66, 0x5A, 0xC0, 0x7B, 0xC0, 0x02, 0xC3, 0x3A, 0x35, 0xC1, 0x5A, 0xC1,
+    0x5A, 0x32, 0xC0, 0x2F, 0xC3, 0x23, 0x1D, 0x9B, 0xFB, 0x9B, 0xFA, 0xA2, 0xC7, 0xA6, 0x84, 0x3D,
+    0x69, 0x66, 0xC0, 0x3D, 0xC0, 0x31, 0xC0, 0x36, 0xC6, 0x3D, 0xC1, 0x36, 0xC5, 0x31, 0x98, 0x9C,
+    0xA2, 0x28, 0xFE, 0x8C, 0xD2, 0xA0, 0x49, 0xA2, 0x47, 0x3F, 0x0E, 0x7E, 0x13, 0x3F, 0x04, 0x56,
+    0x30, 0x2B, 0x7E, 0x3A, 0x3F, 0x56, 0xC0, 0x3C, 0xC0, 0x6B, 0x7E, 0xC3, 0x01, 0xC0, 0x3C, 0xC3,
+    0x04, 0x0B, 0xC2, 0x01, 0xC7, 0x99, 0xBB, 0x99, 0xAC, 0xA5, 0x55, 0xA4, 0x56, 0xA2, 0x67, 0x0D,
+    0x67, 0xC1, 0x7A, 0x0F, 0xC0, 0x6E, 0xC5, 0xA5, 0xC4, 0x07, 0x55, 0x33, 0x65, 0x56, 0x61, 0x55,
+    0x52, 0x55, 0x61, 0x56, 0x66, 0x59, 0x66, 0xC0, 0x55, 0x36, 0x56, 0xC0, 0x36, 0xC0, 0x6F, 0x0A,
+    0xA2, 0x77, 0x7F, 0x3E, 0xA2, 0x77, 0x7F, 0xA2, 0x77, 0x3A, 0xC0, 0xA2, 0x77, 0x55, 0x3A, 0x7E,
+    0xC1, 0x0E, 0x3F, 0x26, 0x07, 0x3F, 0x95, 0xED, 0x65, 0xB0, 0x01, 0xC0, 0x65, 0x61, 0x6E, 0xC0,
+    0x5A, 0xC0, 0x16, 0xC0, 0x0F, 0x07, 0xC0, 0x11, 0x07, 0x02, 0xC2, 0x07, 0x3F, 0x52, 0xC3, 0x5A,
+    0x66, 0x2F, 0x76, 0xC0, 0x2A, 0xC0, 0x5A, 0x2A, 0x69, 0x9E, 0xC9, 0xFE, 0x7B, 0xD0, 0xFE, 0x93,
+    0x2E, 0xA8, 0x83, 0xA2, 0x86, 0x79, 0xC0, 0x31, 0x36, 0xC1, 0x31, 0xC0, 0x36, 0xC6, 0x3D, 0xC0,
+    0x36, 0xC7, 0x98, 0xAD, 0xA1, 0x27, 0xFE, 0x8C, 0x91, 0xA1, 0x28, 0xA3, 0x47, 0x37, 0x3F, 0x0E,
+    0x13, 0x04, 0x3F, 0x30, 0xC0, 0x7B, 0x69, 0x37, 0x3C, 0x37, 0xC0, 0x3C, 0xC1, 0x0B, 0x10, 0x0B,
+    0x10, 0x0B, 0xC1, 0x5A, 0x3C, 0xC3, 0x04, 0x0B, 0xC1, 0x3C, 0x6E, 0xC1, 0x06, 0x01, 0x3C, 0x01,
+    0xC0, 0x99, 0xBB, 0x99, 0xAC, 0xA4, 0x66, 0xA6, 0x35, 0xC1, 0x67, 0xC3, 0x14, 0xC6, 0xA8, 0xB2,
+    0x5A, 0xC0, 0x7B, 0x6E, 0xC0, 0x32, 0x55, 0xC1, 0x66, 0xC1, 0x23, 0x56, 0x69, 0x66, 0xC0, 0x51,
+    0x55, 0x62, 0x41, 0x65, 0x56, 0x51, 0x61, 0x41, 0x51, 0x62, 0xC0, 0x6E, 0xA2, 0x67, 0x7A, 0xC0,
+    0xA2, 0x67, 0xA4, 0x66, 0x37, 0x6F, 0x1F, 0xA2, 0x77, 0x66, 0x02, 0x37, 0x97, 0xCC, 0x0B, 0xAB,
+    0x32, 0x1E, 0x65, 0x56, 0x7F, 0xC0, 0x0F, 0xC0, 0x16, 0xC1, 0x13, 0x0E, 0xC1, 0x02, 0xC2, 0x5F,
+    0x65, 0x52, 0xC4, 0x5A, 0x77, 0xC0, 0x2D, 0x5A, 0xC0, 0x5A, 0x2A, 0x21, 0x9D, 0xD9, 0xFE, 0x83,
+    0x6F, 0xA0, 0xD7, 0xA9, 0x63, 0x60, 0x31, 0x6E, 0xC0, 0x5A, 0x36, 0x31, 0xC1, 0x36, 0xC5, 0x31,
+    0xC0, 0x36, 0xC8, 0x99, 0x9C, 0x9F, 0x49, 0xA7, 0x05, 0xA2, 0x17, 0x38, 0x3A, 0x3F, 0xA2, 0x87,
+    0x13, 0x04, 0xC0, 0x52, 0x30, 0xC1, 0x37, 0xC2, 0x6F, 0xC1, 0x7A, 0x0B, 0xC4, 0x03, 0x3C, 0x37,
+    0x3C, 0xC1, 0x0B, 0xC4, 0x01, 0xC5, 0x99, 0xBB, 0x99, 0xAC, 0x17, 0xA6, 0x45, 0x0D, 0xC0, 0x6B,
+    0x66, 0xC2, 0x14, 0xC6, 0xA6, 0xC3, 0x6E, 0xC0, 0x6B, 0xC4, 0x7A, 0xC0, 0x2B, 0xC2, 0x5A, 0xC1,
+    0x2B, 0x6F, 0xC2, 0x56, 0x23, 0xC0, 0x1B, 0x51, 0x9D, 0xAA, 0x9D, 0xA9, 0x56, 0x55, 0x55, 0x9D,
+    0xAA, 0x3B, 0x51, 0x55, 0xC0, 0x27, 0x3B, 0x00, 0x3B, 0xC0, 0xA3, 0x66, 0xAC, 0x32, 0x2F, 0x1E,
+    0xC0, 0x19, 0xC1, 0x16, 0xC3, 0x13, 0x66, 0xC0, 0x09, 0x02, 0xC1, 0x09, 0x5A, 0x03, 0x32, 0xC3,
+    0x5A, 0x32, 0x39, 0xC0, 0x34, 0x5A, 0x2A, 0x5A, 0x2A, 0x9E, 0xC9, 0x9C, 0xE9, 0xFE, 0x8B, 0x2E,
+    0xA5, 0xA5, 0x3D, 0x61, 0x6E, 0x6E, 0xC0, 0x3D, 0xC0, 0x36, 0x76, 0xC0, 0x36, 0xC5, 0x31, 0xC1,
+    0x36, 0xC6, 0x31, 0x9A, 0x9B, 0x9D, 0x5A, 0xFE, 0x8C, 0x30, 0xA3, 0x17, 0xA2, 0x47, 0xA1, 0x79,
+    0x3F, 0x13, 0x66, 0x04, 0x0B, 0x55, 0xC0, 0x61, 0xC0, 0x32, 0x37, 0xC1, 0x03, 0xC1, 0x0B, 0xC5,
+    0x03, 0x37, 0x3C, 0xC2, 0x0B, 0xC2, 0x01, 0x3C, 0x01, 0xC5, 0x99, 0xBB, 0x99, 0xBC, 0xA4, 0x45,
+    0x10, 0x5A, 0x66, 0x6F, 0xC1, 0x66, 0x7A, 0x6E, 0x14, 0xC5, 0xA7, 0xC2, 0xC2, 0x26, 0x1C, 0x26,
+    0xC5, 0x6E, 0xC1, 0x1C, 0x66, 0xC0, 0x2B, 0x26, 0x23, 0xC0, 0x6E, 0xC0, 0x7F, 0x7F, 0x6E, 0xC0,
+    0x5A, 0x66, 0xC0, 0x69, 0x56, 0x1B, 0x55, 0x9D, 0xAA, 0x24, 0x9D, 0xAA, 0x65, 0x0B, 0x6E, 0xA5,
+    0x65, 0x1E, 0xA2, 0x67, 0x1E, 0xC0, 0x16, 0x7A, 0xC1, 0x16, 0xC2, 0x11, 0x0E, 0x09, 0x0E, 0x09,
+    0x59, 0xC0, 0x09, 0x5A, 0xC0, 0x56, 0xC0, 0x39, 0xC0, 0x69, 0xC0, 0x5A, 0x39, 0xC0, 0x66, 0xC0,
+    0x5A, 0x2A, 0x27, 0x21, 0x9E, 0xC9, 0xFE, 0x83, 0xB0, 0x9D, 0xF9, 0xA8, 0x74, 0x3D, 0x64, 0x7B,
+    0x5E, 0xC1, 0x66, 0xC0, 0x34, 0xC0, 0x36, 0xC0, 0x3D, 0xC1, 0x36, 0x31, 0xC1, 0x36, 0xC7, 0x7A,
+    0x9B, 0x8B, 0x07, 0xFE, 0x8C, 0x31, 0xA3, 0x26, 0x24, 0x3A, 0x3F, 0x13, 0xC0, 0x56, 0x04, 0x56,
+    0xC0, 0x66, 0xC4, 0x3C, 0xC0, 0x6B, 0x0B, 0xC4, 0x06, 0xC0, 0x03, 0x37, 0xC1, 0x03, 0x0B, 0xC2,
+    0x01, 0xC0, 0x0B, 0xC0, 0x01, 0x3C, 0x01, 0xC1, 0x9A, 0xAB, 0x98, 0xCC, 0xA2, 0x67, 0xA8, 0x34,
+    0x56, 0x0D, 0x14, 0x7A, 0x14, 0x66, 0x12, 0x17, 0x14, 0xC5, 0x26, 0x59, 0x66, 0xC0, 0x7A, 0x1F,
+    0xC0, 0x26, 0xC1, 0x1F, 0xC0, 0x26, 0x2B, 0xC1, 0x26, 0x1C, 0x23, 0x1C, 0x1E, 0x23, 0xC0, 0x17,
+    0x23, 0xC2, 0x5A, 0x1B, 0xC1, 0x20, 0x65, 0xC0, 0x20, 0x14, 0x20, 0x14, 0x1B, 0x23, 0x1E, 0x23,
+    0x1E, 0x51, 0x6F, 0x0A, 0x16, 0xC1, 0x11, 0xC2, 0x0E, 0x09, 0x69, 0x09, 0xC1, 0x3F, 0x67, 0x06,
+    0xC2, 0x01, 0x3E, 0xC0, 0x66, 0x37, 0x2F, 0x7A, 0x67, 0xC0, 0x39, 0x56, 0x69, 0xC0, 0x9E, 0xC9,
+    0x9D, 0xE9, 0x9B, 0xFA, 0xA1, 0xD7, 0xA7, 0x74, 0x36, 0x65, 0x7F, 0x56, 0xC6, 0x36, 0x56, 0x66,
+    0x69, 0x66, 0x5A, 0x1D, 0x29, 0x31, 0x36, 0xC1, 0x31, 0xC4, 0x9D, 0x7A, 0x98, 0x9D, 0xFE, 0x94,
+    0x10, 0xA4, 0x06, 0x33, 0x3F, 0xC0, 0x13, 0x0E, 0x59, 0xC2, 0x37, 0xC0, 0x3C, 0xC0, 0x37, 0xC0,
+    0x3C, 0xC0, 0x6B, 0x7E, 0xC4, 0x66, 0xC0, 0x03, 0xC3, 0x0B, 0xC3, 0x59, 0x3C, 0xC0, 0x01, 0x3C,
+    0xC0, 0x6F, 0x6E, 0x9A, 0xBA, 0x97, 0xCD, 0xA2, 0x66, 0xA7, 0x46, 0x59, 0x6B, 0xC0, 0x7F, 0x5A,
+    0x66, 0x12, 0x14, 0xC6, 0x26, 0xC1, 0x55, 0x7A, 0x26, 0xCA, 0x17, 0xC1, 0x1E, 0x17, 0x1E, 0xC2,
+    0x20, 0x1B, 0xC0, 0x69, 0x1B, 0x14, 0xC2, 0x66, 0xC2, 0x1B, 0x1E, 0xC1, 0x16, 0x11, 0x69, 0xC0,
+    0x11, 0xC4, 0x0E, 0x02, 0x3F, 0xC0, 0x06, 0x66, 0x06, 0xC4, 0x01, 0xC2, 0x56, 0x69, 0x2F, 0xC0,
+    0x39, 0x34, 0xC0, 0x5A, 0x69, 0x21, 0x9F, 0xB8, 0x9C, 0xFA, 0xFE, 0x93, 0x0D, 0xA7, 0x95, 0xA3,
+    0x85, 0x69, 0x6D, 0x1D, 0x51, 0x51, 0xC0, 0x09, 0x2C, 0xA2, 0x77, 0x6E, 0x31, 0x2E, 0x09, 0x66,
+    0x5A, 0x35, 0x66, 0x35, 0x01, 0xC0, 0x1D, 0x31, 0x00, 0x31, 0xC0, 0x36, 0xC0, 0x31, 0x7E, 0x9C,
+    0x8B, 0x98, 0x9D, 0xFE, 0x8B, 0xCF, 0x1C, 0x33, 0x3F, 0xC0, 0x7B, 0x5E, 0xC1, 0x69, 0x56, 0xC1,
+    0x6E, 0x3C, 0x5A, 0x66, 0x3C, 0x01, 0x0B, 0xC5, 0x06, 0xC5, 0x0B, 0xC2, 0x5A, 0xC0, 0x01, 0xC5,
+    0x41, 0x95, 0xDD, 0x5A, 0xA8, 0x45, 0x55, 0xA2, 0x67, 0x66, 0x6F, 0xC0, 0x66, 0xC0, 0x14, 0xC6,
+    0x26, 0xCA, 0x59, 0x17, 0x1C, 0x17, 0xC0, 0x66, 0xC2, 0x5A, 0xC0, 0x6E, 0x0F, 0xC0, 0x14, 0xC0,
+    0x6B, 0xC2, 0x14, 0xC2, 0x0F, 0xC1, 0x1E, 0xC2, 0x19, 0x11, 0xC3, 0x0E, 0x65, 0xC0, 0x09, 0x02,
+    0x3F, 0x66, 0x6B, 0x3A, 0xC1, 0x01, 0xC5, 0x3E, 0x76, 0x5A, 0x69, 0xC1, 0x39, 0xC0, 0x66, 0x5A,
+    0x65, 0xA0, 0xA7, 0x9D, 0xD9, 0xFE, 0x8B, 0x8F, 0x9E, 0xD9, 0xA7, 0x94, 0xA2, 0x86, 0x36, 0x2F,
+    0x22, 0x9D, 0xBA, 0x56, 0x51, 0xC0, 0x35, 0x7E, 0x04, 0x5A, 0xC0, 0xA2, 0x87, 0x1D, 0x2C, 0x6E,
+    0xC1, 0x1D, 0x51, 0xC0, 0x22, 0x36, 0xC0, 0x31, 0x36, 0xC0, 0x31, 0x7E, 0x9C, 0x8B, 0x98, 0x9D,
+    0xA7, 0x04, 0xFE, 0x74, 0x92, 0xA3, 0x47, 0xA2, 0x67, 0x5B, 0xC4, 0x55, 0x6E, 0x3C, 0x01, 0x3C,
+    0x5A, 0xC0, 0x3C, 0x0B, 0xC6, 0x06, 0xC5, 0x0B, 0xC3, 0x5A, 0x01, 0xC5, 0x2A, 0x96, 0xDD, 0x41,
+    0xA9, 0x33, 0x5A, 0x6F, 0x66, 0x6F, 0xC0, 0x66, 0xC0, 0x14, 0xC6, 0x26, 0xC2, 0x2B, 0x26, 0xC5,
+    0x5A, 0x1E, 0x17, 0xC0, 0x66, 0xC0, 0x0A, 0xC0, 0x6E, 0xC4, 0x5A, 0x0F, 0x16, 0xC1, 0x1B, 0x69,
+    0x1B, 0xC0, 0x14, 0x0F, 0xC1, 0x14, 0x1E, 0xC1, 0x19, 0x11, 0xC1, 0x13, 0x0E, 0x07, 0x02, 0x3F,
+    0xC1, 0x6B, 0xC7, 0x66, 0xC1, 0x3E, 0xC0, 0x76, 0x32, 0xC2, 0x6B, 0xC0, 0x34, 0xC0, 0x21, 0x9F,
+    0xB8, 0x9D, 0xD9, 0xFE, 0x8B, 0x2D, 0xA3, 0xC7, 0xA8, 0x63, 0x79, 0x05, 0x55, 0x31, 0x2C, 0xA2,
+    0x77, 0x31, 0x2C, 0x09, 0x51, 0xC0, 0x09, 0x29, 0xA2, 0x77, 0x05, 0xC0, 0x00, 0x31, 0xC4, 0x36,
+    0xC0, 0x31, 0xC1, 0x36, 0xC0, 0x9C, 0xAB, 0x99, 0x8C, 0xA5, 0x16, 0xFE, 0x7C, 0x73, 0xA4, 0x25,
+    0x07, 0x5B, 0xC1, 0x6E, 0x0B, 0xC0, 0x5A, 0xC0, 0x65, 0x6E, 0x3C, 0xC1, 0x01, 0x10, 0xC1, 0x0B,
+    0xC3, 0x3F, 0x06, 0x3C, 0x03, 0xC1, 0x0B, 0xC3, 0x08, 0xC6, 0x55, 0x69, 0x97, 0xCD, 0x2F, 0xA8,
+    0x34, 0x6F, 0x0D, 0x08, 0x6F, 0xC0, 0x66, 0xC0, 0x14, 0xC6, 0x26, 0x2B, 0x26, 0x2B, 0xC1, 0x26,
+    0xC4, 0x23, 0xC1, 0x17, 0x12, 0xC0, 0x0A, 0xC0, 0x6E, 0xC0, 0x0A, 0xC2, 0x07, 0x6E, 0x16, 0xC3,
+    0x6E, 0x69, 0x0F, 0xC2, 0x1E, 0xC2, 0x16, 0x11, 0xC0, 0x0E, 0xC1, 0x07, 0x3F, 0xC2, 0x06, 0xC8,
+    0x66, 0xC0, 0x3E, 0xC0, 0x66, 0x69, 0xC2, 0x39, 0xC0, 0x34, 0x32, 0x24, 0x9F, 0xB8, 0x9B, 0xFA,
+    0x9D, 0xF9, 0xA5, 0x95, 0x3D, 0x2C, 0x31, 0xC1, 0x38, 0x2C, 0x31, 0xC6, 0x29, 0xC0, 0x31, 0x38,
+    0x3D, 0xC0, 0x31, 0x3D, 0x69, 0xC1, 0x3D, 0x36, 0x31, 0xC1, 0x42, 0x98, 0x9C, 0xA5, 0x27, 0xFE,
+    0x7C, 0x93, 0xA3, 0x36, 0x0E, 0x0B, 0x06, 0x0B, 0xC0, 0x5A, 0xC2, 0x69, 0xC3, 0x0B, 0x10, 0xC1,
+    0x0B, 0xC3, 0x3F, 0x06, 0xC0, 0x03, 0xC1, 0x0B, 0xC3, 0x08, 0xC5, 0x01, 0x56, 0x69, 0x99, 0xBC,
+    0x9B, 0x9A, 0xA6, 0x56, 0xA3, 0x66, 0x0D, 0x6B, 0xC1, 0x66, 0xC0, 0x14, 0xC6, 0x2B, 0xC6, 0x66,
+    0x56, 0xC1, 0x26, 0xC0, 0x23, 0x1E, 0xC0, 0x12, 0xC1, 0x5A, 0xC0, 0x0A, 0x07, 0x02, 0x07, 0xC2,
+    0x0C, 0xC0, 0x07, 0x0C, 0xC4, 0x7E, 0x23, 0xC2, 0x16, 0x11, 0x56, 0x0E, 0xC1, 0x3F, 0x66, 0xC0,
+    0x3F, 0xC0, 0x67, 0x06, 0xC6, 0x01, 0xC0, 0x3E, 0xC0, 0x69, 0x67, 0x69, 0xC3, 0x39, 0x66, 0x7D,
+    0x71, 0x9D, 0xD9, 0xFE, 0x8B, 0x6E, 0xA2, 0xB6, 0xA5, 0x95, 0x31, 0x00, 0xC0, 0x05, 0x31, 0xC0,
+    0x00, 0xC0, 0x05, 0x6E, 0x05, 0x31, 0x18, 0x55, 0xC0, 0x51, 0xC0, 0x09, 0x6E, 0x1D, 0x22, 0x31,
+    0x6E, 0xC3, 0x6F, 0x36, 0x31, 0x7E, 0x2E, 0x96, 0xBF, 0xA5, 0x15, 0xFE, 0x84, 0x93, 0xA3, 0x26,
+    0xA2, 0x68, 0x0B, 0x06, 0x0B, 0x08, 0xC3, 0x59, 0x08, 0x69, 0x66, 0xC0, 0x01, 0x7F, 0xC1, 0x0B,
+    0x69, 0x0B, 0xC1, 0x3F, 0xC1, 0x0B, 0xC0, 0x03, 0x0B, 0xC2, 0x08, 0xC7, 0x3C, 0x56, 0x9B, 0x9A,
+    0x9A, 0xAA, 0xA7, 0x55, 0xA2, 0x67, 0x56, 0x6F, 0xCB, 0x2B, 0xC2, 0x26, 0x2B, 0xC1, 0x26, 0x1E,
+    0x17, 0x1E, 0x26, 0xC1, 0x1E, 0xC0, 0x65, 0xC1, 0x0F, 0xC0, 0x66, 0x07, 0x65, 0xC0, 0x6B, 0x07,
+    0xC3, 0x0C, 0x07, 0x69, 0xC1, 0x07, 0x0F, 0x6E, 0x23, 0xC0, 0x1E, 0x16, 0x07, 0x02, 0x06, 0x0B,
+    0x65, 0xC0, 0x66, 0x3F, 0x3A, 0xC0, 0x6B, 0xC6, 0x37, 0xC0, 0x01, 0x5A, 0x37, 0xC0, 0x67, 0x32,
+    0xC3, 0x39, 0x2D, 0x7E, 0x9E, 0xC8, 0x9B, 0xFA, 0x9C, 0xE9, 0xA5, 0x95, 0xA4, 0x96, 0x76, 0xC0,
+    0x9D, 0xAA, 0x55, 0x51, 0x55, 0x6B, 0x09, 0x22, 0xA2, 0x77, 0x61, 0x09, 0x55, 0x09, 0x1D, 0x18,
+    0x59, 0x09, 0x35, 0xC0, 0x04, 0x1D, 0x2E, 0x36, 0x02, 0x36, 0x31, 0x36, 0x02, 0x36, 0x00, 0x3D,
+    0x95, 0xCF, 0xA4, 0x16, 0xFE, 0x84, 0x73, 0xA4, 0x16, 0xA2, 0x67, 0x0B, 0x06, 0x5E, 0xC4, 0x5A,
+    0x08, 0x69, 0x66, 0xC1, 0x0B, 0x6E, 0xC0, 0x0B, 0x69, 0x0B, 0xC1, 0x3F, 0xC0, 0x0B, 0xC1, 0x03,
+    0xC0, 0x0B, 0xC0, 0x08, 0xC8, 0x01, 0x52, 0x9B, 0x9A, 0x9A, 0xBA, 0xA7, 0x45, 0xA2, 0x67, 0x56,
+    0x0D, 0x6B, 0xCA, 0x2B, 0xC1, 0x26, 0xC4, 0x65, 0x6B, 0x26, 0xC0, 0x2B, 0x26, 0x12, 0x17, 0xC0,
+    0x12, 0xC0, 0x5E, 0x0F, 0x0A, 0x59, 0x07, 0xC3, 0x0C, 0x0F, 0x07, 0x0C, 0xC0, 0x00, 0xC3, 0x0F,
+    0x14, 0x0F, 0xC0, 0x07, 0x66, 0x07, 0x0B, 0xC0, 0x04, 0x66, 0xC0, 0x3C, 0xC1, 0x03, 0xC0, 0x3E,
+    0xC0, 0x7A, 0xC1, 0x59, 0xC3, 0x34, 0xC0, 0x3E, 0x32, 0xC3, 0x2D, 0xC0, 0x79, 0x9D, 0xDA, 0xFE,
+    0x83, 0x8F, 0xA0, 0xC7, 0xA7, 0x83, 0xA2, 0x86, 0x67, 0x71, 0x9D, 0xAA, 0x56, 0x18, 0x5E, 0x09,
+    0x35, 0xC2, 0x7F, 0x22, 0xA3, 0x77, 0x7A, 0x56, 0x05, 0x69, 0x31, 0x1D, 0x09, 0x55, 0xA2, 0x77,
+    0x22, 0xA3, 0x66, 0xC0, 0x36, 0xC2, 0x7A, 0x5B, 0xFE, 0xB2, 0xED, 0xA4, 0x16, 0x24, 0xA4, 0x16,
+    0xA2, 0x67, 0x0B, 0x06, 0x0B, 0x5A, 0xC2, 0x5A, 0xC0, 0x08, 0xC0, 0x3C, 0xC0, 0x08, 0x0B, 0x6E,
+    0xC0, 0x0B, 0xC7, 0x69, 0x3C, 0xC1, 0x04, 0x08, 0xC0, 0x3C, 0xC2, 0x03, 0x08, 0xC1, 0x69, 0x56,
+    0x99, 0xBB, 0x9B, 0x9A, 0xA7, 0x55, 0xA2, 0x67, 0x56, 0x0D, 0x6B, 0xCA, 0x2B, 0xC0, 0x26, 0x2B,
+    0x26, 0xC2, 0x17, 0xC0, 0x21, 0x26, 0x6F, 0xC0, 0x26, 0x12, 0x1E, 0x12, 0xC0, 0x0F, 0xC1, 0x0A,
+    0x07, 0xC1, 0x66, 0xC0, 0x07, 0xC5, 0x69, 0xC1, 0x07, 0x0F, 0xC2, 0x07, 0xC0, 0x04, 0x0B, 0xC0,
+    0x04, 0x66, 0x3C, 0xC2, 0x03, 0xC0, 0x66, 0xC3, 0x37, 0xC3, 0x5A, 0xC0, 0x37, 0xC2, 0x66, 0xC0,
+    0x56, 0x32, 0x71, 0x9D, 0xE8, 0xFE, 0x8B, 0x4E, 0xA3, 0xA5, 0xA7, 0x73, 0x75, 0x36, 0x31, 0x2C,
+    0x7F, 0xA2, 0x66, 0x5A, 0x36, 0x56, 0x22, 0x1A, 0x1D, 0x31, 0x7E, 0x6B, 0x39, 0x31, 0xC0, 0x36,
+    0xC0, 0x7E, 0x36, 0x22, 0x1D, 0x31, 0x36, 0xC4, 0x31, 0x6F, 0x15, 0xA4, 0x16, 0xFE, 0x84, 0x93,
+    0xA4, 0x16, 0x0E, 0x0B, 0xC0, 0x5A, 0xC3, 0x5A, 0xC0, 0x08, 0xC0, 0x03, 0x3C, 0x08, 0x0B, 0x6E,
+    0xC0, 0x0B, 0xC7, 0x04, 0x3C, 0xC2, 0x08, 0xC0, 0x3C, 0xC3, 0x03, 0x08, 0xC0, 0x59, 0x66, 0x99,
+    0xBB, 0x9A, 0xAB, 0xA8, 0x44, 0x6F, 0x5A, 0xC0, 0x14, 0xCA, 0x26, 0xC1, 0x2B, 0xC1, 0x26, 0x59,
+    0x1E, 0x69, 0x1E, 0x26, 0x6F, 0x66, 0x1E, 0xC0, 0x66, 0x12, 0x0F, 0xC0, 0x16, 0xC0, 0x0A, 0x07,
+    0xC3, 0x6F, 0xC2, 0x0C, 0xC0, 0x07, 0xC1, 0x69, 0x0C, 0x0F, 0x6F, 0xC0, 0x16, 0x13, 0x0E, 0x04,
+    0x6B, 0xC0, 0x04, 0x66, 0x3C, 0xC1, 0x03, 0xC1, 0x66, 0x03, 0x37, 0x3E, 0x37, 0xC2, 0x3C, 0x39,
+    0x67, 0xC0, 0x3E, 0x37, 0x3C, 0xC0, 0x37, 0xC0, 0x56, 0x75, 0x23, 0xFE, 0x83, 0xAF, 0x9C, 0xF9,
+    0xA8, 0x73, 0x36, 0x65, 0x31, 0x36, 0x6F, 0x6E, 0x51, 0x36, 0x02, 0xC0, 0x36, 0xC2, 0x02, 0x36,
+    0x31, 0x36, 0xC2, 0x31, 0x36, 0x7E, 0x36, 0x56, 0x31, 0x3D, 0xC1, 0x2E, 0x36, 0x7B, 0x02, 0x96,
+    0xBE, 0xA1, 0x37, 0xFE, 0x84, 0xB2, 0xA4, 0x16, 0x04, 0x5B, 0x03, 0xC0, 0x08, 0xC3, 0x05, 0x08,
+    0xC0, 0x03, 0x08, 0x01, 0x04, 0x10, 0xC1, 0x0B, 0xC6, 0x01, 0x3C, 0x01, 0xC1, 0x3C, 0xC3, 0x34,
+    0x08, 0x3C, 0x08, 0xC0, 0x39, 0x55, 0x9A, 0xBB, 0x9A, 0xAB, 0xA8, 0x34, 0xA2, 0x77, 0x56, 0x14,
+    0x66, 0xC2, 0x14, 0xC6, 0xA7, 0xC3, 0xC0, 0x2B, 0xC0, 0x26, 0xC0, 0x59, 0x17, 0xC1, 0x1E, 0x6E,
+    0x2D, 0x23, 0x1E, 0x19, 0xC0, 0x16, 0xC3, 0x55, 0xC1, 0x66, 0x07, 0xC0, 0x0E, 0xC2, 0x13, 0x0C,
+    0x07, 0xC2, 0x0C, 0x7A, 0x1B, 0xC0, 0x16, 0xC0, 0x0E, 0xC0, 0x0B, 0x04, 0xC0, 0x3F, 0x5A, 0x37,
+    0xC3, 0x6B, 0xC0, 0x55, 0x3E, 0x37, 0xC2, 0x34, 0xC0, 0x3B, 0x3E, 0xC0, 0x37, 0x3C, 0x37, 0x66,
+    0x37, 0x2F, 0xA0, 0xA8, 0xFE, 0x7C, 0x32, 0x9A, 0xFA, 0xA0, 0xD7, 0x36, 0x7A, 0x51, 0x36, 0xC0,
+    0x38, 0x6B, 0x61, 0x3D, 0x66, 0x31, 0xA2, 0x77, 0x36, 0xC0, 0x6E, 0x6B, 0xC0, 0x05, 0x2E, 0x02,
+    0x33, 0x3D, 0xA2, 0x66, 0x36, 0x31, 0x39, 0x36, 0x3D, 0xC1, 0x02, 0x3D, 0x36, 0x7B, 0x02, 0x97,
+    0xAD, 0x18, 0xFE, 0x84, 0xD2, 0xA4, 0x16, 0x04, 0x5B, 0x03, 0x6F, 0x08, 0xC2, 0x56, 0xC0, 0x08,
+    0x00, 0x03, 0x3C, 0x01, 0x0B, 0x6E, 0xC1, 0x0B, 0xC6, 0x01, 0x3C, 0x01, 0xC1, 0x3C, 0xC5, 0x08,
+    0xC0, 0x01, 0x56, 0x51, 0x9B, 0x99, 0x9B, 0xBB, 0xA7, 0x35, 0x7F, 0x5A, 0x14, 0xC1, 0x76, 0x6E,
+    0x14, 0x17, 0x14, 0xC4, 0x2B, 0xC2, 0x65, 0x1C, 0xC1, 0x66, 0x5A, 0x1E, 0xC3, 0x16, 0xC4, 0x0C,
+    0x66, 0xC0, 0x56, 0xC0, 0x07, 0x0E, 0x13, 0xC3, 0x07, 0xC3, 0x0C, 0x16, 0xC0, 0x1B, 0x16, 0xC0,
+    0x13, 0x0E, 0x04, 0x3F, 0x6F, 0xC0, 0x3F, 0x56, 0xC2, 0x32, 0x03, 0xC0, 0x2F, 0x3E, 0x37, 0xC4,
+    0x3E, 0xC1, 0x37, 0xC1, 0x32, 0xC1, 0x9E, 0xC9, 0x9C, 0xFA, 0x9B, 0xF9, 0xA4, 0xA5, 0xA7, 0x74,
+    0x36, 0x7E, 0x33, 0x6F, 0x2E, 0x33, 0x3D, 0xC0, 0x7A, 0xC0, 0x31, 0xC0, 0x36, 0x31, 0x36, 0xC0,
+    0x2E, 0x02, 0x33, 0x6B, 0xC0, 0x36, 0xC0, 0x3B, 0xC1, 0x02, 0x36, 0x3A, 0x02, 0x3D, 0x31, 0x00,
+    0xA2, 0x67, 0x97, 0xAD, 0x18, 0x2C, 0xA4, 0x26, 0x04, 0x5B, 0x03, 0x0F, 0x08, 0x5A, 0xC1, 0x66,
+    0xC2, 0x39, 0x7A, 0x0B, 0x10, 0xC5, 0x0B, 0xC0, 0x04, 0xC1, 0x01, 0x3C, 0x01, 0xC0, 0x3C, 0xC2,
+    0x01, 0x08, 0x3C, 0x39, 0xA2, 0x77, 0xC1, 0x01, 0x9D, 0x99, 0x9A, 0xAB, 0x9D, 0x99, 0xA6, 0x46,
+    0x6E, 0xA1, 0x89, 0xC0, 0x5A, 0xC0, 0x17, 0x14, 0x17, 0xC0, 0x14, 0xC4, 0x2B, 0xC2, 0x65, 0x1C,
+    0xC1, 0x66, 0x5A, 0x66, 0x1B, 0x7A, 0x1B, 0xC1, 0x66, 0xC0, 0x59, 0xC1, 0x07, 0xC0, 0x56, 0xC1,
+    0x07, 0x6B, 0x13, 0xC3, 0x07, 0xC3, 0x0C, 0x16, 0xC4, 0x0E, 0x07, 0x3F, 0x0E, 0x0B, 0x61, 0x37,
+    0xC2, 0x32, 0x03, 0xC0, 0x2F, 0x37, 0x32, 0x37, 0xC3, 0x6B, 0xC1, 0x37, 0xC0, 0x32, 0x37, 0x61,
+    0x76, 0xA0, 0xA8, 0xFE, 0x83, 0x90, 0x9C, 0xE9, 0xAB, 0x61, 0x79, 0x3B, 0x6F, 0x5E, 0x66, 0x6F,
+    0x66, 0x02, 0x38, 0x65, 0xA2, 0x77, 0xC0, 0x6E, 0x36, 0x31, 0x02, 0x33, 0x6F, 0x0B, 0x10, 0x7A,
+    0x0B, 0x9D, 0xA9, 0x33, 0x65, 0x36, 0x3B, 0x02, 0x3B, 0x33, 0x02, 0xC0, 0x36, 0xC0, 0x07, 0x98,
+    0xBD, 0x9D, 0x5A, 0xFE, 0x8C, 0xD2, 0xA3, 0x27, 0x47, 0x5B, 0xC0, 0x6F, 0x08, 0x5A, 0xC1, 0x66,
+    0xC3, 0x79, 0x7F, 0x6E, 0xC0, 0x0B, 0xC0, 0x10, 0xC1, 0x0B, 0xC0, 0x69, 0xC0, 0x5A, 0xC2, 0x3C,
+    0xC2, 0x01, 0xC0, 0x08, 0x3C, 0xC0, 0x39, 0x65, 0x10, 0x0D, 0x9D, 0x99, 0x98, 0xCC, 0x40, 0xA6,
+    0x45, 0x6F, 0xA1, 0x79, 0x7A, 0x14, 0xC6, 0x17, 0x14, 0xC1, 0xA8, 0xB2, 0xC1, 0x66, 0x1F, 0xC0,
+    0x23, 0xC0, 0x65, 0x5A, 0x66, 0x1B, 0xC2, 0x16, 0xC0, 0x5A, 0xC2, 0x65, 0xC0, 0x3F, 0xC1, 0x04,
+    0x13, 0xC1, 0x0E, 0x13, 0xC1, 0x0E, 0x07, 0xC1, 0x13, 0x16, 0xC0, 0x66, 0x16, 0xC1, 0x0E, 0xC0,
+    0x04, 0x0B, 0x3F, 0x3A, 0x5A, 0xC2, 0x32, 0x03, 0xC0, 0x51, 0x37, 0x32, 0x37, 0xC3, 0x3E, 0xC0,
+    0x5A, 0x34, 0xC1, 0x65, 0x7A, 0x9F, 0xB9, 0x9C, 0xEA, 0xFE, 0x83, 0x0E, 0xA4, 0xA5, 0xA7, 0x73,
+    0xA3, 0x65, 0x6F, 0x45, 0x41, 0x9B, 0xBB, 0xA2, 0x78, 0xA5, 0x75, 0x7A, 0x2E, 0x3D, 0x7A, 0x36,
+    0x65, 0xA2, 0x77, 0x36, 0x5F, 0x10, 0x55, 0x56, 0x9C, 0xAA, 0xA2, 0x77, 0xA3, 0x87, 0xA2, 0x77,
+    0x50, 0x33, 0x7E, 0xC0, 0x6E, 0x3B, 0x36, 0x6F, 0x36, 0xC1, 0x7F, 0x9A, 0x9B, 0x9C, 0x5B, 0xFE,
+    0x8C, 0xB2, 0xA3, 0x27, 0x4B, 0x5B, 0x6B, 0x6E, 0x08, 0xC0, 0x56, 0xC3, 0x6E, 0x00, 0x7D, 0x7B,
+    0x6E, 0xC0, 0x0B, 0xC0, 0x10, 0xC1, 0x0B, 0x69, 0xC1, 0x01, 0xC3, 0x66, 0xC0, 0x01, 0xC0, 0x3C,
+    0xC1, 0x01, 0x9A, 0xBB, 0x9B, 0xBB, 0xA8, 0x34, 0x01, 0x55, 0x96, 0xCD, 0x55, 0xA7, 0x45, 0x5A,
+    0xA1, 0x79, 0x7A, 0x14, 0xC4, 0x17, 0x5E, 0x14, 0xC2, 0xA8, 0xB2, 0xC0, 0x65, 0xC0, 0x26, 0xC0,
+    0x23, 0x1C, 0x56, 0xC2, 0x1B, 0xC2, 0x16, 0x5A, 0xC3, 0x55, 0x3F, 0xC1, 0x04, 0x0E, 0x13, 0xC4,
+    0x0E, 0xC0, 0x07, 0xC0, 0x13, 0x16, 0x66, 0x16, 0xC1, 0x11, 0x0E, 0xC1, 0x5A, 0x3F, 0x66, 0x5A,
+    0xC2, 0x66, 0x03, 0xC0, 0x32, 0x37, 0xC4, 0x6B, 0x66, 0x5E, 0x00, 0x69, 0x37, 0x69, 0xC0, 0x61,
+    0x9F, 0xB9, 0x9B, 0xFB, 0xFE, 0x9B, 0x2E, 0xA7, 0x74, 0xA4, 0x75, 0xA2, 0x76, 0x96, 0xAC, 0x96,
+    0xCC, 0x9B, 0xAC, 0x6F, 0x66, 0xAA, 0x53, 0xAD, 0x32, 0x75, 0x66, 0x3D, 0x7E, 0x51, 0xA2, 0x66,
+    0x6F, 0xA3, 0x56, 0x99, 0xAC, 0x92, 0xEF, 0x08, 0x66, 0xA2, 0x88, 0xA5, 0x55, 0xAD, 0x21, 0xA8,
+    0x64, 0x9D, 0xA9, 0x65, 0x69, 0x7F, 0x3B, 0xC1, 0x36, 0xC0, 0x69, 0x3B, 0x9B, 0x9C, 0x9B, 0x6B,
+    0xFE, 0x8C, 0x91, 0xA3, 0x27, 0xA1, 0x59, 0x5B, 0x6F, 0xC0, 0x69, 0x03, 0x69, 0x03, 0xC0, 0x5A,
+    0xC0, 0x6E, 0xC0, 0x08, 0x0B, 0x10, 0x7A, 0x0B, 0xC1, 0x10, 0xC0, 0x0B, 0x69, 0xC1, 0x5A, 0xC4,
+    0x3C, 0x01, 0xC0, 0x3C, 0x01, 0x3C, 0x01, 0x96, 0xDD, 0x98, 0xCD, 0xA9, 0x33, 0xA8, 0x44, 0x2D,
+    0x96, 0xBC, 0x6F, 0xA7, 0x44, 0x56, 0x6B, 0x6F, 0xC5, 0x19, 0xC0, 0x17, 0x14, 0xC1, 0x2B, 0xC0,
+    0x65, 0xC0, 0x26, 0xC0, 0x23, 0x1C, 0x56, 0xC2, 0x1B, 0xC1, 0x5A, 0x13, 0xC4, 0x04, 0xC0, 0x3F,
+    0xC0, 0x7E, 0x6B, 0x13, 0xC3, 0x0E, 0xC1, 0x07, 0xC0, 0x13, 0x7A, 0xC4, 0x0E, 0xC0, 0x07, 0x57,
+    0xC0, 0x65, 0x37, 0xC2, 0x66, 0x03, 0xC0, 0x37, 0x03, 0x37, 0xC2, 0x3E, 0xC0, 0x66, 0x5E, 0x00,
+    0x79, 0x30, 0x65, 0x7A, 0xA1, 0x97, 0x9C, 0xDB, 0xFE, 0x83, 0x8F, 0xFE, 0xAB, 0x2E, 0xA8, 0x64,
+    0xA6, 0x43, 0x91, 0xEE, 0x9B, 0x8A, 0xFE, 0xA4, 0x2E, 0xAB, 0x13, 0xA3, 0x77, 0x9B, 0xBB, 0xFE,
+    0x82, 0xCB, 0x71, 0xFE, 0xDC, 0xB2, 0x7A, 0x2E, 0x36, 0x6E, 0x51, 0xA6, 0x35, 0x99, 0x9B, 0x3D,
+    0xA8, 0x35, 0xAC, 0x23, 0xA4, 0x56, 0x9D, 0xAA, 0x97, 0xDC, 0xFE, 0x72, 0x08, 0xAF, 0x20, 0xA7,
+    0x54, 0x74, 0x38, 0x79, 0x3B, 0x36, 0x3B, 0x36, 0xC0, 0x2F, 0x33, 0x9D, 0x8A, 0x9A, 0x7C, 0xFE,
+    0x84, 0x91, 0xA3, 0x27, 0x3C, 0x6F, 0xC1, 0x66, 0xC0, 0x37, 0x3C, 0x5B, 0xC3, 0x03, 0x08, 0x7E,
+    0x7A, 0x56, 0xC1, 0x10, 0xC0, 0x0B, 0x04, 0xC1, 0x5A, 0xC4, 0x3C, 0xC0, 0x01, 0x3C, 0x01, 0x3C,
+    0x01, 0x97, 0xDD, 0x97, 0xCD, 0xA8, 0x44, 0xA9, 0x33, 0x50, 0x95, 0xDD, 0xA4, 0x56, 0xA6, 0x45,
+    0x56, 0x6B, 0x6F, 0xC5, 0x19, 0xC0, 0x17, 0xC0, 0x14, 0xC0, 0xA8, 0xB2, 0xC1, 0x65, 0x6B, 0xC0,
+    0x23, 0x69, 0x66, 0x5A, 0xC0, 0x6B, 0xC0, 0x18, 0xC1, 0x13, 0xC3, 0x04, 0xC3, 0x0E, 0x13, 0xC4,
+    0x0E, 0xC0, 0x04, 0x07, 0xC0, 0x13, 0x1B, 0x16, 0xC0, 0x66, 0xC0, 0x16, 0x0E, 0xC0, 0x3F, 0xC0,
+    0x06, 0x65, 0xC0, 0x03, 0xC0, 0x3E, 0x37, 0x03, 0xC0, 0x37, 0x03, 0x37, 0xC2, 0x3E, 0xC0, 0x66,
+    0x3E, 0x3C, 0x37, 0x9F, 0xB7, 0x61, 0xA0, 0xA8, 0x7A, 0x9D, 0xD9, 0x9A, 0xFC, 0xA2, 0xB8, 0xA7,
+    0x64, 0x9A, 0x99, 0x94, 0xBD, 0xFE, 0xCD, 0xB4, 0xFE, 0xFF, 0x9C, 0x5A, 0xA2, 0x77, 0x67, 0xFE,
+    0xDE, 0x17, 0xFE, 0x72, 0x48, 0xB0, 0x20, 0xA2, 0x97, 0x66, 0x33, 0xC0, 0x6E, 0xA3, 0x56, 0xFE,
+    0x8A, 0xC9, 0xFE, 0xC5, 0x12, 0xFE, 0xFF, 0x1B, 0xA4, 0x46, 0x67, 0xA2, 0x66, 0x9B, 0xDB, 0xFE,
+    0xB4, 0x92, 0xFE, 0x7A, 0x48, 0xFE, 0xD4, 0xD1, 0xA0, 0xA8, 0x3D, 0x3B, 0x55, 0x36, 0x02, 0xC0,
+    0x36, 0x69, 0x2C, 0x9D, 0x8B, 0x9B, 0x7A, 0xFE, 0x84, 0x91, 0xA2, 0x37, 0xA2, 0x58, 0x5F, 0x6B,
+    0x66, 0xC0, 0x69, 0x56, 0x6E, 0x6B, 0xC3, 0x39, 0x08, 0x7E, 0x13, 0x56, 0xC4, 0x04, 0x01, 0xC1,
+    0x3C, 0xC0, 0x01, 0xC1, 0x3C, 0xC2, 0x01, 0x3C, 0x01, 0x9B, 0xAB, 0x97, 0xDD, 0xA8, 0x43, 0x01,
+    0x9C, 0x9A, 0x95, 0xDD, 0xA5, 0x55, 0xA5, 0x56, 0x46, 0x7F, 0x6F, 0xC4, 0x6E, 0xC1, 0x14, 0xC2,
+    0x2B, 0xC1, 0x26, 0xC0, 0x69, 0x5B, 0x1C, 0x17, 0x5A, 0xC0, 0x6B, 0xC0, 0x13, 0x69, 0xC0, 0x13,
+    0xC2, 0x0B, 0x69, 0xC0, 0x0B, 0x07, 0x6B, 0x13, 0xC2, 0x7A, 0x13, 0xC1, 0x04, 0xC0, 0x07, 0xC1,
+    0x16, 0xC0, 0x65, 0x6B, 0xC1, 0x0E, 0xC0, 0x55, 0xC1, 0x56, 0xC2, 0x3E, 0xC0, 0x03, 0xC2, 0x3E,
+    0xC5, 0x7A, 0x3A, 0x75, 0x9C, 0xEA, 0x9C, 0xC9, 0xA1, 0x97, 0x9F, 0xB9, 0x71, 0x9D, 0xCA, 0xA7,
+    0x74, 0xA6, 0x55, 0x8E, 0xDF, 0xFE, 0xB4, 0x6F, 0x0D, 0x5A, 0x97, 0xBD, 0x7F, 0xA9, 0x44, 0x75,
+    0xFE, 0x9B, 0xCE, 0x76, 0xA9, 0x63, 0x61, 0x61, 0x33, 0xA2, 0x67, 0x9D, 0x78, 0x98, 0xAC, 0xFE,
+    0xFF, 0x5B, 0xA2, 0x68, 0x9B, 0xAB, 0x6F, 0xA7, 0x44, 0x66, 0x9A, 0xDB, 0xFE, 0x7A, 0xEB, 0xAC,
+    0x41, 0xA3, 0x96, 0x3D, 0x33, 0x3B, 0xC0, 0x02, 0xC0, 0x65, 0x69, 0x46, 0x56, 0x9A, 0x7B, 0xFE,
+    0x8C, 0x6F, 0xA4, 0x27, 0xA0, 0x59, 0xA2, 0x58, 0xC0, 0x6B, 0x55, 0xC2, 0x00, 0xC1, 0x39, 0x34,
+    0x39, 0x7A, 0x7F, 0x13, 0x0B, 0xC3, 0x69, 0xC0, 0x01, 0xC0, 0x3C, 0xC0, 0x01, 0xC0, 0x3C, 0xC1,
+    0x01, 0xC1, 0x3C, 0x01, 0xC1, 0x3C, 0x01, 0x6F, 0x9A, 0xBA, 0x96, 0xCD, 0xA7, 0x44, 0xA3, 0x67,
+    0x5A, 0x6B, 0x6F, 0xC5, 0x19, 0xC0, 0x14, 0xC2, 0xA8, 0xB2, 0xC1, 0x26, 0xC0, 0x2B, 0x56, 0xC1,
+    0x1B, 0xC1, 0x18, 0x0C, 0xC0, 0x13, 0xC3, 0x0B, 0x69, 0x3F, 0xC0, 0x07, 0x0E, 0xC0, 0x13, 0xC5,
+    0x0B, 0x04, 0xC0, 0x07, 0x0C, 0x16, 0xC3, 0x11, 0x0E, 0xC0, 0x07, 0x57, 0xC0, 0x66, 0x59, 0xC0,
+    0x03, 0xC4, 0x66, 0xC0, 0x37, 0xC0, 0x3E, 0x03, 0xC0, 0x3E, 0x75, 0x7A, 0x70, 0xFE, 0x83, 0xAF,
+    0x9F, 0xB8, 0xA4, 0x96, 0x9C, 0xCA, 0x9A, 0xCB, 0xA3, 0x87, 0xAB, 0x32, 0x5E, 0xFE, 0x82, 0x68,
+    0xFE, 0xE6, 0x16, 0xFE, 0xFF, 0x9C, 0x9C, 0x9A, 0xFE, 0x52, 0xCA, 0xC0, 0xFE, 0xE7, 0x3C, 0xA5,
+    0x65, 0xFE, 0xBC, 0xF3, 0xFE, 0x93, 0x2C, 0xAF, 0x30, 0x9C, 0xBA, 0x75, 0x6F, 0xA3, 0x65, 0x97,
+    0xAC, 0x1A, 0xFE, 0xFF, 0x9C, 0x9B, 0xBC, 0xFE, 0x63, 0x0B, 0xA5, 0x56, 0xFE, 0xEF, 0x5D, 0xA4,
+    0x66, 0xC0, 0xFE, 0x93, 0xAE, 0xA3, 0x86, 0xA7, 0x74, 0x9D, 0xB9, 0x3B, 0x36, 0x02, 0x36, 0xC1,
+    0x2F, 0x5E, 0x52, 0x97, 0x9D, 0xFE, 0x94, 0x2F, 0xA4, 0x26, 0x4B, 0xA2, 0x48, 0xA2, 0x67, 0x5B,
+    0x39, 0xC2, 0x00, 0xC0, 0x6E, 0x39, 0xC1, 0x7A, 0x0B, 0x13, 0x0B, 0xC3, 0x04, 0xC1, 0x5A, 0x3C,
+    0xC1, 0x01, 0xC0, 0x3C, 0xC0, 0x01, 0x3C, 0x01, 0x3C, 0x01, 0x08, 0x01, 0x08, 0x7E, 0xC0, 0x98,
+    0xBC, 0x99, 0xBB, 0xA8, 0x33, 0xA2, 0x68, 0x55, 0x6B, 0x14, 0xC5, 0x19, 0xC0, 0x76, 0xC2, 0x2B,
+    0xC1, 0x26, 0xC0, 0x5A, 0xC2, 0x1B, 0xC1, 0x13, 0xC1, 0x5A, 0x18, 0x13, 0x10, 0x0B, 0x04, 0x66,
+    0xC2, 0x04, 0x7B, 0xC0, 0x13, 0xC3, 0x0B, 0x6D, 0xC0, 0x04, 0x7A, 0xC0, 0x16, 0xC1, 0x66, 0xC0,
+    0x0E, 0x07, 0x66, 0x3F, 0xC0, 0x06, 0x5A, 0xC0, 0x37, 0xC0, 0x03, 0xC0, 0x3E, 0xC6, 0x5A, 0x7F,
+    0x3E, 0x7A, 0x9E, 0xC9, 0x9D, 0xD8, 0xFE, 0x93, 0x8F, 0xA5, 0x95, 0xA3, 0xA6, 0x99, 0xDB, 0x98,
+    0xCC, 0xA7, 0x55, 0x0C, 0x49, 0xFE, 0x72, 0x06, 0xFE, 0xB4, 0xB0, 0xA5, 0x56, 0x9A, 0xAC, 0xFE,
+    0x20, 0xE2, 0xA6, 0x45, 0xFE, 0xDE, 0x99, 0xA9, 0x33, 0xFE, 0xAC, 0x70, 0x99, 0xEC, 0xAC, 0x42,
+    0x9D, 0xBA, 0x79, 0x66, 0x5E, 0x99, 0xAB, 0xA3, 0x46, 0xFE, 0xFF, 0x7C, 0x97, 0xDD, 0xFE, 0x20,
+    0xE3, 0xA4, 0x67, 0xFE, 0xDE, 0xDB, 0xA6, 0x55, 0x75, 0x29, 0xA1, 0xA7, 0x12, 0x9C, 0xCA, 0x02,
+    0x51, 0x7F, 0x69, 0x5A, 0x36, 0x65, 0xA2, 0x77, 0x41, 0x96, 0xBD, 0xA4, 0x26, 0xA3, 0x37, 0xA1,
+    0x59, 0xA4, 0x36, 0xA3, 0x37, 0x3C, 0x45, 0x6F, 0x39, 0xC0, 0x00, 0xC0, 0x05, 0x39, 0xC1, 0x3C,
+    0x7F, 0x13, 0x0B, 0xC3, 0x69, 0xC2, 0x66, 0x3C, 0xC1, 0x6E, 0x3C, 0xC1, 0x01, 0xC5, 0x6F, 0xC0,
+    0x98, 0xCB, 0x9A, 0xAB, 0xA8, 0x34, 0x7F, 0x45, 0x6F, 0x14, 0xC5, 0x6E, 0x14, 0x17, 0xC2, 0xA8,
+    0xA2, 0xC1, 0x56, 0xC3, 0x5A, 0x1B, 0xC0, 0x56, 0xC0, 0x59, 0x10, 0xC0, 0x7E, 0x10, 0xC0, 0x65,
+    0x3F, 0xC4, 0x7E, 0x0E, 0xC3, 0x0B, 0xC1, 0x09, 0x04, 0x07, 0xC0, 0x16, 0xC0, 0x11, 0xC1, 0x07,
+    0x66, 0xC0, 0x3F, 0x06, 0xC0, 0x03, 0x65, 0xC1, 0x6B, 0x03, 0x3E, 0x03, 0xC0, 0x3E, 0xC3, 0x00,
+    0x03, 0xC0, 0x76, 0x9E, 0xC8, 0x9B, 0xEA, 0xFE, 0x9B, 0x4E, 0xA9, 0x83, 0x9F, 0xB8, 0x98, 0xDB,
+    0x9C, 0xAA, 0xA9, 0x34, 0xA3, 0x66, 0xA0, 0x58, 0x90, 0xDF, 0x4A, 0xA5, 0x56, 0x42, 0x96, 0xCD,
+    0x6E, 0xFE, 0x93, 0xCE, 0xAC, 0x32, 0xFE, 0x8A, 0xEB, 0xAB, 0x42, 0xA5, 0x75, 0x9D, 0xBA, 0x7A,
+    0x65, 0x5E, 0x9C, 0x9A, 0x94, 0xBE, 0xFE, 0xC4, 0xF2, 0x2E, 0xFE, 0x28, 0xC2, 0xA3, 0x67, 0xFE,
+    0x8C, 0x10, 0xA4, 0x76, 0xA2, 0x86, 0xFE, 0x6A, 0x07, 0xFE, 0xC4, 0x71, 0xA3, 0x86, 0x9D, 0xB9,
+    0x7B, 0x75, 0x02, 0x66, 0x36, 0xC0, 0x34, 0x6E, 0x9B, 0xBB, 0x99, 0x9B, 0xA4, 0x46, 0xA2, 0x47,
+    0xA1, 0x49, 0xA3, 0x37, 0xA5, 0x26, 0xA1, 0x47, 0x46, 0xA2, 0x67, 0x7A, 0xC0, 0x00, 0xC1, 0x39,
+    0x66, 0x39, 0x7F, 0x0B, 0x10, 0x0B, 0x69, 0xC1, 0x0B, 0x04, 0xC2, 0x3C, 0xC6, 0x6E, 0xC0, 0x3C,
+    0xC3, 0x08, 0x6D, 0x9A, 0xBB, 0x98, 0xBC, 0xA7, 0x44, 0xA2, 0x67, 0x56, 0x6F, 0x67, 0x14, 0xC4,
+    0x6E, 0xC0, 0x14, 0xC2, 0xA8, 0xA2, 0x23, 0xC4, 0x20, 0x65, 0x6B, 0x18, 0x65, 0x10, 0x69, 0x10,
+    0x6E, 0x10, 0xC0, 0x04, 0xC0, 0x3C, 0xC0, 0x7A, 0xC1, 0x04, 0x3F, 0xC0, 0x04, 0x0E, 0xC0, 0x0B,
+    0xC0, 0x04, 0xC2, 0x07, 0xC0, 0x16, 0x11, 0xC0, 0x16, 0x11, 0x55, 0xC0, 0x6B, 0x5A, 0xC1, 0x5A,
+    0x65, 0xC1, 0x03, 0xC4, 0x66, 0xC2, 0x03, 0x56, 0x3E, 0x06, 0x9E, 0xC9, 0xFE, 0x7B, 0xD0, 0xFE,
+    0xA3, 0x4E, 0xA7, 0x94, 0x9C, 0xC9, 0x9A, 0xCA, 0xA4, 0x66, 0xA7, 0x45, 0x4E, 0x5F, 0x9F, 0x68,
+    0x6E, 0xA3, 0x67, 0x6F, 0x56, 0x9A, 0xBA, 0x95, 0xDE, 0x99, 0xCB, 0xA3, 0x87, 0xFE, 0xDC, 0xD1,
+    0x62, 0x75, 0x3D, 0x36, 0x33, 0x99, 0xAC, 0x94, 0xCD, 0xA4, 0x57, 0xA6, 0x45, 0xC0, 0x5A, 0x7F,
+    0x9C, 0xAA, 0x9A, 0xCB, 0x95, 0xFD, 0xFE, 0xC4, 0x0F, 0xA6, 0x65, 0x3F, 0x3A, 0x3D, 0x6E, 0xC1,
+    0x36, 0xA0, 0xA9, 0x50, 0x98, 0xCC, 0x5A, 0xA7, 0x35, 0xA3, 0x46, 0x9D, 0x7B, 0x9D, 0x6A, 0xFE,
+    0x84, 0xB3, 0xA1, 0x38, 0x4E, 0x5F, 0x05, 0x00, 0xC2, 0x39, 0x34, 0x7E, 0x08, 0x0B, 0x6E, 0xC0,
+    0x04, 0xC0, 0x0B, 0xC1, 0x65, 0xC2, 0x3C, 0xC6, 0x6E, 0x3C, 0xC2, 0x01, 0x6F, 0x69, 0x9D, 0x9A,
+    0x94, 0xEE, 0xA7, 0x44, 0xA2, 0x67, 0x5A, 0x6B, 0x6B, 0x6E, 0xCA, 0x23, 0xC0, 0x5A, 0xC2, 0x66,
+    0x69, 0x1B, 0x59, 0x66, 0x5A, 0x10, 0x6E, 0xC1, 0x10, 0x65, 0xC0, 0x3C, 0xC2, 0x3F, 0x04, 0xC3,
+    0x0B, 0xC2, 0x04, 0x3F, 0xC2, 0x7E, 0x0E, 0x7A, 0xC1, 0x0E, 0x66, 0x3F, 0x6B, 0xC2, 0x5A, 0xC0,
+    0x65, 0x3C, 0x03, 0xC5, 0x3E, 0xC2, 0x37, 0x03, 0x06, 0x3B, 0xFE, 0x7B, 0xF1, 0xFE, 0xAB, 0x6F,
+    0xA7, 0x93, 0x18, 0x9B, 0xBA, 0xAB, 0x22, 0xA3, 0x67, 0x5F, 0x02, 0xA2, 0x56, 0x5A, 0x6B, 0xC0,
+    0x21, 0xA4, 0x66, 0x9D, 0x99, 0x96, 0xDD, 0xA4, 0x76, 0xA4, 0x76, 0x9C, 0xBA, 0xC0, 0x3D, 0x31,
+    0xA2, 0x67, 0x2B, 0xA2, 0x67, 0x6E, 0x26, 0x6E, 0xA2, 0x78, 0x9C, 0xAA, 0xC0, 0x9C, 0xAA, 0x93,
+    0xFE, 0xAA, 0x43, 0xA4, 0x76, 0x66, 0x3A, 0x3D, 0xC0, 0x69, 0x02, 0x75, 0x66, 0x98, 0xCC, 0x61,
+    0xA7, 0x44, 0x39, 0x02, 0x47, 0x98, 0x7C, 0xFE, 0x84, 0x72, 0xA3, 0x27, 0x37, 0x5E, 0x05, 0xC2,
+    0x00, 0x65, 0x39, 0x7A, 0x6E, 0x0B, 0x10, 0x0B, 0x69, 0xC0, 0x0B, 0xC0, 0x65, 0xC5, 0x04, 0xC0,
+    0x3C, 0xC1, 0x01, 0xC3, 0x3C, 0x01, 0x6E, 0x01, 0x5A, 0x93, 0xEE, 0xA5, 0x55, 0xA3, 0x67, 0x5A,
+    0x08, 0x6F, 0xC2, 0x0F, 0x14, 0xC6, 0x20, 0xC4, 0x1B, 0x59, 0xC1, 0x0C, 0x5A, 0xC0, 0x15, 0xC0,
+    0x10, 0x09, 0x06, 0x66, 0xC1, 0x3C, 0xC0, 0x3F, 0x6E, 0xC3, 0x0B, 0xC1, 0x04, 0x3F, 0xC1, 0x66,
+    0x3F, 0x7A, 0x0E, 0x7A, 0x0E, 0xC0, 0x66, 0xC0, 0x56, 0x6E, 0xC2, 0x03, 0x65, 0xC0, 0x03, 0xC7,
+    0x66, 0xC0, 0x37, 0x03, 0x6F, 0x03, 0x9D, 0xDA, 0xFE, 0x83, 0xF1, 0xFE, 0xA3, 0x4E, 0xA7, 0xA4,
+    0x97, 0xDA, 0x65, 0xAC, 0x23, 0x55, 0x56, 0xA2, 0x57, 0xC0, 0x41, 0x51, 0x7F, 0xC0, 0x65, 0xA3,
+    0x67, 0xA4, 0x65, 0x6E, 0x9D, 0xAA, 0x33, 0x7E, 0x36, 0x66, 0xA2, 0x67, 0xC0, 0x5F, 0x65, 0x1C,
+    0x6E, 0x2B, 0x1C, 0xA3, 0x67, 0x18, 0x3F, 0x33, 0x02, 0x56, 0x02, 0x3A, 0x33, 0x36, 0xC1, 0x9B,
+    0xBB, 0x99, 0xCB, 0xA7, 0x54, 0xA6, 0x55, 0x28, 0x5E, 0xA2, 0x59, 0x97, 0x9D, 0xFE, 0x84, 0x11,
+    0xA5, 0x05, 0xA2, 0x47, 0x39, 0x00, 0xC0, 0x6E, 0xC0, 0x39, 0x34, 0x39, 0x7A, 0xC0, 0x04, 0x6B,
+    0x04, 0xC1, 0x0B, 0xC0, 0x65, 0xC5, 0x04, 0xC1, 0x5A, 0x3C, 0x01, 0xC2, 0x3C, 0xC1, 0x01, 0x6E,
+    0xC0, 0x96, 0xCD, 0x51, 0xA6, 0x45, 0x5A, 0x6F, 0x14, 0xC2, 0x66, 0x14, 0xC6, 0xA7, 0xA3, 0xC4,
+    0x1B, 0x69, 0x5B, 0x69, 0x56, 0xC0, 0x10, 0x15, 0xC0, 0x10, 0xC0, 0x06, 0x66, 0xC2, 0x3C, 0xC0,
+    0x7E, 0xC3, 0x6B, 0xC0, 0x04, 0x0B, 0x04, 0x3F, 0xC0, 0x66, 0x3F, 0x7E, 0x0E, 0xC3, 0x66, 0x5A,
+    0xC2, 0x3C, 0x37, 0x3C, 0xC1, 0x03, 0xC6, 0x3E, 0x66, 0x69, 0x03, 0x6E, 0x3E, 0x9F, 0xC8, 0x9C,
+    0xFA, 0xFE, 0xA3, 0x2E, 0xA8, 0x83, 0xFE, 0xC2, 0xA9, 0xA5, 0x65, 0xA9, 0x33, 0x42, 0x31, 0x5A,
+    0x69, 0x56, 0x9D, 0xAA, 0xC0, 0x51, 0x7A, 0x6E, 0x2E, 0x33, 0xA2, 0x76, 0x02, 0x36, 0x31, 0xC1,
+    0x02, 0x66, 0x2E, 0x9D, 0x99, 0x9D, 0xA9, 0x56, 0x66, 0x23, 0x06, 0x1F, 0x02, 0x3D, 0x2E, 0xA3,
+    0x67, 0x51, 0x02, 0xC0, 0x36, 0x31, 0x98, 0xCC, 0x7E, 0xA9, 0x33, 0x65, 0x51, 0x2A, 0x02, 0x99,
+    0x7D, 0xA3, 0x06, 0xA4, 0x27, 0x37, 0x5E, 0x6B, 0x5A, 0xC0, 0x69, 0x39, 0x34, 0x39, 0x3C, 0xC0,
+    0x04, 0x6B, 0xC0, 0x04, 0xC0, 0x0B, 0xC0, 0x3F, 0xC6, 0x04, 0x3C, 0xC8, 0x01, 0x6E, 0xC0, 0x9A,
+    0xBB, 0x97, 0xBD, 0xA7, 0x44, 0x6F, 0xA3, 0x67, 0x56, 0xC5, 0x7A, 0x14, 0xC3, 0xA6, 0xB4, 0x7A,
+    0xC0, 0x1B, 0xC0, 0x6E, 0x1B, 0x69, 0x18, 0x11, 0xC0, 0x10, 0xC0, 0x15, 0x10, 0xC0, 0x69, 0xC0,
+    0x01, 0xC1, 0x66, 0xC0, 0x04, 0xC5, 0x0B, 0xC0, 0x04, 0xC0, 0x3F, 0x3C, 0x3F, 0xC0, 0x07, 0x6B,
+    0xC3, 0x66, 0xC0, 0x5A, 0xC1, 0x3C, 0xC2, 0x03, 0xC3, 0x66, 0x03, 0xC0, 0x3E, 0x5A, 0x3E, 0xC0,
+    0x03, 0xC0, 0x76, 0x75, 0x9D, 0xE9, 0xFE, 0xA3, 0x4F, 0xA3, 0xA5, 0x98, 0xEA, 0x28, 0x25, 0x2A,
+    0x6F, 0x2E, 0x33, 0x36, 0x31, 0x36, 0x62, 0x31, 0x51, 0x6E, 0x36, 0x7F, 0x56, 0x31, 0x56, 0x2C,
+    0x56, 0xA2, 0x77, 0x3D, 0xC0, 0x31, 0x2E, 0x22, 0x1D, 0x22, 0x33, 0x02, 0xC0, 0x3D, 0xC3, 0x02,
+    0xC0, 0x22, 0x9A, 0xBB, 0x22, 0xA3, 0x86, 0x51, 0x9D, 0x99, 0x22, 0x3A, 0x99, 0x7C, 0xA3, 0x17,
+    0xA5, 0x06, 0xA2, 0x48, 0x5F, 0x00, 0x56, 0x6E, 0x00, 0x39, 0x34, 0x39, 0x7E, 0xC0, 0x04, 0xC0,
+    0x0B, 0xC3, 0x3F, 0xC6, 0x04, 0xC0, 0x3C, 0xC6, 0x01, 0xC0, 0x6E, 0xC0, 0x55, 0x92, 0xFF, 0xA4,
+    0x56, 0xA5, 0x57, 0x0D, 0x6F, 0x66, 0xCA, 0x1E, 0x1B, 0xC2, 0x6E, 0x1B, 0x11, 0xC0, 0x18, 0x56,
+    0xC1, 0x15, 0x10, 0xC0, 0x69, 0x04, 0x01, 0xC1, 0x3C, 0xC0, 0x04, 0xC6, 0x6B, 0x04, 0xC0, 0x3F,
+    0x3C, 0x3F, 0xC0, 0x07, 0x0E, 0xC2, 0x66, 0xC0, 0x5A, 0xC1, 0x3F, 0x3C, 0xC2, 0x39, 0x3C, 0x34,
+    0x3E, 0xC3, 0x3B, 0xC0, 0x3E, 0x69, 0x3E, 0x7A, 0xC0, 0x75, 0x9D, 0xE9, 0xFE, 0x9B, 0x4F, 0x9F,
+    0xD7, 0x9F, 0xB8, 0xAA, 0x32, 0x25, 0x6E, 0x36, 0x33, 0xC1, 0x36, 0xC1, 0x22, 0x99, 0xDC, 0xA6,
+    0x55, 0x05, 0xC0, 0x36, 0x02, 0x62, 0x29, 0x9C, 0xBA, 0x56, 0x2C, 0x31, 0x36, 0x02, 0xC3, 0x36,
+    0x31, 0x6F, 0xC3, 0x02, 0x3D, 0x29, 0x40, 0x36, 0x34, 0x97, 0xDC, 0xA3, 0x66, 0xA8, 0x34, 0x9E,
+    0x7A, 0x99, 0x7C, 0xA5, 0x06, 0xA5, 0x06, 0x32, 0x4F, 0x6E, 0xC1, 0x69, 0x39, 0xC0, 0x7A, 0x6E,
+    0xC1, 0x7A, 0xC0, 0x6B, 0xC3, 0x3F, 0xC5, 0x04, 0xC0, 0x3C, 0xC6, 0x01, 0xC0, 0x6E, 0xC0, 0x01,
+    0x92, 0xEF, 0xA3, 0x66, 0xA6, 0x46, 0x0D, 0x19, 0x14, 0xCA, 0xA6, 0xB4, 0xC0, 0x69, 0xC0, 0x1B,
+    0xC1, 0x11, 0x66, 0xC0, 0x5A, 0xC0, 0x15, 0xC0, 0x10, 0xC0, 0x04, 0xC0, 0x01, 0xC0, 0x3C, 0xC1,
+    0x04, 0xC1, 0x3F, 0xC0, 0x04, 0xC1, 0x6B, 0x04, 0xC0, 0x3F, 0x3C, 0x3F, 0xC1, 0x0E, 0xC2, 0x66,
+    0xC0, 0x5A, 0xC1, 0x3F, 0x04, 0x08, 0x3C, 0xC1, 0x56, 0xC0, 0x7B, 0xC4, 0x56, 0x7A, 0xC1, 0x3E,
+    0x7A, 0x75, 0x9C, 0xF9, 0xFE, 0x9B, 0x6F, 0xFE, 0xAA, 0xAB, 0xA9, 0x52, 0xA4, 0x76, 0x55, 0x2A,
+    0x2E, 0x33, 0xC1, 0x7A, 0xC0, 0x25, 0x9B, 0xAB, 0x7E, 0x25, 0xA2, 0x77, 0x36, 0x05, 0x56, 0x36,
+    0x3D, 0x9D, 0xA9, 0x21, 0x09, 0x05, 0x02, 0x36, 0xC1, 0x66, 0xC0, 0x36, 0x3D, 0xC4, 0x02, 0x3D,
+    0x51, 0x1F, 0x36, 0x9A, 0xCB, 0x9A, 0xCB, 0xA4, 0x66, 0x05, 0x9E, 0x69, 0x99, 0x7C, 0xFE, 0x84,
+    0x51, 0xA4, 0x16, 0xA1, 0x49, 0x5B, 0x6E, 0xC1, 0x79, 0x6B, 0x3C, 0xC0, 0x6E, 0xC1, 0x7A, 0xC0,
+    0x0B, 0xC1, 0x3F, 0xC7, 0x04, 0x3F, 0x3C, 0xC5, 0x01, 0xC2, 0x6E, 0x01, 0x93, 0xEE, 0x5F, 0xA7,
+    0x44, 0x5B, 0x6F, 0xCB, 0xA5, 0xC4, 0x6E, 0x0F, 0x14, 0xC1, 0x5A, 0x0C, 0xC0, 0x5A, 0xC1, 0x15,
+    0xC0, 0x10, 0xC0, 0x65, 0xC0, 0x01, 0x3C, 0xC2, 0x04, 0xC2, 0x3F, 0xC0, 0x04, 0xC0, 0x10, 0x04,
+    0xC0, 0x3F, 0x3C, 0x3F, 0xC0, 0x04, 0x07, 0xC1, 0x67, 0x69, 0x5B, 0xC2, 0x3F, 0xC0, 0x5B, 0x3C,
+    0x37, 0x34, 0xC1, 0x37, 0xC1, 0x3E, 0xC0, 0x56, 0xC0, 0x7A, 0xC2, 0x7E, 0x70, 0x9E, 0xD8, 0xFE,
+    0x9B, 0x6E, 0x9C, 0xFA, 0xAA, 0x52, 0x7E, 0x59, 0x6F, 0x31, 0xA2, 0x66, 0x5A, 0x33, 0xC0, 0x65,
+    0x9A, 0xCB, 0x26, 0x2A, 0xC0, 0x25, 0xA2, 0x77, 0x31, 0x36, 0x6F, 0xC0, 0x33, 0x9B, 0xBB, 0x21,
+    0xAB, 0x22, 0x02, 0x36, 0xC2, 0x31, 0x36, 0x02, 0x66, 0xC3, 0x02, 0x3D, 0x55, 0xC0, 0x65, 0x99,
+    0xDB, 0xA2, 0x88, 0x24, 0x02, 0x9C, 0x7A, 0x9C, 0x5A, 0xFE, 0x7C, 0x72, 0xA3, 0x27, 0xA2, 0x47,
+    0x5B, 0xC1, 0x00, 0x39, 0xC0, 0x3C, 0x6E, 0xC2, 0x3C, 0xC0, 0x3F, 0xCA, 0x04, 0x3F, 0x3C, 0xC5,
+    0x01, 0xC4, 0x94, 0xEE, 0x45, 0xA7, 0x45, 0x08, 0x6B, 0x6E, 0xC9, 0x0F, 0xA6, 0xB3, 0xC1, 0x0C,
+    0xC2, 0x5A, 0xC2, 0x10, 0x15, 0xC0, 0x10, 0x0B, 0x04, 0xC0, 0x66, 0x3C, 0xC1, 0x3F, 0x04, 0xC2,
+    0x3F, 0x04, 0xC1, 0x0B, 0x04, 0xC0, 0x3F, 0x3C, 0x3F, 0xC0, 0x04, 0x07, 0x66, 0xC2, 0x5B, 0xC2,
+    0x3F, 0xC0, 0x0B, 0x3C, 0x66, 0xC7, 0x66, 0x5A, 0x7B, 0xC1, 0x3E, 0x79, 0x70, 0x9E, 0xD9, 0xFE,
+    0x9B, 0x4D, 0xA1, 0xC7, 0x36, 0x69, 0x36, 0x6E, 0x36, 0x3B, 0xC0, 0x38, 0x36, 0x9C, 0xAA, 0x9D,
+    0xA9, 0xA6, 0x55, 0x34, 0xC1, 0x6E, 0xC0, 0x05, 0x5A, 0x51, 0x31, 0x02, 0x26, 0x22, 0x05, 0x02,
+    0x36, 0x02, 0xC0, 0x36, 0xC1, 0x6B, 0xC6, 0x3B, 0x9C, 0xBA, 0x62, 0x7A, 0x9B, 0x9A, 0xAC, 0x03,
+    0x98, 0x8C, 0xA0, 0x38, 0xFE, 0x74, 0x92, 0xA3, 0x27, 0x5F, 0x5B, 0xC1, 0x39, 0xC1, 0x3C, 0xC0,
+    0x01, 0xC1, 0x3C, 0xC0, 0x3F, 0xCC, 0x3C, 0xC5, 0x01, 0x04, 0x5E, 0x01, 0xC0, 0x09, 0x96, 0xCD,
+    0x9C, 0x9A, 0xA7, 0x45, 0x08, 0x6B, 0x14, 0xCA, 0xA5, 0xC4, 0x5A, 0xC4, 0x09, 0xC1, 0x10, 0x6E,
+    0x7A, 0x15, 0x10, 0xC1, 0x04, 0xC1, 0x66, 0xC0, 0x04, 0xC0, 0x0B, 0xC0, 0x7A, 0x0B, 0xC0, 0x04,
+    0x0B, 0xC0, 0x04, 0xC0, 0x3F, 0x3C, 0x3F, 0xC0, 0x04, 0xC0, 0x07, 0xC0, 0x0E, 0x07, 0x57, 0xC2,
+    0x3F, 0xC0, 0x0B, 0x3C, 0x66, 0xC5, 0x3E, 0xC0, 0x37, 0xC0, 0x67, 0xC1, 0x7E, 0x65, 0x9E, 0xC8,
+    0x9D, 0xE9, 0xFE, 0xA3, 0x4D, 0xA5, 0x95, 0x36, 0xC0, 0x3B, 0xC0, 0x36, 0xC0, 0x33, 0xC0, 0x36,
+    0x9A, 0xBB, 0xA3, 0x77, 0xA5, 0x65, 0x99, 0xCC, 0x55, 0x34, 0x6F, 0x36, 0x51, 0xC0, 0x36, 0xC0,
+    0x0A, 0x3A, 0xA3, 0x66, 0x0A, 0x02, 0x36, 0xC3, 0x6B, 0xC6, 0x02, 0xC0, 0x2A, 0x7F, 0x9D, 0xA9,
+    0x9C, 0x9B, 0xA8, 0x14, 0x98, 0x7D, 0xA4, 0x16, 0xA5, 0x05, 0xA2, 0x48, 0x6F, 0x5B, 0xC1, 0x39,
+    0xC0, 0x66, 0x7E, 0xC0, 0x6F, 0x69, 0xC0, 0x3C, 0xC0, 0x3F, 0xCC, 0x3C, 0xC5, 0x01, 0xC0, 0x04,
+    0x01, 0xC0, 0x15, 0x97, 0xCC, 0x9A, 0xAB, 0xA7, 0x45, 0x5F, 0x6E, 0x14, 0xCA, 0xA4, 0xD5, 0x07,
+    0xC0, 0x6E, 0x07, 0xC0, 0x04, 0x09, 0x04, 0x0C, 0x6B, 0x18, 0x13, 0x18, 0x13, 0xC2, 0x0B, 0x04,
+    0xC2, 0x0B, 0x0E, 0xC2, 0x0B, 0xC0, 0x04, 0xC1, 0x66, 0xC1, 0x04, 0x3F, 0x04, 0xC0, 0x07, 0xC0,
+    0x0E, 0xC0, 0x0B, 0x06, 0xC1, 0x3F, 0xC0, 0x0B, 0x3C, 0x66, 0xC6, 0x3E, 0x37, 0xC0, 0x3E, 0x66,
+    0x3E, 0x06, 0x70, 0x9E, 0xC9, 0x9B, 0xFA, 0xFE, 0xAB, 0x6E, 0x29, 0x7E, 0x6E, 0x3B, 0x36, 0xC1,
+    0x33, 0xC0, 0x36, 0x9B, 0xBB, 0x66, 0x7E, 0x9D, 0x9A, 0x9D, 0xA9, 0x2C, 0x05, 0x31, 0x99, 0xBC,
+    0xC0, 0xA5, 0x55, 0x36, 0xC0, 0x04, 0x09, 0x36, 0xC1, 0x02, 0xC1, 0x66, 0x36, 0x3D, 0xC5, 0x02,
+    0x3B, 0x36, 0x7A, 0x66, 0x29, 0x9E, 0x69, 0x9E, 0x39, 0xA6, 0x05, 0xA3, 0x27, 0xA1, 0x48, 0x7F,
+    0x5B, 0x65, 0x7F, 0x39, 0x66, 0xC0, 0x37, 0x3C, 0x6F, 0x79, 0x3C, 0xC3, 0x3F, 0xC4, 0x3C, 0xC0,
+    0x3F, 0xC2, 0x3C, 0xC6, 0x01, 0x04, 0x01, 0xC0, 0xA3, 0x66, 0x98, 0xCC, 0x98, 0xBC, 0xA7, 0x45,
+    0x5B, 0x0D, 0x14, 0xCA, 0x07, 0x69, 0xC1, 0x07, 0x59, 0x07, 0x6E, 0x04, 0x0C, 0x6B, 0xC8, 0x04,
+    0xC0, 0x0B, 0x13, 0x0E, 0xC2, 0x0B, 0x04, 0xC2, 0x66, 0xC0, 0x04, 0xC3, 0x3F, 0xC2, 0x06, 0xC2,
+    0x3F, 0x04, 0x57, 0x3C, 0xC2, 0x66, 0xC3, 0x6B, 0x5A, 0xC2, 0x3E, 0x06, 0x25, 0x9E, 0xD9, 0x9A,
+    0xFB, 0xA0, 0xE7, 0xA6, 0x85, 0x65, 0xA2, 0x76, 0x5A, 0x33, 0x36, 0xC0, 0x33, 0xC0, 0x36, 0x9D,
+    0xAB, 0x21, 0x3A, 0xA1, 0x98, 0x21, 0xA6, 0x55, 0x31, 0x9B, 0xAB, 0x35, 0x22, 0x35, 0x3A, 0xC1,
+    0x22, 0x36, 0xC6, 0x3D, 0xC0, 0x66, 0x3D, 0xC2, 0x02, 0x3B, 0x36, 0x65, 0x3E, 0x33, 0x99, 0x7C,
+    0xA2, 0x17, 0xA7, 0x05, 0xA2, 0x38, 0x4A, 0x39, 0x6B, 0x66, 0x00, 0x39, 0x34, 0x37, 0x3C, 0xC0,
+    0x08, 0x04, 0x3C, 0xC1, 0x37, 0xC2, 0x3F, 0xC2, 0x3C, 0xC1, 0x3F, 0xC1, 0x3C, 0xC6, 0x04, 0xC0,
+    0x5A, 0xC0, 0xA3, 0x76, 0x99, 0xBC, 0x97, 0xCC, 0xA7, 0x35, 0x5E, 0x0D, 0x14, 0xCA, 0xA4, 0xD5,
+    0xC0, 0x07, 0xC3, 0x6E, 0x07, 0xC1, 0x13, 0xC7, 0x0B, 0xC0, 0x0E, 0xC4, 0x0B, 0x04, 0xC0, 0x66,
+    0xC2, 0x04, 0xC1, 0x3F, 0x04, 0xC0, 0x3F, 0xC1, 0x06, 0xC0, 0x0B, 0xC2, 0x03, 0x3C, 0xC3, 0x03,
+    0x3C, 0xC4, 0x3B, 0x00, 0x37, 0x75, 0x9F, 0xB8, 0x0F, 0x9A, 0xFB, 0xA6, 0xA4, 0x31, 0x36, 0x6E,
+    0xC1, 0x36, 0x3D, 0x02, 0x33, 0x36, 0xC0, 0x05, 0x36, 0x7B, 0x09, 0x9D, 0x9A, 0xA2, 0x77, 0x2D,
+    0xA7, 0x44, 0x02, 0x2E, 0x51, 0x66, 0x22, 0x05, 0x02, 0xC1, 0x36, 0xC3, 0x3D, 0xC2, 0x38, 0xC0,
+    0x3D, 0xC0, 0x31, 0x59, 0xA1, 0x98, 0x31, 0x9A, 0x8B, 0x9F, 0x49, 0xA5, 0x06, 0xA6, 0x05, 0xA2,
+    0x47, 0x5B, 0xC0, 0x6B, 0xC1, 0x34, 0x37, 0xC0, 0x03, 0x3C, 0x03, 0x3C, 0xC4, 0x37, 0xC0, 0x3C,
+    0xC0, 0x3F, 0xC0, 0x37, 0x3C, 0x3F, 0xC1, 0x3C, 0xC3, 0x37, 0xC0, 0x3C, 0x04, 0xC1, 0x0B, 0x3C,
+    0xA3, 0x66, 0x9D, 0x99, 0x94, 0xDE, 0xA7, 0x45, 0x5E, 0x6B, 0x14, 0xC7, 0x66, 0x7E, 0xC0, 0xA5,
+    0xB4, 0xC0, 0x0A, 0x0F, 0xC0, 0x07, 0xC2, 0x0C, 0x13, 0xC2, 0x7A, 0x13, 0xC3, 0x0E, 0x0B, 0x0E,
+    0xC4, 0x0B, 0x04, 0xC0, 0x66, 0xC2, 0x04, 0xC1, 0x3F, 0x04, 0x3F, 0xC1, 0x04, 0x06, 0x0B, 0xC3,
+    0x5A, 0x3C, 0xC4, 0x34, 0xC1, 0x3C, 0x39, 0xC1, 0x00, 0x3C, 0x9F, 0xB8, 0x9D, 0xDA, 0x9B, 0xFA,
+    0x9D, 0xF9, 0xA6, 0x95, 0xA0, 0xA7, 0x6E, 0x3B, 0xC0, 0x33, 0x31, 0x2E, 0x33, 0x6E, 0xC0, 0x33,
+    0x02, 0x6E, 0x02, 0x66, 0x1A, 0xC0, 0x6F, 0x2E, 0x6F, 0x02, 0x3D, 0x02, 0xC0, 0x65, 0xC1, 0x02,
+    0x36, 0xC3, 0x3D, 0xC2, 0x66, 0xC0, 0x3D, 0xC0, 0x2E, 0x22, 0x7A, 0x9C, 0x9A, 0x9C, 0x7A, 0xA4,
+    0x17, 0xFE, 0x7C, 0x91, 0xA2, 0x38, 0x32, 0x6B, 0xC0, 0x67, 0x7A, 0xC0, 0x3C, 0xC0, 0x66, 0xC0,
+    0x3C, 0xC5, 0x37, 0xC2, 0x3C, 0x3F, 0xC0, 0x3C, 0xC0, 0x3F, 0xC2, 0x3C, 0xC5, 0x04, 0xC0, 0x5A,
+    0x7F, 0x7E, 0x10, 0x01, 0x94, 0xDD, 0xA6, 0x46, 0x5E, 0x0D, 0x14, 0xC4, 0x66, 0xC1, 0x17, 0xC1,
+    0xA5, 0xC4, 0xC1, 0x5A, 0xC0, 0x0A, 0x5A, 0xC3, 0x0E, 0x13, 0x16, 0x66, 0x13, 0xC2, 0x0C, 0x0E,
+    0xC6, 0x0B, 0x04, 0xC1, 0x66, 0xC1, 0x04, 0xC3, 0x3F, 0x04, 0xC1, 0x06, 0x0B, 0xC3, 0x08, 0x3C,
+    0xC2, 0x39, 0x66, 0xC2, 0x39, 0xC3, 0x3C, 0x2A, 0x9D, 0xEA, 0xFE, 0x93, 0x8F, 0xA3, 0xB6, 0x3D,
+    0x71, 0x31, 0x36, 0x02, 0xC0, 0x3D, 0xC0, 0x02, 0x6E, 0xC0, 0x55, 0x07, 0x7F, 0x2E, 0x02, 0x2E,
+    0x33, 0x02, 0x56, 0xC0, 0x6E, 0x2E, 0x02, 0xC0, 0x31, 0x36, 0x3D, 0xC0, 0x36, 0xC3, 0x7B, 0xC1,
+    0x56, 0x3D, 0x38, 0x3D, 0xC0, 0x36, 0xC0, 0x65, 0x9A, 0x9B, 0x9B, 0x7B, 0xA8, 0x05, 0xFE, 0x7C,
+    0xD3, 0xA1, 0x37, 0x32, 0x39, 0x34, 0x37, 0x3E, 0x37, 0x3C, 0xC0, 0x37, 0xC0, 0x3C, 0xCF, 0x7A,
+    0xC0, 0x0B, 0x04, 0x3C, 0xC4, 0x04, 0xC0, 0x55, 0x3C, 0xA4, 0x65, 0x10, 0x69, 0x93, 0xDF, 0xA4,
+    0x56, 0xA3, 0x67, 0x0D, 0x14, 0xC2, 0x66, 0x14, 0x0F, 0xC1, 0x17, 0xC1, 0x1E, 0xC0, 0x66, 0x12,
+    0x5B, 0x0A, 0x5A, 0xC3, 0x0E, 0x11, 0x16, 0x11, 0x5E, 0xC2, 0x07, 0x0E, 0xC2, 0x13, 0x0E, 0xC1,
+    0x5A, 0x04, 0xC1, 0x3F, 0xC1, 0x04, 0xC7, 0x0B, 0xC4, 0x08, 0x3C, 0xC5, 0x34, 0xC0, 0x39, 0xC3,
+    0x71, 0x9D, 0xE9, 0x9D, 0xEA, 0xFE, 0xA3, 0x6E, 0xA7, 0x84, 0x31, 0x76, 0x2A, 0x36, 0x02, 0x33,
+    0x3D, 0x05, 0x36, 0x5E, 0xC0, 0x56, 0xA2, 0x77, 0x7E, 0x04, 0xC1, 0x7F, 0xC0, 0x04, 0x30, 0xC0,
+    0x33, 0xC1, 0x02, 0x3D, 0x02, 0x3D, 0x36, 0xC3, 0x00, 0xC1, 0x56, 0x3D, 0xC2, 0x02, 0x36, 0x7E,
+    0x9B, 0x9B, 0x99, 0x8C, 0xFE, 0x8C, 0x10, 0xFE, 0x74, 0xD3, 0xA1, 0x48, 0x39, 0xC0, 0x34, 0x37,
+    0x6B, 0x37, 0x3C, 0xC0, 0x37, 0xC0, 0x3C, 0xC8, 0x37, 0xC0, 0x3C, 0xC0, 0x37, 0x3C, 0xC1, 0x3F,
+    0xC0, 0x3C, 0xC1, 0x37, 0x3C, 0xC1, 0x7E, 0xC0, 0x41, 0x98, 0xDC, 0xA6, 0x55, 0x09, 0x5A, 0x94,
+    0xEE, 0xA2, 0x67, 0xA4, 0x57, 0x0D, 0x14, 0xC2, 0x0F, 0xC3, 0x7E, 0xC1, 0xA6, 0xC4, 0x1E, 0xC0,
+    0x12, 0xC0, 0x5A, 0xC0, 0x07, 0xC2, 0x6E, 0x16, 0xC3, 0x5A, 0xC0, 0x07, 0x13, 0xC2, 0x66, 0xC0,
+    0x5A, 0x0E, 0x0B, 0x04, 0xC1, 0x3F, 0xC2, 0x04, 0xC6, 0x0B, 0xC4, 0x08, 0x3C, 0xC7, 0x34, 0x39,
+    0xC0, 0x34, 0x37, 0x75, 0x9D, 0xE9, 0xFE, 0x8B, 0x8F, 0xA1, 0xC6, 0x3D, 0x75, 0xC0, 0x31, 0x33,
+    0x36, 0x02, 0x05, 0x02, 0x33, 0xA2, 0x67, 0x6E, 0xA2, 0x77, 0xC0, 0x9C, 0xAB, 0x59, 0x9C, 0xAA,
+    0x56, 0xA2, 0x77, 0xA2, 0x77, 0xA2, 0x78, 0xA3, 0x76, 0x66, 0x65, 0x61, 0x66, 0x7E, 0x3D, 0xC6,
+    0x36, 0xC0, 0x00, 0x36, 0xC1, 0x00, 0xC0, 0x3D, 0x55, 0xA2, 0x86, 0x9E, 0x79, 0x98, 0x8D, 0x03,
+    0xFE, 0x6C, 0xB3, 0xA3, 0x36, 0x39, 0xC0, 0x66, 0xC0, 0x7B, 0x37, 0xC4, 0x6E, 0xC3, 0x37, 0xC4,
+    0x30, 0xC0, 0x37, 0x3C, 0xC6, 0x30, 0x37, 0x3C, 0xC0, 0x7E, 0xC0, 0x30, 0xFE, 0x1A, 0xEC, 0xA5,
+    0x55, 0xAE, 0x11, 0x06, 0x97, 0xCD, 0x40, 0xA5, 0x57, 0x0D, 0x14, 0xC1, 0x17, 0x66, 0x17, 0x12,
+    0xC0, 0x17, 0xC2, 0x1E, 0x19, 0x69, 0xC1, 0x5A, 0x66, 0xC0, 0x07, 0xC0, 0x0C, 0x7B, 0xC3, 0x6E,
+    0x13, 0xC5, 0x0E, 0x55, 0x04, 0x0E, 0x5A, 0x04, 0xC1, 0x3F, 0xC2, 0x04, 0xC5, 0x3F, 0x0B, 0xC4,
+    0x56, 0x3C, 0xC8, 0x34, 0x39, 0x3C, 0x76, 0x9F, 0xB8, 0x9D, 0xE9, 0xFE, 0x8B, 0x4E, 0xA5, 0xB5,
+    0x38, 0x7D, 0xC0, 0x36, 0xC0, 0x6B, 0xA2, 0x76, 0x3D, 0x55, 0xA3, 0x66, 0xA2, 0x67, 0x66, 0x99,
+    0xAB, 0x9A, 0xBB, 0x97, 0xCC, 0x9D, 0x9A, 0xA6, 0x45, 0x6E, 0x42, 0x65, 0x3C, 0xA7, 0x54, 0xA8,
+    0x54, 0xA5, 0x76, 0x1C, 0x76, 0x9D, 0x99, 0x2E, 0xC0, 0x3D, 0xC4, 0x36, 0xC3, 0x7B, 0xC1, 0x3D,
+    0x33, 0xA1, 0x97, 0x9E, 0x7A, 0x98, 0x8D, 0xA6, 0x05, 0x25, 0xA2, 0x47, 0x5F, 0xC1, 0x66, 0x7A,
+    0xC6, 0x6E, 0xC1, 0x37, 0xC5, 0x30, 0xC0, 0x37, 0xC0, 0x3C, 0xC5, 0x30, 0xC0, 0x3C, 0xC0, 0x04,
+    0xC0, 0x3C, 0x92, 0xFF, 0x7F, 0xAF, 0x00, 0x6D, 0x99, 0xBC, 0x99, 0xAC, 0xA7, 0x44, 0x6F, 0x5A,
+    0x14, 0xC1, 0x76, 0xC0, 0x6E, 0xC4, 0xA5, 0xC4, 0xC3, 0x0F, 0x66, 0x5A, 0xC2, 0x6E, 0x7B, 0xC2,
+    0x1B, 0x56, 0xC5, 0x07, 0x56, 0x07, 0x6B, 0x13, 0x55, 0xC1, 0x3F, 0xC2, 0x04, 0xC6, 0x0B, 0xC5,
+    0x3C, 0xC3, 0x6B, 0xC0, 0x3C, 0xC3, 0x37, 0x75, 0x9F, 0xB8, 0x9C, 0xFA, 0x9B, 0xFB, 0xA7, 0x93,
+    0x9E, 0xC9, 0x7E, 0x6E, 0x46, 0x02, 0x33, 0x38, 0x3D, 0xA2, 0x77, 0xA3, 0x55, 0x9B, 0xAB, 0xFE,
+    0x9A, 0x89, 0x96, 0xCC, 0x99, 0xBC, 0x6E, 0xA9, 0x23, 0xFE, 0xDD, 0xD5, 0xA6, 0x45, 0x9D, 0x99,
+    0x99, 0xBC, 0x98, 0xCC, 0x97, 0xDD, 0x97, 0xED, 0xA5, 0x76, 0xA9, 0x54, 0xA9, 0x53, 0x7A, 0x9B,
+    0xCA, 0xC0, 0x36, 0x3D, 0xC2, 0x38, 0x36, 0xC4, 0x00, 0x3D, 0x02, 0xC0, 0x39, 0x2E, 0x98, 0x7D,
+    0xFE, 0x8C, 0x30, 0xA4, 0x07, 0xA1, 0x48, 0x6F, 0xC0, 0x6E, 0x34, 0xC0, 0x7A, 0xC1, 0x66, 0x37,
+    0xC2, 0x3C, 0xC2, 0x37, 0xC3, 0x69, 0xC0, 0x37, 0xC0, 0x3C, 0xC3, 0x37, 0xC0, 0x30, 0xC0, 0x35,
+    0xC0, 0x3C, 0xC0, 0x6E, 0x9B, 0xBB, 0x66, 0x15, 0x65, 0x9B, 0xAB, 0x98, 0xAC, 0xA7, 0x44, 0x10,
+    0x0D, 0x6B, 0xC1, 0x76, 0xC1, 0x17, 0xC3, 0xA5, 0xC4, 0xC2, 0x6B, 0x12, 0x5A, 0x07, 0xC1, 0x7A,
+    0x0F, 0x6B, 0xC2, 0x1B, 0x13, 0xC5, 0x0E, 0x07, 0xC0, 0x0E, 0xC0, 0x59, 0x3F, 0xC4, 0x04, 0x3F,
+    0xC0, 0x04, 0xC2, 0x0B, 0xC6, 0x3C, 0xC1, 0x37, 0xC2, 0x6B, 0xC0, 0x37, 0xC0, 0x39, 0x3C, 0x9E,
+    0xC9, 0x9D, 0xDA, 0xFE, 0x8B, 0x8F, 0xA3, 0xA6, 0xA5, 0xA5, 0x2C, 0xC0, 0x5D, 0x2E, 0xA4, 0x66,
+    0x02, 0x2E, 0xC0, 0xA3, 0x66, 0x98, 0xBC, 0xFE, 0x71, 0x43, 0x98, 0xCD, 0xA3, 0x56, 0xA3, 0x67,
+    0xA3, 0x56, 0xA6, 0x35, 0xFE, 0xFF, 0x5B, 0xA3, 0x56, 0x6F, 0xC0, 0x9D, 0xAA, 0x9D, 0xAA, 0x94,
+    0xFE, 0xFE, 0xA4, 0x10, 0xFE, 0x7A, 0x49, 0xA7, 0x64, 0x1C, 0x9C, 0xCA, 0xC0, 0x3D, 0xC4, 0x36,
+    0xC2, 0x76, 0xC0, 0x36, 0x3D, 0xC0, 0x02, 0x75, 0x2B, 0x98, 0x8D, 0xA6, 0x05, 0x25, 0x4F, 0x5F,
+    0xC0, 0x5A, 0x34, 0xC0, 0x7A, 0xC6, 0x6E, 0xC1, 0x37, 0xC3, 0x30, 0xC1, 0x37, 0x3C, 0xC4, 0x37,
+    0x30, 0x37, 0xC0, 0x30, 0xC2, 0x04, 0xC0, 0x0B, 0x6E, 0x59, 0x9C, 0xAA, 0x98, 0xBC, 0xA6, 0x46,
+    0x56, 0x0B, 0x14, 0x66, 0x7A, 0xC2, 0x17, 0x12, 0x17, 0xC1, 0xA6, 0xC4, 0x55, 0x19, 0xC2, 0x0A,
+    0xC4, 0x6F, 0xC2, 0x1B, 0x13, 0xC5, 0x3F, 0xC0, 0x7A, 0x0E, 0xC0, 0x3F, 0xC8, 0x04, 0xC1, 0x6B,
+    0xC5, 0x66, 0x5A, 0x3C, 0x37, 0x6B, 0xC0, 0x37, 0x03, 0x37, 0x7B, 0xC1, 0x3E, 0x5D, 0x30, 0x25,
+    0x9C, 0xFA, 0xFE, 0x9B, 0x4E, 0xA8, 0x84, 0xA1, 0x97, 0x3D, 0x27, 0x33, 0x36, 0x6F, 0x59, 0x6F,
+    0x18, 0xFE, 0xB3, 0x0B, 0xFE, 0x60, 0xA1, 0x5A, 0xA2, 0x77, 0xA4, 0x56, 0x5E, 0x42, 0xAB, 0x02,
+    0xFE, 0xFF, 0x9C, 0xA2, 0x67, 0x6F, 0x56, 0x66, 0xA2, 0x77, 0x61, 0x9D, 0xB9, 0xFE, 0x93, 0xAE,
+    0xFE, 0x48, 0xE2, 0xB2, 0x10, 0xAF, 0x20, 0x61, 0x9D, 0xAA, 0x3D, 0xC3, 0x36, 0xC1, 0x66, 0x7A,
+    0xC0, 0x56, 0x00, 0x36, 0x02, 0xC0, 0x41, 0x97, 0x9E, 0xA6, 0x05, 0xA5, 0x06, 0xA2, 0x37, 0x5F,
+    0xC3, 0x32, 0x34, 0xC1, 0x37, 0xC3, 0x6B, 0xC0, 0x37, 0xC3, 0x2D, 0xC1, 0x37, 0x6E, 0xC4, 0x37,
+    0xC0, 0x30, 0xC0, 0x37, 0x3C, 0xC0, 0x7E, 0xC1, 0x3C, 0xA2, 0x76, 0x56, 0x56, 0x94, 0xEE, 0xA7,
+    0x45, 0x6E, 0x56, 0x6F, 0xC9, 0x21, 0x55, 0x19, 0xC2, 0x0A, 0xC4, 0x16, 0xC3, 0x5A, 0xC5, 0x65,
+    0x3F, 0x7A, 0x6F, 0xC0, 0x3F, 0xC7, 0x04, 0xC2, 0x0B, 0xC4, 0x66, 0xC0, 0x5A, 0x3C, 0x37, 0x3E,
+    0x7A, 0xC0, 0x03, 0x37, 0x01, 0x56, 0x01, 0x37, 0x5E, 0x30, 0x9E, 0xD9, 0xFE, 0x83, 0xF0, 0xFE,
+    0xB3, 0xB0, 0xA5, 0x95, 0x7E, 0x3D, 0x45, 0xC0, 0x33, 0x36, 0xA3, 0x57, 0x59, 0x94, 0xEE, 0xFE,
+    0x69, 0x23, 0x9D, 0xAA, 0xA4, 0x55, 0x6B, 0x6E, 0x45, 0x46, 0xFE, 0x8B, 0x8C, 0xFE, 0xFF, 0x9C,
+    0x2A, 0x22, 0x66, 0xA2, 0x77, 0x56, 0x31, 0x20, 0xFE, 0x9C, 0x30, 0xFE, 0x40, 0xE2, 0x76, 0xFE,
+    0xB3, 0x6C, 0xAB, 0x43, 0x61, 0x3D, 0x55, 0x3D, 0x02, 0xC0, 0x33, 0x36, 0x00, 0x65, 0xC0, 0x6E,
+    0x56, 0x02, 0xC2, 0x46, 0x97, 0xAD, 0xA5, 0x16, 0xA4, 0x07, 0xA3, 0x36, 0x5F, 0x5A, 0xC1, 0x37,
+    0x56, 0xC1, 0x34, 0x2F, 0x34, 0x37, 0x3E, 0xC1, 0x66, 0x37, 0xC3, 0x30, 0x2D, 0xC0, 0x37, 0x6E,
+    0xC5, 0x37, 0xC3, 0x3C, 0xC0, 0x7E, 0x0B, 0x3C, 0xC1, 0x6E, 0x94, 0xEE, 0xA6, 0x46, 0xC0, 0x6B,
+    0x5E, 0xC0, 0x66, 0x12, 0xC0, 0x17, 0xC0, 0x12, 0xC2, 0x21, 0x55, 0x6F, 0xC0, 0x12, 0x5A, 0x0A,
+    0xC4, 0x16, 0xC3, 0x5A, 0xC4, 0x66, 0x69, 0x3F, 0x7A, 0xC0, 0x07, 0x3F, 0xC7, 0x04, 0xC2, 0x0B,
+    0xC4, 0x3F, 0xC0, 0x01, 0x3C, 0x6B, 0x3E, 0x7A, 0xC0, 0x03, 0xC0, 0x01, 0x3E, 0x01, 0x37, 0x3C,
+    0x9F, 0xB8, 0x9D, 0xD9, 0xFE, 0x8B, 0xAF, 0xA4, 0xC6, 0xA1, 0xA8, 0x69, 0x6E, 0x33, 0x38, 0x62,
+    0xA4, 0x66, 0x49, 0x92, 0xFF, 0x15, 0xC0, 0xA4, 0x66, 0x9D, 0x9A, 0xA2, 0x76, 0x56, 0x6E, 0x5E,
+    0xFE, 0x9C, 0x0E, 0xFE, 0xFF, 0x9C, 0x2A, 0x5A, 0xC1, 0x6B, 0x2A, 0x9D, 0xBA, 0xFE, 0x8B, 0xAD,
+    0xFE, 0x49, 0x44, 0x9F, 0xB8, 0x26, 0xFE, 0xC3, 0xCE, 0xA8, 0x54, 0x9C, 0xBA, 0x33, 0x2E, 0xA2,
+    0x77, 0x66, 0x02, 0x65, 0x7B, 0x65, 0xC0, 0x00, 0x36, 0xC1, 0x02, 0xC0, 0x46, 0x19, 0xA4, 0x17,
+    0xA5, 0x06, 0xA3, 0x36, 0x4F, 0xC3, 0x7A, 0x2F, 0xC3, 0x32, 0x6B, 0xC1, 0x32, 0xC3, 0x34, 0x37,
+    0xC2, 0x6E, 0xC4, 0x37, 0x3C, 0xC2, 0x37, 0x3C, 0xC0, 0x04, 0xC0, 0x3F, 0x5E, 0x65, 0x01, 0x94,
+    0xEE, 0xA4, 0x57, 0xA2, 0x77, 0x6E, 0x5B, 0xC0, 0x66, 0xC0, 0x12, 0xC5, 0xA7, 0xB3, 0x55, 0x21,
+    0x5A, 0x12, 0x0F, 0x0A, 0xC0, 0x0F, 0x0A, 0xC0, 0x0F, 0x6B, 0xC3, 0x5A, 0xC0, 0x07, 0x13, 0xC0,
+    0x66, 0xC0, 0x3F, 0xC0, 0x7A, 0xC0, 0x3F, 0xC8, 0x04, 0xC2, 0x0B, 0xC2, 0x3F, 0xC2, 0x01, 0x3C,
+    0x37, 0x3E, 0xC0, 0x03, 0x37, 0x03, 0x76, 0xC0, 0x06, 0x37, 0x79, 0xA0, 0xA7, 0xFE, 0x84, 0x31,
+    0x9B, 0xFB, 0xA7, 0x94, 0xA0, 0xB8, 0x3D, 0x3A, 0x6E, 0x6E, 0x7B, 0x18, 0xFE, 0xA2, 0xCA, 0xFE,
+    0x58, 0xA1, 0xA3, 0x66, 0xA2, 0x77, 0x6F, 0x2E, 0x66, 0x3A, 0x5A, 0x45, 0xFE, 0x9B, 0xCD, 0xFE,
+    0xFF, 0xBC, 0xC0, 0x5B, 0x27, 0x51, 0x27, 0x76, 0x9D, 0xB9, 0xFE, 0x72, 0xEA, 0xFE, 0x51, 0x24,
+    0xA3, 0x76, 0x9C, 0xCA, 0xA2, 0x87, 0xFE, 0xCB, 0xAD, 0xAB, 0x23, 0x9B, 0xBA, 0x6B, 0x3D, 0x6E,
+    0xC0, 0x31, 0x36, 0x00, 0xC0, 0x3D, 0x36, 0x33, 0x36, 0x02, 0x3D, 0x45, 0x19, 0xA4, 0x17, 0xFE,
+    0x74, 0x93, 0xA1, 0x48, 0xA2, 0x67, 0x34, 0xC4, 0x2F, 0x51, 0x7E, 0x2F, 0xC0, 0x66, 0xC2, 0x2F,
+    0x2A, 0x2F, 0xC1, 0x34, 0x69, 0x37, 0xC4, 0x3C, 0x37, 0xC0, 0x3C, 0xC5, 0x7E, 0x3C, 0x04, 0xC0,
+    0x55, 0x6F, 0x95, 0xDD, 0xA2, 0x78, 0xA4, 0x56, 0x09, 0x6F, 0x5A, 0x0D, 0x12, 0x17, 0xC0, 0x12,
+    0xC3, 0xA7, 0xB3, 0x55, 0x21, 0x1E, 0x12, 0x0F, 0x0A, 0xC0, 0x0F, 0xC0, 0x0A, 0x0F, 0x6B, 0xC0,
+    0x66, 0x16, 0xC0, 0x5A, 0xC3, 0x66, 0xC0, 0x55, 0xC0, 0x7B, 0xC0, 0x06, 0xC2, 0x3F, 0xC2, 0x04,
+    0xC4, 0x0B, 0xC1, 0x3F, 0xC3, 0x3C, 0xC0, 0x37, 0xC0, 0x3E, 0x6E, 0x37, 0x3C, 0x37, 0xC0, 0x3C,
+    0x61, 0xA1, 0x97, 0x9E, 0xC8, 0xFE, 0x8B, 0xEF, 0xA0, 0xD9, 0xA4, 0x96, 0xA0, 0xA8, 0x54, 0x33,
+    0xA3, 0x67, 0x27, 0x9A, 0xBB, 0xFE, 0x92, 0x48, 0x93, 0xEE, 0x6E, 0xA3, 0x67, 0x6E, 0x65, 0x2B,
+    0x26, 0x7E, 0x5F, 0x59, 0xAB, 0x13, 0xFE, 0xF7, 0x19, 0xA7, 0x25, 0x6B, 0xC0, 0x5A, 0x65, 0x25,
+    0x98, 0xEC, 0xFE, 0x6A, 0x28, 0x98, 0xDC, 0xA0, 0xA8, 0x70, 0x9B, 0xCB, 0xA7, 0x45, 0xFE, 0xCB,
+    0xAD, 0xA9, 0x44, 0x02, 0x6E, 0x02, 0x65, 0x31, 0x00, 0x6E, 0x00, 0x36, 0x02, 0xC1, 0x36, 0x31,
+    0x4A, 0x99, 0x8D, 0xA2, 0x37, 0xFE, 0x74, 0x73, 0xA2, 0x37, 0xA2, 0x67, 0x5E, 0xC0, 0x3C, 0xC0,
+    0x37, 0x5A, 0xC1, 0x37, 0xC3, 0x66, 0x37, 0x32, 0xC1, 0x37, 0xC0, 0x3C, 0xC1, 0x37, 0xC6, 0x3C,
+    0xC7, 0x7E, 0xC0, 0x51, 0x04, 0x97, 0xBC, 0xC0, 0xA5, 0x56, 0x52, 0x6E, 0x5B, 0x65, 0x12, 0xC0,
+    0x69, 0xC0, 0x0E, 0x12, 0x15, 0x12, 0xA7, 0xB3, 0x59, 0x6B, 0xC0, 0x65, 0x0F, 0xC0, 0x0A, 0x0F,
+    0xC0, 0x0A, 0x6F, 0xC1, 0x11, 0x16, 0xC0, 0x5A, 0xC3, 0x66, 0xC0, 0x3F, 0x7E, 0x0E, 0x66, 0x5A,
+    0xC1, 0x3F, 0xC3, 0x04, 0xC4, 0x6B, 0xC1, 0x3F, 0xC3, 0x3C, 0xC0, 0x37, 0xC0, 0x03, 0xC1, 0x3C,
+    0x03, 0x37, 0xC0, 0x74, 0xA0, 0xA8, 0x9C, 0xEA, 0xFE, 0x93, 0x8E, 0xA6, 0x95, 0xA2, 0x97, 0x3D,
+    0x3A, 0x6E, 0x9C, 0xAA, 0x99, 0xCC, 0x91, 0xFF, 0x98, 0xBC, 0xA5, 0x55, 0xA2, 0x67, 0x7E, 0x5A,
+    0x51, 0x26, 0xA2, 0x77, 0x2B, 0xC0, 0x5E, 0x46, 0xFE, 0x8B, 0x8C, 0xAC, 0x12, 0xA5, 0x55, 0xA2,
+    0x78, 0x9D, 0x9A, 0x9D, 0xA9, 0x9D, 0xBA, 0x95, 0xFE, 0xFE, 0x51, 0x03, 0x9F, 0xB9, 0xA1, 0x98,
+    0x7A, 0xA2, 0x87, 0x40, 0xA3, 0x77, 0xFE, 0xCB, 0xAE, 0xA8, 0x54, 0x6E, 0x02, 0x05, 0x3D, 0x65,
+    0x3D, 0x00, 0x3D, 0x02, 0xC0, 0x36, 0x31, 0xC0, 0x02, 0x98, 0x8D, 0xA0, 0x49, 0xFE, 0x74, 0x72,
+    0xA4, 0x26, 0x04, 0x5F, 0x7E, 0xC0, 0x66, 0xC0, 0x59, 0xC0, 0x10, 0xC0, 0x0B, 0x10, 0xC2, 0x04,
+    0x0B, 0xC1, 0x04, 0xC3, 0x10, 0x04, 0x5A, 0xC0, 0x3C, 0xC2, 0x04, 0x3C, 0xC0, 0x01, 0x04, 0xC0,
+    0x01, 0x3C, 0x7A, 0x04, 0xC0, 0x55, 0xC0, 0x9A, 0xAB, 0x9C, 0xAB, 0xA8, 0x44, 0x9C, 0xAA, 0x5F,
+    0xC1, 0x6E, 0x7A, 0xC5, 0xA8, 0x93, 0x55, 0x1E, 0xC0, 0x12, 0xC0, 0x0F, 0xC2, 0x0A, 0x6F, 0xC1,
+    0x66, 0x16, 0xC0, 0x5A, 0xC2, 0x66, 0xC0, 0x5A, 0x3F, 0x0E, 0xC0, 0x09, 0x5A, 0xC2, 0x3F, 0xC2,
+    0x04, 0xC4, 0x0B, 0xC2, 0x3F, 0xC2, 0x3C, 0xC0, 0x37, 0x7B, 0x03, 0xC2, 0x3C, 0xC0, 0x79, 0x71,
+    0x9F, 0xC9, 0x9A, 0xFA, 0x9D, 0xE9, 0xA7, 0x85, 0x76, 0x69, 0x6E, 0x51, 0xFE, 0xA2, 0x69, 0x92,
+    0xEF, 0x9C, 0xAA, 0xA4, 0x56, 0xA5, 0x55, 0x3A, 0x2B, 0x65, 0x2B, 0x3A, 0x65, 0x3A, 0x2B, 0x6E,
+    0x56, 0x9D, 0x89, 0x56, 0xA3, 0x77, 0xA3, 0x66, 0x9B, 0xBC, 0x7A, 0x9C, 0xBA, 0x9F, 0xB9, 0xA1,
+    0x98, 0xA4, 0x76, 0xA3, 0x86, 0xA6, 0x55, 0xA4, 0x66, 0x6E, 0x9C, 0xAA, 0x9B, 0x9A, 0x1A, 0xAC,
+    0x32, 0xA3, 0x66, 0x7F, 0xC0, 0x31, 0xC0, 0x6E, 0x3D, 0x6E, 0x36, 0x31, 0x36, 0x7A, 0x4B, 0x96,
+    0xAD, 0x9E, 0x4A, 0xFE, 0x5B, 0xAF, 0xA2, 0x47, 0xA2, 0x57, 0xA2, 0x67, 0x6E, 0x7E, 0x7F, 0x6F,
+    0x7E, 0x6F, 0x04, 0x6E, 0x04, 0x09, 0x7F, 0x6E, 0xC8, 0x18, 0xC0, 0x5A, 0x66, 0xC0, 0x09, 0xC1,
+    0x10, 0x04, 0xC4, 0x3F, 0x35, 0x38, 0x6E, 0x7F, 0x35, 0x65, 0x9D, 0x99, 0x9A, 0xAC, 0xA8, 0x44,
+    0x9C, 0xAA, 0x6F, 0x5B, 0xC0, 0x7E, 0xC1, 0x02, 0x0E, 0x69, 0x56, 0xC0, 0xA9, 0x93, 0x66, 0x5A,
+    0xC0, 0x66, 0x69, 0x0F, 0xC1, 0x66, 0xC0, 0x16, 0x19, 0x16, 0xC2, 0x11, 0x5A, 0x6E, 0xC0, 0x0E,
+    0xC0, 0x5A, 0x79, 0x0E, 0xC1, 0x56, 0xC2, 0x69, 0xC2, 0x04, 0xC4, 0x0B, 0xC2, 0x3F, 0xC2, 0x3C,
+    0xC0, 0x66, 0x7B, 0x03, 0xC0, 0x37, 0xC0, 0x3C, 0x3F, 0x38, 0x2A, 0x9D, 0xEA, 0xFE, 0x8B, 0x6D,
+    0xA2, 0xC7, 0xA5, 0x86, 0x2E, 0xA2, 0x76, 0x33, 0xC0, 0x9C, 0xAB, 0x3E, 0x97, 0xBC, 0x93, 0xEF,
+    0x40, 0x7F, 0xA2, 0x77, 0x7E, 0x5A, 0x7E, 0x29, 0x21, 0x29, 0x2B, 0x6F, 0x2B, 0x51, 0x56, 0x7B,
+    0x51, 0xA3, 0x87, 0x7E, 0xA1, 0xA8, 0x61, 0xA4, 0x77, 0xA7, 0x55, 0xA2, 0x76, 0x59, 0x2F, 0x40,
+    0x9C, 0xAA, 0x97, 0xCD, 0xA4, 0x66, 0xA8, 0x44, 0xAD, 0x11, 0xA3, 0x77, 0x7E, 0x6E, 0xC0, 0x31,
+    0x36, 0x31, 0xC0, 0x7A, 0xC0, 0x3A, 0x98, 0x9C, 0x9F, 0x49, 0xFE, 0x63, 0xEF, 0xA0, 0x59, 0x5E,
+    0x5A, 0x59, 0x66, 0x66, 0xC0, 0x16, 0xC0, 0xA2, 0x77, 0x7E, 0x7F, 0xC0, 0x6F, 0x7E, 0x6F, 0x7E,
+    0xC0, 0x6E, 0x6F, 0xC5, 0x66, 0xC3, 0x3A, 0x04, 0xC2, 0x6E, 0x04, 0x3D, 0x35, 0xC0, 0x7A, 0xC0,
+    0x3D, 0x2E, 0x29, 0x21, 0x11, 0xA8, 0x34, 0x02, 0x6E, 0x02, 0xC0, 0x56, 0x65, 0x51, 0x55, 0xC0,
+    0x66, 0x51, 0xC0, 0xB0, 0x50, 0xC0, 0x5A, 0xC0, 0x66, 0x1E, 0x55, 0xC2, 0x0A, 0x6F, 0xC4, 0x66,
+    0x59, 0xC0, 0x0E, 0xC1, 0x5A, 0x04, 0x0B, 0x0E, 0xC0, 0x66, 0x5A, 0xC1, 0x3F, 0xC2, 0x04, 0xC4,
+    0x3F, 0xC4, 0x06, 0x3F, 0xC0, 0x3C, 0x77, 0xC0, 0x5A, 0x69, 0x03, 0x37, 0xC1, 0x79, 0x9F, 0xC8,
+    0x9B, 0xFB, 0xFE, 0x93, 0x4D, 0xA7, 0x94, 0x31, 0x36, 0x5A, 0x66, 0xA2, 0x66, 0xA2, 0x88, 0x6F,
+    0x5A, 0x97, 0xCC, 0x95, 0xDE, 0x99, 0xBB, 0x9B, 0xBA, 0x9D, 0xAA, 0x6E, 0x6F, 0xA2, 0x87, 0x66,
+    0x24, 0xC0, 0x15, 0x6F, 0xA2, 0x77, 0x7A, 0x7F, 0xA4, 0x76, 0xA4, 0x76, 0x7B, 0x76, 0x9C, 0xAA,
+    0xA3, 0x86, 0xC0, 0x9B, 0xAA, 0x56, 0x45, 0xA6, 0x45, 0xA8, 0x33, 0xA3, 0x77, 0xA2, 0x66, 0x2D,
+    0xA6, 0x54, 0xA3, 0x67, 0x7A, 0x31, 0xC0, 0x6F, 0x36, 0x31, 0xC0, 0x7E, 0xC0, 0x02, 0x98, 0x9C,
+    0xA1, 0x38, 0xFE, 0x84, 0xB2, 0xA2, 0x38, 0x5E, 0x5E, 0xC0, 0x59, 0x76, 0x56, 0x55, 0x66, 0xC1,
+    0x7E, 0x55, 0x9D, 0xAA, 0x66, 0xC0, 0x55, 0xC1, 0x1B, 0x66, 0xC2, 0x1E, 0xC1, 0x16, 0xC2, 0x2A,
+    0xC0, 0x7F, 0x6E, 0x12, 0x26, 0x7A, 0x6F, 0x7E, 0xC0, 0x35, 0x3D, 0x0C, 0x59, 0x6F, 0x3D, 0x16,
+    0x17, 0x9B, 0xAB, 0x6B, 0x61, 0x55, 0x56, 0x51, 0x7A, 0xC0, 0x6E, 0x7E, 0x0E, 0xC0, 0xAD, 0x62,
+    0xC1, 0x5A, 0x19, 0x69, 0x5A, 0xC2, 0x66, 0x0F, 0x6B, 0xC3, 0x11, 0x5A, 0x69, 0x0E, 0x6E, 0x0E,
+    0x5A, 0x69, 0x0B, 0x0E, 0xC0, 0x66, 0x5A, 0xC1, 0x3F, 0xC2, 0x04, 0xC2, 0x3F, 0x04, 0x0B, 0xC1,
+    0x3F, 0xC3, 0x5A, 0xC0, 0x77, 0xC0, 0x03, 0xC0, 0x65, 0x3F, 0x52, 0x64, 0x7A, 0xA0, 0xB8, 0xFE,
+    0x8B, 0xCF, 0x9F, 0xD8, 0xA6, 0x95, 0x31, 0x6E, 0x3B, 0xC0, 0x33, 0x3A, 0x7F, 0x5A, 0xA3, 0x66,
+    0xC0, 0x9C, 0x99, 0x99, 0xCC, 0x98, 0xCC, 0x99, 0xCB, 0x24, 0x61, 0x52, 0x59, 0x66, 0x55, 0x7E,
+    0xA2, 0x78, 0x7A, 0xA4, 0x66, 0xA4, 0x76, 0xA2, 0x98, 0x51, 0x9C, 0xBA, 0x51, 0x09, 0x6E, 0xA3,
+    0x66, 0x2F, 0xA6, 0x55, 0xA7, 0x34, 0xA4, 0x66, 0x6E, 0x7F, 0x16, 0x65, 0x7B, 0x05, 0x31, 0xC1,
+    0x6E, 0xC1, 0x7A, 0x34, 0x36, 0x99, 0x8C, 0xA1, 0x38, 0xFE, 0x7C, 0x71, 0xA2, 0x37, 0xA2, 0x57,
+    0x5E, 0x7A, 0x6E, 0x6B, 0xC1, 0x33, 0x99, 0xCC, 0x6E, 0x1A, 0x33, 0x3A, 0x33, 0xC0, 0x55, 0x66,
+    0xC1, 0x17, 0x66, 0xC0, 0x65, 0xC2, 0x5A, 0xC0, 0x3E, 0xC0, 0x03, 0xC0, 0x3E, 0xC0, 0x03, 0x12,
+    0xC1, 0x7A, 0x12, 0x15, 0x1A, 0x15, 0x06, 0x66, 0x06, 0x9C, 0xAA, 0x3E, 0x2A, 0x6F, 0xC1, 0x7F,
+    0x12, 0x6F, 0x2B, 0x3A, 0xC0, 0x7E, 0xC0, 0xA1, 0xB9, 0xC1, 0x5A, 0x19, 0x69, 0x0F, 0x66, 0x0F,
+    0xC2, 0x6B, 0xC2, 0x66, 0x0F, 0x57, 0x6E, 0xC1, 0x0E, 0x04, 0x6B, 0x0E, 0xC1, 0x04, 0x3F, 0xC3,
+    0x04, 0xC4, 0x3F, 0xC0, 0x0B, 0xC2, 0x3F, 0xC0, 0x6B, 0xC0, 0x3F, 0x66, 0xC0, 0x6B, 0x5A, 0xC0,
+    0x69, 0x06, 0x3A, 0x65, 0x9F, 0xB8, 0x9C, 0xDA, 0xFE, 0x8B, 0x6E, 0xA5, 0xA5, 0xA3, 0xA6, 0x31,
+    0x6E, 0xA2, 0x66, 0x6B, 0x51, 0x67, 0x6E, 0xC0, 0x6E, 0x5A, 0x3F, 0xA2, 0x77, 0x7E, 0x13, 0x9D,
+    0x9A, 0x9C, 0xBA, 0x9B, 0xAB, 0x9C, 0xA9, 0x51, 0x51, 0x56, 0x65, 0x66, 0x66, 0xA2, 0x76, 0xA0,
+    0xA9, 0x55, 0x07, 0xA6, 0x54, 0xA3, 0x67, 0xA6, 0x55, 0xA4, 0x66, 0xA3, 0x66, 0x56, 0x55, 0xC2,
+    0x3D, 0x02, 0x00, 0x56, 0x31, 0xC1, 0x3D, 0xC0, 0x31, 0xC0, 0x39, 0x02, 0x98, 0x9C, 0xA1, 0x38,
+    0xFE, 0x7C, 0x71, 0xA2, 0x37, 0x1A, 0x26, 0xC0, 0x24, 0x2B, 0x26, 0x69, 0x17, 0x96, 0xDD, 0x9C,
+    0xBA, 0xA2, 0x77, 0xA8, 0x34, 0x26, 0x2B, 0x7F, 0x2B, 0x3A, 0xC9, 0x6E, 0xC3, 0x3A, 0xC0, 0x3F,
+    0x3A, 0x65, 0x2B, 0x26, 0x1A, 0x26, 0xC0, 0x1A, 0xC0, 0x65, 0x1A, 0x26, 0x2B, 0xC0, 0x52, 0x3A,
+    0x6F, 0x3F, 0x7F, 0x65, 0x3A, 0x7A, 0xC2, 0x21, 0xC1, 0x5A, 0xC1, 0x0F, 0xC3, 0x16, 0xC4, 0x0F,
+    0x67, 0x5E, 0xC1, 0x56, 0x04, 0x7B, 0xC2, 0x04, 0x66, 0xC7, 0x04, 0xC0, 0x3F, 0xC0, 0x0B, 0xC2,
+    0x3F, 0xC0, 0x6B, 0xC0, 0x3F, 0x66, 0xC1, 0x3E, 0xC0, 0x3A, 0x66, 0x3A, 0xA0, 0xA7, 0x76, 0x9A,
+    0xFB, 0x9C, 0xFA, 0xA6, 0x94, 0xA0, 0xA7, 0x76, 0x36, 0x3B, 0xC1, 0x67, 0xC0, 0x5A, 0x66, 0x6D,
+    0xC0, 0x3A, 0xC0, 0x7E, 0xC0, 0xA2, 0x78, 0x55, 0x6E, 0x7F, 0x1D, 0x69, 0xC0, 0x66, 0x02, 0xC0,
+    0x00, 0x7F, 0x14, 0x25, 0x50, 0xA3, 0x67, 0x02, 0xC0, 0x33, 0x2E, 0xC1, 0x3A, 0x3D, 0xC0, 0x31,
+    0x38, 0x00, 0x38, 0x3D, 0xC0, 0x36, 0x02, 0x36, 0x7A, 0x02, 0x97, 0x9D, 0xA2, 0x27, 0xFE, 0x7C,
+    0x91, 0xA2, 0x37, 0x5F, 0x6E, 0x6E, 0xC0, 0x2E, 0x2B, 0x66, 0xC0, 0x9B, 0xAA, 0x98, 0xCC, 0x66,
+    0xA8, 0x44, 0x17, 0xC0, 0x26, 0x2B, 0x26, 0x5A, 0x26, 0x23, 0x26, 0x23, 0x26, 0xC0, 0x23, 0x69,
+    0xC1, 0x23, 0x1C, 0xC1, 0x23, 0x6E, 0x2B, 0x6F, 0x7E, 0xC2, 0x7A, 0x56, 0xC0, 0xA2, 0x76, 0x33,
+    0xC0, 0x07, 0x5A, 0x3A, 0x94, 0xEE, 0x9D, 0x9A, 0xA2, 0x86, 0xA2, 0x77, 0xA7, 0x45, 0xA5, 0x65,
+    0x2E, 0x7A, 0xC0, 0x66, 0x29, 0xA4, 0x97, 0xC1, 0x1E, 0xC1, 0x55, 0xC4, 0x6B, 0xC2, 0x65, 0xC0,
+    0x6B, 0x5E, 0x65, 0xC0, 0x0B, 0xC0, 0x69, 0x0B, 0x7A, 0x0B, 0x65, 0xC9, 0x04, 0xC1, 0x0B, 0xC2,
+    0x06, 0xC2, 0x3F, 0x66, 0xC0, 0x06, 0xC1, 0x3F, 0x3A, 0x65, 0x75, 0x9E, 0xC9, 0x9A, 0xFB, 0xA2,
+    0xB7, 0xA4, 0xA6, 0x9D, 0xC9, 0xA2, 0x76, 0x3B, 0xC0, 0x66, 0xC0, 0x3D, 0x38, 0x3D, 0xC0, 0x6E,
+    0xC2, 0x56, 0x65, 0x66, 0x2E, 0x3D, 0xC4, 0xA2, 0x76, 0x66, 0x00, 0xC0, 0x7F, 0x05, 0x2E, 0xA2,
+    0x67, 0xC0, 0x02, 0x3D, 0x02, 0xC0, 0x3D, 0x59, 0x3D, 0x02, 0x3D, 0x38, 0x3D, 0xC3, 0x33, 0x02,
+    0x05, 0x5E, 0x98, 0x8D, 0xA0, 0x48, 0xA5, 0x05, 0xA3, 0x27, 0xA2, 0x67, 0x2B, 0xC0, 0x6E, 0x2B,
+    0xC3, 0x9B, 0xAB, 0x61, 0x17, 0x23, 0x17, 0x7F, 0x2B, 0xC0, 0x23, 0x26, 0x23, 0xC1, 0x26, 0x2B,
+    0x28, 0xC0, 0x23, 0xC3, 0x1C, 0x28, 0xC0, 0x2B, 0x30, 0x37, 0xC2, 0x7A, 0xC0, 0x69, 0x6F, 0x33,
+    0xC1, 0x3F, 0xC0, 0x94, 0xEE, 0x9A, 0xBB, 0x7F, 0xC0, 0x2A, 0xAA, 0x32, 0x66, 0x7A, 0xC2, 0xA0,
+    0xBA, 0xC0, 0x21, 0xC0, 0x1E, 0xC0, 0x55, 0xC0, 0x66, 0xC1, 0x0F, 0xC0, 0x16, 0x13, 0xC0, 0x0A,
+    0x5A, 0xC3, 0x5B, 0xC0, 0x69, 0x0B, 0x0E, 0x0B, 0x65, 0xC8, 0x04, 0xC2, 0x0B, 0xC2, 0x06, 0xC1,
+    0x3F, 0xC2, 0x06, 0xC0, 0x3F, 0xC0, 0x65, 0x66, 0x9F, 0xB9, 0x9E, 0xC9, 0x99, 0xFB, 0xA5, 0xA5,
+    0xA1, 0xB7, 0x38, 0x36, 0x6F, 0x69, 0x36, 0xC0, 0x3D, 0x38, 0x3D, 0x02, 0xC0, 0x51, 0x65, 0xC0,
+    0x38, 0x3D, 0x02, 0x3D, 0x31, 0x66, 0x38, 0x7A, 0x38, 0xC0, 0x3D, 0x02, 0x3D, 0x00, 0x6E, 0xC0,
+    0x02, 0x5A, 0xC0, 0x2E, 0x61, 0x66, 0x6F, 0x2E, 0x6E, 0x02, 0x56, 0x3D, 0x31, 0x38, 0x3D, 0xC2,
+    0x2E, 0x02, 0x2E, 0x5E, 0x9A, 0x8C, 0xA1, 0x37, 0xFE, 0x74, 0x91, 0xA2, 0x37, 0x29, 0x5E, 0xC2,
+    0x26, 0xC0, 0x23, 0x26, 0x23, 0xC3, 0x7F, 0x2B, 0x23, 0xC4, 0x2B, 0x28, 0xC8, 0x6E, 0x6B, 0x2D,
+    0x37, 0xC0, 0x2B, 0x37, 0x2B, 0x32, 0x2B, 0x6E, 0x2B, 0x30, 0x2B, 0xA2, 0x76, 0x6B, 0x2B, 0x9C,
+    0xAA, 0x2A, 0x65, 0xA4, 0x66, 0xA6, 0x55, 0x7E, 0xC0, 0x7A, 0x6F, 0xC0, 0x1C, 0xC0, 0x6E, 0x56,
+    0xC1, 0x55, 0x0F, 0xC0, 0x0A, 0xC0, 0x0F, 0xC1, 0x0C, 0xC0, 0x07, 0xC4, 0x0B, 0xC3, 0x04, 0xCD,
+    0x0B, 0xC2, 0x66, 0xC0, 0x0B, 0x06, 0x69, 0xC2, 0x66, 0xC0, 0x07, 0x3A, 0x7A, 0x9F, 0xB8, 0x9A,
+    0xFB, 0x9E, 0xC9, 0xA8, 0x94, 0x9D, 0xB8, 0xA0, 0xA8, 0xC0, 0x36, 0xC1, 0x3D, 0x00, 0xC0, 0xA2,
+    0x67, 0x55, 0x31, 0x22, 0x56, 0x61, 0x6B, 0x1A, 0x2E, 0x36, 0x3D, 0xC0, 0x66, 0x2C, 0xC0, 0x31,
+    0x2E, 0x35, 0x2E, 0x38, 0x2C, 0x38, 0x55, 0x1A, 0x51, 0x18, 0x2C, 0xC0, 0x7A, 0x3B, 0x3D, 0x02,
+    0x5A, 0x02, 0x3D, 0x02, 0x05, 0x3D, 0x2E, 0x33, 0x3F, 0x02, 0xC0, 0xA2, 0x67, 0x96, 0xAE, 0xA2,
+    0x27, 0xFE, 0x84, 0xF3, 0x1D, 0x26, 0x2B, 0xC1, 0x26, 0x2B, 0xC0, 0x23, 0xC0, 0x2B, 0x28, 0x23,
+    0xC1, 0x28, 0x23, 0x28, 0xC4, 0x23, 0xC0, 0x28, 0xC1, 0x5A, 0xC0, 0x28, 0x6B, 0x28, 0x34, 0xC4,
+    0x28, 0xC0, 0x23, 0xA2, 0x77, 0x30, 0xC0, 0x2B, 0xC1, 0x59, 0x30, 0x7F, 0x66, 0xC2, 0x65, 0x65,
+    0xA2, 0x77, 0x7F, 0x6E, 0xC0, 0x1C, 0xC1, 0x19, 0xC0, 0x16, 0x0F, 0xC6, 0x0C, 0x0F, 0x56, 0xC4,
+    0x0B, 0x7E, 0x0B, 0xC1, 0x04, 0xC0, 0x66, 0x04, 0xCA, 0x0B, 0xC2, 0x66, 0xC0, 0x3F, 0xC2, 0x06,
+    0xC0, 0x3F, 0x66, 0x55, 0x7E, 0xA0, 0xA8, 0xFE, 0x53, 0x6F, 0xFE, 0x31, 0x87, 0xA6, 0x85, 0xFE,
+    0xD4, 0xF3, 0x9D, 0xCA, 0x35, 0x3D, 0x02, 0x55, 0x31, 0x3D, 0x00, 0x3D, 0xC0, 0x69, 0xC1, 0x31,
+    0x55, 0x1A, 0x66, 0x55, 0xC0, 0x09, 0x6E, 0x10, 0xC1, 0x15, 0x1A, 0x15, 0x10, 0x15, 0x62, 0x10,
+    0xC0, 0x15, 0x18, 0x7E, 0x7F, 0x3B, 0xC0, 0x00, 0x36, 0x5F, 0xC1, 0x3D, 0xC0, 0x7E, 0x3D, 0x55,
+    0x6F, 0xC1, 0xA4, 0x56, 0x9E, 0x79, 0xFE, 0x61, 0xE7, 0xA2, 0x37, 0xFE, 0x74, 0xD2, 0xA2, 0x47,
+    0x4A, 0xC5, 0x23, 0xC0, 0x6E, 0x65, 0x23, 0x2B, 0x23, 0xC0, 0x28, 0xC3, 0x23, 0xC0, 0x28, 0xC1,
+    0x25, 0x7B, 0x5A, 0xC0, 0x25, 0x6F, 0xC1, 0x34, 0xC0, 0x2F, 0x34, 0xC0, 0x2F, 0xC0, 0x23, 0x28,
+    0xC0, 0x2B, 0x30, 0x28, 0x30, 0x2B, 0x23, 0xC0, 0x30, 0x7B, 0xC0, 0x69, 0x61, 0x6E, 0xC0, 0x7E,
+    0x6B, 0xC0, 0xA2, 0xA9, 0x19, 0xC2, 0x55, 0x6F, 0x0F, 0xC0, 0x0C, 0x0F, 0xC0, 0x0C, 0x0F, 0xC0,
+    0x0A, 0x07, 0xC2, 0x6B, 0xC0, 0x59, 0x6B, 0xC1, 0x6E, 0x0B, 0x04, 0x66, 0xC1, 0x04, 0xC1, 0x3F,
+    0x04, 0xC7, 0x3F, 0xC1, 0x04, 0x3F, 0xC0, 0x01, 0x6E, 0xC0, 0x59, 0xC0, 0x65, 0x76, 0x71, 0xFE,
+    0x21, 0xA7, 0xFE, 0x00, 0x01, 0xA2, 0xA6, 0xFE, 0x8B, 0x0C, 0xFE, 0xE5, 0x34, 0x60, 0x9D, 0xBA,
+    0x6E, 0x9D, 0xBA, 0x3D, 0xC3, 0x69, 0xC3, 0x00, 0x36, 0x2E, 0x29, 0x69, 0x66, 0xC0, 0x22, 0x29,
+    0x22, 0x29, 0xC0, 0x1D, 0x29, 0x7A, 0xC0, 0x6B, 0x2C, 0x6E, 0xC0, 0x7A, 0x00, 0x3D, 0xC1, 0x3F,
+    0x02, 0x59, 0x02, 0xC1, 0x3D, 0x59, 0x02, 0x57, 0x1F, 0x9F, 0x69, 0xFE, 0x6A, 0x28, 0x91, 0xDF,
+    0xA2, 0x47, 0xFE, 0x4B, 0xAD, 0xAB, 0x03, 0x49, 0x28, 0xC0, 0x2B, 0xC0, 0x66, 0xC0, 0x2B, 0xC0,
+    0x28, 0x23, 0xC2, 0x28, 0xC4, 0x23, 0xC1, 0x6F, 0x28, 0x25, 0xC0, 0x6B, 0x6E, 0x25, 0x31, 0xC2,
+    0x2C, 0x7E, 0xC0, 0x2F, 0xC0, 0x56, 0x69, 0x2F, 0xC0, 0x7A, 0xC1, 0x2B, 0xC1, 0x37, 0x69, 0xC1,
+    0x7A, 0xC2, 0x7E, 0xC0, 0x65, 0x21, 0x19, 0xC2, 0x0F, 0x16, 0xC0, 0x0F, 0x0C, 0x0F, 0xC0, 0x0C,
+    0xC0, 0x0F, 0xC0, 0x56, 0xC2, 0x0E, 0xC0, 0x59, 0xC0, 0x0B, 0xC1, 0x04, 0xC3, 0x66, 0xC0, 0x04,
+    0x3F, 0x04, 0xC6, 0x3F, 0xC5, 0x67, 0x06, 0xC0, 0x5D, 0xC0, 0x75, 0x76, 0x71, 0xFE, 0x11, 0x05,
+    0x99, 0xEB, 0x75, 0xA4, 0x86, 0xFE, 0xA3, 0xAD, 0xAD, 0x32, 0x15, 0x62, 0x65, 0x35, 0xC0, 0x3D,
+    0xC1, 0x69, 0xC2, 0x66, 0xC1, 0x36, 0xC0, 0x3D, 0xC0, 0x00, 0x02, 0xC1, 0x3D, 0xC2, 0x00, 0xC2,
+    0x65, 0xC1, 0x3D, 0xC1, 0x02, 0xC1, 0x55, 0x36, 0x02, 0xC0, 0x33, 0x6B, 0xA2, 0x77, 0xA2, 0x68,
+    0x9C, 0x89, 0xFE, 0x6A, 0x28, 0xFE, 0x18, 0x20, 0x46, 0xA2, 0x56, 0xFE, 0x33, 0x0A, 0xFE, 0x65,
+    0x12, 0x24, 0x2B, 0xC2, 0x66, 0x2B, 0xC0, 0x5A, 0xCB, 0x23, 0x6F, 0xC1, 0x25, 0xC0, 0x6F, 0xC0,
+    0x25, 0x31, 0xC1, 0x2C, 0xC0, 0x7E, 0xC1, 0x2F, 0x2C, 0xC0, 0x2F, 0xC1, 0x7A, 0xC2, 0x2B, 0x37,
+    0x7A, 0x6E, 0x69, 0xC1, 0x7E, 0xC0, 0x7B, 0x6E, 0xC0, 0x21, 0x19, 0xC0, 0x69, 0x56, 0xC1, 0x6E,
+    0xC0, 0x0C, 0x0F, 0xC0, 0x0C, 0xC0, 0x16, 0xC0, 0x07, 0xC2, 0x6B, 0x07, 0x04, 0xCF, 0x6B, 0x04,
+    0xC1, 0x0B, 0x04, 0x66, 0xC0, 0x07, 0x66, 0xC1, 0x3F, 0xC1, 0x04, 0xC0, 0x02, 0x39, 0x9F, 0xB8,
+    0xFE, 0x3A, 0x08, 0xFE, 0x08, 0x21, 0x03, 0x06, 0xA6, 0x75, 0xFE, 0x9B, 0x6D, 0xAD, 0x31, 0x7A,
+    0x9C, 0xBA, 0x76, 0x3D, 0x7A, 0x3D, 0x00, 0x3D, 0xC0, 0x36, 0x5A, 0x76, 0x36, 0xC1, 0x3D, 0xC0,
+    0x6E, 0xC1, 0x3D, 0xC0, 0x02, 0x3D, 0xC2, 0x66, 0xC1, 0x00, 0x38, 0x7A, 0x38, 0xC0, 0x3D, 0xC0,
+    0x7E, 0x36, 0x02, 0x36, 0xC0, 0x3D, 0x45, 0xA2, 0x77, 0xA5, 0x46, 0x99, 0xAC, 0xFE, 0x72, 0x08,
+    0x91, 0xCF, 0x03, 0x5E, 0xA3, 0x56, 0xFE, 0x3B, 0x2B, 0xFE, 0x5C, 0xD2, 0xA2, 0x57, 0xC1, 0x26,
+    0xC0, 0x2B, 0xC0, 0x28, 0xC7, 0x2B, 0xC2, 0x28, 0xC0, 0x2F, 0xC2, 0x25, 0x6F, 0xC4, 0x2C, 0xC0,
+    0x34, 0xC1, 0x2C, 0xC0, 0x27, 0x2C, 0xC0, 0x2F, 0xC0, 0x66, 0xC0, 0x28, 0x2B, 0x37, 0x7E, 0x6E,
+    0x7F, 0xC0, 0x7E, 0xC0, 0x61, 0x0D, 0x6F, 0xC0, 0x9F, 0xBA, 0x56, 0x12, 0x19, 0x55, 0xC2, 0x0C,
+    0xC2, 0x07, 0x0C, 0x16, 0xC0, 0x07, 0xC2, 0x6B, 0x07, 0x5A, 0xC9, 0x0B, 0xC3, 0x6E, 0xC0, 0x0B,
+    0xC0, 0x0E, 0x0B, 0xC0, 0x65, 0xC0, 0x7A, 0xC1, 0x3F, 0xC3, 0x02, 0x39, 0x61, 0x9E, 0xC9, 0x98,
+    0xFC, 0xFE, 0x41, 0x65, 0x95, 0xEE, 0x06, 0xC0, 0xA4, 0x86, 0xFE, 0x8A, 0xCB, 0xFE, 0xD4, 0xF3,
+    0xA1, 0x97, 0x9B, 0xCB, 0x7E, 0x61, 0x38, 0xA2, 0x77, 0x3D, 0x36, 0x33, 0x36, 0xC3, 0x3D, 0xC0,
+    0x36, 0xC1, 0x3D, 0xC4, 0x38, 0xC2, 0x3D, 0x38, 0xC0, 0x3B, 0xC0, 0x38, 0x00, 0x6E, 0x3D, 0x36,
+    0x3D, 0x65, 0x4A, 0xA5, 0x56, 0x21, 0x97, 0xBD, 0xFE, 0x59, 0xA6, 0x95, 0xCD, 0x03, 0x5A, 0xC0,
+    0xAB, 0x02, 0xFE, 0x53, 0xEE, 0xA8, 0x15, 0x5E, 0x6F, 0x66, 0x26, 0xC1, 0x2B, 0x5A, 0xC2, 0x2B,
+    0xC0, 0x28, 0xC1, 0x2B, 0xC2, 0x28, 0xC0, 0x2F, 0xC2, 0x25, 0xC0, 0x6F, 0xC4, 0x2C, 0xC5, 0x27,
+    0x25, 0x20, 0xC0, 0x7A, 0xC1, 0x28, 0x37, 0x6E, 0x7E, 0x13, 0xC0, 0x7E, 0x7F, 0x61, 0xC1, 0x6E,
+    0x9E, 0xCB, 0x12, 0xC0, 0x5A, 0x0A, 0xC2, 0x5E, 0x07, 0x0C, 0xC0, 0x07, 0xC0, 0x7F, 0xC0, 0x0E,
+    0x07, 0xC1, 0x0E, 0x07, 0x5A, 0xC9, 0x0B, 0xC5, 0x7E, 0x0B, 0x0E, 0xC0, 0x0B, 0x66, 0xC2, 0x69,
+    0xC4, 0x76, 0x9D, 0xC9, 0xA0, 0xB8, 0x98, 0xFB, 0xA5, 0x86, 0x65, 0xFE, 0x51, 0x86, 0x09, 0x5A,
+    0xC0, 0xA3, 0x86, 0xAF, 0x20, 0xFE, 0xCC, 0xD2, 0xA4, 0x76, 0x9C, 0xCA, 0x3A, 0x2E, 0x38, 0xC0,
+    0x6E, 0xC0, 0x65, 0x36, 0xC3, 0x3D, 0x36, 0x38, 0x3D, 0xC5, 0x38, 0xC2, 0x3D, 0xC0, 0x38, 0xC2,
+    0x3D, 0xC1, 0x31, 0x3D, 0xA2, 0x67, 0x1F, 0x4A, 0x94, 0xDE, 0xFE, 0x41, 0x02, 0x99, 0x9D, 0x03,
+    0x6E, 0x00, 0xA7, 0x64, 0xFE, 0x63, 0x0C, 0xFE, 0x74, 0xB2, 0xA0, 0x58, 0x26, 0x37, 0x66, 0x26,
+    0xC1, 0x2B, 0x28, 0xC2, 0x2B, 0xC0, 0x28, 0xC1, 0x2B, 0xC3, 0x28, 0xC1, 0x2F, 0xC0, 0x59, 0xC0,
+    0x6B, 0xC0, 0x6E, 0xC1, 0x2C, 0xC8, 0x20, 0xC2, 0x25, 0x20, 0x2F, 0x37, 0x6E, 0x37, 0x7A, 0x6E,
+    0x7F, 0x7E, 0xC2, 0x9E, 0xCB, 0x12, 0x19, 0x59, 0x0A, 0xC2, 0x0C, 0x66, 0x0C, 0xC0, 0x07, 0xC0,
+    0x0C, 0x13, 0x66, 0x07, 0xC1, 0x0E, 0x07, 0x5A, 0xC8, 0x66, 0x04, 0x6B, 0xC6, 0x0E, 0x0B, 0xC0,
+    0x66, 0x3F, 0xC0, 0x06, 0xC1, 0x3F, 0x04, 0xC0, 0x02, 0x71, 0x9D, 0xDA, 0x9C, 0xD9, 0x9C, 0xEA,
+    0xA7, 0x64, 0xA8, 0x43, 0x97, 0xCD, 0xFE, 0x51, 0x85, 0x09, 0x5A, 0xC0, 0x09, 0xAD, 0x31, 0xFE,
+    0xB4, 0x30, 0xA7, 0x64, 0x9C, 0xBA, 0xA0, 0xA8, 0x51, 0x2E, 0x7F, 0xC0, 0x36, 0xC6, 0x38, 0x3D,
+    0xC6, 0x38, 0xC0, 0x3D, 0xC1, 0x38, 0xC0, 0x69, 0xC1, 0x33, 0x7F, 0x3F, 0x7F, 0x10, 0x9B, 0x9B,
+    0x92, 0xDE, 0x92, 0xDF, 0x06, 0x08, 0xC0, 0x7A, 0xAB, 0x32, 0xAF, 0x21, 0xA3, 0x57, 0xA3, 0x27,
+    0xA5, 0x25, 0x26, 0xA2, 0x57, 0x69, 0x62, 0xC0, 0x26, 0x6E, 0x28, 0xC2, 0x2B, 0xC0, 0x28, 0xC1,
+    0x2B, 0xC3, 0x28, 0xC1, 0x2F, 0xC0, 0x25, 0xC0, 0x2C, 0xCE, 0x20, 0x25, 0x2C, 0xC1, 0x2F, 0xC0,
+    0x34, 0x3C, 0x7A, 0x3A, 0xC0, 0x3F, 0x56, 0x66, 0x37, 0x19, 0x12, 0x19, 0x0F, 0x0A, 0xC1, 0x07,
+    0xC5, 0x7F, 0xC0, 0x13, 0x07, 0x6B, 0xC1, 0x07, 0x56, 0xC0, 0x6E, 0xC0, 0x3F, 0xC0, 0x04, 0xC1,
+    0x3F, 0x04, 0xC0, 0x6B, 0x0E, 0xC1, 0x0B, 0xC2, 0x0E, 0x0B, 0xC0, 0x66, 0x3F, 0x0B, 0xC1, 0x06,
+    0xC0, 0x3F, 0x7A, 0x79, 0x9E, 0xC9, 0x9C, 0xEA, 0x99, 0xFC, 0xA1, 0xB7, 0xA5, 0x76, 0xA4, 0x65,
+    0xA4, 0x55, 0x9B, 0x8A, 0xFE, 0x61, 0xE6, 0xFE, 0x18, 0x20, 0x56, 0xC0, 0x09, 0xA8, 0x43, 0xFE,
+    0x93, 0x4C, 0xAF, 0x21, 0x7A, 0x10, 0x9D, 0xAA, 0x2E, 0x36, 0xC3, 0x6E, 0xC0, 0x36, 0xC0, 0x3D,
+    0xC9, 0x6E, 0xC0, 0x3D, 0x31, 0xC1, 0x3D, 0x02, 0x6E, 0xA2, 0x68, 0xA3, 0x56, 0x9C, 0xAA, 0x93,
+    0xDF, 0x91, 0xEF, 0x97, 0xBD, 0x06, 0x08, 0x03, 0xA3, 0x75, 0xAF, 0x20, 0xFE, 0xBC, 0xB1, 0xA0,
+    0xAA, 0x94, 0xCE, 0xFE, 0x73, 0xF0, 0xA5, 0x25, 0x26, 0x34, 0x69, 0x28, 0x23, 0x28, 0x26, 0xC0,
+    0x2B, 0x28, 0x2B, 0xCA, 0x28, 0xC0, 0x6B, 0xC0, 0x25, 0xC0, 0x6B, 0xD2, 0x2F, 0x34, 0x2C, 0x2F,
+    0xA2, 0x77, 0x7E, 0x66, 0x55, 0x34, 0x2F, 0x25, 0x20, 0xA4, 0xB7, 0x66, 0xC0, 0x0F, 0x66, 0xC1,
+    0x5A, 0xC4, 0x16, 0xC1, 0x13, 0x07, 0x6B, 0xC1, 0x07, 0xC1, 0x04, 0x3F, 0xC1, 0x04, 0xC4, 0x6B,
+    0xC6, 0x0E, 0xC0, 0x0B, 0xC0, 0x04, 0x0B, 0xC0, 0x66, 0xC0, 0x65, 0xC0, 0x79, 0x9F, 0xB9, 0x9F,
+    0xB7, 0xFE, 0x93, 0xAF, 0x9D, 0xD9, 0xA7, 0x84, 0x38, 0x26, 0xA3, 0x66, 0xA5, 0x35, 0x9E, 0x79,
+    0xFE, 0x7A, 0xAA, 0xFE, 0x28, 0x61, 0x9D, 0x8A, 0xC0, 0x7A, 0xA5, 0x65, 0xAD, 0x21, 0xFE, 0xBC,
+    0x91, 0xA7, 0x75, 0x0D, 0x9C, 0xCA, 0x2E, 0x7E, 0x31, 0xC0, 0x36, 0xC0, 0x5A, 0x36, 0xC0, 0x3D,
+    0xC1, 0x38, 0xC0, 0x3D, 0xC1, 0x02, 0xC0, 0x3D, 0x02, 0xC0, 0x36, 0x31, 0x3D, 0x02, 0xA2, 0x77,
+    0xA2, 0x67, 0x5F, 0x9C, 0x89, 0x95, 0xDE, 0x92, 0xEF, 0x97, 0xBC, 0x09, 0x06, 0x5A, 0x7E, 0xA7,
+    0x53, 0xAF, 0x21, 0xAF, 0x31, 0x30, 0x97, 0xDD, 0x98, 0x9D, 0xFE, 0x8C, 0x31, 0xA4, 0x05, 0xA2,
+    0x47, 0x2D, 0xC1, 0x28, 0xC0, 0x76, 0xC0, 0x6E, 0xCC, 0x28, 0xC0, 0x2F, 0xC0, 0x59, 0xC0, 0x6F,
+    0xC0, 0x2C, 0x5A, 0x2C, 0xC4, 0x25, 0x5A, 0x2C, 0xC6, 0x31, 0xC0, 0x34, 0xC0, 0x6F, 0x7A, 0xC1,
+    0x34, 0x31, 0xC1, 0xA1, 0xE9, 0x69, 0x19, 0x59, 0x67, 0x0A, 0x5A, 0xC0, 0x66, 0xC0, 0x07, 0xC0,
+    0x13, 0x7A, 0xC1, 0x0E, 0xC0, 0x07, 0x02, 0xC1, 0x0E, 0xC0, 0x07, 0xC2, 0x56, 0xC4, 0x04, 0xC2,
+    0x6B, 0xC4, 0x04, 0x3F, 0x04, 0xC0, 0x3F, 0xC0, 0x3A, 0x02, 0x65, 0xA0, 0xA8, 0xA0, 0xA7, 0x9B,
+    0xEA, 0xFE, 0x9B, 0x6D, 0xA5, 0x85, 0xA1, 0xB8, 0x7A, 0x33, 0x56, 0x6F, 0xA5, 0x35, 0x5A, 0xFE,
+    0x93, 0x2C, 0xFE, 0x41, 0x03, 0x98, 0xCD, 0x5A, 0xC0, 0x7E, 0xA9, 0x43, 0xFE, 0x9B, 0x6C, 0xAE,
+    0x21, 0xA1, 0x98, 0x9C, 0xBA, 0x9D, 0xA9, 0x33, 0x6B, 0x7E, 0x33, 0xC0, 0x2E, 0x3D, 0x7A, 0x38,
+    0x00, 0xC1, 0x3D, 0x38, 0x02, 0x3D, 0xC3, 0x3A, 0x02, 0xA2, 0x78, 0x59, 0x56, 0x9C, 0x9A, 0x97,
+    0xBC, 0x92, 0xDF, 0x99, 0xAC, 0x9E, 0x79, 0x56, 0xC0, 0x06, 0x25, 0xAB, 0x33, 0xFE, 0xAC, 0x0F,
+    0xA7, 0x74, 0x1F, 0x9D, 0xA9, 0x9D, 0xAA, 0x98, 0x9D, 0xFE, 0x83, 0xEF, 0xA5, 0x05, 0xA3, 0x36,
+    0x28, 0xC4, 0x7A, 0xCD, 0x28, 0xC0, 0x2F, 0xC0, 0x5A, 0xC2, 0x5A, 0xC5, 0x69, 0x29, 0xC1, 0x2C,
+    0xC5, 0x31, 0xC2, 0x7B, 0xC3, 0x5E, 0x69, 0x5A, 0x19, 0x69, 0x19, 0x0F, 0x67, 0x0A, 0x5A, 0xC0,
+    0x66, 0xC0, 0x07, 0xC0, 0x6F, 0x16, 0xC1, 0x0E, 0xC0, 0x07, 0xC0, 0x02, 0x07, 0x0E, 0xC0, 0x55,
+    0xC6, 0x07, 0xC0, 0x5B, 0xC3, 0x0E, 0xC2, 0x0B, 0x04, 0x3F, 0xC0, 0x04, 0x07, 0x51, 0x3F, 0x33,
+    0x75, 0xA1, 0xA7, 0x9C, 0xEA, 0x9A, 0xEB, 0xA0, 0xB7, 0xA4, 0x96, 0xA2, 0x97, 0x66, 0x36, 0x6F,
+    0x5A, 0x5A, 0x6F, 0xA2, 0x67, 0x97, 0xCD, 0xFE, 0x61, 0xA6, 0x25, 0x09, 0x06, 0x09, 0xA4, 0x65,
+    0xAD, 0x32, 0xAE, 0x21, 0x1E, 0xA1, 0x97, 0x10, 0x37, 0xC0, 0x79, 0x3F, 0x2E, 0x02, 0x66, 0x66,
+    0x3D, 0x51, 0x38, 0x3D, 0xC1, 0x3A, 0x02, 0xC1, 0xA2, 0x67, 0xA2, 0x67, 0x6B, 0x08, 0x98, 0xCC,
+    0x94, 0xDE, 0x96, 0xBD, 0x9B, 0xAB, 0x09, 0x06, 0x5A, 0xC0, 0xA2, 0x86, 0xA8, 0x65, 0xAF, 0x20,
+    0xAC, 0x32, 0xA4, 0x76, 0x9C, 0xB9, 0x2E, 0x05, 0x42, 0x97, 0x9C, 0xFE, 0x8B, 0xEF, 0xFE, 0x6C,
+    0x91, 0xA3, 0x36, 0x4E, 0x28, 0xC4, 0x7A, 0xCB, 0x28, 0x66, 0x28, 0x2F, 0x2C, 0xC2, 0x5A, 0x6E,
+    0x29, 0xC4, 0x69, 0xC0, 0x29, 0xC0, 0x2C, 0xC3, 0x29, 0xC0, 0x7E, 0xC2, 0x2C, 0x31, 0x77, 0x2C,
+    0x31, 0x2E, 0xC0, 0x6F, 0xFE, 0x7D, 0x55, 0xC0, 0x6B, 0x16, 0xC0, 0x0A, 0x5A, 0xC0, 0x66, 0xC0,
+    0x07, 0xC0, 0x6F, 0x16, 0xC1, 0x0E, 0xC0, 0x07, 0x02, 0xC5, 0x07, 0x56, 0xC3, 0x07, 0xC0, 0x0E,
+    0xC7, 0x0B, 0x04, 0xC2, 0x3F, 0x55, 0xA2, 0x76, 0x66, 0x9F, 0xB8, 0x9D, 0xDA, 0x9A, 0xFA, 0x9D,
+    0xD9, 0xA5, 0x96, 0x33, 0xA2, 0x87, 0x51, 0x51, 0x36, 0x6B, 0xC0, 0x55, 0xA3, 0x57, 0xA4, 0x56,
+    0x9C, 0x9A, 0x92, 0xCE, 0xFE, 0x38, 0xE2, 0x9A, 0xAC, 0x56, 0xC1, 0xA6, 0x75, 0xAA, 0x43, 0xAC,
+    0x31, 0xA8, 0x55, 0x2D, 0xA3, 0x76, 0x51, 0x0B, 0x9D, 0x99, 0x0B, 0x1F, 0x9D, 0xAA, 0xC0, 0x7A,
+    0x06, 0x7E, 0x6F, 0xC0, 0x69, 0x1A, 0x24, 0x6B, 0x05, 0x9B, 0xAB, 0x96, 0xCD, 0x95, 0xCD, 0x99,
+    0xBB, 0x9D, 0x9A, 0x56, 0x5A, 0x03, 0xC0, 0x7E, 0x2A, 0x34, 0xFE, 0xBC, 0x50, 0xA6, 0x76, 0x9D,
+    0xB9, 0x65, 0x33, 0x36, 0x7A, 0x56, 0x98, 0x8C, 0xFE, 0x83, 0xEE, 0xA5, 0x05, 0xA3, 0x37, 0x5E,
+    0x6B, 0x5A, 0xC3, 0x2B, 0xC3, 0x6B, 0xC0, 0x2B, 0xC3, 0x28, 0xC2, 0x6B, 0x2C, 0xC0, 0x5A, 0xC3,
+    0x6E, 0xC0, 0x29, 0xC6, 0x2C, 0xC1, 0x29, 0xC5, 0x7E, 0xC0, 0x2C, 0x29, 0x2E, 0xC0, 0x6B, 0x3A,
+    0x19, 0x12, 0x16, 0xC1, 0x65, 0x07, 0xC0, 0x02, 0xC0, 0x07, 0xC0, 0x6B, 0x16, 0xC1, 0x0E, 0xC0,
+    0x07, 0xC0, 0x02, 0xC4, 0x07, 0xC0, 0x56, 0xC2, 0x07, 0xC0, 0x0E, 0xC0, 0x07, 0x0E, 0xC1, 0x5A,
+    0xC0, 0x0E, 0x04, 0xC3, 0x65, 0x6E, 0x38, 0x75, 0x9E, 0xC9, 0x9A, 0xFB, 0x9D, 0xD9, 0xA4, 0xA6,
+    0xA6, 0x74, 0x61, 0x7F, 0x65, 0x36, 0x66, 0xC1, 0x5B, 0x6E, 0xA2, 0x57, 0xA4, 0x55, 0x5F, 0x99,
+    0x9B, 0x92, 0xEF, 0xFE, 0x20, 0xC2, 0x03, 0xC1, 0x06, 0xA5, 0x75, 0xA7, 0x55, 0xAA, 0x42, 0xA8,
+    0x54, 0x23, 0x94, 0xFE, 0x9B, 0xAB, 0xA6, 0x65, 0xAC, 0x22, 0xAA, 0x33, 0x7F, 0x30, 0x6F, 0x28,
+    0xC0, 0x19, 0x9D, 0x99, 0x9A, 0xBB, 0x0D, 0x9B, 0xAB, 0x99, 0xAC, 0x99, 0xBB, 0x9C, 0x8A, 0x06,
+    0xC0, 0x03, 0xC0, 0x06, 0xA2, 0x76, 0xA2, 0x88, 0xAC, 0x21, 0xAE, 0x21, 0xA9, 0x64, 0xA0, 0xA9,
+    0x9D, 0xB9, 0x65, 0x65, 0x7D, 0x7B, 0x65, 0x39, 0x15, 0xA3, 0x06, 0xFE, 0x74, 0x90, 0xA2, 0x37,
+    0xA2, 0x57, 0x5B, 0x6E, 0x28, 0xC3, 0x2B, 0xC1, 0x32, 0xC2, 0x2B, 0xC1, 0x28, 0xC1, 0x66, 0x5E,
+    0x2C, 0xC0, 0x29, 0x69, 0x29, 0x6E, 0x29, 0x5A, 0x2E, 0x26, 0xC2, 0x6E, 0xC0, 0x26, 0x29, 0xC1,
+    0x7E, 0x29, 0xC1, 0x2E, 0x29, 0xC2, 0x2E, 0xC0, 0x77, 0x5E, 0xC0, 0x6E, 0xC1, 0xA1, 0xF8, 0x66,
+    0x12, 0x5A, 0xC0, 0x66, 0x07, 0xC4, 0x6F, 0x7A, 0x6F, 0xC0, 0x51, 0xC9, 0x02, 0xC1, 0x3F, 0x07,
+    0xC1, 0x0E, 0xC0, 0x07, 0x0E, 0xC5, 0x59, 0xC2, 0x65, 0x04, 0x75, 0x71, 0x9C, 0xEA, 0x9B, 0xEA,
+    0xA2, 0xB7, 0xA5, 0x85, 0xA0, 0xA7, 0x66, 0x7E, 0x51, 0x6B, 0x5A, 0x7F, 0xA2, 0x77, 0x27, 0x5B,
+    0x5A, 0x44, 0x42, 0x45, 0x98, 0xAC, 0xFE, 0x31, 0x44, 0x96, 0xCE, 0xC1, 0x03, 0xA2, 0x77, 0x61,
+    0x7E, 0x7E, 0x66, 0x09, 0x7A, 0xC0, 0xA9, 0x43, 0xAD, 0x21, 0x7F, 0x51, 0xC0, 0x41, 0x65, 0x9C,
+    0xAA, 0x9B, 0xAB, 0x9A, 0xBB, 0x51, 0x0C, 0x09, 0x06, 0xC0, 0x03, 0xC1, 0xA2, 0x86, 0xA5, 0x66,
+    0x08, 0xAD, 0x22, 0xA7, 0x64, 0x7F, 0x71, 0x60, 0x7B, 0x2E, 0x3B, 0x51, 0x2F, 0x36, 0x39, 0x97,
+    0x9D, 0xA2, 0x16, 0xFE, 0x7C, 0x90, 0xA2, 0x37, 0xA2, 0x47, 0x5F, 0xC1, 0x66, 0xC1, 0x7A, 0xC2,
+    0x32, 0xC3, 0x5E, 0xC1, 0x28, 0x56, 0xC2, 0x5E, 0x29, 0xC1, 0x6E, 0x5A, 0xC0, 0x66, 0xC2, 0x2B,
+    0xC1, 0x26, 0xC0, 0x29, 0x2E, 0xC0, 0x29, 0x2E, 0x29, 0x2E, 0x29, 0x26, 0x2E, 0xC1, 0x3A, 0x7A,
+    0x35, 0x3A, 0xC1, 0x5A, 0x1E, 0x66, 0x12, 0x5A, 0xC0, 0x66, 0xC1, 0x5E, 0xC2, 0x6B, 0x7A, 0xC1,
+    0x56, 0xCB, 0x02, 0x07, 0x0E, 0xCA, 0x04, 0xC1, 0x66, 0xC0, 0x38, 0x7A, 0x9D, 0xCA, 0x9D, 0xC9,
+    0x9C, 0xEA, 0xA1, 0xB7, 0xA4, 0x96, 0xA1, 0x97, 0x31, 0x65, 0x36, 0x27, 0xA3, 0x67, 0xA2, 0x77,
+    0x6F, 0x5A, 0x9A, 0xAB, 0x99, 0xBC, 0x98, 0xBC, 0x9B, 0x9A, 0x9B, 0xAB, 0x9C, 0x8A, 0x55, 0x46,
+    0x00, 0xC4, 0x7A, 0xC0, 0x6E, 0x03, 0xC0, 0x06, 0x7A, 0x6E, 0x7A, 0xC0, 0x09, 0xC0, 0x06, 0xC3,
+    0x03, 0x06, 0xC0, 0x03, 0x06, 0xA3, 0x65, 0xA7, 0x55, 0xAD, 0x31, 0xAC, 0x43, 0xA6, 0x65, 0xA2,
+    0x87, 0x9C, 0xBA, 0x9D, 0xA9, 0x76, 0xC0, 0x7E, 0x7A, 0x40, 0xA2, 0x77, 0xC0, 0x61, 0xA1, 0x89,
+    0x99, 0x9B, 0x9F, 0x28, 0xFE, 0x7C, 0x4F, 0xA4, 0x16, 0xA2, 0x47, 0x2D, 0xC1, 0x66, 0xC1, 0x7A,
+    0xC2, 0x6B, 0xC1, 0x5A, 0xC1, 0x6E, 0xC0, 0x28, 0x5A, 0x20, 0xC0, 0x25, 0x29, 0xC1, 0x2E, 0x5A,
+    0xC1, 0x66, 0x2B, 0x26, 0x2B, 0xC3, 0x26, 0x2B, 0x26, 0x2E, 0x29, 0x2E, 0x29, 0x26, 0xC1, 0x2E,
+    0xC1, 0x6F, 0xC4, 0x37, 0x1E, 0xC0, 0x12, 0x0F, 0x0A, 0xC1, 0x0F, 0x0C, 0xC2, 0x13, 0x16, 0xC1,
+    0x56, 0xD8, 0x04, 0xC1, 0x66, 0x04, 0x38, 0xA0, 0xA8, 0x9D, 0xBA, 0x9C, 0xDA, 0x9C, 0xEA, 0x9F,
+    0xC8, 0xA5, 0x86, 0xA4, 0x75, 0x02, 0x65, 0x62, 0x05, 0x1B, 0x10, 0x9B, 0x9B, 0x95, 0xDD, 0x97,
+    0xCD, 0x97, 0xBC, 0x41, 0x52, 0x5A, 0x06, 0xC0, 0x03, 0x5A, 0xC0, 0xA2, 0x76, 0xA3, 0x66, 0xA2,
+    0x78, 0xA3, 0x66, 0x65, 0x9A, 0xBB, 0x00, 0xC2, 0x03, 0xC1, 0x06, 0xC1, 0x6E, 0x03, 0xC1, 0x00,
+    0xC0, 0x03, 0x06, 0xA2, 0x86, 0xA3, 0x77, 0xA9, 0x43, 0xAC, 0x32, 0xAB, 0x32, 0xA3, 0x87, 0x17,
+    0x65, 0x65, 0x66, 0x65, 0x6E, 0x02, 0x33, 0x3B, 0x07, 0x69, 0x33, 0x65, 0xA2, 0x98, 0x9A, 0x8B,
+    0x9B, 0x5A, 0xFE, 0x84, 0x2F, 0xA4, 0x05, 0xA2, 0x48, 0x5F, 0x6E, 0x28, 0xC1, 0x7A, 0x28, 0xC4,
+    0x2F, 0xC2, 0x2D, 0xC0, 0x57, 0x25, 0x20, 0xC0, 0x29, 0xC2, 0x5E, 0xCC, 0x66, 0xC0, 0x2B, 0x26,
+    0xC2, 0x2B, 0x7A, 0xC1, 0x6F, 0xC1, 0x69, 0x3A, 0xC0, 0x6E, 0xFE, 0x7D, 0x76, 0xC0, 0x65, 0x0F,
+    0x0A, 0xC1, 0x0F, 0x5A, 0xC1, 0x13, 0xC0, 0x7A, 0xC1, 0x56, 0xCC, 0x65, 0x6E, 0x0E, 0xC1, 0x07,
+    0x5B, 0x04, 0x0B, 0x0E, 0xC3, 0x07, 0xC0, 0x59, 0x76, 0x9E, 0xC9, 0x9C, 0xDA, 0x9B, 0xEB, 0x9F,
+    0xC8, 0xA5, 0x86, 0xA3, 0x96, 0x51, 0x36, 0x31, 0xC0, 0xA3, 0x57, 0x40, 0xFE, 0x8A, 0x69, 0x95,
+    0xBD, 0x98, 0xBD, 0x5A, 0x06, 0xC1, 0x5A, 0xC1, 0xA2, 0x67, 0xA7, 0x44, 0xA5, 0x66, 0xA7, 0x43,
+    0xA3, 0x77, 0x56, 0x9D, 0xA9, 0x99, 0xBB, 0x94, 0xEF, 0xC0, 0x66, 0xC0, 0x05, 0x00, 0xC0, 0x03,
+    0xC2, 0x6E, 0x00, 0xC3, 0xA4, 0x65, 0xB0, 0x20, 0xA9, 0x54, 0xA5, 0x65, 0xA3, 0x87, 0xA5, 0x75,
+    0x1C, 0x9C, 0xBA, 0x7A, 0x65, 0x31, 0x6E, 0xC1, 0x5A, 0x7E, 0x59, 0x6B, 0x33, 0x3B, 0x36, 0x7B,
+    0x9C, 0x8A, 0x9B, 0x6A, 0xA4, 0x06, 0xA6, 0x04, 0xA2, 0x37, 0xA1, 0x69, 0x5E, 0x28, 0xC0, 0x6E,
+    0xC0, 0x28, 0xC3, 0x2F, 0xC1, 0x2C, 0x6E, 0xC2, 0x25, 0xC1, 0x5B, 0xC1, 0x26, 0xC0, 0x2B, 0xC7,
+    0x5A, 0x2B, 0xC0, 0x28, 0x2B, 0x26, 0x2B, 0xC0, 0x26, 0xC0, 0x7E, 0x2B, 0x2E, 0xC1, 0x6F, 0xC0,
+    0x2E, 0xC0, 0x3A, 0xC0, 0x6E, 0x1E, 0xC0, 0x66, 0x59, 0x0A, 0xC0, 0x0F, 0xC0, 0x5A, 0xC0, 0x6B,
+    0xC0, 0x16, 0xC1, 0x6F, 0x51, 0xC3, 0x69, 0x0E, 0xC3, 0x66, 0xC0, 0x07, 0xC3, 0x0E, 0xC0, 0x5A,
+    0x04, 0xC0, 0x0B, 0x0E, 0xC0, 0x09, 0xC0, 0x07, 0xC0, 0x69, 0x9F, 0xB8, 0x9C, 0xEB, 0x99, 0xFC,
+    0x9D, 0xDA, 0xA7, 0x85, 0xA2, 0x86, 0x75, 0x6E, 0xC0, 0x33, 0x6F, 0x46, 0xFE, 0x71, 0xC6, 0x94,
+    0xBE, 0x42, 0x03, 0x08, 0x05, 0xC0, 0x66, 0xC1, 0xA2, 0x87, 0xA9, 0x33, 0xA9, 0x34, 0xA4, 0x66,
+    0x59, 0x9B, 0xBB, 0x99, 0xCC, 0x15, 0x9A, 0xCB, 0x00, 0xC2, 0x7E, 0x00, 0xC0, 0x03, 0x00, 0xC0,
+    0x05, 0xC0, 0x03, 0xC0, 0x00, 0xC0, 0x05, 0x1C, 0xFE, 0x72, 0xEB, 0xFE, 0xCD, 0x55, 0xA4, 0x76,
+    0x9C, 0xCA, 0x9C, 0xCA, 0x9C, 0xBA, 0x7E, 0x3D, 0x36, 0xC0, 0x56, 0xC0, 0x33, 0x6E, 0x3B, 0x38,
+    0x6E, 0x38, 0x3B, 0xC0, 0x62, 0x45, 0x99, 0x7C, 0xA5, 0x05, 0xA5, 0x06, 0xA1, 0x47, 0xA3, 0x57,
+    0x4A, 0x6E, 0x7A, 0x6D, 0xC0, 0x2D, 0x66, 0xC1, 0x2F, 0xC1, 0x5A, 0x6E, 0x5A, 0x31, 0xC0, 0x2C,
+    0x25, 0x20, 0x5E, 0x29, 0x5A, 0xC3, 0x6E, 0xC8, 0x5A, 0xC0, 0x26, 0x2B, 0xC1, 0x26, 0xC2, 0x2E,
+    0x6E, 0x2E, 0x33, 0x6B, 0xC0, 0x33, 0xC2, 0x1E, 0x65, 0xC0, 0x5A, 0x0A, 0xC0, 0x0F, 0xC0, 0x0C,
+    0x16, 0xC5, 0x66, 0x5A, 0xC2, 0x07, 0x0E, 0xC1, 0x66, 0xC0, 0x0E, 0x09, 0x07, 0xC1, 0x0E, 0x07,
+    0x09, 0x0E, 0x0B, 0x04, 0xC0, 0x0E, 0xC0, 0x02, 0x0E, 0xC0, 0x60, 0x7A, 0x79, 0x9D, 0xC9, 0x9C,
+    0xEA, 0x9C, 0xEB, 0xA4, 0x96, 0xA2, 0x98, 0xA1, 0x97, 0x69, 0x55, 0xA2, 0x67, 0x51, 0xA4, 0x56,
+    0x96, 0xBD, 0xFE, 0x38, 0x40, 0x9E, 0x6A, 0x03, 0x5A, 0x05, 0x6E, 0xC0, 0x00, 0xC0, 0x03, 0xA2,
+    0x77, 0xA2, 0x77, 0xA3, 0x66, 0x9D, 0x9A, 0x21, 0x08, 0x05, 0x00, 0x08, 0x03, 0xA3, 0x76, 0xA4,
+    0x76, 0x9B, 0xAA, 0x52, 0x00, 0xC4, 0xA5, 0x55, 0xA1, 0x98, 0x1F, 0x08, 0x00, 0xC0, 0x08, 0x1F,
+    0xA7, 0x64, 0xAE, 0x32, 0xAB, 0x43, 0xA2, 0x97, 0x75, 0x65, 0x79, 0x31, 0xC1, 0x36, 0x02, 0xC0,
+    0x3B, 0xC0, 0x3D, 0x38, 0x3B, 0xC0, 0x31, 0x46, 0x9C, 0x69, 0x9F, 0x59, 0xFE, 0x7C, 0x70, 0xA2,
+    0x37, 0xA2, 0x47, 0xA2, 0x57, 0x5A, 0x69, 0x6E, 0x7A, 0x2D, 0x66, 0x25, 0xC0, 0x2F, 0xC1, 0x2C,
+    0x5E, 0xC2, 0x2C, 0x25, 0xC0, 0x22, 0x6B, 0x5A, 0xC3, 0x6E, 0xC8, 0x5A, 0xC0, 0x2B, 0xC0, 0x26,
+    0xC2, 0x29, 0x2E, 0xC2, 0x33, 0xC3, 0x7B, 0xC0, 0x1E, 0x12, 0x6B, 0x55, 0x11, 0xC0, 0x16, 0xC4,
+    0x5A, 0xC0, 0x0E, 0x11, 0xC1, 0x0E, 0xCC, 0x13, 0x0E, 0xC4, 0x69, 0x56, 0xA2, 0x76, 0x07, 0x61,
+    0x39, 0x9F, 0xB8, 0x9C, 0xC9, 0x9C, 0xDB, 0xA0, 0xC8, 0xA4, 0x96, 0xA2, 0x97, 0x9D, 0xBA, 0x65,
+    0xA2, 0x76, 0x5E, 0x02, 0x66, 0xA2, 0x56, 0x95, 0xCE, 0xFE, 0x30, 0x00, 0xA0, 0x58, 0x03, 0x05,
+    0x6E, 0xC1, 0x00, 0xC1, 0x03, 0xC0, 0x7A, 0x6E, 0xC0, 0xA6, 0x45, 0x05, 0x00, 0xC0, 0x06, 0xFE,
+    0x6A, 0xAA, 0xFE, 0xBC, 0xB1, 0x95, 0xEF, 0x9D, 0x89, 0xFE, 0x28, 0xC3, 0x00, 0xC2, 0x05, 0xA2,
+    0x77, 0xA9, 0x43, 0xA6, 0x66, 0x9B, 0xAA, 0x98, 0xCC, 0x08, 0x03, 0xC0, 0x06, 0xA2, 0x87, 0xAA,
+    0x53, 0xB0, 0x10, 0xAC, 0x41, 0x9D, 0xBA, 0x60, 0x66, 0xC0, 0x36, 0x3D, 0x6E, 0xC0, 0x36, 0x3B,
+    0xC0, 0x38, 0x3B, 0x02, 0x36, 0x2E, 0x9E, 0x79, 0x9A, 0x8B, 0xA5, 0x05, 0xA6, 0x05, 0xA2, 0x37,
+    0xA3, 0x46, 0x5B, 0x55, 0xC1, 0x7A, 0x2A, 0x25, 0x20, 0x6B, 0xC0, 0x2C, 0xC0, 0x5E, 0xC1, 0x7A,
+    0x2C, 0x59, 0x29, 0xC0, 0x26, 0xC2, 0x2B, 0xCA, 0x28, 0xC0, 0x2B, 0xC0, 0x26, 0xC1, 0x2E, 0xC4,
+    0x7E, 0xC1, 0x6F, 0xC2, 0xFE, 0x7D, 0x56, 0x59, 0xC0, 0x11, 0xC0, 0x6E, 0xC1, 0x11, 0x16, 0xC0,
+    0x5A, 0xC0, 0x0E, 0xC1, 0x11, 0x0E, 0xD3, 0x69, 0x5A, 0x07, 0x69, 0x66, 0x75, 0x9E, 0xC9, 0x9A,
+    0xDB, 0x9D, 0xDA, 0xA3, 0xA6, 0xA4, 0x86, 0x3A, 0x76, 0x65, 0xC1, 0x6E, 0x6E, 0x33, 0x3A, 0x9E,
+    0x79, 0xFE, 0x59, 0x44, 0x09, 0x5A, 0xA2, 0x66, 0x08, 0x56, 0x03, 0xC0, 0x06, 0xC1, 0xA2, 0x86,
+    0xA5, 0x56, 0xA7, 0x55, 0xAA, 0x33, 0x9E, 0x78, 0x08, 0xC0, 0x03, 0xA5, 0x74, 0xFE, 0xBC, 0xB1,
+    0xA4, 0x87, 0x51, 0xA3, 0x56, 0x15, 0x03, 0x00, 0x08, 0xC0, 0x00, 0xC0, 0x17, 0xA9, 0x33, 0xAB,
+    0x33, 0xC0, 0x95, 0xDC, 0x96, 0xEE, 0x03, 0xC1, 0x09, 0xA6, 0x64, 0xB0, 0x10, 0xFE, 0xD4, 0xF2,
+    0x9F, 0xB9, 0x9D, 0xA9, 0x76, 0x31, 0x3D, 0x7A, 0x3D, 0x36, 0xC0, 0x6E, 0x36, 0x6F, 0x36, 0xC1,
+    0x33, 0x9A, 0x9B, 0x9E, 0x49, 0xA7, 0x05, 0xA4, 0x16, 0xA2, 0x37, 0x5F, 0x6E, 0x55, 0xC0, 0x7E,
+    0x2A, 0x66, 0xC0, 0x6B, 0xC2, 0x29, 0x6E, 0x29, 0x7E, 0x29, 0xC0, 0x26, 0xC4, 0x6E, 0xCA, 0x28,
+    0x7B, 0x2B, 0xC0, 0x26, 0xC0, 0x2E, 0xC4, 0x31, 0x6E, 0xC0, 0x6F, 0xC1, 0x7A, 0xC0, 0x19, 0x5A,
+    0xC0, 0x11, 0x16, 0xC1, 0x11, 0xC1, 0x16, 0x11, 0x5A, 0xC3, 0x13, 0x0E, 0xC4, 0x65, 0x0E, 0xC7,
+    0x66, 0xC1, 0x07, 0x04, 0x65, 0xA2, 0x76, 0x71, 0x76, 0x70, 0x9A, 0xEC, 0x9C, 0xDA, 0xA3, 0xA7,
+    0xA6, 0x74, 0xA0, 0xA8, 0x9C, 0xBA, 0x00, 0x65, 0x56, 0xA2, 0x66, 0x55, 0x7B, 0x56, 0x6E, 0xA5,
+    0x46, 0x93, 0xDE, 0xFE, 0x49, 0x03, 0x99, 0xAC, 0x5A, 0xC0, 0xA2, 0x76, 0x2F, 0x7F, 0xA5, 0x66,
+    0xA5, 0x65, 0xA5, 0x66, 0xA7, 0x54, 0xA7, 0x45, 0xA7, 0x55, 0xA4, 0x56, 0xFE, 0x62, 0x69, 0xFE,
+    0x00, 0x00, 0xC0, 0x03, 0xFE, 0x51, 0xC5, 0xFE, 0xD5, 0x33, 0x9B, 0xDB, 0x7E, 0xA3, 0x47, 0xFE,
+    0x61, 0xE7, 0x03, 0x00, 0xA8, 0x54, 0xA7, 0x54, 0x93, 0xEE, 0x03, 0x06, 0x0B, 0xA5, 0x55, 0xAE,
+    0x11, 0xA3, 0x67, 0x96, 0xDD, 0x96, 0xDD, 0x9D, 0x9A, 0xC1, 0x06, 0xA4, 0x75, 0xFE, 0x8B, 0x0B,
+    0xAE, 0x31, 0x3C, 0x75, 0x31, 0x36, 0x3D, 0xC0, 0x36, 0xC2, 0x3D, 0xC0, 0x36, 0x6F, 0x3B, 0x41,
+    0x99, 0x8C, 0xA1, 0x38, 0xA6, 0x05, 0xA4, 0x26, 0xA2, 0x47, 0x5F, 0x6E, 0x55, 0x34, 0x2D, 0x56,
+    0xC0, 0x6B, 0xC3, 0x5A, 0x7E, 0xC0, 0x29, 0xC0, 0x26, 0x6E, 0xC1, 0x26, 0xC0, 0x2B, 0xC4, 0x5A,
+    0xC4, 0x2B, 0xC2, 0x26, 0xC0, 0x7E, 0xC2, 0x31, 0xC1, 0x6E, 0xC0, 0x6F, 0xC0, 0x7A, 0xC1, 0x1E,
+    0x16, 0xC0, 0x66, 0xC7, 0x5A, 0xC2, 0x6E, 0xC3, 0x0E, 0xC7, 0x09, 0xC0, 0x0E, 0xC0, 0x09, 0xC0,
+    0x69, 0x6E, 0x69, 0x69, 0x71, 0xA0, 0xA8, 0x9C, 0xCA, 0x9B, 0xDB, 0x9F, 0xC8, 0xA4, 0x87, 0xA2,
+    0xA7, 0x3D, 0x65, 0x76, 0xA2, 0x77, 0x9D, 0x99, 0xA3, 0x56, 0x65, 0x36, 0xC0, 0x7F, 0x3D, 0xA3,
+    0x56, 0x5F, 0x98, 0xAB, 0x97, 0xBD, 0x9D, 0x99, 0xA2, 0x77, 0xA5, 0x66, 0xA5, 0x55, 0xA3, 0x88,
+    0xA5, 0x55, 0xA3, 0x76, 0xC0, 0x1B, 0x7F, 0xA3, 0x67, 0xFE, 0x93, 0x6E, 0xFE, 0x18, 0x41, 0x41,
+    0xC0, 0xA3, 0x75, 0xFE, 0x93, 0x8C, 0xAC, 0x53, 0x9A, 0xDB, 0x30, 0x1E, 0xFE, 0x72, 0x49, 0x06,
+    0x5A, 0xAE, 0x21, 0xFE, 0xB4, 0xD3, 0xFE, 0x6A, 0x69, 0x91, 0xFF, 0x06, 0xC0, 0x03, 0xA2, 0x77,
+    0xA6, 0x54, 0xA4, 0x66, 0x99, 0xBC, 0x03, 0x5E, 0x66, 0xC0, 0x06, 0xA7, 0x74, 0xFE, 0xC4, 0x70,
+    0xA2, 0xA8, 0x3A, 0x65, 0x36, 0x3D, 0xC3, 0x36, 0x3D, 0xC1, 0x3B, 0x65, 0x3B, 0x9C, 0x8A, 0x99,
+    0x8C, 0xA5, 0x06, 0xA6, 0x15, 0xA3, 0x27, 0x4F, 0xA2, 0x66, 0x56, 0x2C, 0x69, 0xC0, 0x2C, 0xC4,
+    0x31, 0xC1, 0x56, 0xC0, 0x5A, 0x6E, 0xC1, 0x26, 0xC1, 0x2B, 0xC3, 0x5A, 0xC4, 0x2B, 0xC2, 0x26,
+    0xC0, 0x7E, 0xC2, 0x31, 0xC1, 0x6E, 0xC1, 0x7F, 0xC2, 0x19, 0x5A, 0xC0, 0x11, 0xC7, 0x0E, 0xC2,
+    0x6E, 0xC1, 0x0E, 0xC8, 0x09, 0xC2, 0x0E, 0xC0, 0x02, 0x5A, 0x79, 0x7A, 0x79, 0x9C, 0xDA, 0x9D,
+    0xC9, 0x9C, 0xDB, 0xA1, 0x97, 0xA5, 0x85, 0xA2, 0x97, 0x3D, 0x65, 0x7E, 0x20, 0x9C, 0xAA, 0xA4,
+    0x55, 0xA5, 0x56, 0x33, 0x66, 0x7E, 0x31, 0xC0, 0x2E, 0xA4, 0x56, 0xA3, 0x56, 0x45, 0x1E, 0x66,
+    0xA2, 0x77, 0x7E, 0x52, 0x1C, 0x55, 0x55, 0x2A, 0xA2, 0x78, 0xA2, 0x57, 0xFE, 0x49, 0x44, 0x06,
+    0x03, 0xC0, 0xAC, 0x41, 0xFE, 0xC4, 0xD1, 0xA0, 0xA8, 0xA0, 0xA8, 0x3C, 0x28, 0xFE, 0x72, 0x49,
+    0x06, 0xC0, 0xAA, 0x43, 0xFE, 0xD5, 0x75, 0x9D, 0xA9, 0x92, 0xFF, 0xFE, 0x51, 0x44, 0x96, 0xCE,
+    0x06, 0x5A, 0x5A, 0x08, 0xC0, 0x00, 0xC2, 0x06, 0xA2, 0x96, 0xFE, 0xBC, 0x2F, 0xA5, 0x86, 0x61,
+    0x33, 0x36, 0x6B, 0xC5, 0x36, 0x6E, 0x33, 0x69, 0xC0, 0x6F, 0x99, 0xAC, 0x9F, 0x49, 0xA4, 0x26,
+    0xA5, 0x06, 0xA3, 0x36, 0x5F, 0x2F, 0xC0, 0x5A, 0xC5, 0x6E, 0x5A, 0x31, 0xC0, 0x56, 0xC0, 0x26,
+    0x2B, 0xC6, 0x5A, 0xC7, 0x2B, 0xC3, 0x26, 0x2E, 0xC1, 0x31, 0xC2, 0x6E, 0xC0, 0x7B, 0x6E, 0xC0,
+    0x00, 0xC0, 0xA0, 0xD9, 0xC0, 0x11, 0xC8, 0x0E, 0xC2, 0x07, 0xC0, 0x0E, 0xC5, 0x07, 0xC1, 0x02,
+    0x6B, 0xC0, 0x5A, 0xC0, 0x6E, 0x0E, 0x02, 0x69, 0x76, 0x75, 0x9F, 0xB8, 0x9B, 0xDA, 0x9C, 0xEA,
+    0xA2, 0x97, 0xA5, 0x75, 0x04, 0x71, 0xC0, 0x76, 0x55, 0x98, 0xDC, 0x6E, 0x36, 0xC0, 0xA2, 0x66,
+    0x33, 0x36, 0xC0, 0x66, 0xA2, 0x67, 0x3F, 0xC0, 0x59, 0xA2, 0x77, 0x9D, 0xAB, 0xC1, 0x55, 0x37,
+    0x6E, 0x37, 0x5E, 0xA5, 0x55, 0xFE, 0x9B, 0x6D, 0x19, 0x03, 0xC0, 0xA2, 0x86, 0xFE, 0x7B, 0x0B,
+    0xFE, 0xD5, 0x33, 0x2D, 0x38, 0x04, 0xA3, 0x57, 0xFE, 0x82, 0x8A, 0xFE, 0x18, 0x00, 0x03, 0xA5,
+    0x85, 0xFE, 0xC4, 0xD2, 0x20, 0xA1, 0x98, 0x98, 0xCC, 0xFE, 0x6A, 0x07, 0x92, 0xDF, 0x42, 0x03,
+    0xC1, 0x5A, 0xC0, 0x6E, 0x00, 0x03, 0x39, 0xFE, 0xBC, 0x30, 0x10, 0x38, 0x33, 0x36, 0x3D, 0xC5,
+    0x36, 0x6E, 0x38, 0xC0, 0x65, 0xA2, 0x77, 0x3F, 0x98, 0x9C, 0x9F, 0x49, 0xFE, 0x74, 0x50, 0xA5,
+    0x26, 0x4A, 0x5E, 0x5B, 0x5A, 0xC4, 0x2E, 0xC1, 0x7A, 0xC0, 0x56, 0xC0, 0x5A, 0x5E, 0x7A, 0xC4,
+    0x28, 0xC8, 0x2B, 0xC4, 0x2E, 0xC0, 0x31, 0x6E, 0x31, 0x36, 0xC1, 0x7B, 0xC0, 0x6E, 0xC0, 0x00,
+    0xC0, 0xA0, 0xE9, 0x11, 0xC8, 0x07, 0x0E, 0x07, 0x66, 0x07, 0xC1, 0x02, 0xC0, 0x07, 0x56, 0x0B,
+    0x69, 0x3F, 0x0B, 0x3F, 0xC2, 0x66, 0x6F, 0x3F, 0xC0, 0x04, 0x75, 0x61, 0x30, 0x9D, 0xD9, 0x9A,
+    0xFB, 0x9F, 0xB8, 0xA3, 0x97, 0xA4, 0x75, 0x33, 0xC0, 0x7A, 0x34, 0xC0, 0x99, 0xCB, 0x9B, 0xAA,
+    0xA8, 0x44, 0xA4, 0x56, 0x6E, 0x6F, 0xC1, 0x36, 0xC1, 0x5F, 0xC0, 0x38, 0x33, 0xC1, 0x66, 0xA3,
+    0x67, 0x65, 0x56, 0xA2, 0x66, 0xA2, 0x67, 0x9E, 0x79, 0xFE, 0x49, 0x44, 0x96, 0xBE, 0x03, 0x08,
+    0xA7, 0x74, 0xFE, 0xC4, 0xD2, 0x79, 0x71, 0x30, 0x3F, 0x1C, 0xFE, 0x82, 0xAA, 0x06, 0x03, 0xA3,
+    0x96, 0xFE, 0xBC, 0xB1, 0xA2, 0x97, 0x7A, 0xA2, 0x77, 0x9D, 0x99, 0xFE, 0x8B, 0x0B, 0x91, 0xEF,
+    0x09, 0x4A, 0xC0, 0x5A, 0xC1, 0x08, 0x06, 0xAD, 0x41, 0xFE, 0xD4, 0xB2, 0x3C, 0x33, 0x3D, 0x36,
+    0x66, 0x36, 0x3D, 0xC3, 0x36, 0x6E, 0x5A, 0xC1, 0x3B, 0xA2, 0x67, 0x9B, 0xAB, 0x9A, 0x8B, 0xA2,
+    0x27, 0xA6, 0x15, 0xA3, 0x37, 0x4A, 0x4F, 0xA2, 0x67, 0x51, 0x7F, 0xC0, 0x5A, 0x6E, 0x5A, 0xC1,
+    0x31, 0x2C, 0x5A, 0xC0, 0x5A, 0x28, 0xC1, 0x2B, 0x6E, 0xC0, 0x2B, 0x28, 0xC2, 0x66, 0xC0, 0x28,
+    0xC2, 0x26, 0x2B, 0xC3, 0x2E, 0xC0, 0x7E, 0x31, 0xC0, 0x6F, 0x7A, 0xC6, 0xA0, 0xE9, 0x5A, 0x65,
+    0xC0, 0x11, 0xC3, 0x16, 0xC0, 0x56, 0xC0, 0x07, 0xC1, 0x66, 0xC2, 0x07, 0x5A, 0x0B, 0xC0, 0x55,
+    0x04, 0xC0, 0x66, 0x04, 0xC0, 0x3C, 0x04, 0x3F, 0xC0, 0x65, 0x9F, 0xB8, 0x71, 0x9C, 0xDA, 0x9C,
+    0xDA, 0x9F, 0xC8, 0xA3, 0xA7, 0xA5, 0x75, 0x69, 0x3B, 0x51, 0x7B, 0xA2, 0x87, 0x9A, 0xBB, 0x98,
+    0xDC, 0xA7, 0x44, 0xA4, 0x56, 0x2A, 0x31, 0x36, 0x6F, 0x36, 0xC0, 0x02, 0x38, 0x66, 0xC0, 0x36,
+    0x3D, 0x7A, 0x56, 0x31, 0x36, 0x52, 0x6E, 0x37, 0x12, 0x24, 0xFE, 0x20, 0x40, 0x03, 0xC0, 0x7E,
+    0xFE, 0x7A, 0xCA, 0xFE, 0xDD, 0x34, 0x9C, 0xCA, 0x69, 0x61, 0xC0, 0xA5, 0x47, 0xFE, 0x7A, 0x8A,
+    0x06, 0x03, 0xA3, 0x96, 0xFE, 0xBC, 0x91, 0xA2, 0x97, 0x01, 0xC0, 0xA4, 0x66, 0x5F, 0x96, 0xCD,
+    0xFE, 0x61, 0xE6, 0x96, 0xCD, 0x06, 0xC0, 0x03, 0x06, 0xC0, 0xA4, 0x85, 0xFE, 0xA3, 0x8D, 0xAB,
+    0x53, 0x9D, 0xB9, 0x33, 0x36, 0xC4, 0x3D, 0xC0, 0x36, 0x3B, 0xC0, 0x5A, 0xC1, 0x3B, 0x02, 0xC0,
+    0x14, 0x9B, 0x6A, 0xA2, 0x47, 0xA6, 0x26, 0xA2, 0x37, 0xA2, 0x37, 0x4E, 0x7A, 0x25, 0x20, 0xA2,
+    0x67, 0x5A, 0xC2, 0x31, 0x2C, 0x5A, 0xC0, 0x5A, 0x5E, 0xC2, 0x2B, 0xC1, 0x28, 0xC1, 0x66, 0xC1,
+    0x28, 0xC2, 0x2B, 0xC3, 0x2E, 0xC2, 0x31, 0xC0, 0x6E, 0x7B, 0xC3, 0x6E, 0xC1, 0x9F, 0xEA, 0xC0,
+    0x66, 0x07, 0x0E, 0xC0, 0x6E, 0xC2, 0x0E, 0xC2, 0x5A, 0x04, 0x0E, 0xC2, 0x66, 0x5A, 0xC0, 0x0B,
+    0x6E, 0x3C, 0xC0, 0x0B, 0x59, 0x6E, 0xC1, 0x04, 0x65, 0x9F, 0xB8, 0x9D, 0xDA, 0x9B, 0xDA, 0x9C,
+    0xEA, 0xA1, 0xA8, 0xA4, 0x96, 0x3D, 0x65, 0x69, 0x3B, 0x27, 0x31, 0x9D, 0xBA, 0x97, 0xDC, 0xA5,
+    0x55, 0xA8, 0x34, 0xC1, 0x5A, 0xC0, 0x02, 0xC0, 0x3D, 0x02, 0x5A, 0x33, 0x66, 0x36, 0x7B, 0xC0,
+    0x31, 0x66, 0x31, 0x55, 0x33, 0x3F, 0xA0, 0x58, 0xFE, 0x40, 0xE2, 0x03, 0x6E, 0x03, 0xA3, 0x96,
+    0xFE, 0xB4, 0x0F, 0xA7, 0x75, 0x9D, 0xBA, 0x6D, 0x3F, 0x5A, 0xA4, 0x47, 0xFE, 0x72, 0x49, 0xFE,
+    0x10, 0x00, 0x5A, 0xA3, 0x96, 0xFE, 0xB4, 0x50, 0xA5, 0x86, 0x60, 0x04, 0x3C, 0xC0, 0xA5, 0x45,
+    0x0F, 0x96, 0xBD, 0xFE, 0x59, 0xC6, 0x97, 0xCC, 0x52, 0xC0, 0xA6, 0x65, 0xAF, 0x21, 0xAD, 0x31,
+    0xA1, 0xA7, 0x3F, 0x33, 0x7A, 0x6F, 0x3D, 0x36, 0xC1, 0x3D, 0x36, 0xC1, 0x3B, 0xC1, 0x02, 0x3B,
+    0xC0, 0x7F, 0x5A, 0x9A, 0x9B, 0x9B, 0x8B, 0xA2, 0x47, 0xA5, 0x16, 0xA5, 0x05, 0xA1, 0x47, 0x5A,
+    0x6F, 0xC0, 0x6E, 0x56, 0x6F, 0xC2, 0x29, 0xC1, 0x5A, 0x2B, 0xC8, 0x23, 0xC1, 0x2B, 0x28, 0x2B,
+    0xC5, 0x26, 0x2E, 0xC0, 0x7A, 0xC1, 0x7F, 0xC5, 0x6E, 0xC0, 0xA0, 0xD9, 0x16, 0x5A, 0xC4, 0x6E,
+    0x13, 0x10, 0xC4, 0x66, 0xC3, 0x66, 0x0B, 0xC0, 0x52, 0x10, 0x5B, 0x69, 0x69, 0x6E, 0xC0, 0x75,
+    0x76, 0x9F, 0xB9, 0x9D, 0xC9, 0x99, 0xFC, 0x9C, 0xEA, 0xA4, 0x86, 0x37, 0x3D, 0x75, 0xC0, 0x59,
+    0x66, 0x36, 0x9D, 0xAA, 0x97, 0xED, 0xA2, 0x77, 0x39, 0x6E, 0x36, 0x3E, 0x3B, 0x36, 0xC0, 0x6F,
+    0x3D, 0x02, 0x3A, 0x65, 0xC0, 0x7A, 0x7B, 0xC1, 0x2C, 0x31, 0x33, 0x3F, 0xA4, 0x46, 0x91, 0xDF,
+    0xFE, 0x20, 0x20, 0x03, 0x5A, 0xA0, 0xA8, 0xAE, 0x30, 0xFE, 0xD4, 0xB2, 0x9F, 0xB9, 0x61, 0x3A,
+    0x3F, 0x5E, 0xA3, 0x57, 0xFE, 0x61, 0xE7, 0x03, 0xC0, 0xA3, 0x96, 0xFE, 0xB4, 0x10, 0xA5, 0x85,
+    0x3F, 0xC0, 0x33, 0x37, 0x01, 0xA2, 0x67, 0xA3, 0x56, 0x9C, 0xAA, 0x97, 0xCD, 0x52, 0x7A, 0xA6,
+    0x65, 0xA6, 0x65, 0x75, 0x3F, 0x36, 0x31, 0x36, 0x02, 0xC0, 0x36, 0xCA, 0x6E, 0x36, 0x3B, 0x33,
+    0x9B, 0x9B, 0x0F, 0xA2, 0x37, 0xA6, 0x05, 0xA4, 0x16, 0x5E, 0x19, 0xA2, 0x67, 0x22, 0xC0, 0x7F,
+    0xC0, 0x5A, 0xC1, 0x29, 0xC0, 0x59, 0x26, 0x2B, 0xC6, 0x26, 0xC3, 0x2B, 0xC5, 0x26, 0x2E, 0xC1,
+    0x31, 0xC1, 0x7A, 0x6F, 0xC5, 0x7E, 0x18, 0xC0, 0x66, 0xC1, 0x18, 0x5B, 0x69, 0x7F, 0x5A, 0x15,
+    0x0D, 0x66, 0xC1, 0x0D, 0x14, 0x1C, 0xC1, 0x10, 0x66, 0x66, 0x6F, 0x5A, 0x14, 0x5A, 0x69, 0xA2,
+    0x76, 0x61, 0x65, 0xA1, 0x97, 0x9D, 0xDA, 0x9D, 0xC9, 0x99, 0xFC, 0x9E, 0xC9, 0xA5, 0x95, 0x37,
+    0x7A, 0x3D, 0x36, 0x3E, 0x39, 0x56, 0x61, 0x98, 0xCC, 0xC0, 0xAA, 0x33, 0xA2, 0x67, 0x36, 0x3B,
+    0xC1, 0x36, 0xC1, 0x3D, 0x3A, 0xC0, 0x3D, 0xC0, 0x31, 0x67, 0x7A, 0x2C, 0x55, 0x2C, 0x02, 0xA2,
+    0x67, 0x9F, 0x69, 0xFE, 0x51, 0x44, 0x96, 0xAE, 0x4A, 0xC0, 0xA1, 0xB7, 0xFE, 0x9B, 0x6D, 0xAC,
+    0x52, 0x3A, 0x51, 0xA2, 0x76, 0x3A, 0x3C, 0xA4, 0x36, 0xFE, 0x51, 0x85, 0x03, 0xC0, 0xA2, 0xA7,
+    0xFE, 0xB3, 0xEF, 0xA6, 0x76, 0x3A, 0x02, 0x66, 0x51, 0x3F, 0xA3, 0x56, 0x55, 0x6F, 0x66, 0xA2,
+    0x77, 0xC0, 0x61, 0x3F, 0x02, 0x65, 0x3D, 0x31, 0x36, 0x3D, 0xC0, 0x36, 0xC0, 0x3B, 0x36, 0x3D,
+    0x3B, 0xC0, 0x36, 0xC0, 0x31, 0xC0, 0xA2, 0x77, 0x36, 0xC0, 0x65, 0x31, 0x6B, 0x9D, 0x79, 0x9D,
+    0x6A, 0xA3, 0x16, 0xA3, 0x26, 0xA4, 0x35, 0xA1, 0x47, 0xA2, 0x67, 0x5B, 0xC0, 0x22, 0x7B, 0x6E,
+    0x2E, 0xC1, 0x22, 0x1F, 0xC0, 0x6B, 0x2B, 0xC4, 0x26, 0xC4, 0x2B, 0xC2, 0x2E, 0xC4, 0x31, 0x6E,
+    0x31, 0x7A, 0xC0, 0x6E, 0x6B, 0xC1, 0x34, 0xC2, 0x24, 0x66, 0x69, 0x5A, 0x6B, 0xC0, 0x6E, 0xC1,
+    0x55, 0x52, 0x65, 0xC2, 0x66, 0x6F, 0x05, 0x0A, 0xC0, 0x7A, 0xC0, 0x7B, 0x6B, 0x45, 0x55, 0xA2,
+    0x67, 0x6E, 0x60, 0x75, 0x75, 0x9D, 0xDA, 0x9D, 0xD9, 0x23, 0x9F, 0xC8, 0xA5, 0x86, 0xA5, 0x85,
+    0x61, 0x51, 0x02, 0x65, 0xC0, 0x7A, 0x9C, 0xAB, 0x9A, 0xBA, 0x62, 0xA9, 0x33, 0xA3, 0x67, 0x55,
+    0x00, 0x02, 0x31, 0x02, 0x36, 0x6B, 0x36, 0x02, 0x33, 0x3D, 0x02, 0x3D, 0x31, 0x66, 0x38, 0x99,
+    0xCB, 0xC0, 0x31, 0x2E, 0xA7, 0x25, 0xFE, 0x92, 0xEB, 0x11, 0x03, 0x5A, 0x03, 0xAA, 0x62, 0xFE,
+    0xCC, 0xB1, 0xA0, 0xB9, 0x3A, 0x2E, 0xC0, 0x6B, 0x3C, 0xA3, 0x47, 0xFE, 0x41, 0x04, 0x03, 0xC0,
+    0xA1, 0xB7, 0xFE, 0xBC, 0x10, 0x0B, 0x35, 0x3A, 0x3D, 0x31, 0x3D, 0xA2, 0x56, 0xC0, 0x5A, 0xC0,
+    0x0B, 0x3A, 0x55, 0x2E, 0x31, 0x6E, 0x02, 0x36, 0x3D, 0xC2, 0x36, 0x6E, 0x3D, 0x36, 0xC2, 0x3D,
+    0x36, 0xC0, 0x39, 0x36, 0x39, 0x66, 0x2C, 0xA2, 0x77, 0x3D, 0x9F, 0x58, 0x9D, 0x6A, 0x9D, 0x69,
+    0xA7, 0x03, 0xA3, 0x27, 0x4E, 0xA2, 0x57, 0x2A, 0x66, 0x6F, 0x56, 0x6E, 0xC2, 0x22, 0xC0, 0x5A,
+    0x26, 0x6E, 0xC1, 0x26, 0xC6, 0x2B, 0x2E, 0xC6, 0x7E, 0xC0, 0x7A, 0x66, 0xC2, 0x6B, 0x7E, 0xC0,
+    0x66, 0x34, 0xC1, 0x9E, 0xCA, 0xC0, 0x5A, 0x6B, 0xC0, 0x6E, 0xC0, 0x5A, 0x56, 0x69, 0x66, 0x2E,
+    0x36, 0x6F, 0x36, 0x66, 0x56, 0xC0, 0x59, 0x6E, 0x27, 0x36, 0x05, 0x6F, 0x52, 0x5E, 0xA2, 0x66,
+    0x9D, 0xA9, 0x22, 0xA3, 0x96, 0x9F, 0xC9, 0x98, 0xFC, 0x9B, 0xFA, 0xA3, 0xA5, 0xA4, 0x86, 0x3F,
+    0x69, 0x7A, 0x38, 0xC0, 0x62, 0xA1, 0x98, 0x9B, 0xBA, 0x9A, 0xBB, 0x7F, 0x20, 0x00, 0x9D, 0x9A,
+    0x00, 0xC0, 0x56, 0x69, 0x3D, 0x69, 0xC0, 0x6F, 0xC0, 0x3B, 0x02, 0xC0, 0x36, 0x31, 0xC0, 0x3D,
+    0x97, 0xDD, 0x6E, 0x3D, 0x3F, 0xA2, 0x57, 0xFE, 0x49, 0x03, 0x98, 0x9D, 0x4A, 0xC0, 0xA2, 0x86,
+    0xFE, 0x8B, 0x4B, 0xAF, 0x31, 0x9C, 0xC9, 0x76, 0x7B, 0x2E, 0x3D, 0xA2, 0x58, 0x9F, 0x68, 0xFE,
+    0x30, 0x82, 0x00, 0x7E, 0xA1, 0xC7, 0xFE, 0xC4, 0x50, 0x0B, 0x61, 0xC0, 0x7A, 0xC2, 0x3F, 0xC0,
+    0x6E, 0x2E, 0xC0, 0x33, 0x36, 0x02, 0x36, 0x02, 0x36, 0x3D, 0xC3, 0x36, 0xC0, 0x3B, 0xC0, 0x3D,
+    0xC3, 0x75, 0xC1, 0x6E, 0xC0, 0x31, 0x6B, 0xA2, 0x67, 0x9D, 0x79, 0x9A, 0x7B, 0xA3, 0x25, 0xA6,
+    0x04, 0xA2, 0x37, 0x4F, 0x5F, 0xA2, 0x78, 0x56, 0xC0, 0x76, 0x6E, 0xC0, 0x56, 0x6D, 0x2E, 0x2B,
+    0x26, 0xC2, 0x29, 0x30, 0xC1, 0x29, 0xC2, 0x2E, 0xC6, 0x31, 0x36, 0x7A, 0x66, 0xC3, 0x7A, 0xC0,
+    0x34, 0x03, 0x69, 0x37, 0x34, 0xA1, 0xA8, 0x7A, 0x5B, 0xC1, 0x6E, 0x5A, 0x66, 0x6F, 0xA3, 0x65,
+    0xA3, 0x77, 0xA2, 0x77, 0x7F, 0xC0, 0x6E, 0x7B, 0x31, 0x9D, 0xAA, 0x9D, 0x89, 0x9D, 0x99, 0x51,
+    0xC0, 0x67, 0x6E, 0x6B, 0x59, 0x30, 0x0F, 0xA7, 0x75, 0xA1, 0xA7, 0xFE, 0x95, 0x15, 0xFE, 0x83,
+    0x8E, 0xA4, 0xA6, 0xA4, 0x95, 0x7E, 0x33, 0x6E, 0x33, 0x69, 0x33, 0xA2, 0x87, 0x9B, 0xBB, 0x97,
+    0xED, 0x1F, 0xA6, 0x55, 0xA4, 0x55, 0x6B, 0x5A, 0x66, 0xC1, 0x3D, 0xC0, 0x7E, 0x55, 0x3D, 0x36,
+    0x6E, 0x36, 0x33, 0x66, 0xC0, 0x36, 0x3D, 0x1D, 0x24, 0x35, 0xA5, 0x45, 0x98, 0x9B, 0xFE, 0x28,
+    0x40, 0x9E, 0x6A, 0x5E, 0x08, 0xA8, 0x53, 0xFE, 0xC4, 0xD2, 0xA0, 0xA8, 0x9F, 0xB7, 0x9D, 0xBA,
+    0x2E, 0x7A, 0x35, 0xA4, 0x46, 0x99, 0x8C, 0xFE, 0x20, 0x20, 0x9F, 0x59, 0x03, 0xA5, 0x94, 0xFE,
+    0xC4, 0x50, 0xA3, 0x97, 0x65, 0x7A, 0x66, 0x38, 0x3D, 0xC1, 0x07, 0x55, 0x02, 0xC0, 0x31, 0xC0,
+    0x36, 0xC0, 0x3D, 0xC2, 0x66, 0x3D, 0xC0, 0x36, 0xC0, 0x3B, 0x36, 0xC2, 0x3D, 0xC0, 0x7A, 0x65,
+    0xC1, 0x36, 0xC0, 0x34, 0x31, 0x5B, 0x9E, 0x68, 0x99, 0x8B, 0xA6, 0x04, 0xA4, 0x16, 0xA3, 0x37,
+    0xA3, 0x46, 0xA1, 0x69, 0x56, 0xC0, 0x76, 0x7A, 0x2C, 0xC0, 0x2E, 0xC2, 0x29, 0xC2, 0x30, 0xC1,
+    0x6E, 0x30, 0x29, 0xC0, 0x2E, 0xC0, 0x29, 0x2E, 0xC0, 0x7A, 0xC2, 0x7E, 0x6B, 0xC3, 0x7A, 0xC3,
+    0x69, 0x37, 0x5A, 0xB0, 0x51, 0x6E, 0xC1, 0x6F, 0xC1, 0x5A, 0x7E, 0x6E, 0x6B, 0x7E, 0xC1, 0x6E,
+    0xC0, 0x14, 0x5A, 0x51, 0xC0, 0x38, 0x55, 0x56, 0x5A, 0x6B, 0x65, 0x9D, 0xA9, 0xA4, 0x86, 0xA0,
+    0xB7, 0xFE, 0xA5, 0x75, 0xFE, 0x9B, 0xEF, 0xA1, 0xB7, 0xA3, 0x97, 0x33, 0xC0, 0x7E, 0xC0, 0x33,
+    0x65, 0x7F, 0x9D, 0xBA, 0x98, 0xCC, 0x7B, 0x1B, 0xA4, 0x66, 0x5A, 0x55, 0xC0, 0x6F, 0xC9, 0x36,
+    0x31, 0xC0, 0x3D, 0xC0, 0x51, 0x3D, 0x56, 0x17, 0xFE, 0x7A, 0x69, 0x06, 0x4A, 0x6E, 0xA0, 0xA8,
+    0xFE, 0x62, 0x48, 0xFE, 0xDD, 0x33, 0x9D, 0xBA, 0x9D, 0xB9, 0x33, 0x7A, 0x31, 0x3A, 0x17, 0x92,
+    0xBF, 0x06, 0x00, 0x7A, 0xA6, 0x94, 0xFE, 0xCC, 0x71, 0xA1, 0xA7, 0x02, 0x3D, 0x33, 0x3A, 0x3D,
+    0xC0, 0x02, 0x3D, 0x02, 0x3D, 0xC0, 0x65, 0xC1, 0x36, 0x3D, 0xC5, 0x36, 0xC0, 0x3B, 0x36, 0xC0,
+    0x3D, 0x36, 0xC0, 0x3D, 0xC0, 0x79, 0x31, 0xC1, 0x69, 0x36, 0xC0, 0x31, 0xA2, 0x56, 0x99, 0x9C,
+    0x9D, 0x69, 0xA5, 0x16, 0xA6, 0x05, 0xA3, 0x37, 0x9F, 0x69, 0xA2, 0x67, 0x5A, 0x2C, 0xC0, 0x7A,
+    0x20, 0x31, 0xC1, 0x2C, 0xC0, 0x5A, 0xC1, 0x2C, 0x6B, 0xC3, 0x31, 0xC0, 0x29, 0x2E, 0x65, 0x31,
+    0xC1, 0x34, 0xC0, 0x6F, 0x6E, 0x00, 0x05, 0x00, 0x05, 0x00, 0xC3, 0x69, 0x34, 0x31, 0xFE, 0xD7,
+    0xDF, 0x6E, 0xC2, 0x5A, 0x66, 0xC0, 0x1F, 0xC1, 0x1A, 0x5A, 0x1A, 0xC1, 0x17, 0x6E, 0xC1, 0x17,
+    0xC0, 0x56, 0x0C, 0x14, 0xC0, 0x22, 0x9A, 0xEC, 0xFE, 0xA4, 0xF3, 0xFE, 0x8B, 0x4D, 0x0E, 0x37,
+    0x75, 0x7E, 0x5A, 0x3B, 0x33, 0xC0, 0xA1, 0x98, 0x9D, 0x99, 0x97, 0xED, 0xA3, 0x76, 0xA5, 0x56,
+    0xA3, 0x77, 0xC0, 0x5A, 0x56, 0x3D, 0xCE, 0x6E, 0x61, 0x3D, 0x3F, 0xA2, 0x58, 0xFE, 0x51, 0x44,
+    0x06, 0x4A, 0xC0, 0xA3, 0x95, 0xFE, 0xA3, 0xCE, 0xA8, 0x64, 0x71, 0x61, 0x33, 0x36, 0x31, 0x3A,
+    0x0D, 0xFE, 0x72, 0x48, 0xFE, 0x08, 0x00, 0xC0, 0x06, 0xA9, 0x73, 0xFE, 0xD4, 0x91, 0x3A, 0x3D,
+    0xC0, 0x33, 0x3A, 0xC0, 0x36, 0x3D, 0xC4, 0x31, 0x3D, 0xC7, 0x36, 0xC0, 0x3B, 0x36, 0xC0, 0x3D,
+    0xC0, 0x36, 0x3D, 0x36, 0x7B, 0x36, 0x31, 0x36, 0x31, 0x36, 0x61, 0x6E, 0xA2, 0x77, 0x22, 0x9A,
+    0x7B, 0xA0, 0x49, 0xA5, 0x15, 0xA4, 0x17, 0xA2, 0x46, 0xA3, 0x47, 0x29, 0x7E, 0x7B, 0x2F, 0x34,
+    0x56, 0x31, 0x34, 0x31, 0x2C, 0x69, 0x2C, 0xC0, 0x29, 0x66, 0x29, 0x7B, 0xC2, 0x29, 0x6E, 0xC1,
+    0x31, 0x6F, 0x7A, 0xC0, 0x3D, 0xC1, 0x66, 0x5A, 0xC0, 0x38, 0xC1, 0x33, 0x29, 0x38, 0xC2, 0xFE,
+    0xDF, 0xDF, 0xC1, 0x6E, 0x5A, 0x1D, 0xC1, 0x22, 0xC0, 0x1D, 0xC1, 0x22, 0xC0, 0x25, 0x22, 0x55,
+    0x1F, 0xC0, 0x17, 0x66, 0x7E, 0x51, 0x7B, 0xA1, 0x97, 0x99, 0xFC, 0xFE, 0xA4, 0x52, 0x99, 0xEB,
+    0xA4, 0x96, 0xA4, 0x86, 0x79, 0x55, 0x7E, 0x66, 0x36, 0x2E, 0x36, 0x51, 0x98, 0xCC, 0x62, 0xA9,
+    0x43, 0xA4, 0x66, 0x56, 0x66, 0x00, 0x36, 0xC0, 0x3D, 0xCE, 0x36, 0x3D, 0x3A, 0x9C, 0x8A, 0xFE,
+    0x40, 0x82, 0x9C, 0x6A, 0x03, 0xC0, 0xAC, 0x51, 0xFE, 0xD5, 0x34, 0x39, 0x30, 0x7A, 0xC0, 0x31,
+    0x2E, 0x56, 0x0D, 0xFE, 0x61, 0xA6, 0x06, 0xC1, 0xAF, 0x40, 0xFE, 0xD4, 0x92, 0x9F, 0xB8, 0x36,
+    0x6B, 0x3A, 0xC1, 0x3D, 0x36, 0x3D, 0xCA, 0x36, 0xC0, 0x3D, 0x36, 0xC0, 0x6E, 0x36, 0xC0, 0x3D,
+    0xC0, 0x36, 0x3D, 0x36, 0xC5, 0x61, 0xC0, 0xA2, 0x77, 0x36, 0x9D, 0x8A, 0x9C, 0x7A, 0xA0, 0x49,
+    0xFE, 0x7C, 0x71, 0xA2, 0x37, 0xA1, 0x37, 0xA3, 0x57, 0x7B, 0xC1, 0x34, 0x2F, 0x34, 0x31, 0xC1,
+    0x29, 0xC1, 0x35, 0x38, 0xC0, 0x56, 0xC0, 0x35, 0xC1, 0x69, 0x5A, 0x6B, 0x35, 0xC2, 0x32, 0xC3,
+    0x66, 0xC0, 0x66, 0xC5, 0x2D, 0xFE, 0xDF, 0xDF, 0xC3, 0x5E, 0xC4, 0x20, 0xC0, 0x6E, 0x20, 0xC0,
+    0x25, 0x1D, 0x22, 0x1A, 0xC0, 0x1D, 0x22, 0x20, 0xA0, 0xA8, 0x98, 0xFC, 0xFE, 0xAC, 0x51, 0xFE,
+    0xA3, 0x2D, 0xA5, 0x86, 0xA4, 0x86, 0x79, 0xC0, 0x59, 0x36, 0x31, 0xC0, 0x3E, 0x9D, 0x9A, 0x99,
+    0xCC, 0x9D, 0xA9, 0xA8, 0x44, 0x39, 0x66, 0x56, 0x31, 0xC0, 0x7F, 0x31, 0x3D, 0xD0, 0xA2, 0x67,
+    0x97, 0xBD, 0xFE, 0x38, 0x20, 0x9F, 0x59, 0x06, 0xA2, 0x76, 0xFE, 0x93, 0x6D, 0xAF, 0x30, 0x37,
+    0x76, 0x02, 0x31, 0xC0, 0x36, 0x3A, 0x0D, 0xFE, 0x69, 0xC6, 0xFE, 0x20, 0x00, 0x09, 0x0C, 0xFE,
+    0x9B, 0x0B, 0xAD, 0x31, 0x3A, 0x3D, 0xC0, 0x3A, 0xC0, 0x3D, 0x36, 0xC0, 0x3D, 0xCA, 0x36, 0xC0,
+    0x3D, 0x36, 0xC0, 0x6E, 0x36, 0xC0, 0x3D, 0xC0, 0x36, 0x3D, 0xC0, 0x36, 0xC2, 0x31, 0x36, 0x2A,
+    0x39, 0x6E, 0x36, 0x3B, 0x9D, 0x8B, 0x9A, 0x8B, 0xA2, 0x27, 0xA6, 0x05, 0xA1, 0x38, 0xA3, 0x36,
+    0x6F, 0x51, 0xC0, 0x66, 0x65, 0xC0, 0x5A, 0x6E, 0xA2, 0x77, 0x29, 0xA2, 0x77, 0x5B, 0xC0, 0x66,
+    0xC2, 0x5A, 0x6E, 0x69, 0x66, 0x5A, 0x2D, 0xC0, 0x39, 0x01, 0xC3, 0x6E, 0xC0, 0x6B, 0xC2, 0x7A,
+    0xC1, 0x0D, 0x66, 0x3C, 0x25, 0xC1, 0x5A, 0x66, 0x22, 0xC6, 0x25, 0x66, 0x1D, 0xC0, 0x69, 0x22,
+    0x56, 0x22, 0xC0, 0x71, 0xA2, 0x97, 0x98, 0xFC, 0xFE, 0xA4, 0x10, 0xFE, 0xA3, 0x0C, 0xA9, 0x64,
+    0xA3, 0x76, 0x71, 0xC1, 0x31, 0xC0, 0x2A, 0x31, 0x34, 0x99, 0xBB, 0x9C, 0xAA, 0x11, 0xA4, 0x66,
+    0x36, 0x31, 0xC2, 0x00, 0x34, 0x5F, 0xCE, 0x31, 0x3D, 0xC0, 0x9C, 0x8A, 0xFE, 0x58, 0xE3, 0x99,
+    0x9C, 0x5A, 0xAA, 0x42, 0xFE, 0xCC, 0xB2, 0xA1, 0x97, 0x9D, 0xBA, 0x3A, 0x7E, 0x36, 0xC0, 0x3D,
+    0x02, 0x5F, 0x92, 0xCF, 0xFE, 0x30, 0x00, 0x0C, 0xA7, 0x64, 0xFE, 0xC4, 0x30, 0xA4, 0x76, 0x75,
+    0x3D, 0xC1, 0x3A, 0xC0, 0x79, 0xC0, 0x3D, 0xC8, 0x36, 0xC2, 0x3D, 0x36, 0xC0, 0x6E, 0x36, 0xC0,
+    0x3D, 0xC0, 0x36, 0x3D, 0xC0, 0x36, 0xC4, 0x9D, 0xA9, 0x52, 0xA5, 0x54, 0x7F, 0x36, 0xC0, 0x9C,
+    0x8B, 0x98, 0x7C, 0xFE, 0x84, 0x10, 0xFE, 0x75, 0x13, 0xA0, 0x49, 0xA3, 0x56, 0x6F, 0xC0, 0xA2,
+    0x87, 0x51, 0x66, 0x5A, 0x45, 0x9D, 0xAA, 0x5A, 0x5A, 0x6F, 0x6F, 0x7F, 0x6E, 0xC0, 0x6F, 0x0A,
+    0x05, 0x36, 0x6E, 0x05, 0x69, 0x06, 0x7F, 0xA3, 0x67, 0x7E, 0xC1, 0x66, 0x3D, 0xA2, 0x77, 0xA3,
+    0x77, 0xA2, 0x77, 0x7F, 0x6E, 0x7A, 0xC0, 0x1C, 0x65, 0x08, 0x65, 0x25, 0xC0, 0x22, 0xC9, 0x25,
+    0xC2, 0x22, 0x66, 0x22, 0xC0, 0x75, 0xA0, 0xA8, 0x9A, 0xDB, 0xFE, 0xAC, 0x71, 0xFE, 0x9A, 0xEB,
+    0xA9, 0x64, 0xA5, 0x75, 0x9C, 0xBA, 0x7E, 0xC0, 0x2C, 0x31, 0xC0, 0x7E, 0x34, 0x99, 0xBB, 0x9C,
+    0xBB, 0xA6, 0x44, 0xA7, 0x45, 0x55, 0x31, 0xC0, 0x02, 0x36, 0xC0, 0x7B, 0xC0, 0x5A, 0xCF, 0x31,
+    0x56, 0x3A, 0x33, 0x97, 0xBC, 0x4A, 0xAC, 0x21, 0xA9, 0x54, 0x9D, 0xBA, 0x3A, 0x69, 0x36, 0x05,
+    0x39, 0x00, 0x33, 0xA2, 0x67, 0x42, 0xFE, 0x82, 0x28, 0x9C, 0x9A, 0xAC, 0x22, 0x0D, 0x04, 0x3F,
+    0x76, 0xC1, 0x3A, 0x3D, 0xC0, 0x36, 0x3D, 0xC8, 0x36, 0xC2, 0x3D, 0xC0, 0x36, 0x6E, 0x36, 0xC0,
+    0x3D, 0x36, 0xC3, 0x00, 0x36, 0xC0, 0x39, 0x36, 0x9A, 0xBB, 0x99, 0xCB, 0xA9, 0x33, 0x2F, 0x66,
+    0x39, 0x3D, 0x98, 0x9C, 0x9F, 0x49, 0xFE, 0xAD, 0x96, 0xFE, 0xB6, 0xFC, 0xA1, 0x47, 0xA2, 0x67,
+    0x6F, 0xA3, 0x76, 0x66, 0xC0, 0x56, 0x41, 0x51, 0x9D, 0x9A, 0x9D, 0x89, 0x9D, 0x99, 0x56, 0x5A,
+    0xC0, 0x6B, 0x65, 0xC1, 0x7F, 0xA2, 0x77, 0xA2, 0x76, 0xA4, 0x66, 0x7A, 0xA2, 0x77, 0x7F, 0x7E,
+    0xC0, 0x5A, 0x65, 0x27, 0xA2, 0x67, 0xA1, 0x97, 0x6E, 0xC0, 0x03, 0xC1, 0x08, 0xC0, 0x03, 0x5A,
+    0x1D, 0xC0, 0x22, 0xCF, 0x69, 0x76, 0x7A, 0x9B, 0xDB, 0xFE, 0xB4, 0xD2, 0xFE, 0xA3, 0x2C, 0xA7,
+    0x74, 0x02, 0x36, 0x3B, 0x02, 0xC0, 0x61, 0x36, 0xC0, 0x7A, 0x9B, 0xAB, 0x99, 0xDB, 0xA4, 0x67,
+    0x39, 0xC0, 0x36, 0xC1, 0x3B, 0x36, 0xC0, 0x7B, 0xC0, 0x3D, 0xCF, 0x51, 0x6B, 0x3D, 0xA3, 0x57,
+    0x55, 0xA3, 0x56, 0xC0, 0x61, 0x0B, 0x61, 0xC0, 0x3D, 0x05, 0x00, 0xC0, 0x02, 0x3F, 0xA3, 0x67,
+    0x45, 0x51, 0xA5, 0x55, 0x0B, 0x55, 0x02, 0x3D, 0xC0, 0x02, 0x3D, 0xC0, 0x36, 0xC0, 0x3D, 0xC6,
+    0x36, 0xC4, 0x02, 0xC0, 0x36, 0x02, 0x36, 0xC0, 0x3D, 0x36, 0xC8, 0x09, 0x9A, 0xBB, 0xA6, 0x54,
+    0x2F, 0xC0, 0x76, 0x00, 0x9D, 0x9A, 0x98, 0x9D, 0xFE, 0xB4, 0x73, 0xFE, 0xDE, 0xFC, 0xA6, 0x15,
+    0x4A, 0xA2, 0x66, 0x66, 0x12, 0xC0, 0x17, 0xC0, 0x5E, 0xC0, 0x5A, 0x46, 0x52, 0x27, 0x9D, 0xA9,
+    0x56, 0xC1, 0x7F, 0x2A, 0x3E, 0x0B, 0xC1, 0x6E, 0x7A, 0x66, 0xC0, 0x56, 0xC3, 0x01, 0x66, 0x69,
+    0x32, 0xC4, 0x22, 0xCF, 0x56, 0x22, 0x75, 0xA1, 0x98, 0x9C, 0xC9, 0xFE, 0xBD, 0x13, 0xFE, 0x93,
+    0x2C, 0xA6, 0x95, 0xA5, 0x75, 0x31, 0x6E, 0x02, 0x3B, 0x56, 0x31, 0x36, 0x7A, 0x9B, 0xBB, 0x97,
+    0xDD, 0xA3, 0x66, 0xA9, 0x44, 0x6E, 0xC0, 0xA2, 0x66, 0x3B, 0x02, 0x33, 0x36, 0xC0, 0x31, 0x3D,
+    0x36, 0xC0, 0x3D, 0xCC, 0x33, 0x3D, 0x66, 0xC0, 0x3A, 0x6F, 0x59, 0xC0, 0x7A, 0xC0, 0x3A, 0xC0,
+    0x02, 0x00, 0x34, 0x00, 0x3D, 0x02, 0x5E, 0xC0, 0x6F, 0x04, 0x3F, 0xC0, 0x02, 0x3A, 0x3D, 0x02,
+    0x3D, 0xC0, 0x36, 0xC0, 0x3D, 0xC6, 0x36, 0xC4, 0x02, 0xC0, 0x36, 0xC2, 0x3D, 0x36, 0xC0, 0x3D,
+    0xC0, 0x31, 0x36, 0xC2, 0xA2, 0x77, 0x36, 0x51, 0x6E, 0x3B, 0x61, 0x7E, 0x34, 0x6B, 0x9C, 0x9B,
+    0x98, 0x8D, 0xFE, 0xBC, 0xF4, 0xFE, 0xE7, 0x3D, 0xA1, 0x47, 0x6F, 0x5A, 0x52, 0x01, 0x65, 0x01,
+    0x6E, 0x5A, 0x6F, 0x6E, 0xC0, 0x5A, 0xC0, 0x16, 0xC4, 0x7A, 0x16, 0xC0, 0x19, 0x11, 0x66, 0xC0,
+    0x56, 0xC0, 0x65, 0xC0, 0x56, 0x65, 0x5A, 0xC1, 0x6B, 0x6E, 0xC2, 0xA5, 0xA4, 0xCA, 0x5A, 0xC2,
+    0x1C, 0x1F, 0x75, 0x76, 0x9F, 0xB8, 0xFE, 0xC5, 0x95, 0xFE, 0x93, 0x0B, 0xA6, 0x86, 0xA6, 0x75,
+    0x00, 0x05, 0x36, 0x6E, 0x33, 0x66, 0x36, 0xC0, 0x61, 0x96, 0xDD, 0xC0, 0xA8, 0x45, 0x2C, 0x31,
+    0x36, 0xC0, 0x0A, 0x9C, 0xAA, 0x56, 0x31, 0x36, 0xC3, 0x3D, 0xD1, 0x3A, 0x3F, 0xC2, 0x7A, 0xC0,
+    0x36, 0xC1, 0x00, 0x3D, 0x36, 0x3F, 0xC1, 0x33, 0xC0, 0x6E, 0x3A, 0xC0, 0x3D, 0xC2, 0x36, 0xC0,
+    0x3D, 0xC6, 0x36, 0x31, 0xC0, 0x3D, 0x05, 0x36, 0x02, 0x36, 0xC7, 0x3D, 0x36, 0xC7, 0x5D, 0xC0,
+    0x76, 0x36, 0x77, 0x6B, 0x98, 0xAC, 0x9E, 0x59, 0xFE, 0xDE, 0x18, 0xFE, 0xE7, 0x5D, 0x14, 0x46,
+    0x56, 0xC0, 0x35, 0x01, 0xC1, 0x6B, 0x6E, 0xC1, 0x6E, 0x6E, 0xC1, 0x5A, 0xC3, 0x17, 0x14, 0xC1,
+    0x0F, 0x56, 0x55, 0x52, 0x24, 0x56, 0xC2, 0x5A, 0xC0, 0x6E, 0x5A, 0xC1, 0x1F, 0xC2, 0x7A, 0x56,
+    0x1D, 0x1A, 0xC2, 0x17, 0xC3, 0x14, 0x06, 0x71, 0xA1, 0xA7, 0xFE, 0xCD, 0xD6, 0xFE, 0x93, 0x4D,
+    0xA5, 0x95, 0xA5, 0x86, 0x3B, 0x55, 0x3D, 0x33, 0x55, 0x33, 0x36, 0xC0, 0x39, 0x97, 0xDD, 0x9C,
+    0xAA, 0xA8, 0x44, 0xA4, 0x56, 0x25, 0x39, 0x2A, 0x31, 0x05, 0x96, 0xCD, 0xA2, 0x77, 0x36, 0xC4,
+    0x3D, 0xD3, 0x6E, 0xC0, 0x3D, 0x36, 0x3D, 0x36, 0xC1, 0x3D, 0xC0, 0x36, 0x3D, 0xC0, 0x02, 0x3A,
+    0x33, 0xC0, 0x3A, 0x3D, 0xC3, 0x36, 0xC0, 0x3D, 0xC5, 0x36, 0x02, 0x31, 0x3D, 0x05, 0x36, 0x02,
+    0xC1, 0x36, 0xC4, 0x3D, 0xC2, 0x36, 0xC5, 0x6E, 0x5A, 0xC0, 0x3B, 0x36, 0x77, 0xC0, 0x5B, 0x94,
+    0xBD, 0xA8, 0x04, 0xFE, 0xEE, 0xFB, 0x06, 0x4E, 0x1A, 0x12, 0x75, 0xC0, 0x6B, 0xC2, 0x08, 0xC0,
+    0x01, 0x6E, 0x0D, 0x12, 0x0F, 0xC5, 0x66, 0xC0, 0x07, 0x55, 0x66, 0x55, 0x21, 0x1C, 0x19, 0xC0,
+    0x5A, 0xC1, 0x5A, 0xC2, 0xA7, 0x93, 0x17, 0xC1, 0x12, 0xC1, 0x0D, 0x0A, 0x0F, 0xC1, 0x55, 0x6F,
+    0xC1, 0x0F, 0x06, 0x9F, 0xC9, 0xFE, 0xD6, 0x59, 0xFE, 0x93, 0x8E, 0xA0, 0xC8, 0xA6, 0x75, 0x3D,
+    0x7A, 0x31, 0x36, 0x5A, 0x56, 0x33, 0x7E, 0x36, 0x9B, 0xBB, 0x97, 0xDD, 0xA7, 0x44, 0xA6, 0x65,
+    0x31, 0x36, 0xC0, 0x31, 0x36, 0xC0, 0x95, 0xDE, 0x35, 0x36, 0xC0, 0x33, 0x02, 0x36, 0x3D, 0xC2,
+    0x36, 0x3D, 0xD0, 0x02, 0x3D, 0xC5, 0x02, 0x36, 0xC1, 0x3D, 0xC0, 0x36, 0xC0, 0x3D, 0xC4, 0x36,
+    0xC0, 0x3D, 0xC3, 0x02, 0x36, 0xC1, 0x52, 0x69, 0x36, 0x7F, 0xC0, 0x3D, 0x36, 0x31, 0x36, 0xC4,
+    0x02, 0x36, 0xC6, 0x02, 0x3B, 0xC1, 0x02, 0x00, 0x66, 0xC0, 0x5A, 0x9C, 0x9A, 0x99, 0x8B, 0xFE,
+    0xCD, 0x33, 0xFE, 0xEF, 0x7C, 0xA3, 0x37, 0x1A, 0x55, 0x12, 0x7A, 0xC3, 0x56, 0xC0, 0x06, 0xC1,
+    0x03, 0x0F, 0xC0, 0x0C, 0x07, 0xC1, 0x55, 0xC2, 0x56, 0x2D, 0x21, 0x5A, 0x16, 0xC0, 0x13, 0xC2,
+    0x5A, 0xC2, 0x0F, 0xC3, 0x66, 0x07, 0x66, 0x69, 0xC0, 0x6E, 0x5A, 0xC3, 0x03, 0xA0, 0xB8, 0x9B,
+    0xFB, 0xFE, 0xA4, 0x10, 0x99, 0xFB, 0xAB, 0x53, 0x2E, 0x31, 0x7F, 0xC0, 0x5A, 0x5E, 0xC0, 0x69,
+    0x7A, 0x22, 0x96, 0xED, 0xA2, 0x77, 0x25, 0x31, 0x22, 0x05, 0x36, 0xC0, 0x6F, 0x2E, 0x9B, 0xCB,
+    0x22, 0x36, 0xC1, 0x02, 0x36, 0x3D, 0xC2, 0x36, 0x3D, 0xD8, 0x02, 0x36, 0xC1, 0x3D, 0xC1, 0x36,
+    0x3D, 0xCA, 0x02, 0xC1, 0x3D, 0x36, 0x9D, 0xAA, 0x9B, 0xBB, 0x35, 0x00, 0x05, 0x3D, 0x36, 0xCF,
+    0x02, 0x36, 0xC1, 0x3D, 0x00, 0x56, 0xC1, 0x3A, 0x9A, 0xAA, 0x9D, 0x6A, 0xFE, 0xD6, 0x17, 0xFE,
+    0xE7, 0x9D, 0xA0, 0x58, 0x5F, 0xC0, 0x5B, 0x12, 0xC6, 0x0F, 0xC0, 0x5A, 0xC0, 0x56, 0x65, 0x5A,
+    0x66, 0x2D, 0x21, 0x2D, 0xC0, 0x56, 0x1E, 0xC0, 0x1B, 0x16, 0x13, 0x10, 0xC0, 0x59, 0x6B, 0xC3,
+    0x04, 0xC4, 0x66, 0xC0, 0x04, 0xC3, 0x35, 0xC0, 0x38, 0x9E, 0xC9, 0x9F, 0xD8, 0xFE, 0xC4, 0xF4,
+    0xFE, 0x9A, 0xEC, 0xA9, 0x63, 0x3A, 0x31, 0x36, 0x76, 0x6F, 0x3D, 0x6E, 0xC0, 0x3B, 0x3E, 0x98,
+    0xCC, 0x99, 0xDD, 0x1D, 0x2C, 0xC0, 0x36, 0xC0, 0x02, 0x3D, 0x36, 0x56, 0x36, 0x02, 0x31, 0x36,
+    0xC3, 0x3D, 0xC1, 0x36, 0x3D, 0xCC, 0x36, 0xC1, 0x3D, 0xC8, 0x36, 0x3D, 0x36, 0x67, 0xC1, 0x36,
+    0x3D, 0xC0, 0x36, 0xC0, 0x3D, 0xC6, 0x36, 0x02, 0xC0, 0x3D, 0x36, 0x22, 0x98, 0xDD, 0x55, 0x09,
+    0x05, 0xC0, 0x36, 0xCF, 0x3D, 0x36, 0xC1, 0x3D, 0xC3, 0x22, 0x3A, 0x94, 0xCE, 0xA8, 0x04, 0xFE,
+    0xDE, 0xB9, 0xA6, 0x16, 0x4A, 0x03, 0x07, 0xC0, 0x0C, 0xC5, 0x04, 0x3F, 0xC1, 0x56, 0x59, 0x25,
+    0x1B, 0x16, 0x13, 0xC2, 0x66, 0x13, 0xC0, 0x10, 0xC1, 0x56, 0x59, 0x6B, 0x66, 0xC2, 0xA5, 0xA5,
+    0x6E, 0xC1, 0x3C, 0x01, 0x3C, 0xC3, 0x01, 0x35, 0x2D, 0xC0, 0xA1, 0xA7, 0x9D, 0xEA, 0xFE, 0xBD,
+    0x97, 0xFE, 0x9B, 0x2D, 0xA3, 0xA7, 0xA7, 0x63, 0x31, 0x36, 0x2A, 0x36, 0xC1, 0x6F, 0x36, 0x7F,
+    0x34, 0x94, 0xEE, 0xA3, 0x77, 0x34, 0x31, 0xC0, 0x36, 0x31, 0x3D, 0x36, 0x31, 0x36, 0xC1, 0x31,
+    0xC0, 0x3D, 0x36, 0xC1, 0x3D, 0xC0, 0x36, 0xC0, 0x3D, 0xCC, 0x36, 0xC2, 0x3D, 0xC6, 0x36, 0xC0,
+    0x3D, 0xC5, 0x36, 0xC2, 0x3D, 0xC5, 0x33, 0x36, 0xC2, 0x2C, 0x9B, 0xBA, 0x9A, 0xBC, 0x3C, 0x31,
+    0xA3, 0x66, 0x3D, 0x36, 0xD2, 0x3D, 0xC0, 0x02, 0xC0, 0x50, 0x6B, 0x0A, 0x99, 0xAC, 0x98, 0x9C,
+    0xFE, 0xB4, 0xD3, 0xFE, 0xDF, 0x5C, 0x9F, 0x69, 0xA0, 0x59, 0x30, 0x6F, 0x01, 0x3C, 0xC0, 0x5A,
+    0xC1, 0x2D, 0xC0, 0x25, 0x66, 0xC0, 0x56, 0xC0, 0x5A, 0x59, 0x66, 0x5A, 0xC0, 0x08, 0xC0, 0x03,
+    0x08, 0x03, 0xC0, 0x08, 0x5A, 0xC0, 0x5A, 0x69, 0x67, 0x66, 0x3D, 0xC0, 0xA4, 0xB6, 0x39, 0xC1,
+    0x34, 0x5E, 0x34, 0x36, 0x39, 0xC3, 0x69, 0x3C, 0xA0, 0xA7, 0xFE, 0xC6, 0x7A, 0xFE, 0x93, 0xAF,
+    0x9C, 0xEA, 0xA8, 0x74, 0xA2, 0x86, 0x69, 0x6E, 0x69, 0x3B, 0xC0, 0x33, 0x36, 0xC0, 0x7B, 0x9A,
+    0xBB, 0x99, 0xCB, 0xA9, 0x34, 0xA3, 0x76, 0xA2, 0x67, 0x31, 0xC0, 0x36, 0xC0, 0x31, 0xC0, 0xA2,
+    0x67, 0x2E, 0x36, 0x31, 0xC0, 0x36, 0xC3, 0x3D, 0x36, 0xC0, 0x3D, 0xCC, 0x36, 0xC0, 0x3D, 0xC2,
+    0x02, 0xC0, 0x3D, 0xC2, 0x36, 0x3D, 0xC6, 0x36, 0xC2, 0x3D, 0xC3, 0x36, 0xC0, 0x33, 0xC0, 0x36,
+    0xC0, 0x00, 0x34, 0x18, 0x1C, 0x9C, 0xAA, 0xA6, 0x55, 0x00, 0x0A, 0x02, 0x36, 0xCB, 0x3D, 0x36,
+    0x3D, 0xC0, 0x36, 0xC0, 0x5E, 0xC1, 0x02, 0x3B, 0x31, 0x36, 0xA2, 0x68, 0x94, 0xDF, 0x9F, 0x58,
+    0xFE, 0xCD, 0xF8, 0xA7, 0x04, 0xA0, 0x38, 0x16, 0x1B, 0x6B, 0x66, 0xC0, 0x5A, 0x65, 0xC2, 0x06,
+    0x66, 0x5A, 0xC2, 0x03, 0x3E, 0x5A, 0xC5, 0x5A, 0xC0, 0x6E, 0xC0, 0x5A, 0x69, 0x66, 0xC2, 0xA5,
+    0xA6, 0xC0, 0x5A, 0xC1, 0x66, 0x2E, 0xC0, 0x55, 0x22, 0xC2, 0x79, 0x21, 0x9D, 0xE9, 0xFE, 0x94,
+    0x72, 0x02, 0xAA, 0x53, 0xA1, 0xA7, 0xC0, 0x05, 0x45, 0x7E, 0x33, 0x3B, 0xC0, 0x36, 0x66, 0x76,
+    0x97, 0xCC, 0x1C, 0x05, 0x65, 0x31, 0x36, 0xC2, 0x56, 0x36, 0x6B, 0x36, 0x6F, 0x31, 0x36, 0x31,
+    0x36, 0xC5, 0x3D, 0xCD, 0x36, 0x3D, 0xC1, 0x02, 0xC2, 0x3D, 0xC1, 0x36, 0x3D, 0xC6, 0x36, 0xC2,
+    0x3D, 0xC4, 0x36, 0xC1, 0x3D, 0x36, 0x31, 0x00, 0x65, 0x52, 0x9C, 0x99, 0x99, 0xCC, 0xAB, 0x22,
+    0x31, 0x02, 0x36, 0xCD, 0x3D, 0x36, 0xC1, 0x02, 0x59, 0xC1, 0x02, 0x36, 0x76, 0xA2, 0x68, 0x2D,
+    0x95, 0xBE, 0xA8, 0x03, 0xFE, 0xB6, 0x18, 0xA3, 0x07, 0xA2, 0x47, 0x5F, 0xC0, 0x5B, 0x66, 0x69,
+    0xC0, 0x00, 0x34, 0xC0, 0x5A, 0x66, 0x6F, 0xC1, 0x66, 0xC3, 0x5A, 0x33, 0x30, 0x38, 0x30, 0xC0,
+    0x6E, 0xC0, 0x5A, 0x6E, 0x65, 0xC0, 0x66, 0xC1, 0xA5, 0x96, 0xC0, 0x6E, 0x56, 0x66, 0x65, 0xC1,
+    0x5E, 0xC0, 0x66, 0xA2, 0x76, 0x65, 0x74, 0x9F, 0xD9, 0xFE, 0x9D, 0x54, 0xFE, 0x8B, 0x0C, 0xA7,
+    0x84, 0xA4, 0x76, 0x3A, 0x2E, 0x7A, 0x02, 0x69, 0x5A, 0x02, 0x3D, 0x31, 0x7B, 0x9C, 0xA9, 0x98,
+    0xCC, 0xA9, 0x33, 0xA4, 0x67, 0x36, 0xC5, 0x3D, 0x36, 0xC3, 0x3D, 0xDC, 0x2E, 0xC0, 0x0A, 0x3D,
+    0x36, 0x3D, 0xC7, 0x36, 0xC0, 0x3D, 0xC2, 0x02, 0x3D, 0xC6, 0x00, 0xC0, 0x36, 0x31, 0x96, 0xDD,
+    0xC0, 0x31, 0x02, 0x55, 0x36, 0x02, 0x36, 0x02, 0x36, 0xC6, 0x6E, 0xC0, 0x36, 0xC1, 0x3D, 0xC0,
+    0x3A, 0xC0, 0x38, 0x36, 0x31, 0x7B, 0xC0, 0x5A, 0x9D, 0x7A, 0x97, 0x9C, 0xFE, 0xA5, 0x13, 0xFE,
+    0x96, 0x58, 0xA1, 0x38, 0xA2, 0x37, 0x5B, 0x6B, 0x66, 0xC2, 0x7A, 0x26, 0xC3, 0x6B, 0x30, 0xC1,
+    0x2D, 0xC2, 0x66, 0x2D, 0xC0, 0x55, 0x6E, 0x6E, 0xC0, 0x23, 0xC0, 0x1E, 0xC2, 0xA4, 0x86, 0xC0,
+    0x6E, 0x0C, 0x69, 0x66, 0x67, 0x6E, 0xC0, 0x00, 0xC0, 0x03, 0x79, 0x9F, 0xB8, 0xFE, 0x9D, 0xD7,
+    0xFE, 0x8B, 0xEF, 0x9F, 0xE8, 0xA5, 0x86, 0xA1, 0x98, 0x50, 0x66, 0x31, 0xA2, 0x67, 0x33, 0x6F,
+    0x66, 0x38, 0x7E, 0x2F, 0x97, 0xDD, 0x59, 0x00, 0x36, 0xC6, 0x3D, 0x36, 0xC1, 0x3D, 0xDA, 0x31,
+    0x02, 0x3D, 0x29, 0x55, 0x3D, 0xC0, 0x02, 0x36, 0xC0, 0x3D, 0x36, 0xC0, 0x3D, 0xD1, 0x36, 0x3D,
+    0x31, 0x36, 0x7F, 0x98, 0xCC, 0x99, 0xCC, 0xAA, 0x23, 0xA6, 0x44, 0x33, 0xC0, 0x7E, 0x02, 0x36,
+    0x02, 0x36, 0xC5, 0x3B, 0xC0, 0x36, 0xC0, 0x3D, 0x38, 0x3D, 0xC0, 0x3A, 0xC0, 0x33, 0x31, 0x7B,
+    0x66, 0x3D, 0x46, 0x99, 0x9B, 0xA4, 0x16, 0xFE, 0x95, 0xD6, 0xA4, 0x16, 0xA1, 0x28, 0xA1, 0x59,
+    0xC0, 0x66, 0x28, 0x14, 0xC0, 0x6B, 0xC1, 0x1E, 0xC2, 0x23, 0xC0, 0x1E, 0xC1, 0x23, 0x6B, 0xC0,
+    0x1B, 0x7B, 0x1B, 0xC3, 0x2A, 0x59, 0xC2, 0xA1, 0xA9, 0x69, 0x6E, 0x65, 0xC0, 0x66, 0x30, 0xC1,
+    0x7E, 0xC0, 0x70, 0xA0, 0xB8, 0x9E, 0xD8, 0xFE, 0x94, 0x51, 0xFE, 0x9B, 0x4D, 0xA9, 0x63, 0xA2,
+    0x97, 0x51, 0x76, 0x31, 0xC0, 0x3D, 0x02, 0x59, 0x76, 0x31, 0x3B, 0x9D, 0xA9, 0x97, 0xDC, 0xA6,
+    0x46, 0x05, 0x36, 0x31, 0xC0, 0x36, 0xC7, 0x3D, 0xDC, 0x55, 0x98, 0xCC, 0xA4, 0x76, 0x3D, 0x36,
+    0x3D, 0xD5, 0x36, 0xC0, 0x31, 0x36, 0x00, 0x31, 0x36, 0x31, 0x99, 0xBB, 0x52, 0x36, 0x2E, 0x36,
+    0x02, 0x36, 0x02, 0xC0, 0x36, 0xC3, 0x3D, 0xC1, 0x02, 0x36, 0xC0, 0x3D, 0xC2, 0x5E, 0x3A, 0x33,
+    0x31, 0x00, 0x51, 0x3D, 0x0E, 0x9D, 0x8A, 0x98, 0x7C, 0xFE, 0x8C, 0xD3, 0xFE, 0x86, 0x18, 0xA2,
+    0x17, 0xA1, 0x48, 0x5B, 0x20, 0x69, 0xC0, 0x14, 0x20, 0xC1, 0x7A, 0xC0, 0x56, 0x14, 0x1B, 0xC0,
+    0x66, 0x69, 0x67, 0xC1, 0x59, 0x16, 0xC1, 0x1B, 0x6F, 0x1B, 0x5A, 0xC0, 0x27, 0x20, 0x18, 0xC0,
+    0xA2, 0x98, 0x69, 0xC0, 0x23, 0x7A, 0x66, 0xC2, 0x30, 0x29, 0x71, 0x9F, 0xD8, 0xFE, 0x9D, 0x56,
+    0xFE, 0x93, 0x4D, 0xA4, 0xA6, 0x3F, 0xC0, 0x2E, 0x31, 0x6E, 0x31, 0x36, 0x02, 0x36, 0x3D, 0x31,
+    0x76, 0x9B, 0xBB, 0x9B, 0xAA, 0xAA, 0x22, 0x00, 0x36, 0x31, 0xC0, 0x36, 0xC7, 0x3D, 0xDA, 0x6E,
+    0x9D, 0xAA, 0x69, 0x95, 0xEE, 0x15, 0x2E, 0x3D, 0xD6, 0x36, 0xC0, 0x3D, 0x2E, 0x36, 0x3D, 0x31,
+    0x3D, 0x31, 0x97, 0xCC, 0xA3, 0x77, 0x36, 0x31, 0x3D, 0x36, 0x02, 0x36, 0xC0, 0x3D, 0x36, 0xC7,
+    0x3D, 0xC3, 0x3F, 0x36, 0x31, 0x05, 0x3D, 0x66, 0xA2, 0x67, 0x5E, 0x98, 0x9D, 0xA1, 0x27, 0xFE,
+    0x8D, 0xB6, 0xA4, 0x07, 0xA1, 0x37, 0x5B, 0x20, 0x14, 0x28, 0x19, 0x14, 0x0F, 0xC0, 0x55, 0x66,
+    0x66, 0x65, 0x5A, 0x65, 0x56, 0x66, 0xC0, 0x7A, 0x6F, 0xC1, 0x6E, 0x6B, 0xA2, 0x66, 0xA2, 0x77,
+    0x6F, 0xC0, 0x18, 0x7F, 0x18, 0x55, 0x56, 0xA3, 0xA8, 0x59, 0x23, 0x66, 0xC1, 0x21, 0xC0, 0x1E,
+    0x21, 0x69, 0x9F, 0xB8, 0xFE, 0x8D, 0xF8, 0xFE, 0x8C, 0x31, 0xFE, 0xA3, 0x4D, 0x3A, 0xC0, 0x02,
+    0x3D, 0x31, 0xC0, 0x7A, 0x6E, 0x5A, 0xC0, 0x3D, 0x34, 0x66, 0x98, 0xCC, 0xC0, 0x34, 0x6F, 0x3D,
+    0xC0, 0x36, 0xC8, 0x3D, 0xC2, 0x02, 0x3D, 0xD6, 0x55, 0xC0, 0x9B, 0xBA, 0xA4, 0x67, 0x3D, 0xD3,
+    0x36, 0x3D, 0x36, 0xC5, 0x31, 0x00, 0x36, 0xA3, 0x77, 0x97, 0xCD, 0x99, 0xCB, 0x05, 0x31, 0xC0,
+    0x3D, 0xC1, 0x36, 0xC9, 0x3D, 0xC4, 0x02, 0x36, 0x02, 0xC0, 0x3D, 0xC0, 0x6F, 0x9E, 0x79, 0x10,
+    0xFE, 0x94, 0xD3, 0xFE, 0x86, 0x18, 0xA0, 0x38, 0x4F, 0x46, 0x7B, 0x69, 0xC0, 0x56, 0x66, 0xC0,
+    0x7A, 0x6E, 0x7F, 0xC0, 0xA2, 0x77, 0x7E, 0x6E, 0x7B, 0xC0, 0x66, 0x55, 0x66, 0x55, 0x01, 0x56,
+    0x2A, 0x56, 0xC0, 0x6E, 0x33, 0x6F, 0x55, 0x56, 0x65, 0xA6, 0x76, 0xC0, 0x1E, 0xC3, 0x66, 0xC1,
+    0x68, 0xA0, 0xC8, 0xFE, 0x85, 0x55, 0xFE, 0x7B, 0x6D, 0xA4, 0xD6, 0x3D, 0x59, 0x3D, 0x36, 0xC0,
+    0x31, 0x7A, 0x36, 0xC0, 0x3D, 0xC0, 0x34, 0x52, 0x96, 0xDD, 0xA5, 0x65, 0xA8, 0x33, 0x00, 0x3D,
+    0xC0, 0x36, 0xC7, 0x3D, 0xDB, 0x36, 0xC1, 0x2E, 0x31, 0x3D, 0xC0, 0x02, 0x3D, 0xD2, 0x36, 0xC2,
+    0x31, 0x3D, 0xC0, 0x31, 0x3D, 0x05, 0x6E, 0x31, 0x96, 0xDD, 0xA5, 0x66, 0x00, 0x31, 0x36, 0x3D,
+    0x02, 0x36, 0xC9, 0x3D, 0xC4, 0x02, 0xC0, 0x36, 0xC0, 0x02, 0x3D, 0x38, 0xA2, 0x57, 0x99, 0x9B,
+    0x9F, 0x39, 0xFE, 0x8D, 0xB6, 0xA1, 0x38, 0xA1, 0x48, 0x6F, 0xA3, 0x77, 0x6E, 0xA2, 0x77, 0xC0,
+    0x7B, 0x7E, 0xA2, 0x67, 0xA2, 0x77, 0x7E, 0x7E, 0x6E, 0xC1, 0x76, 0xC2, 0x56, 0x66, 0x5A, 0x56,
+    0x41, 0x51, 0x1D, 0x41, 0x3E, 0x56, 0x2F, 0x2A, 0x2F, 0xA3, 0x79, 0x6D, 0xC3, 0x6B, 0x20, 0x19,
+    0x79, 0x69, 0x9E, 0xE8, 0xFE, 0x7C, 0x72, 0x10, 0xA9, 0x93, 0x9F, 0xB8, 0x6F, 0x55, 0x6E, 0x7A,
+    0x31, 0xC1, 0x7F, 0x36, 0x3D, 0x76, 0x9D, 0xA9, 0x95, 0xDE, 0xAA, 0x32, 0x00, 0x36, 0x3D, 0xC2,
+    0x36, 0xC6, 0x3D, 0xD9, 0x6E, 0x3D, 0x31, 0x3D, 0x2E, 0x3D, 0xD2, 0x36, 0x3D, 0xC1, 0x36, 0xC2,
+    0x3D, 0x31, 0x36, 0x7F, 0xC0, 0x36, 0xC0, 0x05, 0x9A, 0xBB, 0x99, 0xCC, 0xAA, 0x33, 0x00, 0x31,
+    0x3D, 0xC0, 0x36, 0xC9, 0x3D, 0xC6, 0x02, 0x33, 0x02, 0x3D, 0x31, 0x3D, 0x9E, 0x78, 0x98, 0x8C,
+    0xFE, 0xA5, 0x74, 0xFE, 0xB6, 0xFB, 0xA3, 0x27, 0xA2, 0x68, 0xC0, 0x7E, 0xC2, 0x7A, 0x6E, 0xC2,
+    0x09, 0xC1, 0x7E, 0xC2, 0x66, 0x56, 0x06, 0xC0, 0x6E, 0x5A, 0x56, 0x9D, 0x9A, 0x55, 0x51, 0xC0,
+    0x6F, 0x15, 0x1E, 0xC4, 0x25, 0x20, 0x7E, 0x68, 0x70, 0x9D, 0xE9, 0xFE, 0x7B, 0xAF, 0xA0, 0xE7,
+    0x02, 0x36, 0xC0, 0x33, 0xC0, 0x36, 0x66, 0x36, 0xC3, 0x3B, 0x1B, 0x2F, 0xAA, 0x33, 0xA5, 0x55,
+    0xC1, 0x3D, 0xC2, 0x36, 0xC5, 0x3D, 0xC6, 0x02, 0xC1, 0x3D, 0xCE, 0x02, 0x3D, 0x36, 0x3D, 0x2E,
+    0x3D, 0x02, 0x3D, 0xD0, 0x36, 0x3D, 0xC1, 0x36, 0xC2, 0x31, 0x3D, 0x00, 0x31, 0xA2, 0x77, 0x3D,
+    0x36, 0xC0, 0x2C, 0x95, 0xEE, 0xA4, 0x66, 0x34, 0x00, 0x31, 0xC0, 0x36, 0xC9, 0x3D, 0xC6, 0x02,
+    0x36, 0xC0, 0x31, 0x36, 0xC0, 0x5E, 0x98, 0x9C, 0xA6, 0x06, 0xFE, 0xDF, 0x7C, 0xA2, 0x38, 0x11,
+    0x7A, 0xC1, 0x66, 0xC1, 0x14, 0xC2, 0x0F, 0xC0, 0x7A, 0x6E, 0xC2, 0x12, 0x14, 0xC0, 0x0F, 0x0C,
+    0x11, 0x5E, 0x0E, 0x13, 0xC0, 0x0E, 0x13, 0xC0, 0x23, 0xC3, 0x6B, 0x7B, 0xC0, 0x69, 0x1D, 0x9F,
+    0xB7, 0xFE, 0x75, 0x14, 0xFE, 0x83, 0x8E, 0xA5, 0xC5, 0x02, 0x36, 0xC0, 0x5B, 0x33, 0xC0, 0x36,
+    0xC1, 0x3D, 0xC1, 0x3B, 0x9C, 0xAA, 0x96, 0xED, 0xAC, 0x12, 0x3B, 0x00, 0x36, 0xCA, 0x3D, 0xC4,
+    0x31, 0x02, 0xC0, 0x33, 0xC0, 0x02, 0x3D, 0xC0, 0x31, 0x3D, 0xE7, 0x36, 0xC8, 0x31, 0xC0, 0x00,
+    0x9A, 0xBB, 0x98, 0xCC, 0xAB, 0x32, 0x05, 0x31, 0x02, 0x31, 0x36, 0xC6, 0x3D, 0xC8, 0x36, 0xC3,
+    0x33, 0x69, 0x4A, 0x96, 0xAE, 0xFE, 0xDE, 0x99, 0xFE, 0xD7, 0x9D, 0xA2, 0x47, 0x7B, 0x52, 0x7E,
+    0xC1, 0x69, 0x15, 0x1A, 0xCB, 0x17, 0xC2, 0x6E, 0xC4, 0x2D, 0x23, 0x6E, 0xC0, 0x23, 0xC0, 0x2A,
+    0xC0, 0x7E, 0x1D, 0x9E, 0xD8, 0xFE, 0x6C, 0x50, 0xFE, 0x93, 0x6D, 0x37, 0xA1, 0x96, 0x36, 0xC0,
+    0x33, 0xC1, 0x36, 0xC0, 0x3D, 0xC0, 0x02, 0x3D, 0x7A, 0x13, 0x97, 0xDC, 0x27, 0xA2, 0x76, 0x31,
+    0x36, 0xCA, 0x3D, 0xC5, 0x02, 0x3D, 0x3A, 0x33, 0x02, 0x3D, 0xEA, 0x36, 0xC2, 0x31, 0x36, 0xC3,
+    0x31, 0xC0, 0x34, 0xC0, 0x95, 0xDE, 0xA4, 0x66, 0x00, 0x36, 0x3D, 0x36, 0xC9, 0x3D, 0xC6, 0x36,
+    0x3D, 0x02, 0x3B, 0x33, 0x38, 0x2C, 0x5E, 0x95, 0xDF, 0xFE, 0xCD, 0x33, 0xFE, 0xEF, 0x9D, 0x05,
+    0xA2, 0x68, 0x55, 0x7B, 0x69, 0x6E, 0x0E, 0x16, 0x1D, 0xC8, 0x6E, 0x1D, 0xC3, 0x22, 0xC1, 0x5A,
+    0xC1, 0x22, 0x2D, 0x55, 0x23, 0xC1, 0x1E, 0x5B, 0x2A, 0x1E, 0x9F, 0xC8, 0x9C, 0xF9, 0xFE, 0x6B,
+    0x8E, 0xA2, 0xE6, 0xA7, 0x94, 0x36, 0x69, 0x33, 0xC2, 0x36, 0xC1, 0x3D, 0xC1, 0x00, 0x13, 0x97,
+    0xDC, 0xAA, 0x33, 0x34, 0x31, 0x36, 0xCA, 0x3D, 0xC3, 0x55, 0x55, 0x02, 0xA2, 0x67, 0x07, 0x13,
+    0x02, 0x3D, 0xC1, 0x66, 0x3D, 0xCF, 0x36, 0xC7, 0x3D, 0xD0, 0x36, 0xC5, 0x31, 0x34, 0xA2, 0x77,
+    0x99, 0xBC, 0x9A, 0xBB, 0x20, 0x36, 0x31, 0x3D, 0x36, 0xC6, 0x3D, 0xCB, 0x02, 0x59, 0xC0, 0x69,
+    0x7B, 0x96, 0xCE, 0xA2, 0x47, 0xFE, 0xF7, 0x5C, 0xA3, 0x37, 0xA2, 0x57, 0x1D, 0x7A, 0x1D, 0xC0,
+    0x16, 0x1D, 0x20, 0x25, 0x20, 0x25, 0x20, 0xC0, 0x25, 0xC1, 0x5A, 0x25, 0x22, 0xC2, 0x25, 0xC2,
+    0x22, 0xC2, 0x21, 0x19, 0x1E, 0xC1, 0x5A, 0xC1, 0x65, 0x9F, 0xD8, 0xFE, 0x75, 0x35, 0xFE, 0x73,
+    0x8E, 0xA6, 0xC4, 0x36, 0x2F, 0xC0, 0x36, 0x33, 0xC0, 0x38, 0x36, 0xC2, 0x3D, 0xC0, 0x7A, 0x9C,
+    0xAA, 0x95, 0xEE, 0xAB, 0x32, 0x34, 0x5A, 0x36, 0xCA, 0x3D, 0x02, 0xC0, 0x3D, 0xC0, 0x2E, 0x02,
+    0xC0, 0x9B, 0xAA, 0x6F, 0xA6, 0x65, 0x07, 0x02, 0x3D, 0xC0, 0x66, 0x3D, 0xCE, 0x36, 0xC8, 0x3D,
+    0xD1, 0x36, 0xC2, 0x3D, 0x36, 0x31, 0x00, 0x34, 0x00, 0x96, 0xDD, 0xC0, 0x00, 0x31, 0x36, 0xC1,
+    0x31, 0x36, 0xC3, 0x3D, 0xCB, 0x02, 0x59, 0xC0, 0x3B, 0xC0, 0x9A, 0xCC, 0x97, 0x9D, 0xFE, 0xEE,
+    0x58, 0xFE, 0xF7, 0xDE, 0x4E, 0x25, 0x69, 0x20, 0x25, 0xC3, 0x7A, 0xC1, 0x25, 0xCD, 0x5A, 0xC1,
+    0xFE, 0x4E, 0x7D, 0x69, 0x5A, 0xC2, 0x5B, 0x65, 0x75, 0x9D, 0xE9, 0xFE, 0x6C, 0x52, 0xFE, 0x8B,
+    0x8E, 0xA8, 0xA3, 0x9E, 0xC8, 0x7F, 0xC0, 0x31, 0xC0, 0x6E, 0x3B, 0xC0, 0x36, 0xC2, 0x3D, 0x00,
+    0x51, 0x94, 0xEE, 0x18, 0xA3, 0x76, 0x39, 0x36, 0xC0, 0x3B, 0x36, 0xC9, 0x3D, 0xC0, 0x33, 0xC0,
+    0x0B, 0x93, 0xEF, 0x69, 0x0B, 0xA6, 0x55, 0xAC, 0x22, 0x02, 0x3D, 0xCD, 0x36, 0xCE, 0x3D, 0xCD,
+    0x02, 0x3D, 0xC5, 0x31, 0x00, 0x2C, 0x00, 0x9B, 0xBB, 0x96, 0xDC, 0xAC, 0x22, 0xA4, 0x56, 0x31,
+    0xC3, 0x36, 0xC2, 0x3D, 0xCC, 0x3A, 0x33, 0x3D, 0x00, 0xC0, 0x92, 0xDF, 0xFE, 0xCD, 0x13, 0xFE,
+    0xFF, 0x9D, 0xA2, 0x37, 0x6E, 0x6B, 0xC0, 0x5A, 0xC0, 0x28, 0xC9, 0x25, 0xC6, 0x69, 0x25, 0xC0,
+    0x1D, 0xC0, 0x1B, 0xC3, 0x6F, 0x5A, 0x61, 0x9C, 0xC9, 0xFE, 0x55, 0x36, 0xFE, 0x63, 0xAF, 0xA1,
+    0xE7, 0xA7, 0xA3, 0x36, 0x39, 0x34, 0xC0, 0x31, 0x36, 0x3B, 0x02, 0x3B, 0x36, 0xC2, 0x3D, 0x36,
+    0x93, 0xFF, 0xA7, 0x54, 0x36, 0xC2, 0x3B, 0xC0, 0x36, 0xC5, 0x31, 0xC0, 0x36, 0x31, 0x5A, 0x3A,
+    0x02, 0x95, 0xCD, 0x95, 0xDD, 0xFE, 0xCC, 0x0E, 0x96, 0xDD, 0x99, 0xCC, 0x33, 0x02, 0x66, 0xC4,
+    0x02, 0x3D, 0xC4, 0x36, 0xC5, 0x3D, 0xC1, 0x36, 0xC2, 0x3D, 0xC1, 0x36, 0x3D, 0xD5, 0x66, 0x31,
+    0x34, 0xC0, 0x6B, 0x97, 0xCC, 0x65, 0x00, 0x6E, 0x31, 0xC2, 0x36, 0x3D, 0xC7, 0x3A, 0xC0, 0x3D,
+    0xC3, 0x3A, 0xC0, 0x33, 0x00, 0x2C, 0xA3, 0x77, 0x96, 0xAC, 0xA4, 0x36, 0xFE, 0xFF, 0x5C, 0xA4,
+    0x25, 0x21, 0xC0, 0x6B, 0xCD, 0x25, 0xC7, 0x1D, 0xC0, 0x69, 0xFE, 0x46, 0x7C, 0xC0, 0x27, 0xC0,
+    0x1F, 0xC0, 0x51, 0x61, 0x9C, 0xD9, 0x9D, 0xF9, 0xFE, 0x6B, 0x4E, 0xA6, 0xB4, 0x04, 0x75, 0x31,
+    0x34, 0xC1, 0x36, 0xC0, 0x3B, 0xC0, 0x36, 0xC3, 0x05, 0x94, 0xEE, 0xA3, 0x76, 0xA7, 0x44, 0xC0,
+    0x36, 0x3B, 0xC0, 0x36, 0xC7, 0x31, 0xC1, 0x2E, 0x33, 0x04, 0x9D, 0x99, 0xFE, 0x9A, 0x68, 0x51,
+    0x6E, 0xAA, 0x33, 0x3F, 0x66, 0x33, 0x36, 0x3D, 0xC9, 0x36, 0xCE, 0x3D, 0xC0, 0x36, 0xC0, 0x3D,
+    0xD3, 0x38, 0x31, 0xC1, 0x00, 0x9C, 0xAA, 0x96, 0xDD, 0x09, 0x05, 0x31, 0x36, 0xC2, 0x3D, 0x02,
+    0x3D, 0xC2, 0x3F, 0x69, 0xC2, 0x3A, 0xC0, 0x3D, 0xC4, 0x00, 0x2C, 0x3D, 0x9B, 0x9A, 0x9B, 0x7A,
+    0xFE, 0xEE, 0x99, 0xFE, 0xF7, 0xFE, 0x4A, 0x7A, 0x21, 0x28, 0xC3, 0x21, 0xC0, 0x28, 0xC4, 0x5A,
+    0xC9, 0x1D, 0xC0, 0xFE, 0x46, 0x9D, 0xC2, 0x1F, 0x41, 0x51, 0x9C, 0xCA, 0xA1, 0xB7, 0xFE, 0x75,
+    0x57, 0xFE, 0x73, 0x4E, 0xA9, 0xA2, 0x04, 0x36, 0xC0, 0x00, 0x65, 0xC0, 0x5A, 0x36, 0xC5, 0x02,
+    0x05, 0x96, 0xCC, 0x7A, 0x36, 0x55, 0x3B, 0xC1, 0x36, 0xC7, 0x31, 0x36, 0x3D, 0x2E, 0x33, 0x9D,
+    0x9A, 0xA6, 0x44, 0xA2, 0x77, 0x04, 0x1D, 0x62, 0x9D, 0x99, 0x33, 0xC0, 0x3D, 0x36, 0x3D, 0xC8,
+    0x36, 0xCE, 0x3D, 0x36, 0xC0, 0x3D, 0xD4, 0x66, 0x00, 0x31, 0x34, 0x31, 0xC0, 0x1C, 0x0D, 0x2C,
+    0x38, 0x36, 0xC2, 0x3D, 0x02, 0x36, 0x3A, 0xC0, 0x3D, 0x3F, 0x69, 0xC0, 0x33, 0xC0, 0x3A, 0xC2,
+    0x3D, 0xC2, 0x66, 0x00, 0x3D, 0x41, 0x94, 0xCE, 0xFE, 0xD5, 0xB5, 0xFE, 0xFF, 0xDD, 0x24, 0xC0,
+    0x21, 0x67, 0x6E, 0xC2, 0x21, 0xC0, 0x28, 0xC4, 0x25, 0xC8, 0x22, 0xC1, 0xFE, 0x36, 0x1B, 0x7F,
+    0x6E, 0x56, 0x55, 0x5A, 0x6B, 0x9F, 0xB9, 0xA2, 0xC6, 0xFE, 0x85, 0x98, 0xFE, 0x83, 0x4E, 0xA9,
+    0x82, 0x04, 0x27, 0x52, 0x65, 0x2A, 0x7F, 0x36, 0x3D, 0x36, 0x66, 0x36, 0xC0, 0x7E, 0x39, 0x31,
+    0xA3, 0x66, 0x27, 0x97, 0xCD, 0x27, 0x33, 0x7D, 0x66, 0x3B, 0x36, 0x31, 0x36, 0xC1, 0x7B, 0x36,
+    0xC1, 0x31, 0x36, 0xC0, 0x2E, 0x5A, 0x96, 0xDC, 0x98, 0xBC, 0x0C, 0xA2, 0x77, 0x0C, 0x9C, 0xAA,
+    0xA8, 0x54, 0x2E, 0x33, 0x3D, 0x6E, 0x3D, 0xC2, 0x36, 0xC4, 0x3D, 0xC0, 0x36, 0xC2, 0x02, 0xC0,
+    0x36, 0xC2, 0x3B, 0x36, 0xC0, 0x3D, 0xD9, 0x36, 0x39, 0x31, 0x2C, 0xA2, 0x77, 0x9D, 0xAA, 0x94,
+    0xEE, 0xA7, 0x44, 0x00, 0xC0, 0x31, 0xC0, 0x36, 0xC0, 0x33, 0x02, 0x3D, 0x3A, 0xC0, 0x6D, 0xC1,
+    0x33, 0xC0, 0x3D, 0x3A, 0xC3, 0x3D, 0xC0, 0x31, 0x6B, 0x7A, 0x02, 0x93, 0xCF, 0xFE, 0xCC, 0xF2,
+    0xFE, 0xFF, 0xBD, 0xA2, 0x47, 0x21, 0x28, 0x23, 0x7E, 0x28, 0xC9, 0x25, 0xC5, 0x22, 0xC2, 0x56,
+    0x69, 0xFE, 0x35, 0xFA, 0x66, 0x69, 0x5F, 0x6E, 0x5B, 0x76, 0x71, 0xA0, 0xE8, 0xFE, 0x74, 0xB5,
+    0xFE, 0x8B, 0x6E, 0xA8, 0x92, 0xA2, 0x86, 0x9D, 0xBA, 0x97, 0xDD, 0x0D, 0xA8, 0x53, 0x2A, 0x6F,
+    0xC0, 0x6B, 0x55, 0x36, 0x05, 0xC0, 0x65, 0x36, 0xA3, 0x66, 0x96, 0xBD, 0xFE, 0x69, 0x22, 0xAD,
+    0x21, 0xFE, 0xED, 0x10, 0x61, 0x56, 0x9D, 0xBA, 0x6F, 0x7F, 0x66, 0xC0, 0x31, 0xC0, 0x00, 0x36,
+    0x2E, 0x3D, 0x02, 0x2E, 0x59, 0xA4, 0x67, 0x9D, 0x99, 0x97, 0xDD, 0x9C, 0x99, 0x9A, 0xCC, 0xA2,
+    0x77, 0xA5, 0x65, 0xAA, 0x33, 0x2E, 0x6E, 0x36, 0xC2, 0x3D, 0x02, 0x36, 0xC4, 0x3D, 0x36, 0xC3,
+    0x3D, 0x02, 0x69, 0xC0, 0x36, 0x3B, 0xC0, 0x36, 0xC0, 0x3D, 0xD9, 0x36, 0x31, 0x00, 0x31, 0xC0,
+    0x66, 0x98, 0xCC, 0x9C, 0xAA, 0x2C, 0x05, 0x31, 0xC1, 0x36, 0x02, 0x33, 0x3D, 0xC0, 0x33, 0x36,
+    0x5E, 0xC0, 0x33, 0xC0, 0x3D, 0xC0, 0x3A, 0xC2, 0x33, 0xC0, 0x3D, 0x00, 0x66, 0x00, 0x96, 0xAD,
+    0xA9, 0x03, 0xFE, 0xFF, 0x9D, 0xA2, 0x57, 0x28, 0xC1, 0x23, 0x28, 0xC7, 0x5A, 0xC2, 0x5A, 0xC2,
+    0x5A, 0x1A, 0xC1, 0x56, 0x65, 0x5A, 0x9D, 0x1B, 0x51, 0x41, 0x9D, 0x99, 0x56, 0x52, 0x66, 0x71,
+    0xA1, 0xD6, 0xFE, 0x74, 0x52, 0xFE, 0x9B, 0x8E, 0x38, 0x7A, 0x9D, 0xBA, 0x96, 0xDD, 0x1C, 0x25,
+    0x7F, 0x39, 0x36, 0x3D, 0x55, 0x3D, 0xC0, 0x05, 0x66, 0x2E, 0x04, 0xFE, 0x71, 0x84, 0x49, 0xA8,
+    0x32, 0xAB, 0x31, 0xAA, 0x54, 0x62, 0x66, 0x66, 0x66, 0x7B, 0x62, 0x6E, 0xC0, 0x3D, 0xC0, 0x6F,
+    0x3D, 0x3A, 0x66, 0x6D, 0x6F, 0xA2, 0x77, 0xC0, 0x56, 0x04, 0x13, 0x65, 0x66, 0x33, 0x36, 0xC2,
+    0x3D, 0xC0, 0x02, 0x36, 0xCE, 0x3B, 0xC1, 0x36, 0xC0, 0x02, 0xC1, 0x3D, 0xD6, 0x36, 0x2E, 0x02,
+    0x36, 0x2C, 0xC0, 0x55, 0x95, 0xED, 0xA6, 0x56, 0xA7, 0x54, 0xC0, 0x36, 0x02, 0x36, 0x02, 0x33,
+    0x3D, 0xC0, 0x33, 0x36, 0x38, 0xC0, 0x3A, 0xC0, 0x3D, 0x3A, 0x3D, 0xC2, 0x33, 0x36, 0x02, 0x76,
+    0x66, 0x05, 0x99, 0x9C, 0x9F, 0x58, 0xFE, 0xFF, 0x3C, 0xA5, 0x25, 0x28, 0x5A, 0x28, 0xC0, 0x25,
+    0xC7, 0x5A, 0xC2, 0x1F, 0x1A, 0x5A, 0x66, 0x5A, 0x66, 0x03, 0x5A, 0xC0, 0x56, 0x69, 0xA3, 0x17,
+    0xC1, 0x56, 0x41, 0x56, 0x16, 0x9E, 0xC9, 0xA2, 0xC7, 0xFE, 0x94, 0xD3, 0xFE, 0xA3, 0x8D, 0x33,
+    0x79, 0x62, 0x9C, 0xAB, 0x7E, 0x34, 0x69, 0x2A, 0x36, 0x6F, 0x3D, 0xC1, 0x50, 0x05, 0x41, 0x4E,
+    0xFE, 0x40, 0x80, 0xFE, 0x9B, 0xCB, 0xAA, 0x20, 0xFE, 0x6A, 0x82, 0xAB, 0x43, 0xAA, 0x43, 0xA0,
+    0x9A, 0x9B, 0xCC, 0x7B, 0x7E, 0x77, 0x66, 0xC0, 0x52, 0x7F, 0x09, 0xC0, 0x3D, 0xC1, 0x02, 0x3F,
+    0xC4, 0x66, 0x3D, 0xC5, 0x02, 0x3D, 0x36, 0xC1, 0x3D, 0xC2, 0x36, 0xC7, 0x3B, 0x36, 0xC1, 0x02,
+    0x3D, 0x36, 0xC0, 0x3D, 0xD5, 0x3A, 0x36, 0xC0, 0x66, 0xC1, 0x7F, 0x99, 0xBB, 0x9A, 0xCB, 0xA9,
+    0x33, 0xA4, 0x66, 0xC0, 0x6E, 0x36, 0xC1, 0x3D, 0xC0, 0x36, 0xC1, 0x5E, 0x3F, 0xC0, 0x3D, 0x3A,
+    0x3D, 0xC2, 0x36, 0xC0, 0x02, 0x00, 0xC0, 0x3D, 0x9C, 0x9A, 0x98, 0x9C, 0xFE, 0xEE, 0xBA, 0xFE,
+    0xEF, 0xDE, 0x4F, 0xC3, 0x5A, 0xC5, 0x5A, 0x1A, 0x17, 0xC0, 0x56, 0xC0, 0x59, 0x66, 0x56, 0x66,
+    0x59, 0xC0, 0x5A, 0xC0, 0x29, 0x26, 0xA5, 0x55, 0x5A, 0xC0, 0x56, 0x6E, 0x5A, 0x0D, 0x9E, 0xCA,
+    0xA0, 0xC7, 0xFE, 0xA5, 0x13, 0xFE, 0xAB, 0x6C, 0x3B, 0x2F, 0x7A, 0xA0, 0x8A, 0xC0, 0x69, 0x36,
+    0x55, 0x6F, 0x02, 0x3D, 0x66, 0xC0, 0x00, 0xC0, 0xA2, 0x57, 0x9A, 0x9A, 0xFE, 0x30, 0x60, 0xFE,
+    0x7B, 0x48, 0xFE, 0xCE, 0x91, 0x96, 0xDB, 0xFE, 0x6B, 0x63, 0xA2, 0x98, 0xA9, 0x55, 0xA4, 0x88,
+    0x72, 0x9D, 0xBB, 0x72, 0x36, 0x56, 0x3D, 0x52, 0x69, 0x38, 0x3D, 0xC0, 0x7E, 0xC0, 0x3D, 0x36,
+    0xC1, 0x6F, 0xC0, 0x3A, 0x3D, 0xC0, 0x6B, 0x3D, 0xC0, 0x02, 0xC0, 0x3B, 0xC7, 0x36, 0xC0, 0x3B,
+    0xC0, 0x36, 0xCE, 0x3D, 0xC2, 0x36, 0xC0, 0x3D, 0xC7, 0x3A, 0x3D, 0xC4, 0x31, 0xC0, 0x34, 0xC0,
+    0x00, 0x31, 0x96, 0xED, 0xA2, 0x77, 0x00, 0x34, 0x56, 0x36, 0x02, 0x3A, 0x3D, 0xC2, 0x02, 0x3D,
+    0xC7, 0x59, 0x36, 0x3D, 0xC0, 0x00, 0x31, 0x42, 0x95, 0xAD, 0xFE, 0xDD, 0xF7, 0xFE, 0xEF, 0xBE,
+    0xA2, 0x46, 0x22, 0xC2, 0x1F, 0xC0, 0x5A, 0xC0, 0x17, 0xC1, 0x5A, 0x0F, 0x55, 0x56, 0xC0, 0x5A,
+    0xC0, 0x56, 0x65, 0x5A, 0x66, 0x5A, 0xC0, 0x1E, 0xC0, 0x6E, 0xA5, 0x75, 0xC2, 0x13, 0xC0, 0x66,
+    0x00, 0x9F, 0xD8, 0xFE, 0xB5, 0x13, 0xFE, 0xB3, 0x8C, 0xA9, 0x73, 0x32, 0xC0, 0x36, 0xC0, 0x05,
+    0x3E, 0x49, 0x6B, 0x02, 0x3A, 0x76, 0xC0, 0x7E, 0x02, 0x9D, 0x9A, 0x9C, 0x79, 0xFE, 0x30, 0xE0,
+    0xA3, 0x35, 0xFE, 0x8D, 0x09, 0xAE, 0x00, 0x9B, 0xCA, 0xFE, 0x7C, 0x25, 0x96, 0xFE, 0xA6, 0x77,
+    0xA9, 0x55, 0xA4, 0x87, 0x9F, 0xBB, 0x9C, 0xBB, 0x9D, 0xBA, 0x6B, 0x7F, 0x38, 0x3D, 0xC0, 0x36,
+    0xC1, 0x00, 0x05, 0x02, 0x33, 0x36, 0x02, 0x6B, 0x3D, 0xC0, 0x04, 0x09, 0x02, 0xC0, 0x3B, 0xC0,
+    0x36, 0x3B, 0xC3, 0x36, 0x3B, 0x36, 0xC0, 0x3B, 0xC0, 0x36, 0xC3, 0x3D, 0xC0, 0x36, 0xC7, 0x3D,
+    0xC2, 0x36, 0xC0, 0x3D, 0xCE, 0x65, 0xC1, 0x00, 0x36, 0x39, 0x9A, 0xBC, 0x99, 0xBB, 0xA8, 0x54,
+    0xA4, 0x67, 0x34, 0xC0, 0x3D, 0xC4, 0x02, 0x3D, 0xC7, 0x36, 0xC0, 0x3D, 0xC0, 0x00, 0x31, 0x42,
+    0x95, 0xBE, 0xFE, 0xC5, 0x54, 0xFE, 0xEF, 0x9D, 0xA2, 0x37, 0x1C, 0xC1, 0x66, 0xC0, 0x59, 0xC0,
+    0x14, 0x56, 0xC2, 0x56, 0x55, 0x55, 0x66, 0x5A, 0x23, 0x1E, 0x5A, 0xC0, 0x56, 0xC2, 0x6E, 0xC0,
+    0xA6, 0x83, 0xC0, 0x67, 0x69, 0xC0, 0x66, 0xC0, 0x76, 0x9F, 0xD8, 0xFE, 0xBD, 0x34, 0xFE, 0xAB,
+    0x2B, 0x27, 0xA0, 0xA8, 0x6F, 0xC0, 0x31, 0x33, 0xA2, 0x76, 0x56, 0x33, 0x6B, 0x7F, 0x76, 0x55,
+    0xC0, 0x9B, 0xAA, 0x9C, 0x79, 0xA4, 0x35, 0xFE, 0x29, 0x00, 0xFE, 0x4A, 0xE4, 0xA3, 0x54, 0xFE,
+    0x85, 0x69, 0xAC, 0x31, 0x61, 0x97, 0xED, 0xFE, 0x73, 0xA2, 0x98, 0xEE, 0xA6, 0x76, 0xA8, 0x66,
+    0xA4, 0x88, 0xA0, 0x9A, 0x9D, 0xBB, 0x2E, 0x6B, 0x65, 0xA2, 0x76, 0x02, 0x36, 0xC1, 0x31, 0xC0,
+    0x3D, 0x5A, 0xC2, 0x3D, 0x02, 0xC1, 0x36, 0xC3, 0x6E, 0xC1, 0x38, 0x3B, 0x38, 0x3B, 0xC3, 0x36,
+    0xC2, 0x3D, 0xC0, 0x36, 0xC1, 0x3B, 0x36, 0x3B, 0xC0, 0x36, 0xC0, 0x3D, 0xC2, 0x36, 0xC2, 0x3D,
+    0xCD, 0x36, 0x31, 0xA2, 0x77, 0x36, 0xC0, 0x2C, 0x95, 0xDD, 0x10, 0xA9, 0x44, 0x7F, 0x5A, 0x6E,
+    0x3D, 0xC0, 0x36, 0x3D, 0xC4, 0x36, 0x3D, 0xC7, 0x00, 0x31, 0x30, 0x95, 0xBD, 0xFE, 0xBC, 0xD3,
+    0xFE, 0xE7, 0x5C, 0xA3, 0x17, 0x5E, 0xC0, 0x66, 0xC0, 0x5A, 0x56, 0xC0, 0x04, 0x5A, 0x69, 0x66,
+    0xC0, 0x5A, 0x56, 0x66, 0x1B, 0xC0, 0x6B, 0x18, 0xC0, 0x56, 0xC5, 0x0A, 0xC0, 0x0D, 0xC0, 0x0A,
+    0xC0, 0x05, 0x71, 0x9F, 0xD9, 0xFE, 0xC5, 0x95, 0xFE, 0x9B, 0x0B, 0xA9, 0x73, 0x34, 0xC0, 0x6E,
+    0x2E, 0x6D, 0xA2, 0x77, 0x38, 0x51, 0x2E, 0x02, 0xC0, 0x29, 0x98, 0xBC, 0x45, 0xAC, 0x02, 0x94,
+    0xBC, 0x98, 0x89, 0xFE, 0xBE, 0x71, 0x94, 0xDE, 0xFE, 0x32, 0xA1, 0xFE, 0x74, 0xA8, 0xAE, 0x20,
+    0xA5, 0x64, 0x9A, 0xCB, 0x97, 0xEC, 0x93, 0xFF, 0x9A, 0xDD, 0xA5, 0x78, 0xA9, 0x66, 0xA3, 0x89,
+    0xA1, 0x99, 0x51, 0x38, 0x33, 0x65, 0xC0, 0x7F, 0xC0, 0x6F, 0x31, 0x6F, 0x2E, 0x6F, 0x02, 0x3A,
+    0x3D, 0xC1, 0x36, 0xC3, 0x02, 0x69, 0xC1, 0x38, 0xC1, 0x3B, 0x38, 0x3B, 0xC0, 0x36, 0xC1, 0x3D,
+    0xC2, 0x36, 0xC0, 0x3B, 0xC0, 0x36, 0xC5, 0x3D, 0xC0, 0x36, 0xC2, 0x3D, 0xCA, 0x36, 0x02, 0xC0,
+    0x36, 0x3D, 0x02, 0x36, 0x02, 0x31, 0x99, 0xCC, 0x9A, 0xBB, 0xA8, 0x54, 0xA5, 0x66, 0x5A, 0x69,
+    0x6F, 0x3D, 0x36, 0xC0, 0x3D, 0xC0, 0x3A, 0x3D, 0xC0, 0x2E, 0x36, 0x3D, 0x02, 0x3D, 0xC2, 0x36,
+    0x31, 0x36, 0x3B, 0x5A, 0x94, 0xCE, 0xFE, 0xB4, 0x72, 0xFE, 0xDF, 0x3C, 0xA3, 0x16, 0x4F, 0xC0,
+    0x66, 0xC0, 0x66, 0x35, 0x5A, 0xC0, 0x5A, 0xC0, 0x2A, 0xC0, 0x55, 0xC0, 0x18, 0x6B, 0xC0, 0x5A,
+    0x65, 0x5A, 0xC6, 0x0A, 0xC5, 0x08, 0x9E, 0xD9, 0xFE, 0xD6, 0x79, 0xFE, 0x9B, 0x2C, 0xA5, 0x95,
+    0xA5, 0x86, 0x34, 0x39, 0x59, 0xC0, 0x6E, 0x2C, 0x2E, 0xA3, 0x67, 0x65, 0x9B, 0x9A, 0x9A, 0xAB,
+    0x6E, 0xFE, 0xDD, 0x33, 0xA4, 0x45, 0xFE, 0x41, 0xA2, 0xFE, 0x6B, 0xC7, 0xFE, 0xC6, 0xD3, 0xFE,
+    0x84, 0xAD, 0xFE, 0x42, 0xC7, 0x9D, 0xA9, 0xA5, 0x64, 0xFE, 0x95, 0x0A, 0xAC, 0x20, 0xA3, 0x64,
+    0x9D, 0xA8, 0x97, 0xDD, 0xFE, 0x84, 0x03, 0xFE, 0x62, 0x80, 0xA2, 0x89, 0xAA, 0x56, 0xA6, 0x76,
+    0xA3, 0x78, 0x66, 0x61, 0x9C, 0xBB, 0x7F, 0x02, 0xC0, 0x36, 0x6E, 0xC0, 0x33, 0x3B, 0x33, 0xC0,
+    0x7B, 0xC3, 0x31, 0x36, 0xC3, 0x33, 0xC0, 0x3B, 0x02, 0x3B, 0xC0, 0x33, 0x36, 0x02, 0x3D, 0xC0,
+    0x02, 0xC0, 0x36, 0xC1, 0x3B, 0x36, 0x33, 0x36, 0x33, 0x36, 0x3B, 0x36, 0x33, 0x3D, 0xC0, 0x36,
+    0xC1, 0x02, 0x3D, 0x36, 0x3D, 0xC0, 0x02, 0x3D, 0xC4, 0x36, 0x5E, 0x3B, 0xC0, 0x6F, 0x02, 0x36,
+    0x02, 0x33, 0x31, 0x55, 0x99, 0xDC, 0x9D, 0xAA, 0xA8, 0x44, 0xA4, 0x66, 0x55, 0xC0, 0x36, 0xC0,
+    0x3D, 0x02, 0x3D, 0x55, 0x3D, 0x2E, 0xC0, 0x29, 0x31, 0x02, 0x3D, 0x36, 0x3D, 0xC0, 0x31, 0xC0,
+    0x7F, 0x66, 0xC0, 0x94, 0xBF, 0xFE, 0xAC, 0x51, 0xFE, 0xD6, 0xFB, 0xA3, 0x17, 0xA2, 0x46, 0x6B,
+    0x5A, 0x32, 0x26, 0x5A, 0x6F, 0x56, 0xC0, 0x66, 0x18, 0x66, 0xC0, 0x18, 0x5A, 0x10, 0x0D, 0x66,
+    0xC0, 0x5A, 0xC6, 0x14, 0x69, 0x66, 0x0D, 0x08, 0x5E, 0xC0, 0x0D, 0x9E, 0xCA, 0x9C, 0xFA, 0xFE,
+    0x9B, 0x8E, 0x9F, 0xD9, 0x3D, 0x31, 0xA2, 0x76, 0xC0, 0x69, 0x6F, 0x56, 0x56, 0x41, 0x9A, 0xAB,
+    0x9E, 0x79, 0xA8, 0x33, 0xFE, 0xE6, 0x16, 0xA9, 0x24, 0xFE, 0xA4, 0xD0, 0xFE, 0x21, 0x40, 0xFE,
+    0xA5, 0xCF, 0x7F, 0xFE, 0x53, 0x0A, 0xA8, 0x68, 0x66, 0x95, 0xDB, 0x9A, 0xA7, 0xFE, 0x6B, 0xA6,
+    0xFE, 0xAD, 0xEC, 0xA5, 0x63, 0x6E, 0xC0, 0x98, 0xDE, 0xFE, 0x84, 0x05, 0x95, 0xFF, 0x9D, 0xBB,
+    0xA8, 0x56, 0xA8, 0x55, 0xA7, 0x65, 0x1F, 0x9C, 0xCB, 0xC0, 0x61, 0x2B, 0x33, 0x38, 0x3B, 0x55,
+    0x3B, 0x33, 0x36, 0x3D, 0xC0, 0x56, 0x7A, 0x3D, 0xC0, 0x36, 0xC0, 0x3D, 0x36, 0x33, 0xC0, 0x3B,
+    0xC0, 0x02, 0xCB, 0x3B, 0x36, 0xC5, 0x3D, 0xC0, 0x02, 0xC0, 0x36, 0xC1, 0x3D, 0xC5, 0x31, 0xC0,
+    0x3D, 0xC0, 0x33, 0xA2, 0x76, 0x3B, 0x51, 0xC0, 0x33, 0x02, 0x36, 0x56, 0x36, 0x9C, 0xBA, 0x99,
+    0xBC, 0xA3, 0x76, 0x34, 0x7E, 0x34, 0x59, 0x36, 0x02, 0x36, 0x3D, 0xC0, 0x02, 0x9D, 0xAA, 0x69,
+    0x36, 0x02, 0x36, 0x29, 0x2E, 0x3D, 0xC1, 0x36, 0x7B, 0x34, 0x6B, 0x95, 0xAE, 0xFE, 0xA4, 0x10,
+    0xFE, 0xCE, 0xDB, 0xA3, 0x16, 0xA2, 0x47, 0x2F, 0x66, 0x23, 0x56, 0xC0, 0x6E, 0x18, 0x6B, 0x5A,
+    0xC0, 0x10, 0x15, 0xC0, 0x56, 0xC0, 0x66, 0x5A, 0x65, 0xC0, 0x5B, 0xC0, 0x6E, 0xC3, 0xA6, 0xD4,
+    0x69, 0x0F, 0x08, 0xC0, 0x5A, 0x0A, 0x7B, 0x71, 0x9F, 0xD9, 0xFE, 0xBD, 0x14, 0xFE, 0x8A, 0x8A,
+    0xAB, 0x63, 0xA6, 0x64, 0x65, 0x69, 0x69, 0x5A, 0x9C, 0xAC, 0x9A, 0x9B, 0x9D, 0x89, 0xA7, 0x24,
+    0xAB, 0x12, 0xFE, 0xEE, 0xF9, 0xA4, 0x46, 0x41, 0xFE, 0x5B, 0x49, 0x9C, 0x99, 0xFE, 0xC6, 0xD3,
+    0xFE, 0x7C, 0x6C, 0xFE, 0x6B, 0x2F, 0xA3, 0x8B, 0xA1, 0x89, 0x7D, 0x99, 0xB8, 0x97, 0xB9, 0xA3,
+    0x52, 0xFE, 0x73, 0xC8, 0xFE, 0xAD, 0xCD, 0xA6, 0x43, 0xA2, 0x75, 0x6E, 0x96, 0xED, 0xFE, 0x84,
+    0x23, 0x98, 0xDE, 0x9A, 0xCD, 0xA5, 0x77, 0xA6, 0x77, 0xA7, 0x67, 0xA4, 0x77, 0x76, 0x51, 0x65,
+    0xC0, 0x76, 0x27, 0xC0, 0x3B, 0xC0, 0x67, 0xC6, 0x69, 0xC1, 0x6F, 0x3B, 0x02, 0xCC, 0x3D, 0x36,
+    0x3D, 0xC0, 0x36, 0xC0, 0x3D, 0xC2, 0x36, 0x3D, 0x02, 0x3D, 0x36, 0xC1, 0x66, 0x36, 0xC0, 0x3D,
+    0xC3, 0x36, 0x02, 0x36, 0x2E, 0x36, 0xC2, 0x2E, 0x3B, 0xA2, 0x67, 0xA2, 0x77, 0x96, 0xED, 0x9A,
+    0xBB, 0x3F, 0xA4, 0x76, 0x3E, 0x36, 0xC1, 0x31, 0x36, 0x3D, 0x36, 0x9B, 0xAB, 0x9C, 0xBA, 0x1A,
+    0x36, 0xC0, 0x31, 0x3D, 0xC2, 0x36, 0xC0, 0x31, 0x67, 0x96, 0xBD, 0xFE, 0x9B, 0xF0, 0xFE, 0xC6,
+    0xBA, 0xA3, 0x17, 0x23, 0x5A, 0x66, 0x5A, 0xC0, 0x66, 0x5E, 0x10, 0x5A, 0xC5, 0x5A, 0x66, 0x56,
+    0x69, 0x66, 0x36, 0xC2, 0x5A, 0x36, 0x33, 0xA7, 0xD4, 0xC1, 0x08, 0xC0, 0x5A, 0x6E, 0xC0, 0x9F,
+    0xBA, 0x9D, 0xD9, 0x9D, 0xDA, 0xFE, 0xA3, 0xCF, 0x9B, 0xEB, 0xA5, 0x75, 0xA3, 0x76, 0x54, 0x9D,
+    0xA9, 0x9C, 0x9A, 0x42, 0xA6, 0x35, 0xAB, 0x13, 0xFE, 0xEE, 0xD9, 0xA4, 0x46, 0x5E, 0x4A, 0x9C,
+    0xA9, 0xFE, 0x22, 0x03, 0xFE, 0x64, 0x0A, 0xFE, 0xBE, 0xB3, 0xFE, 0x63, 0x8A, 0xFE, 0x83, 0x93,
+    0x9E, 0xBF, 0x77, 0xA2, 0x67, 0x6C, 0xA0, 0x74, 0x9B, 0xA8, 0x97, 0xB8, 0xA3, 0x53, 0xFE, 0x74,
+    0x08, 0xFE, 0xAE, 0x0C, 0xA7, 0x43, 0x68, 0x9C, 0xAA, 0x62, 0x9B, 0xCC, 0xFE, 0x84, 0x05, 0x95,
+    0xFF, 0x73, 0xA5, 0x77, 0xA8, 0x44, 0xA5, 0x77, 0xA4, 0x77, 0x7A, 0x9D, 0xAA, 0x9D, 0xAA, 0x7E,
+    0x2C, 0x27, 0xC0, 0x2E, 0x66, 0x6B, 0xA2, 0x76, 0xC0, 0x6E, 0xC3, 0x65, 0x5A, 0x02, 0x36, 0xC5,
+    0x3D, 0xC3, 0x36, 0xC4, 0x3D, 0xC3, 0x36, 0xC4, 0x3D, 0xC1, 0x36, 0x66, 0x36, 0xC1, 0x02, 0x36,
+    0x6E, 0xC2, 0x33, 0x6E, 0x0C, 0xA2, 0x66, 0x6F, 0x9D, 0x99, 0x55, 0x96, 0xED, 0x9A, 0xBB, 0xA5,
+    0x65, 0xA6, 0x66, 0x34, 0x3B, 0x36, 0xC2, 0x3D, 0x31, 0x9C, 0x9A, 0x97, 0xDD, 0xA7, 0x54, 0xA6,
+    0x55, 0xC1, 0x3D, 0xC0, 0x66, 0x3D, 0x36, 0x31, 0xC0, 0x67, 0x97, 0xAD, 0xFE, 0x93, 0xCF, 0xFE,
+    0xBE, 0x9A, 0xA4, 0x06, 0x20, 0x56, 0x5A, 0x66, 0xC2, 0x0D, 0xC2, 0x56, 0x6E, 0xC0, 0x05, 0xC0,
+    0x5A, 0x65, 0x5A, 0x66, 0xC0, 0x33, 0xC4, 0xA7, 0xC3, 0xC0, 0x6B, 0xC0, 0x05, 0xC0, 0x5A, 0xC0,
+    0x76, 0x9E, 0xC9, 0xA0, 0xB9, 0xFE, 0xD6, 0x39, 0xFE, 0xA3, 0xD0, 0x9A, 0xDA, 0x65, 0xC0, 0xA2,
+    0x76, 0xA7, 0x34, 0xA8, 0x25, 0xAB, 0x12, 0xA8, 0x24, 0x4A, 0x49, 0x4A, 0x6B, 0x94, 0xED, 0xFE,
+    0x11, 0xC2, 0xFE, 0x8D, 0x4F, 0xA6, 0x65, 0xFE, 0x6B, 0x4C, 0xFE, 0x93, 0x96, 0x9D, 0xBE, 0x67,
+    0x6B, 0x22, 0x6D, 0xA3, 0x65, 0x0B, 0x98, 0xB8, 0x9B, 0xA7, 0xA5, 0x32, 0xFE, 0x73, 0xE7, 0xFE,
+    0xA5, 0xAB, 0xA5, 0x54, 0x6D, 0xA3, 0x76, 0x65, 0x9B, 0xBB, 0x98, 0xDE, 0x95, 0xFE, 0x97, 0xDF,
+    0x77, 0xA7, 0x66, 0xA8, 0x56, 0xA3, 0x88, 0xA4, 0x66, 0x7A, 0x61, 0x62, 0x65, 0x6B, 0x66, 0x77,
+    0x6E, 0x5A, 0x59, 0x65, 0x33, 0x6E, 0x33, 0xC0, 0x7E, 0xC0, 0x66, 0xC0, 0x3B, 0x6B, 0xC0, 0x36,
+    0xC0, 0x3D, 0xC4, 0x7A, 0xC0, 0x56, 0xC1, 0x3D, 0xC2, 0x38, 0x3D, 0x36, 0xC0, 0x00, 0x3D, 0x36,
+    0x66, 0x36, 0xC0, 0x3D, 0x02, 0xC0, 0x36, 0x33, 0x3B, 0x33, 0x3B, 0xC0, 0x5E, 0xC0, 0x07, 0x18,
+    0x50, 0x9D, 0x89, 0x99, 0xBB, 0x98, 0xBB, 0x9B, 0xAB, 0xA3, 0x76, 0xA8, 0x54, 0x66, 0xA3, 0x97,
+    0xA8, 0x55, 0x77, 0x62, 0x36, 0xC1, 0x66, 0x6F, 0x29, 0x9B, 0xBA, 0xA5, 0x55, 0xA3, 0x77, 0xC0,
+    0x00, 0xC0, 0x3D, 0xC1, 0x36, 0x31, 0xC0, 0x38, 0x98, 0x9C, 0xA4, 0x06, 0xFE, 0xB6, 0x9A, 0xA4,
+    0x06, 0x4F, 0x5A, 0x66, 0x0D, 0xC1, 0x66, 0x5A, 0xC5, 0x5A, 0x66, 0x69, 0x5A, 0x66, 0x59, 0xC0,
+    0x2E, 0xC4, 0xA7, 0xB3, 0xC0, 0x5A, 0xC0, 0x7E, 0xC0, 0x5A, 0x3A, 0x76, 0xA0, 0xA8, 0x75, 0xA2,
+    0xA7, 0x98, 0xFD, 0x97, 0xFC, 0x9C, 0xB9, 0xA2, 0x67, 0xA6, 0x44, 0xA5, 0x46, 0xA4, 0x46, 0xA2,
+    0x67, 0x5F, 0x49, 0xA3, 0x56, 0x41, 0xA0, 0xA9, 0xFE, 0x64, 0x8F, 0x1A, 0xFE, 0x9D, 0xD1, 0x9A,
+    0xDC, 0xFE, 0x6B, 0x0D, 0xA3, 0xAE, 0x9D, 0xCF, 0x6F, 0xC1, 0x69, 0x50, 0x58, 0xA5, 0x43, 0xA0,
+    0x75, 0x9C, 0x97, 0x9B, 0x96, 0x9F, 0x76, 0xA5, 0x53, 0xAA, 0x20, 0xA9, 0x32, 0xA7, 0x53, 0xA6,
+    0x44, 0x7A, 0x9D, 0xAA, 0x9B, 0xBC, 0x96, 0xEE, 0x97, 0xEE, 0x99, 0xCD, 0x9C, 0xBB, 0x7B, 0xA6,
+    0x66, 0xA6, 0x55, 0xA6, 0x75, 0xA4, 0x67, 0xA1, 0x98, 0xA1, 0x89, 0x7A, 0x56, 0x9D, 0xAA, 0x5A,
+    0x65, 0x65, 0xC0, 0x35, 0x7A, 0x65, 0x3B, 0x56, 0xC5, 0x7A, 0xC0, 0x31, 0xC3, 0x36, 0x31, 0x36,
+    0x31, 0x5A, 0x31, 0xC5, 0x36, 0xC0, 0x31, 0x2E, 0x33, 0xC3, 0x38, 0x04, 0x7E, 0x5A, 0xA2, 0x76,
+    0x56, 0x6D, 0x40, 0x99, 0xBB, 0x99, 0xAB, 0x9A, 0xAA, 0x40, 0xA4, 0x55, 0xAA, 0x13, 0xA9, 0x33,
+    0xA7, 0x65, 0xA2, 0x87, 0xFE, 0x93, 0x86, 0x9B, 0xDB, 0xA9, 0x65, 0xA5, 0x78, 0x77, 0x36, 0xC0,
+    0x66, 0xC0, 0x6F, 0x31, 0x66, 0x36, 0x7B, 0x36, 0x31, 0x6B, 0xC0, 0x3D, 0xC0, 0x36, 0x31, 0xC0,
+    0x38, 0x99, 0x8C, 0xA4, 0x06, 0xFE, 0xB6, 0x99, 0xA4, 0x06, 0xA1, 0x48, 0x57, 0xC0, 0x5A, 0xC0,
+    0x66, 0xC4, 0x5A, 0xC1, 0x66, 0x59, 0xC0, 0x66, 0x5A, 0x65, 0x24, 0xC0, 0x1F, 0x24, 0x1F, 0xC1,
+    0xA7, 0xB3, 0x5F, 0xC1, 0x7A, 0xC1, 0x66, 0x3A, 0x61, 0x7E, 0xA0, 0xA8, 0xA0, 0xB9, 0x71, 0x7E,
+    0x69, 0x5E, 0x46, 0x5A, 0x5E, 0x46, 0xA2, 0x67, 0xA3, 0x66, 0x36, 0x71, 0xFE, 0x43, 0x4B, 0x97,
+    0xD9, 0xFE, 0xB6, 0x12, 0xFE, 0x8C, 0x6E, 0xFE, 0x6A, 0xED, 0xA2, 0xBF, 0x9E, 0xBD, 0x6E, 0xA2,
+    0x77, 0x52, 0x6B, 0x27, 0x55, 0xA2, 0x65, 0xA2, 0x75, 0xA3, 0x54, 0x58, 0x9D, 0x97, 0x99, 0xA9,
+    0x9D, 0x87, 0x9F, 0x86, 0xA7, 0x42, 0xA9, 0x32, 0xA9, 0x32, 0xA6, 0x54, 0xA5, 0x55, 0xA3, 0x76,
+    0x51, 0x9A, 0xCB, 0x96, 0xED, 0x98, 0xCD, 0x9A, 0xBC, 0x9B, 0xCC, 0x67, 0xA3, 0x87, 0xA3, 0x77,
+    0xA4, 0x77, 0xA5, 0x66, 0xA2, 0x98, 0xA2, 0x78, 0xA2, 0x88, 0xA2, 0x76, 0x66, 0x13, 0x1D, 0x16,
+    0x51, 0x66, 0x66, 0xC5, 0x66, 0xC2, 0x66, 0x33, 0x6B, 0xC4, 0x33, 0xC0, 0x7B, 0x6E, 0xC0, 0x5A,
+    0x33, 0x38, 0xC0, 0x3F, 0x6E, 0x7E, 0x5A, 0xC0, 0x0E, 0xC0, 0x13, 0x56, 0x51, 0x50, 0x9A, 0xAB,
+    0x9B, 0xA9, 0x9C, 0x99, 0x9E, 0x78, 0x55, 0xA5, 0x34, 0xAA, 0x32, 0xAC, 0x01, 0xA7, 0x33, 0xA3,
+    0x66, 0x9B, 0xAB, 0x95, 0xFD, 0x96, 0xFE, 0x97, 0xFF, 0xA4, 0x96, 0xA3, 0xA9, 0xA8, 0x67, 0xA2,
+    0x99, 0xC0, 0x5A, 0x62, 0x6E, 0x31, 0xC0, 0x36, 0x31, 0xC0, 0x36, 0x67, 0xC0, 0x6E, 0xC0, 0x02,
+    0x33, 0x36, 0x31, 0x38, 0x99, 0x8B, 0xFE, 0x94, 0x10, 0xFE, 0xAE, 0x79, 0xA3, 0x17, 0xA2, 0x37,
+    0x08, 0x5A, 0x5A, 0xC0, 0x05, 0x66, 0x05, 0x56, 0xC3, 0x02, 0x56, 0x65, 0xC0, 0x5A, 0x69, 0x5A,
+    0xC3, 0x24, 0xC1, 0xA6, 0xB4, 0x6F, 0x5A, 0xC0, 0x76, 0xC3, 0x2B, 0xC0, 0x66, 0xA0, 0xB8, 0x7A,
+    0x75, 0x5A, 0x55, 0xA2, 0x57, 0xA2, 0x67, 0x6F, 0x42, 0xA2, 0x76, 0xC0, 0x36, 0x9C, 0xCB, 0xFE,
+    0x22, 0x47, 0xA2, 0x83, 0xFE, 0xBE, 0x73, 0xFE, 0x7B, 0xED, 0xFE, 0x73, 0x0E, 0xA2, 0xAF, 0x9E,
+    0xBC, 0x7E, 0x20, 0x6B, 0x6B, 0x66, 0x2E, 0x27, 0x55, 0xA2, 0x65, 0x19, 0xA3, 0x65, 0x5D, 0xA0,
+    0x75, 0x9C, 0x98, 0x9D, 0x97, 0x9A, 0xA8, 0x9E, 0x87, 0xA6, 0x42, 0xA3, 0x76, 0xA9, 0x32, 0xAA,
+    0x21, 0xA7, 0x54, 0xA6, 0x54, 0x6B, 0x62, 0x9A, 0xBC, 0x9B, 0xBB, 0x99, 0xDC, 0x96, 0xDE, 0x99,
+    0xDC, 0x61, 0x62, 0xA0, 0x9A, 0xA2, 0x88, 0xA4, 0x66, 0xA6, 0x55, 0xA4, 0x76, 0xA3, 0x77, 0xA2,
+    0x77, 0xA2, 0x87, 0x7F, 0x6E, 0x7F, 0x6B, 0x7E, 0x66, 0x56, 0xC0, 0x66, 0xC0, 0x65, 0xC0, 0x6B,
+    0xC0, 0x18, 0x13, 0xC3, 0x18, 0xC1, 0x1D, 0xC0, 0x22, 0xC1, 0x55, 0x66, 0x55, 0x56, 0x51, 0x50,
+    0x9D, 0x99, 0x9C, 0x9A, 0x9C, 0xAA, 0x9D, 0x99, 0x9D, 0x99, 0x41, 0x64, 0xA6, 0x34, 0xAA, 0x22,
+    0xAA, 0x22, 0xA9, 0x22, 0xA5, 0x45, 0x55, 0x9F, 0x67, 0x95, 0xDD, 0x97, 0xCC, 0x9B, 0xBC, 0xA2,
+    0x76, 0xA5, 0x84, 0xA8, 0x65, 0xA2, 0xB9, 0xFE, 0xA3, 0x85, 0x9D, 0xDD, 0xA7, 0x67, 0x3B, 0x7B,
+    0x41, 0x7E, 0x31, 0x36, 0xC0, 0x31, 0xC0, 0x7F, 0x36, 0x67, 0x6E, 0xC0, 0x6E, 0x33, 0x36, 0x31,
+    0x36, 0x97, 0x9E, 0xFE, 0x94, 0x10, 0xFE, 0xA6, 0x59, 0xA3, 0x17, 0xA2, 0x47, 0x56, 0x5B, 0x6E,
+    0xC1, 0x3D, 0xC3, 0x5A, 0x3D, 0x3A, 0x69, 0x66, 0x5A, 0xC0, 0x69, 0x5A, 0xC5, 0x24, 0xA6, 0xA5,
+    0xC0, 0x34, 0x2F, 0xC0, 0x32, 0x2F, 0x69, 0xC1, 0x32, 0x51, 0x7F, 0x76, 0x7A, 0x54, 0x5E, 0x6F,
+    0xA2, 0x67, 0xC0, 0x34, 0x37, 0x32, 0x7A, 0x9A, 0xDB, 0xFE, 0x11, 0xE5, 0xA5, 0x72, 0xFE, 0xBE,
+    0x93, 0xFE, 0x7C, 0x0D, 0xFE, 0x6A, 0xEE, 0xA4, 0x9D, 0x9D, 0xBE, 0x27, 0x69, 0x27, 0xC0, 0x6B,
+    0x29, 0x69, 0xC0, 0x27, 0xA2, 0x66, 0x69, 0x5D, 0x7E, 0xA2, 0x64, 0x59, 0xA0, 0x75, 0x9F, 0x86,
+    0x9D, 0x97, 0x9C, 0x98, 0x9D, 0x87, 0x40, 0xA3, 0x65, 0xA9, 0x32, 0xA8, 0x43, 0xA5, 0x65, 0xA8,
+    0x44, 0xA4, 0x65, 0x7F, 0x66, 0x9D, 0xBA, 0x9D, 0x99, 0x9B, 0xBC, 0x98, 0xDD, 0x98, 0xEE, 0x9C,
+    0xAA, 0x9D, 0xAA, 0x9D, 0xAA, 0x9D, 0xAA, 0x66, 0x7F, 0xA4, 0x76, 0xA2, 0x87, 0xA4, 0x67, 0xA2,
+    0x77, 0xA2, 0x77, 0x7F, 0x7F, 0xC0, 0x6F, 0xA2, 0x77, 0x7F, 0x7E, 0x6B, 0x6E, 0x7A, 0x6F, 0x35,
+    0xC0, 0x32, 0x26, 0x6E, 0xC0, 0x56, 0x0F, 0x55, 0x51, 0x55, 0x9D, 0x99, 0x9D, 0xA9, 0x55, 0x9B,
+    0xAB, 0x9B, 0xBB, 0x45, 0xA2, 0x77, 0xA3, 0x65, 0xA3, 0x66, 0xA4, 0x56, 0xA6, 0x44, 0xA6, 0x55,
+    0xA7, 0x43, 0xA5, 0x55, 0xA6, 0x43, 0x5A, 0x9A, 0xAA, 0x9A, 0xAA, 0x98, 0xBD, 0x99, 0xBC, 0x9D,
+    0x9A, 0xA5, 0x53, 0xA7, 0x33, 0xA9, 0x32, 0xA7, 0x53, 0xA3, 0x87, 0xA0, 0xA9, 0x9C, 0xEC, 0xFE,
+    0xBD, 0x08, 0xFE, 0xA3, 0x24, 0xA0, 0xAB, 0xA8, 0x57, 0xA3, 0x78, 0x65, 0x66, 0x36, 0xC1, 0x31,
+    0xC0, 0x36, 0xC0, 0x6B, 0xC2, 0x02, 0x36, 0xC0, 0x5A, 0x98, 0x9C, 0xFE, 0x8C, 0x0F, 0xFE, 0xA6,
+    0x59, 0xA3, 0x17, 0xA1, 0x48, 0x5B, 0xC1, 0x6E, 0xC0, 0x3D, 0xC0, 0x5A, 0xC3, 0x69, 0x56, 0x69,
+    0x2B, 0x24, 0x56, 0xC1, 0x2B, 0x1C, 0x6E, 0xC2,
 };
+
 const image_t xPatrickImage =
 {
-    (rgb565_t *)pPixels,
+    pData,
+    sizeof(pData),
     180,
-    177
+    177,
+    IMAGE_ENCODING_QOI565
 };
-
@@ -23,6 +23,12 @@ void dbg_swo_config(uint32_t ulChannelMask, uint32_t ulFrequency)
     ITM->TPR = ulChannelMask;
     ITM->TER = ulChannelMask;
 }
+void dbg_cycle_counter_init()
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; // Must come after dbg_swo_config, it overwrites DWT->CTRL
+}
 void dbg_swo_putc(char c, uint8_t ubChannel)
 {
     dbg_swo_send_uint8((uint8_t)c, ubChannel);
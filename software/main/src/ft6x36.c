@@ -63,6 +63,16 @@ void ft6x36_tick()
 {
     while((FT6X36_TOUCH_FIFO_SIZE + ubTouchFIFOWr - ubTouchFIFORd) % FT6X36_TOUCH_FIFO_SIZE)
     {
+        uint8_t ubNext = (ubTouchFIFORd + 1) % FT6X36_TOUCH_FIFO_SIZE;
+
+        // Only the latest of consecutive moves matters
+        if(pxTouchFIFO[ubTouchFIFORd].ubEvent == FT6X06_REG_Pn_XH_EVENT_FLAG_CONTACT && ubNext != ubTouchFIFOWr && pxTouchFIFO[ubNext].ubEvent == FT6X06_REG_Pn_XH_EVENT_FLAG_CONTACT)
+        {
+            ubTouchFIFORd = ubNext;
+
+            continue;
+        }
+
         if(pfEventCallback)
             pfEventCallback(pxTouchFIFO[ubTouchFIFORd].ubEvent, pxTouchFIFO[ubTouchFIFORd].usX, pxTouchFIFO[ubTouchFIFORd].usY);
 
@@ -4,8 +4,114 @@ uint8_t g_ubILI9488Rotation;
 static uint16_t usMaxWidth;
 static uint16_t usMaxHeigth;
 
+static ldma_descriptor_t __attribute__ ((aligned (4))) pDMADescriptor[2];
+static uint8_t pubFillPattern[ILI9488_FILL_PATTERN_PIXELS * ILI9488_PIXEL_SIZE];
+static rgb565_t xFillPatternColor;
+static uint8_t ubFillPatternValid = 0;
+static const uint8_t * volatile pubDMASrc = NULL;
+static volatile uint32_t ulDMABytesLeft = 0;
+static volatile uint8_t ubDMABusy = 0;
+static volatile uint8_t ubDMAFill = 0;
+static ili9488_dma_callback_fn_t pfDMACallback = NULL;
+static ili9488_stats_t xStats;
+
+static void ili9488_dma_load_next()
+{
+    if(ubDMAFill)
+    {
+        // The pattern descriptor links to itself while LOOPCNT is not zero, every reload starts over from the pattern start
+        // When the loop count runs out the next sequential descriptor sends the tail and raises the done flag
+        uint32_t ulLoops = (ulDMABytesLeft - 1) / sizeof(pubFillPattern);
+
+        if(ulLoops > ILI9488_DMA_MAX_LOOPS)
+            ulLoops = ILI9488_DMA_MAX_LOOPS;
+
+        uint32_t ulTail = ulDMABytesLeft - ulLoops * sizeof(pubFillPattern);
+
+        if(ulTail > sizeof(pubFillPattern))
+            ulTail = sizeof(pubFillPattern);
+
+        pDMADescriptor[0].CTRL = LDMA_CH_CTRL_DSTMODE_ABSOLUTE | LDMA_CH_CTRL_SRCMODE_ABSOLUTE | LDMA_CH_CTRL_DSTINC_NONE | LDMA_CH_CTRL_SIZE_BYTE | LDMA_CH_CTRL_SRCINC_ONE | LDMA_CH_CTRL_REQMODE_BLOCK | LDMA_CH_CTRL_DECLOOPCNT | LDMA_CH_CTRL_BLOCKSIZE_UNIT1 | (((sizeof(pubFillPattern) - 1) << _LDMA_CH_CTRL_XFERCNT_SHIFT) & _LDMA_CH_CTRL_XFERCNT_MASK) | LDMA_CH_CTRL_STRUCTTYPE_TRANSFER;
+        pDMADescriptor[0].SRC = pubFillPattern;
+        pDMADescriptor[0].DST = &(USART1->TXDATA);
+        pDMADescriptor[0].LINK = 0x00000000 | LDMA_CH_LINK_LINK | LDMA_CH_LINK_LINKMODE_RELATIVE;
+
+        pDMADescriptor[1].CTRL = LDMA_CH_CTRL_DSTMODE_ABSOLUTE | LDMA_CH_CTRL_SRCMODE_ABSOLUTE | LDMA_CH_CTRL_DSTINC_NONE | LDMA_CH_CTRL_SIZE_BYTE | LDMA_CH_CTRL_SRCINC_ONE | LDMA_CH_CTRL_REQMODE_BLOCK | LDMA_CH_CTRL_DONEIFSEN | LDMA_CH_CTRL_BLOCKSIZE_UNIT1 | (((ulTail - 1) << _LDMA_CH_CTRL_XFERCNT_SHIFT) & _LDMA_CH_CTRL_XFERCNT_MASK) | LDMA_CH_CTRL_STRUCTTYPE_TRANSFER;
+        pDMADescriptor[1].SRC = pubFillPattern;
+        pDMADescriptor[1].DST = &(USART1->TXDATA);
+        pDMADescriptor[1].LINK = 0x00000000;
+
+        ulDMABytesLeft -= ulLoops * sizeof(pubFillPattern) + ulTail;
+
+        if(ulLoops)
+        {
+            ldma_ch_set_loop_count(ILI9488_DMA_CHANNEL, ulLoops - 1); // Descriptor runs LOOPCNT + 1 times
+            ldma_ch_load(ILI9488_DMA_CHANNEL, &pDMADescriptor[0]);
+        }
+        else
+        {
+            ldma_ch_load(ILI9488_DMA_CHANNEL, &pDMADescriptor[1]);
+        }
+
+        return;
+    }
+
+    uint32_t ulSize = ulDMABytesLeft > ILI9488_DMA_MAX_XFER_SIZE ? ILI9488_DMA_MAX_XFER_SIZE : ulDMABytesLeft;
+
+    pDMADescriptor[0].CTRL = LDMA_CH_CTRL_DSTMODE_ABSOLUTE | LDMA_CH_CTRL_SRCMODE_ABSOLUTE | LDMA_CH_CTRL_DSTINC_NONE | LDMA_CH_CTRL_SIZE_BYTE | LDMA_CH_CTRL_SRCINC_ONE | LDMA_CH_CTRL_REQMODE_BLOCK | LDMA_CH_CTRL_DONEIFSEN | LDMA_CH_CTRL_BLOCKSIZE_UNIT1 | (((ulSize - 1) << _LDMA_CH_CTRL_XFERCNT_SHIFT) & _LDMA_CH_CTRL_XFERCNT_MASK) | LDMA_CH_CTRL_STRUCTTYPE_TRANSFER;
+    pDMADescriptor[0].SRC = (void *)pubDMASrc;
+    pDMADescriptor[0].DST = &(USART1->TXDATA);
+    pDMADescriptor[0].LINK = 0x00000000;
+
+    pubDMASrc += ulSize;
+    ulDMABytesLeft -= ulSize;
+
+    ldma_ch_load(ILI9488_DMA_CHANNEL, pDMADescriptor);
+}
+static void ili9488_dma_isr(uint8_t ubError)
+{
+    if(!ubError && ulDMABytesLeft)
+    {
+        ili9488_dma_load_next(); // Chunk done, LDMA can only move 2048 units per descriptor
+
+        return;
+    }
+
+    ulDMABytesLeft = 0;
+
+    while(!(USART1->STATUS & USART_STATUS_TXC)); // Last byte is still in the shift register, at most 2 byte times
+
+    ILI9488_UNSELECT();
+
+    ubDMABusy = 0;
+
+    if(pfDMACallback)
+        pfDMACallback();
+}
+
+static void ili9488_dma_start(uint32_t ulCount, ili9488_dma_callback_fn_t pfCallback)
+{
+    xStats.ulBytesSent += ulCount * ILI9488_PIXEL_SIZE;
+    xStats.ulPixels += ulCount;
+    xStats.ulDMATransfers++;
+
+    ulDMABytesLeft = ulCount * ILI9488_PIXEL_SIZE;
+    pfDMACallback = pfCallback;
+    ubDMABusy = 1;
+
+    ILI9488_SELECT();
+    ILI9488_SETUP_DAT();
+
+    ili9488_dma_load_next();
+}
+
 static void ili9488_send_cmd(uint8_t ubCmd, uint8_t *pubParam, uint8_t ubCount)
 {
+    ili9488_dma_wait();
+
+    xStats.ulBytesSent += 1 + (pubParam ? ubCount : 0);
+    xStats.ulCommands++;
+
     ILI9488_SELECT();
     ILI9488_SETUP_CMD();
 
@@ -22,6 +128,8 @@ static void ili9488_send_cmd(uint8_t ubCmd, uint8_t *pubParam, uint8_t ubCount)
 }
 static void ili9488_read_data(uint8_t ubCmd, uint8_t *pubData, uint8_t ubCount)
 {
+    ili9488_dma_wait();
+
     ILI9488_SELECT();
     ILI9488_SETUP_CMD();
 
@@ -40,6 +148,16 @@ static void ili9488_read_data(uint8_t ubCmd, uint8_t *pubData, uint8_t ubCount)
 
 uint8_t ili9488_init()
 {
+    ldma_ch_disable(ILI9488_DMA_CHANNEL);
+    ldma_ch_peri_req_disable(ILI9488_DMA_CHANNEL);
+    ldma_ch_req_clear(ILI9488_DMA_CHANNEL);
+
+    ldma_ch_config(ILI9488_DMA_CHANNEL, LDMA_CH_REQSEL_SOURCESEL_USART1 | LDMA_CH_REQSEL_SIGSEL_USART1TXBL, LDMA_CH_CFG_SRCINCSIGN_POSITIVE, LDMA_CH_CFG_DSTINCSIGN_DEFAULT, LDMA_CH_CFG_ARBSLOTS_DEFAULT, 0);
+    ldma_ch_set_isr(ILI9488_DMA_CHANNEL, ili9488_dma_isr);
+
+    ldma_ch_peri_req_enable(ILI9488_DMA_CHANNEL);
+    ldma_ch_enable(ILI9488_DMA_CHANNEL);
+
     TFT_RESET();
     delay_ms(10);
     TFT_UNRESET();
@@ -131,6 +249,24 @@ uint8_t ili9488_init()
     return 1;
 }
 
+void ili9488_get_stats(ili9488_stats_t *pStats)
+{
+    if(!pStats)
+        return;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        *pStats = xStats;
+    }
+}
+void ili9488_reset_stats()
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        memset(&xStats, 0, sizeof(ili9488_stats_t));
+    }
+}
+
 uint32_t ili9488_read_id()
 {
     uint8_t ubBuf[3];
@@ -199,11 +335,44 @@ void ili9488_set_rotation(uint8_t ubRotation)
 
     ili9488_send_cmd(ILI9488_MEM_A_CTL, &ubBuf, 1);
 }
+uint16_t ili9488_get_width()
+{
+    return usMaxWidth + 1;
+}
+uint16_t ili9488_get_height()
+{
+    return usMaxHeigth + 1;
+}
 void ili9488_set_invert(uint8_t ubOnOff)
 {
     ili9488_send_cmd((ubOnOff ? ILI9488_INV_ON : ILI9488_INV_OFF), NULL, 0);
 }
 
+void ili9488_set_scroll_area(uint16_t usTop, uint16_t usHeight)
+{
+    if(usTop + usHeight > ILI9488_TFTHEIGHT)
+        return;
+
+    uint16_t usBottom = ILI9488_TFTHEIGHT - usTop - usHeight;
+    uint8_t ubBuf[6];
+
+    ubBuf[0] = usTop >> 8;
+    ubBuf[1] = usTop & 0xFF; // TFA
+    ubBuf[2] = usHeight >> 8;
+    ubBuf[3] = usHeight & 0xFF; // VSA
+    ubBuf[4] = usBottom >> 8;
+    ubBuf[5] = usBottom & 0xFF; // BFA
+    ili9488_send_cmd(ILI9488_VSCRL_DEF, ubBuf, 6); // Vertical Scrolling Definition
+}
+void ili9488_set_scroll_start(uint16_t usLine)
+{
+    uint8_t ubBuf[2];
+
+    ubBuf[0] = usLine >> 8;
+    ubBuf[1] = usLine & 0xFF; // VSP
+    ili9488_send_cmd(ILI9488_VSCRL_ADDR, ubBuf, 2); // Vertical Scrolling Start Address
+}
+
 void ili9488_read_pixel_block(rgb565_t *pPixelBuf, uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1)
 {
     if(usX0 > usX1)
@@ -234,8 +403,7 @@ void ili9488_fill_screen(rgb565_t xColor)
     if(!ili9488_set_window(0, 0, usMaxWidth, usMaxHeigth))
         return;
 
-    for(uint32_t ulI = ILI9488_TFTWIDTH * ILI9488_TFTHEIGHT; ulI > 0; ulI--)
-        ili9488_send_pixel_data(xColor);
+    ili9488_fill_pixels(xColor, ILI9488_TFTWIDTH * ILI9488_TFTHEIGHT, NULL); // Returns as soon as the transfer starts
 }
 
 
@@ -269,11 +437,18 @@ uint8_t ili9488_set_window(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t
 
     ili9488_send_cmd(ILI9488_RAM_WR, NULL, 0); // write to RAM
 
+    xStats.ulWindowSets++;
+
     return 1;
 }
 
 void ili9488_send_pixel_data(rgb565_t xColor)
 {
+    ili9488_dma_wait();
+
+    xStats.ulBytesSent += ILI9488_PIXEL_SIZE;
+    xStats.ulPixels++;
+
     ILI9488_SELECT();
     ILI9488_SETUP_DAT();
 
@@ -283,9 +458,52 @@ void ili9488_send_pixel_data(rgb565_t xColor)
 
     ILI9488_UNSELECT();
 }
+void ili9488_write_pixels(const uint8_t *pubData, uint32_t ulCount, ili9488_dma_callback_fn_t pfCallback)
+{
+    if(!pubData || !ulCount)
+        return;
+
+    ili9488_dma_wait();
+
+    pubDMASrc = pubData;
+    ubDMAFill = 0;
+
+    ili9488_dma_start(ulCount, pfCallback);
+}
+void ili9488_fill_pixels(rgb565_t xColor, uint32_t ulCount, ili9488_dma_callback_fn_t pfCallback)
+{
+    if(!ulCount)
+        return;
+
+    ili9488_dma_wait(); // Pattern might still be in use
+
+    if(!ubFillPatternValid || xColor != xFillPatternColor)
+    {
+        uint8_t *pubDst = pubFillPattern;
+
+        for(uint16_t usI = 0; usI < ILI9488_FILL_PATTERN_PIXELS; usI++)
+            pubDst = ili9488_pack_pixel(pubDst, xColor);
+
+        xFillPatternColor = xColor;
+        ubFillPatternValid = 1;
+    }
+
+    pubDMASrc = pubFillPattern;
+    ubDMAFill = 1;
+
+    ili9488_dma_start(ulCount, pfCallback);
+}
+uint8_t ili9488_dma_busy()
+{
+    return ubDMABusy;
+}
+void ili9488_dma_wait()
+{
+    while(ubDMABusy);
+}
 void ili9488_set_pixel_color(uint16_t usX, uint16_t usY, rgb565_t xColor)
 {
-    if(!ili9488_set_window(usX, usY, usX + 1, usY + 1))
+    if(!ili9488_set_window(usX, usY, usX, usY))
         return;
 
     ili9488_send_pixel_data(xColor);
@@ -6,11 +6,18 @@
 #include "systick.h"
 #include "utils.h"
 #include "usart.h"
+#include "ldma.h"
 #include "gpio.h"
 
 #define ILI9488_TFTWIDTH        320UL
 #define ILI9488_TFTHEIGHT       480UL
 
+#define ILI9488_PIXEL_SIZE          3 // 18 bit interface, one byte per color component
+#define ILI9488_DMA_CHANNEL         13
+#define ILI9488_DMA_MAX_XFER_SIZE   2048 // XFERCNT is 11 bits wide
+#define ILI9488_DMA_MAX_LOOPS       256 // LOOPCNT is 8 bits wide
+#define ILI9488_FILL_PATTERN_PIXELS 128
+
 // Commands
 #define ILI9488_NOP                         0x00 // NOP
 #define ILI9488_SW_RESET                    0x01 // Soft Reset
@@ -120,10 +127,34 @@
 #define ILI9488_ROTATION_VERTICAL_FLIP   2
 #define ILI9488_ROTATION_HORIZONTAL_FLIP 3
 
+typedef struct ili9488_stats_t ili9488_stats_t;
+typedef void (* ili9488_dma_callback_fn_t)();
+
+struct ili9488_stats_t
+{
+    uint32_t ulBytesSent; // Bytes clocked out on the bus, commands included
+    uint32_t ulCommands;
+    uint32_t ulPixels;
+    uint32_t ulWindowSets;
+    uint32_t ulDMATransfers;
+};
+
 extern uint8_t g_ubILI9488Rotation;
 
+static inline uint8_t* ili9488_pack_pixel(uint8_t *pubDst, rgb565_t xColor)
+{
+    *pubDst++ = RGB565_EXTRACT_RED(xColor);
+    *pubDst++ = RGB565_EXTRACT_GREEN(xColor);
+    *pubDst++ = RGB565_EXTRACT_BLUE(xColor);
+
+    return pubDst;
+}
+
 uint8_t ili9488_init();
 
+void ili9488_get_stats(ili9488_stats_t *pStats);
+void ili9488_reset_stats();
+
 uint32_t ili9488_read_id();
 
 void ili9488_sleep();
@@ -133,8 +164,13 @@ void ili9488_display_on();
 void ili9488_display_off();
 
 void ili9488_set_rotation(uint8_t ubRotation);
+uint16_t ili9488_get_width();
+uint16_t ili9488_get_height();
 void ili9488_set_invert(uint8_t ubOnOff);
 
+void ili9488_set_scroll_area(uint16_t usTop, uint16_t usHeight); // Frame memory lines, panel native orientation
+void ili9488_set_scroll_start(uint16_t usLine);
+
 void ili9488_read_pixel_block(rgb565_t *pPixelBuf, uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1);
 
 void ili9488_fill_screen(rgb565_t xColor);
@@ -142,6 +178,10 @@ void ili9488_fill_screen(rgb565_t xColor);
 uint8_t ili9488_set_window(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1);
 
 void ili9488_send_pixel_data(rgb565_t xColor);
+void ili9488_write_pixels(const uint8_t *pubData, uint32_t ulCount, ili9488_dma_callback_fn_t pfCallback);
+void ili9488_fill_pixels(rgb565_t xColor, uint32_t ulCount, ili9488_dma_callback_fn_t pfCallback);
+uint8_t ili9488_dma_busy();
+void ili9488_dma_wait();
 void ili9488_set_pixel_color(uint16_t usX, uint16_t usY, rgb565_t xColor);
 
 #endif  // __ILI9488_H__
\ No newline at end of file
@@ -38,6 +38,7 @@ void ldma_sync_clear(uint8_t ubMask);
 
 void ldma_ch_config(uint8_t ubChannel, uint32_t ulSource, uint32_t ulSrcIncSign, uint32_t ulDstIncSign, uint32_t ulArbitrationSlots, uint8_t ubLoopCount);
 void ldma_ch_set_isr(uint8_t ubChannel, ldma_ch_isr_t pfISR);
+void ldma_ch_set_loop_count(uint8_t ubChannel, uint8_t ubLoopCount);
 void ldma_ch_load(uint8_t ubChannel, ldma_descriptor_t *pDescriptor);
 void ldma_ch_sw_req(uint8_t ubChannel);
 void ldma_ch_enable(uint8_t ubChannel);
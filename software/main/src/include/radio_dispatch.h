@@ -0,0 +1,59 @@
+#ifndef __RADIO_DISPATCH_H__
+#define __RADIO_DISPATCH_H__
+
+#include <em_device.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "systick.h"
+#include "rfm69.h"
+#include "radio_protocol.h"
+#include "radio_transport.h"
+
+#define RADIO_DISPATCH_MAX_MESSAGE_SIZE     60      // Largest decoded radio_cmd_*_t struct, must be a multiple of 4
+#define RADIO_DISPATCH_REQUEST_SLOTS        16      // Requests awaiting a response, all nodes together
+#define RADIO_DISPATCH_REQUEST_BUCKETS      16      // Must be a power of 2
+#define RADIO_DISPATCH_DEFAULT_TIMEOUT      2000    // ms
+
+typedef struct radio_dispatch_entry_t radio_dispatch_entry_t;
+typedef struct radio_dispatch_request_t radio_dispatch_request_t;
+typedef struct radio_dispatch_stats_t radio_dispatch_stats_t;
+typedef void (* radio_dispatch_handler_fn_t)(uint8_t, int8_t, const void *); // Node ID, RSSI, decoded message
+typedef void (* radio_dispatch_response_fn_t)(uint8_t, uint8_t, const void *); // Node ID, request command, decoded response (NULL on timeout)
+
+struct radio_dispatch_entry_t
+{
+    const radio_protocol_message_t *pMessage; // NULL if the command has no wire layout, anything received with it is dropped
+    radio_dispatch_handler_fn_t pfHandler;
+};
+struct radio_dispatch_request_t
+{
+    uint8_t ubUsed;
+    uint8_t ubNodeID;
+    uint8_t ubCommand; // Request command, the response is the same without RADIO_CMD_REQUEST_FLAG
+    uint64_t ullDeadline;
+    radio_dispatch_response_fn_t pfCallback;
+    radio_dispatch_request_t *pPrev; // Hash bucket chain, pNext links the free list when unused
+    radio_dispatch_request_t *pNext;
+};
+struct radio_dispatch_stats_t
+{
+    uint32_t ulDispatched;
+    uint32_t ulUnhandled; // Valid messages without a handler
+    uint32_t ulMalformed; // Unknown command or failed to decode
+    uint32_t ulRequests;
+    uint32_t ulResponses;
+    uint32_t ulTimeouts;
+};
+
+void radio_dispatch_init(); // Takes over the radio_transport RX callback
+void radio_dispatch_tick();
+
+void radio_dispatch_set_handler(uint8_t ubCommand, radio_dispatch_handler_fn_t pfFunc); // Request flag included in the command
+
+uint8_t radio_dispatch_send(uint8_t ubNodeID, const void *pvMessage);
+uint8_t radio_dispatch_request(uint8_t ubNodeID, const void *pvRequest, uint16_t usTimeout, radio_dispatch_response_fn_t pfCallback); // One request per node and command in flight
+
+void radio_dispatch_get_stats(radio_dispatch_stats_t *pStats);
+
+#endif // __RADIO_DISPATCH_H__
@@ -0,0 +1,78 @@
+#ifndef __RADIO_FOTA_H__
+#define __RADIO_FOTA_H__
+
+#include <em_device.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils.h"
+#include "systick.h"
+#include "crypto.h"
+#include "qspi.h"
+#include "radio_protocol.h"
+#include "radio_dispatch.h"
+
+// Node side contract
+// - FOTA_BEGIN answers with the offset it already holds for the same version and size, 0 otherwise
+// - Chunks are stored as they come, out of order ones included, a FOTA_SEND_CHUNK response is sent every few chunks, on every gap, on duplicates, when a gap gets filled and on the last chunk
+// - FOTA_END hashes the stored image and answers RADIO_FOTA_STATUS_HASH_MISMATCH (discarding it) if the digest differs
+
+#define RADIO_FOTA_WINDOW_CHUNKS        16      // Chunks in flight past the cumulative ACK, at most 32 (the selective ACK mask)
+#define RADIO_FOTA_CHUNKS_PER_TICK      2       // Burst handed to the radio per tick, the rest waits for TX FIFO room
+#define RADIO_FOTA_ACK_TIMEOUT          500     // ms - No progress for this long sends everything past the cumulative ACK again
+#define RADIO_FOTA_REQUEST_TIMEOUT      1000    // ms - Begin and end exchanges
+#define RADIO_FOTA_MAX_RETRIES          8       // Consecutive timeouts before the session fails, progress resets the count
+#define RADIO_FOTA_MAX_RESTARTS         1       // Full retransfers after a hash mismatch
+
+#define RADIO_FOTA_STATE_IDLE           0
+#define RADIO_FOTA_STATE_BEGIN          1       // Waiting for the node resume offset
+#define RADIO_FOTA_STATE_TRANSFER       2
+#define RADIO_FOTA_STATE_END            3       // Image acknowledged, waiting for the node hash check
+
+typedef struct radio_fota_session_t radio_fota_session_t;
+typedef struct radio_fota_stats_t radio_fota_stats_t;
+typedef void (* radio_fota_callback_fn_t)(uint8_t, uint8_t); // Node ID, success
+
+struct radio_fota_session_t
+{
+    uint8_t ubState;
+    uint8_t ubNodeID;
+    uint8_t ubRequestPending;
+    uint8_t ubRetries;
+    uint8_t ubRestarts;
+    uint32_t ulImageAddress; // QSPI flash address
+    uint32_t ulImageSize;
+    uint32_t ulVersion;
+    uint8_t pubDigest[RADIO_PROTOCOL_FOTA_DIGEST_SIZE];
+    uint32_t ulBase; // Cumulative ACK in bytes, the window starts here
+    uint32_t ulSentMask; // Chunks from ulBase, bit 0 is the chunk at ulBase
+    uint32_t ulAckedMask;
+    uint32_t ulResentMask; // Fast retransmitted already, further losses wait for the timeout
+    uint8_t ubNextNew; // First chunk in the window never sent
+    uint64_t ullLastProgress;
+    uint64_t ullStart;
+    radio_fota_callback_fn_t pfCallback;
+};
+struct radio_fota_stats_t
+{
+    uint8_t ubState;
+    uint8_t ubNodeID;
+    uint32_t ulImageSize;
+    uint32_t ulAckedBytes;
+    uint32_t ulElapsed; // ms since the session started
+    uint32_t ulChunksSent;
+    uint32_t ulChunksResent;
+    uint32_t ulAcks;
+    uint32_t ulTimeouts;
+    uint32_t ulHashMismatches;
+};
+
+void radio_fota_init(); // After radio_dispatch_init()
+void radio_fota_tick();
+
+uint8_t radio_fota_start(uint8_t ubNodeID, uint32_t ulImageAddress, uint32_t ulImageSize, uint32_t ulVersion, radio_fota_callback_fn_t pfCallback); // One session at a time
+void radio_fota_abort();
+uint8_t radio_fota_busy();
+
+void radio_fota_get_stats(radio_fota_stats_t *pStats);
+
+#endif // __RADIO_FOTA_H__
@@ -2,6 +2,29 @@
 #define __RADIO_PROTOCOL_H__
 
 #include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// On air every message is the command byte, the wire version and the fields in declaration order
+// Fixed point integers go out little endian, counters and delays as unsigned LEB128 varints, flags packed into bits, strings length prefixed
+#define RADIO_PROTOCOL_WIRE_VERSION        1
+#define RADIO_PROTOCOL_HEADER_SIZE         2 // Command, wire version
+
+#define RADIO_PROTOCOL_FIELD_BYTE          0 // uint8_t or int8_t
+#define RADIO_PROTOCOL_FIELD_U16           1 // uint16_t or int16_t, little endian
+#define RADIO_PROTOCOL_FIELD_U32           2 // uint32_t or int32_t, little endian
+#define RADIO_PROTOCOL_FIELD_VARINT        3 // uint16_t or uint32_t (ubArg is the size in the struct), 1 to 5 bytes
+#define RADIO_PROTOCOL_FIELD_FLAG          4 // uint8_t boolean, ubArg is the bit in a shared byte, bit 0 starts a new byte
+#define RADIO_PROTOCOL_FIELD_STRING        5 // char array (ubArg is its size), length byte followed by the characters
+#define RADIO_PROTOCOL_FIELD_BYTES         6 // uint8_t length immediately followed by a uint8_t array (ubArg is its size), same on air
+
+#define RADIO_PROTOCOL_FOTA_CHUNK_SIZE     48 // Worst case chunk message is 56 bytes, fits one RFM69 frame
+#define RADIO_PROTOCOL_FOTA_DIGEST_SIZE    32 // SHA-256
+
+#define RADIO_FOTA_STATUS_OK               0
+#define RADIO_FOTA_STATUS_HASH_MISMATCH    1 // Node discarded the image, it reports offset 0 on the next begin
+#define RADIO_FOTA_STATUS_ERROR            2
 
 #define RADIO_CMD_REQUEST_FLAG             0x80
 
@@ -20,6 +43,11 @@
 
 #define RADIO_CMD_FOTA_QUERY_INFO          0x50
 #define RADIO_CMD_FOTA_SEND_CHUNK          0x51
+#define RADIO_CMD_FOTA_BEGIN               0x52
+#define RADIO_CMD_FOTA_END                 0x53
+
+#define RADIO_CMD_TRANSPORT_FRAGMENT       0x60 // Handled by radio_transport, never seen by the application
+#define RADIO_CMD_TRANSPORT_STATUS         0x61
 
 typedef struct radio_cmd_ping_req_t radio_cmd_ping_req_t;
 typedef struct radio_cmd_ping_res_t radio_cmd_ping_res_t;
@@ -45,6 +73,14 @@ typedef struct radio_cmd_fota_query_info_req_t radio_cmd_fota_query_info_req_t;
 typedef struct radio_cmd_fota_query_info_res_t radio_cmd_fota_query_info_res_t;
 typedef struct radio_cmd_fota_send_chunk_req_t radio_cmd_fota_send_chunk_req_t;
 typedef struct radio_cmd_fota_send_chunk_res_t radio_cmd_fota_send_chunk_res_t;
+typedef struct radio_cmd_fota_begin_req_t radio_cmd_fota_begin_req_t;
+typedef struct radio_cmd_fota_begin_res_t radio_cmd_fota_begin_res_t;
+typedef struct radio_cmd_fota_end_req_t radio_cmd_fota_end_req_t;
+typedef struct radio_cmd_fota_end_res_t radio_cmd_fota_end_res_t;
+typedef struct radio_cmd_transport_fragment_t radio_cmd_transport_fragment_t;
+typedef struct radio_cmd_transport_status_t radio_cmd_transport_status_t;
+typedef struct radio_protocol_field_t radio_protocol_field_t;
+typedef struct radio_protocol_message_t radio_protocol_message_t;
 
 struct radio_cmd_ping_req_t
 {
@@ -92,7 +128,7 @@ struct radio_cmd_temp_data_req_t
 struct radio_cmd_temp_data_res_t
 {
     uint8_t ubCommand;
-    double gWaterTemp;
+    int16_t sWaterTemp; // 0.01 degC
 };
 struct radio_cmd_bat_data_req_t
 {
@@ -102,7 +138,7 @@ struct radio_cmd_bat_data_req_t
 struct radio_cmd_bat_data_res_t
 {
     uint8_t ubCommand;
-    double gBatteryVoltage;
+    uint16_t usBatteryVoltage; // mV
     uint8_t ubChargerDetected;
     uint8_t ubChargerTerminated;
     uint8_t ubBatteryLow;
@@ -160,10 +196,74 @@ struct radio_cmd_fota_query_info_res_t
 struct radio_cmd_fota_send_chunk_req_t
 {
     uint8_t ubCommand;
+    uint32_t ulOffset;
+    uint8_t ubDataSize;
+    uint8_t pubData[RADIO_PROTOCOL_FOTA_CHUNK_SIZE];
+};
+struct radio_cmd_fota_send_chunk_res_t // Sent by the node every few chunks and whenever it sees a gap, not one per chunk
+{
+    uint8_t ubCommand;
+    uint32_t ulOffset; // Everything below is stored
+    uint32_t ulReceivedMask; // Bit i set if the chunk at ulOffset + i * RADIO_PROTOCOL_FOTA_CHUNK_SIZE is stored
+};
+struct radio_cmd_fota_begin_req_t
+{
+    uint8_t ubCommand;
+    uint32_t ulVersion;
+    uint32_t ulImageSize;
+};
+struct radio_cmd_fota_begin_res_t
+{
+    uint8_t ubCommand;
+    uint32_t ulOffset; // Resume point if the node holds part of the same image, 0 otherwise
+};
+struct radio_cmd_fota_end_req_t
+{
+    uint8_t ubCommand;
+    uint8_t ubDigestSize;
+    uint8_t pubDigest[RADIO_PROTOCOL_FOTA_DIGEST_SIZE];
+};
+struct radio_cmd_fota_end_res_t
+{
+    uint8_t ubCommand;
+    uint8_t ubStatus;
+};
+struct radio_cmd_transport_fragment_t
+{
+    uint8_t ubCommand;
+    uint8_t ubMessageID;
+    uint8_t ubIndex;
+    uint8_t ubCount;
+    uint8_t pubData[]; // Full fragments except for the last one
 };
-struct radio_cmd_fota_send_chunk_res_t
+struct radio_cmd_transport_status_t
 {
     uint8_t ubCommand;
+    uint8_t ubMessageID;
+    uint8_t ubReserved[2];
+    uint32_t ulMissingMask; // Zero when the message is complete
 };
 
+struct radio_protocol_field_t
+{
+    uint8_t ubType;
+    uint8_t ubOffset;
+    uint8_t ubArg;
+};
+struct radio_protocol_message_t
+{
+    uint8_t ubCommand; // Request flag included
+    uint8_t ubStructSize;
+    const radio_protocol_field_t *pFields;
+    uint8_t ubFieldCount;
+};
+
+// Transport frames keep their own fixed layout (see radio_transport.c) and are not described here
+const radio_protocol_message_t* radio_protocol_get_message(uint8_t ubCommand);
+uint8_t radio_protocol_get_max_size(uint8_t ubCommand); // Worst case encoded size, 0 if the command is unknown
+
+uint8_t radio_protocol_encode(const void *pvMessage, uint8_t *pubBuffer, uint8_t ubBufferSize); // Returns the encoded size, 0 on failure
+uint8_t radio_protocol_decode(void *pvMessage, uint8_t ubMessageSize, const uint8_t *pubBuffer, uint8_t ubSize);
+uint8_t radio_protocol_decode_message(const radio_protocol_message_t *pMessage, void *pvMessage, uint8_t ubMessageSize, const uint8_t *pubBuffer, uint8_t ubSize); // Skips the lookup when the layout is already known
+
 #endif // __RADIO_PROTOCOL_H__
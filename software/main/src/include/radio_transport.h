@@ -0,0 +1,74 @@
+#ifndef __RADIO_TRANSPORT_H__
+#define __RADIO_TRANSPORT_H__
+
+#include <em_device.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "systick.h"
+#include "rfm69.h"
+#include "radio_protocol.h"
+
+#define RADIO_TRANSPORT_FRAGMENT_DATA_SIZE  ((uint16_t)(RFM69_MAX_DATA_SIZE - sizeof(radio_cmd_transport_fragment_t))) // Not size_t, so it compares with the signed sizes around it
+#define RADIO_TRANSPORT_MAX_FRAGMENTS       32      // One bit per fragment in the masks
+#define RADIO_TRANSPORT_MAX_MESSAGE_SIZE    1024    // Must fit in RADIO_TRANSPORT_MAX_FRAGMENTS fragments
+#define RADIO_TRANSPORT_TX_SLOTS            2
+#define RADIO_TRANSPORT_RX_SLOTS            4       // Oldest slot is evicted when a new message does not fit
+#define RADIO_TRANSPORT_STATUS_DELAY        200     // ms - Silence before the receiver reports missing fragments
+#define RADIO_TRANSPORT_TX_TIMEOUT          1000    // ms - Silence before the sender pokes the receiver with the last fragment
+#define RADIO_TRANSPORT_TX_RETRIES          5
+#define RADIO_TRANSPORT_RX_TIMEOUT          10000   // ms - Slots without progress are evicted, complete ones are kept to answer late pokes (must outlast TX_TIMEOUT * (TX_RETRIES + 1))
+
+typedef struct radio_transport_tx_slot_t radio_transport_tx_slot_t;
+typedef struct radio_transport_rx_slot_t radio_transport_rx_slot_t;
+typedef struct radio_transport_stats_t radio_transport_stats_t;
+typedef void (* radio_transport_rx_callback_fn_t)(uint8_t, int8_t, const uint8_t *, uint16_t);
+typedef void (* radio_transport_tx_callback_fn_t)(uint8_t, uint8_t, uint8_t);
+
+struct radio_transport_tx_slot_t
+{
+    uint8_t ubUsed;
+    uint8_t ubNodeID;
+    uint8_t ubMessageID;
+    uint8_t ubFragmentCount;
+    uint8_t ubRetriesLeft;
+    uint16_t usSize;
+    uint32_t ulUnsentMask; // Fragments still to be handed to rfm69_send()
+    uint64_t ullLastActivity;
+    uint8_t pubData[RADIO_TRANSPORT_MAX_MESSAGE_SIZE];
+};
+struct radio_transport_rx_slot_t
+{
+    uint8_t ubUsed;
+    uint8_t ubComplete;
+    uint8_t ubNodeID;
+    uint8_t ubMessageID;
+    uint8_t ubFragmentCount;
+    int8_t bRSSI;
+    uint16_t usSize;
+    uint32_t ulReceivedMask;
+    uint64_t ullLastActivity;
+    uint64_t ullLastStatus;
+    uint8_t pubData[RADIO_TRANSPORT_MAX_MESSAGE_SIZE];
+};
+struct radio_transport_stats_t
+{
+    uint32_t ulMessagesSent;
+    uint32_t ulMessagesFailed;
+    uint32_t ulMessagesReceived;
+    uint32_t ulFragmentsSent;
+    uint32_t ulFragmentsResent;
+    uint32_t ulEvictions;
+};
+
+void radio_transport_init();
+void radio_transport_tick();
+
+void radio_transport_set_rx_callback(radio_transport_rx_callback_fn_t pfFunc); // Node ID, RSSI, data, size - Plain radio packets are passed through as well
+void radio_transport_set_tx_callback(radio_transport_tx_callback_fn_t pfFunc); // Node ID, message ID, delivered
+
+uint8_t radio_transport_send(uint8_t ubReceiver, const void *pvData, uint16_t usSize); // Returns the message ID, 0 on failure
+
+void radio_transport_get_stats(radio_transport_stats_t *pStats);
+
+#endif // __RADIO_TRANSPORT_H__
@@ -0,0 +1,51 @@
+#ifndef __RECORD_FIFO_H__
+#define __RECORD_FIFO_H__
+
+#include <em_device.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#define RECORD_FIFO_HEADER_SIZE 2 // 16 bit little endian length in front of every record
+
+// Single producer, single consumer
+// The producer only moves ulHead and the consumer only moves ulTail, so an ISR and the main loop can share a FIFO without masking interrupts
+// Both indexes run freely and are masked on access, the buffer size must be a power of 2
+
+typedef struct
+{
+    const uint8_t *pubData;
+    uint32_t ulSize;
+} record_fifo_span_t;
+
+typedef struct
+{
+    uint8_t *pubBuffer;
+    uint8_t ubBufferAllocated : 1;
+    uint32_t ulBufferSize;
+    volatile uint32_t ulHead;
+    volatile uint32_t ulTail;
+} record_fifo_t;
+
+record_fifo_t* record_fifo_init(uint8_t *pubBuffer, uint32_t ulSize);
+void record_fifo_delete(record_fifo_t *pFIFO);
+uint8_t record_fifo_write(record_fifo_t *pFIFO, const uint8_t *pubData, uint32_t ulSize);
+uint8_t record_fifo_read(record_fifo_t *pFIFO, uint8_t *pubData, uint32_t *pulSize, uint32_t ulMaxSize);
+uint32_t record_fifo_peek(record_fifo_t *pFIFO, record_fifo_span_t pSpans[2]); // Zero copy, returns the record size (0 if empty), the data is valid until record_fifo_commit
+void record_fifo_commit(record_fifo_t *pFIFO); // Drop the record returned by record_fifo_peek
+static inline uint8_t record_fifo_is_empty(record_fifo_t *pFIFO)
+{
+    if(!pFIFO)
+        return 1;
+
+    return pFIFO->ulHead == pFIFO->ulTail;
+}
+static inline uint32_t record_fifo_get_free(record_fifo_t *pFIFO)
+{
+    if(!pFIFO)
+        return 0;
+
+    return pFIFO->ulBufferSize - (pFIFO->ulHead - pFIFO->ulTail);
+}
+
+#endif
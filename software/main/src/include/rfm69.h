@@ -10,7 +10,10 @@
 #include "systick.h"
 #include "gpio.h"
 #include "usart.h"
-#include "blob_fifo.h"
+#include "ldma.h"
+#include "dbg.h"
+#include "record_fifo.h"
+#include "trng.h"
 
 #define RFM69_REG_FIFO 0x00
 #define RFM69_REG_OPMODE 0x01
@@ -1046,10 +1049,12 @@
 #define RFM69_CTL_RELR    2
 #define RFM69_CTL_RELS    3
 #define RFM69_CTL_QOS     4
+#define RFM69_CTL_AGG     5    // Data is a sequence of length prefixed messages
 
 #define RFM69_MAX_PAYLOAD_SIZE       64    // 64 bytes because AES is enabled
 #define RFM69_PACKET_HEADER_SIZE     6    // Packed header is 6 bytes (Flags, Packet ID (16 bit), Source Node, Target Node, Remote RSSI (for ATC))
 #define RFM69_MAX_DATA_SIZE         (RFM69_MAX_PAYLOAD_SIZE - RFM69_PACKET_HEADER_SIZE)
+#define RFM69_FRAME_OVERHEAD_SIZE   6     // Sync word (3), length byte and CRC (2), for airtime accounting, the preamble length comes from the modem settings
 
 #define RFM69_MINIMUM_TX_POWER -2 // dBm - Do not touch
 #define RFM69_MAXIMUM_TX_POWER 20 // dBm - Do not touch
@@ -1058,12 +1063,84 @@
 #define RFM69_NORMAL_RX_SENSITIVITY    -110 // dBm
 #define RFM69_LISTEN_RX_SENSITIVITY    -95  // dBm - Set higher than noise floor, otherwise excessive current will be used in listen mode
 
-#define RFM69_RX_PACKET_FIFO_SIZE 2048    // Set high enough or packet loss will occur
-#define RFM69_TX_PACKET_FIFO_SIZE 512    // Usually does not need to be set very high
+#define RFM69_DMA_RX_CHANNEL    14    // Lower channel number wins arbitration, RX must never fall behind TX
+#define RFM69_DMA_TX_CHANNEL    15
+
+#define RFM69_TX_TIMEOUT    100    // ms - On top of the longest frame airtime at the current bit rate, abort TX if PacketSent does not come by then
+
+#define RFM69_REGISTER_COUNT    0x72   // Shadowed register map, RegFifo to RegTestAfc
+#define RFM69_BURST_MAX_SIZE    16     // Registers per burst when writing a register table, longer runs are split
+
+#define RFM69_MODEM_PROFILE_4K8         0       // 4.8 kbps, 5 kHz deviation, 20.8 kHz RX bandwidth, for range
+#define RFM69_MODEM_PROFILE_25K         1       // 25 kbps, 20 kHz deviation, 41.7 kHz RX bandwidth, applied by rfm69_init()
+#define RFM69_MODEM_PROFILE_55K5        2       // 55.5 kbps, 50 kHz deviation, 83.3 kHz RX bandwidth, for throughput
+#define RFM69_MODEM_PROFILE_COUNT       3
+#define RFM69_MODEM_PROFILE_CUSTOM      0xFF    // Bit rate or deviation changed by hand
+#define RFM69_MODEM_PROFILE_REGISTERS   12
+
+#define RFM69_TX_STATE_IDLE     0
+#define RFM69_TX_STATE_BACKOFF  1    // Frame peeked from the TX FIFO, listening until the backoff runs out
+#define RFM69_TX_STATE_STANDBY  2    // Channel clear, waiting for ModeReady to load the frame
+#define RFM69_TX_STATE_SENDING  3    // In TX, waiting for the PacketSent interrupt on DIO0
+#define RFM69_TX_STATE_DONE     4    // PacketSent seen, retry bookkeeping pending
+
+#define RFM69_CSMA_SLOT_TIME            2    // ms - Backoff unit, covers an RSSI sample and the RX to TX turnaround
+#define RFM69_CSMA_MAX_BACKOFFS         8    // Busy channel assessments before a frame is given up on
+#define RFM69_CSMA_RETRY_JITTER_SHIFT   2    // QoS retries are delayed by up to a quarter of their retry delay on top
+
+#define RFM69_CSMA_PRIORITY_HIGH    0    // ACK, REL and REL requests, they complete an exchange already on air
+#define RFM69_CSMA_PRIORITY_NORMAL  1    // QoS 1 and 2 data, fresh or retried
+#define RFM69_CSMA_PRIORITY_LOW     2    // QoS 0 data
+#define RFM69_CSMA_PRIORITY_COUNT   3
+
+#define RFM69_RX_PACKET_FIFO_SIZE 2048    // Set high enough or packet loss will occur, must be a power of 2
+#define RFM69_TX_PACKET_FIFO_SIZE 512    // Usually does not need to be set very high, must be a power of 2
+
+#ifndef RFM69_FIFO_DRAIN_DMA
+#define RFM69_FIFO_DRAIN_DMA        1     // 0 reads the payload inside rfm69_isr() with interrupts masked, the path the LDMA drain replaced
+#endif
+#ifndef RFM69_PENDING_SLAB_SIZE
+#define RFM69_PENDING_SLAB_SIZE     64    // Outstanding QoS exchanges, all states together
+#endif
+#define RFM69_PENDING_HASH_BUCKETS  32    // Must be a power of 2
+
+#define RFM69_PENDING_STATE_FREE    0
+#define RFM69_PENDING_STATE_ACK     1    // Our packet, waiting for the ACK
+#define RFM69_PENDING_STATE_REL     2    // Their QoS 2 packet, ACKed, waiting for the REL request
+#define RFM69_PENDING_STATE_RELACK  3    // Our QoS 2 packet, REL requested, waiting for the REL
+#define RFM69_PENDING_STATE_COUNT   4
+
+#define RFM69_TIMER_WHEEL_RESOLUTION_SHIFT  3    // 8 ms per wheel tick
+#define RFM69_TIMER_WHEEL_BITS              6
+#define RFM69_TIMER_WHEEL_SIZE              (1 << RFM69_TIMER_WHEEL_BITS)    // Slots per level, two levels cover ~32 s, longer deadlines cascade again
+
+#define RFM69_AGGREGATION_SLOTS     4     // Frames being filled at the same time, one per receiver and QoS class
+#define RFM69_AGGREGATION_LATENCY   20    // ms - Default budget a message may wait for others to share its frame, 0 disables aggregation
+
+#define RFM69_LINK_TABLE_GROWTH     4     // Records added each time the link table is full, it only holds nodes seen or addressed
+#define RFM69_LINK_RSSI_EWMA_SHIFT  3     // RSSI and noise floor averages weigh each new sample 1/8
+#define RFM69_LINK_MAX_ID_GAP       256   // Packet ID jumps larger than this (either way) mean the node restarted, resync instead of counting losses
+#define RFM69_LINK_ID_WINDOW        32    // Data frame IDs below the newest one remembered for duplicate suppression, bits in ulIDWindow
+
+#define RFM69_ATC_GAIN_EWMA_SHIFT   2     // Path gain average weighs each remote RSSI report 1/4
+#define RFM69_ATC_GAIN_CLAMP        6     // dB - Largest deviation a single report counts with, keeps deep fades from dragging the average
+#define RFM69_ATC_HYSTERESIS        1     // dB - Dead band around the target, no correction inside it
+#define RFM69_ATC_MAX_STEP          8     // dB - Correction steps double while they keep the same direction, up to this
+#define RFM69_ATC_LOSS_STEP         1     // dB - Boost on a retransmission, doubled for every consecutive one
+#define RFM69_ATC_SETTLE_REPORTS    4     // Consecutive reports inside the dead band to call the loop converged
 
 
 typedef struct rfm69_packet_header_t rfm69_packet_header_t;
 typedef struct rfm69_pending_packet_t rfm69_pending_packet_t;
+typedef struct rfm69_pending_stats_t rfm69_pending_stats_t;
+typedef struct rfm69_isr_stats_t rfm69_isr_stats_t;
+typedef struct rfm69_aggregate_t rfm69_aggregate_t;
+typedef struct rfm69_tx_stats_t rfm69_tx_stats_t;
+typedef struct rfm69_csma_window_t rfm69_csma_window_t;
+typedef struct rfm69_link_t rfm69_link_t;
+typedef struct rfm69_register_t rfm69_register_t;
+typedef struct rfm69_modem_profile_t rfm69_modem_profile_t;
+typedef struct rfm69_spi_stats_t rfm69_spi_stats_t;
 typedef void (* rfm69_timeout_callback_fn_t)(uint16_t);
 typedef void (* rfm69_tx_callback_fn_t)(uint16_t, uint16_t);
 typedef void (* rfm69_ack_callback_fn_t)(uint16_t);
@@ -1077,22 +1154,125 @@ struct rfm69_packet_header_t
     uint8_t ubRELRequested : 1;
     uint8_t ubRELSent : 1;
     uint8_t ubQoSLevel : 1;
+    uint8_t ubAggregated : 1;
     int8_t bRemoteRSSI;
     uint8_t ubReceiverNodeID;
     uint8_t ubSenderNodeID;
 };
 struct rfm69_pending_packet_t
 {
-    rfm69_packet_header_t sHeader;
-    uint8_t *pubData;
+    rfm69_packet_header_t sHeader; // Keyed by the peer (ubReceiverNodeID) and usID
+    uint8_t pubData[RFM69_MAX_DATA_SIZE];
     uint8_t ubDataSize;
+    uint8_t ubState;
     uint8_t ubInTX;
     uint16_t usRetryDelay;
     uint16_t usRetriesLeft;
     uint64_t ullLastRetry;
-    rfm69_pending_packet_t *pPrev;
+    uint32_t ulDeadline; // Retransmission deadline in wheel ticks, only valid while scheduled
+    rfm69_pending_packet_t **ppTimerSlot; // Timer wheel slot (or the expired list) holding the entry, NULL if not scheduled
+    rfm69_pending_packet_t *pTimerPrev;
+    rfm69_pending_packet_t *pTimerNext;
+    rfm69_pending_packet_t *pPrev; // Hash bucket chain, pNext links the free list when unused
     rfm69_pending_packet_t *pNext;
 };
+struct rfm69_pending_stats_t
+{
+    uint16_t usCapacity;
+    uint16_t usUsed;
+    uint16_t usPeakUsed;
+    uint16_t pusStateCount[RFM69_PENDING_STATE_COUNT];
+    uint32_t ulAllocFailures;
+    uint32_t ulTimerExpirations;
+    uint32_t ulTimerCascades;
+};
+struct rfm69_isr_stats_t
+{
+    uint32_t ulDrains;
+    uint32_t ulDrainedBytes;
+    uint32_t ulDrainErrors;
+    uint32_t ulInlineFinishes; // Drains completed by a register access that could not wait for the LDMA interrupt
+    uint32_t ulInlineFinishCycles; // Interrupts masked while those register accesses waited, DWT cycles in total
+    uint32_t ulLastMaskedCycles; // Interrupts masked in rfm69_isr(), DWT cycles
+    uint32_t ulMaxMaskedCycles; // Longest masked stretch, rfm69_isr() or an inline finish
+};
+struct rfm69_aggregate_t
+{
+    rfm69_packet_header_t sHeader; // The packet ID is taken when the frame is opened and shared by every message in it
+    uint8_t pubData[RFM69_MAX_DATA_SIZE]; // Length prefixed messages
+    uint8_t ubDataSize;
+    uint8_t ubCount; // 0 if the slot is free
+    uint8_t ubQoSLevel;
+    uint16_t usRetryDelay;
+    uint16_t usRetries;
+    uint64_t ullDeadline;
+};
+struct rfm69_tx_stats_t
+{
+    uint32_t ulMessages; // Accepted by rfm69_send()
+    uint32_t ulFrames; // Loaded into the radio, responses and retransmissions included
+    uint32_t ulAggregatedMessages;
+    uint32_t ulAggregatedFrames;
+    uint32_t ulAggregationStalls; // Flush attempts put off to the next tick because the frame could not be queued yet
+    uint32_t ulAirBytes; // Bytes on air, preamble and padding included
+    uint32_t ulAirtime; // ms, accumulated per frame at the bit rate it went out with
+    uint32_t ulCSMABusy; // Busy channel assessments
+    uint32_t ulCSMAFailures; // Frames given up on after RFM69_CSMA_MAX_BACKOFFS busy assessments
+};
+struct rfm69_csma_window_t
+{
+    uint8_t ubIFS; // Slots always waited before the random part, lower for higher priorities
+    uint16_t usMinWindow; // Slots, must be a power of 2
+    uint16_t usMaxWindow; // Slots, must be a power of 2
+};
+struct rfm69_link_t
+{
+    uint8_t ubNodeID;
+    int8_t bPowerLevel; // dBm - ATC TX power towards the node
+    int8_t bTargetRSSI; // dBm - ATC target at the node, 0 disables ATC
+    int8_t bRemoteRSSI; // dBm - Last RSSI the node reported for our frames, -128 if none yet
+    int8_t bLastRSSI; // dBm - Last RSSI measured from the node, -128 if none yet
+    int8_t bSNR; // dB - RSSI average over the noise floor sampled by CSMA
+    uint8_t ubIDSynced; // usNextID is valid
+    int8_t bLastTXPower; // dBm - Power of the last frame loaded for the node, what its next RSSI report refers to
+    int8_t bATCDirection; // Sign of the last correction, 0 after a reset
+    uint8_t ubATCStep; // dB
+    uint8_t ubATCLossStreak; // Consecutive retransmissions
+    uint8_t ubATCSettled; // Consecutive reports inside the dead band
+    uint8_t ubATCConverged;
+    uint8_t ubATCGainValid;
+    int16_t sRSSIAverage; // 1/16 dBm, EWMA of bLastRSSI
+    int16_t sATCPathGain; // 1/16 dB - Remote RSSI minus the TX power it was measured at, averaged
+    uint16_t usNextID; // Packet ID expected in the next data frame from the node
+    uint32_t ulIDWindow; // Bit i set if data frame usNextID - 1 - i was received
+    uint32_t ulRXPackets; // Data frames received
+    uint32_t ulRXIDGaps; // Data frames missing from the node packet ID sequence, only an upper bound on loss: the node numbers frames to every receiver with one shared counter, so frames it sent to others count as gaps here and overstate loss
+    uint32_t ulRXDuplicates; // Data frames received again (lost ACK), answered but not delivered
+    uint32_t ulTXPackets; // Frames loaded into the radio for the node, responses and retransmissions included
+    uint32_t ulTXRetries;
+    uint32_t ulTXFailures; // QoS exchanges that ran out of retries
+    int32_t lTXPowerSum; // dBm - Over ulTXPackets, for the average TX power
+    uint32_t ulATCConvergenceTime; // ms - From the last disturbance (target change, start, leaving the dead band, loss) until settled
+    uint64_t ullATCDisturbance; // ms
+    uint64_t ullLastSeen; // ms - 0 if nothing was received yet
+};
+struct rfm69_register_t
+{
+    uint8_t ubRegister;
+    uint8_t ubValue;
+};
+struct rfm69_modem_profile_t
+{
+    const char *pszName;
+    rfm69_register_t pRegisters[RFM69_MODEM_PROFILE_REGISTERS]; // Address order, contiguous registers go out in one burst
+};
+struct rfm69_spi_stats_t
+{
+    uint32_t ulTransactions; // Chip select cycles, FIFO accesses included
+    uint32_t ulBytes; // Clocked on the bus, addresses included
+    uint32_t ulShadowHits; // Register reads answered by the shadow
+    uint32_t ulElidedWrites; // Register writes dropped because the shadow already held the value
+};
 
 uint8_t rfm69_init(uint8_t ubNodeID, uint8_t ubNetID, const void *pvEncKey);
 void rfm69_isr();
@@ -1103,8 +1283,31 @@ void rfm69_set_tx_callback(rfm69_tx_callback_fn_t pfFunc);
 void rfm69_set_ack_callback(rfm69_ack_callback_fn_t pfFunc);
 void rfm69_set_rx_callback(rfm69_rx_callback_fn_t pfFunc);
 
+// Returns the packet ID, 0 if refused for now (TX FIFO or pending slab full), the caller retries on a later tick
+// Messages to the same node with the same QoS, retry delay and retries wait up to the aggregation latency to share a frame and then share its packet ID
+// The TX, ACK and timeout callbacks fire per frame, once for that ID, so every message that joined the aggregate is resolved by the same call
 uint16_t rfm69_send(uint8_t ubReceiver, const void *pvPayload, uint8_t ubSize, uint8_t ubQoSLevel, uint16_t usRetryDelay, uint16_t usRetries);
 
+void rfm69_get_pending_stats(rfm69_pending_stats_t *pStats);
+void rfm69_get_isr_stats(rfm69_isr_stats_t *pStats);
+uint32_t rfm69_get_next_deadline(); // Milliseconds until the next retransmission or aggregation flush is due, 0 if that or a queued frame needs rfm69_tick() now, UINT32_MAX if nothing is scheduled
+uint8_t rfm69_get_tx_state(); // RFM69_TX_STATE_*
+void rfm69_get_tx_stats(rfm69_tx_stats_t *pStats);
+
+void rfm69_set_aggregation_latency(uint16_t usLatency);
+
+uint16_t rfm69_get_link_count();
+const rfm69_link_t* rfm69_get_link(uint16_t usIndex); // Node ID order, NULL past the end, pointers are only valid until the next rfm69_tick()
+const rfm69_link_t* rfm69_find_link(uint8_t ubNodeID); // NULL if the node was never seen or addressed
+uint32_t rfm69_get_link_table_size(); // Bytes allocated for the link table
+int8_t rfm69_get_noise_floor(); // dBm
+
+void rfm69_get_spi_stats(rfm69_spi_stats_t *pStats);
+
+uint8_t rfm69_set_modem_profile(uint8_t ubProfile); // Every node in the network has to be switched too, fails while a frame is being sent
+uint8_t rfm69_get_modem_profile();
+const char* rfm69_get_modem_profile_name(uint8_t ubProfile);
+
 uint32_t rfm69_get_rx_bandwidth();
 void rfm69_set_carrier(uint32_t ulCarrier);
 uint32_t rfm69_get_carrier();
@@ -3,6 +3,7 @@
 
 #include <em_device.h>
 #include <stdarg.h>
+#include <math.h>
 #include "ft6x36.h"
 #include "ili9488.h"
 #include "printf.h"
@@ -10,22 +11,88 @@
 #include "rgb565.h"
 #include "images.h"
 #include "fonts.h"
+#include "dbg.h"
+
+#define TFT_LINE_BUFFER_PIXELS  ILI9488_TFTHEIGHT // Longest line in any rotation
+
+#define TFT_BUTTON_MAX              32 // One bit per button in each touch grid cell
+#define TFT_TOUCH_GRID_CELL_SIZE    40 // Pixels
+#define TFT_TOUCH_GRID_SIZE         ((uint16_t)((ILI9488_TFTHEIGHT + TFT_TOUCH_GRID_CELL_SIZE - 1) / TFT_TOUCH_GRID_CELL_SIZE)) // Cells per side, any rotation
+
+#define TFT_GESTURE_DRAG_THRESHOLD  10 // Pixels away from the press point
+#define TFT_GESTURE_LONG_PRESS_TIME 600 // ms
+#define TFT_GESTURE_SWIPE_VELOCITY  600 // Pixels per second at lift off
+
+#define TFT_GESTURE_TAP             0
+#define TFT_GESTURE_LONG_PRESS      1
+#define TFT_GESTURE_DRAG            2
+#define TFT_GESTURE_DRAG_END        3
+#define TFT_GESTURE_SWIPE           4
+
+#define TFT_GESTURE_DIR_NONE        0
+#define TFT_GESTURE_DIR_LEFT        1
+#define TFT_GESTURE_DIR_RIGHT       2
+#define TFT_GESTURE_DIR_UP          3
+#define TFT_GESTURE_DIR_DOWN        4
+
+#define TFT_TOUCH_STATE_IDLE        0
+#define TFT_TOUCH_STATE_PRESSED     1
+#define TFT_TOUCH_STATE_LONG_PRESSED 2
+#define TFT_TOUCH_STATE_DRAGGING    3
+
+#define TFT_TERMINAL_PRINTF_BUFFER_SIZE 128 // Longer output is truncated
+
+#define TFT_FRAME_MAX_COMMANDS      1024 // Recorded primitives before an early flush
+#define TFT_FRAME_CMD_BLOCK         0
+#define TFT_FRAME_CMD_BITMAP        1
+#define TFT_FRAME_CMD_IMAGE         2
+#define TFT_FRAME_CMD_IMAGE666      3 // Pixels already in the 18 bit wire format, copied as they are
+#define TFT_FRAME_SCROLL_AREA       BIT(0)
+#define TFT_FRAME_SCROLL_START      BIT(1)
+#define TFT_TILE_SIZE               32 // Pixels, one coverage mask word per tile row
+#define TFT_TILE_GRID_SIZE          ((ILI9488_TFTHEIGHT + TFT_TILE_SIZE - 1) / TFT_TILE_SIZE) // Tiles per side, any rotation
+
+#define TFT_IMAGE_FILL_MIN_RUN      32 // Shorter runs are decoded into the line buffer instead of a DMA fill
+
+#define TFT_GLYPH_CACHE_SIZE        32768 // Bytes, entry headers included
+#define TFT_GLYPH_CACHE_BUCKETS     64 // Must be a power of 2
 
 typedef struct tft_button_t tft_button_t;
+typedef struct tft_gesture_t tft_gesture_t;
 typedef struct tft_graph_t tft_graph_t;
+typedef struct tft_chart_t tft_chart_t;
+typedef struct tft_chart_series_t tft_chart_series_t;
 typedef struct tft_textbox_t tft_textbox_t;
 typedef struct tft_terminal_t tft_terminal_t;
+typedef struct tft_frame_cmd_t tft_frame_cmd_t;
+typedef struct tft_frame_stats_t tft_frame_stats_t;
+typedef struct tft_image_stream_t tft_image_stream_t;
+typedef struct tft_glyph_cache_entry_t tft_glyph_cache_entry_t;
+typedef struct tft_glyph_cache_stats_t tft_glyph_cache_stats_t;
 typedef void (* tft_button_callback_fn_t)(uint8_t);
+typedef void (* tft_gesture_callback_fn_t)(tft_button_t *, tft_gesture_t *);
 
 struct tft_button_t
 {
     uint8_t ubID;
+    uint8_t ubSlot; // Bit in the touch grid
     uint16_t usOriginX;
     uint16_t usOriginY;
     uint16_t usWidth;
     uint16_t usHeight;
-    tft_button_t *pPrev;
-    tft_button_t *pNext;
+    tft_gesture_callback_fn_t pfCallback; // Without one, taps go to the global button callback
+};
+struct tft_gesture_t
+{
+    uint8_t ubType;
+    uint8_t ubDirection; // Swipes only
+    uint16_t usX;
+    uint16_t usY;
+    uint16_t usStartX;
+    uint16_t usStartY;
+    int16_t sVelocityX; // Pixels per second
+    int16_t sVelocityY;
+    uint32_t ulDuration; // ms since the press
 };
 struct tft_graph_t
 {
@@ -55,6 +122,30 @@ struct tft_graph_t
     rgb565_t xTextColor;
     rgb565_t xBackColor;
 };
+struct tft_chart_series_t
+{
+    int32_t lYMin; // 16.16 fixed point
+    int32_t lYScale; // Rows per unit, scaled so that (sample - min) * scale >> 32 is the row
+    rgb565_t xColor;
+};
+struct tft_chart_t
+{
+    uint16_t usX;
+    uint16_t usY;
+    uint16_t usWidth;
+    uint16_t usHeight;
+    uint16_t usSamplesPerColumn; // Min/max decimation factor
+    uint16_t usGridX; // Grid spacing in pixels, 0 disables
+    uint16_t usGridY;
+    uint16_t usCapacity; // History on screen, usWidth * usSamplesPerColumn
+    uint16_t usHead; // Next slot to be written
+    uint16_t usCount;
+    uint8_t ubNumSeries;
+    tft_chart_series_t *pSeries;
+    int32_t *plSamples; // usCapacity slots of ubNumSeries 16.16 fixed point samples
+    rgb565_t xGridColor;
+    rgb565_t xBackColor;
+};
 struct tft_textbox_t
 {
     uint16_t usX;
@@ -72,8 +163,63 @@ struct tft_textbox_t
 struct tft_terminal_t
 {
     tft_textbox_t *pTextbox;
-    char **ppszBuf;
+    char *pszBuf; // usNumLines slots of usLineSize characters, used as a ring
+    uint16_t usLineSize;
+    uint16_t usHead; // Slot of the top line
+    uint16_t usLineLen; // Characters on the bottom line
+    uint16_t usLinePixLen; // Pixels used on the bottom line
+    uint16_t usScrolled; // Lines scrolled since the last update
+    uint16_t usScrollOffset; // Hardware scroll offset, in lines
     uint8_t ubUpdatePending : 1;
+    uint8_t ubRedrawPending : 1;
+};
+struct tft_frame_cmd_t
+{
+    uint8_t ubType;
+    int16_t sX0; // Unclipped bounds, inclusive
+    int16_t sY0;
+    int16_t sX1;
+    int16_t sY1;
+    rgb565_t xColor;
+    rgb565_t xBackColor;
+    const void *pData; // 1 bpp bitmap, RGB565 pixels or wire format pixels
+};
+struct tft_frame_stats_t
+{
+    uint32_t ulFrames;
+    uint32_t ulLastBytes; // Bytes pushed to the panel by the last frame
+    uint32_t ulLastFillBytes; // Part of ulLastBytes sent as solid fills, without compositing
+    uint32_t ulLastCycles;
+    uint16_t usLastCommands;
+    uint16_t usLastTiles; // Composited, solid tiles are filled instead
+};
+struct tft_image_stream_t
+{
+    const uint8_t *pubSrc;
+    const uint8_t *pubEnd;
+    uint32_t ulRun; // Pending repeats of xPrev
+    rgb565_t xPrev;
+    rgb565_t pIndex[IMAGE_QOI565_INDEX_SIZE];
+};
+struct tft_glyph_cache_entry_t
+{
+    const font_t *pFont;
+    uint8_t ubGlyph;
+    rgb565_t xColor;
+    rgb565_t xBackColor;
+    uint32_t ulSize;
+    uint8_t *pubPixels; // Glyph box rows, packed in the 18 bit wire format
+    tft_glyph_cache_entry_t *pHashNext;
+    tft_glyph_cache_entry_t *pPrev; // LRU list, most recent first
+    tft_glyph_cache_entry_t *pNext;
+};
+struct tft_glyph_cache_stats_t
+{
+    uint32_t ulHits;
+    uint32_t ulMisses;
+    uint32_t ulEvictions;
+    uint32_t ulUsed;
+    uint16_t usEntries;
 };
 
 static inline void tft_display_on()
@@ -94,31 +240,42 @@ static inline void tft_set_invert(uint8_t ubOnOff)
     ili9488_set_invert(ubOnOff);
 }
 
-static inline void tft_fill_screen(rgb565_t xColor)
-{
-    ili9488_fill_screen(xColor);
-}
-
 void tft_init();
+void tft_tick();
 void tft_bl_init(uint32_t ulFrequency);
 void tft_bl_set(float fBrightness);
 
+void tft_frame_begin();
+void tft_frame_end();
+void tft_frame_get_stats(tft_frame_stats_t *pStats);
+
+void tft_fill_screen(rgb565_t xColor);
+
 void tft_draw_fast_v_line(uint16_t usX, uint16_t usY0, uint16_t usY1, rgb565_t xColor);
 void tft_draw_fast_h_line(uint16_t usX0, uint16_t usY0, uint16_t usX1, rgb565_t xColor);
 void tft_draw_line(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, rgb565_t xColor);
+void tft_draw_thick_line(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, uint16_t usThickness, rgb565_t xColor);
 void tft_draw_rectangle(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, rgb565_t xColor, uint8_t ubFill);
+void tft_draw_rounded_rectangle(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, uint16_t usR, rgb565_t xColor, uint8_t ubFill);
 void tft_draw_circle(uint16_t usX, uint16_t usY, uint16_t usR, rgb565_t xColor, uint8_t ubFill);
+void tft_draw_triangle(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, uint16_t usX2, uint16_t usY2, rgb565_t xColor, uint8_t ubFill);
+void tft_fill_triangle(int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1, int16_t sX2, int16_t sY2, rgb565_t xColor);
 
 void tft_draw_image(const image_t *pImage, uint16_t usX, uint16_t usY);
 void tft_draw_bitmap(const uint8_t *pubBitmap, uint16_t usX, uint16_t usY, uint16_t usW, uint16_t usH, rgb565_t xColor, rgb565_t usBackColor);
 
 uint16_t tft_get_text_height(const font_t *pFont, uint16_t usNumLines);
 
+void tft_glyph_cache_clear();
+void tft_glyph_cache_get_stats(tft_glyph_cache_stats_t *pStats);
+
 tft_button_t* tft_button_create(uint8_t ubID, uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHeight);
 void tft_button_delete(tft_button_t *pxButton);
 void tft_button_clear();
+void tft_button_set_callback(tft_button_t *pButton, tft_gesture_callback_fn_t pfFunc);
 void tft_set_button_callback(tft_button_callback_fn_t pfFunc);
-void tft_button_draw(tft_button_t *pButton, const uint8_t *pubStr, const font_t *pxFont, rgb565_t xBColor, rgb565_t xTColor);
+void tft_set_gesture_callback(tft_gesture_callback_fn_t pfFunc);
+void tft_button_draw(tft_button_t *pButton, const char *pszStr, const font_t *pxFont, rgb565_t xBColor, rgb565_t xTColor);
 
 tft_graph_t* tft_graph_create(uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHeight, float fXScaleMin, float fXScaleMax, float fXScaleInc, float fYScaleMin, float fYScaleMax, float fYScaleInc, uint8_t ubDrawLabels, const char *pszXScaleFmt, const char *pszYScaleFmt, const char *pszTitle, const char *pszXLabel, const char *pszYLabel, const font_t *pFont, rgb565_t xGridColor, rgb565_t xAxisColor, rgb565_t xDataLineColor, rgb565_t xTextColor, rgb565_t xBackColor);
 void tft_graph_delete(tft_graph_t *pxGraph);
@@ -126,6 +283,12 @@ void tft_graph_clear(tft_graph_t *pxGraph);
 void tft_graph_draw_frame(tft_graph_t *pxGraph);
 void tft_graph_draw_data(tft_graph_t *pxGraph, float *pfXData, float *pfYData, uint16_t usDataSize);
 
+tft_chart_t* tft_chart_create(uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHeight, uint16_t usSamplesPerColumn, uint8_t ubNumSeries, uint16_t usGridX, uint16_t usGridY, rgb565_t xGridColor, rgb565_t xBackColor);
+void tft_chart_delete(tft_chart_t *pChart);
+uint8_t tft_chart_set_series(tft_chart_t *pChart, uint8_t ubSeries, float fYMin, float fYMax, rgb565_t xColor);
+void tft_chart_draw(tft_chart_t *pChart);
+void tft_chart_append(tft_chart_t *pChart, const float *pfValues, uint8_t ubDraw); // Redraws the whole chart once per column, call it inside a frame
+
 uint8_t tft_draw_char(char cChar, const font_t *xFont, uint16_t usX, uint16_t usY, rgb565_t xColor, rgb565_t xBackColor);
 void tft_draw_string(char *pszStr, const font_t *pFont, uint16_t usX, uint16_t usY, rgb565_t xColor, rgb565_t xBackColor);
 void tft_printf(const font_t *pFont, uint16_t usX, uint16_t usY, rgb565_t xColor, rgb565_t usBackColor, const char* pszFmt, ...);
@@ -143,6 +306,7 @@ tft_terminal_t* tft_terminal_create(uint16_t usX, uint16_t usY, uint16_t usNumLi
 void tft_terminal_delete(tft_terminal_t *pTerminal);
 void tft_terminal_draw_string(tft_terminal_t *pTerminal, char *pszStr);
 void tft_terminal_update(tft_terminal_t *pTerminal);
+void tft_terminal_hide(tft_terminal_t *pTerminal);
 void tft_terminal_clear(tft_terminal_t *pTerminal);
 void tft_terminal_printf(tft_terminal_t *pTerminal, uint8_t ubUpdate, const char* pszFmt, ...);
 
@@ -48,6 +48,10 @@
 // Absolute value of
 #define ABS(a)      ((a) < 0 ? (-(a)) : (a))
 
+// Minimum and maximum of
+#define MIN(a, b)   ((a) < (b) ? (a) : (b))
+#define MAX(a, b)   ((a) > (b) ? (a) : (b))
+
 // Swap two variables
 #define SWAP(a, b)  do{ typeof(a) SWAP = a; a = b; b = SWAP; }while(0)
 
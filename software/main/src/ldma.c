@@ -60,6 +60,13 @@ void ldma_ch_set_isr(uint8_t ubChannel, ldma_ch_isr_t pfISR)
 
     ppfChannelISR[ubChannel] = pfISR;
 }
+void ldma_ch_set_loop_count(uint8_t ubChannel, uint8_t ubLoopCount)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    LDMA->CH[ubChannel].LOOP = ubLoopCount;
+}
 void ldma_ch_load(uint8_t ubChannel, ldma_descriptor_t *pDescriptor)
 {
     if(ubChannel >= DMA_CHAN_COUNT)
@@ -22,6 +22,9 @@
 #include "i2c.h"
 #include "rfm69.h"
 #include "radio_protocol.h"
+#include "radio_transport.h"
+#include "radio_dispatch.h"
+#include "radio_fota.h"
 #include "ws2812b.h"
 #include "bmp280.h"
 #include "ccs811.h"
@@ -40,6 +43,7 @@
 #define RADIO_NODE_ID           2
 #define RADIO_NETWORK_ID        193
 #define RADIO_AES_KEY           "TheThiccGatewayy" // Needs to be exactly 16 bytes, no zeros allowed
+#define RADIO_FOTA_IMAGE_SLOT   QSPI_FLASH_SECTOR(256) // Image size and version (one word each), image follows
 
 // Forward declarations
 static void reset() __attribute__((noreturn));
@@ -51,11 +55,17 @@ static void get_device_name(char *pszDeviceName, uint32_t ulDeviceNameSize);
 static uint16_t get_device_revision();
 
 void touch_button_callback(uint8_t ubButtonID);
+void touch_gesture_callback(tft_button_t *pButton, tft_gesture_t *pGesture);
 void mag_trigger_callback();
+void radio_ping_handler(uint8_t ubNodeID, int8_t bRSSI, const void *pvMessage);
+void radio_report_handler(uint8_t ubNodeID, int8_t bRSSI, const void *pvMessage);
+void radio_ping_response_callback(uint8_t ubNodeID, uint8_t ubCommand, const void *pvResponse);
+void radio_fota_callback(uint8_t ubNodeID, uint8_t ubSuccess);
 
 // Variables
 static uint8_t ubScreenNum = 0;
-tft_graph_t *pGraph = NULL;
+static uint64_t ullPingSent = 0;
+tft_chart_t *pChart = NULL;
 tft_terminal_t *pTerminal = NULL;
 tft_textbox_t *pTextbox = NULL;
 tft_button_t *pButtons[5] = {NULL};
@@ -247,6 +257,7 @@ int init()
 
     dbg_init(); // Init Debug module
     dbg_swo_config(BIT(0) | BIT(1), 6000000); // Init SWO channels 0 and 1 at 6 MHz
+    dbg_cycle_counter_init(); // Enable DWT cycle counter for profiling
 
     msc_init(); // Init Flash, RAM and caches
 
@@ -489,6 +500,18 @@ int main()
     DBGPRINTLN_CTX("SI7210 SN: 0x%08lX", si7210_get_serial_num());
     si7210_set_trigger_callback(mag_trigger_callback);
 
+    // Radio transport
+    radio_transport_init();
+
+    // Radio command dispatcher
+    radio_dispatch_init();
+    radio_dispatch_set_handler(RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG, radio_ping_handler);
+    radio_dispatch_set_handler(RADIO_CMD_TEMP_DATA, radio_report_handler);
+    radio_dispatch_set_handler(RADIO_CMD_BAT_DATA, radio_report_handler);
+
+    // Radio FOTA
+    radio_fota_init();
+
     // QSPI Flash info
     uint8_t ubFlashUID[8];
 
@@ -521,19 +544,36 @@ int main()
     /* - - - - - - - - TFT init - - - - - - - - -*/
     tft_init();
     tft_set_button_callback(touch_button_callback);
+    tft_set_gesture_callback(touch_gesture_callback);
     tft_bl_init(2000); // Init backlight PWM at 2 kHz
     tft_bl_set(0); // Set backlight to 0%
     tft_display_on(); // Turn display on
     tft_set_rotation(ILI9488_ROTATION_VERTICAL); // Set rotation 1 (horizontal, ribbon to the right)
+
+    ili9488_stats_t xTFTStats;
+    uint32_t ulFlushStart = DBG_CYCLE_COUNTER();
+
+    ili9488_reset_stats();
     tft_fill_screen(RGB565_BLACK); // Fill display
+    ili9488_get_stats(&xTFTStats);
+
+    uint32_t ulFlushCPU = DBG_CYCLE_COUNTER() - ulFlushStart;
+
+    ili9488_dma_wait();
+
+    DBGPRINTLN_CTX("TFT - Full frame flush: %lu cycles (%lu CPU), %lu bytes", DBG_CYCLE_COUNTER() - ulFlushStart, ulFlushCPU, xTFTStats.ulBytesSent);
 
-    pGraph = tft_graph_create(60, 30, 220, 360, 0, 30, 5, 25, 35, 0.5, 1, "%.0f", "%.2f", "Temperature", "t", "C", &xSans9pFont, RGB565_WHITE, RGB565_BLACK, RGB565_YELLOW, RGB565_BLACK, RGB565_DARKGREY);
-    if(!pGraph)
+    pChart = tft_chart_create(20, 40, 280, 360, 4, 3, 40, 36, RGB565_BLACK, RGB565_DARKGREY); // 4 s per column, the last 18 min 40 s on screen
+    if(!pChart)
     {
-        DBGPRINTLN_CTX("Could not allocate graph");
+        DBGPRINTLN_CTX("Could not allocate chart");
         while(1);
     }
 
+    tft_chart_set_series(pChart, 0, 15.f, 35.f, RGB565_YELLOW); // Temperature, C
+    tft_chart_set_series(pChart, 1, 0.f, 100.f, RGB565_CYAN); // Humidity, %RH
+    tft_chart_set_series(pChart, 2, 950.f, 1050.f, RGB565_MAGENTA); // Pressure, hPa
+
     pTerminal = tft_terminal_create(10, 10, 18, 300, &xSans9pFont, RGB565_GREEN, RGB565_BLACK);
     if(!pTerminal)
     {
@@ -593,7 +633,11 @@ int main()
     {
         /* - - - - - - - - Library Tasks - - - - - - - - -*/
         rfm69_tick();
+        radio_transport_tick();
+        radio_dispatch_tick();
+        radio_fota_tick();
         ft6x36_tick();
+        tft_tick();
         /* - - - - - - - - Library Tasks - - - - - - - - -*/
 
         /* - - - - - - - - Main Tasks - - - - - - - - -*/
@@ -612,26 +656,18 @@ int main()
 
         if(g_ullSystemTick > (ullLastTftRoutine + 1000))
         {
-            static uint8_t ubCount = 0;
+            float pfSamples[3];
 
-            switch(ubScreenNum)
-            {
-                case 1: // graph
+            pfSamples[0] = bmp280_read_temperature();
+            pfSamples[1] = si7021_read_humidity();
+            pfSamples[2] = bmp280_read_pressure();
 
-                    if(ubCount == 31)
-                    {
-                        tft_graph_clear(pGraph);
-                        tft_graph_draw_frame(pGraph);
-                        ubCount = 0;
-                    }
-
-                    float fCount = ubCount;
-                    float fTemp = bmp280_read_temperature();
+            tft_frame_begin();
 
-                    tft_graph_draw_data(pGraph, &fCount, &fTemp, 1);
+            tft_chart_append(pChart, pfSamples, ubScreenNum == 1); // Keep recording history while another screen is shown
 
-                    ubCount++;
-                    break;
+            switch(ubScreenNum)
+            {
 
                 case 2: // terminal
                     if(pTerminal->ubUpdatePending)
@@ -684,6 +720,8 @@ int main()
                     break;
             }
 
+            tft_frame_end();
+
             ullLastTftRoutine = g_ullSystemTick;
         }
 
@@ -760,6 +798,79 @@ int main()
 
             tft_terminal_printf(pTerminal, 0, "Free RAM: %lu KiB\n", get_free_ram() >> 10);
 
+            tft_glyph_cache_stats_t xGlyphStats;
+
+            tft_glyph_cache_get_stats(&xGlyphStats);
+
+            DBGPRINTLN_CTX("TFT - Glyph cache: %hu entries, %lu/%lu bytes, %lu hits, %lu misses, %lu evictions", xGlyphStats.usEntries, xGlyphStats.ulUsed, (uint32_t)TFT_GLYPH_CACHE_SIZE, xGlyphStats.ulHits, xGlyphStats.ulMisses, xGlyphStats.ulEvictions);
+
+            rfm69_pending_stats_t xPendingStats;
+
+            rfm69_get_pending_stats(&xPendingStats);
+
+            DBGPRINTLN_CTX("RFM69 - Pending: %hu/%hu (peak %hu), ACK %hu, REL %hu, RELACK %hu, %lu alloc failures", xPendingStats.usUsed, xPendingStats.usCapacity, xPendingStats.usPeakUsed, xPendingStats.pusStateCount[RFM69_PENDING_STATE_ACK], xPendingStats.pusStateCount[RFM69_PENDING_STATE_REL], xPendingStats.pusStateCount[RFM69_PENDING_STATE_RELACK], xPendingStats.ulAllocFailures);
+            DBGPRINTLN_CTX("RFM69 - Timer: %lu expirations, %lu cascades, next deadline in %lu ms", xPendingStats.ulTimerExpirations, xPendingStats.ulTimerCascades, rfm69_get_next_deadline());
+
+            rfm69_tx_stats_t xTXStats;
+
+            rfm69_get_tx_stats(&xTXStats);
+
+            DBGPRINTLN_CTX("RFM69 - TX: %lu messages (%lu aggregated into %lu frames, %lu stalled flushes), %lu frames, %lu ms airtime", xTXStats.ulMessages, xTXStats.ulAggregatedMessages, xTXStats.ulAggregatedFrames, xTXStats.ulAggregationStalls, xTXStats.ulFrames, xTXStats.ulAirtime);
+
+            DBGPRINTLN_CTX("RFM69 - CSMA: %lu busy assessments, %lu frames given up", xTXStats.ulCSMABusy, xTXStats.ulCSMAFailures);
+
+            if(xTXStats.ulMessages)
+                DBGPRINTLN_CTX("RFM69 - TX: %lu us airtime per message, %.2f messages/s", (uint32_t)((uint64_t)xTXStats.ulAirtime * 1000 / xTXStats.ulMessages), (float)xTXStats.ulMessages * 1000.f / g_ullSystemTick);
+
+            DBGPRINTLN_CTX("RFM69 - Links: %hu nodes in %lu bytes, noise floor %hhd dBm", rfm69_get_link_count(), rfm69_get_link_table_size(), rfm69_get_noise_floor());
+
+            for(uint16_t i = 0; i < rfm69_get_link_count(); i++)
+            {
+                const rfm69_link_t *pLink = rfm69_get_link(i);
+
+                DBGPRINTLN_CTX("RFM69 - Node %hhu: TX %hhd dBm, RSSI %.1f dBm (SNR %hhd dB, remote %hhd dBm), %lu received (at most %lu lost by ID gaps, %lu duplicates), %lu sent (%lu retries, %lu failed), seen %lu ms ago", pLink->ubNodeID, pLink->bPowerLevel, (float)pLink->sRSSIAverage / 16.f, pLink->bSNR, pLink->bRemoteRSSI, pLink->ulRXPackets, pLink->ulRXIDGaps, pLink->ulRXDuplicates, pLink->ulTXPackets, pLink->ulTXRetries, pLink->ulTXFailures, pLink->ullLastSeen ? (uint32_t)(g_ullSystemTick - pLink->ullLastSeen) : 0);
+
+                if(pLink->bTargetRSSI && pLink->ulTXPackets)
+                    DBGPRINTLN_CTX("RFM69 - Node %hhu ATC: target %hhd dBm, average TX %.1f dBm, %s (%lu ms)", pLink->ubNodeID, pLink->bTargetRSSI, (float)pLink->lTXPowerSum / pLink->ulTXPackets, pLink->ubATCConverged ? "converged" : "converging", pLink->ubATCConverged ? pLink->ulATCConvergenceTime : (uint32_t)(g_ullSystemTick - pLink->ullATCDisturbance));
+            }
+
+            rfm69_isr_stats_t xISRStats;
+
+            rfm69_get_isr_stats(&xISRStats);
+
+            radio_transport_stats_t xTransportStats;
+
+            radio_transport_get_stats(&xTransportStats);
+
+            DBGPRINTLN_CTX("Radio transport - %lu sent, %lu failed, %lu received, %lu fragments (%lu resent), %lu evictions", xTransportStats.ulMessagesSent, xTransportStats.ulMessagesFailed, xTransportStats.ulMessagesReceived, xTransportStats.ulFragmentsSent, xTransportStats.ulFragmentsResent, xTransportStats.ulEvictions);
+
+            rfm69_spi_stats_t xSPIStats;
+
+            rfm69_get_spi_stats(&xSPIStats);
+
+            DBGPRINTLN_CTX("RFM69 - SPI: %lu transactions (%lu bytes), %lu shadow hits, %lu writes elided, modem profile %s", xSPIStats.ulTransactions, xSPIStats.ulBytes, xSPIStats.ulShadowHits, xSPIStats.ulElidedWrites, rfm69_get_modem_profile_name(rfm69_get_modem_profile()));
+            DBGPRINTLN_CTX("RFM69 - ISR: %lu drains (%lu bytes, %lu errors, %lu inline for %lu cycles), masked %lu cycles (max %lu)", xISRStats.ulDrains, xISRStats.ulDrainedBytes, xISRStats.ulDrainErrors, xISRStats.ulInlineFinishes, xISRStats.ulInlineFinishCycles, xISRStats.ulLastMaskedCycles, xISRStats.ulMaxMaskedCycles);
+
+            radio_dispatch_stats_t xDispatchStats;
+
+            radio_dispatch_get_stats(&xDispatchStats);
+
+            DBGPRINTLN_CTX("Radio dispatch - %lu dispatched, %lu unhandled, %lu malformed, %lu requests, %lu responses, %lu timeouts", xDispatchStats.ulDispatched, xDispatchStats.ulUnhandled, xDispatchStats.ulMalformed, xDispatchStats.ulRequests, xDispatchStats.ulResponses, xDispatchStats.ulTimeouts);
+
+            radio_fota_stats_t xFOTAStats;
+
+            radio_fota_get_stats(&xFOTAStats);
+
+            if(xFOTAStats.ubState != RADIO_FOTA_STATE_IDLE)
+                DBGPRINTLN_CTX("Radio FOTA - node %hhu, %lu/%lu bytes, %lu B/s, %lu chunks (%lu resent), %lu ACKs, %lu timeouts", xFOTAStats.ubNodeID, xFOTAStats.ulAckedBytes, xFOTAStats.ulImageSize, xFOTAStats.ulElapsed ? (uint32_t)((uint64_t)xFOTAStats.ulAckedBytes * 1000 / xFOTAStats.ulElapsed) : 0, xFOTAStats.ulChunksSent, xFOTAStats.ulChunksResent, xFOTAStats.ulAcks, xFOTAStats.ulTimeouts);
+
+            radio_cmd_ping_req_t xPing;
+
+            xPing.ubCommand = RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG;
+
+            if(radio_dispatch_request(RADIO_NODE_ID, &xPing, 0, radio_ping_response_callback))
+                ullPingSent = g_ullSystemTick;
+
             play_sound(2700, 10);
 
             ullLastSwoPrint = g_ullSystemTick;
@@ -784,6 +895,15 @@ int main()
         if(BTN_2_STATE() && (ubLastBtn2State != 1))
         {
             ubLastBtn2State = 1;
+
+            const uint32_t *pulImageInfo = (const uint32_t *)(QSPI0_MEM_BASE + RADIO_FOTA_IMAGE_SLOT);
+
+            if(radio_fota_busy())
+                radio_fota_abort();
+            else if(pulImageInfo[0] != 0xFFFFFFFF && radio_fota_start(RADIO_NODE_ID, RADIO_FOTA_IMAGE_SLOT + 8, pulImageInfo[0], pulImageInfo[1], radio_fota_callback))
+                DBGPRINTLN_CTX("Radio FOTA to node %hhu started (%lu bytes, version %lu)", RADIO_NODE_ID, pulImageInfo[0], pulImageInfo[1]);
+            else
+                DBGPRINTLN_CTX("Radio FOTA to node %hhu could not be started", RADIO_NODE_ID);
         }
         else if(!BTN_2_STATE() && (ubLastBtn2State != 0))
         {
@@ -793,6 +913,16 @@ int main()
         if(BTN_3_STATE() && (ubLastBtn3State != 1))
         {
             ubLastBtn3State = 1;
+
+            uint8_t ubProfile = rfm69_get_modem_profile() + 1;
+
+            if(ubProfile >= RFM69_MODEM_PROFILE_COUNT)
+                ubProfile = 0;
+
+            if(rfm69_set_modem_profile(ubProfile))
+                DBGPRINTLN_CTX("RFM69 - Modem profile %s, %lu bps, %lu Hz deviation, %lu Hz RX bandwidth", rfm69_get_modem_profile_name(ubProfile), rfm69_get_bit_rate(), rfm69_get_deviation(), rfm69_get_rx_bandwidth());
+            else
+                DBGPRINTLN_CTX("RFM69 - Modem profile %s could not be applied", rfm69_get_modem_profile_name(ubProfile));
         }
         else if(!BTN_3_STATE() && (ubLastBtn3State != 0))
         {
@@ -831,6 +961,15 @@ int main()
             ubLastBtn3State = 0;
         }
         /* - - - - - - - - Button Routines - - - - - - - - -*/
+
+        /* - - - - - - - - Idle - - - - - - - - -*/
+        if(rfm69_get_next_deadline())
+        {
+            SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk; // EM1, SysTick keeps running and wakes us up within 1 ms
+
+            __WFI(); // Nothing due in the radio before the next interrupt
+        }
+        /* - - - - - - - - Idle - - - - - - - - -*/
     }
 
     return 0;
@@ -838,6 +977,11 @@ int main()
 
 void touch_button_callback(uint8_t ubButtonID)
 {
+    if(ubScreenNum == 2 && ubButtonID != 2)
+        tft_terminal_hide(pTerminal); // Give the scroll area back before another screen is drawn
+
+    tft_frame_begin();
+
     switch(ubButtonID)
     {
         case 0: // image
@@ -866,7 +1010,10 @@ void touch_button_callback(uint8_t ubButtonID)
             {
                 ubScreenNum = 1;
                 tft_fill_screen(RGB565_DARKGREY);
-                tft_graph_draw_frame(pGraph);
+                tft_printf(&xSans9pFont, 20, 10, RGB565_YELLOW, RGB565_DARKGREY, "15-35 C");
+                tft_printf(&xSans9pFont, 110, 10, RGB565_CYAN, RGB565_DARKGREY, "0-100 %%RH");
+                tft_printf(&xSans9pFont, 205, 10, RGB565_MAGENTA, RGB565_DARKGREY, "950-1050 hPa");
+                tft_chart_draw(pChart);
                 tft_button_draw(pButtons[0], "img", &xSans9pFont, RGB565_CYAN, RGB565_BLACK);
                 tft_button_draw(pButtons[1], "grph", &xSans9pFont, RGB565_CYAN, RGB565_BLACK);
                 tft_button_draw(pButtons[2], "trm", &xSans9pFont, RGB565_CYAN, RGB565_BLACK);
@@ -926,9 +1073,110 @@ void touch_button_callback(uint8_t ubButtonID)
             DBGPRINTLN_CTX("Sum Ting Wong");
             break;
     }
+
+    tft_frame_end();
+
+    tft_frame_stats_t xFrameStats;
+
+    tft_frame_get_stats(&xFrameStats);
+
+    DBGPRINTLN_CTX("TFT - Frame: %hu commands, %hu tiles, %lu bytes (%lu filled), %lu cycles", xFrameStats.usLastCommands, xFrameStats.usLastTiles, xFrameStats.ulLastBytes, xFrameStats.ulLastFillBytes, xFrameStats.ulLastCycles);
+}
+void touch_gesture_callback(tft_button_t *pButton, tft_gesture_t *pGesture)
+{
+    static uint8_t ubDrawing = 0;
+    static uint16_t usLastX, usLastY;
+
+    switch(pGesture->ubType)
+    {
+        case TFT_GESTURE_DRAG:
+            if(ubScreenNum != 4 || pButton) // Scribble on the blank screen only
+                break;
+
+            if(!ubDrawing)
+            {
+                usLastX = pGesture->usStartX;
+                usLastY = pGesture->usStartY;
+                ubDrawing = 1;
+            }
+
+            tft_draw_line(usLastX, usLastY, pGesture->usX, pGesture->usY, RGB565_YELLOW);
+
+            usLastX = pGesture->usX;
+            usLastY = pGesture->usY;
+            break;
+
+        case TFT_GESTURE_DRAG_END:
+            ubDrawing = 0;
+            break;
+
+        case TFT_GESTURE_SWIPE:
+            ubDrawing = 0;
+
+            if(ubScreenNum == 4) // Swipes end scribbles there
+                break;
+
+            if(pGesture->ubDirection == TFT_GESTURE_DIR_LEFT)
+                touch_button_callback((ubScreenNum + 1) % 5);
+            else if(pGesture->ubDirection == TFT_GESTURE_DIR_RIGHT)
+                touch_button_callback((ubScreenNum + 4) % 5);
+            break;
+
+        default:
+            break;
+    }
 }
 void mag_trigger_callback()
 {
     DBGPRINTLN_CTX("Mag Switch Triggered!");
     DBGPRINTLN_CTX("SI7210 Field: %.5f mT", si7210_read_mag_field());
-}
\ No newline at end of file
+}
+void radio_ping_handler(uint8_t ubNodeID, int8_t bRSSI, const void *pvMessage)
+{
+    radio_cmd_ping_res_t xPong;
+
+    xPong.ubCommand = RADIO_CMD_PING;
+
+    radio_dispatch_send(ubNodeID, &xPong);
+
+    DBGPRINTLN_CTX("Radio ping from node %hhu (%hhd dBm)", ubNodeID, bRSSI);
+}
+void radio_report_handler(uint8_t ubNodeID, int8_t bRSSI, const void *pvMessage)
+{
+    switch(*(const uint8_t *)pvMessage)
+    {
+        case RADIO_CMD_TEMP_DATA:
+        {
+            const radio_cmd_temp_data_res_t *pTemp = (const radio_cmd_temp_data_res_t *)pvMessage;
+
+            DBGPRINTLN_CTX("Radio node %hhu (%hhd dBm) water temperature: %.2f C", ubNodeID, bRSSI, (float)pTemp->sWaterTemp / 100.f);
+        }
+        break;
+        case RADIO_CMD_BAT_DATA:
+        {
+            const radio_cmd_bat_data_res_t *pBat = (const radio_cmd_bat_data_res_t *)pvMessage;
+
+            DBGPRINTLN_CTX("Radio node %hhu (%hhd dBm) battery: %hu mV%s%s%s", ubNodeID, bRSSI, pBat->usBatteryVoltage, pBat->ubChargerDetected ? ", charger detected" : "", pBat->ubChargerTerminated ? ", charge terminated" : "", pBat->ubBatteryLow ? ", low" : "");
+        }
+        break;
+    }
+}
+void radio_ping_response_callback(uint8_t ubNodeID, uint8_t ubCommand, const void *pvResponse)
+{
+    if(!pvResponse)
+    {
+        DBGPRINTLN_CTX("Radio ping to node %hhu timed out", ubNodeID);
+
+        return;
+    }
+
+    DBGPRINTLN_CTX("Radio ping to node %hhu: %lu ms", ubNodeID, (uint32_t)(g_ullSystemTick - ullPingSent));
+}
+void radio_fota_callback(uint8_t ubNodeID, uint8_t ubSuccess)
+{
+    radio_fota_stats_t xFOTAStats;
+
+    radio_fota_get_stats(&xFOTAStats);
+
+    DBGPRINTLN_CTX("Radio FOTA to node %hhu %s after %lu ms (%lu chunks, %lu resent, %lu hash mismatches)", ubNodeID, ubSuccess ? "done" : "failed", xFOTAStats.ulElapsed, xFOTAStats.ulChunksSent, xFOTAStats.ulChunksResent, xFOTAStats.ulHashMismatches);
+}
@@ -0,0 +1,238 @@
+#include "radio_dispatch.h"
+
+static radio_dispatch_entry_t pDispatchTable[256]; // Indexed by the command byte, request flag included
+static radio_dispatch_request_t pRequestSlab[RADIO_DISPATCH_REQUEST_SLOTS];
+static radio_dispatch_request_t *pRequestBuckets[RADIO_DISPATCH_REQUEST_BUCKETS];
+static radio_dispatch_request_t *pRequestFree = NULL;
+static uint64_t ullNextDeadline = UINT64_MAX;
+static radio_dispatch_stats_t xStats;
+
+static inline uint8_t radio_dispatch_request_hash(uint8_t ubNodeID, uint8_t ubCommand)
+{
+    return (ubNodeID ^ (ubNodeID >> 4) ^ ((uint8_t)(ubCommand << 2))) & (RADIO_DISPATCH_REQUEST_BUCKETS - 1);
+}
+static radio_dispatch_request_t* radio_dispatch_find_request(uint8_t ubNodeID, uint8_t ubCommand)
+{
+    radio_dispatch_request_t *pRequest = pRequestBuckets[radio_dispatch_request_hash(ubNodeID, ubCommand)];
+
+    while(pRequest)
+    {
+        if(pRequest->ubNodeID == ubNodeID && pRequest->ubCommand == ubCommand)
+            return pRequest;
+
+        pRequest = pRequest->pNext;
+    }
+
+    return NULL;
+}
+static radio_dispatch_request_t* radio_dispatch_add_request(uint8_t ubNodeID, uint8_t ubCommand, uint16_t usTimeout, radio_dispatch_response_fn_t pfCallback)
+{
+    radio_dispatch_request_t *pRequest = pRequestFree;
+
+    if(!pRequest)
+        return NULL;
+
+    pRequestFree = pRequest->pNext;
+
+    pRequest->ubUsed = 1;
+    pRequest->ubNodeID = ubNodeID;
+    pRequest->ubCommand = ubCommand;
+    pRequest->ullDeadline = g_ullSystemTick + usTimeout;
+    pRequest->pfCallback = pfCallback;
+
+    // Insert at the head of the bucket
+    radio_dispatch_request_t **ppBucket = &pRequestBuckets[radio_dispatch_request_hash(ubNodeID, ubCommand)];
+
+    pRequest->pNext = *ppBucket;
+    pRequest->pPrev = NULL;
+
+    if(*ppBucket)
+        (*ppBucket)->pPrev = pRequest;
+
+    *ppBucket = pRequest;
+
+    if(pRequest->ullDeadline < ullNextDeadline)
+        ullNextDeadline = pRequest->ullDeadline;
+
+    return pRequest;
+}
+static void radio_dispatch_remove_request(radio_dispatch_request_t *pRequest)
+{
+    if(!pRequest || !pRequest->ubUsed)
+        return;
+
+    radio_dispatch_request_t **ppBucket = &pRequestBuckets[radio_dispatch_request_hash(pRequest->ubNodeID, pRequest->ubCommand)];
+
+    if(*ppBucket == pRequest)
+        *ppBucket = pRequest->pNext;
+
+    if(pRequest->pPrev)
+        pRequest->pPrev->pNext = pRequest->pNext;
+
+    if(pRequest->pNext)
+        pRequest->pNext->pPrev = pRequest->pPrev;
+
+    pRequest->ubUsed = 0;
+    pRequest->pNext = pRequestFree;
+
+    pRequestFree = pRequest;
+}
+
+static void radio_dispatch_rx_callback(uint8_t ubNodeID, int8_t bRSSI, const uint8_t *pubData, uint16_t usSize)
+{
+    if(!pubData || !usSize)
+        return;
+
+    uint32_t pulMessage[RADIO_DISPATCH_MAX_MESSAGE_SIZE / sizeof(uint32_t)]; // Word aligned for the decoded struct
+    const radio_dispatch_entry_t *pEntry = &pDispatchTable[pubData[0]];
+
+    if(usSize > 0xFF || !radio_protocol_decode_message(pEntry->pMessage, pulMessage, sizeof(pulMessage), pubData, usSize))
+    {
+        xStats.ulMalformed++;
+
+        return;
+    }
+
+    if(!(pubData[0] & RADIO_CMD_REQUEST_FLAG))
+    {
+        radio_dispatch_request_t *pRequest = radio_dispatch_find_request(ubNodeID, pubData[0] | RADIO_CMD_REQUEST_FLAG);
+
+        if(pRequest)
+        {
+            radio_dispatch_response_fn_t pfCallback = pRequest->pfCallback;
+
+            radio_dispatch_remove_request(pRequest); // Free before the callback so it can issue the next request right away
+
+            xStats.ulResponses++;
+
+            if(pfCallback)
+                pfCallback(ubNodeID, pubData[0] | RADIO_CMD_REQUEST_FLAG, pulMessage);
+
+            return;
+        }
+    }
+
+    // Requests, unsolicited reports and late responses
+    if(!pEntry->pfHandler)
+    {
+        xStats.ulUnhandled++;
+
+        return;
+    }
+
+    xStats.ulDispatched++;
+
+    pEntry->pfHandler(ubNodeID, bRSSI, pulMessage);
+}
+
+void radio_dispatch_init()
+{
+    memset(pRequestBuckets, 0, sizeof(pRequestBuckets));
+    memset(&xStats, 0, sizeof(radio_dispatch_stats_t));
+
+    for(uint16_t i = 0; i < 256; i++)
+    {
+        pDispatchTable[i].pMessage = radio_protocol_get_message(i);
+        pDispatchTable[i].pfHandler = NULL;
+    }
+
+    pRequestFree = NULL;
+    ullNextDeadline = UINT64_MAX;
+
+    for(uint8_t i = RADIO_DISPATCH_REQUEST_SLOTS; i--;)
+    {
+        pRequestSlab[i].ubUsed = 0;
+        pRequestSlab[i].pNext = pRequestFree;
+
+        pRequestFree = &pRequestSlab[i];
+    }
+
+    radio_transport_set_rx_callback(radio_dispatch_rx_callback);
+}
+void radio_dispatch_tick()
+{
+    if(g_ullSystemTick < ullNextDeadline)
+        return;
+
+    ullNextDeadline = UINT64_MAX;
+
+    for(uint8_t i = 0; i < RADIO_DISPATCH_REQUEST_SLOTS; i++)
+    {
+        radio_dispatch_request_t *pRequest = &pRequestSlab[i];
+
+        if(!pRequest->ubUsed)
+            continue;
+
+        if(g_ullSystemTick < pRequest->ullDeadline)
+        {
+            if(pRequest->ullDeadline < ullNextDeadline)
+                ullNextDeadline = pRequest->ullDeadline;
+
+            continue;
+        }
+
+        radio_dispatch_response_fn_t pfCallback = pRequest->pfCallback;
+        uint8_t ubNodeID = pRequest->ubNodeID;
+        uint8_t ubCommand = pRequest->ubCommand;
+
+        radio_dispatch_remove_request(pRequest);
+
+        xStats.ulTimeouts++;
+
+        if(pfCallback)
+            pfCallback(ubNodeID, ubCommand, NULL); // May add a request, add_request keeps ullNextDeadline up to date
+    }
+}
+
+void radio_dispatch_set_handler(uint8_t ubCommand, radio_dispatch_handler_fn_t pfFunc)
+{
+    pDispatchTable[ubCommand].pfHandler = pfFunc;
+}
+
+uint8_t radio_dispatch_send(uint8_t ubNodeID, const void *pvMessage)
+{
+    uint8_t pubBuffer[RFM69_MAX_DATA_SIZE];
+    uint8_t ubSize = radio_protocol_encode(pvMessage, pubBuffer, RFM69_MAX_DATA_SIZE);
+
+    if(!ubSize)
+        return 0;
+
+    return !!rfm69_send(ubNodeID, pubBuffer, ubSize, 0, 0, 0); // Every layout fits in one frame, transport fragments are not worth it
+}
+uint8_t radio_dispatch_request(uint8_t ubNodeID, const void *pvRequest, uint16_t usTimeout, radio_dispatch_response_fn_t pfCallback)
+{
+    if(!pvRequest)
+        return 0;
+
+    uint8_t ubCommand = *(const uint8_t *)pvRequest;
+
+    if(!(ubCommand & RADIO_CMD_REQUEST_FLAG))
+        return 0;
+
+    if(radio_dispatch_find_request(ubNodeID, ubCommand))
+        return 0; // Responses carry no sequence number, a second one in flight could not be told apart
+
+    radio_dispatch_request_t *pRequest = radio_dispatch_add_request(ubNodeID, ubCommand, usTimeout ? usTimeout : RADIO_DISPATCH_DEFAULT_TIMEOUT, pfCallback);
+
+    if(!pRequest)
+        return 0;
+
+    if(!radio_dispatch_send(ubNodeID, pvRequest))
+    {
+        radio_dispatch_remove_request(pRequest);
+
+        return 0;
+    }
+
+    xStats.ulRequests++;
+
+    return 1;
+}
+
+void radio_dispatch_get_stats(radio_dispatch_stats_t *pStats)
+{
+    if(!pStats)
+        return;
+
+    memcpy(pStats, &xStats, sizeof(radio_dispatch_stats_t));
+}
@@ -0,0 +1,312 @@
+#include "radio_fota.h"
+
+static radio_fota_session_t xSession;
+static radio_fota_stats_t xStats;
+
+static inline uint32_t radio_fota_shift_mask(uint32_t ulMask, uint32_t ulShift)
+{
+    return ulShift >= 32 ? 0 : ulMask >> ulShift;
+}
+static inline uint32_t radio_fota_window_mask()
+{
+    // Chunks from ulBase that exist in the image, capped to the window
+    uint32_t ulChunks = (xSession.ulImageSize - xSession.ulBase + RADIO_PROTOCOL_FOTA_CHUNK_SIZE - 1) / RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+
+    if(ulChunks > RADIO_FOTA_WINDOW_CHUNKS)
+        ulChunks = RADIO_FOTA_WINDOW_CHUNKS;
+
+    return ulChunks >= 32 ? 0xFFFFFFFF : (1UL << ulChunks) - 1;
+}
+static void radio_fota_reset_window(uint32_t ulOffset)
+{
+    xSession.ulBase = ulOffset;
+    xSession.ulSentMask = 0;
+    xSession.ulAckedMask = 0;
+    xSession.ulResentMask = 0;
+    xSession.ubNextNew = 0;
+    xSession.ubRetries = 0;
+    xSession.ullLastProgress = g_ullSystemTick;
+}
+static void radio_fota_finish(uint8_t ubSuccess)
+{
+    uint8_t ubNodeID = xSession.ubNodeID;
+    radio_fota_callback_fn_t pfCallback = xSession.pfCallback;
+
+    xSession.ubState = RADIO_FOTA_STATE_IDLE;
+
+    if(pfCallback)
+        pfCallback(ubNodeID, ubSuccess);
+}
+static uint8_t radio_fota_request_timeout()
+{
+    xStats.ulTimeouts++;
+
+    if(++xSession.ubRetries <= RADIO_FOTA_MAX_RETRIES)
+        return 0;
+
+    radio_fota_finish(0);
+
+    return 1;
+}
+
+static void radio_fota_begin_callback(uint8_t ubNodeID, uint8_t ubCommand, const void *pvResponse)
+{
+    if(xSession.ubState != RADIO_FOTA_STATE_BEGIN || ubNodeID != xSession.ubNodeID)
+        return;
+
+    xSession.ubRequestPending = 0;
+
+    if(!pvResponse)
+    {
+        radio_fota_request_timeout();
+
+        return;
+    }
+
+    uint32_t ulOffset = ((const radio_cmd_fota_begin_res_t *)pvResponse)->ulOffset;
+
+    if(ulOffset > xSession.ulImageSize || (ulOffset < xSession.ulImageSize && (ulOffset % RADIO_PROTOCOL_FOTA_CHUNK_SIZE)))
+        ulOffset = 0; // Not something we would have acknowledged, start over
+
+    radio_fota_reset_window(ulOffset);
+
+    xSession.ubState = ulOffset == xSession.ulImageSize ? RADIO_FOTA_STATE_END : RADIO_FOTA_STATE_TRANSFER;
+}
+static void radio_fota_end_callback(uint8_t ubNodeID, uint8_t ubCommand, const void *pvResponse)
+{
+    if(xSession.ubState != RADIO_FOTA_STATE_END || ubNodeID != xSession.ubNodeID)
+        return;
+
+    xSession.ubRequestPending = 0;
+
+    if(!pvResponse)
+    {
+        radio_fota_request_timeout();
+
+        return;
+    }
+
+    switch(((const radio_cmd_fota_end_res_t *)pvResponse)->ubStatus)
+    {
+        case RADIO_FOTA_STATUS_OK:
+            radio_fota_finish(1);
+        break;
+        case RADIO_FOTA_STATUS_HASH_MISMATCH:
+        {
+            xStats.ulHashMismatches++;
+
+            if(++xSession.ubRestarts > RADIO_FOTA_MAX_RESTARTS)
+            {
+                radio_fota_finish(0);
+
+                break;
+            }
+
+            xSession.ubRetries = 0;
+            xSession.ubState = RADIO_FOTA_STATE_BEGIN; // The node dropped the image, it resumes from 0
+        }
+        break;
+        default:
+            radio_fota_finish(0);
+        break;
+    }
+}
+static void radio_fota_ack_handler(uint8_t ubNodeID, int8_t bRSSI, const void *pvMessage)
+{
+    if(xSession.ubState != RADIO_FOTA_STATE_TRANSFER || ubNodeID != xSession.ubNodeID)
+        return;
+
+    const radio_cmd_fota_send_chunk_res_t *pACK = (const radio_cmd_fota_send_chunk_res_t *)pvMessage;
+
+    xStats.ulAcks++;
+
+    if(pACK->ulOffset < xSession.ulBase || pACK->ulOffset > xSession.ulImageSize)
+        return; // Stale or bogus
+
+    uint8_t ubProgress = 0;
+    uint32_t ulShift = (pACK->ulOffset - xSession.ulBase + RADIO_PROTOCOL_FOTA_CHUNK_SIZE - 1) / RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+
+    if(ulShift)
+    {
+        xSession.ulBase = pACK->ulOffset;
+        xSession.ulSentMask = radio_fota_shift_mask(xSession.ulSentMask, ulShift);
+        xSession.ulAckedMask = radio_fota_shift_mask(xSession.ulAckedMask, ulShift);
+        xSession.ulResentMask = radio_fota_shift_mask(xSession.ulResentMask, ulShift);
+        xSession.ubNextNew = ulShift >= xSession.ubNextNew ? 0 : xSession.ubNextNew - ulShift;
+
+        ubProgress = 1;
+    }
+
+    if(xSession.ulBase >= xSession.ulImageSize)
+    {
+        xSession.ubRetries = 0;
+        xSession.ubState = RADIO_FOTA_STATE_END;
+
+        return;
+    }
+
+    uint32_t ulReceived = pACK->ulReceivedMask & radio_fota_window_mask();
+
+    if(ulReceived & ~xSession.ulAckedMask)
+        ubProgress = 1;
+
+    xSession.ulAckedMask |= ulReceived;
+    xSession.ulSentMask |= ulReceived;
+
+    if(ubProgress)
+    {
+        xSession.ubRetries = 0;
+        xSession.ullLastProgress = g_ullSystemTick;
+    }
+
+    if(!xSession.ulAckedMask)
+        return;
+
+    // Chunks sent before the highest one the node has are lost, send them again once without waiting for the timeout
+    uint32_t ulBelow = (1UL << (31 - __builtin_clz(xSession.ulAckedMask))) - 1;
+    uint32_t ulHoles = ulBelow & xSession.ulSentMask & ~xSession.ulAckedMask & ~xSession.ulResentMask;
+
+    xSession.ulSentMask &= ~ulHoles;
+    xSession.ulResentMask |= ulHoles;
+}
+
+static void radio_fota_send_chunks()
+{
+    if(g_ullSystemTick - xSession.ullLastProgress >= RADIO_FOTA_ACK_TIMEOUT)
+    {
+        if(radio_fota_request_timeout())
+            return;
+
+        // Go back to the last acknowledged offset
+        xSession.ulSentMask = xSession.ulAckedMask;
+        xSession.ulResentMask = 0;
+        xSession.ullLastProgress = g_ullSystemTick;
+    }
+
+    uint32_t ulWindowMask = radio_fota_window_mask();
+
+    for(uint8_t i = 0; i < RADIO_FOTA_CHUNKS_PER_TICK; i++)
+    {
+        uint32_t ulUnsent = ulWindowMask & ~xSession.ulSentMask;
+
+        if(!ulUnsent)
+            return;
+
+        uint8_t ubChunk = __builtin_ctz(ulUnsent);
+        radio_cmd_fota_send_chunk_req_t xChunk;
+
+        xChunk.ubCommand = RADIO_CMD_FOTA_SEND_CHUNK | RADIO_CMD_REQUEST_FLAG;
+        xChunk.ulOffset = xSession.ulBase + (uint32_t)ubChunk * RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+        xChunk.ubDataSize = xSession.ulImageSize - xChunk.ulOffset < RADIO_PROTOCOL_FOTA_CHUNK_SIZE ? xSession.ulImageSize - xChunk.ulOffset : RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+
+        memcpy(xChunk.pubData, (const uint8_t *)QSPI0_MEM_BASE + xSession.ulImageAddress + xChunk.ulOffset, xChunk.ubDataSize);
+
+        if(!radio_dispatch_send(xSession.ubNodeID, &xChunk))
+            return; // TX queue full, try again on the next tick
+
+        xSession.ulSentMask |= BIT(ubChunk);
+
+        xStats.ulChunksSent++;
+
+        if(ubChunk < xSession.ubNextNew)
+            xStats.ulChunksResent++;
+        else
+            xSession.ubNextNew = ubChunk + 1;
+    }
+}
+
+void radio_fota_init()
+{
+    memset(&xSession, 0, sizeof(radio_fota_session_t));
+    memset(&xStats, 0, sizeof(radio_fota_stats_t));
+
+    radio_dispatch_set_handler(RADIO_CMD_FOTA_SEND_CHUNK, radio_fota_ack_handler);
+}
+void radio_fota_tick()
+{
+    switch(xSession.ubState)
+    {
+        case RADIO_FOTA_STATE_BEGIN:
+        {
+            if(xSession.ubRequestPending)
+                break;
+
+            radio_cmd_fota_begin_req_t xBegin;
+
+            xBegin.ubCommand = RADIO_CMD_FOTA_BEGIN | RADIO_CMD_REQUEST_FLAG;
+            xBegin.ulVersion = xSession.ulVersion;
+            xBegin.ulImageSize = xSession.ulImageSize;
+
+            xSession.ubRequestPending = radio_dispatch_request(xSession.ubNodeID, &xBegin, RADIO_FOTA_REQUEST_TIMEOUT, radio_fota_begin_callback);
+        }
+        break;
+        case RADIO_FOTA_STATE_TRANSFER:
+            radio_fota_send_chunks();
+        break;
+        case RADIO_FOTA_STATE_END:
+        {
+            if(xSession.ubRequestPending)
+                break;
+
+            radio_cmd_fota_end_req_t xEnd;
+
+            xEnd.ubCommand = RADIO_CMD_FOTA_END | RADIO_CMD_REQUEST_FLAG;
+            xEnd.ubDigestSize = RADIO_PROTOCOL_FOTA_DIGEST_SIZE;
+
+            memcpy(xEnd.pubDigest, xSession.pubDigest, RADIO_PROTOCOL_FOTA_DIGEST_SIZE);
+
+            xSession.ubRequestPending = radio_dispatch_request(xSession.ubNodeID, &xEnd, RADIO_FOTA_REQUEST_TIMEOUT, radio_fota_end_callback);
+        }
+        break;
+    }
+}
+
+uint8_t radio_fota_start(uint8_t ubNodeID, uint32_t ulImageAddress, uint32_t ulImageSize, uint32_t ulVersion, radio_fota_callback_fn_t pfCallback)
+{
+    if(xSession.ubState != RADIO_FOTA_STATE_IDLE)
+        return 0;
+
+    if(!ulImageSize || ulImageAddress > QSPI_FLASH_SIZE || ulImageSize > QSPI_FLASH_SIZE - ulImageAddress)
+        return 0;
+
+    if(ulImageAddress & 3)
+        return 0; // The SHA engine reads words
+
+    memset(&xSession, 0, sizeof(radio_fota_session_t));
+    memset(&xStats, 0, sizeof(radio_fota_stats_t));
+
+    xSession.ubNodeID = ubNodeID;
+    xSession.ulImageAddress = ulImageAddress;
+    xSession.ulImageSize = ulImageSize;
+    xSession.ulVersion = ulVersion;
+    xSession.pfCallback = pfCallback;
+    xSession.ullStart = g_ullSystemTick;
+
+    crypto_sha256((uint8_t *)QSPI0_MEM_BASE + ulImageAddress, ulImageSize, xSession.pubDigest); // Straight from the memory mapped flash
+
+    xSession.ubState = RADIO_FOTA_STATE_BEGIN;
+
+    return 1;
+}
+void radio_fota_abort()
+{
+    xSession.ubState = RADIO_FOTA_STATE_IDLE; // The node keeps what it has, a later start resumes from there
+}
+uint8_t radio_fota_busy()
+{
+    return xSession.ubState != RADIO_FOTA_STATE_IDLE;
+}
+
+void radio_fota_get_stats(radio_fota_stats_t *pStats)
+{
+    if(!pStats)
+        return;
+
+    memcpy(pStats, &xStats, sizeof(radio_fota_stats_t));
+
+    pStats->ubState = xSession.ubState;
+    pStats->ubNodeID = xSession.ubNodeID;
+    pStats->ulImageSize = xSession.ulImageSize;
+    pStats->ulAckedBytes = xSession.ulBase;
+    pStats->ulElapsed = g_ullSystemTick - xSession.ullStart;
+}
@@ -0,0 +1,453 @@
+#include "radio_protocol.h"
+
+#define RADIO_PROTOCOL_FIELD(type, member, kind, arg) {RADIO_PROTOCOL_FIELD_##kind, offsetof(type, member), arg}
+#define RADIO_PROTOCOL_MESSAGE(cmd, type, fields) {cmd, sizeof(type), fields, sizeof(fields) / sizeof(radio_protocol_field_t)}
+#define RADIO_PROTOCOL_MESSAGE_EMPTY(cmd, type) {cmd, sizeof(type), NULL, 0}
+
+static const radio_protocol_field_t pRadioProtocolLEDSetReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_led_set_req_t, ubMode, BYTE, 0),
+    RADIO_PROTOCOL_FIELD(radio_cmd_led_set_req_t, usValue, VARINT, sizeof(uint16_t))
+};
+static const radio_protocol_field_t pRadioProtocolUIDReadResFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_uid_read_res_t, usID0_15, U16, 0),
+    RADIO_PROTOCOL_FIELD(radio_cmd_uid_read_res_t, usID16_31, U16, 0),
+    RADIO_PROTOCOL_FIELD(radio_cmd_uid_read_res_t, ulID32_63, U32, 0),
+    RADIO_PROTOCOL_FIELD(radio_cmd_uid_read_res_t, ulID64_96, U32, 0)
+};
+static const radio_protocol_field_t pRadioProtocolTempDataReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_temp_data_req_t, ulSamples, VARINT, sizeof(uint32_t))
+};
+static const radio_protocol_field_t pRadioProtocolTempDataResFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_temp_data_res_t, sWaterTemp, U16, 0)
+};
+static const radio_protocol_field_t pRadioProtocolBatDataReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_bat_data_req_t, ulSamples, VARINT, sizeof(uint32_t))
+};
+static const radio_protocol_field_t pRadioProtocolBatDataResFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_bat_data_res_t, usBatteryVoltage, U16, 0),
+    RADIO_PROTOCOL_FIELD(radio_cmd_bat_data_res_t, ubChargerDetected, FLAG, 0),
+    RADIO_PROTOCOL_FIELD(radio_cmd_bat_data_res_t, ubChargerTerminated, FLAG, 1),
+    RADIO_PROTOCOL_FIELD(radio_cmd_bat_data_res_t, ubBatteryLow, FLAG, 2)
+};
+static const radio_protocol_field_t pRadioProtocolRadioFreqCfgReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_radio_freq_cfg_req_t, ubMode, BYTE, 0)
+};
+static const radio_protocol_field_t pRadioProtocolRadioPowerCfgReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_radio_power_cfg_req_t, bATCTargetRSSI, BYTE, 0)
+};
+static const radio_protocol_field_t pRadioProtocolReportCfgReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_report_cfg_req_t, ulDataReportDelay, VARINT, sizeof(uint32_t)),
+    RADIO_PROTOCOL_FIELD(radio_cmd_report_cfg_req_t, ulAccelSamples, VARINT, sizeof(uint32_t)),
+    RADIO_PROTOCOL_FIELD(radio_cmd_report_cfg_req_t, ulTempSamples, VARINT, sizeof(uint32_t)),
+    RADIO_PROTOCOL_FIELD(radio_cmd_report_cfg_req_t, ulBatterySamples, VARINT, sizeof(uint32_t))
+};
+static const radio_protocol_field_t pRadioProtocolSleepCfgReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_sleep_cfg_req_t, ulSleepTimeout, VARINT, sizeof(uint32_t))
+};
+static const radio_protocol_field_t pRadioProtocolFOTAQueryInfoResFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_query_info_res_t, ulCurrentVersion, VARINT, sizeof(uint32_t)),
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_query_info_res_t, pszBuildDate, STRING, sizeof(((radio_cmd_fota_query_info_res_t *)0)->pszBuildDate)),
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_query_info_res_t, pszBuildTime, STRING, sizeof(((radio_cmd_fota_query_info_res_t *)0)->pszBuildTime))
+};
+static const radio_protocol_field_t pRadioProtocolFOTASendChunkReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_send_chunk_req_t, ulOffset, VARINT, sizeof(uint32_t)),
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_send_chunk_req_t, ubDataSize, BYTES, RADIO_PROTOCOL_FOTA_CHUNK_SIZE)
+};
+static const radio_protocol_field_t pRadioProtocolFOTASendChunkResFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_send_chunk_res_t, ulOffset, VARINT, sizeof(uint32_t)),
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_send_chunk_res_t, ulReceivedMask, U32, 0)
+};
+static const radio_protocol_field_t pRadioProtocolFOTABeginReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_begin_req_t, ulVersion, VARINT, sizeof(uint32_t)),
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_begin_req_t, ulImageSize, VARINT, sizeof(uint32_t))
+};
+static const radio_protocol_field_t pRadioProtocolFOTABeginResFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_begin_res_t, ulOffset, VARINT, sizeof(uint32_t))
+};
+static const radio_protocol_field_t pRadioProtocolFOTAEndReqFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_end_req_t, ubDigestSize, BYTES, RADIO_PROTOCOL_FOTA_DIGEST_SIZE)
+};
+static const radio_protocol_field_t pRadioProtocolFOTAEndResFields[] = {
+    RADIO_PROTOCOL_FIELD(radio_cmd_fota_end_res_t, ubStatus, BYTE, 0)
+};
+
+static const radio_protocol_message_t pRadioProtocolMessages[] = {
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG, radio_cmd_ping_req_t),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_PING, radio_cmd_ping_res_t),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_LED_SET | RADIO_CMD_REQUEST_FLAG, radio_cmd_led_set_req_t, pRadioProtocolLEDSetReqFields),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_LED_SET, radio_cmd_led_set_res_t),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_UID_READ | RADIO_CMD_REQUEST_FLAG, radio_cmd_uid_read_req_t),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_UID_READ, radio_cmd_uid_read_res_t, pRadioProtocolUIDReadResFields),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_SYS_RESET | RADIO_CMD_REQUEST_FLAG, radio_cmd_sys_reset_req_t),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_SYS_RESET, radio_cmd_sys_reset_res_t),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_TEMP_DATA | RADIO_CMD_REQUEST_FLAG, radio_cmd_temp_data_req_t, pRadioProtocolTempDataReqFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_TEMP_DATA, radio_cmd_temp_data_res_t, pRadioProtocolTempDataResFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_BAT_DATA | RADIO_CMD_REQUEST_FLAG, radio_cmd_bat_data_req_t, pRadioProtocolBatDataReqFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_BAT_DATA, radio_cmd_bat_data_res_t, pRadioProtocolBatDataResFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_RADIO_FREQ_CFG | RADIO_CMD_REQUEST_FLAG, radio_cmd_radio_freq_cfg_req_t, pRadioProtocolRadioFreqCfgReqFields),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_RADIO_FREQ_CFG, radio_cmd_radio_freq_cfg_res_t),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_RADIO_POWER_CFG | RADIO_CMD_REQUEST_FLAG, radio_cmd_radio_power_cfg_req_t, pRadioProtocolRadioPowerCfgReqFields),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_RADIO_POWER_CFG, radio_cmd_radio_power_cfg_res_t),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_REPORT_CFG | RADIO_CMD_REQUEST_FLAG, radio_cmd_report_cfg_req_t, pRadioProtocolReportCfgReqFields),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_REPORT_CFG, radio_cmd_report_cfg_res_t),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, radio_cmd_sleep_cfg_req_t, pRadioProtocolSleepCfgReqFields),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_SLEEP_CFG, radio_cmd_sleep_cfg_res_t),
+    RADIO_PROTOCOL_MESSAGE_EMPTY(RADIO_CMD_FOTA_QUERY_INFO | RADIO_CMD_REQUEST_FLAG, radio_cmd_fota_query_info_req_t),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_FOTA_QUERY_INFO, radio_cmd_fota_query_info_res_t, pRadioProtocolFOTAQueryInfoResFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_FOTA_SEND_CHUNK | RADIO_CMD_REQUEST_FLAG, radio_cmd_fota_send_chunk_req_t, pRadioProtocolFOTASendChunkReqFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_FOTA_SEND_CHUNK, radio_cmd_fota_send_chunk_res_t, pRadioProtocolFOTASendChunkResFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_FOTA_BEGIN | RADIO_CMD_REQUEST_FLAG, radio_cmd_fota_begin_req_t, pRadioProtocolFOTABeginReqFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_FOTA_BEGIN, radio_cmd_fota_begin_res_t, pRadioProtocolFOTABeginResFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_FOTA_END | RADIO_CMD_REQUEST_FLAG, radio_cmd_fota_end_req_t, pRadioProtocolFOTAEndReqFields),
+    RADIO_PROTOCOL_MESSAGE(RADIO_CMD_FOTA_END, radio_cmd_fota_end_res_t, pRadioProtocolFOTAEndResFields)
+};
+
+static uint8_t radio_protocol_get_field_max_size(const radio_protocol_field_t *pField)
+{
+    switch(pField->ubType)
+    {
+        case RADIO_PROTOCOL_FIELD_BYTE:
+            return 1;
+        case RADIO_PROTOCOL_FIELD_U16:
+            return 2;
+        case RADIO_PROTOCOL_FIELD_U32:
+            return 4;
+        case RADIO_PROTOCOL_FIELD_VARINT:
+            return pField->ubArg == sizeof(uint16_t) ? 3 : 5;
+        case RADIO_PROTOCOL_FIELD_FLAG:
+            return pField->ubArg ? 0 : 1;
+        case RADIO_PROTOCOL_FIELD_STRING:
+            return pField->ubArg; // Length byte takes the place of the terminator
+        case RADIO_PROTOCOL_FIELD_BYTES:
+            return pField->ubArg + 1;
+    }
+
+    return 0;
+}
+
+const radio_protocol_message_t* radio_protocol_get_message(uint8_t ubCommand)
+{
+    for(uint8_t i = 0; i < sizeof(pRadioProtocolMessages) / sizeof(radio_protocol_message_t); i++)
+        if(pRadioProtocolMessages[i].ubCommand == ubCommand)
+            return &pRadioProtocolMessages[i];
+
+    return NULL;
+}
+uint8_t radio_protocol_get_max_size(uint8_t ubCommand)
+{
+    const radio_protocol_message_t *pMessage = radio_protocol_get_message(ubCommand);
+
+    if(!pMessage)
+        return 0;
+
+    uint8_t ubSize = RADIO_PROTOCOL_HEADER_SIZE;
+
+    for(uint8_t i = 0; i < pMessage->ubFieldCount; i++)
+        ubSize += radio_protocol_get_field_max_size(&pMessage->pFields[i]);
+
+    return ubSize;
+}
+
+uint8_t radio_protocol_encode(const void *pvMessage, uint8_t *pubBuffer, uint8_t ubBufferSize)
+{
+    if(!pvMessage || !pubBuffer)
+        return 0;
+
+    const uint8_t *pubMessage = (const uint8_t *)pvMessage;
+    const radio_protocol_message_t *pMessage = radio_protocol_get_message(pubMessage[0]);
+
+    if(!pMessage)
+        return 0;
+
+    if(ubBufferSize < RADIO_PROTOCOL_HEADER_SIZE)
+        return 0;
+
+    uint8_t *pubDst = pubBuffer;
+    uint8_t *pubFlags = NULL;
+
+    *pubDst++ = pMessage->ubCommand;
+    *pubDst++ = RADIO_PROTOCOL_WIRE_VERSION;
+
+    for(uint8_t i = 0; i < pMessage->ubFieldCount; i++)
+    {
+        const radio_protocol_field_t *pField = &pMessage->pFields[i];
+        const uint8_t *pubSrc = pubMessage + pField->ubOffset;
+        uint8_t ubLeft = ubBufferSize - (pubDst - pubBuffer);
+
+        switch(pField->ubType)
+        {
+            case RADIO_PROTOCOL_FIELD_BYTE:
+            {
+                if(ubLeft < 1)
+                    return 0;
+
+                *pubDst++ = *pubSrc;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_U16:
+            {
+                uint16_t usValue;
+
+                if(ubLeft < 2)
+                    return 0;
+
+                memcpy(&usValue, pubSrc, sizeof(uint16_t));
+
+                *pubDst++ = usValue & 0xFF;
+                *pubDst++ = usValue >> 8;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_U32:
+            {
+                uint32_t ulValue;
+
+                if(ubLeft < 4)
+                    return 0;
+
+                memcpy(&ulValue, pubSrc, sizeof(uint32_t));
+
+                for(uint8_t j = 0; j < 4; j++, ulValue >>= 8)
+                    *pubDst++ = ulValue & 0xFF;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_VARINT:
+            {
+                uint32_t ulValue;
+
+                if(pField->ubArg == sizeof(uint16_t))
+                {
+                    uint16_t usValue;
+
+                    memcpy(&usValue, pubSrc, sizeof(uint16_t));
+
+                    ulValue = usValue;
+                }
+                else
+                {
+                    memcpy(&ulValue, pubSrc, sizeof(uint32_t));
+                }
+
+                do
+                {
+                    if(!ubLeft--)
+                        return 0;
+
+                    *pubDst++ = (ulValue & 0x7F) | (ulValue > 0x7F ? 0x80 : 0x00);
+
+                    ulValue >>= 7;
+                } while(ulValue);
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_FLAG:
+            {
+                if(!pField->ubArg || !pubFlags)
+                {
+                    if(ubLeft < 1)
+                        return 0;
+
+                    pubFlags = pubDst++;
+                    *pubFlags = 0;
+                }
+
+                if(*pubSrc)
+                    *pubFlags |= 1 << pField->ubArg;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_STRING:
+            {
+                uint8_t ubLength = strnlen((const char *)pubSrc, pField->ubArg);
+
+                if(ubLength >= pField->ubArg)
+                    return 0; // Not terminated
+
+                if(ubLeft < ubLength + 1)
+                    return 0;
+
+                *pubDst++ = ubLength;
+
+                memcpy(pubDst, pubSrc, ubLength);
+
+                pubDst += ubLength;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_BYTES:
+            {
+                uint8_t ubLength = *pubSrc++;
+
+                if(ubLength > pField->ubArg)
+                    return 0;
+
+                if(ubLeft < ubLength + 1)
+                    return 0;
+
+                *pubDst++ = ubLength;
+
+                memcpy(pubDst, pubSrc, ubLength);
+
+                pubDst += ubLength;
+            }
+            break;
+            default:
+                return 0;
+        }
+    }
+
+    return pubDst - pubBuffer;
+}
+uint8_t radio_protocol_decode(void *pvMessage, uint8_t ubMessageSize, const uint8_t *pubBuffer, uint8_t ubSize)
+{
+    if(!pubBuffer || !ubSize)
+        return 0;
+
+    return radio_protocol_decode_message(radio_protocol_get_message(pubBuffer[0]), pvMessage, ubMessageSize, pubBuffer, ubSize);
+}
+uint8_t radio_protocol_decode_message(const radio_protocol_message_t *pMessage, void *pvMessage, uint8_t ubMessageSize, const uint8_t *pubBuffer, uint8_t ubSize)
+{
+    if(!pMessage || !pvMessage || !pubBuffer)
+        return 0;
+
+    if(ubSize < RADIO_PROTOCOL_HEADER_SIZE)
+        return 0;
+
+    if(pubBuffer[0] != pMessage->ubCommand || pubBuffer[1] != RADIO_PROTOCOL_WIRE_VERSION)
+        return 0;
+
+    if(ubMessageSize < pMessage->ubStructSize)
+        return 0;
+
+    uint8_t *pubMessage = (uint8_t *)pvMessage;
+    const uint8_t *pubSrc = pubBuffer + RADIO_PROTOCOL_HEADER_SIZE;
+    const uint8_t *pubEnd = pubBuffer + ubSize;
+    const uint8_t *pubFlags = NULL;
+
+    memset(pubMessage, 0, pMessage->ubStructSize);
+
+    pubMessage[0] = pMessage->ubCommand;
+
+    for(uint8_t i = 0; i < pMessage->ubFieldCount; i++)
+    {
+        const radio_protocol_field_t *pField = &pMessage->pFields[i];
+        uint8_t *pubDst = pubMessage + pField->ubOffset;
+
+        switch(pField->ubType)
+        {
+            case RADIO_PROTOCOL_FIELD_BYTE:
+            {
+                if(pubEnd - pubSrc < 1)
+                    return 0;
+
+                *pubDst = *pubSrc++;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_U16:
+            {
+                if(pubEnd - pubSrc < 2)
+                    return 0;
+
+                uint16_t usValue = (uint16_t)pubSrc[0] | ((uint16_t)pubSrc[1] << 8);
+
+                memcpy(pubDst, &usValue, sizeof(uint16_t));
+
+                pubSrc += 2;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_U32:
+            {
+                if(pubEnd - pubSrc < 4)
+                    return 0;
+
+                uint32_t ulValue = (uint32_t)pubSrc[0] | ((uint32_t)pubSrc[1] << 8) | ((uint32_t)pubSrc[2] << 16) | ((uint32_t)pubSrc[3] << 24);
+
+                memcpy(pubDst, &ulValue, sizeof(uint32_t));
+
+                pubSrc += 4;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_VARINT:
+            {
+                uint32_t ulValue = 0;
+                uint8_t ubShift = 0;
+                uint8_t ubByte;
+
+                do
+                {
+                    if(pubSrc >= pubEnd || ubShift > 28)
+                        return 0;
+
+                    ubByte = *pubSrc++;
+
+                    if(ubShift == 28 && (ubByte & 0x70))
+                        return 0; // Does not fit in 32 bits
+
+                    ulValue |= (uint32_t)(ubByte & 0x7F) << ubShift;
+                    ubShift += 7;
+                } while(ubByte & 0x80);
+
+                if(pField->ubArg == sizeof(uint16_t))
+                {
+                    if(ulValue > UINT16_MAX)
+                        return 0;
+
+                    uint16_t usValue = ulValue;
+
+                    memcpy(pubDst, &usValue, sizeof(uint16_t));
+                }
+                else
+                {
+                    memcpy(pubDst, &ulValue, sizeof(uint32_t));
+                }
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_FLAG:
+            {
+                if(!pField->ubArg || !pubFlags)
+                {
+                    if(pubSrc >= pubEnd)
+                        return 0;
+
+                    pubFlags = pubSrc++;
+                }
+
+                *pubDst = !!(*pubFlags & (1 << pField->ubArg));
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_STRING:
+            {
+                if(pubSrc >= pubEnd)
+                    return 0;
+
+                uint8_t ubLength = *pubSrc++;
+
+                if(ubLength >= pField->ubArg || pubEnd - pubSrc < ubLength)
+                    return 0;
+
+                memcpy(pubDst, pubSrc, ubLength);
+
+                pubDst[ubLength] = '\0';
+                pubSrc += ubLength;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_BYTES:
+            {
+                if(pubSrc >= pubEnd)
+                    return 0;
+
+                uint8_t ubLength = *pubSrc++;
+
+                if(ubLength > pField->ubArg || pubEnd - pubSrc < ubLength)
+                    return 0;
+
+                *pubDst++ = ubLength;
+
+                memcpy(pubDst, pubSrc, ubLength);
+
+                pubSrc += ubLength;
+            }
+            break;
+            default:
+                return 0;
+        }
+    }
+
+    return pubSrc == pubEnd; // Trailing bytes mean the sender speaks another layout under the same version
+}
@@ -0,0 +1,324 @@
+#include "radio_transport.h"
+
+static radio_transport_tx_slot_t pTXSlots[RADIO_TRANSPORT_TX_SLOTS];
+static radio_transport_rx_slot_t pRXSlots[RADIO_TRANSPORT_RX_SLOTS];
+static radio_transport_stats_t xStats;
+static uint8_t ubNextMessageID = 0;
+static radio_transport_rx_callback_fn_t pfRXCallback = NULL;
+static radio_transport_tx_callback_fn_t pfTXCallback = NULL;
+
+static inline uint32_t radio_transport_fragment_mask(uint8_t ubCount)
+{
+    return ubCount ? (0xFFFFFFFF >> (32 - ubCount)) : 0;
+}
+
+static void radio_transport_send_status(radio_transport_rx_slot_t *pSlot)
+{
+    radio_cmd_transport_status_t xStatus;
+
+    memset(&xStatus, 0, sizeof(radio_cmd_transport_status_t));
+
+    xStatus.ubCommand = RADIO_CMD_TRANSPORT_STATUS;
+    xStatus.ubMessageID = pSlot->ubMessageID;
+    xStatus.ulMissingMask = pSlot->ubComplete ? 0 : (radio_transport_fragment_mask(pSlot->ubFragmentCount) & ~pSlot->ulReceivedMask);
+
+    if(rfm69_send(pSlot->ubNodeID, &xStatus, sizeof(radio_cmd_transport_status_t), 0, 0, 0))
+        pSlot->ullLastStatus = g_ullSystemTick;
+}
+static radio_transport_rx_slot_t* radio_transport_get_rx_slot(uint8_t ubNodeID, uint8_t ubMessageID, uint8_t ubCount)
+{
+    radio_transport_rx_slot_t *pFree = NULL;
+    radio_transport_rx_slot_t *pOldest = NULL;
+
+    for(uint8_t i = 0; i < RADIO_TRANSPORT_RX_SLOTS; i++)
+    {
+        radio_transport_rx_slot_t *pSlot = &pRXSlots[i];
+
+        if(!pSlot->ubUsed)
+        {
+            if(!pFree)
+                pFree = pSlot;
+
+            continue;
+        }
+
+        if(pSlot->ubNodeID == ubNodeID && pSlot->ubMessageID == ubMessageID)
+            return pSlot->ubFragmentCount == ubCount ? pSlot : NULL;
+
+        if(!pOldest || pSlot->ullLastActivity < pOldest->ullLastActivity)
+            pOldest = pSlot;
+    }
+
+    if(!pFree)
+    {
+        pFree = pOldest;
+
+        if(!pFree->ubComplete)
+            xStats.ulEvictions++;
+    }
+
+    memset(pFree, 0, offsetof(radio_transport_rx_slot_t, pubData));
+
+    pFree->ubUsed = 1;
+    pFree->ubNodeID = ubNodeID;
+    pFree->ubMessageID = ubMessageID;
+    pFree->ubFragmentCount = ubCount;
+
+    return pFree;
+}
+static void radio_transport_handle_fragment(uint8_t ubNodeID, int8_t bRSSI, const uint8_t *pubData, uint8_t ubSize)
+{
+    if(ubSize < sizeof(radio_cmd_transport_fragment_t))
+        return;
+
+    const radio_cmd_transport_fragment_t *pFragment = (const radio_cmd_transport_fragment_t *)pubData;
+    uint8_t ubDataSize = ubSize - sizeof(radio_cmd_transport_fragment_t);
+
+    if(!pFragment->ubCount || pFragment->ubCount > RADIO_TRANSPORT_MAX_FRAGMENTS || pFragment->ubIndex >= pFragment->ubCount)
+        return;
+
+    uint8_t ubLast = pFragment->ubIndex == pFragment->ubCount - 1;
+
+    if(!ubLast && ubDataSize != RADIO_TRANSPORT_FRAGMENT_DATA_SIZE)
+        return;
+
+    if(!ubDataSize || pFragment->ubIndex * RADIO_TRANSPORT_FRAGMENT_DATA_SIZE + ubDataSize > RADIO_TRANSPORT_MAX_MESSAGE_SIZE)
+        return;
+
+    radio_transport_rx_slot_t *pSlot = radio_transport_get_rx_slot(ubNodeID, pFragment->ubMessageID, pFragment->ubCount);
+
+    if(!pSlot)
+        return;
+
+    pSlot->ullLastActivity = g_ullSystemTick;
+
+    if(pSlot->ubComplete) // Our status got lost, the sender is poking us, keep the slot around while it does
+    {
+        radio_transport_send_status(pSlot);
+
+        return;
+    }
+
+    pSlot->bRSSI = bRSSI;
+
+    if(!(pSlot->ulReceivedMask & BIT(pFragment->ubIndex)))
+    {
+        memcpy(pSlot->pubData + pFragment->ubIndex * RADIO_TRANSPORT_FRAGMENT_DATA_SIZE, pFragment->pubData, ubDataSize);
+
+        pSlot->ulReceivedMask |= BIT(pFragment->ubIndex);
+
+        if(ubLast)
+            pSlot->usSize = pFragment->ubIndex * RADIO_TRANSPORT_FRAGMENT_DATA_SIZE + ubDataSize;
+    }
+
+    if(pSlot->ulReceivedMask == radio_transport_fragment_mask(pSlot->ubFragmentCount))
+    {
+        pSlot->ubComplete = 1;
+
+        xStats.ulMessagesReceived++;
+
+        radio_transport_send_status(pSlot);
+
+        if(pfRXCallback)
+            pfRXCallback(pSlot->ubNodeID, pSlot->bRSSI, pSlot->pubData, pSlot->usSize);
+    }
+    else if(ubLast)
+    {
+        radio_transport_send_status(pSlot); // End of a burst, ask for the gaps right away
+    }
+}
+static void radio_transport_handle_status(uint8_t ubNodeID, const uint8_t *pubData, uint8_t ubSize)
+{
+    if(ubSize < sizeof(radio_cmd_transport_status_t))
+        return;
+
+    radio_cmd_transport_status_t xStatus;
+
+    memcpy(&xStatus, pubData, sizeof(radio_cmd_transport_status_t));
+
+    for(uint8_t i = 0; i < RADIO_TRANSPORT_TX_SLOTS; i++)
+    {
+        radio_transport_tx_slot_t *pSlot = &pTXSlots[i];
+
+        if(!pSlot->ubUsed || pSlot->ubNodeID != ubNodeID || pSlot->ubMessageID != xStatus.ubMessageID)
+            continue;
+
+        pSlot->ullLastActivity = g_ullSystemTick;
+        pSlot->ubRetriesLeft = RADIO_TRANSPORT_TX_RETRIES;
+
+        if(!xStatus.ulMissingMask)
+        {
+            pSlot->ubUsed = 0;
+
+            xStats.ulMessagesSent++;
+
+            if(pfTXCallback)
+                pfTXCallback(pSlot->ubNodeID, pSlot->ubMessageID, 1);
+
+            return;
+        }
+
+        uint32_t ulMissing = xStatus.ulMissingMask & radio_transport_fragment_mask(pSlot->ubFragmentCount) & ~pSlot->ulUnsentMask;
+
+        xStats.ulFragmentsResent += __builtin_popcount(ulMissing);
+
+        pSlot->ulUnsentMask |= ulMissing; // Only the gaps go out again
+
+        return;
+    }
+}
+static void radio_transport_rfm69_rx_callback(const rfm69_packet_header_t *pHeader, int8_t bRSSI, const uint8_t *pubData, uint8_t ubSize)
+{
+    switch(pubData[0])
+    {
+        case RADIO_CMD_TRANSPORT_FRAGMENT:
+            radio_transport_handle_fragment(pHeader->ubSenderNodeID, bRSSI, pubData, ubSize);
+        break;
+        case RADIO_CMD_TRANSPORT_STATUS:
+            radio_transport_handle_status(pHeader->ubSenderNodeID, pubData, ubSize);
+        break;
+        default:
+            if(pfRXCallback)
+                pfRXCallback(pHeader->ubSenderNodeID, bRSSI, pubData, ubSize);
+        break;
+    }
+}
+
+void radio_transport_init()
+{
+    memset(pTXSlots, 0, sizeof(pTXSlots));
+    memset(pRXSlots, 0, sizeof(pRXSlots));
+    memset(&xStats, 0, sizeof(radio_transport_stats_t));
+
+    rfm69_set_rx_callback(radio_transport_rfm69_rx_callback);
+}
+void radio_transport_tick()
+{
+    for(uint8_t i = 0; i < RADIO_TRANSPORT_TX_SLOTS; i++)
+    {
+        radio_transport_tx_slot_t *pSlot = &pTXSlots[i];
+
+        if(!pSlot->ubUsed)
+            continue;
+
+        while(pSlot->ulUnsentMask)
+        {
+            uint8_t ubIndex = __builtin_ctz(pSlot->ulUnsentMask);
+            uint16_t usOffset = ubIndex * RADIO_TRANSPORT_FRAGMENT_DATA_SIZE;
+            uint16_t usRemaining = pSlot->usSize - usOffset;
+            uint8_t ubDataSize = MIN(usRemaining, RADIO_TRANSPORT_FRAGMENT_DATA_SIZE);
+            uint8_t pubBuffer[RFM69_MAX_DATA_SIZE];
+            radio_cmd_transport_fragment_t *pFragment = (radio_cmd_transport_fragment_t *)pubBuffer;
+
+            pFragment->ubCommand = RADIO_CMD_TRANSPORT_FRAGMENT;
+            pFragment->ubMessageID = pSlot->ubMessageID;
+            pFragment->ubIndex = ubIndex;
+            pFragment->ubCount = pSlot->ubFragmentCount;
+
+            memcpy(pFragment->pubData, pSlot->pubData + usOffset, ubDataSize);
+
+            if(!rfm69_send(pSlot->ubNodeID, pubBuffer, sizeof(radio_cmd_transport_fragment_t) + ubDataSize, 0, 0, 0))
+                break; // Radio TX FIFO is full, carry on next tick
+
+            pSlot->ulUnsentMask &= ~BIT(ubIndex);
+            pSlot->ullLastActivity = g_ullSystemTick;
+
+            xStats.ulFragmentsSent++;
+        }
+
+        if(pSlot->ulUnsentMask || g_ullSystemTick - pSlot->ullLastActivity < RADIO_TRANSPORT_TX_TIMEOUT)
+            continue;
+
+        if(!pSlot->ubRetriesLeft)
+        {
+            pSlot->ubUsed = 0;
+
+            xStats.ulMessagesFailed++;
+
+            if(pfTXCallback)
+                pfTXCallback(pSlot->ubNodeID, pSlot->ubMessageID, 0);
+
+            continue;
+        }
+
+        pSlot->ubRetriesLeft--;
+        pSlot->ulUnsentMask |= BIT(pSlot->ubFragmentCount - 1); // Resending the last fragment makes the receiver report what it is missing
+
+        xStats.ulFragmentsResent++;
+    }
+
+    for(uint8_t i = 0; i < RADIO_TRANSPORT_RX_SLOTS; i++)
+    {
+        radio_transport_rx_slot_t *pSlot = &pRXSlots[i];
+
+        if(!pSlot->ubUsed)
+            continue;
+
+        if(g_ullSystemTick - pSlot->ullLastActivity >= RADIO_TRANSPORT_RX_TIMEOUT)
+        {
+            if(!pSlot->ubComplete)
+                xStats.ulEvictions++;
+
+            pSlot->ubUsed = 0;
+
+            continue;
+        }
+
+        if(!pSlot->ubComplete && g_ullSystemTick - pSlot->ullLastActivity >= RADIO_TRANSPORT_STATUS_DELAY && g_ullSystemTick - pSlot->ullLastStatus >= RADIO_TRANSPORT_STATUS_DELAY)
+            radio_transport_send_status(pSlot); // Sender went quiet with gaps left, the tail may have been lost
+    }
+}
+
+void radio_transport_set_rx_callback(radio_transport_rx_callback_fn_t pfFunc)
+{
+    pfRXCallback = pfFunc;
+}
+void radio_transport_set_tx_callback(radio_transport_tx_callback_fn_t pfFunc)
+{
+    pfTXCallback = pfFunc;
+}
+
+uint8_t radio_transport_send(uint8_t ubReceiver, const void *pvData, uint16_t usSize)
+{
+    if(!pvData || !usSize || usSize > RADIO_TRANSPORT_MAX_MESSAGE_SIZE)
+        return 0;
+
+    radio_transport_tx_slot_t *pSlot = NULL;
+
+    for(uint8_t i = 0; i < RADIO_TRANSPORT_TX_SLOTS; i++)
+    {
+        if(!pTXSlots[i].ubUsed)
+        {
+            pSlot = &pTXSlots[i];
+
+            break;
+        }
+    }
+
+    if(!pSlot)
+        return 0;
+
+    if(!++ubNextMessageID)
+        ubNextMessageID = 1;
+
+    pSlot->ubUsed = 1;
+    pSlot->ubNodeID = ubReceiver;
+    pSlot->ubMessageID = ubNextMessageID;
+    pSlot->ubFragmentCount = (usSize + RADIO_TRANSPORT_FRAGMENT_DATA_SIZE - 1) / RADIO_TRANSPORT_FRAGMENT_DATA_SIZE;
+    pSlot->ubRetriesLeft = RADIO_TRANSPORT_TX_RETRIES;
+    pSlot->usSize = usSize;
+    pSlot->ulUnsentMask = radio_transport_fragment_mask(pSlot->ubFragmentCount);
+    pSlot->ullLastActivity = g_ullSystemTick;
+
+    memcpy(pSlot->pubData, pvData, usSize);
+
+    return pSlot->ubMessageID;
+}
+
+void radio_transport_get_stats(radio_transport_stats_t *pStats)
+{
+    if(!pStats)
+        return;
+
+    memcpy(pStats, &xStats, sizeof(radio_transport_stats_t));
+}
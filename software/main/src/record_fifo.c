@@ -0,0 +1,169 @@
+#include "record_fifo.h"
+
+static void record_fifo_copy_in(record_fifo_t *pFIFO, uint32_t ulIndex, const uint8_t *pubData, uint32_t ulSize)
+{
+    uint32_t ulOffset = ulIndex & (pFIFO->ulBufferSize - 1);
+    uint32_t ulFirst = pFIFO->ulBufferSize - ulOffset;
+
+    if(ulFirst > ulSize)
+        ulFirst = ulSize;
+
+    memcpy(pFIFO->pubBuffer + ulOffset, pubData, ulFirst);
+    memcpy(pFIFO->pubBuffer, pubData + ulFirst, ulSize - ulFirst);
+}
+static void record_fifo_copy_out(record_fifo_t *pFIFO, uint32_t ulIndex, uint8_t *pubData, uint32_t ulSize)
+{
+    uint32_t ulOffset = ulIndex & (pFIFO->ulBufferSize - 1);
+    uint32_t ulFirst = pFIFO->ulBufferSize - ulOffset;
+
+    if(ulFirst > ulSize)
+        ulFirst = ulSize;
+
+    memcpy(pubData, pFIFO->pubBuffer + ulOffset, ulFirst);
+    memcpy(pubData + ulFirst, pFIFO->pubBuffer, ulSize - ulFirst);
+}
+static uint32_t record_fifo_get_record_size(record_fifo_t *pFIFO, uint32_t ulTail)
+{
+    uint8_t pubHeader[RECORD_FIFO_HEADER_SIZE];
+
+    record_fifo_copy_out(pFIFO, ulTail, pubHeader, RECORD_FIFO_HEADER_SIZE);
+
+    return (uint32_t)pubHeader[0] | ((uint32_t)pubHeader[1] << 8);
+}
+
+record_fifo_t* record_fifo_init(uint8_t *pubBuffer, uint32_t ulSize)
+{
+    if(!ulSize || (ulSize & (ulSize - 1)))
+        return NULL;
+
+    record_fifo_t *pNewFIFO = (record_fifo_t *)malloc(sizeof(record_fifo_t));
+
+    if(!pNewFIFO)
+        return NULL;
+
+    memset(pNewFIFO, 0, sizeof(record_fifo_t));
+
+    pNewFIFO->pubBuffer = pubBuffer ? pubBuffer : (uint8_t *)malloc(ulSize);
+
+    if(!pNewFIFO->pubBuffer)
+    {
+        free(pNewFIFO);
+
+        return NULL;
+    }
+
+    memset(pNewFIFO->pubBuffer, 0, ulSize);
+
+    if(!pubBuffer)
+        pNewFIFO->ubBufferAllocated = 1;
+
+    pNewFIFO->ulBufferSize = ulSize;
+
+    return pNewFIFO;
+}
+void record_fifo_delete(record_fifo_t *pFIFO)
+{
+    if(!pFIFO)
+        return;
+
+    if(pFIFO->ubBufferAllocated)
+        free(pFIFO->pubBuffer);
+
+    free(pFIFO);
+}
+uint8_t record_fifo_write(record_fifo_t *pFIFO, const uint8_t *pubData, uint32_t ulSize)
+{
+    if(!pFIFO)
+        return 0;
+
+    if(!pubData || !ulSize || ulSize > 0xFFFF)
+        return 0;
+
+    uint32_t ulHead = pFIFO->ulHead;
+
+    if(pFIFO->ulBufferSize - (ulHead - pFIFO->ulTail) < RECORD_FIFO_HEADER_SIZE + ulSize)
+        return 0;
+
+    uint8_t pubHeader[RECORD_FIFO_HEADER_SIZE] = {ulSize & 0xFF, ulSize >> 8};
+
+    record_fifo_copy_in(pFIFO, ulHead, pubHeader, RECORD_FIFO_HEADER_SIZE);
+    record_fifo_copy_in(pFIFO, ulHead + RECORD_FIFO_HEADER_SIZE, pubData, ulSize);
+
+    __DMB(); // Record contents must land before the consumer can see the new head
+
+    pFIFO->ulHead = ulHead + RECORD_FIFO_HEADER_SIZE + ulSize;
+
+    return 1;
+}
+uint8_t record_fifo_read(record_fifo_t *pFIFO, uint8_t *pubData, uint32_t *pulSize, uint32_t ulMaxSize)
+{
+    if(!pFIFO)
+        return 0;
+
+    if(!pubData || !pulSize || !ulMaxSize)
+        return 0;
+
+    uint32_t ulTail = pFIFO->ulTail;
+
+    if(pFIFO->ulHead == ulTail)
+        return 0;
+
+    __DMB(); // Do not read the record before the head that published it
+
+    uint32_t ulSize = record_fifo_get_record_size(pFIFO, ulTail);
+
+    if(ulSize > ulMaxSize) // Leave it for a bigger buffer
+        return 0;
+
+    record_fifo_copy_out(pFIFO, ulTail + RECORD_FIFO_HEADER_SIZE, pubData, ulSize);
+
+    *pulSize = ulSize;
+
+    __DMB(); // Done reading before the producer may reuse the space
+
+    pFIFO->ulTail = ulTail + RECORD_FIFO_HEADER_SIZE + ulSize;
+
+    return 1;
+}
+uint32_t record_fifo_peek(record_fifo_t *pFIFO, record_fifo_span_t pSpans[2])
+{
+    if(!pFIFO || !pSpans)
+        return 0;
+
+    uint32_t ulTail = pFIFO->ulTail;
+
+    if(pFIFO->ulHead == ulTail)
+        return 0;
+
+    __DMB(); // Do not read the record before the head that published it
+
+    uint32_t ulSize = record_fifo_get_record_size(pFIFO, ulTail);
+    uint32_t ulOffset = (ulTail + RECORD_FIFO_HEADER_SIZE) & (pFIFO->ulBufferSize - 1);
+    uint32_t ulFirst = pFIFO->ulBufferSize - ulOffset;
+
+    if(ulFirst > ulSize)
+        ulFirst = ulSize;
+
+    pSpans[0].pubData = pFIFO->pubBuffer + ulOffset;
+    pSpans[0].ulSize = ulFirst;
+    pSpans[1].pubData = pFIFO->pubBuffer;
+    pSpans[1].ulSize = ulSize - ulFirst;
+
+    return ulSize;
+}
+void record_fifo_commit(record_fifo_t *pFIFO)
+{
+    if(!pFIFO)
+        return;
+
+    uint32_t ulTail = pFIFO->ulTail;
+
+    if(pFIFO->ulHead == ulTail)
+        return;
+
+    uint32_t ulSize = record_fifo_get_record_size(pFIFO, ulTail);
+
+    __DMB(); // Done reading before the producer may reuse the space
+
+    pFIFO->ulTail = ulTail + RECORD_FIFO_HEADER_SIZE + ulSize;
+}
@@ -2,51 +2,330 @@
 
 static uint16_t usRadioPacketID = 0;
 static uint8_t ubRadioNodeID = 0;
+static uint8_t ubRadioAESEnabled = 0;
 static volatile uint8_t ubRadioCurrentMode = RFM69_REG_OPMODE_STANDBY;
 static int8_t bRadioCurrentPowerLevel = RFM69_MAXIMUM_TX_POWER;
-static int8_t *pbRadioATCPowerLevel = NULL;
-static int8_t *pbRadioATCTargetRemoteRSSI = NULL;
-static int8_t *pbRadioATCRemoteRSSI = NULL;
-static int8_t *pbRadioLastRSSI = NULL;
+static rfm69_link_t *pRadioLinks = NULL; // Sorted by node ID
+static uint16_t usRadioLinkCount = 0;
+static uint16_t usRadioLinkCapacity = 0;
+static int16_t sRadioNoiseFloor = RFM69_NORMAL_RX_SENSITIVITY * 16; // 1/16 dBm
 static uint64_t ullLastTX = 0;
-static rfm69_pending_packet_t *pRadioACKPending = NULL;
-static rfm69_pending_packet_t *pRadioRELPending = NULL;
-static rfm69_pending_packet_t *pRadioRELACKPending = NULL;
-static blob_fifo_t *pRadioRXPacketFIFO = NULL;
-static blob_fifo_t *pRadioTXPacketFIFO = NULL;
+static volatile uint8_t ubRadioTXState = RFM69_TX_STATE_IDLE;
+static volatile uint8_t ubRadioModeSettling = 0;
+static const rfm69_csma_window_t pRadioCSMAWindows[RFM69_CSMA_PRIORITY_COUNT] = {
+	{1, 4, 16}, // RFM69_CSMA_PRIORITY_HIGH
+	{2, 8, 64}, // RFM69_CSMA_PRIORITY_NORMAL
+	{3, 16, 128} // RFM69_CSMA_PRIORITY_LOW
+};
+static uint8_t ubRadioCSMAPriority = RFM69_CSMA_PRIORITY_LOW;
+static uint16_t usRadioCSMAWindow = 0;
+static uint8_t ubRadioCSMABackoffs = 0;
+static uint64_t ullRadioCSMABackoffEnd = 0;
+static rfm69_packet_header_t sRadioTXHeader;
+static record_fifo_span_t pRadioTXFrameSpans[2]; // Frame stays in the TX FIFO until it is loaded into the radio
+static uint8_t ubRadioTXFrameSize = 0;
+#if RFM69_FIFO_DRAIN_DMA
+static ldma_descriptor_t __attribute__ ((aligned (4))) pRadioDMADescriptor[2];
+static uint8_t ubRadioDMADummy = 0;
+#endif
+static uint8_t pubRadioDMABuffer[RFM69_MAX_PAYLOAD_SIZE + 1]; // RSSI followed by the payload
+static volatile uint8_t ubRadioDMABusy = 0;
+static volatile uint8_t ubRadioDMALength = 0;
+static rfm69_isr_stats_t xRadioISRStats;
+static rfm69_pending_packet_t pRadioPendingSlab[RFM69_PENDING_SLAB_SIZE];
+static rfm69_pending_packet_t *pRadioPendingBuckets[RFM69_PENDING_HASH_BUCKETS];
+static rfm69_pending_packet_t *pRadioPendingFree = NULL;
+static rfm69_pending_stats_t xRadioPendingStats;
+static rfm69_pending_packet_t *pRadioTimerWheel[2][RFM69_TIMER_WHEEL_SIZE];
+static rfm69_pending_packet_t *pRadioTimerExpired = NULL;
+static uint64_t pullRadioTimerWheelMask[2];
+static uint32_t ulRadioTimerTick = 0;
+static rfm69_aggregate_t pRadioAggregates[RFM69_AGGREGATION_SLOTS];
+static uint16_t usRadioAggregationLatency = RFM69_AGGREGATION_LATENCY;
+static rfm69_tx_stats_t xRadioTXStats;
+static uint64_t ullRadioAirtime = 0; // us
+static uint16_t usRadioTXTimeout = RFM69_TX_TIMEOUT;
+static uint8_t pubRadioShadow[RFM69_REGISTER_COUNT];
+static uint32_t pulRadioShadowValid[(RFM69_REGISTER_COUNT + 31) / 32];
+static rfm69_spi_stats_t xRadioSPIStats;
+static const rfm69_modem_profile_t pRadioModemProfiles[RFM69_MODEM_PROFILE_COUNT] = {
+	{
+		"4.8 kbps", // RFM69_MODEM_PROFILE_4K8
+		{
+			{RFM69_REG_BITRATEMSB, RFM69_REG_BITRATEMSB_4800},
+			{RFM69_REG_BITRATELSB, RFM69_REG_BITRATELSB_4800},
+			{RFM69_REG_FDEVMSB, RFM69_REG_FDEVMSB_5000}, // MI = 2.1
+			{RFM69_REG_FDEVLSB, RFM69_REG_FDEVLSB_5000},
+			{RFM69_REG_AFCCTRL, RFM69_REG_AFCCTRL_LOWBETA_OFF},
+			{RFM69_REG_RXBW, RFM69_REG_RXBW_DCCFREQ_010 | RFM69_REG_RXBW_MANT_24 | RFM69_REG_RXBW_EXP_4}, // 20,8 kHz, leaves ~13 kHz for crystal offset
+			{RFM69_REG_AFCBW, RFM69_REG_AFCBW_DCCFREQAFC_100 | RFM69_REG_AFCBW_MANTAFC_20 | RFM69_REG_AFCBW_EXPAFC_3}, // 50 kHz
+			{RFM69_REG_AFCFEI, RFM69_REG_AFCFEI_AFCAUTO_OFF | RFM69_REG_AFCFEI_AFCAUTOCLEAR_OFF},
+			{RFM69_REG_PREAMBLEMSB, 0x00}, // 4 bytes, 6,7 ms is plenty for the AGC
+			{RFM69_REG_PREAMBLELSB, 0x04},
+			{RFM69_REG_TESTDAGC, RFM69_REG_DAGC_IMPROVED_LOWBETA0},
+			{RFM69_REG_TESTAFC, 0x01} // 10% Fdev
+		}
+	},
+	{
+		"25 kbps", // RFM69_MODEM_PROFILE_25K
+		{
+			{RFM69_REG_BITRATEMSB, RFM69_REG_BITRATEMSB_25000},
+			{RFM69_REG_BITRATELSB, RFM69_REG_BITRATELSB_25000},
+			{RFM69_REG_FDEVMSB, RFM69_REG_FDEVMSB_20000}, // MI = 1.6
+			{RFM69_REG_FDEVLSB, RFM69_REG_FDEVLSB_20000},
+			{RFM69_REG_AFCCTRL, RFM69_REG_AFCCTRL_LOWBETA_OFF},
+			{RFM69_REG_RXBW, RFM69_REG_RXBW_DCCFREQ_010 | RFM69_REG_RXBW_MANT_24 | RFM69_REG_RXBW_EXP_3}, // 41,7 kHz
+			{RFM69_REG_AFCBW, RFM69_REG_AFCBW_DCCFREQAFC_100 | RFM69_REG_AFCBW_MANTAFC_16 | RFM69_REG_AFCBW_EXPAFC_2}, // 125 kHz
+			{RFM69_REG_AFCFEI, RFM69_REG_AFCFEI_AFCAUTO_OFF | RFM69_REG_AFCFEI_AFCAUTOCLEAR_OFF},
+			{RFM69_REG_PREAMBLEMSB, 0x00}, // 5 bytes
+			{RFM69_REG_PREAMBLELSB, 0x05},
+			{RFM69_REG_TESTDAGC, RFM69_REG_DAGC_IMPROVED_LOWBETA0},
+			{RFM69_REG_TESTAFC, 0x03}
+		}
+	},
+	{
+		"55.5 kbps", // RFM69_MODEM_PROFILE_55K5
+		{
+			{RFM69_REG_BITRATEMSB, RFM69_REG_BITRATEMSB_55555},
+			{RFM69_REG_BITRATELSB, RFM69_REG_BITRATELSB_55555},
+			{RFM69_REG_FDEVMSB, RFM69_REG_FDEVMSB_50000}, // MI = 1.8
+			{RFM69_REG_FDEVLSB, RFM69_REG_FDEVLSB_50000},
+			{RFM69_REG_AFCCTRL, RFM69_REG_AFCCTRL_LOWBETA_OFF},
+			{RFM69_REG_RXBW, RFM69_REG_RXBW_DCCFREQ_010 | RFM69_REG_RXBW_MANT_24 | RFM69_REG_RXBW_EXP_2}, // 83,3 kHz
+			{RFM69_REG_AFCBW, RFM69_REG_AFCBW_DCCFREQAFC_100 | RFM69_REG_AFCBW_MANTAFC_20 | RFM69_REG_AFCBW_EXPAFC_1}, // 200 kHz
+			{RFM69_REG_AFCFEI, RFM69_REG_AFCFEI_AFCAUTO_OFF | RFM69_REG_AFCFEI_AFCAUTOCLEAR_OFF},
+			{RFM69_REG_PREAMBLEMSB, 0x00}, // 8 bytes, the AGC settles in about the same time at any bit rate
+			{RFM69_REG_PREAMBLELSB, 0x08},
+			{RFM69_REG_TESTDAGC, RFM69_REG_DAGC_IMPROVED_LOWBETA0},
+			{RFM69_REG_TESTAFC, 0x0A}
+		}
+	}
+};
+static uint8_t ubRadioModemProfile = RFM69_MODEM_PROFILE_25K;
+static record_fifo_t *pRadioRXPacketFIFO = NULL;
+static record_fifo_t *pRadioTXPacketFIFO = NULL;
 static rfm69_timeout_callback_fn_t pfRadioTimeoutCallback = NULL;
 static rfm69_tx_callback_fn_t pfRadioTXCallback = NULL;
 static rfm69_ack_callback_fn_t pfRadioACKCallback = NULL;
 static rfm69_rx_callback_fn_t pfRadioRXCallback = NULL;
 
 
+static void rfm69_dma_finish(uint8_t ubError)
+{
+	if(!ubRadioDMABusy)
+		return;
+
+	if(!ubError)
+	{
+		// Only spins when a register access beat the LDMA interrupt, bounded by one FIFO worth of bytes
+		while(!PERI_REG_BIT(&(LDMA->CHDONE), RFM69_DMA_RX_CHANNEL) && !(LDMA->IF & LDMA_IF_ERROR));
+
+		ubError = !PERI_REG_BIT(&(LDMA->CHDONE), RFM69_DMA_RX_CHANNEL);
+	}
+
+	RFM69_UNSELECT();
+
+	ubRadioDMABusy = 0;
+
+	if(ubError)
+	{
+		ldma_ch_disable(RFM69_DMA_TX_CHANNEL);
+		ldma_ch_disable(RFM69_DMA_RX_CHANNEL);
+
+		USART3->CMD = USART_CMD_CLEARRX | USART_CMD_CLEARTX;
+
+		ldma_ch_enable(RFM69_DMA_RX_CHANNEL);
+		ldma_ch_enable(RFM69_DMA_TX_CHANNEL);
+
+		xRadioISRStats.ulDrainErrors++;
+	}
+	else
+	{
+		record_fifo_write(pRadioRXPacketFIFO, pubRadioDMABuffer, ubRadioDMALength + 1);
+
+		xRadioISRStats.ulDrains++;
+		xRadioISRStats.ulDrainedBytes += ubRadioDMALength;
+	}
+
+	if(ubRadioTXState == RFM69_TX_STATE_IDLE || ubRadioTXState == RFM69_TX_STATE_BACKOFF) // Stay in standby if a transmission is being loaded
+		rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
+}
+static void rfm69_dma_isr(uint8_t ubError)
+{
+	rfm69_dma_finish(ubError); // No-op if a register access already finished it
+}
+static inline void rfm69_dma_wait()
+{
+	// Must be called with interrupts masked, so the LDMA interrupt cannot run in between
+	if(!ubRadioDMABusy)
+		return;
+
+	uint32_t ulStartCycles = DBG_CYCLE_COUNTER();
+
+	rfm69_dma_finish(0);
+
+	uint32_t ulCycles = DBG_CYCLE_COUNTER() - ulStartCycles;
+
+	xRadioISRStats.ulInlineFinishes++;
+	xRadioISRStats.ulInlineFinishCycles += ulCycles;
+
+	if(ulCycles > xRadioISRStats.ulMaxMaskedCycles)
+		xRadioISRStats.ulMaxMaskedCycles = ulCycles;
+}
+#if RFM69_FIFO_DRAIN_DMA
+static void rfm69_dma_start(uint8_t ubLength)
+{
+	// Chip select is held from the FIFO address and length bytes, the LDMA clocks out dummies and collects the payload
+	pRadioDMADescriptor[0].CTRL = LDMA_CH_CTRL_DSTMODE_ABSOLUTE | LDMA_CH_CTRL_SRCMODE_ABSOLUTE | LDMA_CH_CTRL_DSTINC_ONE | LDMA_CH_CTRL_SIZE_BYTE | LDMA_CH_CTRL_SRCINC_NONE | LDMA_CH_CTRL_REQMODE_BLOCK | LDMA_CH_CTRL_DONEIFSEN | LDMA_CH_CTRL_BLOCKSIZE_UNIT1 | (((ubLength - 1) << _LDMA_CH_CTRL_XFERCNT_SHIFT) & _LDMA_CH_CTRL_XFERCNT_MASK) | LDMA_CH_CTRL_STRUCTTYPE_TRANSFER;
+	pRadioDMADescriptor[0].SRC = (void *)&USART3->RXDATA;
+	pRadioDMADescriptor[0].DST = pubRadioDMABuffer + 1;
+	pRadioDMADescriptor[0].LINK = 0x00000000;
+
+	pRadioDMADescriptor[1].CTRL = LDMA_CH_CTRL_DSTMODE_ABSOLUTE | LDMA_CH_CTRL_SRCMODE_ABSOLUTE | LDMA_CH_CTRL_DSTINC_NONE | LDMA_CH_CTRL_SIZE_BYTE | LDMA_CH_CTRL_SRCINC_NONE | LDMA_CH_CTRL_REQMODE_BLOCK | LDMA_CH_CTRL_BLOCKSIZE_UNIT1 | (((ubLength - 1) << _LDMA_CH_CTRL_XFERCNT_SHIFT) & _LDMA_CH_CTRL_XFERCNT_MASK) | LDMA_CH_CTRL_STRUCTTYPE_TRANSFER;
+	pRadioDMADescriptor[1].SRC = &ubRadioDMADummy;
+	pRadioDMADescriptor[1].DST = &(USART3->TXDATA);
+	pRadioDMADescriptor[1].LINK = 0x00000000;
+
+	ubRadioDMALength = ubLength;
+	ubRadioDMABusy = 1;
+
+	USART3->CMD = USART_CMD_CLEARRX;
+
+	ldma_ch_load(RFM69_DMA_RX_CHANNEL, &pRadioDMADescriptor[0]); // RX first so no byte is missed
+	ldma_ch_load(RFM69_DMA_TX_CHANNEL, &pRadioDMADescriptor[1]);
+}
+#endif
+
+static inline uint8_t rfm69_shadow_cacheable(uint8_t ubRegister)
+{
+	// Registers the radio changes on its own (status, measurements, FIFO) or that read back as zero (AES key) always go to the bus
+	switch(ubRegister)
+	{
+		case RFM69_REG_FIFO:
+		case RFM69_REG_OSC1:
+		case RFM69_REG_VERSION:
+		case RFM69_REG_IRQFLAGS1:
+		case RFM69_REG_IRQFLAGS2:
+			return 0;
+	}
+
+	if(ubRegister >= RFM69_REG_AFCFEI && ubRegister <= RFM69_REG_RSSIVALUE)
+		return 0;
+
+	if(ubRegister >= RFM69_REG_AESKEY1 && ubRegister <= RFM69_REG_TEMP2)
+		return 0;
+
+	return ubRegister < RFM69_REGISTER_COUNT;
+}
+static inline uint8_t rfm69_shadow_valid(uint8_t ubRegister)
+{
+	return ubRegister < RFM69_REGISTER_COUNT && (pulRadioShadowValid[ubRegister >> 5] & (1UL << (ubRegister & 31)));
+}
+static inline void rfm69_shadow_store(uint8_t ubRegister, uint8_t ubValue)
+{
+	if(!rfm69_shadow_cacheable(ubRegister))
+		return;
+
+	if(ubRegister == RFM69_REG_OPMODE)
+		ubValue &= ~RFM69_REG_OPMODE_LISTENABORT; // Trigger bits read back as zero, keeping them out also means a trigger write never matches the shadow
+	else if(ubRegister == RFM69_REG_PACKETCONFIG2)
+		ubValue &= ~RFM69_REG_PACKET2_RXRESTART;
+
+	pubRadioShadow[ubRegister] = ubValue;
+	pulRadioShadowValid[ubRegister >> 5] |= 1UL << (ubRegister & 31);
+}
+static inline void rfm69_shadow_invalidate()
+{
+	memset(pulRadioShadowValid, 0, sizeof(pulRadioShadowValid));
+}
+
 static uint8_t rfm69_read_register(uint8_t ubRegister)
 {
 	uint8_t ubValue;
 
 	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 	{
-		RFM69_SELECT();
+		if(rfm69_shadow_valid(ubRegister))
+		{
+			xRadioSPIStats.ulShadowHits++;
 
-		usart3_spi_transfer_byte(ubRegister & 0x7F);
+			ubValue = pubRadioShadow[ubRegister];
+		}
+		else
+		{
+			rfm69_dma_wait(); // Do not cut into a FIFO drain
+
+			RFM69_SELECT();
 
-		ubValue = usart3_spi_transfer_byte(0);
+			usart3_spi_transfer_byte(ubRegister & 0x7F);
 
-		RFM69_UNSELECT();
+			ubValue = usart3_spi_transfer_byte(0);
+
+			RFM69_UNSELECT();
+
+			xRadioSPIStats.ulTransactions++;
+			xRadioSPIStats.ulBytes += 2;
+
+			rfm69_shadow_store(ubRegister, ubValue);
+		}
 	}
 
 	return ubValue;
 }
-static void rfm69_write_register(uint8_t ubRegister, uint8_t ubValue)
+static void rfm69_write_burst(uint8_t ubRegister, const uint8_t *pubValues, uint8_t ubCount)
 {
 	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
 	{
-		RFM69_SELECT();
+		// Only leading registers are dropped, some settings (Frf) latch on the last byte of the group
+		while(ubCount && rfm69_shadow_valid(ubRegister) && pubRadioShadow[ubRegister] == *pubValues)
+		{
+			xRadioSPIStats.ulElidedWrites++;
+
+			ubRegister++;
+			pubValues++;
+			ubCount--;
+		}
+
+		if(ubCount)
+		{
+			rfm69_dma_wait(); // Do not cut into a FIFO drain
+
+			RFM69_SELECT();
+
+			usart3_spi_transfer_byte(ubRegister | 0x80);
+			usart3_spi_write(pubValues, ubCount, 1); // Address auto-increments
+
+			RFM69_UNSELECT();
+
+			xRadioSPIStats.ulTransactions++;
+			xRadioSPIStats.ulBytes += 1 + ubCount;
+
+			for(uint8_t i = 0; i < ubCount; i++)
+				rfm69_shadow_store(ubRegister + i, pubValues[i]);
+		}
+	}
+}
+static inline void rfm69_write_register(uint8_t ubRegister, uint8_t ubValue)
+{
+	rfm69_write_burst(ubRegister, &ubValue, 1);
+}
+static void rfm69_write_registers(const rfm69_register_t *pTable, uint8_t ubCount)
+{
+	uint8_t pubBurst[RFM69_BURST_MAX_SIZE];
+
+	while(ubCount)
+	{
+		uint8_t ubRegister = pTable->ubRegister;
+		uint8_t ubSize = 0;
 
-		usart3_spi_transfer_byte(ubRegister | 0x80);
-		usart3_spi_transfer_byte(ubValue);
+		do
+		{
+			pubBurst[ubSize++] = pTable->ubValue;
+			pTable++;
+			ubCount--;
+		} while(ubCount && ubSize < RFM69_BURST_MAX_SIZE && pTable->ubRegister == ubRegister + ubSize);
 
-		RFM69_UNSELECT();
+		rfm69_write_burst(ubRegister, pubBurst, ubSize);
 	}
 }
 static void rfm69_rmw_register(uint8_t ubRegister, uint8_t ubMask, uint8_t ubValue)
@@ -54,6 +333,23 @@ static void rfm69_rmw_register(uint8_t ubRegister, uint8_t ubMask, uint8_t ubVal
 	rfm69_write_register(ubRegister, (rfm69_read_register(ubRegister) & ubMask) | ubValue);
 }
 
+static uint16_t rfm69_frame_air_bytes(uint8_t ubPayloadSize)
+{
+	uint16_t usPreambleSize = ((uint16_t)rfm69_read_register(RFM69_REG_PREAMBLEMSB) << 8) | (uint16_t)rfm69_read_register(RFM69_REG_PREAMBLELSB);
+
+	return usPreambleSize + RFM69_FRAME_OVERHEAD_SIZE + (ubRadioAESEnabled ? (ubPayloadSize + 15) & ~15 : ubPayloadSize); // AES pads the payload to whole blocks
+}
+static uint32_t rfm69_air_bytes_time(uint16_t usAirBytes)
+{
+	uint32_t ulBitPeriod = ((uint32_t)rfm69_read_register(RFM69_REG_BITRATEMSB) << 8) | (uint32_t)rfm69_read_register(RFM69_REG_BITRATELSB); // 1/32 us
+
+	return (uint32_t)((uint64_t)usAirBytes * 8 * ulBitPeriod / 32); // us
+}
+static void rfm69_update_tx_timeout()
+{
+	usRadioTXTimeout = RFM69_TX_TIMEOUT + rfm69_air_bytes_time(rfm69_frame_air_bytes(RFM69_MAX_PAYLOAD_SIZE)) / 1000;
+}
+
 static inline uint16_t rfm69_get_next_packet_id()
 {
     while(!++usRadioPacketID);
@@ -61,123 +357,549 @@ static inline uint16_t rfm69_get_next_packet_id()
     return usRadioPacketID;
 }
 
-static uint8_t rfm69_add_pending_packet(rfm69_pending_packet_t **ppList, const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubDataSize, uint16_t usRetryDelay, uint16_t usRetriesLeft)
+static inline uint32_t rfm69_timer_now()
+{
+	return (uint32_t)(g_ullSystemTick >> RFM69_TIMER_WHEEL_RESOLUTION_SHIFT);
+}
+static inline uint8_t rfm69_timer_next_slot(uint64_t ullMask, uint8_t ubFrom)
 {
-    if(!ppList)
-        return 0;
+	// Distance from ubFrom to the next occupied slot, the mask must not be empty
+	ubFrom &= RFM69_TIMER_WHEEL_SIZE - 1;
 
-    if(!pHeader)
-        return 0;
+	if(ubFrom)
+		ullMask = (ullMask >> ubFrom) | (ullMask << (RFM69_TIMER_WHEEL_SIZE - ubFrom));
 
-    rfm69_pending_packet_t *pNewPacket = (rfm69_pending_packet_t *)malloc(sizeof(rfm69_pending_packet_t));
+	return __builtin_ctzll(ullMask);
+}
+static void rfm69_timer_link(rfm69_pending_packet_t **ppSlot, rfm69_pending_packet_t *pPacket)
+{
+	pPacket->ppTimerSlot = ppSlot;
+	pPacket->pTimerPrev = NULL;
+	pPacket->pTimerNext = *ppSlot;
 
-    if(!pNewPacket)
-        return 0;
+	if(*ppSlot)
+		(*ppSlot)->pTimerPrev = pPacket;
 
-    memset(pNewPacket, 0, sizeof(rfm69_pending_packet_t));
+	*ppSlot = pPacket;
+}
+static void rfm69_timer_insert(rfm69_pending_packet_t *pPacket)
+{
+	int32_t lDelta = (int32_t)(pPacket->ulDeadline - ulRadioTimerTick);
 
-	if(pubData && ubDataSize)
+	if(lDelta <= 0)
 	{
-		pNewPacket->pubData = (uint8_t *)malloc(ubDataSize);
+		rfm69_timer_link(&pRadioTimerExpired, pPacket);
 
-		if(!pNewPacket->pubData)
+		return;
+	}
+
+	uint8_t ubLevel;
+	uint8_t ubSlot;
+
+	if(lDelta < RFM69_TIMER_WHEEL_SIZE)
+	{
+		ubLevel = 0;
+		ubSlot = pPacket->ulDeadline & (RFM69_TIMER_WHEEL_SIZE - 1);
+	}
+	else
+	{
+		uint32_t ulBlockDelta = (pPacket->ulDeadline >> RFM69_TIMER_WHEEL_BITS) - (ulRadioTimerTick >> RFM69_TIMER_WHEEL_BITS);
+
+		if(ulBlockDelta >= RFM69_TIMER_WHEEL_SIZE)
+			ulBlockDelta = RFM69_TIMER_WHEEL_SIZE - 1; // Out of range, park it in the furthest slot and place it again when it cascades
+
+		ubLevel = 1;
+		ubSlot = ((ulRadioTimerTick >> RFM69_TIMER_WHEEL_BITS) + ulBlockDelta) & (RFM69_TIMER_WHEEL_SIZE - 1);
+	}
+
+	rfm69_timer_link(&pRadioTimerWheel[ubLevel][ubSlot], pPacket);
+
+	pullRadioTimerWheelMask[ubLevel] |= 1ULL << ubSlot;
+}
+static void rfm69_timer_cancel(rfm69_pending_packet_t *pPacket)
+{
+	rfm69_pending_packet_t **ppSlot = pPacket->ppTimerSlot;
+
+	if(!ppSlot)
+		return;
+
+	if(*ppSlot == pPacket)
+		*ppSlot = pPacket->pTimerNext;
+
+	if(pPacket->pTimerPrev)
+		pPacket->pTimerPrev->pTimerNext = pPacket->pTimerNext;
+
+	if(pPacket->pTimerNext)
+		pPacket->pTimerNext->pTimerPrev = pPacket->pTimerPrev;
+
+	pPacket->ppTimerSlot = NULL;
+
+	if(*ppSlot || ppSlot == &pRadioTimerExpired)
+		return;
+
+	// Slot emptied, clear its bit
+	uint32_t ulIndex = ppSlot - &pRadioTimerWheel[0][0];
+
+	pullRadioTimerWheelMask[ulIndex >> RFM69_TIMER_WHEEL_BITS] &= ~(1ULL << (ulIndex & (RFM69_TIMER_WHEEL_SIZE - 1)));
+}
+static void rfm69_timer_schedule(rfm69_pending_packet_t *pPacket, uint16_t usDelay)
+{
+	rfm69_timer_cancel(pPacket);
+
+	// Round up so the entry never fires early
+	pPacket->ulDeadline = rfm69_timer_now() + ((usDelay + (1 << RFM69_TIMER_WHEEL_RESOLUTION_SHIFT) - 1) >> RFM69_TIMER_WHEEL_RESOLUTION_SHIFT);
+
+	rfm69_timer_insert(pPacket);
+}
+static void rfm69_timer_advance()
+{
+	uint32_t ulNow = rfm69_timer_now();
+
+	if(!pullRadioTimerWheelMask[0] && !pullRadioTimerWheelMask[1])
+	{
+		ulRadioTimerTick = ulNow; // Nothing scheduled, skip the idle ticks
+
+		return;
+	}
+
+	while(ulRadioTimerTick != ulNow)
+	{
+		ulRadioTimerTick++;
+
+		uint8_t ubSlot = ulRadioTimerTick & (RFM69_TIMER_WHEEL_SIZE - 1);
+
+		if(!ubSlot)
 		{
-			free(pNewPacket);
+			// Start of a new block, spread the matching upper level slot over the lower level
+			uint8_t ubBlockSlot = (ulRadioTimerTick >> RFM69_TIMER_WHEEL_BITS) & (RFM69_TIMER_WHEEL_SIZE - 1);
+			rfm69_pending_packet_t *pPacket = pRadioTimerWheel[1][ubBlockSlot];
 
-			return 0;
+			pRadioTimerWheel[1][ubBlockSlot] = NULL;
+			pullRadioTimerWheelMask[1] &= ~(1ULL << ubBlockSlot);
+
+			while(pPacket)
+			{
+				rfm69_pending_packet_t *pNext = pPacket->pTimerNext;
+
+				rfm69_timer_insert(pPacket);
+
+				xRadioPendingStats.ulTimerCascades++;
+
+				pPacket = pNext;
+			}
 		}
 
-		memcpy(pNewPacket->pubData, pubData, ubDataSize);
+		rfm69_pending_packet_t *pPacket = pRadioTimerWheel[0][ubSlot];
+
+		pRadioTimerWheel[0][ubSlot] = NULL;
+		pullRadioTimerWheelMask[0] &= ~(1ULL << ubSlot);
+
+		while(pPacket)
+		{
+			rfm69_pending_packet_t *pNext = pPacket->pTimerNext;
 
-    	pNewPacket->ubDataSize = ubDataSize;
+			rfm69_timer_link(&pRadioTimerExpired, pPacket);
+
+			xRadioPendingStats.ulTimerExpirations++;
+
+			pPacket = pNext;
+		}
+
+		if(!pullRadioTimerWheelMask[0] && !pullRadioTimerWheelMask[1])
+			ulRadioTimerTick = ulNow;
 	}
+}
+static uint16_t rfm69_link_index(uint8_t ubNodeID)
+{
+	// First record with a node ID not below ubNodeID
+	uint16_t usLow = 0;
+	uint16_t usHigh = usRadioLinkCount;
 
-	memcpy(&pNewPacket->sHeader, pHeader, sizeof(rfm69_packet_header_t));
+	while(usLow < usHigh)
+	{
+		uint16_t usMiddle = (usLow + usHigh) >> 1;
 
-	pNewPacket->usRetryDelay = usRetryDelay;
-	pNewPacket->usRetriesLeft = usRetriesLeft;
+		if(pRadioLinks[usMiddle].ubNodeID < ubNodeID)
+			usLow = usMiddle + 1;
+		else
+			usHigh = usMiddle;
+	}
+
+	return usLow;
+}
+static rfm69_link_t* rfm69_link_find(uint8_t ubNodeID)
+{
+	uint16_t usIndex = rfm69_link_index(ubNodeID);
+
+	if(usIndex == usRadioLinkCount || pRadioLinks[usIndex].ubNodeID != ubNodeID)
+		return NULL;
+
+	return &pRadioLinks[usIndex];
+}
+static rfm69_link_t* rfm69_link_get(uint8_t ubNodeID)
+{
+	// Find the record or insert a fresh one, inserting moves the records after it so earlier pointers become stale
+	uint16_t usIndex = rfm69_link_index(ubNodeID);
+
+	if(usIndex < usRadioLinkCount && pRadioLinks[usIndex].ubNodeID == ubNodeID)
+		return &pRadioLinks[usIndex];
+
+	if(usRadioLinkCount == usRadioLinkCapacity)
+	{
+		rfm69_link_t *pLinks = (rfm69_link_t *)realloc(pRadioLinks, (usRadioLinkCapacity + RFM69_LINK_TABLE_GROWTH) * sizeof(rfm69_link_t));
+
+		if(!pLinks)
+			return NULL;
+
+		pRadioLinks = pLinks;
+		usRadioLinkCapacity += RFM69_LINK_TABLE_GROWTH;
+	}
+
+	rfm69_link_t *pLink = &pRadioLinks[usIndex];
+
+	memmove(pLink + 1, pLink, (usRadioLinkCount - usIndex) * sizeof(rfm69_link_t));
+	memset(pLink, 0, sizeof(rfm69_link_t));
+
+	pLink->ubNodeID = ubNodeID;
+	pLink->bPowerLevel = RFM69_MAXIMUM_TX_POWER;
+	pLink->bRemoteRSSI = -128;
+	pLink->bLastRSSI = -128;
+	pLink->sRSSIAverage = -128 * 16;
+	pLink->bLastTXPower = RFM69_MAXIMUM_TX_POWER;
+	pLink->ubATCStep = 1;
+	pLink->ullATCDisturbance = g_ullSystemTick;
+
+	usRadioLinkCount++;
+
+	return pLink;
+}
+static inline int8_t rfm69_link_last_rssi(uint8_t ubNodeID)
+{
+	rfm69_link_t *pLink = rfm69_link_find(ubNodeID);
+
+	return pLink ? pLink->bLastRSSI : -128;
+}
+static inline void rfm69_link_average(int16_t *psAverage, int8_t bSample)
+{
+	*psAverage += (bSample * 16 - *psAverage) >> RFM69_LINK_RSSI_EWMA_SHIFT;
+}
+static uint8_t rfm69_link_rx(rfm69_link_t *pLink, const rfm69_packet_header_t *pHeader, int8_t bRSSI)
+{
+	// Returns 0 if the frame is a duplicate of a data frame already received
+	if(pLink->bLastRSSI == -128)
+		pLink->sRSSIAverage = bRSSI * 16;
+	else
+		rfm69_link_average(&pLink->sRSSIAverage, bRSSI);
+
+	int16_t sSNR = (pLink->sRSSIAverage - sRadioNoiseFloor) / 16;
+
+	pLink->bLastRSSI = bRSSI;
+	pLink->bSNR = sSNR > INT8_MAX ? INT8_MAX : sSNR < INT8_MIN ? INT8_MIN : sSNR;
+	pLink->ullLastSeen = g_ullSystemTick;
+
+	if(pHeader->ubACKSent || pHeader->ubRELSent || pHeader->ubRELRequested)
+		return 1; // Responses carry the ID of the packet they answer, only data frames follow the node sequence
+
+	int16_t sGap = (int16_t)(pHeader->usID - pLink->usNextID);
+
+	if(!pLink->ubIDSynced || sGap >= RFM69_LINK_MAX_ID_GAP || sGap <= -RFM69_LINK_MAX_ID_GAP)
+	{
+		pLink->usNextID = pHeader->usID + 1;
+		pLink->ulIDWindow = 1;
+		pLink->ubIDSynced = 1;
+		pLink->ulRXPackets++;
+
+		return 1;
+	}
+
+	if(sGap >= 0)
+	{
+		// Newest so far, everything skipped is a gap until it shows up
+		pLink->ulRXIDGaps += sGap;
+		pLink->ulIDWindow = sGap + 1 >= RFM69_LINK_ID_WINDOW ? 1 : (pLink->ulIDWindow << (sGap + 1)) | 1;
+		pLink->usNextID = pHeader->usID + 1;
+		pLink->ulRXPackets++;
+
+		return 1;
+	}
+
+	uint16_t usAge = -sGap - 1; // 0 for the newest one
+
+	if(usAge >= RFM69_LINK_ID_WINDOW)
+	{
+		pLink->ulRXPackets++;
+
+		return 1; // Too old to tell, let it through
+	}
+
+	if(pLink->ulIDWindow & (1UL << usAge))
+	{
+		pLink->ulRXDuplicates++;
+
+		return 0;
+	}
+
+	// Reordered, it was counted as a gap when a newer one arrived
+	pLink->ulIDWindow |= 1UL << usAge;
+	pLink->ulRXPackets++;
+
+	if(pLink->ulRXIDGaps)
+		pLink->ulRXIDGaps--;
 
-	// Insert at the head of the list
-    pNewPacket->pNext = (*ppList);
-    pNewPacket->pPrev = NULL;
+	return 1;
+}
+static void rfm69_atc_disturb(rfm69_link_t *pLink)
+{
+	pLink->ubATCSettled = 0;
+
+	if(!pLink->ubATCConverged)
+		return; // Keep timing from the first disturbance
+
+	pLink->ubATCConverged = 0;
+	pLink->ullATCDisturbance = g_ullSystemTick;
+}
+static void rfm69_atc_report(rfm69_link_t *pLink, int8_t bRemoteRSSI)
+{
+	// ATC - Power Control to target a constant RSSI at the receiver
+	pLink->ubATCLossStreak = 0;
+
+	if(!pLink->bTargetRSSI)
+	{
+		pLink->bPowerLevel = RFM69_MAXIMUM_TX_POWER; // Disabled
+
+		return;
+	}
+
+	// The report is for our last frame, normalizing by its power makes the estimate independent of our own corrections
+	int16_t sGain = (bRemoteRSSI - pLink->bLastTXPower) * 16;
+
+	if(!pLink->ubATCGainValid)
+	{
+		pLink->sATCPathGain = sGain;
+	}
+	else
+	{
+		// Deep fades are short, clamping the innovation keeps one of them from dragging the average (it tends to the median)
+		int16_t sInnovation = sGain - pLink->sATCPathGain;
+
+		if(sInnovation > RFM69_ATC_GAIN_CLAMP * 16)
+			sInnovation = RFM69_ATC_GAIN_CLAMP * 16;
+		else if(sInnovation < -RFM69_ATC_GAIN_CLAMP * 16)
+			sInnovation = -RFM69_ATC_GAIN_CLAMP * 16;
+
+		pLink->sATCPathGain += sInnovation >> RFM69_ATC_GAIN_EWMA_SHIFT;
+	}
+
+	pLink->ubATCGainValid = 1;
+
+	int16_t sError = (pLink->sATCPathGain + (pLink->bPowerLevel - pLink->bTargetRSSI) * 16) / 16; // Positive if the node would hear us louder than needed
 
-    if(*ppList)
-        (*ppList)->pPrev = pNewPacket;
+	if(sError >= -RFM69_ATC_HYSTERESIS && sError <= RFM69_ATC_HYSTERESIS)
+	{
+		pLink->bATCDirection = 0;
+		pLink->ubATCStep = 1;
+
+		if(!pLink->ubATCConverged && ++pLink->ubATCSettled >= RFM69_ATC_SETTLE_REPORTS)
+		{
+			pLink->ubATCConverged = 1;
+			pLink->ulATCConvergenceTime = g_ullSystemTick - pLink->ullATCDisturbance;
+		}
+
+		return;
+	}
 
-    (*ppList) = pNewPacket;
+	rfm69_atc_disturb(pLink);
 
-    return 1;
+	int8_t bDirection = sError > 0 ? -1 : 1;
+
+	// Keep speeding up while the error keeps the same sign, start over from the smallest step when it flips
+	if(bDirection == pLink->bATCDirection)
+		pLink->ubATCStep = pLink->ubATCStep << 1 > RFM69_ATC_MAX_STEP ? RFM69_ATC_MAX_STEP : pLink->ubATCStep << 1;
+	else
+		pLink->ubATCStep = 1;
+
+	pLink->bATCDirection = bDirection;
+
+	uint8_t ubMagnitude = sError > 0 ? sError : -sError;
+	int16_t sPowerLevel = pLink->bPowerLevel + bDirection * (ubMagnitude < pLink->ubATCStep ? ubMagnitude : pLink->ubATCStep);
+
+	pLink->bPowerLevel = sPowerLevel < RFM69_MINIMUM_TX_POWER ? RFM69_MINIMUM_TX_POWER : sPowerLevel > RFM69_MAXIMUM_TX_POWER ? RFM69_MAXIMUM_TX_POWER : sPowerLevel;
 }
-static uint8_t rfm69_remove_pending_packet(rfm69_pending_packet_t **ppList, rfm69_pending_packet_t *pPacket)
+static void rfm69_atc_loss(rfm69_link_t *pLink)
 {
-    if(!ppList)
-        return 0;
+	if(!pLink->bTargetRSSI)
+		return;
 
-    if(!pPacket)
-        return 0;
+	rfm69_atc_disturb(pLink);
 
-	free(pPacket->pubData);
+	// Consecutive losses mean the estimate is stale (the link got worse faster than the reports came), climb exponentially
+	uint8_t ubShift = pLink->ubATCLossStreak < 3 ? pLink->ubATCLossStreak : 3;
+	int16_t sPowerLevel = pLink->bPowerLevel + (RFM69_ATC_LOSS_STEP << ubShift);
 
-    if((*ppList) == pPacket)
-        (*ppList) = pPacket->pNext;
+	if(pLink->ubATCLossStreak < UINT8_MAX)
+		pLink->ubATCLossStreak++;
 
-    if(pPacket->pPrev)
-        pPacket->pPrev->pNext = pPacket->pNext;
+	pLink->bATCDirection = 0;
+	pLink->ubATCStep = 1;
+	pLink->bPowerLevel = sPowerLevel > RFM69_MAXIMUM_TX_POWER ? RFM69_MAXIMUM_TX_POWER : sPowerLevel;
+}
 
-    if(pPacket->pNext)
-        pPacket->pNext->pPrev = pPacket->pPrev;
+static inline uint8_t rfm69_pending_hash(uint16_t usID, uint8_t ubNodeID)
+{
+	return (usID ^ (usID >> 8) ^ ((uint16_t)ubNodeID << 3)) & (RFM69_PENDING_HASH_BUCKETS - 1);
+}
+static void rfm69_reset_pending_packets()
+{
+	memset(pRadioPendingBuckets, 0, sizeof(pRadioPendingBuckets));
+	memset(&xRadioPendingStats, 0, sizeof(rfm69_pending_stats_t));
+
+	memset(pRadioTimerWheel, 0, sizeof(pRadioTimerWheel));
+	memset(pullRadioTimerWheelMask, 0, sizeof(pullRadioTimerWheelMask));
+
+	pRadioPendingFree = NULL;
+	pRadioTimerExpired = NULL;
+	ulRadioTimerTick = rfm69_timer_now();
 
-    free(pPacket);
+	for(uint16_t usI = RFM69_PENDING_SLAB_SIZE; usI--;)
+	{
+		pRadioPendingSlab[usI].ubState = RFM69_PENDING_STATE_FREE;
+		pRadioPendingSlab[usI].ppTimerSlot = NULL;
+		pRadioPendingSlab[usI].pNext = pRadioPendingFree;
+
+		pRadioPendingFree = &pRadioPendingSlab[usI];
+	}
 
-    return 1;
+	xRadioPendingStats.usCapacity = RFM69_PENDING_SLAB_SIZE;
 }
-static rfm69_pending_packet_t* rfm69_find_pending_packet(rfm69_pending_packet_t *pList, uint16_t usID, uint8_t ubNodeID)
+static rfm69_pending_packet_t* rfm69_add_pending_packet(uint8_t ubState, const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubDataSize, uint16_t usRetryDelay, uint16_t usRetriesLeft)
 {
-    if(!usID)
+	if(!pHeader)
 		return NULL;
 
-	for(rfm69_pending_packet_t *pPacket = pList; pPacket; pPacket = pPacket->pNext)
+	if(ubDataSize > RFM69_MAX_DATA_SIZE)
+		return NULL;
+
+	rfm69_pending_packet_t *pNewPacket = pRadioPendingFree;
+
+	if(!pNewPacket)
 	{
-		if(pPacket->sHeader.usID == usID && pPacket->sHeader.ubReceiverNodeID == ubNodeID)
-			return pPacket;
+		xRadioPendingStats.ulAllocFailures++;
+
+		return NULL;
 	}
 
-	return NULL;
+	pRadioPendingFree = pNewPacket->pNext;
+
+	memcpy(&pNewPacket->sHeader, pHeader, sizeof(rfm69_packet_header_t));
+
+	if(pubData && ubDataSize)
+		memcpy(pNewPacket->pubData, pubData, ubDataSize);
+	else
+		ubDataSize = 0;
+
+	pNewPacket->ubDataSize = ubDataSize;
+	pNewPacket->ubState = ubState;
+	pNewPacket->ubInTX = 0;
+	pNewPacket->usRetryDelay = usRetryDelay;
+	pNewPacket->usRetriesLeft = usRetriesLeft;
+	pNewPacket->ullLastRetry = 0;
+	pNewPacket->ppTimerSlot = NULL;
+
+	// Insert at the head of the bucket
+	rfm69_pending_packet_t **ppBucket = &pRadioPendingBuckets[rfm69_pending_hash(pHeader->usID, pHeader->ubReceiverNodeID)];
+
+	pNewPacket->pNext = *ppBucket;
+	pNewPacket->pPrev = NULL;
+
+	if(*ppBucket)
+		(*ppBucket)->pPrev = pNewPacket;
+
+	*ppBucket = pNewPacket;
+
+	xRadioPendingStats.usUsed++;
+	xRadioPendingStats.pusStateCount[ubState]++;
+
+	if(xRadioPendingStats.usUsed > xRadioPendingStats.usPeakUsed)
+		xRadioPendingStats.usPeakUsed = xRadioPendingStats.usUsed;
+
+	rfm69_timer_schedule(pNewPacket, 0); // First transmission is due right away
+
+	return pNewPacket;
 }
-static uint8_t rfm69_clear_pending_packets(rfm69_pending_packet_t **ppList)
+static void rfm69_remove_pending_packet(rfm69_pending_packet_t *pPacket)
 {
-    if(!ppList)
-        return 0;
+	if(!pPacket || pPacket->ubState == RFM69_PENDING_STATE_FREE)
+		return;
+
+	rfm69_timer_cancel(pPacket);
+
+	rfm69_pending_packet_t **ppBucket = &pRadioPendingBuckets[rfm69_pending_hash(pPacket->sHeader.usID, pPacket->sHeader.ubReceiverNodeID)];
+
+	if(*ppBucket == pPacket)
+		*ppBucket = pPacket->pNext;
 
-    while(*ppList)
-    {
-        rfm69_pending_packet_t *pPacket = (*ppList);
+	if(pPacket->pPrev)
+		pPacket->pPrev->pNext = pPacket->pNext;
 
-        (*ppList) = pPacket->pNext;
+	if(pPacket->pNext)
+		pPacket->pNext->pPrev = pPacket->pPrev;
 
-		free(pPacket->pubData);
-        free(pPacket);
-    }
+	xRadioPendingStats.usUsed--;
+	xRadioPendingStats.pusStateCount[pPacket->ubState]--;
+
+	pPacket->ubState = RFM69_PENDING_STATE_FREE;
+	pPacket->pNext = pRadioPendingFree;
+
+	pRadioPendingFree = pPacket;
+}
+static void rfm69_move_pending_packet(rfm69_pending_packet_t *pPacket, uint8_t ubState, const rfm69_packet_header_t *pHeader, uint16_t usRetryDelay, uint16_t usRetriesLeft)
+{
+	// Same peer and ID, so the entry stays in its bucket
+	xRadioPendingStats.pusStateCount[pPacket->ubState]--;
+	xRadioPendingStats.pusStateCount[ubState]++;
+
+	memcpy(&pPacket->sHeader, pHeader, sizeof(rfm69_packet_header_t));
+
+	pPacket->ubDataSize = 0;
+	pPacket->ubState = ubState;
+	pPacket->ubInTX = 0;
+	pPacket->usRetryDelay = usRetryDelay;
+	pPacket->usRetriesLeft = usRetriesLeft;
+	pPacket->ullLastRetry = 0;
+
+	rfm69_timer_schedule(pPacket, 0);
+}
+static rfm69_pending_packet_t* rfm69_find_pending_packet(uint8_t ubState, uint16_t usID, uint8_t ubNodeID)
+{
+	if(!usID)
+		return NULL;
+
+	for(rfm69_pending_packet_t *pPacket = pRadioPendingBuckets[rfm69_pending_hash(usID, ubNodeID)]; pPacket; pPacket = pPacket->pNext)
+	{
+		if(pPacket->sHeader.usID == usID && pPacket->sHeader.ubReceiverNodeID == ubNodeID && pPacket->ubState == ubState)
+			return pPacket;
+	}
 
-    return 1;
+	return NULL;
 }
 
 static uint8_t rfm69_pack_header(const rfm69_packet_header_t *pHeader, uint8_t *pubBuffer, uint8_t ubBufferSize)
 {
-    if(!pubBuffer || !ubBufferSize)
+	if(!pubBuffer || !ubBufferSize)
 		return 0;
 
 	if(ubBufferSize < RFM69_PACKET_HEADER_SIZE)
 		return 0;
 
-    if(!pHeader)
-        return 0;
+	if(!pHeader)
+		return 0;
 
 	uint8_t ubFlags = ((!!pHeader->ubACKRequested) << RFM69_CTL_ACKR) |
 					  ((!!pHeader->ubACKSent) << RFM69_CTL_ACKS) |
 					  ((!!pHeader->ubRELRequested) << RFM69_CTL_RELR) |
 					  ((!!pHeader->ubRELSent) << RFM69_CTL_RELS) |
-					  ((!!pHeader->ubQoSLevel) << RFM69_CTL_QOS);
+					  ((!!pHeader->ubQoSLevel) << RFM69_CTL_QOS) |
+					  ((!!pHeader->ubAggregated) << RFM69_CTL_AGG);
 
 	memcpy(pubBuffer, &ubFlags, sizeof(uint8_t));
 
@@ -203,14 +925,14 @@ static uint8_t rfm69_pack_header(const rfm69_packet_header_t *pHeader, uint8_t *
 }
 static uint8_t rfm69_unpack_header(rfm69_packet_header_t *pHeader, const uint8_t *pubBuffer, uint8_t ubBufferSize)
 {
-    if(!pubBuffer || !ubBufferSize)
+	if(!pubBuffer || !ubBufferSize)
 		return 0;
 
 	if(ubBufferSize < RFM69_PACKET_HEADER_SIZE)
 		return 0;
 
-    if(!pHeader)
-        return 0;
+	if(!pHeader)
+		return 0;
 
 	uint8_t ubFlags;
 
@@ -223,6 +945,7 @@ static uint8_t rfm69_unpack_header(rfm69_packet_header_t *pHeader, const uint8_t
 	pHeader->ubRELRequested = !!(ubFlags & BIT(RFM69_CTL_RELR));
 	pHeader->ubRELSent = !!(ubFlags & BIT(RFM69_CTL_RELS));
 	pHeader->ubQoSLevel = !!(ubFlags & BIT(RFM69_CTL_QOS));
+	pHeader->ubAggregated = !!(ubFlags & BIT(RFM69_CTL_AGG));
 
 	memcpy(&pHeader->usID, pubBuffer, sizeof(uint16_t));
 
@@ -244,14 +967,14 @@ static uint8_t rfm69_unpack_header(rfm69_packet_header_t *pHeader, const uint8_t
 }
 static uint8_t rfm69_build_payload(const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubDataSize, uint8_t *pubBuffer, uint8_t ubBufferSize, uint8_t *pubPayloadSize)
 {
-    if(!pubBuffer || !ubBufferSize)
+	if(!pubBuffer || !ubBufferSize)
 		return 0;
 
 	if(ubBufferSize < ubDataSize + RFM69_PACKET_HEADER_SIZE)
 		return 0;
 
-    if(!pHeader)
-        return 0;
+	if(!pHeader)
+		return 0;
 
 	if(ubDataSize > RFM69_MAX_DATA_SIZE)
 		return 0;
@@ -274,7 +997,7 @@ static uint8_t rfm69_build_payload(const rfm69_packet_header_t *pHeader, const u
 }
 static uint8_t rfm69_parse_payload(rfm69_packet_header_t *pHeader, uint8_t **ppubData, uint8_t *pubDataSize, uint8_t *pubBuffer, uint8_t ubBufferSize)
 {
-    if(!pubBuffer || !ubBufferSize)
+	if(!pubBuffer || !ubBufferSize)
 		return 0;
 
 	if(ubBufferSize < RFM69_PACKET_HEADER_SIZE)
@@ -304,82 +1027,193 @@ static uint8_t rfm69_build_pending_packet_payload(const rfm69_pending_packet_t *
 
 	return rfm69_build_payload(&pPacket->sHeader, pPacket->pubData, pPacket->ubDataSize, pubBuffer, ubBufferSize, pubPayloadSize);
 }
+static uint8_t rfm69_queue_frame(const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubDataSize, uint8_t ubQoSLevel, uint16_t usRetryDelay, uint16_t usRetries)
+{
+	if(!ubQoSLevel)
+	{
+		uint8_t pubBuffer[RFM69_MAX_PAYLOAD_SIZE];
+		uint8_t ubPayloadSize;
 
-uint8_t rfm69_init(uint8_t ubNodeID, uint8_t ubNetID, const void *pvEncKey)
+		if(!rfm69_build_payload(pHeader, pubData, ubDataSize, pubBuffer, RFM69_MAX_PAYLOAD_SIZE, &ubPayloadSize))
+			return 0;
+
+		return record_fifo_write(pRadioTXPacketFIFO, pubBuffer, ubPayloadSize);
+	}
+
+	return !!rfm69_add_pending_packet(RFM69_PENDING_STATE_ACK, pHeader, pubData, ubDataSize, usRetryDelay, usRetries);
+}
+static void rfm69_deliver(const rfm69_packet_header_t *pHeader, int8_t bRSSI, const uint8_t *pubData, uint8_t ubDataSize)
 {
-	free(pbRadioATCPowerLevel);
-	free(pbRadioATCTargetRemoteRSSI);
-	free(pbRadioATCRemoteRSSI);
-	free(pbRadioLastRSSI);
+	if(!pfRadioRXCallback || !pubData || !ubDataSize)
+		return;
+
+	if(!pHeader->ubAggregated)
+	{
+		pfRadioRXCallback(pHeader, bRSSI, pubData, ubDataSize);
+
+		return;
+	}
 
-	blob_fifo_delete(pRadioTXPacketFIFO);
-	blob_fifo_delete(pRadioRXPacketFIFO);
+	while(ubDataSize)
+	{
+		uint8_t ubSize = *pubData++;
 
-	pbRadioATCPowerLevel = (int8_t *)malloc(256);
+		ubDataSize--;
 
-	if(!pbRadioATCPowerLevel)
-		return 0;
+		if(!ubSize || ubSize > ubDataSize)
+			break; // Malformed, drop the rest of the frame
 
-	pbRadioATCTargetRemoteRSSI = (int8_t *)malloc(256);
+		pfRadioRXCallback(pHeader, bRSSI, pubData, ubSize);
+
+		pubData += ubSize;
+		ubDataSize -= ubSize;
+	}
+}
 
-	if(!pbRadioATCTargetRemoteRSSI)
+static uint8_t rfm69_aggregate_flush(rfm69_aggregate_t *pAggregate)
+{
+	// Returns 0 if the frame could not be queued, the aggregate is then left as it is and rfm69_tick() tries again
+	if(!pAggregate->ubCount)
+		return 1;
+
+	uint8_t ubQueued;
+
+	pAggregate->sHeader.bRemoteRSSI = rfm69_link_last_rssi(pAggregate->sHeader.ubReceiverNodeID);
+
+	if(pAggregate->ubCount == 1)
 	{
-		free(pbRadioATCPowerLevel);
+		// Nobody joined, send it as a plain frame without the length prefix
+		pAggregate->sHeader.ubAggregated = 0;
 
-		return 0;
+		ubQueued = rfm69_queue_frame(&pAggregate->sHeader, pAggregate->pubData + 1, pAggregate->pubData[0], pAggregate->ubQoSLevel, pAggregate->usRetryDelay, pAggregate->usRetries);
 	}
+	else
+	{
+		pAggregate->sHeader.ubAggregated = 1;
 
-	pbRadioATCRemoteRSSI = (int8_t *)malloc(256);
+		ubQueued = rfm69_queue_frame(&pAggregate->sHeader, pAggregate->pubData, pAggregate->ubDataSize, pAggregate->ubQoSLevel, pAggregate->usRetryDelay, pAggregate->usRetries);
 
-	if(!pbRadioATCRemoteRSSI)
+		if(ubQueued)
+		{
+			xRadioTXStats.ulAggregatedFrames++;
+			xRadioTXStats.ulAggregatedMessages += pAggregate->ubCount;
+		}
+	}
+
+	if(!ubQueued)
 	{
-		free(pbRadioATCPowerLevel);
-		free(pbRadioATCTargetRemoteRSSI);
+		xRadioTXStats.ulAggregationStalls++;
 
-		return 0;
+		return 0; // rfm69_send() already accepted these messages, they must not be dropped
 	}
 
-	pbRadioLastRSSI = (int8_t *)malloc(256);
+	pAggregate->ubCount = 0;
+	pAggregate->ubDataSize = 0;
 
-	if(!pbRadioLastRSSI)
+	return 1;
+}
+static void rfm69_aggregate_flush_all()
+{
+	for(uint8_t i = 0; i < RFM69_AGGREGATION_SLOTS; i++)
+		rfm69_aggregate_flush(&pRadioAggregates[i]);
+}
+static void rfm69_aggregate_flush_expired()
+{
+	for(uint8_t i = 0; i < RFM69_AGGREGATION_SLOTS; i++)
+		if(pRadioAggregates[i].ubCount && g_ullSystemTick >= pRadioAggregates[i].ullDeadline)
+			rfm69_aggregate_flush(&pRadioAggregates[i]);
+}
+static rfm69_aggregate_t* rfm69_find_aggregate(uint8_t ubReceiver, uint8_t ubQoSLevel, uint16_t usRetryDelay, uint16_t usRetries)
+{
+	for(uint8_t i = 0; i < RFM69_AGGREGATION_SLOTS; i++)
 	{
-		free(pbRadioATCPowerLevel);
-		free(pbRadioATCTargetRemoteRSSI);
-		free(pbRadioATCRemoteRSSI);
+		rfm69_aggregate_t *pAggregate = &pRadioAggregates[i];
 
-		return 0;
+		if(!pAggregate->ubCount)
+			continue;
+
+		if(pAggregate->sHeader.ubReceiverNodeID == ubReceiver && pAggregate->ubQoSLevel == ubQoSLevel && pAggregate->usRetryDelay == usRetryDelay && pAggregate->usRetries == usRetries)
+			return pAggregate;
 	}
 
-	pRadioRXPacketFIFO = blob_fifo_init(NULL, RFM69_RX_PACKET_FIFO_SIZE);
+	return NULL;
+}
+static rfm69_aggregate_t* rfm69_alloc_aggregate()
+{
+	rfm69_aggregate_t *pOldest = &pRadioAggregates[0];
 
-	if(!pRadioRXPacketFIFO)
+	for(uint8_t i = 0; i < RFM69_AGGREGATION_SLOTS; i++)
 	{
-		free(pbRadioATCPowerLevel);
-		free(pbRadioATCTargetRemoteRSSI);
-		free(pbRadioATCRemoteRSSI);
-		free(pbRadioLastRSSI);
+		if(!pRadioAggregates[i].ubCount)
+			return &pRadioAggregates[i];
 
-		return 0;
+		if(pRadioAggregates[i].ullDeadline < pOldest->ullDeadline)
+			pOldest = &pRadioAggregates[i];
 	}
 
-	pRadioTXPacketFIFO = blob_fifo_init(NULL, RFM69_TX_PACKET_FIFO_SIZE);
+	if(!rfm69_aggregate_flush(pOldest)) // All busy, the one closest to its deadline goes out early
+		return NULL;
+
+	return pOldest;
+}
+
+uint8_t rfm69_init(uint8_t ubNodeID, uint8_t ubNetID, const void *pvEncKey)
+{
+	free(pRadioLinks);
+
+	pRadioLinks = NULL; // Grows as nodes show up
+	usRadioLinkCount = 0;
+	usRadioLinkCapacity = 0;
+	sRadioNoiseFloor = RFM69_NORMAL_RX_SENSITIVITY * 16;
+
+	record_fifo_delete(pRadioTXPacketFIFO);
+	record_fifo_delete(pRadioRXPacketFIFO);
+
+	pRadioRXPacketFIFO = record_fifo_init(NULL, RFM69_RX_PACKET_FIFO_SIZE);
+
+	if(!pRadioRXPacketFIFO)
+		return 0;
+
+	pRadioTXPacketFIFO = record_fifo_init(NULL, RFM69_TX_PACKET_FIFO_SIZE);
 
 	if(!pRadioTXPacketFIFO)
 	{
-		free(pbRadioATCPowerLevel);
-		free(pbRadioATCTargetRemoteRSSI);
-		free(pbRadioATCRemoteRSSI);
-		free(pbRadioLastRSSI);
-
-		blob_fifo_delete(pRadioRXPacketFIFO);
+		record_fifo_delete(pRadioRXPacketFIFO);
 
 		return 0;
 	}
 
-	memset(pbRadioATCPowerLevel, RFM69_MAXIMUM_TX_POWER, 256);
-	memset(pbRadioATCTargetRemoteRSSI, 0, 256);
-	memset(pbRadioATCRemoteRSSI, -128, 256);
-	memset(pbRadioLastRSSI, -128, 256);
+	rfm69_reset_pending_packets();
+
+	memset(pRadioAggregates, 0, sizeof(pRadioAggregates));
+	memset(&xRadioISRStats, 0, sizeof(rfm69_isr_stats_t));
+	memset(&xRadioTXStats, 0, sizeof(rfm69_tx_stats_t));
+	memset(&xRadioSPIStats, 0, sizeof(rfm69_spi_stats_t));
+
+	ullRadioAirtime = 0;
+
+	ubRadioDMABusy = 0;
+	ubRadioTXState = RFM69_TX_STATE_IDLE;
+	ubRadioModeSettling = 0;
+	ubRadioCurrentMode = RFM69_REG_OPMODE_STANDBY; // Where the reset below leaves the chip
+
+	ldma_ch_disable(RFM69_DMA_RX_CHANNEL);
+	ldma_ch_peri_req_disable(RFM69_DMA_RX_CHANNEL);
+	ldma_ch_req_clear(RFM69_DMA_RX_CHANNEL);
+	ldma_ch_disable(RFM69_DMA_TX_CHANNEL);
+	ldma_ch_peri_req_disable(RFM69_DMA_TX_CHANNEL);
+	ldma_ch_req_clear(RFM69_DMA_TX_CHANNEL);
+
+	ldma_ch_config(RFM69_DMA_RX_CHANNEL, LDMA_CH_REQSEL_SOURCESEL_USART3 | LDMA_CH_REQSEL_SIGSEL_USART3RXDATAV, LDMA_CH_CFG_SRCINCSIGN_DEFAULT, LDMA_CH_CFG_DSTINCSIGN_POSITIVE, LDMA_CH_CFG_ARBSLOTS_DEFAULT, 0);
+	ldma_ch_set_isr(RFM69_DMA_RX_CHANNEL, rfm69_dma_isr);
+	ldma_ch_config(RFM69_DMA_TX_CHANNEL, LDMA_CH_REQSEL_SOURCESEL_USART3 | LDMA_CH_REQSEL_SIGSEL_USART3TXBL, LDMA_CH_CFG_SRCINCSIGN_DEFAULT, LDMA_CH_CFG_DSTINCSIGN_DEFAULT, LDMA_CH_CFG_ARBSLOTS_DEFAULT, 0);
+
+	ldma_ch_peri_req_enable(RFM69_DMA_RX_CHANNEL);
+	ldma_ch_enable(RFM69_DMA_RX_CHANNEL);
+	ldma_ch_peri_req_enable(RFM69_DMA_TX_CHANNEL);
+	ldma_ch_enable(RFM69_DMA_TX_CHANNEL);
+
+	rfm69_shadow_invalidate(); // Everything goes back to its reset value
 
 	RFM69_RESET();
 	delay_ms(10);
@@ -390,6 +1224,7 @@ uint8_t rfm69_init(uint8_t ubNodeID, uint8_t ubNetID, const void *pvEncKey)
 	if(rfm69_read_register(RFM69_REG_VERSION) == 0x24)
 	{
 		ubRadioNodeID = ubNodeID;
+		ubRadioAESEnabled = pvEncKey != 0;
 
 		// ...---------|------------|-----------|-----------|------------|---------...
 		//           RxBw          Fdev       Carrier      Fdev          RxBw
@@ -400,59 +1235,57 @@ uint8_t rfm69_init(uint8_t ubNodeID, uint8_t ubNetID, const void *pvEncKey)
 		// 4)  RxBwAfc >=  Fdev + (BR / 2) + LOoffset	(receiver AFC bandwidth)
 		// 5)  Fdev + (BR / 2) < 500kHz					(maximum RxBw setting)
 
-		rfm69_write_register(RFM69_REG_OPMODE, RFM69_REG_OPMODE_STANDBY); // RegOpMode: Standby
-		rfm69_write_register(RFM69_REG_DATAMODUL, RFM69_REG_DATAMODUL_DATAMODE_PACKET | RFM69_REG_DATAMODUL_MODULATIONTYPE_FSK | RFM69_REG_DATAMODUL_MODULATIONSHAPING_00); // RegDataModul: Packet mode, FSK, no shaping
-		rfm69_write_register(RFM69_REG_BITRATEMSB, RFM69_REG_BITRATEMSB_25000); // RegBitrateMsb: 25,000 bps
-		rfm69_write_register(RFM69_REG_BITRATELSB, RFM69_REG_BITRATELSB_25000); // RegBitrateLsb
-		rfm69_write_register(RFM69_REG_FDEVMSB, RFM69_REG_FDEVMSB_20000); // RegFdevMsb: 20 kHz Single-side TX Deviation
-		rfm69_write_register(RFM69_REG_FDEVLSB, RFM69_REG_FDEVLSB_20000); // RegFdevLsb
-		rfm69_write_register(RFM69_REG_FRFMSB, RFM69_REG_FRFMSB_868 + 0x00); // RegFrfMsb: 868,2 MHz
-		rfm69_write_register(RFM69_REG_FRFMID, RFM69_REG_FRFMID_868 + 0x0C); // RegFrfMid
-		rfm69_write_register(RFM69_REG_FRFLSB, RFM69_REG_FRFLSB_868 + 0xCC); // RegFrfLsb
-		rfm69_write_register(RFM69_REG_AFCCTRL, RFM69_REG_AFCCTRL_LOWBETA_OFF); // RegAfcCtrl: Disable Low beta AFC
-		rfm69_write_register(RFM69_REG_LISTEN1, RFM69_REG_LISTEN1_RESOL_IDLE_262000 | RFM69_REG_LISTEN1_RESOL_RX_64 | RFM69_REG_LISTEN1_CRITERIA_RSSIANDSYNC | RFM69_REG_LISTEN1_END_10); // RegListen1: Idle resolution 4.1ms, RX resolution 64us, RSSI and Sync to receive packet, stay in listen mode after IRQ
-		rfm69_write_register(RFM69_REG_LISTEN2, 0x06); // RegListen2: 1572 ms idle (6 * 262 ms)
-		rfm69_write_register(RFM69_REG_LISTEN3, 0x50); // RegListen3: 5120 us RX (80 * 64 us)
-		rfm69_write_register(RFM69_REG_PALEVEL, RFM69_REG_PALEVEL_PA1_ON | RFM69_REG_PALEVEL_OUTPUTPOWER_10000); // RegPaLevel: Enable PA1 with minimum power
-		rfm69_write_register(RFM69_REG_PARAMP, RFM69_REG_PARAMP_40); // RegPaRamp: 40us PA Ramp time
-		rfm69_write_register(RFM69_REG_OCP, RFM69_REG_OCP_OFF); // RegOcp: OCP off because we only use H (High Power) devices
-		rfm69_write_register(RFM69_REG_LNA, RFM69_REG_LNA_ZIN_50 | RFM69_REG_LNA_GAINSELECT_AUTO); // RegLNA: 50 Ohm impedance, gain set by AGC loop
-		rfm69_write_register(RFM69_REG_RXBW, RFM69_REG_RXBW_DCCFREQ_010 | RFM69_REG_RXBW_MANT_24 | RFM69_REG_RXBW_EXP_3); // RegRxBw: DCCFreq = 4% RxBw, 41,7 kHz Single-side RX Bandwidth
-		rfm69_write_register(RFM69_REG_AFCBW, RFM69_REG_AFCBW_DCCFREQAFC_100 | RFM69_REG_AFCBW_MANTAFC_16 | RFM69_REG_AFCBW_EXPAFC_2); // RegAfcBw: DCCFreqAfc = 1% RxBwAfc, 125 kHz Single-side RX Bandwidth during AFC
-		rfm69_write_register(RFM69_REG_AFCFEI, RFM69_REG_AFCFEI_AFCAUTO_OFF | RFM69_REG_AFCFEI_AFCAUTOCLEAR_OFF); // RegAfcFei: Disable auto AFC on receiver startup
-		rfm69_write_register(RFM69_REG_DIOMAPPING1, RFM69_REG_DIOMAPPING1_DIO0_01); // RegDioMapping1: Pin DIO0 outputs PayloadReady
-		rfm69_write_register(RFM69_REG_DIOMAPPING2, RFM69_REG_DIOMAPPING2_CLKOUT_OFF); // RegDioMapping2: Disable CLKOUT on DIO5 to save power
-		rfm69_write_register(RFM69_REG_RSSITHRESH, -(RFM69_NORMAL_RX_SENSITIVITY) << 1); // RegRssiThresh: Min RSSI to start receiving
-		rfm69_write_register(RFM69_REG_RXTIMEOUT1, 0x00); // RegRxTimeout1: No timeout if no RSSI detected
-		rfm69_write_register(RFM69_REG_RXTIMEOUT2, 0x57); // RegRxTimeout2: Timeout after Rssi interrupt and no PayloadReady interrupt (~55ms)
-		rfm69_write_register(RFM69_REG_PREAMBLEMSB, 0x00); // RegPreambleMsb: 5 bytes preamble
-		rfm69_write_register(RFM69_REG_PREAMBLELSB, 0x05); // RegPreambleLsb
-		rfm69_write_register(RFM69_REG_SYNCCONFIG, RFM69_REG_SYNC_ON | RFM69_REG_SYNC_SIZE_3); // RegSyncConfig: Enable sync word, 3 bytes sync word
-		rfm69_write_register(RFM69_REG_SYNCVALUE1, 0x21); // RegSyncValue1: 0x21 (Hardcoded)
-		rfm69_write_register(RFM69_REG_SYNCVALUE2, 0x29); // RegSyncValue2: 0x29 (Hardcoded)
-		rfm69_write_register(RFM69_REG_SYNCVALUE3, ubNetID); // RegSyncValue3: Network ID
-		rfm69_write_register(RFM69_REG_PACKETCONFIG1, RFM69_REG_PACKET1_FORMAT_VARIABLE | RFM69_REG_PACKET1_DCFREE_WHITENING | RFM69_REG_PACKET1_CRC_ON); // RegPacketConfig1: Variable length, CRC on, whitening, Address match off
-		rfm69_write_register(RFM69_REG_PAYLOADLENGTH, 0x41); // RegPayloadLength: 65 bytes max payload (length byte)
-		rfm69_write_register(RFM69_REG_NODEADRS, 0x00); // RegNodeAdrs: Node Address (Not used)
-		rfm69_write_register(RFM69_REG_BROADCASTADRS, 0xFF); // RegBroadcastAdrs: Broadcast Address
-		rfm69_write_register(RFM69_REG_FIFOTHRESH, RFM69_REG_FIFOTHRESH_TXSTART_FIFONOTEMPTY | 0x0F); // RegFifoThresh: TxStart on FifoNotEmpty, 15 bytes FifoLevel
-		rfm69_write_register(RFM69_REG_PACKETCONFIG2, RFM69_REG_PACKET2_RXRESTARTDELAY_2BITS | RFM69_REG_PACKET2_AUTORXRESTART_ON | (pvEncKey == 0 ? RFM69_REG_PACKET2_AES_OFF : RFM69_REG_PACKET2_AES_ON)); // RegPacketConfig2: RX restart delay exp = 2, Auto RX restart, AES on/off
-        rfm69_write_register(RFM69_REG_TESTLNA, RFM69_REG_TESTLNA_NORMAL); // RegTestLna: Recommended value
-        rfm69_write_register(RFM69_REG_TESTDAGC, RFM69_REG_DAGC_IMPROVED_LOWBETA0); // RegTestDagc: Recommended value
-		rfm69_write_register(RFM69_REG_TESTAFC, 0x03); // RegTestAfc: Recommended AFC offset 10% Fdev. Unit: 488 Hz (AfcOffset > DCCFreqAfc)
+		const rfm69_modem_profile_t *pProfile = &pRadioModemProfiles[RFM69_MODEM_PROFILE_25K];
+		rfm69_register_t pRegisters[] = { // Address order, the modem profile is merged in so contiguous runs go out in one burst
+			{RFM69_REG_OPMODE, RFM69_REG_OPMODE_STANDBY}, // RegOpMode: Standby
+			{RFM69_REG_DATAMODUL, RFM69_REG_DATAMODUL_DATAMODE_PACKET | RFM69_REG_DATAMODUL_MODULATIONTYPE_FSK | RFM69_REG_DATAMODUL_MODULATIONSHAPING_00}, // RegDataModul: Packet mode, FSK, no shaping
+			{RFM69_REG_FRFMSB, RFM69_REG_FRFMSB_868 + 0x00}, // RegFrfMsb: 868,2 MHz
+			{RFM69_REG_FRFMID, RFM69_REG_FRFMID_868 + 0x0C}, // RegFrfMid
+			{RFM69_REG_FRFLSB, RFM69_REG_FRFLSB_868 + 0xCC}, // RegFrfLsb
+			{RFM69_REG_LISTEN1, RFM69_REG_LISTEN1_RESOL_IDLE_262000 | RFM69_REG_LISTEN1_RESOL_RX_64 | RFM69_REG_LISTEN1_CRITERIA_RSSIANDSYNC | RFM69_REG_LISTEN1_END_10}, // RegListen1: Idle resolution 4.1ms, RX resolution 64us, RSSI and Sync to receive packet, stay in listen mode after IRQ
+			{RFM69_REG_LISTEN2, 0x06}, // RegListen2: 1572 ms idle (6 * 262 ms)
+			{RFM69_REG_LISTEN3, 0x50}, // RegListen3: 5120 us RX (80 * 64 us)
+			{RFM69_REG_PALEVEL, RFM69_REG_PALEVEL_PA1_ON | RFM69_REG_PALEVEL_OUTPUTPOWER_10000}, // RegPaLevel: Enable PA1 with minimum power
+			{RFM69_REG_PARAMP, RFM69_REG_PARAMP_40}, // RegPaRamp: 40us PA Ramp time
+			{RFM69_REG_OCP, RFM69_REG_OCP_OFF}, // RegOcp: OCP off because we only use H (High Power) devices
+			{RFM69_REG_LNA, RFM69_REG_LNA_ZIN_50 | RFM69_REG_LNA_GAINSELECT_AUTO}, // RegLNA: 50 Ohm impedance, gain set by AGC loop
+			{RFM69_REG_DIOMAPPING1, RFM69_REG_DIOMAPPING1_DIO0_01}, // RegDioMapping1: Pin DIO0 outputs PayloadReady
+			{RFM69_REG_DIOMAPPING2, RFM69_REG_DIOMAPPING2_CLKOUT_OFF}, // RegDioMapping2: Disable CLKOUT on DIO5 to save power
+			{RFM69_REG_RSSITHRESH, -(RFM69_NORMAL_RX_SENSITIVITY) << 1}, // RegRssiThresh: Min RSSI to start receiving
+			{RFM69_REG_RXTIMEOUT1, 0x00}, // RegRxTimeout1: No timeout if no RSSI detected
+			{RFM69_REG_RXTIMEOUT2, 0x57}, // RegRxTimeout2: Timeout after Rssi interrupt and no PayloadReady interrupt (1392 bits, longer than the longest frame at any profile)
+			{RFM69_REG_SYNCCONFIG, RFM69_REG_SYNC_ON | RFM69_REG_SYNC_SIZE_3}, // RegSyncConfig: Enable sync word, 3 bytes sync word
+			{RFM69_REG_SYNCVALUE1, 0x21}, // RegSyncValue1: 0x21 (Hardcoded)
+			{RFM69_REG_SYNCVALUE2, 0x29}, // RegSyncValue2: 0x29 (Hardcoded)
+			{RFM69_REG_SYNCVALUE3, ubNetID}, // RegSyncValue3: Network ID
+			{RFM69_REG_PACKETCONFIG1, RFM69_REG_PACKET1_FORMAT_VARIABLE | RFM69_REG_PACKET1_DCFREE_WHITENING | RFM69_REG_PACKET1_CRC_ON}, // RegPacketConfig1: Variable length, CRC on, whitening, Address match off
+			{RFM69_REG_PAYLOADLENGTH, 0x41}, // RegPayloadLength: 65 bytes max payload (length byte)
+			{RFM69_REG_NODEADRS, 0x00}, // RegNodeAdrs: Node Address (Not used)
+			{RFM69_REG_BROADCASTADRS, 0xFF}, // RegBroadcastAdrs: Broadcast Address
+			{RFM69_REG_AUTOMODES, RFM69_REG_AUTOMODES_ENTER_OFF | RFM69_REG_AUTOMODES_EXIT_OFF | RFM69_REG_AUTOMODES_INTERMEDIATE_SLEEP}, // RegAutoModes: Off, the mode only changes when we write it (the shadow relies on it)
+			{RFM69_REG_FIFOTHRESH, RFM69_REG_FIFOTHRESH_TXSTART_FIFONOTEMPTY | 0x0F}, // RegFifoThresh: TxStart on FifoNotEmpty, 15 bytes FifoLevel
+			{RFM69_REG_PACKETCONFIG2, RFM69_REG_PACKET2_RXRESTARTDELAY_2BITS | RFM69_REG_PACKET2_AUTORXRESTART_ON | (pvEncKey == 0 ? RFM69_REG_PACKET2_AES_OFF : RFM69_REG_PACKET2_AES_ON)}, // RegPacketConfig2: RX restart delay exp = 2, Auto RX restart, AES on/off
+			{RFM69_REG_TESTLNA, RFM69_REG_TESTLNA_NORMAL} // RegTestLna: Recommended value
+		};
+		rfm69_register_t pMerged[sizeof(pRegisters) / sizeof(rfm69_register_t) + RFM69_MODEM_PROFILE_REGISTERS];
+		uint8_t ubMerged = 0;
+
+		for(uint8_t i = 0, j = 0; i < sizeof(pRegisters) / sizeof(rfm69_register_t) || j < RFM69_MODEM_PROFILE_REGISTERS;)
+		{
+			if(j == RFM69_MODEM_PROFILE_REGISTERS || (i < sizeof(pRegisters) / sizeof(rfm69_register_t) && pRegisters[i].ubRegister < pProfile->pRegisters[j].ubRegister))
+				pMerged[ubMerged++] = pRegisters[i++];
+			else
+				pMerged[ubMerged++] = pProfile->pRegisters[j++];
+		}
+
+		rfm69_write_registers(pMerged, ubMerged);
 
 		if(pvEncKey != 0)
-		{
-			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
-			{
-				RFM69_SELECT();
+			rfm69_write_burst(RFM69_REG_AESKEY1, (const uint8_t *)pvEncKey, 16);
 
-				usart3_spi_transfer_byte(RFM69_REG_AESKEY1 | 0x80);
-				usart3_spi_write((uint8_t*)pvEncKey, 16, 1);
+		ubRadioModemProfile = RFM69_MODEM_PROFILE_25K;
 
-				RFM69_UNSELECT();
-			}
-		}
+		rfm69_update_tx_timeout();
 
 		while(!(rfm69_read_register(RFM69_REG_IRQFLAGS1) & RFM69_REG_IRQFLAGS1_MODEREADY)); // Wait for ModeReady
 
@@ -469,209 +1302,375 @@ uint8_t rfm69_init(uint8_t ubNodeID, uint8_t ubNetID, const void *pvEncKey)
 }
 void rfm69_isr()
 {
+	if(ubRadioDMABusy)
+		return; // Radio sits in standby while its FIFO is drained, nothing else can be pending
+
 	uint8_t ubIRQFlags = rfm69_read_register(RFM69_REG_IRQFLAGS2);
 
+	if(ubRadioTXState == RFM69_TX_STATE_SENDING)
+	{
+		if(ubIRQFlags & RFM69_REG_IRQFLAGS2_PACKETSENT) // PacketSent
+		{
+			rfm69_write_register(RFM69_REG_DIOMAPPING1, RFM69_REG_DIOMAPPING1_DIO0_01); // DIO0 back to PayloadReady
+			rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
+
+			ubRadioTXState = RFM69_TX_STATE_DONE; // Bookkeeping is left to rfm69_tick()
+		}
+
+		return;
+	}
+
 	if(ubIRQFlags & RFM69_REG_IRQFLAGS2_PAYLOADREADY) // PayloadReady
 	{
 		rfm69_set_mode(RFM69_REG_OPMODE_STANDBY); // Standby
 
 		int8_t bRSSI = rfm69_read_rssi();
+		uint8_t ubDrainStarted = 0;
+
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			uint32_t ulStartCycles = DBG_CYCLE_COUNTER();
+
+			RFM69_SELECT();
+
+			usart3_spi_transfer_byte(RFM69_REG_FIFO & 0x7F);
+
+			uint8_t ubPayloadLength = usart3_spi_transfer_byte(0);
+
+			xRadioSPIStats.ulTransactions++;
+			xRadioSPIStats.ulBytes += 2 + ubPayloadLength;
+
+			if(ubPayloadLength >= RFM69_PACKET_HEADER_SIZE && ubPayloadLength <= RFM69_MAX_PAYLOAD_SIZE)
+			{
+				pubRadioDMABuffer[0] = (uint8_t)bRSSI;
+
+#if RFM69_FIFO_DRAIN_DMA
+				rfm69_dma_start(ubPayloadLength); // Completes in rfm69_dma_isr() with interrupts enabled
+
+				ubDrainStarted = 1;
+#else
+				usart3_spi_read(pubRadioDMABuffer + 1, ubPayloadLength, 0);
+
+				RFM69_UNSELECT();
+
+				record_fifo_write(pRadioRXPacketFIFO, pubRadioDMABuffer, ubPayloadLength + 1);
+
+				xRadioISRStats.ulDrains++;
+				xRadioISRStats.ulDrainedBytes += ubPayloadLength;
+#endif
+			}
+			else
+			{
+				while(ubPayloadLength--)
+					usart3_spi_transfer_byte(0);
+
+				RFM69_UNSELECT();
+			}
+
+			xRadioISRStats.ulLastMaskedCycles = DBG_CYCLE_COUNTER() - ulStartCycles;
+
+			if(xRadioISRStats.ulLastMaskedCycles > xRadioISRStats.ulMaxMaskedCycles)
+				xRadioISRStats.ulMaxMaskedCycles = xRadioISRStats.ulLastMaskedCycles;
+		}
+
+		if(!ubDrainStarted && (ubRadioTXState == RFM69_TX_STATE_IDLE || ubRadioTXState == RFM69_TX_STATE_BACKOFF)) // Stay in standby if a transmission is being loaded
+			rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
+	}
+}
+static uint8_t rfm69_csma_priority(const rfm69_packet_header_t *pHeader)
+{
+	if(pHeader->ubACKSent || pHeader->ubRELSent || pHeader->ubRELRequested)
+		return RFM69_CSMA_PRIORITY_HIGH;
+
+	if(pHeader->ubACKRequested)
+		return RFM69_CSMA_PRIORITY_NORMAL;
+
+	return RFM69_CSMA_PRIORITY_LOW;
+}
+static void rfm69_csma_backoff()
+{
+	uint32_t ulSlots = pRadioCSMAWindows[ubRadioCSMAPriority].ubIFS + (trng_pop_random() & (usRadioCSMAWindow - 1));
+
+	ullRadioCSMABackoffEnd = g_ullSystemTick + ulSlots * RFM69_CSMA_SLOT_TIME;
+}
+static uint16_t rfm69_csma_retry_delay(uint16_t usRetryDelay)
+{
+	uint32_t ulJitter = usRetryDelay >> RFM69_CSMA_RETRY_JITTER_SHIFT;
+
+	if(!ulJitter)
+		return usRetryDelay;
+
+	// Nodes that lost the same collision must not all come back at the same time
+	uint32_t ulDelay = usRetryDelay + trng_pop_random() % (ulJitter + 1);
+
+	return ulDelay > UINT16_MAX ? UINT16_MAX : ulDelay;
+}
+
+static void rfm69_tx_done(const rfm69_packet_header_t *pHeader)
+{
+	rfm69_pending_packet_t *pPendingPacket = NULL;
+	uint8_t ubPendingState = RFM69_PENDING_STATE_FREE;
 
-		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
-		{
-			RFM69_SELECT();
+	if(pHeader->ubACKRequested)
+		ubPendingState = RFM69_PENDING_STATE_ACK;
+	else if(pHeader->ubRELRequested && pHeader->ubQoSLevel == 1)
+		ubPendingState = RFM69_PENDING_STATE_RELACK;
+	else if(pHeader->ubACKSent && pHeader->ubQoSLevel == 1)
+		ubPendingState = RFM69_PENDING_STATE_REL;
 
-			usart3_spi_transfer_byte(RFM69_REG_FIFO & 0x7F);
+	if(ubPendingState != RFM69_PENDING_STATE_FREE)
+		pPendingPacket = rfm69_find_pending_packet(ubPendingState, pHeader->usID, pHeader->ubReceiverNodeID);
 
-			uint8_t ubPayloadLength = usart3_spi_transfer_byte(0);
+	if(pPendingPacket)
+	{
+		rfm69_link_t *pLink = rfm69_link_find(pHeader->ubReceiverNodeID); // Created when the frame was loaded
 
-			if(ubPayloadLength >= RFM69_PACKET_HEADER_SIZE && ubPayloadLength <= RFM69_MAX_PAYLOAD_SIZE)
-			{
-				uint8_t pubBuffer[RFM69_MAX_PAYLOAD_SIZE + 1];
+		if(pLink && pPendingPacket->ullLastRetry)
+		{
+			pLink->ulTXRetries++;
 
-				pubBuffer[0] = (uint8_t)bRSSI;
+			rfm69_atc_loss(pLink); // Not the first try, the previous one went unanswered
+		}
 
-				usart3_spi_read(pubBuffer + 1, ubPayloadLength, 0);
+		if(!pPendingPacket->usRetriesLeft)
+		{
+			if(pLink)
+				pLink->ulTXFailures++;
 
-				blob_fifo_write(pRadioRXPacketFIFO, pubBuffer, ubPayloadLength + 1);
-			}
-			else
-			{
-				while(ubPayloadLength--)
-					usart3_spi_transfer_byte(0);
-			}
+			rfm69_remove_pending_packet(pPendingPacket);
 
-			RFM69_UNSELECT();
+			if(pfRadioTimeoutCallback)
+				pfRadioTimeoutCallback(pHeader->usID);
 		}
+		else
+		{
+			pPendingPacket->usRetriesLeft--;
+			pPendingPacket->ullLastRetry = g_ullSystemTick;
+			pPendingPacket->ubInTX = 0;
 
-		rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
+			rfm69_timer_schedule(pPendingPacket, rfm69_csma_retry_delay(pPendingPacket->usRetryDelay));
+
+			if(pfRadioTXCallback)
+				pfRadioTXCallback(pHeader->usID, pPendingPacket->usRetriesLeft);
+		}
+	}
+	else
+	{
+		if(pfRadioTXCallback)
+			pfRadioTXCallback(pHeader->usID, 0);
 	}
 }
+
 void rfm69_tick()
 {
 	uint8_t pubTXBuffer[RFM69_MAX_PAYLOAD_SIZE];
 	uint8_t pubRXBuffer[RFM69_MAX_PAYLOAD_SIZE + 1];
 
-	if(ubRadioCurrentMode == RFM69_REG_OPMODE_STANDBY)
+	if(ubRadioModeSettling)
+	{
+		if(!(rfm69_read_register(RFM69_REG_IRQFLAGS1) & RFM69_REG_IRQFLAGS1_MODEREADY))
+			return; // Still waking up from sleep, nothing to do with the radio yet
+
+		ubRadioModeSettling = 0;
+	}
+
+	if(ubRadioCurrentMode == RFM69_REG_OPMODE_STANDBY && (ubRadioTXState == RFM69_TX_STATE_IDLE || ubRadioTXState == RFM69_TX_STATE_BACKOFF))
 		rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
 
-	for(rfm69_pending_packet_t *pPacket = pRadioRELPending; pPacket; pPacket = pPacket->pNext)
+	rfm69_aggregate_flush_expired();
+	rfm69_timer_advance();
+
+	while(pRadioTimerExpired)
 	{
-		if(pPacket->ubInTX)
-			continue;
+		rfm69_pending_packet_t *pPacket = pRadioTimerExpired;
+		uint8_t ubPayloadSize;
 
-		if(g_ullSystemTick - pPacket->ullLastRetry < pPacket->usRetryDelay)
-			continue;
+		rfm69_timer_cancel(pPacket);
 
-		uint8_t ubPayloadSize;
+		if(!rfm69_build_pending_packet_payload(pPacket, pubTXBuffer, RFM69_MAX_PAYLOAD_SIZE, &ubPayloadSize) || !record_fifo_write(pRadioTXPacketFIFO, pubTXBuffer, ubPayloadSize))
+		{
+			pPacket->ulDeadline = ulRadioTimerTick + 1; // Try again on the next wheel tick
 
-		if(!rfm69_build_pending_packet_payload(pPacket, pubTXBuffer, RFM69_MAX_PAYLOAD_SIZE, &ubPayloadSize))
-			continue;
+			rfm69_timer_insert(pPacket);
 
-		if(!blob_fifo_write(pRadioTXPacketFIFO, pubTXBuffer, ubPayloadSize))
-			continue;
+			break;
+		}
 
-		pPacket->ubInTX = 1;
+		pPacket->ubInTX = 1; // Not scheduled while queued, the TX completion reschedules it
 	}
 
-	for(rfm69_pending_packet_t *pPacket = pRadioRELACKPending; pPacket; pPacket = pPacket->pNext)
+	if((ubRadioTXState == RFM69_TX_STATE_STANDBY || ubRadioTXState == RFM69_TX_STATE_SENDING) && g_ullSystemTick - ullLastTX >= usRadioTXTimeout)
 	{
-		if(pPacket->ubInTX)
-			continue;
+		// PacketSent never came (or the radio never settled), give up on this frame and let the retry logic take over
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			rfm69_write_register(RFM69_REG_DIOMAPPING1, RFM69_REG_DIOMAPPING1_DIO0_01); // DIO0 back to PayloadReady
+			rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
 
-		if(g_ullSystemTick - pPacket->ullLastRetry < pPacket->usRetryDelay)
-			continue;
+			if(ubRadioTXState == RFM69_TX_STATE_STANDBY)
+				record_fifo_commit(pRadioTXPacketFIFO); // Never loaded, drop the peeked frame
 
-		uint8_t ubPayloadSize;
+			ubRadioTXState = RFM69_TX_STATE_DONE;
+		}
+	}
 
-		if(!rfm69_build_pending_packet_payload(pPacket, pubTXBuffer, RFM69_MAX_PAYLOAD_SIZE, &ubPayloadSize))
-			continue;
+	switch(ubRadioTXState)
+	{
+		case RFM69_TX_STATE_IDLE:
+		{
+			if(record_fifo_is_empty(pRadioTXPacketFIFO))
+			{
+				rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
 
-		if(!blob_fifo_write(pRadioTXPacketFIFO, pubTXBuffer, ubPayloadSize))
-			continue;
+				break;
+			}
 
-		pPacket->ubInTX = 1;
-	}
+			uint32_t ulFrameSize = record_fifo_peek(pRadioTXPacketFIFO, pRadioTXFrameSpans);
 
-	for(rfm69_pending_packet_t *pPacket = pRadioACKPending; pPacket; pPacket = pPacket->pNext)
-	{
-		if(pPacket->ubInTX)
-			continue;
+			if(!ulFrameSize)
+				break;
 
-		if(g_ullSystemTick - pPacket->ullLastRetry < pPacket->usRetryDelay)
-			continue;
+			// The header may wrap around the end of the FIFO
+			uint8_t pubHeader[RFM69_PACKET_HEADER_SIZE];
+			uint32_t ulHeaderFirst = pRadioTXFrameSpans[0].ulSize < RFM69_PACKET_HEADER_SIZE ? pRadioTXFrameSpans[0].ulSize : RFM69_PACKET_HEADER_SIZE;
 
-		uint8_t ubPayloadSize;
+			if(ulFrameSize < RFM69_PACKET_HEADER_SIZE || ulFrameSize > RFM69_MAX_PAYLOAD_SIZE)
+			{
+				record_fifo_commit(pRadioTXPacketFIFO);
 
-		if(!rfm69_build_pending_packet_payload(pPacket, pubTXBuffer, RFM69_MAX_PAYLOAD_SIZE, &ubPayloadSize))
-			continue;
+				break;
+			}
 
-		if(!blob_fifo_write(pRadioTXPacketFIFO, pubTXBuffer, ubPayloadSize))
-			continue;
+			memcpy(pubHeader, pRadioTXFrameSpans[0].pubData, ulHeaderFirst);
+			memcpy(pubHeader + ulHeaderFirst, pRadioTXFrameSpans[1].pubData, RFM69_PACKET_HEADER_SIZE - ulHeaderFirst);
 
-		pPacket->ubInTX = 1;
-	}
+			if(!rfm69_unpack_header(&sRadioTXHeader, pubHeader, RFM69_PACKET_HEADER_SIZE))
+			{
+				record_fifo_commit(pRadioTXPacketFIFO);
 
-	if(!blob_fifo_is_empty(pRadioTXPacketFIFO) && g_ullSystemTick - ullLastTX >= 30)
-	{
-		ullLastTX = g_ullSystemTick;
+				break;
+			}
+
+			ubRadioTXFrameSize = ulFrameSize;
+
+			// Every frame contends from its class minimum window, retransmissions included
+			ubRadioCSMAPriority = rfm69_csma_priority(&sRadioTXHeader);
+			usRadioCSMAWindow = pRadioCSMAWindows[ubRadioCSMAPriority].usMinWindow;
+			ubRadioCSMABackoffs = 0;
 
-		if(rfm69_read_rssi() < RFM69_CHANNEL_FREE_RSSI)
+			rfm69_csma_backoff();
+
+			ubRadioTXState = RFM69_TX_STATE_BACKOFF;
+		}
+		// Fall through
+		case RFM69_TX_STATE_BACKOFF:
 		{
-			uint32_t ulBufferSize;
+			if(g_ullSystemTick < ullRadioCSMABackoffEnd)
+				break; // Keep listening
 
-			if(blob_fifo_read(pRadioTXPacketFIFO, pubTXBuffer, &ulBufferSize, RFM69_MAX_PAYLOAD_SIZE))
+			int8_t bChannelRSSI = rfm69_read_rssi();
+
+			if(bChannelRSSI >= RFM69_CHANNEL_FREE_RSSI)
 			{
-				rfm69_packet_header_t *pHeader = (rfm69_packet_header_t *)malloc(sizeof(rfm69_packet_header_t));
+				xRadioTXStats.ulCSMABusy++;
+
+				rfm69_rmw_register(RFM69_REG_PACKETCONFIG2, 0xFB, RFM69_REG_PACKET2_RXRESTART); // Restart RX (WAIT mode to setup new gain through the AGC)
 
-				if(pHeader)
+				if(++ubRadioCSMABackoffs >= RFM69_CSMA_MAX_BACKOFFS)
 				{
-					if(rfm69_unpack_header(pHeader, pubTXBuffer, RFM69_PACKET_HEADER_SIZE))
-					{
-						rfm69_set_mode(RFM69_REG_OPMODE_STANDBY); // Standby
+					xRadioTXStats.ulCSMAFailures++;
 
-						while (!(rfm69_read_register(RFM69_REG_IRQFLAGS1) & RFM69_REG_IRQFLAGS1_MODEREADY)); // Wait for ModeReady
+					record_fifo_commit(pRadioTXPacketFIFO); // Drop the peeked frame, QoS frames get retried as if it was lost on air
 
-						rfm69_clear_fifo();
+					ubRadioTXState = RFM69_TX_STATE_DONE;
 
-						ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
-						{
-							RFM69_SELECT();
+					break;
+				}
 
-							usart3_spi_transfer_byte(RFM69_REG_FIFO | 0x80);
-							usart3_spi_transfer_byte((uint8_t)ulBufferSize);
-							usart3_spi_write(pubTXBuffer, ulBufferSize, 1);
+				if(usRadioCSMAWindow < pRadioCSMAWindows[ubRadioCSMAPriority].usMaxWindow)
+					usRadioCSMAWindow <<= 1;
 
-							RFM69_UNSELECT();
-						}
+				rfm69_csma_backoff();
 
-						bRadioCurrentPowerLevel = pbRadioATCPowerLevel[pHeader->ubReceiverNodeID]; // Set the power needed to this target node ID
+				break;
+			}
 
-						rfm69_set_mode(RFM69_REG_OPMODE_TRANSMITTER); // TX (Send the packet)
-						while (!(rfm69_read_register(RFM69_REG_IRQFLAGS2) & RFM69_REG_IRQFLAGS2_PACKETSENT)); // Wait for PacketSent
-						rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
+			rfm69_link_average(&sRadioNoiseFloor, bChannelRSSI); // A clear channel reading is as close to the noise floor as it gets
 
-						rfm69_pending_packet_t *pPendingPacket = NULL;
-						rfm69_pending_packet_t **ppPendingList = NULL;
+			ullLastTX = g_ullSystemTick;
 
-						if(pHeader->ubACKRequested)
-							ppPendingList = &pRadioACKPending;
-						else if(pHeader->ubRELRequested && pHeader->ubQoSLevel == 1)
-							ppPendingList = &pRadioRELACKPending;
-						else if(pHeader->ubACKSent && pHeader->ubQoSLevel == 1)
-							ppPendingList = &pRadioRELPending;
+			rfm69_set_mode(RFM69_REG_OPMODE_STANDBY); // Standby
+
+			ubRadioTXState = RFM69_TX_STATE_STANDBY; // The radio is usually ready right away, try to load it on this same tick
+		}
+		// Fall through
+		case RFM69_TX_STATE_STANDBY:
+		{
+			if(!(rfm69_read_register(RFM69_REG_IRQFLAGS1) & RFM69_REG_IRQFLAGS1_MODEREADY))
+				break; // Check again on the next tick
 
-						if(ppPendingList)
-							pPendingPacket = rfm69_find_pending_packet(*ppPendingList, pHeader->usID, pHeader->ubReceiverNodeID);
+			rfm69_clear_fifo();
 
-						if(pPendingPacket)
-						{
-							if(pPendingPacket->ullLastRetry && pbRadioATCPowerLevel[pHeader->ubReceiverNodeID] < RFM69_MAXIMUM_TX_POWER)
-								pbRadioATCPowerLevel[pHeader->ubReceiverNodeID]++; // Increase the power if it is not the first try
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				rfm69_dma_wait(); // Do not cut into a FIFO drain
 
-							if(!pPendingPacket->usRetriesLeft)
-							{
-								rfm69_remove_pending_packet(ppPendingList, pPendingPacket);
+				RFM69_SELECT();
 
-								if(pfRadioTimeoutCallback)
-									pfRadioTimeoutCallback(pHeader->usID);
-							}
-							else
-							{
-								pPendingPacket->usRetriesLeft--;
-								pPendingPacket->ullLastRetry = g_ullSystemTick;
-								pPendingPacket->ubInTX = 0;
+				usart3_spi_transfer_byte(RFM69_REG_FIFO | 0x80);
+				usart3_spi_transfer_byte(ubRadioTXFrameSize);
+				usart3_spi_write(pRadioTXFrameSpans[0].pubData, pRadioTXFrameSpans[0].ulSize, !pRadioTXFrameSpans[1].ulSize);
+				usart3_spi_write(pRadioTXFrameSpans[1].pubData, pRadioTXFrameSpans[1].ulSize, 1);
 
-								if(pfRadioTXCallback)
-									pfRadioTXCallback(pHeader->usID, pPendingPacket->usRetriesLeft);
-							}
-						}
-						else
-						{
-							if(pfRadioTXCallback)
-								pfRadioTXCallback(pHeader->usID, 0);
-						}
-					}
+				RFM69_UNSELECT();
 
-					free(pHeader);
-				}
+				xRadioSPIStats.ulTransactions++;
+				xRadioSPIStats.ulBytes += 2 + ubRadioTXFrameSize;
+			}
+
+			record_fifo_commit(pRadioTXPacketFIFO);
+
+			uint16_t usAirBytes = rfm69_frame_air_bytes(ubRadioTXFrameSize);
+
+			xRadioTXStats.ulFrames++;
+			xRadioTXStats.ulAirBytes += usAirBytes;
+
+			ullRadioAirtime += rfm69_air_bytes_time(usAirBytes);
+
+			rfm69_link_t *pLink = rfm69_link_get(sRadioTXHeader.ubReceiverNodeID);
+
+			bRadioCurrentPowerLevel = pLink ? pLink->bPowerLevel : RFM69_MAXIMUM_TX_POWER; // Set the power needed to this target node ID
+
+			if(pLink)
+			{
+				pLink->ulTXPackets++;
+				pLink->lTXPowerSum += bRadioCurrentPowerLevel;
+				pLink->bLastTXPower = bRadioCurrentPowerLevel;
+			}
+
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				rfm69_write_register(RFM69_REG_DIOMAPPING1, RFM69_REG_DIOMAPPING1_DIO0_00); // DIO0 outputs PacketSent while transmitting
+				rfm69_set_mode(RFM69_REG_OPMODE_TRANSMITTER); // TX (Send the packet)
+
+				ubRadioTXState = RFM69_TX_STATE_SENDING; // rfm69_isr() takes it from here
 			}
 		}
-		else
+		break;
+		case RFM69_TX_STATE_DONE:
 		{
-			rfm69_rmw_register(RFM69_REG_PACKETCONFIG2, 0xFB, RFM69_REG_PACKET2_RXRESTART); // Restart RX (WAIT mode to setup new gain through the AGC)
+			rfm69_tx_done(&sRadioTXHeader);
+
+			ubRadioTXState = RFM69_TX_STATE_IDLE;
 		}
-	}
-	else
-	{
-		rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER); // RX
+		break;
 	}
 
-	if(!blob_fifo_is_empty(pRadioRXPacketFIFO))
+	if(!record_fifo_is_empty(pRadioRXPacketFIFO))
 	{
 		uint32_t ulBufferSize = 0;
 
-		if(blob_fifo_read(pRadioRXPacketFIFO, pubRXBuffer, &ulBufferSize, RFM69_MAX_PAYLOAD_SIZE + 1))
+		if(record_fifo_read(pRadioRXPacketFIFO, pubRXBuffer, &ulBufferSize, RFM69_MAX_PAYLOAD_SIZE + 1))
 		{
 			int8_t bRSSI = (int8_t)pubRXBuffer[0];
 			rfm69_packet_header_t *pHeader = (rfm69_packet_header_t *)malloc(sizeof(rfm69_packet_header_t));
@@ -682,23 +1681,21 @@ void rfm69_tick()
 			{
 				if(rfm69_parse_payload(pHeader, &pubData, &ubDataSize, pubRXBuffer + 1, ulBufferSize - 1))
 				{
-					pbRadioLastRSSI[pHeader->ubSenderNodeID] = bRSSI;
+					rfm69_link_t *pLink = rfm69_link_get(pHeader->ubSenderNodeID);
+					uint8_t ubFresh = pLink ? rfm69_link_rx(pLink, pHeader, bRSSI) : 1;
 
 					if(pHeader->ubReceiverNodeID == ubRadioNodeID)
 					{
-						// ATC - Power Control to target a constant RSSI at the receiver
-						if(pHeader->bRemoteRSSI > -128)
+						if(pLink && pHeader->bRemoteRSSI > -128)
 						{
-							pbRadioATCRemoteRSSI[pHeader->ubSenderNodeID] = pHeader->bRemoteRSSI;
+							pLink->bRemoteRSSI = pHeader->bRemoteRSSI;
 
-							if(pHeader->bRemoteRSSI > pbRadioATCTargetRemoteRSSI[pHeader->ubSenderNodeID] && pbRadioATCPowerLevel[pHeader->ubSenderNodeID] > RFM69_MINIMUM_TX_POWER)
-								pbRadioATCPowerLevel[pHeader->ubSenderNodeID]--;
-							else if(pHeader->bRemoteRSSI < pbRadioATCTargetRemoteRSSI[pHeader->ubSenderNodeID] && pbRadioATCPowerLevel[pHeader->ubSenderNodeID] < RFM69_MAXIMUM_TX_POWER)
-								pbRadioATCPowerLevel[pHeader->ubSenderNodeID]++;
+							rfm69_atc_report(pLink, pHeader->bRemoteRSSI);
 						}
 
-						if(pfRadioRXCallback && pubData && ubDataSize > 0 && !rfm69_find_pending_packet(pRadioRELPending, pHeader->usID, pHeader->ubSenderNodeID))
-							pfRadioRXCallback(pHeader, bRSSI, pubData, ubDataSize);
+						// Duplicates still go through the response logic below, the ACK we sent before may be the one that got lost
+						if(ubFresh && !rfm69_find_pending_packet(RFM69_PENDING_STATE_REL, pHeader->usID, pHeader->ubSenderNodeID))
+							rfm69_deliver(pHeader, bRSSI, pubData, ubDataSize);
 
 						if(pHeader->ubACKSent)
 						{
@@ -708,14 +1705,17 @@ void rfm69_tick()
 							// Check if pending and remove
 							rfm69_pending_packet_t *pPendingPacket;
 
-							pPendingPacket = rfm69_find_pending_packet(pRadioACKPending, pHeader->usID, pHeader->ubSenderNodeID);
+							pPendingPacket = rfm69_find_pending_packet(RFM69_PENDING_STATE_ACK, pHeader->usID, pHeader->ubSenderNodeID);
 
 							if(pPendingPacket)
 							{
-								rfm69_remove_pending_packet(&pRadioACKPending, pPendingPacket);
+								if(pHeader->ubQoSLevel == 0)
+								{
+									rfm69_remove_pending_packet(pPendingPacket);
 
-								if(pHeader->ubQoSLevel == 0 && pfRadioACKCallback)
-									pfRadioACKCallback(pHeader->usID);
+									if(pfRadioACKCallback)
+										pfRadioACKCallback(pHeader->usID);
+								}
 								else if(pHeader->ubQoSLevel == 1)
 								{
 									// Build response header
@@ -727,16 +1727,23 @@ void rfm69_tick()
 									sHeader.ubACKSent = 0;
 									sHeader.ubRELRequested = 1;
 									sHeader.ubRELSent = 0;
-									sHeader.bRemoteRSSI = pbRadioLastRSSI[pHeader->ubSenderNodeID];
+									sHeader.ubAggregated = 0;
+									sHeader.bRemoteRSSI = bRSSI;
 									sHeader.ubReceiverNodeID = pHeader->ubSenderNodeID;
 									sHeader.ubSenderNodeID = ubRadioNodeID;
 
-									pPendingPacket = rfm69_find_pending_packet(pRadioRELACKPending, pHeader->usID, pHeader->ubSenderNodeID);
+									rfm69_pending_packet_t *pRELACKPacket = rfm69_find_pending_packet(RFM69_PENDING_STATE_RELACK, pHeader->usID, pHeader->ubSenderNodeID);
 
-									if(!pPendingPacket) // Add to pending if we dont already have it there
-										rfm69_add_pending_packet(&pRadioRELACKPending, &sHeader, NULL, 0, 250, 80);
+									if(!pRELACKPacket) // Move to the next state in place if we dont already have it there
+									{
+										rfm69_move_pending_packet(pPendingPacket, RFM69_PENDING_STATE_RELACK, &sHeader, 250, 80);
+									}
 									else // Otherwise just update the header
-										memcpy(&pPendingPacket->sHeader, &sHeader, sizeof(rfm69_packet_header_t));
+									{
+										rfm69_remove_pending_packet(pPendingPacket);
+
+										memcpy(&pRELACKPacket->sHeader, &sHeader, sizeof(rfm69_packet_header_t));
+									}
 								}
 							}
 						}
@@ -745,11 +1752,11 @@ void rfm69_tick()
 							// Sending REL on QoS level 2 (bit set) means the packet is released, on QoS level 1 (bit cleared) is forbidden
 
 							// Check if pending and remove
-							rfm69_pending_packet_t *pPendingPacket = rfm69_find_pending_packet(pRadioRELACKPending, pHeader->usID, pHeader->ubSenderNodeID);
+							rfm69_pending_packet_t *pPendingPacket = rfm69_find_pending_packet(RFM69_PENDING_STATE_RELACK, pHeader->usID, pHeader->ubSenderNodeID);
 
 							if(pPendingPacket)
 							{
-								rfm69_remove_pending_packet(&pRadioRELACKPending, pPendingPacket);
+								rfm69_remove_pending_packet(pPendingPacket);
 
 								if(pfRadioACKCallback)
 									pfRadioACKCallback(pHeader->usID);
@@ -760,10 +1767,10 @@ void rfm69_tick()
 							// Requesting REL on QoS level 2 (bit set) means the packet should released and a REL sent, on QoS level 1 (bit cleared) is forbidden
 
 							// Check if pending and remove
-							rfm69_pending_packet_t *pPendingPacket = rfm69_find_pending_packet(pRadioRELPending, pHeader->usID, pHeader->ubSenderNodeID);
+							rfm69_pending_packet_t *pPendingPacket = rfm69_find_pending_packet(RFM69_PENDING_STATE_REL, pHeader->usID, pHeader->ubSenderNodeID);
 
 							if(pPendingPacket)
-								rfm69_remove_pending_packet(&pRadioRELPending, pPendingPacket);
+								rfm69_remove_pending_packet(pPendingPacket);
 
 							// Build response header
 							rfm69_packet_header_t sHeader;
@@ -774,14 +1781,15 @@ void rfm69_tick()
 							sHeader.ubACKSent = 0;
 							sHeader.ubRELRequested = 0;
 							sHeader.ubRELSent = 1;
-							sHeader.bRemoteRSSI = pbRadioLastRSSI[pHeader->ubSenderNodeID];
+							sHeader.ubAggregated = 0;
+							sHeader.bRemoteRSSI = bRSSI;
 							sHeader.ubReceiverNodeID = pHeader->ubSenderNodeID;
 							sHeader.ubSenderNodeID = ubRadioNodeID;
 
 							uint8_t ubPayloadSize;
 
 							if(rfm69_build_payload(&sHeader, NULL, 0, pubTXBuffer, RFM69_MAX_PAYLOAD_SIZE, &ubPayloadSize))
-								blob_fifo_write(pRadioTXPacketFIFO, pubTXBuffer, ubPayloadSize);
+								record_fifo_write(pRadioTXPacketFIFO, pubTXBuffer, ubPayloadSize);
 						}
 						else if(pHeader->ubACKRequested)
 						{
@@ -797,16 +1805,17 @@ void rfm69_tick()
 							sHeader.ubACKSent = 1;
 							sHeader.ubRELRequested = 0;
 							sHeader.ubRELSent = 0;
-							sHeader.bRemoteRSSI = pbRadioLastRSSI[pHeader->ubSenderNodeID];
+							sHeader.ubAggregated = 0;
+							sHeader.bRemoteRSSI = bRSSI;
 							sHeader.ubReceiverNodeID = pHeader->ubSenderNodeID;
 							sHeader.ubSenderNodeID = ubRadioNodeID;
 
 							if(pHeader->ubQoSLevel == 1)
 							{
-								rfm69_pending_packet_t *pPendingPacket = rfm69_find_pending_packet(pRadioRELPending, pHeader->usID, pHeader->ubSenderNodeID);
+								rfm69_pending_packet_t *pPendingPacket = rfm69_find_pending_packet(RFM69_PENDING_STATE_REL, pHeader->usID, pHeader->ubSenderNodeID);
 
 								if(!pPendingPacket) // Add to pending if we dont already have it there
-									rfm69_add_pending_packet(&pRadioRELPending, &sHeader, NULL, 0, 250, 80);
+									rfm69_add_pending_packet(RFM69_PENDING_STATE_REL, &sHeader, NULL, 0, 250, 80);
 								else // Otherwise just update the header
 									memcpy(&pPendingPacket->sHeader, &sHeader, sizeof(rfm69_packet_header_t));
 							}
@@ -815,14 +1824,13 @@ void rfm69_tick()
 								uint8_t ubPayloadSize;
 
 								if(rfm69_build_payload(&sHeader, NULL, 0, pubTXBuffer, RFM69_MAX_PAYLOAD_SIZE, &ubPayloadSize))
-									blob_fifo_write(pRadioTXPacketFIFO, pubTXBuffer, ubPayloadSize);
+									record_fifo_write(pRadioTXPacketFIFO, pubTXBuffer, ubPayloadSize);
 							}
 						}
 					}
 					else
 					{
-						if(pfRadioRXCallback && pubData && ubDataSize > 0)
-							pfRadioRXCallback(pHeader, bRSSI, pubData, ubDataSize);
+						rfm69_deliver(pHeader, bRSSI, pubData, ubDataSize);
 					}
 				}
 
@@ -867,29 +1875,224 @@ uint16_t rfm69_send(uint8_t ubReceiver, const void *pvPayload, uint8_t ubSize, u
 	sHeader.ubRELRequested = 0;
 	sHeader.ubRELSent = 0;
 	sHeader.ubQoSLevel = ubQoSLevel - 1;
-	sHeader.usID = rfm69_get_next_packet_id();
-	sHeader.bRemoteRSSI = pbRadioLastRSSI[ubReceiver];
+	sHeader.ubAggregated = 0;
+	sHeader.bRemoteRSSI = rfm69_link_last_rssi(ubReceiver);
 	sHeader.ubReceiverNodeID = ubReceiver;
 	sHeader.ubSenderNodeID = ubRadioNodeID;
 
-	if(!ubQoSLevel)
-	{
-		uint8_t pubBuffer[RFM69_MAX_PAYLOAD_SIZE];
-		uint8_t ubPayloadSize;
+	rfm69_aggregate_t *pAggregate = rfm69_find_aggregate(ubReceiver, ubQoSLevel, usRetryDelay, usRetries);
 
-		if(!rfm69_build_payload(&sHeader, pvPayload, ubSize, pubBuffer, RFM69_MAX_PAYLOAD_SIZE, &ubPayloadSize))
+	if(usRadioAggregationLatency && pvPayload && ubSize && ubSize < RFM69_MAX_DATA_SIZE) // Leave room for the length prefix
+	{
+		if(pAggregate && pAggregate->ubDataSize + ubSize + 1 > RFM69_MAX_DATA_SIZE && !rfm69_aggregate_flush(pAggregate)) // Full, send it and start over in the same slot
 			return 0;
 
-		if(!blob_fifo_write(pRadioTXPacketFIFO, pubBuffer, ubPayloadSize))
+		if(!pAggregate)
+			pAggregate = rfm69_alloc_aggregate();
+
+		if(!pAggregate)
 			return 0;
+
+		if(!pAggregate->ubCount)
+		{
+			// Messages that join later share this ID, ACK and timeout callbacks cover all of them
+			sHeader.usID = rfm69_get_next_packet_id();
+
+			memcpy(&pAggregate->sHeader, &sHeader, sizeof(rfm69_packet_header_t));
+
+			pAggregate->ubQoSLevel = ubQoSLevel;
+			pAggregate->usRetryDelay = usRetryDelay;
+			pAggregate->usRetries = usRetries;
+			pAggregate->ullDeadline = g_ullSystemTick + usRadioAggregationLatency;
+		}
+
+		pAggregate->pubData[pAggregate->ubDataSize++] = ubSize;
+
+		memcpy(pAggregate->pubData + pAggregate->ubDataSize, pvPayload, ubSize);
+
+		pAggregate->ubDataSize += ubSize;
+		pAggregate->ubCount++;
+
+		xRadioTXStats.ulMessages++;
+
+		return pAggregate->sHeader.usID;
+	}
+
+	if(pAggregate && !rfm69_aggregate_flush(pAggregate)) // Do not let this one overtake what is already waiting for the same node
+		return 0;
+
+	sHeader.usID = rfm69_get_next_packet_id();
+
+	if(!rfm69_queue_frame(&sHeader, pvPayload, ubSize, ubQoSLevel, usRetryDelay, usRetries))
+		return 0;
+
+	xRadioTXStats.ulMessages++;
+
+	return sHeader.usID;
+}
+
+void rfm69_get_pending_stats(rfm69_pending_stats_t *pStats)
+{
+	if(!pStats)
+		return;
+
+	memcpy(pStats, &xRadioPendingStats, sizeof(rfm69_pending_stats_t));
+}
+
+void rfm69_get_isr_stats(rfm69_isr_stats_t *pStats)
+{
+	if(!pStats)
+		return;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		memcpy(pStats, &xRadioISRStats, sizeof(rfm69_isr_stats_t));
+	}
+}
+static uint32_t rfm69_timer_get_next_deadline()
+{
+	rfm69_timer_advance();
+
+	if(pRadioTimerExpired)
+		return 0;
+
+	uint32_t ulTicks;
+
+	if(pullRadioTimerWheelMask[0])
+	{
+		ulTicks = rfm69_timer_next_slot(pullRadioTimerWheelMask[0], ulRadioTimerTick + 1) + 1;
+	}
+	else if(pullRadioTimerWheelMask[1])
+	{
+		// Nothing in the lower level, wake up when the next upper level slot cascades (a lower bound)
+		uint32_t ulBlock = (ulRadioTimerTick >> RFM69_TIMER_WHEEL_BITS) + 1;
+
+		ulBlock += rfm69_timer_next_slot(pullRadioTimerWheelMask[1], ulBlock);
+
+		ulTicks = (ulBlock << RFM69_TIMER_WHEEL_BITS) - ulRadioTimerTick;
 	}
 	else
 	{
-		if(!rfm69_add_pending_packet(&pRadioACKPending, &sHeader, pvPayload, ubSize, usRetryDelay, usRetries))
+		return UINT32_MAX;
+	}
+
+	return (ulTicks << RFM69_TIMER_WHEEL_RESOLUTION_SHIFT) - (g_ullSystemTick & ((1 << RFM69_TIMER_WHEEL_RESOLUTION_SHIFT) - 1));
+}
+uint32_t rfm69_get_next_deadline()
+{
+	if(ubRadioTXState == RFM69_TX_STATE_DONE || (ubRadioTXState == RFM69_TX_STATE_IDLE && !record_fifo_is_empty(pRadioTXPacketFIFO)) || !record_fifo_is_empty(pRadioRXPacketFIFO))
+		return 0; // rfm69_tick() has a frame to load or deliver right away
+
+	uint32_t ulDeadline = rfm69_timer_get_next_deadline();
+
+	for(uint8_t i = 0; i < RFM69_AGGREGATION_SLOTS && ulDeadline; i++)
+	{
+		if(!pRadioAggregates[i].ubCount)
+			continue;
+
+		if(g_ullSystemTick >= pRadioAggregates[i].ullDeadline)
 			return 0;
+
+		if(pRadioAggregates[i].ullDeadline - g_ullSystemTick < ulDeadline)
+			ulDeadline = pRadioAggregates[i].ullDeadline - g_ullSystemTick;
 	}
 
-	return sHeader.usID;
+	return ulDeadline;
+}
+uint8_t rfm69_get_tx_state()
+{
+	return ubRadioTXState;
+}
+void rfm69_get_tx_stats(rfm69_tx_stats_t *pStats)
+{
+	if(!pStats)
+		return;
+
+	memcpy(pStats, &xRadioTXStats, sizeof(rfm69_tx_stats_t));
+
+	pStats->ulAirtime = ullRadioAirtime / 1000;
+}
+
+uint16_t rfm69_get_link_count()
+{
+	return usRadioLinkCount;
+}
+const rfm69_link_t* rfm69_get_link(uint16_t usIndex)
+{
+	if(usIndex >= usRadioLinkCount)
+		return NULL;
+
+	return &pRadioLinks[usIndex];
+}
+const rfm69_link_t* rfm69_find_link(uint8_t ubNodeID)
+{
+	return rfm69_link_find(ubNodeID);
+}
+uint32_t rfm69_get_link_table_size()
+{
+	return (uint32_t)usRadioLinkCapacity * sizeof(rfm69_link_t);
+}
+int8_t rfm69_get_noise_floor()
+{
+	return sRadioNoiseFloor / 16;
+}
+
+void rfm69_get_spi_stats(rfm69_spi_stats_t *pStats)
+{
+	if(!pStats)
+		return;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		memcpy(pStats, &xRadioSPIStats, sizeof(rfm69_spi_stats_t));
+	}
+}
+
+uint8_t rfm69_set_modem_profile(uint8_t ubProfile)
+{
+	if(ubProfile >= RFM69_MODEM_PROFILE_COUNT)
+		return 0;
+
+	uint8_t ubApplied = 0;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if(ubRadioTXState != RFM69_TX_STATE_STANDBY && ubRadioTXState != RFM69_TX_STATE_SENDING) // Not while a frame is being loaded or on air
+		{
+			rfm69_set_mode(RFM69_REG_OPMODE_STANDBY); // Standby
+
+			rfm69_write_registers(pRadioModemProfiles[ubProfile].pRegisters, RFM69_MODEM_PROFILE_REGISTERS); // Registers the profiles share are elided by the shadow
+
+			ubRadioModemProfile = ubProfile;
+			ubApplied = 1;
+		}
+	}
+
+	if(!ubApplied)
+		return 0;
+
+	rfm69_update_tx_timeout();
+
+	return 1; // rfm69_tick() puts the radio back in RX
+}
+uint8_t rfm69_get_modem_profile()
+{
+	return ubRadioModemProfile;
+}
+const char* rfm69_get_modem_profile_name(uint8_t ubProfile)
+{
+	if(ubProfile >= RFM69_MODEM_PROFILE_COUNT)
+		return "Custom";
+
+	return pRadioModemProfiles[ubProfile].pszName;
+}
+
+void rfm69_set_aggregation_latency(uint16_t usLatency)
+{
+	usRadioAggregationLatency = usLatency;
+
+	if(!usLatency)
+		rfm69_aggregate_flush_all();
 }
 
 uint32_t rfm69_get_rx_bandwidth()
@@ -905,6 +2108,8 @@ uint32_t rfm69_get_rx_bandwidth()
 		case 0x10:
 			return (uint32_t)(32000000.f / (24.f * (1 << ((ubReg & 0x07) + 2))));
 	}
+
+	return 0; // Reserved mantissa
 }
 void rfm69_set_carrier(uint32_t ulCarrier)
 {
@@ -915,9 +2120,9 @@ void rfm69_set_carrier(uint32_t ulCarrier)
 	if(ulCarrier >= (1 << 24))
 		return;
 
-	rfm69_write_register(RFM69_REG_FRFMSB, ulCarrier >> 16);
-	rfm69_write_register(RFM69_REG_FRFMID, ulCarrier >> 8);
-	rfm69_write_register(RFM69_REG_FRFLSB, ulCarrier);
+	uint8_t pubFrf[3] = {ulCarrier >> 16, ulCarrier >> 8, ulCarrier};
+
+	rfm69_write_burst(RFM69_REG_FRFMSB, pubFrf, 3); // Frf is latched when RegFrfLsb is written
 
 	rfm69_set_mode(RFM69_REG_OPMODE_SYNTHESIZER); // Frequency Synthetizer
 
@@ -942,8 +2147,11 @@ void rfm69_set_deviation(uint32_t ulDeviation)
 	if(ulDeviation >= (1 << 16))
 		return;
 
-	rfm69_write_register(RFM69_REG_FDEVMSB, ulDeviation >> 8);
-	rfm69_write_register(RFM69_REG_FDEVLSB, ulDeviation);
+	uint8_t pubFdev[2] = {ulDeviation >> 8, ulDeviation};
+
+	rfm69_write_burst(RFM69_REG_FDEVMSB, pubFdev, 2);
+
+	ubRadioModemProfile = RFM69_MODEM_PROFILE_CUSTOM;
 
 	rfm69_set_mode(RFM69_REG_OPMODE_SYNTHESIZER); // Frequency Synthetizer
 
@@ -965,8 +2173,13 @@ void rfm69_set_bit_rate(uint32_t ulBitRate)
 
 	ulBitRate = 32000000.f / ulBitRate;
 
-	rfm69_write_register(RFM69_REG_BITRATEMSB, ulBitRate >> 8);
-	rfm69_write_register(RFM69_REG_BITRATELSB, ulBitRate);
+	uint8_t pubBitRate[2] = {ulBitRate >> 8, ulBitRate};
+
+	rfm69_write_burst(RFM69_REG_BITRATEMSB, pubBitRate, 2);
+
+	ubRadioModemProfile = RFM69_MODEM_PROFILE_CUSTOM;
+
+	rfm69_update_tx_timeout();
 }
 uint32_t rfm69_get_bit_rate()
 {
@@ -993,6 +2206,8 @@ uint32_t rfm69_get_freq_correction()
 
 void rfm69_set_aes_key(const void *pvEncKey)
 {
+	ubRadioAESEnabled = !!pvEncKey;
+
 	if(!pvEncKey)
 	{
 		rfm69_rmw_register(RFM69_REG_PACKETCONFIG2, 0xFE, RFM69_REG_PACKET2_AES_OFF);
@@ -1000,16 +2215,7 @@ void rfm69_set_aes_key(const void *pvEncKey)
 	else
 	{
 		rfm69_rmw_register(RFM69_REG_PACKETCONFIG2, 0xFE, RFM69_REG_PACKET2_AES_ON);
-
-		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
-		{
-			RFM69_SELECT();
-
-			usart3_spi_transfer_byte(RFM69_REG_AESKEY1 | 0x80);
-			usart3_spi_write((uint8_t*)pvEncKey, 16, 1);
-
-			RFM69_UNSELECT();
-		}
+		rfm69_write_burst(RFM69_REG_AESKEY1, (const uint8_t *)pvEncKey, 16);
 	}
 }
 void rfm69_set_network_id(uint8_t ubNetID)
@@ -1052,11 +2258,21 @@ void rfm69_set_power_level(int8_t bPowerLevel)
 
 int8_t rfm69_get_atc_power_level(uint8_t ubNodeID)
 {
-	return pbRadioATCPowerLevel[ubNodeID];
+	rfm69_link_t *pLink = rfm69_link_find(ubNodeID);
+
+	return pLink ? pLink->bPowerLevel : RFM69_MAXIMUM_TX_POWER;
 }
 void rfm69_set_atc_target_rssi(uint8_t ubNodeID, int8_t bRSSI)
 {
-    pbRadioATCTargetRemoteRSSI[ubNodeID] = bRSSI;
+	rfm69_link_t *pLink = rfm69_link_get(ubNodeID);
+
+	if(!pLink || pLink->bTargetRSSI == bRSSI)
+		return;
+
+	pLink->bTargetRSSI = bRSSI;
+	pLink->ubATCConverged = 0;
+	pLink->ubATCSettled = 0;
+	pLink->ullATCDisturbance = g_ullSystemTick;
 }
 
 void rfm69_set_mode(uint8_t ubMode)
@@ -1082,7 +2298,7 @@ void rfm69_set_mode(uint8_t ubMode)
 			rfm69_set_power_level(RFM69_MINIMUM_TX_POWER);
 
 		if(ubRadioCurrentMode == RFM69_REG_OPMODE_SLEEP)
-			while(!(rfm69_read_register(RFM69_REG_IRQFLAGS1) & RFM69_REG_IRQFLAGS1_MODEREADY));
+			ubRadioModeSettling = 1; // rfm69_tick() polls ModeReady instead of waiting here
 
 		ubRadioCurrentMode = ubMode;
 	}
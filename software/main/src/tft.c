@@ -1,7 +1,125 @@
 #include "tft.h"
 
-static tft_button_t *pButtonList = NULL;
+static tft_button_t *pButtonSlots[TFT_BUTTON_MAX];
+static uint32_t pulTouchGrid[TFT_TOUCH_GRID_SIZE * TFT_TOUCH_GRID_SIZE]; // Mask of the button slots overlapping each cell
 static tft_button_callback_fn_t pfButtonCallback = NULL;
+static tft_gesture_callback_fn_t pfGestureCallback = NULL;
+static tft_gesture_t xTouchGesture; // Gesture in progress
+static tft_button_t *pTouchTarget = NULL; // Button under the press point
+static uint8_t ubTouchState = TFT_TOUCH_STATE_IDLE;
+static uint64_t ullTouchStart = 0;
+static uint64_t ullTouchLast = 0;
+static uint8_t pubLineBuffer[2][TFT_LINE_BUFFER_PIXELS * ILI9488_PIXEL_SIZE]; // Converted while the other one is being streamed
+static tft_frame_cmd_t pFrameCmds[TFT_FRAME_MAX_COMMANDS];
+static uint16_t usFrameCmdCount = 0;
+static uint16_t usFrameGlyphCmds = 0; // Recorded commands pointing into the glyph cache
+static uint8_t ubFrameDepth = 0;
+static uint8_t ubFrameScrollPending = 0; // Scroll registers written by the flush, after the frame memory they refer to
+static uint16_t usFrameScrollTop, usFrameScrollHeight, usFrameScrollStart;
+static uint32_t pulFrameRowCmds[TFT_TILE_GRID_SIZE][TFT_FRAME_MAX_COMMANDS / 32]; // Commands touching each tile row, one bit each
+static uint32_t pulFrameColCmds[TFT_TILE_GRID_SIZE][TFT_FRAME_MAX_COMMANDS / 32];
+static uint8_t pubTileBuffer[2][TFT_TILE_SIZE * TFT_TILE_SIZE * ILI9488_PIXEL_SIZE];
+static uint32_t pulTileCoverage[TFT_TILE_SIZE];
+static tft_frame_stats_t xFrameStats;
+static tft_glyph_cache_entry_t *pGlyphCacheBuckets[TFT_GLYPH_CACHE_BUCKETS];
+static tft_glyph_cache_entry_t *pGlyphCacheHead = NULL;
+static tft_glyph_cache_entry_t *pGlyphCacheTail = NULL;
+static tft_glyph_cache_stats_t xGlyphCacheStats;
+
+static tft_button_t* tft_button_hit_test(uint16_t usX, uint16_t usY)
+{
+    uint16_t usCellX = usX / TFT_TOUCH_GRID_CELL_SIZE;
+    uint16_t usCellY = usY / TFT_TOUCH_GRID_CELL_SIZE;
+
+    if(usCellX >= TFT_TOUCH_GRID_SIZE || usCellY >= TFT_TOUCH_GRID_SIZE)
+        return NULL;
+
+    uint32_t ulMask = pulTouchGrid[usCellY * TFT_TOUCH_GRID_SIZE + usCellX];
+
+    while(ulMask)
+    {
+        tft_button_t *pButton = pButtonSlots[__builtin_ctz(ulMask)];
+
+        ulMask &= ulMask - 1;
+
+        if((usX >= pButton->usOriginX) &&
+           (usX < (pButton->usOriginX + pButton->usWidth)) &&
+           (usY >= pButton->usOriginY) &&
+           (usY < (pButton->usOriginY + pButton->usHeight)))
+            return pButton;
+    }
+
+    return NULL;
+}
+static void tft_button_index(tft_button_t *pButton, uint8_t ubInsert)
+{
+    if(!pButton->usWidth || !pButton->usHeight)
+        return;
+
+    uint16_t usCellX0 = pButton->usOriginX / TFT_TOUCH_GRID_CELL_SIZE;
+    uint16_t usCellY0 = pButton->usOriginY / TFT_TOUCH_GRID_CELL_SIZE;
+    uint16_t usCellX1 = MIN((pButton->usOriginX + pButton->usWidth - 1) / TFT_TOUCH_GRID_CELL_SIZE, TFT_TOUCH_GRID_SIZE - 1);
+    uint16_t usCellY1 = MIN((pButton->usOriginY + pButton->usHeight - 1) / TFT_TOUCH_GRID_CELL_SIZE, TFT_TOUCH_GRID_SIZE - 1);
+
+    for(uint16_t usCellY = usCellY0; usCellY <= usCellY1; usCellY++)
+    {
+        for(uint16_t usCellX = usCellX0; usCellX <= usCellX1; usCellX++)
+        {
+            if(ubInsert)
+                pulTouchGrid[usCellY * TFT_TOUCH_GRID_SIZE + usCellX] |= 1UL << pButton->ubSlot;
+            else
+                pulTouchGrid[usCellY * TFT_TOUCH_GRID_SIZE + usCellX] &= ~(1UL << pButton->ubSlot);
+        }
+    }
+}
+static void tft_gesture_dispatch(uint8_t ubType)
+{
+    xTouchGesture.ubType = ubType;
+    xTouchGesture.ulDuration = g_ullSystemTick - ullTouchStart;
+
+    if(pTouchTarget && pTouchTarget->pfCallback)
+    {
+        pTouchTarget->pfCallback(pTouchTarget, &xTouchGesture);
+
+        return;
+    }
+
+    if(pTouchTarget && ubType == TFT_GESTURE_TAP)
+    {
+        if(pfButtonCallback)
+            pfButtonCallback(pTouchTarget->ubID);
+
+        return;
+    }
+
+    if(pfGestureCallback)
+        pfGestureCallback(pTouchTarget, &xTouchGesture);
+}
+static void tft_gesture_track(uint16_t usX, uint16_t usY)
+{
+    uint32_t ulDelta = g_ullSystemTick - ullTouchLast;
+
+    if(ulDelta)
+    {
+        // Moves are coalesced upstream, so each step may span several samples
+        int32_t lVelocityX = ((int32_t)usX - xTouchGesture.usX) * 1000 / (int32_t)ulDelta;
+        int32_t lVelocityY = ((int32_t)usY - xTouchGesture.usY) * 1000 / (int32_t)ulDelta;
+
+        lVelocityX = MAX(MIN(lVelocityX, INT16_MAX), INT16_MIN);
+        lVelocityY = MAX(MIN(lVelocityY, INT16_MAX), INT16_MIN);
+
+        xTouchGesture.sVelocityX = (xTouchGesture.sVelocityX + lVelocityX) / 2;
+        xTouchGesture.sVelocityY = (xTouchGesture.sVelocityY + lVelocityY) / 2;
+
+        ullTouchLast = g_ullSystemTick;
+    }
+
+    xTouchGesture.usX = usX;
+    xTouchGesture.usY = usY;
+
+    if(ubTouchState != TFT_TOUCH_STATE_DRAGGING && (ABS((int16_t)(usX - xTouchGesture.usStartX)) > TFT_GESTURE_DRAG_THRESHOLD || ABS((int16_t)(usY - xTouchGesture.usStartY)) > TFT_GESTURE_DRAG_THRESHOLD))
+        ubTouchState = TFT_TOUCH_STATE_DRAGGING;
+}
 
 void tft_touch_callback(uint8_t ubEvent, uint16_t usX, uint16_t usY)
 {
@@ -33,33 +151,84 @@ void tft_touch_callback(uint8_t ubEvent, uint16_t usX, uint16_t usY)
             break;
     }
 
-    if(ubEvent == FT6X06_REG_Pn_XH_EVENT_FLAG_PRESS_DOWN)
+    switch(ubEvent)
     {
-        for(tft_button_t *pButton = pButtonList; pButton; pButton = pButton->pNext)
-        {
-            if((usX >= pButton->usOriginX) &&
-               (usX < (pButton->usOriginX + pButton->usWidth)) &&
-               (usY >= pButton->usOriginY) &&
-               (usY < (pButton->usOriginY + pButton->usHeight)))
-                pfButtonCallback(pButton->ubID);
-        }
-    }
+        case FT6X06_REG_Pn_XH_EVENT_FLAG_PRESS_DOWN:
+            pTouchTarget = tft_button_hit_test(usX, usY);
+            ubTouchState = TFT_TOUCH_STATE_PRESSED;
+            ullTouchStart = g_ullSystemTick;
+            ullTouchLast = g_ullSystemTick;
+
+            xTouchGesture.ubDirection = TFT_GESTURE_DIR_NONE;
+            xTouchGesture.usX = usX;
+            xTouchGesture.usY = usY;
+            xTouchGesture.usStartX = usX;
+            xTouchGesture.usStartY = usY;
+            xTouchGesture.sVelocityX = 0;
+            xTouchGesture.sVelocityY = 0;
+        break;
+        case FT6X06_REG_Pn_XH_EVENT_FLAG_CONTACT:
+            if(ubTouchState == TFT_TOUCH_STATE_IDLE) // Press was lost
+                break;
 
-    static uint16_t usLastX, usLastY;
+            tft_gesture_track(usX, usY);
 
-    if(ubEvent == FT6X06_REG_Pn_XH_EVENT_FLAG_CONTACT)
-    {
-        tft_draw_line(usLastX, usLastY, usX, usY, RGB565_YELLOW);
-    }
+            if(ubTouchState == TFT_TOUCH_STATE_DRAGGING)
+                tft_gesture_dispatch(TFT_GESTURE_DRAG);
+            else
+                tft_tick();
+        break;
+        case FT6X06_REG_Pn_XH_EVENT_FLAG_LIFT_UP:
+            if(ubTouchState == TFT_TOUCH_STATE_IDLE)
+                break;
+
+            tft_gesture_track(usX, usY);
+
+            if(ubTouchState == TFT_TOUCH_STATE_PRESSED)
+            {
+                tft_gesture_dispatch(TFT_GESTURE_TAP);
+            }
+            else if(ubTouchState == TFT_TOUCH_STATE_DRAGGING)
+            {
+                int16_t sSpeedX = ABS(xTouchGesture.sVelocityX);
+                int16_t sSpeedY = ABS(xTouchGesture.sVelocityY);
+
+                if(MAX(sSpeedX, sSpeedY) >= TFT_GESTURE_SWIPE_VELOCITY)
+                {
+                    if(sSpeedX > sSpeedY)
+                        xTouchGesture.ubDirection = xTouchGesture.sVelocityX > 0 ? TFT_GESTURE_DIR_RIGHT : TFT_GESTURE_DIR_LEFT;
+                    else
+                        xTouchGesture.ubDirection = xTouchGesture.sVelocityY > 0 ? TFT_GESTURE_DIR_DOWN : TFT_GESTURE_DIR_UP;
+
+                    tft_gesture_dispatch(TFT_GESTURE_SWIPE);
+                }
+                else
+                {
+                    tft_gesture_dispatch(TFT_GESTURE_DRAG_END);
+                }
+            }
 
-    usLastX = usX;
-    usLastY = usY;
+            ubTouchState = TFT_TOUCH_STATE_IDLE;
+            pTouchTarget = NULL;
+        break;
+        default:
+        break;
+    }
 }
 
 void tft_init()
 {
     ft6x36_set_event_callback(tft_touch_callback);
 }
+void tft_tick()
+{
+    if(ubTouchState == TFT_TOUCH_STATE_PRESSED && (g_ullSystemTick - ullTouchStart) >= TFT_GESTURE_LONG_PRESS_TIME)
+    {
+        ubTouchState = TFT_TOUCH_STATE_LONG_PRESSED;
+
+        tft_gesture_dispatch(TFT_GESTURE_LONG_PRESS);
+    }
+}
 void tft_bl_init(uint32_t ulFrequency)
 {
     CMU->HFPERCLKEN1 |= CMU_HFPERCLKEN1_WTIMER2;
@@ -86,31 +255,563 @@ void tft_bl_set(float fBrightness)
     WTIMER2->CC[1].CCVB = WTIMER2->TOP * fBrightness;
 }
 
-void tft_draw_fast_v_line(uint16_t usX, uint16_t usY0, uint16_t usY1, rgb565_t xColor)
+static uint8_t tft_frame_tile_cmds(uint16_t usTileRow, uint16_t usTileCol, uint32_t *pulCmds)
 {
-    if(usY0 > usY1)
-        SWAP(usY0, usY1);
+    uint32_t ulAny = 0;
+
+    for(uint16_t usWord = 0; usWord < TFT_FRAME_MAX_COMMANDS / 32; usWord++)
+    {
+        pulCmds[usWord] = pulFrameRowCmds[usTileRow][usWord] & pulFrameColCmds[usTileCol][usWord];
+        ulAny |= pulCmds[usWord];
+    }
+
+    return !!ulAny;
+}
+static int16_t tft_frame_find_base(const uint32_t *pulCmds, uint16_t usTileX, uint16_t usTileY, uint16_t usTileW, uint16_t usTileH, uint8_t *pubLast)
+{
+    // Last command covering the whole tile, everything recorded before it is hidden
+    *pubLast = 1;
+
+    for(int16_t sWord = TFT_FRAME_MAX_COMMANDS / 32 - 1; sWord >= 0; sWord--)
+    {
+        uint32_t ulMask = pulCmds[sWord];
+
+        while(ulMask)
+        {
+            uint8_t ubBit = 31 - __builtin_clz(ulMask);
+            tft_frame_cmd_t *pCmd = &pFrameCmds[sWord * 32 + ubBit];
+
+            if(pCmd->sX0 <= (int16_t)usTileX && pCmd->sY0 <= (int16_t)usTileY && pCmd->sX1 >= (int16_t)(usTileX + usTileW - 1) && pCmd->sY1 >= (int16_t)(usTileY + usTileH - 1))
+                return sWord * 32 + ubBit;
+
+            ulMask &= ~(1UL << ubBit);
+            *pubLast = 0;
+        }
+    }
+
+    return -1;
+}
+static void tft_frame_render_tile(const uint32_t *pulCmds, uint16_t usFirst, uint16_t usTileX, uint16_t usTileY, uint16_t usTileW, uint16_t usTileH, uint8_t *pubTile)
+{
+    memset(pulTileCoverage, 0, sizeof(pulTileCoverage));
+
+    for(uint16_t usWord = usFirst / 32; usWord < TFT_FRAME_MAX_COMMANDS / 32; usWord++)
+    {
+        uint32_t ulMask = pulCmds[usWord];
+
+        if(usWord == usFirst / 32)
+            ulMask &= ~((1UL << (usFirst & 31)) - 1);
+
+        while(ulMask)
+        {
+            tft_frame_cmd_t *pCmd = &pFrameCmds[usWord * 32 + __builtin_ctz(ulMask)];
+            int16_t sX0 = MAX(pCmd->sX0, (int16_t)usTileX);
+            int16_t sY0 = MAX(pCmd->sY0, (int16_t)usTileY);
+            int16_t sX1 = MIN(pCmd->sX1, (int16_t)(usTileX + usTileW - 1));
+            int16_t sY1 = MIN(pCmd->sY1, (int16_t)(usTileY + usTileH - 1));
+
+            ulMask &= ulMask - 1;
+
+            if(sX0 > sX1 || sY0 > sY1)
+                continue; // Shares the tile row and column but not the tile
+
+            uint16_t usCmdW = pCmd->sX1 - pCmd->sX0 + 1;
+            uint32_t ulRowMask = (sX1 - sX0 == 31) ? 0xFFFFFFFF : (((1UL << (sX1 - sX0 + 1)) - 1) << (sX0 - usTileX));
+
+            for(int16_t sY = sY0; sY <= sY1; sY++)
+            {
+                uint8_t *pubDst = pubTile + ((sY - usTileY) * usTileW + (sX0 - usTileX)) * ILI9488_PIXEL_SIZE;
+                uint32_t ulIndex = (uint32_t)(sY - pCmd->sY0) * usCmdW + (sX0 - pCmd->sX0);
+
+                pulTileCoverage[sY - usTileY] |= ulRowMask;
+
+                switch(pCmd->ubType)
+                {
+                    case TFT_FRAME_CMD_BLOCK:
+                        for(int16_t sX = sX0; sX <= sX1; sX++)
+                            pubDst = ili9488_pack_pixel(pubDst, pCmd->xColor);
+                    break;
+                    case TFT_FRAME_CMD_BITMAP:
+                    {
+                        const uint8_t *pubBitmap = (const uint8_t *)pCmd->pData;
+
+                        for(int16_t sX = sX0; sX <= sX1; sX++, ulIndex++)
+                            pubDst = ili9488_pack_pixel(pubDst, (pubBitmap[ulIndex >> 3] & (0x80 >> (ulIndex & 7))) ? pCmd->xColor : pCmd->xBackColor);
+                    }
+                    break;
+                    case TFT_FRAME_CMD_IMAGE:
+                    {
+                        const rgb565_t *pPixels = (const rgb565_t *)pCmd->pData;
+
+                        for(int16_t sX = sX0; sX <= sX1; sX++, ulIndex++)
+                            pubDst = ili9488_pack_pixel(pubDst, pPixels[ulIndex]);
+                    }
+                    break;
+                    case TFT_FRAME_CMD_IMAGE666:
+                        memcpy(pubDst, (const uint8_t *)pCmd->pData + ulIndex * ILI9488_PIXEL_SIZE, (sX1 - sX0 + 1) * ILI9488_PIXEL_SIZE);
+                    break;
+                }
+            }
+        }
+    }
+}
+static void tft_frame_flush_tile(uint16_t usTileX, uint16_t usTileY, uint16_t usTileW, uint16_t usTileH, uint8_t *pubTile)
+{
+    uint32_t ulFullMask = (usTileW == 32) ? 0xFFFFFFFF : ((1UL << usTileW) - 1);
+    uint8_t ubFull = 1;
+
+    for(uint16_t usRow = 0; usRow < usTileH; usRow++)
+    {
+        if(pulTileCoverage[usRow] != ulFullMask)
+        {
+            ubFull = 0;
+
+            break;
+        }
+    }
+
+    if(ubFull)
+    {
+        if(ili9488_set_window(usTileX, usTileY, usTileX + usTileW - 1, usTileY + usTileH - 1))
+            ili9488_write_pixels(pubTile, usTileW * usTileH, NULL);
 
-    if(!ili9488_set_window(usX, usY0, usX, usY1))
         return;
+    }
+
+    // Only the covered pixels are known, anything else on the panel must be left alone
+    // Rows sharing a coverage mask (a glyph or a block seen through the tile) get one window per run, streamed a row at a time
+    for(uint16_t usRow = 0; usRow < usTileH; )
+    {
+        uint32_t ulMask = pulTileCoverage[usRow];
+        uint16_t usRows = 1;
+        uint16_t usCol = 0;
+
+        while(usRow + usRows < usTileH && pulTileCoverage[usRow + usRows] == ulMask)
+            usRows++;
 
-    uint32_t ulDataLen = usY1 - usY0 + 1;
+        while(ulMask)
+        {
+            while(!(ulMask & 1))
+            {
+                ulMask >>= 1;
+                usCol++;
+            }
 
-    while(ulDataLen--)
-        ili9488_send_pixel_data(xColor);
+            uint16_t usStart = usCol;
+
+            while(ulMask & 1)
+            {
+                ulMask >>= 1;
+                usCol++;
+            }
+
+            if(!ili9488_set_window(usTileX + usStart, usTileY + usRow, usTileX + usCol - 1, usTileY + usRow + usRows - 1))
+                continue;
+
+            if(usCol - usStart == usTileW) // Whole tile rows are contiguous in the buffer
+                ili9488_write_pixels(pubTile + usRow * usTileW * ILI9488_PIXEL_SIZE, usTileW * usRows, NULL);
+            else
+                for(uint16_t usLine = usRow; usLine < usRow + usRows; usLine++)
+                    ili9488_write_pixels(pubTile + (usLine * usTileW + usStart) * ILI9488_PIXEL_SIZE, usCol - usStart, NULL);
+        }
+
+        usRow += usRows;
+    }
 }
-void tft_draw_fast_h_line(uint16_t usX0, uint16_t usY0, uint16_t usX1, rgb565_t xColor)
+static void tft_frame_flush_fill(uint16_t usTileCol0, uint16_t usTileCol1, uint16_t usTileRow0, uint16_t usTileRow1, rgb565_t xColor)
 {
-    if(usX0 > usX1)
-        SWAP(usX0, usX1);
+    uint16_t usX0 = usTileCol0 * TFT_TILE_SIZE;
+    uint16_t usY0 = usTileRow0 * TFT_TILE_SIZE;
+    uint16_t usX1 = MIN((usTileCol1 + 1) * TFT_TILE_SIZE, ili9488_get_width()) - 1;
+    uint16_t usY1 = MIN((usTileRow1 + 1) * TFT_TILE_SIZE, ili9488_get_height()) - 1;
+    uint32_t ulPixels = (uint32_t)(usX1 - usX0 + 1) * (usY1 - usY0 + 1);
+
+    if(!ili9488_set_window(usX0, usY0, usX1, usY1))
+        return;
+
+    ili9488_fill_pixels(xColor, ulPixels, NULL);
+
+    xFrameStats.ulLastFillBytes += ulPixels * ILI9488_PIXEL_SIZE;
+}
+static void tft_frame_flush()
+{
+    uint16_t usWidth = ili9488_get_width();
+    uint16_t usHeight = ili9488_get_height();
+    uint16_t usTilesX = (usWidth + TFT_TILE_SIZE - 1) / TFT_TILE_SIZE;
+    uint16_t usTilesY = (usHeight + TFT_TILE_SIZE - 1) / TFT_TILE_SIZE;
+    uint8_t ubBuffer = 0;
+    uint32_t pulCmds[TFT_FRAME_MAX_COMMANDS / 32];
+    uint32_t ulOpenFills = 0; // Rectangles of solid tiles still growing downwards, by first tile column
+    uint16_t pusFillCol1[TFT_TILE_GRID_SIZE];
+    uint16_t pusFillRow0[TFT_TILE_GRID_SIZE];
+    rgb565_t pxFillColor[TFT_TILE_GRID_SIZE];
+
+    xFrameStats.usLastCommands += usFrameCmdCount;
+
+    for(uint16_t usTileRow = 0; usTileRow < usTilesY; usTileRow++)
+    {
+        uint32_t ulSolid = 0;
+        rgb565_t pxSolidColor[TFT_TILE_GRID_SIZE];
+
+        for(uint16_t usTileCol = 0; usTileCol < usTilesX; usTileCol++)
+        {
+            if(!tft_frame_tile_cmds(usTileRow, usTileCol, pulCmds))
+                continue;
+
+            uint16_t usTileX = usTileCol * TFT_TILE_SIZE;
+            uint16_t usTileY = usTileRow * TFT_TILE_SIZE;
+            uint16_t usTileW = MIN(TFT_TILE_SIZE, usWidth - usTileX);
+            uint16_t usTileH = MIN(TFT_TILE_SIZE, usHeight - usTileY);
+            uint8_t ubLast;
+            int16_t sBase = tft_frame_find_base(pulCmds, usTileX, usTileY, usTileW, usTileH, &ubLast);
+
+            if(sBase >= 0 && ubLast && pFrameCmds[sBase].ubType == TFT_FRAME_CMD_BLOCK)
+            {
+                ulSolid |= BIT(usTileCol);
+                pxSolidColor[usTileCol] = pFrameCmds[sBase].xColor;
+
+                continue;
+            }
+
+            // The previous tile is still being streamed from the other buffer while this one renders
+            tft_frame_render_tile(pulCmds, MAX(sBase, 0), usTileX, usTileY, usTileW, usTileH, pubTileBuffer[ubBuffer]);
+            tft_frame_flush_tile(usTileX, usTileY, usTileW, usTileH, pubTileBuffer[ubBuffer]);
+
+            xFrameStats.usLastTiles++;
+            ubBuffer ^= 1;
+        }
+
+        // Solid tiles of one color are merged into runs, runs matching the one above extend its rectangle
+        uint32_t ulContinued = 0;
+
+        for(uint16_t usTileCol = 0; usTileCol < usTilesX; usTileCol++)
+        {
+            if(!(ulSolid & BIT(usTileCol)))
+                continue;
+
+            uint16_t usRunStart = usTileCol;
+
+            while(usTileCol + 1 < usTilesX && (ulSolid & BIT(usTileCol + 1)) && pxSolidColor[usTileCol + 1] == pxSolidColor[usRunStart])
+                usTileCol++;
+
+            if((ulOpenFills & BIT(usRunStart)) && pusFillCol1[usRunStart] == usTileCol && pxFillColor[usRunStart] == pxSolidColor[usRunStart])
+            {
+                ulContinued |= BIT(usRunStart);
+
+                continue;
+            }
+
+            if(ulOpenFills & BIT(usRunStart))
+                tft_frame_flush_fill(usRunStart, pusFillCol1[usRunStart], pusFillRow0[usRunStart], usTileRow - 1, pxFillColor[usRunStart]);
+
+            pusFillCol1[usRunStart] = usTileCol;
+            pusFillRow0[usRunStart] = usTileRow;
+            pxFillColor[usRunStart] = pxSolidColor[usRunStart];
+
+            ulOpenFills |= BIT(usRunStart);
+            ulContinued |= BIT(usRunStart);
+        }
+
+        for(uint32_t ulDone = ulOpenFills & ~ulContinued; ulDone; ulDone &= ulDone - 1)
+        {
+            uint16_t usCol = __builtin_ctz(ulDone);
+
+            tft_frame_flush_fill(usCol, pusFillCol1[usCol], pusFillRow0[usCol], usTileRow - 1, pxFillColor[usCol]);
+        }
+
+        ulOpenFills &= ulContinued;
+    }
+
+    for(; ulOpenFills; ulOpenFills &= ulOpenFills - 1)
+    {
+        uint16_t usCol = __builtin_ctz(ulOpenFills);
+
+        tft_frame_flush_fill(usCol, pusFillCol1[usCol], pusFillRow0[usCol], usTilesY - 1, pxFillColor[usCol]);
+    }
+
+    ili9488_dma_wait();
+
+    if(ubFrameScrollPending & TFT_FRAME_SCROLL_AREA)
+        ili9488_set_scroll_area(usFrameScrollTop, usFrameScrollHeight);
+
+    if(ubFrameScrollPending & TFT_FRAME_SCROLL_START)
+        ili9488_set_scroll_start(usFrameScrollStart);
+
+    memset(pulFrameRowCmds, 0, sizeof(pulFrameRowCmds));
+    memset(pulFrameColCmds, 0, sizeof(pulFrameColCmds));
+
+    usFrameCmdCount = 0;
+    usFrameGlyphCmds = 0;
+    ubFrameScrollPending = 0;
+}
+static uint8_t tft_frame_record(uint8_t ubType, int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1, rgb565_t xColor, rgb565_t xBackColor, const void *pData)
+{
+    if(!ubFrameDepth)
+        return 0;
+
+    int16_t sWidth = ili9488_get_width();
+    int16_t sHeight = ili9488_get_height();
+
+    if(sX1 < 0 || sY1 < 0 || sX0 >= sWidth || sY0 >= sHeight || sX0 > sX1 || sY0 > sY1)
+        return 1; // Nothing visible, swallow it anyway
+
+    if(ubType == TFT_FRAME_CMD_BLOCK && sX0 <= 0 && sY0 <= 0 && sX1 >= sWidth - 1 && sY1 >= sHeight - 1)
+    {
+        // Screen wide block, whatever was recorded so far can never show
+        memset(pulFrameRowCmds, 0, sizeof(pulFrameRowCmds));
+        memset(pulFrameColCmds, 0, sizeof(pulFrameColCmds));
+
+        xFrameStats.usLastCommands += usFrameCmdCount;
 
-    if(!ili9488_set_window(usX0, usY0, usX1, usY0))
+        usFrameCmdCount = 0;
+        usFrameGlyphCmds = 0;
+    }
+
+    if(usFrameCmdCount == TFT_FRAME_MAX_COMMANDS)
+        tft_frame_flush(); // Out of room, composite what we have so far
+
+    uint16_t usCmd = usFrameCmdCount++;
+    tft_frame_cmd_t *pCmd = &pFrameCmds[usCmd];
+
+    pCmd->ubType = ubType;
+    pCmd->sX0 = sX0;
+    pCmd->sY0 = sY0;
+    pCmd->sX1 = sX1;
+    pCmd->sY1 = sY1;
+    pCmd->xColor = xColor;
+    pCmd->xBackColor = xBackColor;
+    pCmd->pData = pData;
+
+    if(ubType == TFT_FRAME_CMD_IMAGE666)
+        usFrameGlyphCmds++;
+
+    // Each tile walks only the commands found in both its tile row and its tile column
+    for(uint16_t usTileRow = MAX(sY0, 0) / TFT_TILE_SIZE; usTileRow <= MIN(sY1, sHeight - 1) / TFT_TILE_SIZE; usTileRow++)
+        pulFrameRowCmds[usTileRow][usCmd >> 5] |= 1UL << (usCmd & 31);
+
+    for(uint16_t usTileCol = MAX(sX0, 0) / TFT_TILE_SIZE; usTileCol <= MIN(sX1, sWidth - 1) / TFT_TILE_SIZE; usTileCol++)
+        pulFrameColCmds[usTileCol][usCmd >> 5] |= 1UL << (usCmd & 31);
+
+    return 1;
+}
+// Inside a frame the panel would otherwise scroll before the lines moving in are drawn, only the last value of each register matters
+static void tft_frame_set_scroll_area(uint16_t usTop, uint16_t usHeight)
+{
+    if(!ubFrameDepth)
+    {
+        ili9488_set_scroll_area(usTop, usHeight);
+
+        return;
+    }
+
+    usFrameScrollTop = usTop;
+    usFrameScrollHeight = usHeight;
+    ubFrameScrollPending |= TFT_FRAME_SCROLL_AREA;
+}
+static void tft_frame_set_scroll_start(uint16_t usLine)
+{
+    if(!ubFrameDepth)
+    {
+        ili9488_set_scroll_start(usLine);
+
+        return;
+    }
+
+    usFrameScrollStart = usLine;
+    ubFrameScrollPending |= TFT_FRAME_SCROLL_START;
+}
+
+void tft_frame_begin()
+{
+    if(ubFrameDepth++)
         return;
 
-    uint32_t ulDataLen = usX1 - usX0 + 1;
+    ili9488_stats_t xStats;
+
+    ili9488_get_stats(&xStats);
 
-    while(ulDataLen--)
-        ili9488_send_pixel_data(xColor);
+    xFrameStats.ulLastBytes = xStats.ulBytesSent; // Start marker, turned into a delta on end
+    xFrameStats.ulLastFillBytes = 0;
+    xFrameStats.ulLastCycles = DBG_CYCLE_COUNTER();
+    xFrameStats.usLastCommands = 0;
+    xFrameStats.usLastTiles = 0;
+}
+void tft_frame_end()
+{
+    if(!ubFrameDepth || --ubFrameDepth)
+        return;
+
+    tft_frame_flush();
+
+    ili9488_stats_t xStats;
+
+    ili9488_get_stats(&xStats);
+
+    xFrameStats.ulLastBytes = xStats.ulBytesSent - xFrameStats.ulLastBytes;
+    xFrameStats.ulLastCycles = DBG_CYCLE_COUNTER() - xFrameStats.ulLastCycles;
+    xFrameStats.ulFrames++;
+}
+void tft_frame_get_stats(tft_frame_stats_t *pStats)
+{
+    if(!pStats)
+        return;
+
+    *pStats = xFrameStats;
+}
+
+static void tft_draw_block(int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1, rgb565_t xColor)
+{
+    int16_t sWidth = ili9488_get_width();
+    int16_t sHeight = ili9488_get_height();
+
+    if(sX0 > sX1)
+        SWAP(sX0, sX1);
+
+    if(sY0 > sY1)
+        SWAP(sY0, sY1);
+
+    if(tft_frame_record(TFT_FRAME_CMD_BLOCK, sX0, sY0, sX1, sY1, xColor, xColor, NULL))
+        return;
+
+    if(sX1 < 0 || sX0 >= sWidth || sY1 < 0 || sY0 >= sHeight)
+        return;
+
+    if(sX0 < 0)
+        sX0 = 0;
+
+    if(sY0 < 0)
+        sY0 = 0;
+
+    if(sX1 >= sWidth)
+        sX1 = sWidth - 1;
+
+    if(sY1 >= sHeight)
+        sY1 = sHeight - 1;
+
+    if(!ili9488_set_window(sX0, sY0, sX1, sY1))
+        return;
+
+    ili9488_fill_pixels(xColor, (uint32_t)(sX1 - sX0 + 1) * (sY1 - sY0 + 1), NULL);
+}
+static void tft_draw_span_h(int16_t sX0, int16_t sX1, int16_t sY, rgb565_t xColor)
+{
+    tft_draw_block(sX0, sY, sX1, sY, xColor);
+}
+static void tft_draw_span_v(int16_t sX, int16_t sY0, int16_t sY1, rgb565_t xColor)
+{
+    tft_draw_block(sX, sY0, sX, sY1, xColor);
+}
+static void tft_draw_round_run(int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1, int16_t sRunStart, int16_t sRunEnd, int16_t sOffset, rgb565_t xColor)
+{
+    // Run of an arc octant at distance sOffset, mirrored to the four corners and swapped to the other octant
+    // (sX0, sY0) is the top left corner center and (sX1, sY1) the bottom right one, they are the same for a circle
+    if(!sRunStart)
+    {
+        tft_draw_span_h(sX0 - sRunEnd, sX1 + sRunEnd, sY0 - sOffset, xColor);
+        tft_draw_span_h(sX0 - sRunEnd, sX1 + sRunEnd, sY1 + sOffset, xColor);
+        tft_draw_span_v(sX0 - sOffset, sY0 - sRunEnd, sY1 + sRunEnd, xColor);
+        tft_draw_span_v(sX1 + sOffset, sY0 - sRunEnd, sY1 + sRunEnd, xColor);
+
+        return;
+    }
+
+    tft_draw_span_h(sX0 - sRunEnd, sX0 - sRunStart, sY0 - sOffset, xColor);
+    tft_draw_span_h(sX1 + sRunStart, sX1 + sRunEnd, sY0 - sOffset, xColor);
+    tft_draw_span_h(sX0 - sRunEnd, sX0 - sRunStart, sY1 + sOffset, xColor);
+    tft_draw_span_h(sX1 + sRunStart, sX1 + sRunEnd, sY1 + sOffset, xColor);
+    tft_draw_span_v(sX0 - sOffset, sY0 - sRunEnd, sY0 - sRunStart, xColor);
+    tft_draw_span_v(sX0 - sOffset, sY1 + sRunStart, sY1 + sRunEnd, xColor);
+    tft_draw_span_v(sX1 + sOffset, sY0 - sRunEnd, sY0 - sRunStart, xColor);
+    tft_draw_span_v(sX1 + sOffset, sY1 + sRunStart, sY1 + sRunEnd, xColor);
+}
+static void tft_draw_round(int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1, int16_t sR, rgb565_t xColor, uint8_t ubFill)
+{
+    int16_t sF = 1 - sR;
+    int16_t sDdFx = 1;
+    int16_t sDdFy = -2 * sR;
+    int16_t sXh = 0;
+    int16_t sYh = sR;
+
+    if(ubFill)
+    {
+        int16_t sLastXh = sXh;
+        int16_t sLastYh = sYh;
+
+        tft_draw_block(sX0 - sR, sY0, sX1 + sR, sY1, xColor);
+
+        while(sXh < sYh)
+        {
+            if(sF >= 0)
+            {
+                sYh--;
+                sDdFy += 2;
+                sF += sDdFy;
+            }
+
+            sXh++;
+            sDdFx += 2;
+            sF += sDdFx;
+
+            if(sXh <= sYh) // Avoid drawing the rows at the octant boundary twice
+            {
+                tft_draw_span_h(sX0 - sYh, sX1 + sYh, sY0 - sXh, xColor);
+                tft_draw_span_h(sX0 - sYh, sX1 + sYh, sY1 + sXh, xColor);
+            }
+
+            if(sYh != sLastYh)
+            {
+                tft_draw_span_h(sX0 - sLastXh, sX1 + sLastXh, sY0 - sLastYh, xColor);
+                tft_draw_span_h(sX0 - sLastXh, sX1 + sLastXh, sY1 + sLastYh, xColor);
+
+                sLastYh = sYh;
+            }
+
+            sLastXh = sXh;
+        }
+
+        return;
+    }
+
+    int16_t sRunStart = 0;
+
+    while(sXh < sYh)
+    {
+        int16_t sLastXh = sXh;
+        int16_t sLastYh = sYh;
+
+        if(sF >= 0)
+        {
+            sYh--;
+            sDdFy += 2;
+            sF += sDdFy;
+        }
+
+        sXh++;
+        sDdFx += 2;
+        sF += sDdFx;
+
+        if(sYh != sLastYh)
+        {
+            tft_draw_round_run(sX0, sY0, sX1, sY1, sRunStart, sLastXh, sLastYh, xColor);
+
+            sRunStart = sXh;
+        }
+    }
+
+    tft_draw_round_run(sX0, sY0, sX1, sY1, sRunStart, sXh, sYh, xColor);
+}
+
+void tft_fill_screen(rgb565_t xColor)
+{
+    tft_draw_block(0, 0, ili9488_get_width() - 1, ili9488_get_height() - 1, xColor);
+}
+void tft_draw_fast_v_line(uint16_t usX, uint16_t usY0, uint16_t usY1, rgb565_t xColor)
+{
+    tft_draw_span_v(usX, usY0, usY1, xColor);
+}
+void tft_draw_fast_h_line(uint16_t usX0, uint16_t usY0, uint16_t usX1, rgb565_t xColor)
+{
+    tft_draw_span_h(usX0, usX1, usY0, xColor);
 }
 void tft_draw_line(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, rgb565_t xColor)
 {
@@ -128,50 +829,74 @@ void tft_draw_line(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, r
         return;
     }
 
-    uint8_t ubSteep = ABS(usY1 - usY0) > ABS(usX1 - usX0);
-    uint8_t ubdx, ubdy;
-    int8_t bErr;
-    int8_t bYstep;
+    int16_t sX0 = usX0;
+    int16_t sY0 = usY0;
+    int16_t sX1 = usX1;
+    int16_t sY1 = usY1;
+    uint8_t ubSteep = ABS(sY1 - sY0) > ABS(sX1 - sX0);
 
     if(ubSteep)
     {
-        SWAP(usX0, usY0);
-        SWAP(usX1, usY1);
+        SWAP(sX0, sY0);
+        SWAP(sX1, sY1);
     }
 
-    if(usX0 > usX1)
+    if(sX0 > sX1)
     {
-        SWAP(usX0, usX1);
-        SWAP(usY0, usY1);
+        SWAP(sX0, sX1);
+        SWAP(sY0, sY1);
     }
 
-    ubdx = usX1 - usX0;
-    ubdy = ABS(usY1 - usY0);
-
-    bErr = ubdx / 2;
+    int16_t sDx = sX1 - sX0;
+    int16_t sDy = ABS(sY1 - sY0);
+    int16_t sErr = sDx / 2;
+    int16_t sYStep = sY0 < sY1 ? 1 : -1;
+    int16_t sRunStart = sX0;
 
-    if(usY0 < usY1)
-        bYstep = 1;
-    else
-        bYstep = -1;
-
-    while(usX0 <= usX1)
+    // Bresenham, but every run of pixels along the major axis goes out as a single window
+    for(; sX0 <= sX1; sX0++)
     {
-        if(ubSteep)
-            ili9488_set_pixel_color(usY0, usX0, xColor);
-        else
-            ili9488_set_pixel_color(usX0, usY0, xColor);
+        sErr -= sDy;
 
-        bErr -= ubdy;
-
-        if(bErr < 0)
+        if(sErr < 0 || sX0 == sX1)
         {
-            usY0 += bYstep;
-            bErr += ubdx;
+            if(ubSteep)
+                tft_draw_span_v(sY0, sRunStart, sX0, xColor);
+            else
+                tft_draw_span_h(sRunStart, sX0, sY0, xColor);
+
+            sY0 += sYStep;
+            sErr += sDx;
+            sRunStart = sX0 + 1;
         }
+    }
+}
+void tft_draw_thick_line(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, uint16_t usThickness, rgb565_t xColor)
+{
+    if(usThickness < 2)
+    {
+        tft_draw_line(usX0, usY0, usX1, usY1, xColor);
+
+        return;
+    }
 
-        usX0++;
+    float fDx = (float)usX1 - usX0;
+    float fDy = (float)usY1 - usY0;
+    float fLen = sqrtf(fDx * fDx + fDy * fDy);
+
+    if(fLen < 1.f)
+    {
+        tft_draw_circle(usX0, usY0, usThickness >> 1, xColor, 1);
+
+        return;
     }
+
+    // Offset both ends along the normal and fill the resulting quad as two triangles
+    int16_t sOffX = lroundf(-fDy * usThickness / (2.f * fLen));
+    int16_t sOffY = lroundf(fDx * usThickness / (2.f * fLen));
+
+    tft_fill_triangle(usX0 + sOffX, usY0 + sOffY, usX1 + sOffX, usY1 + sOffY, usX1 - sOffX, usY1 - sOffY, xColor);
+    tft_fill_triangle(usX0 + sOffX, usY0 + sOffY, usX1 - sOffX, usY1 - sOffY, usX0 - sOffX, usY0 - sOffY, xColor);
 }
 void tft_draw_rectangle(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, rgb565_t xColor, uint8_t ubFill)
 {
@@ -183,13 +908,7 @@ void tft_draw_rectangle(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t us
 
     if(ubFill)
     {
-        if(!ili9488_set_window(usX0, usY0, usX1, usY1))
-            return;
-
-        uint32_t ulDataLen = (usY1 - usY0 + 1) * (usX1 - usX0 + 1);
-
-        while(ulDataLen--)
-            ili9488_send_pixel_data(xColor);
+        tft_draw_block(usX0, usY0, usX1, usY1, xColor);
     }
     else
     {
@@ -199,126 +918,464 @@ void tft_draw_rectangle(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t us
         tft_draw_fast_h_line(usX0, usY1, usX1, xColor);
     }
 }
-void tft_draw_circle(uint16_t usX, uint16_t usY, uint16_t usR, rgb565_t xColor, uint8_t ubFill)
+void tft_draw_rounded_rectangle(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, uint16_t usR, rgb565_t xColor, uint8_t ubFill)
+{
+    if(usX0 > usX1)
+        SWAP(usX0, usX1);
+
+    if(usY0 > usY1)
+        SWAP(usY0, usY1);
+
+    uint16_t usMaxR = MIN(usX1 - usX0, usY1 - usY0) >> 1;
+
+    if(usR > usMaxR)
+        usR = usMaxR;
+
+    tft_draw_round(usX0 + usR, usY0 + usR, usX1 - usR, usY1 - usR, usR, xColor, ubFill);
+}
+void tft_draw_circle(uint16_t usX, uint16_t usY, uint16_t usR, rgb565_t xColor, uint8_t ubFill)
+{
+    tft_draw_round(usX, usY, usX, usY, usR, xColor, ubFill);
+}
+void tft_draw_triangle(uint16_t usX0, uint16_t usY0, uint16_t usX1, uint16_t usY1, uint16_t usX2, uint16_t usY2, rgb565_t xColor, uint8_t ubFill)
+{
+    if(ubFill)
+    {
+        tft_fill_triangle(usX0, usY0, usX1, usY1, usX2, usY2, xColor);
+
+        return;
+    }
+
+    tft_draw_line(usX0, usY0, usX1, usY1, xColor);
+    tft_draw_line(usX1, usY1, usX2, usY2, xColor);
+    tft_draw_line(usX2, usY2, usX0, usY0, xColor);
+}
+void tft_fill_triangle(int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1, int16_t sX2, int16_t sY2, rgb565_t xColor)
+{
+    // Sort by Y, sY0 <= sY1 <= sY2
+    if(sY0 > sY1)
+    {
+        SWAP(sY0, sY1);
+        SWAP(sX0, sX1);
+    }
+
+    if(sY1 > sY2)
+    {
+        SWAP(sY2, sY1);
+        SWAP(sX2, sX1);
+    }
+
+    if(sY0 > sY1)
+    {
+        SWAP(sY0, sY1);
+        SWAP(sX0, sX1);
+    }
+
+    if(sY0 == sY2) // Degenerate, single row
+    {
+        int16_t sMin = MIN(sX0, MIN(sX1, sX2));
+        int16_t sMax = MAX(sX0, MAX(sX1, sX2));
+
+        tft_draw_span_h(sMin, sMax, sY0, xColor);
+
+        return;
+    }
+
+    int32_t lDx01 = sX1 - sX0;
+    int32_t lDy01 = sY1 - sY0;
+    int32_t lDx02 = sX2 - sX0;
+    int32_t lDy02 = sY2 - sY0;
+    int32_t lDx12 = sX2 - sX1;
+    int32_t lDy12 = sY2 - sY1;
+    int32_t lSa = 0;
+    int32_t lSb = 0;
+    int16_t sY;
+    int16_t sLast = (sY1 == sY2) ? sY1 : sY1 - 1; // Include the middle row in the upper half only if the lower half is flat
+
+    for(sY = sY0; sY <= sLast; sY++)
+    {
+        tft_draw_span_h(sX0 + lSa / lDy01, sX0 + lSb / lDy02, sY, xColor);
+
+        lSa += lDx01;
+        lSb += lDx02;
+    }
+
+    lSa = lDx12 * (sY - sY1);
+    lSb = lDx02 * (sY - sY0);
+
+    for(; sY <= sY2; sY++)
+    {
+        tft_draw_span_h(sX1 + lSa / lDy12, sX0 + lSb / lDy02, sY, xColor);
+
+        lSa += lDx12;
+        lSb += lDx02;
+    }
+}
+
+static inline rgb565_t tft_image_apply_diff(rgb565_t xColor, int8_t bDR, int8_t bDG, int8_t bDB)
+{
+    uint16_t usR = ((xColor >> 11) + bDR) & 0x1F;
+    uint16_t usG = (((xColor >> 5) & 0x3F) + bDG) & 0x3F;
+    uint16_t usB = ((xColor & 0x1F) + bDB) & 0x1F;
+
+    return (usR << 11) | (usG << 5) | usB;
+}
+static inline uint8_t tft_image_hash(rgb565_t xColor)
+{
+    return ((xColor >> 11) * 3 + ((xColor >> 5) & 0x3F) * 5 + (xColor & 0x1F) * 7) & (IMAGE_QOI565_INDEX_SIZE - 1);
+}
+static uint32_t tft_image_decode(tft_image_stream_t *pStream, uint8_t *pubDst, uint32_t ulCount)
+{
+    uint32_t ulDecoded = 0;
+
+    while(ulDecoded < ulCount)
+    {
+        if(pStream->ulRun)
+        {
+            if(pStream->ulRun >= TFT_IMAGE_FILL_MIN_RUN)
+                break; // Worth a DMA fill, left to the caller
+
+            uint32_t ulRun = MIN(pStream->ulRun, ulCount - ulDecoded);
+
+            pStream->ulRun -= ulRun;
+            ulDecoded += ulRun;
+
+            while(ulRun--)
+                pubDst = ili9488_pack_pixel(pubDst, pStream->xPrev);
+
+            continue;
+        }
+
+        if(pStream->pubSrc >= pStream->pubEnd)
+            break;
+
+        uint8_t ubOp = *pStream->pubSrc++;
+        rgb565_t xColor = pStream->xPrev;
+
+        if(ubOp == IMAGE_QOI565_OP_RGB)
+        {
+            xColor = ((rgb565_t)pStream->pubSrc[0] << 8) | pStream->pubSrc[1];
+
+            pStream->pubSrc += 2;
+        }
+        else if(ubOp == IMAGE_QOI565_OP_LONG_RUN)
+        {
+            pStream->ulRun = (((uint32_t)pStream->pubSrc[0] << 8) | pStream->pubSrc[1]) + 1;
+            pStream->pubSrc += 2;
+
+            continue;
+        }
+        else
+        {
+            switch(ubOp & IMAGE_QOI565_OP_MASK)
+            {
+                case IMAGE_QOI565_OP_INDEX:
+                    xColor = pStream->pIndex[ubOp];
+                break;
+                case IMAGE_QOI565_OP_DIFF:
+                    xColor = tft_image_apply_diff(xColor, ((ubOp >> 4) & 3) - 2, ((ubOp >> 2) & 3) - 2, (ubOp & 3) - 2);
+                break;
+                case IMAGE_QOI565_OP_LUMA:
+                {
+                    int8_t bDG = (ubOp & 0x3F) - 32;
+                    uint8_t ubRB = *pStream->pubSrc++;
+
+                    xColor = tft_image_apply_diff(xColor, bDG + (ubRB >> 4) - 8, bDG, bDG + (ubRB & 0x0F) - 8);
+                }
+                break;
+                case IMAGE_QOI565_OP_RUN:
+                    pStream->ulRun = (ubOp & 0x3F) + 1;
+                continue;
+            }
+        }
+
+        pStream->pIndex[tft_image_hash(xColor)] = xColor;
+        pStream->xPrev = xColor;
+
+        pubDst = ili9488_pack_pixel(pubDst, xColor);
+        ulDecoded++;
+    }
+
+    return ulDecoded;
+}
+static void tft_draw_image_raw(const image_t *pImage)
+{
+    const rgb565_t *pPixels = (const rgb565_t *)pImage->pData;
+    uint32_t ulImgSize = pImage->usWidth * pImage->usHeight;
+    uint8_t ubBuffer = 0;
+
+    while(ulImgSize)
+    {
+        uint32_t ulCount = ulImgSize > TFT_LINE_BUFFER_PIXELS ? TFT_LINE_BUFFER_PIXELS : ulImgSize;
+        uint8_t *pubDst = pubLineBuffer[ubBuffer];
+
+        for(uint32_t ulI = 0; ulI < ulCount; ulI++)
+            pubDst = ili9488_pack_pixel(pubDst, *pPixels++);
+
+        ili9488_write_pixels(pubLineBuffer[ubBuffer], ulCount, NULL); // Waits for the previous chunk only
+
+        ulImgSize -= ulCount;
+        ubBuffer ^= 1;
+    }
+}
+static void tft_draw_image_qoi565(const image_t *pImage)
+{
+    tft_image_stream_t xStream;
+    uint32_t ulImgSize = pImage->usWidth * pImage->usHeight;
+    uint8_t ubBuffer = 0;
+
+    xStream.pubSrc = (const uint8_t *)pImage->pData;
+    xStream.pubEnd = xStream.pubSrc + pImage->ulSize;
+    xStream.ulRun = 0;
+    xStream.xPrev = 0x0000;
+
+    memset(xStream.pIndex, 0, sizeof(xStream.pIndex));
+
+    while(ulImgSize)
+    {
+        if(xStream.ulRun >= TFT_IMAGE_FILL_MIN_RUN) // Flat area, let the looping pattern descriptor do it
+        {
+            uint32_t ulCount = MIN(xStream.ulRun, ulImgSize);
+
+            ili9488_fill_pixels(xStream.xPrev, ulCount, NULL);
+
+            xStream.ulRun -= ulCount;
+            ulImgSize -= ulCount;
+
+            continue;
+        }
+
+        // Decoded while the previous line is being streamed
+        uint32_t ulCount = tft_image_decode(&xStream, pubLineBuffer[ubBuffer], MIN(ulImgSize, TFT_LINE_BUFFER_PIXELS));
+
+        if(!ulCount && xStream.ulRun < TFT_IMAGE_FILL_MIN_RUN)
+            break; // Truncated stream
+
+        if(!ulCount)
+            continue;
+
+        ili9488_write_pixels(pubLineBuffer[ubBuffer], ulCount, NULL);
+
+        ulImgSize -= ulCount;
+        ubBuffer ^= 1;
+    }
+}
+void tft_draw_image(const image_t *pImage, uint16_t usX, uint16_t usY)
+{
+    if(!pImage)
+        return;
+
+    if(!pImage->pData)
+        return;
+
+    if(pImage->ubEncoding == IMAGE_ENCODING_RAW)
+    {
+        if(tft_frame_record(TFT_FRAME_CMD_IMAGE, usX, usY, usX + pImage->usWidth - 1, usY + pImage->usHeight - 1, 0, 0, pImage->pData))
+            return;
+    }
+    else if(ubFrameDepth)
+    {
+        tft_frame_flush(); // Compressed streams can't be replayed per tile, draw what was recorded so far to keep the order
+    }
+
+    if(!ili9488_set_window(usX, usY, usX + pImage->usWidth - 1, usY + pImage->usHeight - 1))
+        return;
+
+    switch(pImage->ubEncoding)
+    {
+        case IMAGE_ENCODING_RAW:
+            tft_draw_image_raw(pImage);
+        break;
+        case IMAGE_ENCODING_QOI565:
+            tft_draw_image_qoi565(pImage);
+        break;
+    }
+
+    ili9488_dma_wait();
+}
+void tft_draw_bitmap(const uint8_t *pubBitmap, uint16_t usX, uint16_t usY, uint16_t usW, uint16_t usH, rgb565_t xColor, rgb565_t xBackColor)
+{
+    if(!pubBitmap)
+        return;
+
+    if(tft_frame_record(TFT_FRAME_CMD_BITMAP, usX, usY, usX + usW - 1, usY + usH - 1, xColor, xBackColor, pubBitmap))
+        return;
+
+    if(!ili9488_set_window(usX, usY, usX + usW - 1, usY + usH - 1))
+        return;
+
+    uint32_t ulBit = 0;
+    uint32_t ulSize = usW * usH;
+    uint8_t ubBuffer = 0;
+
+    while(ulBit < ulSize)
+    {
+        uint32_t ulCount = (ulSize - ulBit) > TFT_LINE_BUFFER_PIXELS ? TFT_LINE_BUFFER_PIXELS : (ulSize - ulBit);
+        uint8_t *pubDst = pubLineBuffer[ubBuffer];
+
+        for(uint32_t ulI = 0; ulI < ulCount; ulI++, ulBit++)
+            pubDst = ili9488_pack_pixel(pubDst, (pubBitmap[ulBit >> 3] & (0x80 >> (ulBit & 7))) ? xColor : xBackColor);
+
+        ili9488_write_pixels(pubLineBuffer[ubBuffer], ulCount, NULL);
+
+        ubBuffer ^= 1;
+    }
+
+    ili9488_dma_wait();
+}
+
+static inline uint8_t tft_glyph_cache_hash(const font_t *pFont, uint8_t ubGlyph, rgb565_t xColor, rgb565_t xBackColor)
+{
+    uint32_t ulHash = ((uint32_t)pFont >> 2) ^ ((uint32_t)ubGlyph * 0x9E37) ^ ((uint32_t)xColor * 0x3B) ^ ((uint32_t)xBackColor << 5);
+
+    return (ulHash ^ (ulHash >> 8) ^ (ulHash >> 16)) & (TFT_GLYPH_CACHE_BUCKETS - 1);
+}
+static void tft_glyph_cache_unlink(tft_glyph_cache_entry_t *pEntry)
+{
+    if(pEntry->pPrev)
+        pEntry->pPrev->pNext = pEntry->pNext;
+    else
+        pGlyphCacheHead = pEntry->pNext;
+
+    if(pEntry->pNext)
+        pEntry->pNext->pPrev = pEntry->pPrev;
+    else
+        pGlyphCacheTail = pEntry->pPrev;
+
+    pEntry->pPrev = NULL;
+    pEntry->pNext = NULL;
+}
+static void tft_glyph_cache_push_front(tft_glyph_cache_entry_t *pEntry)
+{
+    pEntry->pPrev = NULL;
+    pEntry->pNext = pGlyphCacheHead;
+
+    if(pGlyphCacheHead)
+        pGlyphCacheHead->pPrev = pEntry;
+    else
+        pGlyphCacheTail = pEntry;
+
+    pGlyphCacheHead = pEntry;
+}
+static void tft_glyph_cache_evict(tft_glyph_cache_entry_t *pEntry)
+{
+    tft_glyph_cache_entry_t **ppLink = &pGlyphCacheBuckets[tft_glyph_cache_hash(pEntry->pFont, pEntry->ubGlyph, pEntry->xColor, pEntry->xBackColor)];
+
+    while(*ppLink && *ppLink != pEntry)
+        ppLink = &(*ppLink)->pHashNext;
+
+    if(*ppLink)
+        *ppLink = pEntry->pHashNext;
+
+    tft_glyph_cache_unlink(pEntry);
+
+    xGlyphCacheStats.ulUsed -= pEntry->ulSize;
+    xGlyphCacheStats.usEntries--;
+
+    free(pEntry);
+}
+static tft_glyph_cache_entry_t* tft_glyph_cache_get(const font_t *pFont, uint8_t ubGlyph, rgb565_t xColor, rgb565_t xBackColor)
 {
-    int16_t sF = 1 - usR;
-    int16_t sDdFx = 1;
-    int16_t sDdFy = -2 * usR;
-    int16_t sXh = 0;
-    int16_t sYh = usR;
+    uint8_t ubBucket = tft_glyph_cache_hash(pFont, ubGlyph, xColor, xBackColor);
 
-    if(ubFill)
-    {
-        for(int16_t usI = usY - usR; usI <= usY + usR; usI++)
-            ili9488_set_pixel_color(usX, usI, xColor);
-    }
-    else
+    for(tft_glyph_cache_entry_t *pEntry = pGlyphCacheBuckets[ubBucket]; pEntry; pEntry = pEntry->pHashNext)
     {
-        ili9488_set_pixel_color(usX, usY + usR, xColor);
-        ili9488_set_pixel_color(usX, usY - usR, xColor);
-        ili9488_set_pixel_color(usX + usR, usY, xColor);
-        ili9488_set_pixel_color(usX - usR, usY, xColor);
-    }
+        if(pEntry->pFont != pFont || pEntry->ubGlyph != ubGlyph || pEntry->xColor != xColor || pEntry->xBackColor != xBackColor)
+            continue;
 
-    while(sXh < sYh)
-    {
-        if(sF >= 0)
+        if(pEntry != pGlyphCacheHead)
         {
-            sYh--;
-            sDdFy += 2;
-            sF += sDdFy;
+            tft_glyph_cache_unlink(pEntry);
+            tft_glyph_cache_push_front(pEntry);
         }
 
-        sXh++;
-        sDdFx += 2;
-        sF += sDdFx;
+        xGlyphCacheStats.ulHits++;
 
-        if(ubFill)
-        {
-            for(int16_t usI = usY - sYh; usI <= usY + sYh; usI++)
-            {
-                ili9488_set_pixel_color(usX + sXh, usI, xColor);
-                ili9488_set_pixel_color(usX - sXh, usI, xColor);
-            }
+        return pEntry;
+    }
 
-            for(int16_t usI = usY - sXh; usI <= usY + sXh; usI++)
-            {
-                ili9488_set_pixel_color(usX + sYh, usI, xColor);
-                ili9488_set_pixel_color(usX - sYh, usI, xColor);
-            }
-        }
-        else
+    xGlyphCacheStats.ulMisses++;
+
+    const glyph_t *pGlyph = &pFont->pGlyph[ubGlyph];
+    uint32_t ulPixels = pGlyph->ubWidth * pGlyph->ubHeight;
+    uint32_t ulSize = sizeof(tft_glyph_cache_entry_t) + ulPixels * ILI9488_PIXEL_SIZE;
+
+    if(ulSize > TFT_GLYPH_CACHE_SIZE)
+        return NULL;
+
+    if(xGlyphCacheStats.ulUsed + ulSize > TFT_GLYPH_CACHE_SIZE)
+    {
+        if(usFrameGlyphCmds)
+            return NULL; // Recorded glyphs point into the cache, the caller records this one from the font bitmap instead of flushing the frame early
+
+        ili9488_dma_wait(); // The least recently used glyph might be the one being streamed
+
+        while(pGlyphCacheTail && xGlyphCacheStats.ulUsed + ulSize > TFT_GLYPH_CACHE_SIZE)
         {
-            ili9488_set_pixel_color(usX + sXh, usY + sYh, xColor);
-            ili9488_set_pixel_color(usX - sXh, usY + sYh, xColor);
-            ili9488_set_pixel_color(usX + sXh, usY - sYh, xColor);
-            ili9488_set_pixel_color(usX - sXh, usY - sYh, xColor);
-            ili9488_set_pixel_color(usX + sYh, usY + sXh, xColor);
-            ili9488_set_pixel_color(usX - sYh, usY + sXh, xColor);
-            ili9488_set_pixel_color(usX + sYh, usY - sXh, xColor);
-            ili9488_set_pixel_color(usX - sYh, usY - sXh, xColor);
+            tft_glyph_cache_evict(pGlyphCacheTail);
+
+            xGlyphCacheStats.ulEvictions++;
         }
     }
-}
 
-void tft_draw_image(const image_t *pImage, uint16_t usX, uint16_t usY)
-{
-    if(!pImage)
-        return;
+    tft_glyph_cache_entry_t *pEntry = (tft_glyph_cache_entry_t *)malloc(ulSize);
 
-    if(!pImage->pPixels)
-        return;
+    if(!pEntry)
+        return NULL;
 
-    if(!ili9488_set_window(usX, usY, usX + pImage->usWidth - 1, usY + pImage->usHeight - 1))
-        return;
+    pEntry->pFont = pFont;
+    pEntry->ubGlyph = ubGlyph;
+    pEntry->xColor = xColor;
+    pEntry->xBackColor = xBackColor;
+    pEntry->ulSize = ulSize;
+    pEntry->pubPixels = (uint8_t *)(pEntry + 1);
 
-    rgb565_t *pPixels = pImage->pPixels;
-    uint32_t ulImgSize = pImage->usWidth * pImage->usHeight;
+    const uint8_t *pubBitmap = pFont->pubBitmap + pGlyph->usBitmapOffset;
+    uint8_t *pubDst = pEntry->pubPixels;
+
+    for(uint32_t ulBit = 0; ulBit < ulPixels; ulBit++)
+        pubDst = ili9488_pack_pixel(pubDst, (pubBitmap[ulBit >> 3] & (0x80 >> (ulBit & 7))) ? xColor : xBackColor);
+
+    pEntry->pHashNext = pGlyphCacheBuckets[ubBucket];
+    pGlyphCacheBuckets[ubBucket] = pEntry;
+
+    tft_glyph_cache_push_front(pEntry);
+
+    xGlyphCacheStats.ulUsed += ulSize;
+    xGlyphCacheStats.usEntries++;
 
-    while(ulImgSize--)
-        ili9488_send_pixel_data(*pPixels++);
+    return pEntry;
 }
-void tft_draw_bitmap(const uint8_t *pubBitmap, uint16_t usX, uint16_t usY, uint16_t usW, uint16_t usH, rgb565_t xColor, rgb565_t xBackColor)
+void tft_glyph_cache_clear()
 {
-    if(!pubBitmap)
-        return;
+    if(usFrameGlyphCmds)
+        tft_frame_flush();
 
-    if(!ili9488_set_window(usX, usY, usX + usW - 1, usY + usH - 1))
+    ili9488_dma_wait();
+
+    while(pGlyphCacheTail)
+        tft_glyph_cache_evict(pGlyphCacheTail);
+}
+void tft_glyph_cache_get_stats(tft_glyph_cache_stats_t *pStats)
+{
+    if(!pStats)
         return;
 
-    for(uint32_t ulI = 0; ulI < usW * usH; ulI++)
-    {
-        if(*(pubBitmap + (ulI / 8)) & (0x80 >> (ulI % 8)))
-            ili9488_send_pixel_data(xColor);
-        else
-            ili9488_send_pixel_data(xBackColor);
-    }
+    *pStats = xGlyphCacheStats;
 }
 
 uint16_t tft_get_text_height(const font_t *pFont, uint16_t usNumLines)
 {
     return (usNumLines * pFont->ubYAdvance) + pFont->ubLineOffset;
 }
-static uint8_t tft_search_char(char *ubStr, uint8_t ubChar)
-{
-    uint8_t ubCnt = 0;
-
-    while(*ubStr++)
-    {
-        if(*ubStr == ubChar)
-            ubCnt++;
-    }
-
-    return ubCnt;
-}
-static uint16_t tft_get_str_pix_len(const font_t *pFont, const uint8_t *pubStr)
+static uint16_t tft_get_str_pix_len(const font_t *pFont, const char *pszStr)
 {
     uint16_t usLength = 0;
 
-    while(*pubStr)
+    while(*pszStr)
     {
-        usLength += pFont->pGlyph[*pubStr - pFont->cFirstChar].ubXAdvance;
-        pubStr++;
+        usLength += pFont->pGlyph[(uint8_t)*pszStr - pFont->cFirstChar].ubXAdvance;
+        pszStr++;
     }
 
     return usLength;
@@ -326,6 +1383,14 @@ static uint16_t tft_get_str_pix_len(const font_t *pFont, const uint8_t *pubStr)
 
 tft_button_t* tft_button_create(uint8_t ubID, uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHeight)
 {
+    uint8_t ubSlot = 0;
+
+    while(ubSlot < TFT_BUTTON_MAX && pButtonSlots[ubSlot])
+        ubSlot++;
+
+    if(ubSlot == TFT_BUTTON_MAX)
+        return NULL;
+
     tft_button_t *pNewButton = (tft_button_t *)malloc(sizeof(tft_button_t));
 
     if(!pNewButton)
@@ -334,19 +1399,15 @@ tft_button_t* tft_button_create(uint8_t ubID, uint16_t usX, uint16_t usY, uint16
     memset(pNewButton, 0, sizeof(tft_button_t));
 
     pNewButton->ubID = ubID;
+    pNewButton->ubSlot = ubSlot;
     pNewButton->usOriginX = usX;
     pNewButton->usOriginY = usY;
     pNewButton->usWidth = usWidth;
     pNewButton->usHeight = usHeight;
 
-    // Insert at the head of the list
-    pNewButton->pNext = pButtonList;
-    pNewButton->pPrev = NULL;
+    pButtonSlots[ubSlot] = pNewButton;
 
-    if(pButtonList)
-        pButtonList->pPrev = pNewButton;
-
-    pButtonList = pNewButton;
+    tft_button_index(pNewButton, 1);
 
     return pNewButton;
 }
@@ -355,36 +1416,44 @@ void tft_button_delete(tft_button_t *pButton)
     if(!pButton)
         return;
 
-    if(pButtonList == pButton)
-        pButtonList = pButton->pNext;
+    tft_button_index(pButton, 0);
 
-    if(pButton->pPrev)
-        pButton->pPrev->pNext = pButton->pNext;
+    pButtonSlots[pButton->ubSlot] = NULL;
 
-    if(pButton->pNext)
-        pButton->pNext->pPrev = pButton->pPrev;
+    if(pTouchTarget == pButton)
+        pTouchTarget = NULL;
 
     free(pButton);
 }
 void tft_button_clear()
 {
-    while(pButtonList)
+    for(uint8_t ubSlot = 0; ubSlot < TFT_BUTTON_MAX; ubSlot++)
     {
-        tft_button_t *pButton = pButtonList;
-
-        pButtonList = pButton->pNext;
+        free(pButtonSlots[ubSlot]);
 
-        free(pButton);
+        pButtonSlots[ubSlot] = NULL;
     }
+
+    memset(pulTouchGrid, 0, sizeof(pulTouchGrid));
+
+    pTouchTarget = NULL;
+}
+void tft_button_set_callback(tft_button_t *pButton, tft_gesture_callback_fn_t pfFunc)
+{
+    pButton->pfCallback = pfFunc;
 }
 void tft_set_button_callback(tft_button_callback_fn_t pfFunc)
 {
     pfButtonCallback = pfFunc;
 }
-void tft_button_draw(tft_button_t *pButton, const uint8_t *pubStr, const font_t *pFont, rgb565_t xBackColor, rgb565_t xTextColor)
+void tft_set_gesture_callback(tft_gesture_callback_fn_t pfFunc)
+{
+    pfGestureCallback = pfFunc;
+}
+void tft_button_draw(tft_button_t *pButton, const char *pszStr, const font_t *pFont, rgb565_t xBackColor, rgb565_t xTextColor)
 {
     tft_draw_rectangle(pButton->usOriginX, pButton->usOriginY, pButton->usOriginX + pButton->usWidth - 1, pButton->usOriginY + pButton->usHeight - 1, xBackColor, 1);
-    tft_printf(pFont, pButton->usOriginX + ((pButton->usWidth - tft_get_str_pix_len(pFont, pubStr)) / 2) - 1, pButton->usOriginY + ((pButton->usHeight - pFont->ubYAdvance - pFont->ubLineOffset) / 2) - 1, xTextColor, xBackColor, pubStr);
+    tft_printf(pFont, pButton->usOriginX + ((pButton->usWidth - tft_get_str_pix_len(pFont, pszStr)) / 2) - 1, pButton->usOriginY + ((pButton->usHeight - pFont->ubYAdvance - pFont->ubLineOffset) / 2) - 1, xTextColor, xBackColor, "%s", pszStr);
 }
 
 tft_graph_t* tft_graph_create(uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHeight, float fXScaleMin, float fXScaleMax, float fXScaleInc, float fYScaleMin, float fYScaleMax, float fYScaleInc, uint8_t ubDrawLabels, const char *pszXScaleFmt, const char *pszYScaleFmt, const char *pszTitle, const char *pszXLabel, const char *pszYLabel, const font_t *pFont, rgb565_t xGridColor, rgb565_t xAxisColor, rgb565_t xDataLineColor, rgb565_t xTextColor, rgb565_t xBackColor)
@@ -603,16 +1672,232 @@ void tft_graph_draw_data(tft_graph_t *pGraph, float *pfXData, float *pfYData, ui
     }
 }
 
+static inline int32_t tft_chart_to_fixed(float fValue)
+{
+    if(fValue >= 32767.f)
+        return INT32_MAX;
+
+    if(fValue <= -32768.f)
+        return INT32_MIN;
+
+    return (int32_t)(fValue * 65536.f);
+}
+static inline int16_t tft_chart_sample_y(tft_chart_t *pChart, tft_chart_series_t *pSeries, int32_t lSample)
+{
+    int64_t llRow = (((int64_t)lSample - pSeries->lYMin) * pSeries->lYScale) >> 32;
+
+    if(llRow < 0)
+        llRow = 0;
+
+    if(llRow > pChart->usHeight - 1)
+        llRow = pChart->usHeight - 1;
+
+    return pChart->usY + pChart->usHeight - 1 - (int16_t)llRow;
+}
+// The newest column sits at the right edge, older ones follow it to the left
+static inline uint16_t tft_chart_column_x(tft_chart_t *pChart, uint16_t usColumn)
+{
+    uint16_t usNewest = (pChart->usHead + pChart->usCapacity - 1) % pChart->usCapacity;
+
+    return (usColumn + pChart->usWidth - usNewest / pChart->usSamplesPerColumn - 1) % pChart->usWidth;
+}
+static void tft_chart_draw_column(tft_chart_t *pChart, uint16_t usColumn)
+{
+    if(!pChart->usCount)
+        return;
+
+    uint16_t usNewest = (pChart->usHead + pChart->usCapacity - 1) % pChart->usCapacity;
+    uint16_t usFirst = usColumn * pChart->usSamplesPerColumn;
+    uint16_t usFirstAge = (usNewest + pChart->usCapacity - usFirst) % pChart->usCapacity;
+
+    if(usFirstAge >= pChart->usCount)
+        return;
+
+    // Slots past the newest one in the current column still hold the oldest samples, those already scrolled out
+    uint16_t usSamples = MIN(pChart->usSamplesPerColumn, usFirstAge + 1);
+    uint8_t ubConnect = usFirstAge + 1 < pChart->usCount;
+    uint16_t usPrev = (usFirst + pChart->usCapacity - 1) % pChart->usCapacity;
+
+    for(uint8_t ubSeries = 0; ubSeries < pChart->ubNumSeries; ubSeries++)
+    {
+        tft_chart_series_t *pSeries = &pChart->pSeries[ubSeries];
+        int32_t *plSample = pChart->plSamples + usFirst * pChart->ubNumSeries + ubSeries;
+        int32_t lMin = *plSample;
+        int32_t lMax = *plSample;
+
+        for(uint16_t usSample = 1; usSample < usSamples; usSample++)
+        {
+            plSample += pChart->ubNumSeries;
+
+            lMin = MIN(lMin, *plSample);
+            lMax = MAX(lMax, *plSample);
+        }
+
+        if(ubConnect)
+        {
+            int32_t lPrev = pChart->plSamples[usPrev * pChart->ubNumSeries + ubSeries];
+
+            lMin = MIN(lMin, lPrev);
+            lMax = MAX(lMax, lPrev);
+        }
+
+        tft_draw_span_v(pChart->usX + tft_chart_column_x(pChart, usColumn), tft_chart_sample_y(pChart, pSeries, lMax), tft_chart_sample_y(pChart, pSeries, lMin), pSeries->xColor);
+    }
+}
+tft_chart_t* tft_chart_create(uint16_t usX, uint16_t usY, uint16_t usWidth, uint16_t usHeight, uint16_t usSamplesPerColumn, uint8_t ubNumSeries, uint16_t usGridX, uint16_t usGridY, rgb565_t xGridColor, rgb565_t xBackColor)
+{
+    if(usWidth < 2 || usHeight < 2 || !usSamplesPerColumn || !ubNumSeries)
+        return NULL;
+
+    if((uint32_t)usWidth * usSamplesPerColumn > 0xFFFF)
+        return NULL;
+
+    tft_chart_t *pNewChart = (tft_chart_t *)malloc(sizeof(tft_chart_t));
+
+    if(!pNewChart)
+        return NULL;
+
+    pNewChart->usX = usX;
+    pNewChart->usY = usY;
+    pNewChart->usWidth = usWidth;
+    pNewChart->usHeight = usHeight;
+    pNewChart->usSamplesPerColumn = usSamplesPerColumn;
+    pNewChart->usGridX = usGridX;
+    pNewChart->usGridY = usGridY;
+    pNewChart->usCapacity = usWidth * usSamplesPerColumn;
+    pNewChart->usHead = 0;
+    pNewChart->usCount = 0;
+    pNewChart->ubNumSeries = ubNumSeries;
+    pNewChart->xGridColor = xGridColor;
+    pNewChart->xBackColor = xBackColor;
+
+    pNewChart->pSeries = (tft_chart_series_t *)malloc(ubNumSeries * sizeof(tft_chart_series_t));
+
+    if(!pNewChart->pSeries)
+    {
+        free(pNewChart);
+
+        return NULL;
+    }
+
+    pNewChart->plSamples = (int32_t *)malloc((uint32_t)pNewChart->usCapacity * ubNumSeries * sizeof(int32_t));
+
+    if(!pNewChart->plSamples)
+    {
+        free(pNewChart->pSeries);
+        free(pNewChart);
+
+        return NULL;
+    }
+
+    for(uint8_t ubSeries = 0; ubSeries < ubNumSeries; ubSeries++)
+        tft_chart_set_series(pNewChart, ubSeries, 0.f, 1.f, RGB565_WHITE);
+
+    return pNewChart;
+}
+void tft_chart_delete(tft_chart_t *pChart)
+{
+    free(pChart->plSamples);
+    free(pChart->pSeries);
+
+    free(pChart);
+}
+uint8_t tft_chart_set_series(tft_chart_t *pChart, uint8_t ubSeries, float fYMin, float fYMax, rgb565_t xColor)
+{
+    if(ubSeries >= pChart->ubNumSeries)
+        return 0;
+
+    int32_t lYMin = tft_chart_to_fixed(fYMin);
+    int32_t lYMax = tft_chart_to_fixed(fYMax);
+
+    if(lYMax <= lYMin)
+        return 0;
+
+    int64_t llScale = ((int64_t)(pChart->usHeight - 1) << 32) / ((int64_t)lYMax - lYMin);
+
+    if(llScale > INT32_MAX)
+        return 0; // Range narrower than the fixed point resolution allows for this height
+
+    tft_chart_series_t *pSeries = &pChart->pSeries[ubSeries];
+
+    pSeries->lYMin = lYMin;
+    pSeries->lYScale = llScale;
+    pSeries->xColor = xColor;
+
+    return 1;
+}
+void tft_chart_draw(tft_chart_t *pChart)
+{
+    int16_t sBottom = pChart->usY + pChart->usHeight - 1;
+    int16_t sRight = pChart->usX + pChart->usWidth - 1;
+
+    tft_draw_block(pChart->usX, pChart->usY, sRight, sBottom, pChart->xBackColor);
+
+    if(pChart->usGridY)
+        for(uint16_t usRow = 0; usRow < pChart->usHeight; usRow += pChart->usGridY)
+            tft_draw_span_h(pChart->usX, sRight, sBottom - usRow, pChart->xGridColor);
+
+    if(pChart->usGridX)
+        for(uint16_t usColumn = 0; usColumn < pChart->usWidth; usColumn += pChart->usGridX)
+            tft_draw_span_v(pChart->usX + usColumn, pChart->usY, sBottom, pChart->xGridColor);
+
+    for(uint16_t usColumn = 0; usColumn < pChart->usWidth; usColumn++)
+        tft_chart_draw_column(pChart, usColumn);
+}
+void tft_chart_append(tft_chart_t *pChart, const float *pfValues, uint8_t ubDraw)
+{
+    int32_t *plSlot = pChart->plSamples + pChart->usHead * pChart->ubNumSeries;
+
+    for(uint8_t ubSeries = 0; ubSeries < pChart->ubNumSeries; ubSeries++)
+        plSlot[ubSeries] = tft_chart_to_fixed(pfValues[ubSeries]);
+
+    uint16_t usColumn = pChart->usHead / pChart->usSamplesPerColumn;
+    uint8_t ubNewColumn = !(pChart->usHead % pChart->usSamplesPerColumn);
+
+    pChart->usHead = (pChart->usHead + 1) % pChart->usCapacity;
+
+    if(pChart->usCount < pChart->usCapacity)
+        pChart->usCount++;
+
+    if(!ubDraw)
+        return;
+
+    // A new column moves every other one to the left, otherwise only the newest column's spans grow
+    if(ubNewColumn)
+        tft_chart_draw(pChart);
+    else
+        tft_chart_draw_column(pChart, usColumn);
+}
+
 uint8_t tft_draw_char(char cChar, const font_t *pFont, uint16_t usX, uint16_t usY, rgb565_t xColor, rgb565_t xBackColor)
 {
     if((cChar < pFont->cFirstChar) || (cChar > pFont->cLastChar))
         cChar = '?';
 
-    cChar -= pFont->cFirstChar;
+    uint8_t ubGlyph = cChar - pFont->cFirstChar;
+    const glyph_t *pGlyph = &pFont->pGlyph[ubGlyph];
+    uint16_t usGlyphX = usX + pGlyph->bXOffset;
+    uint16_t usGlyphY = usY + pFont->ubYAdvance + pGlyph->bYOffset - 1;
+
+    if(!pGlyph->ubWidth || !pGlyph->ubHeight)
+        return pGlyph->ubXAdvance;
 
-    tft_draw_bitmap(pFont->pubBitmap + pFont->pGlyph[cChar].usBitmapOffset, usX + pFont->pGlyph[cChar].bXOffset, usY + pFont->ubYAdvance + pFont->pGlyph[cChar].bYOffset - 1, pFont->pGlyph[cChar].ubWidth, pFont->pGlyph[cChar].ubHeight, xColor, xBackColor);
+    tft_glyph_cache_entry_t *pEntry = tft_glyph_cache_get(pFont, ubGlyph, xColor, xBackColor);
 
-    return pFont->pGlyph[cChar].ubXAdvance;
+    if(pEntry && tft_frame_record(TFT_FRAME_CMD_IMAGE666, (int16_t)usGlyphX, (int16_t)usGlyphY, (int16_t)usGlyphX + pGlyph->ubWidth - 1, (int16_t)usGlyphY + pGlyph->ubHeight - 1, xColor, xBackColor, pEntry->pubPixels))
+        return pGlyph->ubXAdvance;
+
+    if(!pEntry) // Does not fit the cache, expand it on the fly
+    {
+        tft_draw_bitmap(pFont->pubBitmap + pGlyph->usBitmapOffset, usGlyphX, usGlyphY, pGlyph->ubWidth, pGlyph->ubHeight, xColor, xBackColor);
+
+        return pGlyph->ubXAdvance;
+    }
+
+    if(ili9488_set_window(usGlyphX, usGlyphY, usGlyphX + pGlyph->ubWidth - 1, usGlyphY + pGlyph->ubHeight - 1))
+        ili9488_write_pixels(pEntry->pubPixels, pGlyph->ubWidth * pGlyph->ubHeight, NULL);
+
+    return pGlyph->ubXAdvance;
 }
 void tft_draw_string(char *pszStr, const font_t *pFont, uint16_t usX, uint16_t usY, rgb565_t xColor, rgb565_t xBackColor)
 {
@@ -809,13 +2094,53 @@ void tft_textbox_printf(tft_textbox_t *pTextbox, const char* pszFmt, ...)
     va_end(args);
 }
 
+static inline char* tft_terminal_get_line(tft_terminal_t *pTerminal, uint16_t usLine)
+{
+    return pTerminal->pszBuf + ((pTerminal->usHead + usLine) % pTerminal->pTextbox->usNumLines) * pTerminal->usLineSize;
+}
+static inline uint8_t tft_terminal_hw_scroll(tft_terminal_t *pTerminal)
+{
+    return g_ubILI9488Rotation == ILI9488_ROTATION_VERTICAL; // Scrolling runs along the panel native rows
+}
+static void tft_terminal_new_line(tft_terminal_t *pTerminal)
+{
+    pTerminal->usHead = (pTerminal->usHead + 1) % pTerminal->pTextbox->usNumLines; // Old top line slot becomes the new bottom one
+
+    *tft_terminal_get_line(pTerminal, pTerminal->pTextbox->usNumLines - 1) = '\0';
+
+    pTerminal->usLineLen = 0;
+    pTerminal->usLinePixLen = 0;
+
+    if(pTerminal->usScrolled < pTerminal->pTextbox->usNumLines)
+        pTerminal->usScrolled++;
+}
+static void tft_terminal_draw_line(tft_terminal_t *pTerminal, uint16_t usLine)
+{
+    tft_textbox_t *pTextbox = pTerminal->pTextbox;
+    const font_t *pFont = pTextbox->pFont;
+    uint16_t usBand = (usLine + pTerminal->usScrollOffset) % pTextbox->usNumLines;
+    uint16_t usY = pTextbox->usY + pFont->ubLineOffset + usBand * pFont->ubYAdvance; // Frame memory row, not affected by scrolling
+    uint16_t usX = pTextbox->usX;
+    char *pszLine = tft_terminal_get_line(pTerminal, usLine);
+
+    tft_draw_rectangle(pTextbox->usX, usY, pTextbox->usX + pTextbox->usLen - 1, usY + pFont->ubYAdvance - 1, pTextbox->xBackColor, 1);
+
+    while(*pszLine)
+        usX += tft_draw_char(*pszLine++, pFont, usX, usY - pFont->ubLineOffset, pTextbox->xColor, pTextbox->xBackColor);
+}
+
 tft_terminal_t* tft_terminal_create(uint16_t usX, uint16_t usY, uint16_t usNumLines, uint16_t usLenght, const font_t *pFont, rgb565_t xColor, rgb565_t xBackColor)
 {
+    if(!usNumLines)
+        return NULL;
+
     tft_terminal_t *pNewTerminal = (tft_terminal_t *)malloc(sizeof(tft_terminal_t));
 
     if(!pNewTerminal)
         return NULL;
 
+    memset(pNewTerminal, 0, sizeof(tft_terminal_t));
+
     pNewTerminal->pTextbox = tft_textbox_create(usX, usY, usNumLines, usLenght, 1, 1, pFont, xColor, xBackColor);
 
     if(!pNewTerminal->pTextbox)
@@ -825,9 +2150,18 @@ tft_terminal_t* tft_terminal_create(uint16_t usX, uint16_t usY, uint16_t usNumLi
         return NULL;
     }
 
-    pNewTerminal->ppszBuf = (char **)malloc(usNumLines * sizeof(char *));
+    uint8_t ubMinAdvance = 0xFF;
+
+    for(uint16_t usI = 0; usI <= (uint8_t)(pFont->cLastChar - pFont->cFirstChar); usI++)
+    {
+        if(pFont->pGlyph[usI].ubXAdvance && pFont->pGlyph[usI].ubXAdvance < ubMinAdvance)
+            ubMinAdvance = pFont->pGlyph[usI].ubXAdvance;
+    }
+
+    pNewTerminal->usLineSize = usLenght / ubMinAdvance + 1; // Enough for a full line of the narrowest glyph
+    pNewTerminal->pszBuf = (char *)malloc(usNumLines * pNewTerminal->usLineSize);
 
-    if(!pNewTerminal->ppszBuf)
+    if(!pNewTerminal->pszBuf)
     {
         free(pNewTerminal->pTextbox);
         free(pNewTerminal);
@@ -835,166 +2169,140 @@ tft_terminal_t* tft_terminal_create(uint16_t usX, uint16_t usY, uint16_t usNumLi
         return NULL;
     }
 
-    memset(pNewTerminal->ppszBuf, 0, usNumLines * sizeof(char *));
+    memset(pNewTerminal->pszBuf, 0, usNumLines * pNewTerminal->usLineSize);
 
-    pNewTerminal->ubUpdatePending = 0;
+    pNewTerminal->ubRedrawPending = 1;
 
     return pNewTerminal;
 }
 void tft_terminal_delete(tft_terminal_t *pTerminal)
 {
-    for(uint16_t usI = 0; usI < pTerminal->pTextbox->usNumLines; usI++)
-        free(pTerminal->ppszBuf[usI]);
+    if(!pTerminal)
+        return;
 
-    free(pTerminal->ppszBuf);
+    free(pTerminal->pszBuf);
     free(pTerminal->pTextbox);
     free(pTerminal);
 }
-static void tft_terminal_scroll(tft_terminal_t *pTerminal, uint16_t usNumLines)
-{
-    while(usNumLines--)
-    {
-        free(pTerminal->ppszBuf[0]);
-
-        for(uint8_t ubI = 0; ubI < pTerminal->pTextbox->usNumLines - 1; ubI++)
-            pTerminal->ppszBuf[ubI] = pTerminal->ppszBuf[ubI + 1];
-
-        pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1] = NULL;
-    }
-}
 void tft_terminal_draw_string(tft_terminal_t *pTerminal, char *pszStr)
 {
-    uint8_t ubMaxStrLen = strlen(pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1]) + strlen(pszStr);
-
-    char *pszTempStr = (char *)malloc(ubMaxStrLen + 1);
-
-    if(!pszTempStr)
-        return;
-
-    memset(pszTempStr, 0, ubMaxStrLen + 1);
-
-    uint8_t ubStrLen = strlen(pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1]);
-
-    free(pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1]);
+    const font_t *pFont = pTerminal->pTextbox->pFont;
 
     while(*pszStr)
     {
-        if(*pszStr == '\n')
-        {
-            pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1] = (char *)malloc(ubStrLen + 1);
-
-            if(!pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1])
-            {
-                free(pszTempStr);
-
-                return;
-            }
-
-            strcpy(pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1], pszTempStr);
+        char cChar = *pszStr++;
 
-            tft_terminal_scroll(pTerminal, 1);
-
-            memset(pszTempStr, 0, ubMaxStrLen + 1);
+        if(cChar == '\n')
+        {
+            tft_terminal_new_line(pTerminal);
 
-            ubStrLen = 0;
+            continue;
         }
-        else if(*pszStr == '\r')
+
+        if(cChar == '\r')
         {
-            memset(pszTempStr, 0, ubMaxStrLen + 1);
+            *tft_terminal_get_line(pTerminal, pTerminal->pTextbox->usNumLines - 1) = '\0';
 
-            ubStrLen = 0;
+            pTerminal->usLineLen = 0;
+            pTerminal->usLinePixLen = 0;
+
+            continue;
         }
-        else
-        {
-            if(tft_get_str_pix_len(pTerminal->pTextbox->pFont, pszTempStr) + pTerminal->pTextbox->pFont->pGlyph[*pszStr - pTerminal->pTextbox->pFont->cFirstChar].ubXAdvance >= pTerminal->pTextbox->usLen + pTerminal->pTextbox->usX - 1)
-            {
-                pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1] = (char *)malloc(ubStrLen + 1);
 
-                if(!pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1])
-                {
-                    free(pszTempStr);
+        if((cChar < pFont->cFirstChar) || (cChar > pFont->cLastChar))
+            cChar = '?';
 
-                    return;
-                }
+        uint8_t ubAdvance = pFont->pGlyph[cChar - pFont->cFirstChar].ubXAdvance;
 
-                strcpy(pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1], pszTempStr);
+        if(pTerminal->usLinePixLen + ubAdvance > pTerminal->pTextbox->usLen || pTerminal->usLineLen >= pTerminal->usLineSize - 1)
+            tft_terminal_new_line(pTerminal);
 
-                tft_terminal_scroll(pTerminal, 1);
+        char *pszLine = tft_terminal_get_line(pTerminal, pTerminal->pTextbox->usNumLines - 1);
 
-                memset(pszTempStr, 0, ubMaxStrLen + 1);
+        pszLine[pTerminal->usLineLen++] = cChar;
+        pszLine[pTerminal->usLineLen] = '\0';
 
-                ubStrLen = 0;
-            }
+        pTerminal->usLinePixLen += ubAdvance;
+    }
+}
+void tft_terminal_update(tft_terminal_t *pTerminal)
+{
+    uint16_t usNumLines = pTerminal->pTextbox->usNumLines;
 
-            *(pszTempStr + ubStrLen) = *pszStr;
+    if(pTerminal->ubRedrawPending || pTerminal->usScrolled >= usNumLines || !tft_terminal_hw_scroll(pTerminal))
+    {
+        const font_t *pFont = pTerminal->pTextbox->pFont;
 
-            ubStrLen++;
+        if(tft_terminal_hw_scroll(pTerminal))
+        {
+            tft_frame_set_scroll_area(pTerminal->pTextbox->usY + pFont->ubLineOffset, usNumLines * pFont->ubYAdvance);
+            tft_frame_set_scroll_start(pTerminal->pTextbox->usY + pFont->ubLineOffset);
         }
 
-        pszStr++;
-    }
+        pTerminal->usScrollOffset = 0;
 
-    pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1] = (char *)malloc(ubStrLen + 1);
+        tft_draw_rectangle(pTerminal->pTextbox->usX, pTerminal->pTextbox->usY, pTerminal->pTextbox->usX + pTerminal->pTextbox->usLen - 1, pTerminal->pTextbox->usY + pFont->ubLineOffset - 1, pTerminal->pTextbox->xBackColor, 1);
 
-    if(!pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1])
+        for(uint16_t usI = 0; usI < usNumLines; usI++)
+            tft_terminal_draw_line(pTerminal, usI);
+    }
+    else
     {
-        free(pszTempStr);
+        const font_t *pFont = pTerminal->pTextbox->pFont;
 
-        return;
-    }
+        // Move the oldest lines out with one register write, then render only the lines that changed in their bands
+        if(pTerminal->usScrolled)
+        {
+            pTerminal->usScrollOffset = (pTerminal->usScrollOffset + pTerminal->usScrolled) % usNumLines;
 
-    strcpy(pTerminal->ppszBuf[pTerminal->pTextbox->usNumLines - 1], pszTempStr);
+            tft_frame_set_scroll_start(pTerminal->pTextbox->usY + pFont->ubLineOffset + pTerminal->usScrollOffset * pFont->ubYAdvance);
+        }
+
+        for(uint16_t usI = usNumLines - pTerminal->usScrolled - 1; usI < usNumLines; usI++)
+            tft_terminal_draw_line(pTerminal, usI);
+    }
 
-    free(pszTempStr);
+    pTerminal->usScrolled = 0;
+    pTerminal->ubRedrawPending = 0;
+    pTerminal->ubUpdatePending = 0;
 }
-void tft_terminal_update(tft_terminal_t *pTerminal)
+void tft_terminal_hide(tft_terminal_t *pTerminal)
 {
-    for(uint8_t ubI = 0; ubI < pTerminal->pTextbox->usNumLines; ubI++)
+    if(tft_terminal_hw_scroll(pTerminal))
     {
-        tft_textbox_goto(pTerminal->pTextbox, 0, ubI, 1);
-
-        tft_textbox_draw_string(pTerminal->pTextbox, pTerminal->ppszBuf[ubI]);
+        tft_frame_set_scroll_area(0, ILI9488_TFTHEIGHT);
+        tft_frame_set_scroll_start(0);
     }
 
-    pTerminal->ubUpdatePending = 0;
+    pTerminal->usScrollOffset = 0;
+    pTerminal->ubRedrawPending = 1;
 }
 void tft_terminal_clear(tft_terminal_t *pTerminal)
 {
-    for(uint8_t ubI = 0; ubI < pTerminal->pTextbox->usNumLines; ubI++)
-    {
-        free(pTerminal->ppszBuf[ubI]);
+    memset(pTerminal->pszBuf, 0, pTerminal->pTextbox->usNumLines * pTerminal->usLineSize);
 
-        pTerminal->ppszBuf[ubI] = NULL;
-    }
+    pTerminal->usHead = 0;
+    pTerminal->usLineLen = 0;
+    pTerminal->usLinePixLen = 0;
+    pTerminal->ubRedrawPending = 1;
 
-    tft_textbox_clear(pTerminal->pTextbox);
+    tft_terminal_update(pTerminal);
 }
 void tft_terminal_printf(tft_terminal_t *pTerminal, uint8_t ubUpdate, const char* pszFmt, ...)
 {
     if(!pTerminal)
         return;
 
+    char szBuf[TFT_TERMINAL_PRINTF_BUFFER_SIZE];
     va_list args;
     va_start(args, pszFmt);
 
-    uint32_t ulStrLen = vsnprintf(NULL, 0, pszFmt, args);
-    char *pszBuf = (char *)malloc(ulStrLen + 1);
-
-    if(!pszBuf)
-    {
-        va_end(args);
-
-        return;
-    }
-
-    vsnprintf(pszBuf, ulStrLen + 1, pszFmt, args);
-
-    tft_terminal_draw_string(pTerminal, pszBuf);
-
-    free(pszBuf);
+    vsnprintf(szBuf, TFT_TERMINAL_PRINTF_BUFFER_SIZE, pszFmt, args);
 
     va_end(args);
 
+    tft_terminal_draw_string(pTerminal, szBuf);
+
     if(ubUpdate)
         tft_terminal_update(pTerminal);
     else
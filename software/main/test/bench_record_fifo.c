@@ -0,0 +1,117 @@
+#include "host.h"
+#include "rfm69.h"
+#include "record_fifo.h"
+
+// Throughput of record_fifo per byte, record sizes from a bare header up to the largest radio frame and beyond
+// Sized like the RX packet FIFO, half full so the records keep wrapping, once with copies and once through peek and commit
+// The lock free path is what makes it cheap, the masked section count must stay at 0
+
+#define BENCH_RECORD_FIFO_BYTES     (64UL * 1024 * 1024) // Per record size and mode
+
+static const uint16_t pusRecordSizes[] = {8, 16, 32, 66, 128, 512};
+
+static uint8_t bench_record_fifo_run(uint16_t usRecordSize, uint8_t ubZeroCopy)
+{
+    uint8_t pubData[512];
+    uint8_t pubOut[512];
+    record_fifo_span_t pSpans[2];
+    uint32_t ulRecords = BENCH_RECORD_FIFO_BYTES / usRecordSize;
+    uint32_t ulCheck = 0;
+    record_fifo_t *pFIFO = record_fifo_init(NULL, RFM69_RX_PACKET_FIFO_SIZE);
+
+    if(!pFIFO)
+    {
+        printf("  %hu: FIFO not created\n", usRecordSize);
+
+        return 1;
+    }
+
+    for(uint16_t i = 0; i < usRecordSize; i++)
+        pubData[i] = i;
+
+    // Keep half the FIFO in flight, like a consumer that lags the producer by a few frames
+    uint32_t ulBacklog = 0;
+
+    while(record_fifo_get_free(pFIFO) > (uint32_t)(RFM69_RX_PACKET_FIFO_SIZE / 2 + RECORD_FIFO_HEADER_SIZE + usRecordSize) && record_fifo_write(pFIFO, pubData, usRecordSize))
+        ulBacklog++;
+
+    uint64_t ullStart = host_time_ns();
+
+    for(uint32_t i = 0; i < ulRecords; i++)
+    {
+        pubData[0] = i;
+
+        if(!record_fifo_write(pFIFO, pubData, usRecordSize))
+        {
+            printf("  %hu: write refused with %u free\n", usRecordSize, record_fifo_get_free(pFIFO));
+
+            record_fifo_delete(pFIFO);
+
+            return 1;
+        }
+
+        if(ubZeroCopy)
+        {
+            if(record_fifo_peek(pFIFO, pSpans))
+                ulCheck += pSpans[0].pubData[0];
+
+            record_fifo_commit(pFIFO);
+        }
+        else
+        {
+            uint32_t ulSize;
+
+            if(record_fifo_read(pFIFO, pubOut, &ulSize, sizeof(pubOut)))
+                ulCheck += pubOut[0];
+        }
+    }
+
+    uint64_t ullTime = host_time_ns() - ullStart;
+    uint32_t ulExpected = 0;
+
+    for(uint32_t i = 0; i < ulRecords; i++)
+        ulExpected += i < ulBacklog ? 0 : (uint8_t)(i - ulBacklog);
+
+    record_fifo_delete(pFIFO);
+
+    if(ulCheck != ulExpected)
+    {
+        printf("  %hu: records came out wrong\n", usRecordSize);
+
+        return 1;
+    }
+
+    double dBytesPerSecond = (double)ulRecords * usRecordSize * 1e9 / ullTime;
+
+    printf("%6hu %-10s %10u %10.2f %10.3f %10.1f\n", usRecordSize, ubZeroCopy ? "peek" : "read", ulRecords, (double)ullTime / ulRecords, (double)ullTime / ((double)ulRecords * usRecordSize), dBytesPerSecond / (1024 * 1024));
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+    uint32_t ulMaskedSections = g_ulHostMaskedSections;
+
+    printf("%6s %-10s %10s %10s %10s %10s\n", "size", "mode", "records", "ns/record", "ns/byte", "MiB/s");
+
+    for(uint8_t i = 0; i < sizeof(pusRecordSizes) / sizeof(pusRecordSizes[0]); i++)
+    {
+        ubFailed |= bench_record_fifo_run(pusRecordSizes[i], 0);
+        ubFailed |= bench_record_fifo_run(pusRecordSizes[i], 1);
+    }
+
+    printf("masked sections: %u\n", g_ulHostMaskedSections - ulMaskedSections);
+
+    if(g_ulHostMaskedSections != ulMaskedSections)
+    {
+        printf("  record_fifo masked interrupts\n");
+
+        ubFailed = 1;
+    }
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
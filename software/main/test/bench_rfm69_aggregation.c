@@ -0,0 +1,174 @@
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69_peer.h"
+#include "rfm69.h"
+
+// Message rate and airtime per message with and without aggregation, the driver kept saturated by a sender that retries refused messages every millisecond
+// Receivers are scripted peers that ACK QoS 1 frames, their ACKs are injected and cost no airtime here
+// Every message is numbered, the peers check that all of them arrive, QoS 0 ones in order (QoS 1 frames go out in timer order)
+
+#define BENCH_RFM69_AGGREGATION_NODE_ID     1
+#define BENCH_RFM69_AGGREGATION_NET_ID      100
+#define BENCH_RFM69_AGGREGATION_MESSAGES    400
+#define BENCH_RFM69_AGGREGATION_TIMEOUT     120000  // ms
+#define BENCH_RFM69_AGGREGATION_RETRY_DELAY 300     // ms
+#define BENCH_RFM69_AGGREGATION_RETRIES     3
+
+typedef struct
+{
+    uint8_t ubSize;
+    uint8_t ubQoSLevel;
+    uint8_t ubReceivers;
+} bench_rfm69_aggregation_case_t;
+
+static const bench_rfm69_aggregation_case_t pCases[] = {
+    {4, 0, 1},
+    {8, 0, 1},
+    {16, 0, 1},
+    {27, 0, 1},
+    {8, 1, 1},
+    {8, 0, 4},
+    {8, 1, 4},
+    {40, 0, 1},
+};
+static const uint16_t pusLatencies[] = {0, RFM69_AGGREGATION_LATENCY, 50};
+
+static rfm69_model_t xRadio;
+static rfm69_peer_t pPeers[4];
+static uint16_t pusNextExpected[4];
+static uint32_t pulSeen[4][(BENCH_RFM69_AGGREGATION_MESSAGES + 31) / 32];
+static uint32_t ulReceived = 0;
+static uint32_t ulOutOfOrder = 0;
+
+static void bench_rfm69_aggregation_irq(rfm69_model_t *pModel)
+{
+    rfm69_isr();
+}
+static void bench_rfm69_aggregation_peer_rx(rfm69_peer_t *pPeer, const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubSize)
+{
+    uint8_t ubPeer = pPeer - pPeers;
+    uint16_t usNumber = pubData[0] | (pubData[1] << 8);
+
+    if(usNumber >= BENCH_RFM69_AGGREGATION_MESSAGES || (pulSeen[ubPeer][usNumber / 32] & BIT(usNumber % 32)))
+        return; // Retransmission after a lost ACK, not counted twice
+
+    pulSeen[ubPeer][usNumber / 32] |= BIT(usNumber % 32);
+
+    if(!pHeader->ubACKRequested && usNumber != pusNextExpected[ubPeer])
+        ulOutOfOrder++;
+
+    pusNextExpected[ubPeer] = usNumber + 1;
+
+    ulReceived++;
+}
+
+static uint8_t bench_rfm69_aggregation_run(const bench_rfm69_aggregation_case_t *pCase, uint16_t usLatency)
+{
+    uint8_t pubMessage[RFM69_MAX_DATA_SIZE];
+    uint16_t pusNumbers[4] = {0};
+    rfm69_tx_stats_t xTXStats;
+
+    host_trng_seed(pCase->ubSize);
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = bench_rfm69_aggregation_irq;
+
+    rfm69_peer_attach(&xRadio);
+
+    for(uint8_t i = 0; i < pCase->ubReceivers; i++)
+    {
+        rfm69_peer_init(&pPeers[i], 2 + i, 1 + i);
+
+        pusNextExpected[i] = 0;
+        pPeers[i].pfRX = bench_rfm69_aggregation_peer_rx;
+    }
+
+    memset(pulSeen, 0, sizeof(pulSeen));
+
+    ulReceived = 0;
+    ulOutOfOrder = 0;
+
+    ldma_init();
+
+    if(!rfm69_init(BENCH_RFM69_AGGREGATION_NODE_ID, BENCH_RFM69_AGGREGATION_NET_ID, NULL))
+    {
+        printf("  RFM69 not detected\n");
+
+        return 1;
+    }
+
+    rfm69_set_aggregation_latency(usLatency);
+
+    uint16_t usQueued = 0;
+    uint64_t ullStart = g_ullSystemTick;
+
+    while(ulReceived < BENCH_RFM69_AGGREGATION_MESSAGES && g_ullSystemTick - ullStart < BENCH_RFM69_AGGREGATION_TIMEOUT)
+    {
+        while(usQueued < BENCH_RFM69_AGGREGATION_MESSAGES)
+        {
+            uint8_t ubPeer = usQueued % pCase->ubReceivers;
+
+            memset(pubMessage, usQueued, pCase->ubSize);
+
+            pubMessage[0] = pusNumbers[ubPeer] & 0xFF;
+            pubMessage[1] = pusNumbers[ubPeer] >> 8;
+
+            if(!rfm69_send(2 + ubPeer, pubMessage, pCase->ubSize, pCase->ubQoSLevel, BENCH_RFM69_AGGREGATION_RETRY_DELAY, BENCH_RFM69_AGGREGATION_RETRIES))
+                break; // Driver is full, try again next millisecond
+
+            pusNumbers[ubPeer]++;
+            usQueued++;
+        }
+
+        host_advance(1);
+        rfm69_tick();
+    }
+
+    uint64_t ullTime = g_ullSystemTick - ullStart;
+
+    rfm69_get_tx_stats(&xTXStats);
+
+    uint8_t ubFailed = 0;
+
+    if(ulReceived != BENCH_RFM69_AGGREGATION_MESSAGES || ulOutOfOrder)
+    {
+        printf("  %hhu bytes, QoS %hhu, %hhu receivers, %hu ms: %u of %u messages, %u out of order\n", pCase->ubSize, pCase->ubQoSLevel, pCase->ubReceivers, usLatency, ulReceived, BENCH_RFM69_AGGREGATION_MESSAGES, ulOutOfOrder);
+
+        ubFailed = 1;
+    }
+
+    // Aggregation has to pay off whenever two messages fit a frame
+    if(usLatency && 2 * (pCase->ubSize + 1) <= RFM69_MAX_DATA_SIZE && xTXStats.ulAggregatedFrames == 0)
+    {
+        printf("  %hhu bytes, QoS %hhu, %hhu receivers, %hu ms: nothing aggregated\n", pCase->ubSize, pCase->ubQoSLevel, pCase->ubReceivers, usLatency);
+
+        ubFailed = 1;
+    }
+
+    printf("%5hhu %4hhu %9hhu %8hu %7u %9.1f %10.0f %9.1f %8u\n",
+        pCase->ubSize, pCase->ubQoSLevel, pCase->ubReceivers, usLatency,
+        xTXStats.ulFrames,
+        BENCH_RFM69_AGGREGATION_MESSAGES * 1000.0 / ullTime,
+        (double)xRadio.xStats.ullTXTime / BENCH_RFM69_AGGREGATION_MESSAGES,
+        (double)xTXStats.ulAirBytes / BENCH_RFM69_AGGREGATION_MESSAGES,
+        xTXStats.ulAggregationStalls);
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("%5s %4s %9s %8s %7s %9s %10s %9s %8s\n", "bytes", "QoS", "receivers", "latency", "frames", "msg/s", "us air/msg", "B air/msg", "stalls");
+
+    for(uint8_t i = 0; i < sizeof(pCases) / sizeof(pCases[0]); i++)
+        for(uint8_t j = 0; j < sizeof(pusLatencies) / sizeof(pusLatencies[0]); j++)
+            ubFailed |= bench_rfm69_aggregation_run(&pCases[i], pusLatencies[j]);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
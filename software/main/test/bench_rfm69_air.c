@@ -0,0 +1,333 @@
+#include <dlfcn.h>
+#include <math.h>
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69.h"
+
+// Several complete nodes on one simulated air, each with its own copy of the driver
+// The driver keeps its state in file scope statics, so every node loads a private copy of bin/librfm69.so and the harness switches the bus, pins and LDMA interrupt to it before calling in
+// Sensor nodes send QoS 1 reports to a gateway at random, the gateway answers through its own driver, collision rate and goodput are reported against the node count
+// Collision rate is frames lost to overlaps at the gateway over data frames sent, goodput counts unique reports only
+
+#define BENCH_RFM69_AIR_GATEWAY_ID      1
+#define BENCH_RFM69_AIR_NET_ID          100
+#define BENCH_RFM69_AIR_MAX_NODES       25
+#define BENCH_RFM69_AIR_DURATION        60000   // ms
+#define BENCH_RFM69_AIR_PAYLOAD         20
+#define BENCH_RFM69_AIR_RETRY_DELAY     200     // ms
+#define BENCH_RFM69_AIR_RETRIES         3
+#define BENCH_RFM69_AIR_MAX_MESSAGES    4096    // Per node, tracked for duplicates
+#define BENCH_RFM69_AIR_TX_START_DELAY  500     // us - RX to TX turnaround and RSSI sampling, the window in which CSMA cannot see another node
+
+static const uint8_t pubNodeCounts[] = {1, 2, 4, 8, 16, 24};
+static const uint16_t pusIntervals[] = {2000, 500}; // ms - Mean time between reports of a node
+
+typedef struct bench_rfm69_air_node_t bench_rfm69_air_node_t;
+
+struct bench_rfm69_air_node_t
+{
+    void *pvLibrary;
+    rfm69_model_t xModel;
+    ldma_ch_isr_t pfDMAISR;
+    uint8_t ubNodeID;
+    uint64_t ullNextReport;
+    uint16_t usNextNumber;
+    uint32_t ulRefused;
+    uint32_t ulTimeouts;
+    uint32_t pulDelivered[BENCH_RFM69_AIR_MAX_MESSAGES / 32];
+    // Entry points of this copy
+    uint8_t (* pfInit)(uint8_t, uint8_t, const void *);
+    void (* pfTick)();
+    void (* pfISR)();
+    uint16_t (* pfSend)(uint8_t, const void *, uint8_t, uint8_t, uint16_t, uint16_t);
+    void (* pfSetRXCallback)(rfm69_rx_callback_fn_t);
+    void (* pfSetTimeoutCallback)(rfm69_timeout_callback_fn_t);
+    void (* pfGetTXStats)(rfm69_tx_stats_t *);
+};
+
+static bench_rfm69_air_node_t pNodes[BENCH_RFM69_AIR_MAX_NODES];
+static uint8_t ubNodeCount = 0;
+static bench_rfm69_air_node_t *pCurrent = NULL;
+static uint32_t ulRandom = 1;
+static uint32_t ulDelivered = 0;
+static uint32_t ulDuplicates = 0;
+
+static uint32_t bench_rfm69_air_random()
+{
+    ulRandom ^= ulRandom << 13;
+    ulRandom ^= ulRandom >> 17;
+    ulRandom ^= ulRandom << 5;
+
+    return ulRandom;
+}
+static uint32_t bench_rfm69_air_exponential(uint32_t ulMean)
+{
+    double dUniform = (bench_rfm69_air_random() + 1.0) / 4294967297.0;
+
+    return (uint32_t)(-log(dUniform) * ulMean) + 1;
+}
+
+// Everything the driver touches that is not its own goes to the node being entered
+static bench_rfm69_air_node_t* bench_rfm69_air_enter(bench_rfm69_air_node_t *pNode)
+{
+    bench_rfm69_air_node_t *pPrevious = pCurrent;
+
+    pCurrent = pNode;
+
+    rfm69_model_select(&pNode->xModel);
+    ldma_ch_set_isr(RFM69_DMA_RX_CHANNEL, pNode->pfDMAISR);
+
+    return pPrevious;
+}
+static void bench_rfm69_air_irq(rfm69_model_t *pModel)
+{
+    bench_rfm69_air_node_t *pNode = (bench_rfm69_air_node_t *)pModel->pvUser;
+    bench_rfm69_air_node_t *pPrevious = bench_rfm69_air_enter(pNode);
+
+    pNode->pfISR();
+
+    if(pPrevious)
+        bench_rfm69_air_enter(pPrevious);
+}
+static void bench_rfm69_air_gateway_rx(const rfm69_packet_header_t *pHeader, int8_t bRSSI, const uint8_t *pubData, uint8_t ubSize)
+{
+    uint8_t ubIndex = pHeader->ubSenderNodeID - BENCH_RFM69_AIR_GATEWAY_ID;
+    uint16_t usNumber = pubData[0] | (pubData[1] << 8);
+
+    if(!ubIndex || ubIndex >= ubNodeCount || ubSize != BENCH_RFM69_AIR_PAYLOAD || usNumber >= BENCH_RFM69_AIR_MAX_MESSAGES)
+        return;
+
+    uint32_t *pulDelivered = pNodes[ubIndex].pulDelivered;
+
+    if(pulDelivered[usNumber / 32] & BIT(usNumber % 32))
+    {
+        ulDuplicates++;
+
+        return;
+    }
+
+    pulDelivered[usNumber / 32] |= BIT(usNumber % 32);
+    ulDelivered++;
+}
+static void bench_rfm69_air_timeout(uint16_t usID)
+{
+    pCurrent->ulTimeouts++;
+}
+
+static uint8_t bench_rfm69_air_copy(const char *pszFrom, const char *pszTo)
+{
+    FILE *pFrom = fopen(pszFrom, "rb");
+
+    if(!pFrom)
+        return 0;
+
+    FILE *pTo = fopen(pszTo, "wb");
+
+    if(!pTo)
+    {
+        fclose(pFrom);
+
+        return 0;
+    }
+
+    uint8_t pubBuffer[4096];
+    size_t xSize;
+
+    while((xSize = fread(pubBuffer, 1, sizeof(pubBuffer), pFrom)) > 0)
+        fwrite(pubBuffer, 1, xSize, pTo);
+
+    fclose(pFrom);
+    fclose(pTo);
+
+    return 1;
+}
+static uint8_t bench_rfm69_air_load(bench_rfm69_air_node_t *pNode, const char *pszDirectory, uint8_t ubIndex)
+{
+    char pszLibrary[256];
+    char pszCopy[256];
+
+    // dlopen() hands out the same instance for the same path, a copy per node gets it fresh statics
+    snprintf(pszLibrary, sizeof(pszLibrary), "%s/librfm69.so", pszDirectory);
+    snprintf(pszCopy, sizeof(pszCopy), "%s/librfm69_node%hhu.so", pszDirectory, ubIndex);
+
+    if(!bench_rfm69_air_copy(pszLibrary, pszCopy))
+        return 0;
+
+    pNode->pvLibrary = dlopen(pszCopy, RTLD_NOW | RTLD_LOCAL);
+
+    if(!pNode->pvLibrary)
+    {
+        printf("  %s\n", dlerror());
+
+        return 0;
+    }
+
+    pNode->pfInit = dlsym(pNode->pvLibrary, "rfm69_init");
+    pNode->pfTick = dlsym(pNode->pvLibrary, "rfm69_tick");
+    pNode->pfISR = dlsym(pNode->pvLibrary, "rfm69_isr");
+    pNode->pfSend = dlsym(pNode->pvLibrary, "rfm69_send");
+    pNode->pfSetRXCallback = dlsym(pNode->pvLibrary, "rfm69_set_rx_callback");
+    pNode->pfSetTimeoutCallback = dlsym(pNode->pvLibrary, "rfm69_set_timeout_callback");
+    pNode->pfGetTXStats = dlsym(pNode->pvLibrary, "rfm69_get_tx_stats");
+
+    return pNode->pfInit && pNode->pfTick && pNode->pfISR && pNode->pfSend && pNode->pfSetRXCallback && pNode->pfSetTimeoutCallback && pNode->pfGetTXStats;
+}
+static uint8_t bench_rfm69_air_start(bench_rfm69_air_node_t *pNode, uint8_t ubNodeID)
+{
+    rfm69_model_init(&pNode->xModel);
+
+    pNode->xModel.pvUser = pNode;
+    pNode->xModel.pfIRQ = bench_rfm69_air_irq;
+    pNode->xModel.ulTXStartDelay = BENCH_RFM69_AIR_TX_START_DELAY;
+    pNode->ubNodeID = ubNodeID;
+    pNode->usNextNumber = 0;
+    pNode->ulRefused = 0;
+    pNode->ulTimeouts = 0;
+
+    memset(pNode->pulDelivered, 0, sizeof(pNode->pulDelivered));
+
+    pCurrent = pNode;
+
+    rfm69_model_select(&pNode->xModel);
+
+    if(!pNode->pfInit(ubNodeID, BENCH_RFM69_AIR_NET_ID, NULL))
+        return 0;
+
+    pNode->pfDMAISR = ldma_host_get_isr(RFM69_DMA_RX_CHANNEL); // Set by this copy's rfm69_init()
+    pNode->pfSetTimeoutCallback(bench_rfm69_air_timeout);
+
+    return 1;
+}
+
+static uint8_t bench_rfm69_air_run(uint8_t ubSensors, uint16_t usInterval)
+{
+    uint8_t pubReport[BENCH_RFM69_AIR_PAYLOAD];
+
+    host_trng_seed(ubSensors * 7 + usInterval);
+    rfm69_model_air_reset();
+
+    ubNodeCount = ubSensors + 1;
+    ulRandom = 0xA5A5 + ubSensors * 31 + usInterval;
+    ulDelivered = 0;
+    ulDuplicates = 0;
+
+    for(uint8_t i = 0; i < ubNodeCount; i++)
+    {
+        if(!bench_rfm69_air_start(&pNodes[i], BENCH_RFM69_AIR_GATEWAY_ID + i))
+        {
+            printf("  %hhu nodes: node %hhu did not start\n", ubSensors, i);
+
+            return 1;
+        }
+
+        pNodes[i].ullNextReport = g_ullSystemTick + bench_rfm69_air_exponential(usInterval);
+    }
+
+    pNodes[0].pfSetRXCallback(bench_rfm69_air_gateway_rx);
+
+    uint64_t ullStart = g_ullSystemTick;
+    uint32_t ulOffered = 0;
+
+    while(g_ullSystemTick - ullStart < BENCH_RFM69_AIR_DURATION + 3000) // Reports stop at the duration, the rest drains
+    {
+        for(uint8_t i = 0; i < ubNodeCount; i++)
+        {
+            bench_rfm69_air_node_t *pNode = &pNodes[i];
+
+            bench_rfm69_air_enter(pNode);
+
+            if(i && g_ullSystemTick >= pNode->ullNextReport && g_ullSystemTick - ullStart < BENCH_RFM69_AIR_DURATION && pNode->usNextNumber < BENCH_RFM69_AIR_MAX_MESSAGES)
+            {
+                memset(pubReport, pNode->ubNodeID, sizeof(pubReport));
+
+                pubReport[0] = pNode->usNextNumber & 0xFF;
+                pubReport[1] = pNode->usNextNumber >> 8;
+
+                if(pNode->pfSend(BENCH_RFM69_AIR_GATEWAY_ID, pubReport, sizeof(pubReport), 1, BENCH_RFM69_AIR_RETRY_DELAY, BENCH_RFM69_AIR_RETRIES))
+                    ulOffered++;
+                else
+                    pNode->ulRefused++;
+
+                pNode->usNextNumber++;
+                pNode->ullNextReport = g_ullSystemTick + bench_rfm69_air_exponential(usInterval);
+            }
+
+            pNode->pfTick();
+        }
+
+        pCurrent = NULL;
+
+        host_advance(1);
+    }
+
+    rfm69_tx_stats_t xTXStats;
+    uint32_t ulDataFrames = 0;
+    uint32_t ulCSMABusy = 0;
+    uint32_t ulCSMAFailures = 0;
+    uint32_t ulTimeouts = 0;
+    uint32_t ulRefused = 0;
+    uint64_t ullAirtime = 0;
+
+    for(uint8_t i = 0; i < ubNodeCount; i++)
+    {
+        pNodes[i].pfGetTXStats(&xTXStats);
+
+        if(i)
+            ulDataFrames += pNodes[i].xModel.xStats.ulFramesSent;
+
+        ulCSMABusy += xTXStats.ulCSMABusy;
+        ulCSMAFailures += xTXStats.ulCSMAFailures;
+        ulTimeouts += pNodes[i].ulTimeouts;
+        ulRefused += pNodes[i].ulRefused;
+        ullAirtime += pNodes[i].xModel.xStats.ullTXTime;
+    }
+
+    double dCollisionRate = ulDataFrames ? (double)pNodes[0].xModel.xStats.ulCollisions / ulDataFrames : 0;
+    double dGoodput = ulDelivered * BENCH_RFM69_AIR_PAYLOAD * 1000.0 / BENCH_RFM69_AIR_DURATION;
+    double dDelivery = ulOffered ? (double)ulDelivered / ulOffered : 1;
+    double dOfferedLoad = (double)ullAirtime / 1000 / (BENCH_RFM69_AIR_DURATION + 3000); // Airtime of all nodes over the run, above 1 only with frames overlapping
+    uint8_t ubFailed = 0;
+
+    // Alone on air nothing may collide or get lost, a light load has to get through as well
+    if((ubSensors == 1 && (pNodes[0].xModel.xStats.ulCollisions || ulDelivered != ulOffered)) || (dOfferedLoad < 0.1 && dDelivery < 0.99))
+    {
+        printf("  %hhu nodes, %hu ms: %u of %u delivered, %u collisions\n", ubSensors, usInterval, ulDelivered, ulOffered, pNodes[0].xModel.xStats.ulCollisions);
+
+        ubFailed = 1;
+    }
+
+    printf("%5hhu %8hu %7u %7u %9.1f%% %6.1f%% %8.3f %8.1f %6u %6u %6u %6u\n", ubSensors, usInterval, ulOffered, ulRefused, dDelivery * 100, dCollisionRate * 100, dOfferedLoad, dGoodput, ulCSMABusy, ulCSMAFailures, ulTimeouts, ulDuplicates);
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    const char *pszDirectory = argc > 1 ? argv[1] : ".";
+    uint8_t ubFailed = 0;
+
+    ldma_init();
+
+    for(uint8_t i = 0; i < BENCH_RFM69_AIR_MAX_NODES; i++)
+    {
+        if(!bench_rfm69_air_load(&pNodes[i], pszDirectory, i))
+        {
+            printf("  could not load the driver for node %hhu\n", i);
+
+            printf("FAILED\n");
+
+            return 1;
+        }
+    }
+
+    printf("%5s %8s %7s %7s %10s %7s %8s %8s %6s %6s %6s %6s\n", "nodes", "interval", "offered", "refused", "delivered", "coll", "load", "B/s", "busy", "fails", "tmouts", "dups");
+
+    for(uint8_t i = 0; i < sizeof(pusIntervals) / sizeof(pusIntervals[0]); i++)
+        for(uint8_t j = 0; j < sizeof(pubNodeCounts) / sizeof(pubNodeCounts[0]); j++)
+            ubFailed |= bench_rfm69_air_run(pubNodeCounts[j], pusIntervals[i]);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
@@ -0,0 +1,353 @@
+#include <math.h>
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69_peer.h"
+#include "rfm69.h"
+
+// ATC against fading channels, one QoS 1 report per second to a scripted peer whose ACKs carry the RSSI it heard, with ATC on (target below) and at full power
+// Energy per delivered report uses RFM69HCW TX currents at 3.3 V over the airtime of every frame sent, retransmissions included
+// Settling is the time until the ATC power stays within BENCH_RFM69_ATC_SETTLE_BAND of the power the mean path loss needs, from the start and again after a step in the loss
+
+#define BENCH_RFM69_ATC_NODE_ID         1
+#define BENCH_RFM69_ATC_PEER_ID         2
+#define BENCH_RFM69_ATC_NET_ID          100
+#define BENCH_RFM69_ATC_TARGET          -88     // dBm
+#define BENCH_RFM69_ATC_SENSITIVITY     -100    // dBm - Both ends, weaker frames are lost
+#define BENCH_RFM69_ATC_PEER_POWER      13      // dBm - The peer has no ATC
+#define BENCH_RFM69_ATC_REPORTS         300
+#define BENCH_RFM69_ATC_INTERVAL        1000    // ms
+#define BENCH_RFM69_ATC_PAYLOAD         12
+#define BENCH_RFM69_ATC_RETRY_DELAY     50      // ms
+#define BENCH_RFM69_ATC_RETRIES         3
+#define BENCH_RFM69_ATC_SEEDS           4
+#define BENCH_RFM69_ATC_SETTLE_BAND     3       // dB
+#define BENCH_RFM69_ATC_VOLTAGE         3.3     // V
+
+typedef struct bench_rfm69_atc_channel_t bench_rfm69_atc_channel_t;
+typedef struct bench_rfm69_atc_result_t bench_rfm69_atc_result_t;
+
+struct bench_rfm69_atc_channel_t
+{
+    const char *pszName;
+    float fLoss; // dB - Mean path loss at the start
+    float fLossEnd; // dB - Mean path loss at the end, reached linearly
+    float fStep; // dB - Added halfway
+    float fShadowing; // dB - Standard deviation of slow log-normal shadowing, correlated from frame to frame
+    uint8_t ubRayleigh; // Fast fading drawn for every frame
+};
+struct bench_rfm69_atc_result_t
+{
+    uint32_t ulDelivered;
+    uint32_t ulFrames;
+    double dEnergy; // uJ
+    double dError; // dB - Sum of |ATC power - ideal power| over the reports
+    uint32_t ulSettle; // ms - 0 if the power was always in the band
+    uint32_t ulRecover; // ms - After the step
+    uint8_t ubConverged; // The driver called its loop converged at the end
+    uint32_t ulConvergence; // ms - As the driver timed it, from its last disturbance
+};
+
+static const bench_rfm69_atc_channel_t pChannels[] = {
+    {"static near", 85, 85, 0, 0, 0},
+    {"static far", 104, 104, 0, 0, 0},
+    {"shadowing", 95, 95, 0, 4, 0},
+    {"rayleigh", 95, 95, 0, 0, 1},
+    {"15 dB drop", 88, 88, 15, 0, 0},
+    {"walk away", 85, 105, 0, 0, 0},
+};
+// RFM69HCW TX current, mA against dBm, linear in between
+static const int8_t pbCurrentPower[] = {-2, 0, 5, 10, 13, 17, 20};
+static const float pfCurrent[] = {16, 18, 24, 33, 45, 95, 130};
+
+static rfm69_model_t xRadio;
+static rfm69_peer_t xPeer;
+static const bench_rfm69_atc_channel_t *pChannel;
+static uint32_t ulRandom;
+static float fShadow;
+static uint64_t ullRunStart; // ms
+static uint32_t pulSeen[(BENCH_RFM69_ATC_REPORTS + 31) / 32];
+static uint32_t ulDelivered;
+static uint32_t ulFrames;
+static double dCurrentSum; // mA, over the frames sent
+
+static void bench_rfm69_atc_irq(rfm69_model_t *pModel)
+{
+    rfm69_isr();
+}
+static float bench_rfm69_atc_uniform()
+{
+    ulRandom ^= ulRandom << 13;
+    ulRandom ^= ulRandom >> 17;
+    ulRandom ^= ulRandom << 5;
+
+    return (ulRandom >> 8) / 16777216.0f + 1 / 33554432.0f; // Never 0
+}
+static float bench_rfm69_atc_gaussian()
+{
+    return sqrtf(-2 * logf(bench_rfm69_atc_uniform())) * cosf(6.2831853f * bench_rfm69_atc_uniform());
+}
+static float bench_rfm69_atc_current(int8_t bPower)
+{
+    for(uint8_t i = 1; i < sizeof(pbCurrentPower) / sizeof(pbCurrentPower[0]); i++)
+        if(bPower <= pbCurrentPower[i])
+            return pfCurrent[i - 1] + (pfCurrent[i] - pfCurrent[i - 1]) * (bPower - pbCurrentPower[i - 1]) / (pbCurrentPower[i] - pbCurrentPower[i - 1]);
+
+    return pfCurrent[sizeof(pfCurrent) / sizeof(pfCurrent[0]) - 1];
+}
+static float bench_rfm69_atc_mean_loss(uint64_t ullTime)
+{
+    float fProgress = (float)ullTime / (BENCH_RFM69_ATC_REPORTS * BENCH_RFM69_ATC_INTERVAL);
+
+    if(fProgress > 1)
+        fProgress = 1;
+
+    return pChannel->fLoss + (pChannel->fLossEnd - pChannel->fLoss) * fProgress + (fProgress >= 0.5f ? pChannel->fStep : 0);
+}
+static int8_t bench_rfm69_atc_ideal_power(uint64_t ullTime)
+{
+    float fPower = BENCH_RFM69_ATC_TARGET + bench_rfm69_atc_mean_loss(ullTime);
+
+    return fPower < RFM69_MINIMUM_TX_POWER ? RFM69_MINIMUM_TX_POWER : fPower > RFM69_MAXIMUM_TX_POWER ? RFM69_MAXIMUM_TX_POWER : (int8_t)lrintf(fPower);
+}
+static int8_t bench_rfm69_atc_peer_rssi(rfm69_peer_t *pPeer, int8_t bPower)
+{
+    // Every frame for the peer, the ACK it may send back sees the same channel
+    float fLoss = bench_rfm69_atc_mean_loss(g_ullSystemTick - ullRunStart);
+
+    if(pChannel->fShadowing)
+    {
+        fShadow = 0.95f * fShadow + 0.31225f * pChannel->fShadowing * bench_rfm69_atc_gaussian(); // sqrt(1 - 0.95^2) keeps the variance
+
+        fLoss += fShadow;
+    }
+
+    if(pChannel->ubRayleigh)
+        fLoss -= 10 * log10f(-logf(bench_rfm69_atc_uniform()));
+
+    ulFrames++;
+    dCurrentSum += bench_rfm69_atc_current(bPower);
+
+    float fReverse = BENCH_RFM69_ATC_PEER_POWER - fLoss;
+
+    pPeer->bRSSI = fReverse < -127 ? -127 : (int8_t)lrintf(fReverse);
+    pPeer->usLossOut = fReverse < BENCH_RFM69_ATC_SENSITIVITY ? RFM69_PEER_LOSS_SCALE : 0;
+
+    float fRSSI = bPower - fLoss;
+
+    if(fRSSI < BENCH_RFM69_ATC_SENSITIVITY)
+        return -128;
+
+    return fRSSI > 0 ? 0 : (int8_t)lrintf(fRSSI);
+}
+static void bench_rfm69_atc_peer_rx(rfm69_peer_t *pPeer, const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubSize)
+{
+    uint16_t usNumber = pubData[0] | (pubData[1] << 8);
+
+    if(usNumber >= BENCH_RFM69_ATC_REPORTS || (pulSeen[usNumber / 32] & BIT(usNumber % 32)))
+        return; // Retransmission after a lost ACK
+
+    pulSeen[usNumber / 32] |= BIT(usNumber % 32);
+
+    ulDelivered++;
+}
+
+static uint8_t bench_rfm69_atc_run(uint32_t ulSeed, int8_t bTarget, bench_rfm69_atc_result_t *pResult)
+{
+    uint8_t pubReport[BENCH_RFM69_ATC_PAYLOAD];
+
+    host_trng_seed(ulSeed);
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = bench_rfm69_atc_irq;
+
+    rfm69_peer_attach(&xRadio);
+    rfm69_peer_init(&xPeer, BENCH_RFM69_ATC_PEER_ID, ulSeed);
+
+    xPeer.pfRX = bench_rfm69_atc_peer_rx;
+    xPeer.pfRSSI = bench_rfm69_atc_peer_rssi;
+
+    ulRandom = ulSeed * 2654435761u + 1;
+    fShadow = pChannel->fShadowing * bench_rfm69_atc_gaussian();
+    ulDelivered = 0;
+    ulFrames = 0;
+    dCurrentSum = 0;
+
+    memset(pulSeen, 0, sizeof(pulSeen));
+    memset(pResult, 0, sizeof(bench_rfm69_atc_result_t));
+
+    ldma_init();
+
+    if(!rfm69_init(BENCH_RFM69_ATC_NODE_ID, BENCH_RFM69_ATC_NET_ID, NULL))
+        return 0;
+
+    rfm69_set_aggregation_latency(0);
+    rfm69_set_atc_target_rssi(BENCH_RFM69_ATC_PEER_ID, bTarget);
+
+    uint64_t ullStart = g_ullSystemTick;
+    uint64_t ullStep = ullStart + BENCH_RFM69_ATC_REPORTS * BENCH_RFM69_ATC_INTERVAL / 2;
+    uint64_t ullLastOut = 0; // Last report sent outside the band, before and after the step
+    uint64_t ullLastOutAfterStep = 0;
+
+    ullRunStart = ullStart;
+
+    for(uint16_t i = 0; i < BENCH_RFM69_ATC_REPORTS; i++)
+    {
+        uint64_t ullNow = g_ullSystemTick - ullStart;
+        int8_t bPower = rfm69_get_atc_power_level(BENCH_RFM69_ATC_PEER_ID);
+        int8_t bIdeal = bench_rfm69_atc_ideal_power(ullNow);
+        uint8_t ubError = bPower > bIdeal ? bPower - bIdeal : bIdeal - bPower;
+
+        pResult->dError += ubError;
+
+        if(ubError > BENCH_RFM69_ATC_SETTLE_BAND)
+        {
+            if(g_ullSystemTick < ullStep)
+                ullLastOut = ullNow + BENCH_RFM69_ATC_INTERVAL;
+            else
+                ullLastOutAfterStep = g_ullSystemTick - ullStep + BENCH_RFM69_ATC_INTERVAL;
+        }
+
+        memset(pubReport, i, sizeof(pubReport));
+
+        pubReport[0] = i & 0xFF;
+        pubReport[1] = i >> 8;
+
+        rfm69_send(BENCH_RFM69_ATC_PEER_ID, pubReport, sizeof(pubReport), 1, BENCH_RFM69_ATC_RETRY_DELAY, BENCH_RFM69_ATC_RETRIES);
+
+        for(uint16_t j = 0; j < BENCH_RFM69_ATC_INTERVAL; j++)
+        {
+            host_advance(1);
+            rfm69_tick();
+        }
+    }
+
+    const rfm69_link_t *pLink = rfm69_find_link(BENCH_RFM69_ATC_PEER_ID);
+
+    // Every gateway frame is a report of the same size, so the average airtime is the airtime of each
+    double dAirtime = xRadio.xStats.ulFramesSent ? (double)xRadio.xStats.ullTXTime / 1000 / xRadio.xStats.ulFramesSent : 0; // ms
+
+    pResult->ulDelivered = ulDelivered;
+    pResult->ulFrames = ulFrames;
+    pResult->dEnergy = BENCH_RFM69_ATC_VOLTAGE * dCurrentSum * dAirtime; // V * mA * ms = uJ
+    pResult->ulSettle = ullLastOut;
+    pResult->ulRecover = ullLastOutAfterStep;
+    pResult->ubConverged = pLink && pLink->ubATCConverged;
+    pResult->ulConvergence = pLink ? pLink->ulATCConvergenceTime : 0;
+
+    return 1;
+}
+
+static uint8_t bench_rfm69_atc_channel(const bench_rfm69_atc_channel_t *pNewChannel)
+{
+    uint8_t ubFailed = 0;
+    bench_rfm69_atc_result_t xATC;
+    bench_rfm69_atc_result_t xFull;
+    uint32_t ulDelivered[2] = {0};
+    uint32_t ulFrames[2] = {0};
+    double dEnergy[2] = {0};
+    double dError = 0;
+    uint32_t ulSettle = 0;
+    uint32_t ulRecover = 0;
+    uint8_t ubConverged = 0;
+    uint32_t ulConvergence = 0;
+
+    pChannel = pNewChannel;
+
+    for(uint8_t i = 0; i < BENCH_RFM69_ATC_SEEDS; i++)
+    {
+        if(!bench_rfm69_atc_run(1 + i, BENCH_RFM69_ATC_TARGET, &xATC) || !bench_rfm69_atc_run(1 + i, 0, &xFull))
+        {
+            printf("  %s: RFM69 not detected\n", pChannel->pszName);
+
+            return 1;
+        }
+
+        ulDelivered[0] += xATC.ulDelivered;
+        ulDelivered[1] += xFull.ulDelivered;
+        ulFrames[0] += xATC.ulFrames;
+        ulFrames[1] += xFull.ulFrames;
+        dEnergy[0] += xATC.dEnergy;
+        dEnergy[1] += xFull.dEnergy;
+        dError += xATC.dError;
+        ubConverged += xATC.ubConverged;
+
+        if(xATC.ubConverged && xATC.ulConvergence > ulConvergence)
+            ulConvergence = xATC.ulConvergence;
+
+        if(xATC.ulSettle > ulSettle)
+            ulSettle = xATC.ulSettle;
+
+        if(xATC.ulRecover > ulRecover)
+            ulRecover = xATC.ulRecover;
+    }
+
+    uint32_t ulOffered = BENCH_RFM69_ATC_SEEDS * BENCH_RFM69_ATC_REPORTS;
+    double dATCEnergy = ulDelivered[0] ? dEnergy[0] / ulDelivered[0] : 0;
+    double dFullEnergy = ulDelivered[1] ? dEnergy[1] / ulDelivered[1] : 0;
+    uint8_t ubStatic = !pChannel->fShadowing && !pChannel->ubRayleigh;
+
+    char pszSettle[16] = "-";
+    char pszRecover[16] = "-";
+
+    // The ideal power follows the mean path loss only, with fading the loop is meant to chase the shadowing instead
+    if(ubStatic)
+        snprintf(pszSettle, sizeof(pszSettle), "%.1f", ulSettle / 1000.0);
+
+    if(ubStatic && pChannel->fStep)
+        snprintf(pszRecover, sizeof(pszRecover), "%.1f", ulRecover / 1000.0);
+
+    printf("%-12s %7.1f %7.1f %7.2f %7.2f %8.1f %8.1f %7s %8s %7.2f %5hhu/%hhu %7.1f\n",
+        pChannel->pszName,
+        100.0 * ulDelivered[0] / ulOffered,
+        100.0 * ulDelivered[1] / ulOffered,
+        (double)ulFrames[0] / ulOffered,
+        (double)ulFrames[1] / ulOffered,
+        dATCEnergy,
+        dFullEnergy,
+        pszSettle,
+        pszRecover,
+        dError / ulOffered,
+        ubConverged, BENCH_RFM69_ATC_SEEDS,
+        ulConvergence / 1000.0);
+
+    // ATC has to save energy on every channel without giving up deliveries, and settle on the ones that hold still
+    if(dATCEnergy >= dFullEnergy)
+    {
+        printf("  %s: ATC costs %.1f uJ per report, full power %.1f uJ\n", pChannel->pszName, dATCEnergy, dFullEnergy);
+
+        ubFailed = 1;
+    }
+
+    if(ulDelivered[0] * 100 < ulDelivered[1] * 98)
+    {
+        printf("  %s: ATC delivered %u reports, full power %u\n", pChannel->pszName, ulDelivered[0], ulDelivered[1]);
+
+        ubFailed = 1;
+    }
+
+    if(ubStatic && pChannel->fLoss == pChannel->fLossEnd && (ubConverged != BENCH_RFM69_ATC_SEEDS || ulSettle > 10000 || ulRecover > 15000))
+    {
+        printf("  %s: settled in %u ms, recovered in %u ms, converged in %hhu of %hhu runs\n", pChannel->pszName, ulSettle, ulRecover, ubConverged, BENCH_RFM69_ATC_SEEDS);
+
+        ubFailed = 1;
+    }
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("%u reports per run, %u runs, target %d dBm, sensitivity %d dBm\n", BENCH_RFM69_ATC_REPORTS, BENCH_RFM69_ATC_SEEDS, BENCH_RFM69_ATC_TARGET, BENCH_RFM69_ATC_SENSITIVITY);
+    printf("%-12s %7s %7s %7s %7s %8s %8s %7s %8s %7s %7s %7s\n", "channel", "dlv %", "full %", "frm/rp", "full", "uJ/dlv", "full", "settle", "recover", "dB err", "conv", "conv s");
+
+    for(uint8_t i = 0; i < sizeof(pChannels) / sizeof(pChannels[0]); i++)
+        ubFailed |= bench_rfm69_atc_channel(&pChannels[i]);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
@@ -0,0 +1,181 @@
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69.h"
+
+// Time rfm69_isr() keeps interrupts masked per received frame against the payload size, from the driver's own DBG_CYCLE_COUNTER() figures
+// Built twice, with the LDMA drain and with RFM69_FIFO_DRAIN_DMA=0 for the byte by byte read it replaced, host ns stand in for DWT cycles
+// Half of the LDMA drains are finished by a register access instead of the LDMA interrupt, that masked time is reported on its own
+
+#define BENCH_RFM69_ISR_NODE_ID     1
+#define BENCH_RFM69_ISR_NET_ID      100
+#define BENCH_RFM69_ISR_PEER_ID     5
+#define BENCH_RFM69_ISR_FRAMES      256
+
+static const uint8_t pubDataSizes[] = {1, 8, 24, 40, RFM69_MAX_DATA_SIZE};
+
+static rfm69_model_t xRadio;
+static uint8_t pubRXData[RFM69_MAX_DATA_SIZE];
+static uint8_t ubRXSize = 0;
+static uint32_t ulRXCallbacks = 0;
+
+static void bench_rfm69_isr_irq(rfm69_model_t *pModel)
+{
+    rfm69_isr();
+}
+static void bench_rfm69_isr_rx_callback(const rfm69_packet_header_t *pHeader, int8_t bRSSI, const uint8_t *pubData, uint8_t ubSize)
+{
+    memcpy(pubRXData, pubData, ubSize);
+
+    ubRXSize = ubSize;
+    ulRXCallbacks++;
+}
+
+static uint8_t bench_rfm69_isr_run(uint8_t ubDataSize)
+{
+    uint8_t pubFrame[RFM69_MAX_PAYLOAD_SIZE];
+    uint8_t pubData[RFM69_MAX_DATA_SIZE];
+    rfm69_isr_stats_t xISRStats;
+    uint64_t ullMaskedSum = 0;
+    uint32_t ulMaskedMax = 0;
+    uint32_t ulInline = 0;
+    uint32_t ulInlineCycles = 0;
+    uint32_t ulInlineMax = 0;
+    uint8_t ubFailed = 0;
+
+    host_trng_seed(7);
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = bench_rfm69_isr_irq;
+
+    ldma_init();
+
+    if(!rfm69_init(BENCH_RFM69_ISR_NODE_ID, BENCH_RFM69_ISR_NET_ID, NULL))
+    {
+        printf("  %hhu bytes: RFM69 not detected\n", ubDataSize);
+
+        return 1;
+    }
+
+    rfm69_set_rx_callback(bench_rfm69_isr_rx_callback);
+    rfm69_tick(); // Into RX
+
+    ulRXCallbacks = 0;
+
+    for(uint16_t i = 0; i < BENCH_RFM69_ISR_FRAMES; i++)
+    {
+        uint16_t usID = i + 1;
+
+        for(uint8_t j = 0; j < ubDataSize; j++)
+            pubData[j] = usID + j;
+
+        // Data frame from the peer, header then data
+        pubFrame[0] = 0x00; // QoS 0, no flags
+        pubFrame[1] = usID & 0xFF;
+        pubFrame[2] = usID >> 8;
+        pubFrame[3] = (uint8_t)-128; // No RSSI report
+        pubFrame[4] = BENCH_RFM69_ISR_NODE_ID;
+        pubFrame[5] = BENCH_RFM69_ISR_PEER_ID;
+
+        memcpy(pubFrame + RFM69_PACKET_HEADER_SIZE, pubData, ubDataSize);
+
+        ldma_host_set_deferred(BIT(RFM69_DMA_RX_CHANNEL) | BIT(RFM69_DMA_TX_CHANNEL));
+
+        if(!rfm69_model_inject(&xRadio, pubFrame, RFM69_PACKET_HEADER_SIZE + ubDataSize, -70))
+        {
+            printf("  %hhu bytes: radio not listening for frame %hu\n", ubDataSize, usID);
+
+            ldma_host_set_deferred(0);
+
+            return 1;
+        }
+
+        rfm69_get_isr_stats(&xISRStats);
+
+        ullMaskedSum += xISRStats.ulLastMaskedCycles;
+
+        if(xISRStats.ulLastMaskedCycles > ulMaskedMax)
+            ulMaskedMax = xISRStats.ulLastMaskedCycles;
+
+        uint32_t ulInlineBefore = xISRStats.ulInlineFinishCycles;
+        uint32_t ulCallbacks = ulRXCallbacks;
+
+        if(i & 1)
+            ldma_host_step(RFM69_MAX_PAYLOAD_SIZE * 2); // Completion interrupt finishes it
+        else
+            rfm69_tick(); // First register access finishes it on the spot, a no-op without a drain
+
+        ldma_host_set_deferred(0);
+
+        rfm69_get_isr_stats(&xISRStats);
+
+        if(xISRStats.ulInlineFinishCycles - ulInlineBefore > ulInlineMax)
+            ulInlineMax = xISRStats.ulInlineFinishCycles - ulInlineBefore;
+
+        ulInlineCycles += xISRStats.ulInlineFinishCycles - ulInlineBefore;
+
+        rfm69_tick(); // Delivers it, if the inline finish did not already
+
+        if(ulRXCallbacks != ulCallbacks + 1 || ubRXSize != ubDataSize || memcmp(pubRXData, pubData, ubDataSize))
+        {
+            printf("  %hhu bytes: frame %hu not delivered intact\n", ubDataSize, usID);
+
+            ubFailed = 1;
+
+            break;
+        }
+    }
+
+    rfm69_get_isr_stats(&xISRStats);
+
+    ulInline = xISRStats.ulInlineFinishes;
+
+    if(xISRStats.ulDrains != BENCH_RFM69_ISR_FRAMES || xISRStats.ulDrainErrors || xISRStats.ulDrainedBytes != (uint32_t)BENCH_RFM69_ISR_FRAMES * (RFM69_PACKET_HEADER_SIZE + ubDataSize))
+    {
+        printf("  %hhu bytes: %u drains, %u bytes, %u errors\n", ubDataSize, xISRStats.ulDrains, xISRStats.ulDrainedBytes, xISRStats.ulDrainErrors);
+
+        ubFailed = 1;
+    }
+
+    // The LDMA drain leaves every other frame to a register access, the byte by byte read never has one pending
+    if(ulInline != (RFM69_FIFO_DRAIN_DMA ? BENCH_RFM69_ISR_FRAMES / 2 : 0))
+    {
+        printf("  %hhu bytes: %u inline finishes\n", ubDataSize, ulInline);
+
+        ubFailed = 1;
+    }
+
+    if(xISRStats.ulMaxMaskedCycles < ulMaskedMax || xISRStats.ulMaxMaskedCycles < ulInlineMax)
+    {
+        printf("  %hhu bytes: max masked %u cycles below the ISR %u or inline %u\n", ubDataSize, xISRStats.ulMaxMaskedCycles, ulMaskedMax, ulInlineMax);
+
+        ubFailed = 1;
+    }
+
+    printf("%7hhu %6u %9.0f %9u %7u %9.0f %9u\n",
+        RFM69_PACKET_HEADER_SIZE + ubDataSize,
+        BENCH_RFM69_ISR_FRAMES,
+        (double)ullMaskedSum / BENCH_RFM69_ISR_FRAMES,
+        ulMaskedMax,
+        ulInline,
+        ulInline ? (double)ulInlineCycles / ulInline : 0,
+        ulInlineMax);
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("FIFO drain: %s, masked times in host ns\n", RFM69_FIFO_DRAIN_DMA ? "LDMA" : "byte by byte inside rfm69_isr()");
+    printf("%7s %6s %9s %9s %7s %9s %9s\n", "payload", "frames", "ISR avg", "ISR max", "inline", "inl avg", "inl max");
+
+    for(uint8_t i = 0; i < sizeof(pubDataSizes); i++)
+        ubFailed |= bench_rfm69_isr_run(pubDataSizes[i]);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
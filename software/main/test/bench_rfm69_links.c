@@ -0,0 +1,209 @@
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69.h"
+
+// Link table footprint and rfm69_find_link() cost against the number of nodes, records created through rfm69_set_atc_target_rssi() in random node ID order
+// Hits and misses are timed separately, next to a direct index into a 256 entry array like the per-node arrays the table replaced
+// Checks the table stays sorted, holds exactly the nodes added and is sized in steps of RFM69_LINK_TABLE_GROWTH
+
+#define BENCH_RFM69_LINKS_FIRST_ID      2       // Node 1 is the driver itself
+#define BENCH_RFM69_LINKS_LAST_ID       254
+#define BENCH_RFM69_LINKS_ID_COUNT      (BENCH_RFM69_LINKS_LAST_ID - BENCH_RFM69_LINKS_FIRST_ID + 1)
+#define BENCH_RFM69_LINKS_KEYS          4096    // Must be a power of 2
+#define BENCH_RFM69_LINKS_LOOKUPS       (1 << 22)
+#define BENCH_RFM69_LINKS_OLD_FIELDS    4       // ATC power, ATC target, remote RSSI, last RSSI, one byte per node each
+
+static const uint16_t pusNodes[] = {1, 4, 16, 64, 128, BENCH_RFM69_LINKS_ID_COUNT};
+
+static rfm69_model_t xRadio;
+static uint32_t ulRandom = 0x2545F491;
+static uint8_t pubIDs[BENCH_RFM69_LINKS_ID_COUNT];
+static uint8_t pubHits[BENCH_RFM69_LINKS_KEYS];
+static uint8_t pubMisses[BENCH_RFM69_LINKS_KEYS];
+static int8_t pbDirect[256];
+static volatile int32_t lSink;
+
+static void bench_rfm69_links_irq(rfm69_model_t *pModel)
+{
+    rfm69_isr();
+}
+static uint32_t bench_rfm69_links_random()
+{
+    ulRandom ^= ulRandom << 13;
+    ulRandom ^= ulRandom >> 17;
+    ulRandom ^= ulRandom << 5;
+
+    return ulRandom;
+}
+static double bench_rfm69_links_time_find(const uint8_t *pubKeys)
+{
+    int32_t lSum = 0;
+    uint64_t ullStart = host_time_ns();
+
+    for(uint32_t i = 0; i < BENCH_RFM69_LINKS_LOOKUPS; i++)
+    {
+        const rfm69_link_t *pLink = rfm69_find_link(pubKeys[i & (BENCH_RFM69_LINKS_KEYS - 1)]);
+
+        lSum += pLink ? pLink->bPowerLevel : 1;
+    }
+
+    uint64_t ullTime = host_time_ns() - ullStart;
+
+    lSink = lSum;
+
+    return (double)ullTime / BENCH_RFM69_LINKS_LOOKUPS;
+}
+static double bench_rfm69_links_time_direct(const uint8_t *pubKeys)
+{
+    int32_t lSum = 0;
+    uint64_t ullStart = host_time_ns();
+
+    for(uint32_t i = 0; i < BENCH_RFM69_LINKS_LOOKUPS; i++)
+        lSum += ((volatile int8_t *)pbDirect)[pubKeys[i & (BENCH_RFM69_LINKS_KEYS - 1)]];
+
+    uint64_t ullTime = host_time_ns() - ullStart;
+
+    lSink = lSum;
+
+    return (double)ullTime / BENCH_RFM69_LINKS_LOOKUPS;
+}
+
+static uint8_t bench_rfm69_links_run(uint16_t usNodes)
+{
+    uint8_t ubFailed = 0;
+
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = bench_rfm69_links_irq;
+
+    ldma_init();
+
+    if(!rfm69_init(1, 100, NULL))
+    {
+        printf("  %hu nodes: RFM69 not detected\n", usNodes);
+
+        return 1;
+    }
+
+    // Shuffle every candidate, the first usNodes are added and the rest are the misses
+    for(uint16_t i = 0; i < BENCH_RFM69_LINKS_ID_COUNT; i++)
+        pubIDs[i] = BENCH_RFM69_LINKS_FIRST_ID + i;
+
+    for(uint16_t i = BENCH_RFM69_LINKS_ID_COUNT - 1; i > 0; i--)
+    {
+        uint16_t j = bench_rfm69_links_random() % (i + 1);
+        uint8_t ubID = pubIDs[i];
+
+        pubIDs[i] = pubIDs[j];
+        pubIDs[j] = ubID;
+    }
+
+    uint64_t ullStart = host_time_ns();
+
+    for(uint16_t i = 0; i < usNodes; i++)
+        rfm69_set_atc_target_rssi(pubIDs[i], -80);
+
+    double dInsert = (double)(host_time_ns() - ullStart) / usNodes;
+
+    uint16_t usMisses = BENCH_RFM69_LINKS_ID_COUNT - usNodes;
+
+    for(uint16_t i = 0; i < BENCH_RFM69_LINKS_KEYS; i++)
+    {
+        pubHits[i] = pubIDs[bench_rfm69_links_random() % usNodes];
+        pubMisses[i] = usMisses ? pubIDs[usNodes + bench_rfm69_links_random() % usMisses] : 0; // Node 0 is never added
+    }
+
+    // Contents
+    if(rfm69_get_link_count() != usNodes)
+    {
+        printf("  %hu nodes: table holds %hu\n", usNodes, rfm69_get_link_count());
+
+        ubFailed = 1;
+    }
+
+    for(uint16_t i = 1; i < rfm69_get_link_count(); i++)
+    {
+        if(rfm69_get_link(i - 1)->ubNodeID >= rfm69_get_link(i)->ubNodeID)
+        {
+            printf("  %hu nodes: records %hu and %hu out of order\n", usNodes, i - 1, i);
+
+            ubFailed = 1;
+
+            break;
+        }
+    }
+
+    if(rfm69_get_link(usNodes))
+    {
+        printf("  %hu nodes: record past the end\n", usNodes);
+
+        ubFailed = 1;
+    }
+
+    for(uint16_t i = 0; i < BENCH_RFM69_LINKS_ID_COUNT; i++)
+    {
+        const rfm69_link_t *pLink = rfm69_find_link(pubIDs[i]);
+
+        if(i < usNodes && (!pLink || pLink->ubNodeID != pubIDs[i] || pLink->bTargetRSSI != -80))
+        {
+            printf("  %hu nodes: node %hhu not found\n", usNodes, pubIDs[i]);
+
+            ubFailed = 1;
+
+            break;
+        }
+
+        if(i >= usNodes && pLink)
+        {
+            printf("  %hu nodes: node %hhu found but never added\n", usNodes, pubIDs[i]);
+
+            ubFailed = 1;
+
+            break;
+        }
+    }
+
+    uint32_t ulSize = rfm69_get_link_table_size();
+    uint32_t ulExpected = (usNodes + RFM69_LINK_TABLE_GROWTH - 1) / RFM69_LINK_TABLE_GROWTH * RFM69_LINK_TABLE_GROWTH * sizeof(rfm69_link_t);
+
+    if(ulSize != ulExpected)
+    {
+        printf("  %hu nodes: table is %u bytes, expected %u\n", usNodes, ulSize, ulExpected);
+
+        ubFailed = 1;
+    }
+
+    // Lookups
+    double dHit = bench_rfm69_links_time_find(pubHits);
+    double dMiss = usMisses ? bench_rfm69_links_time_find(pubMisses) : 0;
+    double dDirect = bench_rfm69_links_time_direct(pubHits);
+
+    printf("%5hu %7u %6.1f %8u %9.1f %9.1f %9.1f %9.1f\n",
+        usNodes,
+        ulSize,
+        (double)ulSize / usNodes,
+        BENCH_RFM69_LINKS_OLD_FIELDS * 256,
+        dInsert,
+        dHit,
+        dMiss,
+        dDirect);
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("Record is %u bytes, the per-node arrays held %u bytes per node for every node ID\n", (uint32_t)sizeof(rfm69_link_t), BENCH_RFM69_LINKS_OLD_FIELDS);
+    printf("%5s %7s %6s %8s %9s %9s %9s %9s\n", "nodes", "bytes", "B/node", "old B", "ns insert", "ns hit", "ns miss", "ns direct");
+
+    for(uint8_t i = 0; i < sizeof(pusNodes) / sizeof(pusNodes[0]); i++)
+        ubFailed |= bench_rfm69_links_run(pusNodes[i]);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
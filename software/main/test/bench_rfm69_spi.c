@@ -0,0 +1,307 @@
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69_peer.h"
+#include "rfm69.h"
+
+// SPI transactions per driver operation, counted on the register model's bus and by the driver itself, the two have to agree
+// The operations run in table order on one radio, so each starts from the register state the previous one left, repeats show what the shadow saves
+// Budgets are today's counts, a change that costs an operation more transactions has to raise its budget on purpose
+
+#define BENCH_RFM69_SPI_NODE_ID     1
+#define BENCH_RFM69_SPI_NET_ID      100
+#define BENCH_RFM69_SPI_PEER_ID     2
+#define BENCH_RFM69_SPI_CARRIER     868000000   // Hz
+#define BENCH_RFM69_SPI_FRAME_TIME  200         // ms - Ticks given to a frame going out or coming in
+
+typedef struct bench_rfm69_spi_op_t bench_rfm69_spi_op_t;
+
+struct bench_rfm69_spi_op_t
+{
+    const char *pszName;
+    void (* pfRun)();
+    uint32_t ulBudget; // Transactions
+};
+
+static const uint8_t pubKey[16] = {0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x87, 0x98, 0xA9, 0xBA, 0xCB, 0xDC, 0xED, 0xFE, 0x0F};
+
+static rfm69_model_t xRadio;
+static rfm69_peer_t xPeer;
+static volatile uint32_t ulSink;
+static uint32_t ulReceived = 0;
+static const char *pszOpProblem; // Set by an operation that did not do what it was measured for
+
+static void bench_rfm69_spi_irq(rfm69_model_t *pModel)
+{
+    rfm69_isr();
+}
+static void bench_rfm69_spi_rx_callback(const rfm69_packet_header_t *pHeader, int8_t bRSSI, const uint8_t *pubData, uint8_t ubSize)
+{
+    ulReceived++;
+}
+static void bench_rfm69_spi_ticks(uint16_t usTicks)
+{
+    for(uint16_t i = 0; i < usTicks; i++)
+    {
+        host_advance(1);
+        rfm69_tick();
+    }
+}
+
+static void bench_rfm69_spi_init()
+{
+    if(!rfm69_init(BENCH_RFM69_SPI_NODE_ID, BENCH_RFM69_SPI_NET_ID, NULL))
+        pszOpProblem = "RFM69 not detected";
+
+    rfm69_set_rx_callback(bench_rfm69_spi_rx_callback);
+}
+static void bench_rfm69_spi_init_key()
+{
+    if(!rfm69_init(BENCH_RFM69_SPI_NODE_ID, BENCH_RFM69_SPI_NET_ID, pubKey))
+        pszOpProblem = "RFM69 not detected";
+}
+static void bench_rfm69_spi_rx_entry()
+{
+    rfm69_set_mode(RFM69_REG_OPMODE_RECEIVER);
+}
+static void bench_rfm69_spi_standby()
+{
+    rfm69_set_mode(RFM69_REG_OPMODE_STANDBY);
+}
+static void bench_rfm69_spi_profile_55k5()
+{
+    rfm69_set_modem_profile(RFM69_MODEM_PROFILE_55K5);
+}
+static void bench_rfm69_spi_profile_25k()
+{
+    rfm69_set_modem_profile(RFM69_MODEM_PROFILE_25K);
+}
+static void bench_rfm69_spi_profile_4k8()
+{
+    rfm69_set_modem_profile(RFM69_MODEM_PROFILE_4K8);
+}
+static void bench_rfm69_spi_set_bit_rate()
+{
+    rfm69_set_bit_rate(38400);
+}
+static void bench_rfm69_spi_get_bit_rate()
+{
+    ulSink = rfm69_get_bit_rate();
+}
+static void bench_rfm69_spi_set_deviation()
+{
+    rfm69_set_deviation(35000);
+}
+static void bench_rfm69_spi_set_carrier()
+{
+    rfm69_set_carrier(BENCH_RFM69_SPI_CARRIER);
+}
+static void bench_rfm69_spi_set_carrier_next()
+{
+    rfm69_set_carrier(BENCH_RFM69_SPI_CARRIER + 200000);
+}
+static void bench_rfm69_spi_get_carrier()
+{
+    ulSink = rfm69_get_carrier();
+}
+static void bench_rfm69_spi_set_network_id()
+{
+    rfm69_set_network_id(BENCH_RFM69_SPI_NET_ID + 1);
+}
+static void bench_rfm69_spi_set_aes_key()
+{
+    rfm69_set_aes_key(pubKey);
+}
+static void bench_rfm69_spi_clear_aes_key()
+{
+    rfm69_set_aes_key(NULL);
+}
+static void bench_rfm69_spi_set_power_low()
+{
+    rfm69_set_power_level(5);
+}
+static void bench_rfm69_spi_set_power_high()
+{
+    rfm69_set_power_level(RFM69_MAXIMUM_TX_POWER);
+}
+static void bench_rfm69_spi_listen_mode()
+{
+    rfm69_listen_mode();
+}
+static void bench_rfm69_spi_read_rssi()
+{
+    ulSink = rfm69_read_rssi();
+}
+static void bench_rfm69_spi_read_temperature()
+{
+    ulSink = rfm69_read_temperature(0);
+}
+static void bench_rfm69_spi_idle()
+{
+    bench_rfm69_spi_ticks(BENCH_RFM69_SPI_FRAME_TIME);
+}
+static void bench_rfm69_spi_tx_frame()
+{
+    uint8_t pubData[16];
+
+    uint32_t ulHeard = xPeer.xStats.ulFramesHeard;
+
+    memset(pubData, 0x5A, sizeof(pubData));
+
+    rfm69_send(BENCH_RFM69_SPI_PEER_ID, pubData, sizeof(pubData), 0, 0, 0);
+
+    bench_rfm69_spi_ticks(BENCH_RFM69_SPI_FRAME_TIME);
+
+    if(xPeer.xStats.ulFramesHeard != ulHeard + 1)
+        pszOpProblem = "frame not heard by the peer";
+}
+static void bench_rfm69_spi_rx_frame()
+{
+    uint8_t pubData[16];
+
+    uint32_t ulBefore = ulReceived;
+
+    memset(pubData, 0xA5, sizeof(pubData));
+
+    rfm69_peer_send_data(&xPeer, BENCH_RFM69_SPI_NODE_ID, pubData, sizeof(pubData));
+
+    bench_rfm69_spi_ticks(BENCH_RFM69_SPI_FRAME_TIME);
+
+    if(ulReceived != ulBefore + 1)
+        pszOpProblem = "frame not delivered";
+}
+
+static const bench_rfm69_spi_op_t pOps[] = {
+    {"init", bench_rfm69_spi_init, 17},
+    {"rx entry", bench_rfm69_spi_rx_entry, 3},
+    {"rx entry again", bench_rfm69_spi_rx_entry, 0},
+    {"standby", bench_rfm69_spi_standby, 1},
+    {"profile 55k5", bench_rfm69_spi_profile_55k5, 5},
+    {"profile 25k", bench_rfm69_spi_profile_25k, 5},
+    {"profile 25k again", bench_rfm69_spi_profile_25k, 1},
+    {"profile 4k8", bench_rfm69_spi_profile_4k8, 5},
+    {"set_bit_rate", bench_rfm69_spi_set_bit_rate, 1},
+    {"set_bit_rate again", bench_rfm69_spi_set_bit_rate, 0},
+    {"get_bit_rate", bench_rfm69_spi_get_bit_rate, 0},
+    {"set_deviation", bench_rfm69_spi_set_deviation, 4},
+    {"set_carrier", bench_rfm69_spi_set_carrier_next, 3},
+    {"set_carrier back", bench_rfm69_spi_set_carrier, 4},
+    {"set_carrier again", bench_rfm69_spi_set_carrier, 3},
+    {"get_carrier", bench_rfm69_spi_get_carrier, 0},
+    {"set_network_id", bench_rfm69_spi_set_network_id, 1},
+    {"set_network_id again", bench_rfm69_spi_set_network_id, 0},
+    {"set_aes_key", bench_rfm69_spi_set_aes_key, 2},
+    {"clear_aes_key", bench_rfm69_spi_clear_aes_key, 1},
+    {"set_power_level 5", bench_rfm69_spi_set_power_low, 1},
+    {"set_power_level 20", bench_rfm69_spi_set_power_high, 3},
+    {"set_power_level again", bench_rfm69_spi_set_power_high, 0},
+    {"listen_mode", bench_rfm69_spi_listen_mode, 2},
+    {"leave listen (rmw)", bench_rfm69_spi_standby, 5},
+    {"read_rssi", bench_rfm69_spi_read_rssi, 1},
+    {"read_temperature", bench_rfm69_spi_read_temperature, 3},
+    {"profile 25k restore", bench_rfm69_spi_profile_25k, 5},
+    {"idle 200 ms", bench_rfm69_spi_idle, 1},
+    {"tx frame", bench_rfm69_spi_tx_frame, 16},
+    {"rx frame", bench_rfm69_spi_rx_frame, 5},
+    {"init with key", bench_rfm69_spi_init_key, 18},
+};
+
+static uint8_t bench_rfm69_spi_check_shadow(const char *pszName)
+{
+    // The getters read through the shadow, it has to agree with what the model holds
+    const uint8_t *pubRegisters = xRadio.pubRegisters;
+    uint32_t ulCarrier = (uint32_t)((((uint32_t)pubRegisters[RFM69_REG_FRFMSB] << 16) | ((uint32_t)pubRegisters[RFM69_REG_FRFMID] << 8) | pubRegisters[RFM69_REG_FRFLSB]) * 61.03515625);
+    uint32_t ulDeviation = (uint32_t)((((uint32_t)pubRegisters[RFM69_REG_FDEVMSB] << 8) | pubRegisters[RFM69_REG_FDEVLSB]) * 61.03515625);
+    uint32_t ulBitRate = (uint32_t)(32000000.f / (((uint32_t)pubRegisters[RFM69_REG_BITRATEMSB] << 8) | pubRegisters[RFM69_REG_BITRATELSB]));
+
+    if(rfm69_get_carrier() != ulCarrier || rfm69_get_deviation() != ulDeviation || rfm69_get_bit_rate() != ulBitRate)
+    {
+        printf("  %s: driver reads %u Hz, %u Hz, %u bps, the radio holds %u Hz, %u Hz, %u bps\n", pszName, rfm69_get_carrier(), rfm69_get_deviation(), rfm69_get_bit_rate(), ulCarrier, ulDeviation, ulBitRate);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    host_trng_seed(1);
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = bench_rfm69_spi_irq;
+
+    rfm69_peer_attach(&xRadio);
+    rfm69_peer_init(&xPeer, BENCH_RFM69_SPI_PEER_ID, 1);
+
+    ldma_init();
+
+    printf("%-22s %6s %6s %6s %6s %6s %6s\n", "operation", "trans", "bytes", "driver", "hits", "elided", "budget");
+
+    for(uint8_t i = 0; i < sizeof(pOps) / sizeof(pOps[0]); i++)
+    {
+        const bench_rfm69_spi_op_t *pOp = &pOps[i];
+        rfm69_spi_stats_t xBefore;
+        rfm69_spi_stats_t xAfter;
+
+        rfm69_get_spi_stats(&xBefore);
+
+        uint32_t ulTransactions = xRadio.xStats.ulTransactions;
+        uint32_t ulBytes = xRadio.xStats.ulBytes;
+
+        pszOpProblem = NULL;
+
+        pOp->pfRun();
+
+        rfm69_get_spi_stats(&xAfter);
+
+        ulTransactions = xRadio.xStats.ulTransactions - ulTransactions;
+        ulBytes = xRadio.xStats.ulBytes - ulBytes;
+
+        // rfm69_init() starts the driver counters over
+        if(pOp->pfRun == bench_rfm69_spi_init || pOp->pfRun == bench_rfm69_spi_init_key)
+            memset(&xBefore, 0, sizeof(rfm69_spi_stats_t));
+
+        uint32_t ulDriverTransactions = xAfter.ulTransactions - xBefore.ulTransactions;
+        uint32_t ulDriverBytes = xAfter.ulBytes - xBefore.ulBytes;
+
+        printf("%-22s %6u %6u %6u %6u %6u %6u\n",
+            pOp->pszName,
+            ulTransactions,
+            ulBytes,
+            ulDriverTransactions,
+            xAfter.ulShadowHits - xBefore.ulShadowHits,
+            xAfter.ulElidedWrites - xBefore.ulElidedWrites,
+            pOp->ulBudget);
+
+        if(pszOpProblem)
+        {
+            printf("  %s: %s\n", pOp->pszName, pszOpProblem);
+
+            ubFailed = 1;
+        }
+
+        if(ulDriverTransactions != ulTransactions || ulDriverBytes != ulBytes)
+        {
+            printf("  %s: driver counted %u transactions and %u bytes, the bus saw %u and %u\n", pOp->pszName, ulDriverTransactions, ulDriverBytes, ulTransactions, ulBytes);
+
+            ubFailed = 1;
+        }
+
+        if(ulTransactions > pOp->ulBudget)
+        {
+            printf("  %s: %u transactions, budget %u\n", pOp->pszName, ulTransactions, pOp->ulBudget);
+
+            ubFailed = 1;
+        }
+
+        ubFailed |= bench_rfm69_spi_check_shadow(pOp->pszName);
+    }
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
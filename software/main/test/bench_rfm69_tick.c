@@ -0,0 +1,146 @@
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69.h"
+
+// Cost of an idle rfm69_tick() against the number of outstanding QoS exchanges
+// Packets go to nodes that never answer, with a retry delay long enough that nothing comes due while measuring, so the figure is what the main loop pays every time it wakes up
+// Built with RFM69_PENDING_SLAB_SIZE raised to 1024, the firmware keeps 64
+
+#define BENCH_RFM69_TICK_RETRY_DELAY    60000   // ms
+#define BENCH_RFM69_TICK_RETRIES        3
+#define BENCH_RFM69_TICK_SEND_TIMEOUT   120000  // ms - To get every first transmission out
+#define BENCH_RFM69_TICK_WINDOW         4000    // ms - Ticks averaged, starts after the last first transmission
+#define BENCH_RFM69_TICK_PAYLOAD        8
+
+static const uint16_t pusOutstanding[] = {10, 100, 1000};
+
+static rfm69_model_t xRadio;
+
+static void bench_rfm69_tick_irq(rfm69_model_t *pModel)
+{
+    rfm69_isr();
+}
+
+static uint8_t bench_rfm69_tick_run(uint16_t usOutstanding)
+{
+    uint8_t pubPayload[BENCH_RFM69_TICK_PAYLOAD];
+    rfm69_pending_stats_t xPendingStats;
+    rfm69_tx_stats_t xTXStats;
+
+    host_trng_seed(usOutstanding);
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = bench_rfm69_tick_irq;
+
+    ldma_init();
+
+    if(!rfm69_init(1, 100, NULL))
+    {
+        printf("  %hu: RFM69 not detected\n", usOutstanding);
+
+        return 1;
+    }
+
+    rfm69_set_aggregation_latency(0); // One exchange per packet
+    rfm69_set_modem_profile(RFM69_MODEM_PROFILE_55K5); // Gets the first transmissions out sooner
+
+    for(uint16_t i = 0; i < usOutstanding; i++)
+    {
+        memset(pubPayload, i, sizeof(pubPayload));
+
+        if(!rfm69_send(2 + i % 200, pubPayload, sizeof(pubPayload), 1, BENCH_RFM69_TICK_RETRY_DELAY, BENCH_RFM69_TICK_RETRIES))
+        {
+            printf("  %hu: send %hu refused\n", usOutstanding, i);
+
+            return 1;
+        }
+    }
+
+    // Let every packet go out once, they then all sit in the timer wheel waiting for an ACK
+    uint64_t ullStart = g_ullSystemTick;
+
+    do
+    {
+        host_advance(1);
+        rfm69_tick();
+
+        rfm69_get_tx_stats(&xTXStats);
+    } while(xTXStats.ulFrames < usOutstanding && g_ullSystemTick - ullStart < BENCH_RFM69_TICK_SEND_TIMEOUT);
+
+    if(xTXStats.ulFrames < usOutstanding)
+    {
+        printf("  %hu: only %u first transmissions after %u ms\n", usOutstanding, xTXStats.ulFrames, BENCH_RFM69_TICK_SEND_TIMEOUT);
+
+        return 1;
+    }
+
+    uint64_t ullSendTime = g_ullSystemTick - ullStart;
+
+    for(uint8_t i = 0; i < 50; i++) // Last PacketSent and the bookkeeping behind it
+    {
+        host_advance(1);
+        rfm69_tick();
+    }
+
+    rfm69_get_pending_stats(&xPendingStats);
+
+    uint32_t ulExpirations = xPendingStats.ulTimerExpirations;
+    uint32_t ulCascades = xPendingStats.ulTimerCascades;
+    uint64_t ullTotal = 0;
+    uint64_t ullMax = 0;
+
+    for(uint32_t i = 0; i < BENCH_RFM69_TICK_WINDOW; i++)
+    {
+        host_advance(1);
+
+        uint64_t ullTickStart = host_time_ns();
+
+        rfm69_tick();
+
+        uint64_t ullTime = host_time_ns() - ullTickStart;
+
+        ullTotal += ullTime;
+
+        if(ullTime > ullMax)
+            ullMax = ullTime;
+    }
+
+    uint8_t ubFailed = 0;
+
+    rfm69_get_pending_stats(&xPendingStats);
+    rfm69_get_tx_stats(&xTXStats);
+
+    if(xPendingStats.usUsed != usOutstanding || xPendingStats.ulAllocFailures)
+    {
+        printf("  %hu: %hu exchanges outstanding, %u allocation failures\n", usOutstanding, xPendingStats.usUsed, xPendingStats.ulAllocFailures);
+
+        ubFailed = 1;
+    }
+
+    if(xPendingStats.ulTimerExpirations != ulExpirations)
+    {
+        printf("  %hu: %u retransmissions came due while measuring\n", usOutstanding, xPendingStats.ulTimerExpirations - ulExpirations);
+
+        ubFailed = 1;
+    }
+
+    printf("%11hu %9llu %10.1f %9llu %9u %11u\n", usOutstanding, (unsigned long long)ullSendTime, (double)ullTotal / BENCH_RFM69_TICK_WINDOW, (unsigned long long)ullMax, xPendingStats.ulTimerCascades - ulCascades, rfm69_get_next_deadline());
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("%11s %9s %10s %9s %9s %11s\n", "outstanding", "send ms", "ns/tick", "max ns", "cascades", "deadline ms");
+
+    for(uint8_t i = 0; i < sizeof(pusOutstanding) / sizeof(pusOutstanding[0]); i++)
+        ubFailed |= bench_rfm69_tick_run(pusOutstanding[i]);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
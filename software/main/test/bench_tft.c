@@ -0,0 +1,777 @@
+#include <math.h>
+#include "host.h"
+#include "ili9488_model.h"
+#include "tft.h"
+
+// Replays the screens of the gateway UI against the ILI9488 model
+// Every screen is drawn once immediately and once composited, both must leave the same picture on the panel and compositing may never send more bytes
+// Bus figures come from the driver and from what the model decoded, wall time is host time and only meaningful relative to other runs
+
+#define BENCH_TFT_SPI_CLOCK     18000000UL // USART1 bit rate on the gateway
+#define BENCH_TFT_CHART_SAMPLES 600
+#define BENCH_TFT_TERM_LINES    40
+#define BENCH_TFT_CHART_APPENDS 9 // Two full columns and one sample into the next one
+#define BENCH_TFT_SCROLL_LINES  3 // Appended to the shown terminal, scrolled in with the scroll start register
+
+#define BENCH_TFT_SCREENS       6
+
+#define BENCH_TFT_PRIM_LINE     0
+#define BENCH_TFT_PRIM_CIRCLE   1
+#define BENCH_TFT_PRIM_TRIANGLE 2
+#define BENCH_TFT_PRIM_THICK    3
+#define BENCH_TFT_PRIM_ROUNDED  4
+
+typedef struct bench_tft_primitive_t bench_tft_primitive_t;
+typedef struct bench_tft_image_t bench_tft_image_t;
+
+struct bench_tft_primitive_t
+{
+    const char *pszName;
+    uint8_t ubType;
+    uint16_t pusArgs[6]; // Coordinates, then radius or thickness where the primitive takes one
+    uint8_t ubFill;
+};
+struct bench_tft_image_t
+{
+    const char *pszName;
+    const image_t *pImage; // QOI565
+    const image_t *pRawImage; // Same pixels converted with --raw from the same PNG
+    uint16_t usX;
+    uint16_t usY;
+};
+
+extern const image_t xPatrickRawImage;
+extern const image_t xSurpriseRawImage;
+
+static const char * const pszScreenName[] = {"image", "graph", "terminal", "textbox", "blank", "glyphs"};
+
+static const bench_tft_primitive_t pPrimitives[] = {
+    {"line",      BENCH_TFT_PRIM_LINE,     {10, 20, 300, 140}, 0},
+    {"line-stp",  BENCH_TFT_PRIM_LINE,     {300, 30, 40, 460}, 0},
+    {"circle",    BENCH_TFT_PRIM_CIRCLE,   {160, 240, 100}, 0},
+    {"circle-f",  BENCH_TFT_PRIM_CIRCLE,   {160, 240, 100}, 1},
+    {"circle-c",  BENCH_TFT_PRIM_CIRCLE,   {12, 465, 40}, 1}, // Clipped on two sides
+    {"triangle",  BENCH_TFT_PRIM_TRIANGLE, {20, 400, 160, 30, 300, 350}, 0},
+    {"tri-f",     BENCH_TFT_PRIM_TRIANGLE, {20, 400, 160, 30, 300, 350}, 1},
+    {"thick",     BENCH_TFT_PRIM_THICK,    {30, 50, 290, 420, 9}, 0},
+    {"rounded",   BENCH_TFT_PRIM_ROUNDED,  {20, 60, 300, 400, 24}, 0},
+    {"rounded-f", BENCH_TFT_PRIM_ROUNDED,  {20, 60, 300, 400, 24}, 1},
+};
+
+static const bench_tft_image_t pImages[] = {
+    {"patrick",  &xPatrickImage,  &xPatrickRawImage,  70, 150},
+    {"surprise", &xSurpriseImage, &xSurpriseRawImage, 0, 0},
+};
+
+static tft_chart_t *pChart = NULL;
+static tft_terminal_t *pTerminal = NULL;
+static tft_textbox_t *pTextbox = NULL;
+static tft_button_t *pButtons[5];
+static uint8_t ubScreenNum = 4;
+static uint8_t pubImmediate[ILI9488_TFTWIDTH * ILI9488_TFTHEIGHT * 3];
+static uint8_t pubComposited[ILI9488_TFTWIDTH * ILI9488_TFTHEIGHT * 3];
+static uint8_t pubReference[ILI9488_TFTWIDTH * ILI9488_TFTHEIGHT]; // Pixels set by the reference renderer
+
+static void bench_tft_draw_buttons()
+{
+    tft_button_draw(pButtons[0], "img", &xSans9pFont, RGB565_CYAN, RGB565_BLACK);
+    tft_button_draw(pButtons[1], "grph", &xSans9pFont, RGB565_CYAN, RGB565_BLACK);
+    tft_button_draw(pButtons[2], "trm", &xSans9pFont, RGB565_CYAN, RGB565_BLACK);
+    tft_button_draw(pButtons[3], "txt", &xSans9pFont, RGB565_CYAN, RGB565_BLACK);
+    tft_button_draw(pButtons[4], "blnk", &xSans9pFont, RGB565_CYAN, RGB565_BLACK);
+}
+// Same drawing as touch_button_callback in main.c, without the "already shown" check
+static void bench_tft_draw_screen(uint8_t ubScreen, uint8_t ubComposited)
+{
+    if(ubScreenNum == 2 && ubScreen != 2)
+        tft_terminal_hide(pTerminal);
+
+    ubScreenNum = ubScreen;
+
+    if(ubComposited)
+        tft_frame_begin();
+
+    switch(ubScreen)
+    {
+        case 0: // image
+        {
+            tft_fill_screen(RGB565_WHITE);
+
+            for(uint8_t x = 0; x < 4; x++)
+                for(uint8_t y = 0; y < 6; y++)
+                    tft_draw_image(&xPepeImage, 32 + (x * 64), 32 + (y * 64));
+        }
+        break;
+        case 1: // graph
+        {
+            tft_fill_screen(RGB565_DARKGREY);
+            tft_printf(&xSans9pFont, 20, 10, RGB565_YELLOW, RGB565_DARKGREY, "15-35 C");
+            tft_printf(&xSans9pFont, 110, 10, RGB565_CYAN, RGB565_DARKGREY, "0-100 %%RH");
+            tft_printf(&xSans9pFont, 205, 10, RGB565_MAGENTA, RGB565_DARKGREY, "950-1050 hPa");
+            tft_chart_draw(pChart);
+        }
+        break;
+        case 2: // terminal
+        {
+            tft_fill_screen(RGB565_BLACK);
+            tft_terminal_update(pTerminal);
+        }
+        break;
+        case 3: // text box
+        {
+            tft_fill_screen(RGB565_WHITE);
+            tft_draw_rectangle(10, 65, 295 + 15 + 5, 75 + tft_get_text_height(&xSans9pFont, 6), RGB565_DARKGREEN, 1);
+            tft_textbox_clear(pTextbox);
+            tft_printf(&xSans18pFont, 10, 10, RGB565_DARKGREY, RGB565_WHITE, "Display is the wey");
+            tft_textbox_goto(pTextbox, 0, 0, 1);
+            tft_textbox_set_color(pTextbox, RGB565_BLUE, RGB565_WHITE);
+            tft_textbox_printf(pTextbox, "ADC Temp: ");
+            tft_textbox_set_color(pTextbox, RGB565_RED, RGB565_WHITE);
+            tft_textbox_printf(pTextbox, "%.2f\n\r", 23.5f);
+            tft_textbox_set_color(pTextbox, RGB565_BLUE, RGB565_WHITE);
+            tft_textbox_printf(pTextbox, "RTCC Time: ");
+            tft_textbox_set_color(pTextbox, RGB565_RED, RGB565_WHITE);
+            tft_textbox_printf(pTextbox, "%lu\n\r", 1234567UL);
+        }
+        break;
+        case 4: // blank
+        {
+            tft_fill_screen(RGB565_BLACK);
+        }
+        break;
+        case 5: // Not a gateway screen, enough glyph colors to overflow the glyph cache in the middle of a frame
+        {
+            static const rgb565_t pxColors[] = {RGB565_RED, RGB565_GREEN, RGB565_BLUE, RGB565_YELLOW, RGB565_CYAN, RGB565_MAGENTA, RGB565_WHITE, RGB565_ORANGE};
+
+            tft_fill_screen(RGB565_BLACK);
+
+            for(uint8_t j = 0; j < sizeof(pxColors) / sizeof(pxColors[0]); j++)
+                tft_printf(&xSans18pFont, 0, j * 52, pxColors[j], RGB565_BLACK, "ABCDEFGHIJKLM\n\rnopqrstuvwxyz"); // Fits the width, the two paths clip partly visible glyphs differently
+        }
+        break;
+    }
+
+    bench_tft_draw_buttons();
+
+    if(ubComposited)
+        tft_frame_end();
+
+    ili9488_dma_wait();
+}
+static void bench_tft_setup()
+{
+    pChart = tft_chart_create(20, 40, 280, 360, 4, 3, 40, 36, RGB565_BLACK, RGB565_DARKGREY);
+    pTerminal = tft_terminal_create(10, 10, 18, 300, &xSans9pFont, RGB565_GREEN, RGB565_BLACK);
+    pTextbox = tft_textbox_create(15, 70, 6, 295, 0, 0, &xSans9pFont, RGB565_BLUE, RGB565_WHITE);
+
+    for(uint8_t i = 0; i < 5; i++)
+        pButtons[i] = tft_button_create(i, 10 + i * 60, 420, 50, 50);
+
+    if(!pChart || !pTerminal || !pTextbox || !pButtons[4])
+    {
+        fprintf(stderr, "Could not allocate the UI\n");
+
+        exit(1);
+    }
+
+    tft_chart_set_series(pChart, 0, 15.f, 35.f, RGB565_YELLOW);
+    tft_chart_set_series(pChart, 1, 0.f, 100.f, RGB565_CYAN);
+    tft_chart_set_series(pChart, 2, 950.f, 1050.f, RGB565_MAGENTA);
+
+    for(uint16_t i = 0; i < BENCH_TFT_CHART_SAMPLES; i++)
+    {
+        float pfSamples[3];
+
+        pfSamples[0] = 25.f + 8.f * sinf(i * 0.02f);
+        pfSamples[1] = 50.f + 30.f * sinf(i * 0.013f + 1.f);
+        pfSamples[2] = 1000.f + 20.f * cosf(i * 0.007f);
+
+        tft_chart_append(pChart, pfSamples, 0);
+    }
+
+    for(uint16_t i = 0; i < BENCH_TFT_TERM_LINES; i++)
+        tft_terminal_printf(pTerminal, 0, "Line %hu, node %hu RSSI -%hu dBm\n", i, i % 7, 40 + i);
+}
+
+// Reference renderer, the per-pixel Adafruit GFX algorithms the span rasterizer replaced, into a mask of the vertical screen
+static void bench_tft_ref_pixel(int16_t sX, int16_t sY)
+{
+    if(sX < 0 || sY < 0 || sX >= (int16_t)ILI9488_TFTWIDTH || sY >= (int16_t)ILI9488_TFTHEIGHT)
+        return;
+
+    pubReference[sY * ILI9488_TFTWIDTH + sX] = 1;
+}
+static void bench_tft_ref_line(int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1)
+{
+    uint8_t ubSteep = ABS(sY1 - sY0) > ABS(sX1 - sX0);
+
+    if(ubSteep)
+    {
+        SWAP(sX0, sY0);
+        SWAP(sX1, sY1);
+    }
+
+    if(sX0 > sX1)
+    {
+        SWAP(sX0, sX1);
+        SWAP(sY0, sY1);
+    }
+
+    int16_t sDx = sX1 - sX0;
+    int16_t sDy = ABS(sY1 - sY0);
+    int16_t sErr = sDx / 2;
+
+    for(; sX0 <= sX1; sX0++)
+    {
+        if(ubSteep)
+            bench_tft_ref_pixel(sY0, sX0);
+        else
+            bench_tft_ref_pixel(sX0, sY0);
+
+        sErr -= sDy;
+
+        if(sErr < 0)
+        {
+            sY0 += sY0 < sY1 ? 1 : -1;
+            sErr += sDx;
+        }
+    }
+}
+static void bench_tft_ref_column(int16_t sX, int16_t sY0, int16_t sY1)
+{
+    for(int16_t sY = sY0; sY <= sY1; sY++)
+        bench_tft_ref_pixel(sX, sY);
+}
+// Circle with its four quadrants pulled apart to the corner centers (sX0, sY0) top left and (sX1, sY1) bottom right
+static void bench_tft_ref_round(int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1, int16_t sR, uint8_t ubFill)
+{
+    int16_t sF = 1 - sR;
+    int16_t sDdFx = 1;
+    int16_t sDdFy = -2 * sR;
+    int16_t sXh = 0;
+    int16_t sYh = sR;
+
+    for(int16_t sX = sX0; sX <= sX1; sX++)
+    {
+        if(ubFill)
+        {
+            bench_tft_ref_column(sX, sY0 - sR, sY1 + sR);
+        }
+        else
+        {
+            bench_tft_ref_pixel(sX, sY0 - sR);
+            bench_tft_ref_pixel(sX, sY1 + sR);
+        }
+    }
+
+    for(int16_t sY = sY0; sY <= sY1; sY++)
+    {
+        bench_tft_ref_pixel(sX0 - sR, sY);
+        bench_tft_ref_pixel(sX1 + sR, sY);
+    }
+
+    if(ubFill)
+        for(int16_t sX = sX0 - sR; sX <= sX1 + sR; sX++)
+            bench_tft_ref_column(sX, sY0, sY1);
+
+    while(sXh < sYh)
+    {
+        if(sF >= 0)
+        {
+            sYh--;
+            sDdFy += 2;
+            sF += sDdFy;
+        }
+
+        sXh++;
+        sDdFx += 2;
+        sF += sDdFx;
+
+        if(ubFill)
+        {
+            bench_tft_ref_column(sX1 + sXh, sY0 - sYh, sY1 + sYh);
+            bench_tft_ref_column(sX0 - sXh, sY0 - sYh, sY1 + sYh);
+            bench_tft_ref_column(sX1 + sYh, sY0 - sXh, sY1 + sXh);
+            bench_tft_ref_column(sX0 - sYh, sY0 - sXh, sY1 + sXh);
+        }
+        else
+        {
+            bench_tft_ref_pixel(sX1 + sXh, sY1 + sYh);
+            bench_tft_ref_pixel(sX0 - sXh, sY1 + sYh);
+            bench_tft_ref_pixel(sX1 + sXh, sY0 - sYh);
+            bench_tft_ref_pixel(sX0 - sXh, sY0 - sYh);
+            bench_tft_ref_pixel(sX1 + sYh, sY1 + sXh);
+            bench_tft_ref_pixel(sX0 - sYh, sY1 + sXh);
+            bench_tft_ref_pixel(sX1 + sYh, sY0 - sXh);
+            bench_tft_ref_pixel(sX0 - sYh, sY0 - sXh);
+        }
+    }
+}
+// Edges interpolated per row from the top vertex, the middle row belongs to the upper half unless the lower one is flat
+static void bench_tft_ref_triangle(int16_t sX0, int16_t sY0, int16_t sX1, int16_t sY1, int16_t sX2, int16_t sY2)
+{
+    if(sY0 > sY1)
+    {
+        SWAP(sY0, sY1);
+        SWAP(sX0, sX1);
+    }
+
+    if(sY1 > sY2)
+    {
+        SWAP(sY2, sY1);
+        SWAP(sX2, sX1);
+    }
+
+    if(sY0 > sY1)
+    {
+        SWAP(sY0, sY1);
+        SWAP(sX0, sX1);
+    }
+
+    for(int16_t sY = sY0; sY <= sY2; sY++)
+    {
+        int16_t sA, sB;
+
+        if(sY0 == sY2)
+        {
+            sA = MIN(sX0, MIN(sX1, sX2));
+            sB = MAX(sX0, MAX(sX1, sX2));
+        }
+        else
+        {
+            sB = sX0 + (int32_t)(sX2 - sX0) * (sY - sY0) / (sY2 - sY0);
+
+            if(sY < sY1 || (sY == sY1 && sY1 == sY2))
+                sA = sX0 + (int32_t)(sX1 - sX0) * (sY - sY0) / (sY1 - sY0);
+            else
+                sA = sX1 + (int32_t)(sX2 - sX1) * (sY - sY1) / (sY2 - sY1);
+        }
+
+        if(sA > sB)
+            SWAP(sA, sB);
+
+        for(int16_t sX = sA; sX <= sB; sX++)
+            bench_tft_ref_pixel(sX, sY);
+    }
+}
+static void bench_tft_ref_primitive(const bench_tft_primitive_t *pPrimitive)
+{
+    const uint16_t *pusA = pPrimitive->pusArgs;
+
+    memset(pubReference, 0, sizeof(pubReference));
+
+    switch(pPrimitive->ubType)
+    {
+        case BENCH_TFT_PRIM_LINE:
+            bench_tft_ref_line(pusA[0], pusA[1], pusA[2], pusA[3]);
+        break;
+        case BENCH_TFT_PRIM_CIRCLE:
+            bench_tft_ref_round(pusA[0], pusA[1], pusA[0], pusA[1], pusA[2], pPrimitive->ubFill);
+        break;
+        case BENCH_TFT_PRIM_TRIANGLE:
+            if(pPrimitive->ubFill)
+            {
+                bench_tft_ref_triangle(pusA[0], pusA[1], pusA[2], pusA[3], pusA[4], pusA[5]);
+            }
+            else
+            {
+                bench_tft_ref_line(pusA[0], pusA[1], pusA[2], pusA[3]);
+                bench_tft_ref_line(pusA[2], pusA[3], pusA[4], pusA[5]);
+                bench_tft_ref_line(pusA[4], pusA[5], pusA[0], pusA[1]);
+            }
+        break;
+        case BENCH_TFT_PRIM_THICK:
+        {
+            // Quad around the line, offset along the normal by half the thickness
+            float fDx = (float)pusA[2] - pusA[0];
+            float fDy = (float)pusA[3] - pusA[1];
+            float fLen = sqrtf(fDx * fDx + fDy * fDy);
+            int16_t sOffX = lroundf(-fDy * pusA[4] / (2.f * fLen));
+            int16_t sOffY = lroundf(fDx * pusA[4] / (2.f * fLen));
+
+            bench_tft_ref_triangle(pusA[0] + sOffX, pusA[1] + sOffY, pusA[2] + sOffX, pusA[3] + sOffY, pusA[2] - sOffX, pusA[3] - sOffY);
+            bench_tft_ref_triangle(pusA[0] + sOffX, pusA[1] + sOffY, pusA[2] - sOffX, pusA[3] - sOffY, pusA[0] - sOffX, pusA[1] - sOffY);
+        }
+        break;
+        case BENCH_TFT_PRIM_ROUNDED:
+            bench_tft_ref_round(pusA[0] + pusA[4], pusA[1] + pusA[4], pusA[2] - pusA[4], pusA[3] - pusA[4], pusA[4], pPrimitive->ubFill);
+        break;
+    }
+}
+static void bench_tft_draw_primitive(const bench_tft_primitive_t *pPrimitive)
+{
+    const uint16_t *pusA = pPrimitive->pusArgs;
+
+    switch(pPrimitive->ubType)
+    {
+        case BENCH_TFT_PRIM_LINE:
+            tft_draw_line(pusA[0], pusA[1], pusA[2], pusA[3], RGB565_YELLOW);
+        break;
+        case BENCH_TFT_PRIM_CIRCLE:
+            tft_draw_circle(pusA[0], pusA[1], pusA[2], RGB565_YELLOW, pPrimitive->ubFill);
+        break;
+        case BENCH_TFT_PRIM_TRIANGLE:
+            tft_draw_triangle(pusA[0], pusA[1], pusA[2], pusA[3], pusA[4], pusA[5], RGB565_YELLOW, pPrimitive->ubFill);
+        break;
+        case BENCH_TFT_PRIM_THICK:
+            tft_draw_thick_line(pusA[0], pusA[1], pusA[2], pusA[3], pusA[4], RGB565_YELLOW);
+        break;
+        case BENCH_TFT_PRIM_ROUNDED:
+            tft_draw_rounded_rectangle(pusA[0], pusA[1], pusA[2], pusA[3], pusA[4], RGB565_YELLOW, pPrimitive->ubFill);
+        break;
+    }
+
+    ili9488_dma_wait();
+}
+// Each primitive alone on a blank screen, bus cost from the driver and the pixels against the reference renderer
+static uint8_t bench_tft_primitive(const bench_tft_primitive_t *pPrimitive)
+{
+    ili9488_stats_t xTFTStats;
+    ili9488_model_stats_t xModelStats;
+    uint8_t pubColor[2][3]; // Background, primitive
+    uint32_t ulReference = 0;
+    uint32_t ulDiff = 0;
+    uint8_t ubFailed = 0;
+
+    tft_fill_screen(RGB565_YELLOW);
+    ili9488_dma_wait();
+    ili9488_model_snapshot(pubImmediate, NULL, NULL);
+
+    memcpy(pubColor[1], pubImmediate, 3); // As the panel stores it
+
+    tft_fill_screen(RGB565_BLACK);
+    ili9488_dma_wait();
+    ili9488_model_snapshot(pubImmediate, NULL, NULL);
+
+    memcpy(pubColor[0], pubImmediate, 3);
+
+    ili9488_reset_stats();
+    ili9488_model_reset_stats();
+
+    bench_tft_draw_primitive(pPrimitive);
+
+    ili9488_get_stats(&xTFTStats);
+    ili9488_model_get_stats(&xModelStats);
+    ili9488_model_snapshot(pubImmediate, NULL, NULL);
+
+    bench_tft_ref_primitive(pPrimitive);
+
+    for(uint32_t i = 0; i < sizeof(pubReference); i++)
+    {
+        ulReference += pubReference[i];
+
+        if(memcmp(&pubImmediate[i * 3], pubColor[pubReference[i]], 3))
+            ulDiff++;
+    }
+
+    if(ulDiff)
+    {
+        printf("  %s: %u pixels differ from the reference renderer\n", pPrimitive->pszName, ulDiff);
+
+        ubFailed = 1;
+    }
+
+    if(xModelStats.ulBytes != xTFTStats.ulBytesSent)
+    {
+        printf("  %s: driver counted %u bytes, panel saw %u\n", pPrimitive->pszName, xTFTStats.ulBytesSent, xModelStats.ulBytes);
+
+        ubFailed = 1;
+    }
+
+    printf("%-9s %9.3f %8u %8u %8u %8u\n", pPrimitive->pszName, xModelStats.ulBytes * 8.0 * 1000.0 / BENCH_TFT_SPI_CLOCK, xModelStats.ulBytes, xTFTStats.ulWindowSets, xTFTStats.ulPixels, ulReference);
+
+    return ubFailed;
+}
+
+// QOI565 image decoded immediately and inside a frame, both against the raw copy of the same pixels
+static uint8_t bench_tft_image(const bench_tft_image_t *pImage)
+{
+    ili9488_stats_t xTFTStats;
+    ili9488_model_stats_t xModelStats;
+    uint32_t pulBusBytes[2];
+    uint32_t ulRawBytes = (uint32_t)pImage->pImage->usWidth * pImage->pImage->usHeight * sizeof(rgb565_t);
+    uint8_t ubFailed = 0;
+
+    if(pImage->pImage->ubEncoding != IMAGE_ENCODING_QOI565 || pImage->pRawImage->ubEncoding != IMAGE_ENCODING_RAW)
+    {
+        printf("  %s: expected a QOI565 asset and a raw reference\n", pImage->pszName);
+
+        return 1;
+    }
+
+    tft_fill_screen(RGB565_BLACK);
+    tft_draw_image(pImage->pRawImage, pImage->usX, pImage->usY);
+    ili9488_dma_wait();
+    ili9488_model_snapshot(pubComposited, NULL, NULL); // Reference
+
+    for(uint8_t ubComposited = 0; ubComposited < 2; ubComposited++)
+    {
+        tft_fill_screen(RGB565_BLACK);
+        ili9488_dma_wait();
+
+        ili9488_reset_stats();
+        ili9488_model_reset_stats();
+
+        if(ubComposited)
+            tft_frame_begin();
+
+        tft_draw_image(pImage->pImage, pImage->usX, pImage->usY);
+
+        if(ubComposited)
+            tft_frame_end();
+
+        ili9488_dma_wait();
+        ili9488_get_stats(&xTFTStats);
+        ili9488_model_get_stats(&xModelStats);
+        ili9488_model_snapshot(pubImmediate, NULL, NULL);
+
+        pulBusBytes[ubComposited] = xModelStats.ulBytes;
+
+        if(memcmp(pubImmediate, pubComposited, sizeof(pubImmediate)))
+        {
+            printf("  %s: decoded %s differs from the raw pixels\n", pImage->pszName, ubComposited ? "inside a frame" : "immediately");
+
+            ubFailed = 1;
+        }
+
+        if(xModelStats.ulBytes != xTFTStats.ulBytesSent)
+        {
+            printf("  %s: driver counted %u bytes, panel saw %u\n", pImage->pszName, xTFTStats.ulBytesSent, xModelStats.ulBytes);
+
+            ubFailed = 1;
+        }
+    }
+
+    printf("%-9s %9u %8u %6.1f%% %9u %9u\n", pImage->pszName, pImage->pImage->ulSize, ulRawBytes, pImage->pImage->ulSize * 100.0 / ulRawBytes, pulBusBytes[0], pulBusBytes[1]);
+
+    return ubFailed;
+}
+
+// Samples appended to the shown chart must end up like a full redraw of the same history
+static uint8_t bench_tft_chart()
+{
+    static uint16_t usSample = BENCH_TFT_CHART_SAMPLES;
+    ili9488_model_stats_t xModelStats;
+    uint8_t ubFailed = 0;
+
+    if(tft_chart_set_series(pChart, 0, 15.f, 15.001f, RGB565_YELLOW))
+    {
+        printf("  chart: accepted a range narrower than one row per fixed point step\n");
+
+        ubFailed = 1;
+    }
+
+    bench_tft_draw_screen(4, 0);
+    bench_tft_draw_screen(1, 0);
+
+    ili9488_model_reset_stats();
+
+    for(uint8_t i = 0; i < BENCH_TFT_CHART_APPENDS; i++, usSample++)
+    {
+        float pfSamples[3];
+
+        pfSamples[0] = 25.f + 8.f * sinf(usSample * 0.02f);
+        pfSamples[1] = 50.f + 30.f * sinf(usSample * 0.013f + 1.f);
+        pfSamples[2] = 1000.f + 20.f * cosf(usSample * 0.007f);
+
+        tft_frame_begin();
+        tft_chart_append(pChart, pfSamples, 1);
+        tft_frame_end();
+    }
+
+    ili9488_dma_wait();
+    ili9488_model_get_stats(&xModelStats);
+
+    printf("%-9s %-5s %10s %9.2f %8u\n", "chart", "frame", "-", xModelStats.ulBytes * 8.0 * 1000.0 / BENCH_TFT_SPI_CLOCK, xModelStats.ulBytes);
+
+    ili9488_model_snapshot(pubComposited, NULL, NULL);
+
+    bench_tft_draw_screen(4, 0);
+    bench_tft_draw_screen(1, 0); // Full redraw of the same history, reference
+
+    ili9488_model_snapshot(pubImmediate, NULL, NULL);
+
+    if(memcmp(pubImmediate, pubComposited, sizeof(pubImmediate)))
+    {
+        printf("  chart: appended samples differ from a full redraw\n");
+
+        ubFailed = 1;
+    }
+
+    return ubFailed;
+}
+// Terminal lines scrolled in on top of the shown terminal must end up like a full redraw of the same text
+// Inside a frame the scroll start register may only move once the new lines are on the panel
+static uint8_t bench_tft_scroll(uint8_t ubComposited)
+{
+    static uint16_t usLine = BENCH_TFT_TERM_LINES;
+    ili9488_model_stats_t xModelStats;
+    uint8_t ubFailed = 0;
+
+    bench_tft_draw_screen(4, 0);
+    bench_tft_draw_screen(2, 0);
+
+    for(uint8_t i = 0; i < BENCH_TFT_SCROLL_LINES; i++, usLine++)
+        tft_terminal_printf(pTerminal, 0, "Line %hu, node %hu RSSI -%hu dBm\n", usLine, usLine % 7, 40 + usLine % 60);
+
+    ili9488_model_reset_stats();
+
+    if(ubComposited)
+        tft_frame_begin();
+
+    tft_terminal_update(pTerminal);
+
+    ili9488_model_get_stats(&xModelStats);
+
+    if(ubComposited && xModelStats.ulScrollUpdates)
+    {
+        printf("  scroll: scroll start written inside the frame, before the lines it reveals\n");
+
+        ubFailed = 1;
+    }
+
+    if(ubComposited)
+        tft_frame_end();
+
+    ili9488_dma_wait();
+    ili9488_model_get_stats(&xModelStats);
+
+    if(xModelStats.ulScrollUpdates != 1)
+    {
+        printf("  scroll: expected one scroll start update, panel saw %u\n", xModelStats.ulScrollUpdates);
+
+        ubFailed = 1;
+    }
+
+    printf("%-9s %-5s %10s %9.2f %8u\n", "scroll", ubComposited ? "frame" : "imm", "-", xModelStats.ulBytes * 8.0 * 1000.0 / BENCH_TFT_SPI_CLOCK, xModelStats.ulBytes);
+
+    ili9488_model_snapshot(pubComposited, NULL, NULL);
+
+    bench_tft_draw_screen(4, 0);
+    bench_tft_draw_screen(2, 0); // Full redraw of the same text, reference
+
+    ili9488_model_snapshot(pubImmediate, NULL, NULL);
+
+    if(memcmp(pubImmediate, pubComposited, sizeof(pubImmediate)))
+    {
+        printf("  scroll: scrolled terminal differs from a full redraw\n");
+
+        ubFailed = 1;
+    }
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    const char *pszOutDir = argc > 1 ? argv[1] : ".";
+    uint8_t ubFailed = 0;
+
+    ili9488_model_init();
+    ldma_init();
+
+    if(!ili9488_init())
+    {
+        fprintf(stderr, "ILI9488 not detected\n");
+
+        return 1;
+    }
+
+    tft_init();
+    tft_display_on();
+    tft_set_rotation(ILI9488_ROTATION_VERTICAL);
+    tft_fill_screen(RGB565_BLACK);
+    ili9488_dma_wait();
+
+    bench_tft_setup();
+
+    printf("%-9s %-5s %10s %9s %8s %8s %8s %8s %8s %9s %6s\n", "screen", "mode", "wall ns", "bus ms", "bytes", "fill", "pixels", "windows", "DMA", "commands", "tiles");
+
+    for(uint8_t i = 0; i < BENCH_TFT_SCREENS; i++)
+    {
+        uint8_t ubScreen = (i + 1) % BENCH_TFT_SCREENS;
+        uint32_t ulImmediateBytes = 0;
+
+        for(uint8_t ubComposited = 0; ubComposited < 2; ubComposited++)
+        {
+            ili9488_stats_t xTFTStats;
+            ili9488_model_stats_t xModelStats;
+            tft_frame_stats_t xFrameStats;
+
+            bench_tft_draw_screen(4, 0); // Same starting point for both passes
+
+            ili9488_reset_stats();
+            ili9488_model_reset_stats();
+
+            uint64_t ullStart = host_time_ns();
+
+            bench_tft_draw_screen(ubScreen, ubComposited);
+
+            uint64_t ullTime = host_time_ns() - ullStart;
+
+            ili9488_get_stats(&xTFTStats);
+            ili9488_model_get_stats(&xModelStats);
+            tft_frame_get_stats(&xFrameStats);
+
+            if(xModelStats.ulBytes != xTFTStats.ulBytesSent)
+            {
+                printf("  %s: driver counted %u bytes, panel saw %u\n", pszScreenName[ubScreen], xTFTStats.ulBytesSent, xModelStats.ulBytes);
+
+                ubFailed = 1;
+            }
+
+            if(!ubComposited)
+                ulImmediateBytes = xModelStats.ulBytes;
+            else if(xModelStats.ulBytes > ulImmediateBytes)
+            {
+                printf("  %s: composited frame sent %u bytes, immediate drawing %u\n", pszScreenName[ubScreen], xModelStats.ulBytes, ulImmediateBytes);
+
+                ubFailed = 1;
+            }
+
+            printf("%-9s %-5s %10llu %9.2f %8u %8u %8u %8u %8u %9hu %6hu\n", pszScreenName[ubScreen], ubComposited ? "frame" : "imm", (unsigned long long)ullTime, xModelStats.ulBytes * 8.0 * 1000.0 / BENCH_TFT_SPI_CLOCK, xModelStats.ulBytes, ubComposited ? xFrameStats.ulLastFillBytes : 0, xTFTStats.ulPixels, xTFTStats.ulWindowSets, xTFTStats.ulDMATransfers, ubComposited ? xFrameStats.usLastCommands : 0, ubComposited ? xFrameStats.usLastTiles : 0);
+
+            ili9488_model_snapshot(ubComposited ? pubComposited : pubImmediate, NULL, NULL);
+        }
+
+        if(memcmp(pubImmediate, pubComposited, sizeof(pubImmediate)))
+        {
+            uint32_t ulDiff = 0;
+
+            for(uint32_t j = 0; j < sizeof(pubImmediate); j += 3)
+                if(memcmp(&pubImmediate[j], &pubComposited[j], 3))
+                    ulDiff++;
+
+            printf("  %s: composited frame differs from the immediate one in %u pixels\n", pszScreenName[ubScreen], ulDiff);
+
+            ubFailed = 1;
+        }
+
+        char szFile[256];
+
+        snprintf(szFile, sizeof(szFile), "%s/tft_%s.png", pszOutDir, pszScreenName[ubScreen]);
+
+        if(!ili9488_model_write_png(szFile))
+            printf("  Could not write %s\n", szFile);
+    }
+
+    printf("%-9s %9s %8s %8s %8s %8s\n", "primitive", "bus ms", "bytes", "windows", "pixels", "ref px");
+
+    for(uint8_t i = 0; i < sizeof(pPrimitives) / sizeof(pPrimitives[0]); i++)
+        ubFailed |= bench_tft_primitive(&pPrimitives[i]);
+
+    printf("%-9s %9s %8s %7s %9s %9s\n", "image", "QOI565 B", "raw B", "ratio", "imm bus B", "frame B");
+
+    for(uint8_t i = 0; i < sizeof(pImages) / sizeof(pImages[0]); i++)
+        ubFailed |= bench_tft_image(&pImages[i]);
+
+    ubFailed |= bench_tft_chart();
+
+    for(uint8_t ubComposited = 0; ubComposited < 2; ubComposited++)
+        ubFailed |= bench_tft_scroll(ubComposited);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
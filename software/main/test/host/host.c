@@ -0,0 +1,377 @@
+#include <time.h>
+#include "host.h"
+#include "crypto.h"
+#include "trng.h"
+#include "ft6x36.h"
+
+volatile uint32_t g_ulHostPRIMASK = 0;
+volatile uint32_t g_ulHostMaskedSections = 0;
+volatile uint64_t g_ullSystemTick = 0;
+uint32_t HFPER_CLOCK_FREQ = 50000000UL;
+CMU_TypeDef g_xHostCMU;
+WTIMER_TypeDef g_xHostWTIMER2;
+uint8_t g_pubHostQSPIFlash[HOST_QSPI_FLASH_SIZE] __attribute__ ((aligned (4)));
+
+static host_tick_hook_fn_t pfTickHooks[HOST_TICK_HOOKS];
+static host_irq_source_fn_t pfIRQSources[HOST_IRQ_SOURCES];
+static uint8_t pubPinLevel[GPIO_HOST_PIN_COUNT] = {[GPIO_HOST_PIN_RFM69_CS] = 1, [GPIO_HOST_PIN_TFT_CS] = 1};
+static gpio_host_listener_fn_t pfPinListener[GPIO_HOST_PIN_COUNT];
+static uint32_t ulTRNGState = 0x2545F491;
+
+void host_advance(uint32_t ulMilliseconds)
+{
+    while(ulMilliseconds--)
+    {
+        g_ullSystemTick++;
+
+        for(uint8_t i = 0; i < HOST_TICK_HOOKS; i++)
+            if(pfTickHooks[i])
+                pfTickHooks[i]();
+    }
+}
+uint8_t host_add_tick_hook(host_tick_hook_fn_t pfHook)
+{
+    for(uint8_t i = 0; i < HOST_TICK_HOOKS; i++)
+        if(pfTickHooks[i] == pfHook)
+            return 1;
+
+    for(uint8_t i = 0; i < HOST_TICK_HOOKS; i++)
+    {
+        if(pfTickHooks[i])
+            continue;
+
+        pfTickHooks[i] = pfHook;
+
+        return 1;
+    }
+
+    return 0;
+}
+void host_clear_tick_hooks()
+{
+    memset(pfTickHooks, 0, sizeof(pfTickHooks));
+}
+uint8_t host_add_irq_source(host_irq_source_fn_t pfSource)
+{
+    for(uint8_t i = 0; i < HOST_IRQ_SOURCES; i++)
+        if(pfIRQSources[i] == pfSource)
+            return 1;
+
+    for(uint8_t i = 0; i < HOST_IRQ_SOURCES; i++)
+    {
+        if(pfIRQSources[i])
+            continue;
+
+        pfIRQSources[i] = pfSource;
+
+        return 1;
+    }
+
+    return 0;
+}
+void host_clear_irq_sources()
+{
+    memset(pfIRQSources, 0, sizeof(pfIRQSources));
+}
+void host_irq_unmasked()
+{
+    ldma_host_irq_unmasked(); // Pending completions fire as soon as interrupts are enabled again
+
+    for(uint8_t i = 0; i < HOST_IRQ_SOURCES && !g_ulHostPRIMASK; i++)
+        if(pfIRQSources[i])
+            pfIRQSources[i]();
+}
+
+uint64_t host_time_ns()
+{
+    struct timespec xTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &xTime);
+
+    return (uint64_t)xTime.tv_sec * 1000000000ULL + xTime.tv_nsec;
+}
+uint32_t host_cycle_counter()
+{
+    return (uint32_t)host_time_ns();
+}
+
+uint8_t host_peri_reg_bit(volatile uint32_t *pulRegister, uint8_t ubBit)
+{
+    if((volatile uint8_t *)pulRegister >= (volatile uint8_t *)LDMA && (volatile uint8_t *)pulRegister < (volatile uint8_t *)(LDMA + 1))
+        ldma_host_step(1); // Busy polling, the transfer keeps going meanwhile
+
+    return (*pulRegister >> ubBit) & 1;
+}
+
+void delay_ms(uint64_t ullTicks)
+{
+    host_advance(ullTicks);
+}
+
+void _putchar(char cCharacter)
+{
+    putchar(cCharacter);
+}
+
+void ft6x36_set_event_callback(ft6x36_event_callback_fn_t pfFunc)
+{
+    // No touch controller on the host
+}
+
+void gpio_host_write(uint8_t ubPin, uint8_t ubLevel)
+{
+    if(ubPin >= GPIO_HOST_PIN_COUNT)
+        return;
+
+    ubLevel = !!ubLevel;
+
+    if(pubPinLevel[ubPin] == ubLevel)
+        return;
+
+    pubPinLevel[ubPin] = ubLevel;
+
+    if(pfPinListener[ubPin])
+        pfPinListener[ubPin](ubPin, ubLevel);
+}
+uint8_t gpio_host_read(uint8_t ubPin)
+{
+    if(ubPin >= GPIO_HOST_PIN_COUNT)
+        return 0;
+
+    return pubPinLevel[ubPin];
+}
+void gpio_host_set_listener(uint8_t ubPin, gpio_host_listener_fn_t pfListener)
+{
+    if(ubPin >= GPIO_HOST_PIN_COUNT)
+        return;
+
+    pfPinListener[ubPin] = pfListener;
+}
+
+void host_trng_seed(uint32_t ulSeed)
+{
+    ulTRNGState = ulSeed ? ulSeed : 0x2545F491;
+}
+uint32_t trng_pop_random()
+{
+    // xorshift32, repeatable runs matter more than quality here
+    ulTRNGState ^= ulTRNGState << 13;
+    ulTRNGState ^= ulTRNGState >> 17;
+    ulTRNGState ^= ulTRNGState << 5;
+
+    return ulTRNGState;
+}
+
+static const uint32_t pulSHA256K[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+static inline uint32_t host_sha256_rotr(uint32_t ulValue, uint8_t ubBits)
+{
+    return (ulValue >> ubBits) | (ulValue << (32 - ubBits));
+}
+static void host_sha256_block(uint32_t pulState[8], const uint8_t *pubBlock)
+{
+    uint32_t pulW[64];
+
+    for(uint8_t i = 0; i < 16; i++)
+        pulW[i] = ((uint32_t)pubBlock[i * 4] << 24) | ((uint32_t)pubBlock[i * 4 + 1] << 16) | ((uint32_t)pubBlock[i * 4 + 2] << 8) | pubBlock[i * 4 + 3];
+
+    for(uint8_t i = 16; i < 64; i++)
+    {
+        uint32_t ulS0 = host_sha256_rotr(pulW[i - 15], 7) ^ host_sha256_rotr(pulW[i - 15], 18) ^ (pulW[i - 15] >> 3);
+        uint32_t ulS1 = host_sha256_rotr(pulW[i - 2], 17) ^ host_sha256_rotr(pulW[i - 2], 19) ^ (pulW[i - 2] >> 10);
+
+        pulW[i] = pulW[i - 16] + ulS0 + pulW[i - 7] + ulS1;
+    }
+
+    uint32_t a = pulState[0], b = pulState[1], c = pulState[2], d = pulState[3];
+    uint32_t e = pulState[4], f = pulState[5], g = pulState[6], h = pulState[7];
+
+    for(uint8_t i = 0; i < 64; i++)
+    {
+        uint32_t ulT1 = h + (host_sha256_rotr(e, 6) ^ host_sha256_rotr(e, 11) ^ host_sha256_rotr(e, 25)) + ((e & f) ^ (~e & g)) + pulSHA256K[i] + pulW[i];
+        uint32_t ulT2 = (host_sha256_rotr(a, 2) ^ host_sha256_rotr(a, 13) ^ host_sha256_rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + ulT1;
+        d = c;
+        c = b;
+        b = a;
+        a = ulT1 + ulT2;
+    }
+
+    pulState[0] += a;
+    pulState[1] += b;
+    pulState[2] += c;
+    pulState[3] += d;
+    pulState[4] += e;
+    pulState[5] += f;
+    pulState[6] += g;
+    pulState[7] += h;
+}
+void crypto_sha256(uint8_t *pubData, uint32_t ulDataSize, uint8_t pubDigest[32])
+{
+    uint32_t pulState[8] = {0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+    uint8_t pubBlock[64];
+    uint32_t ulLeft = ulDataSize;
+
+    while(ulLeft >= 64)
+    {
+        host_sha256_block(pulState, pubData);
+
+        pubData += 64;
+        ulLeft -= 64;
+    }
+
+    memset(pubBlock, 0, sizeof(pubBlock));
+    memcpy(pubBlock, pubData, ulLeft);
+
+    pubBlock[ulLeft] = 0x80;
+
+    if(ulLeft >= 56)
+    {
+        host_sha256_block(pulState, pubBlock);
+
+        memset(pubBlock, 0, sizeof(pubBlock));
+    }
+
+    uint64_t ullBits = (uint64_t)ulDataSize * 8;
+
+    for(uint8_t i = 0; i < 8; i++)
+        pubBlock[63 - i] = ullBits >> (i * 8);
+
+    host_sha256_block(pulState, pubBlock);
+
+    for(uint8_t i = 0; i < 32; i++)
+        pubDigest[i] = pulState[i >> 2] >> (24 - (i & 3) * 8);
+}
+
+static uint32_t host_crc32(uint32_t ulCRC, const uint8_t *pubData, uint32_t ulSize)
+{
+    ulCRC = ~ulCRC;
+
+    while(ulSize--)
+    {
+        ulCRC ^= *pubData++;
+
+        for(uint8_t i = 0; i < 8; i++)
+            ulCRC = (ulCRC >> 1) ^ (0xEDB88320 & -(ulCRC & 1));
+    }
+
+    return ~ulCRC;
+}
+static void host_png_u32(uint8_t *pubDst, uint32_t ulValue)
+{
+    pubDst[0] = ulValue >> 24;
+    pubDst[1] = ulValue >> 16;
+    pubDst[2] = ulValue >> 8;
+    pubDst[3] = ulValue;
+}
+static void host_png_chunk(FILE *pFile, const char *pszType, const uint8_t *pubData, uint32_t ulSize)
+{
+    uint8_t pubWord[4];
+
+    host_png_u32(pubWord, ulSize);
+    fwrite(pubWord, 1, 4, pFile);
+    fwrite(pszType, 1, 4, pFile);
+    fwrite(pubData, 1, ulSize, pFile);
+
+    uint32_t ulCRC = host_crc32(0, (const uint8_t *)pszType, 4);
+
+    ulCRC = host_crc32(ulCRC, pubData, ulSize);
+
+    host_png_u32(pubWord, ulCRC);
+    fwrite(pubWord, 1, 4, pFile);
+}
+uint8_t host_write_png(const char *pszFile, const uint8_t *pubRGB, uint16_t usWidth, uint16_t usHeight)
+{
+    uint32_t ulStride = usWidth * 3 + 1; // Filter byte first
+    uint32_t ulRawSize = ulStride * usHeight;
+    uint32_t ulBlocks = (ulRawSize + 65534) / 65535;
+    uint32_t ulZSize = 2 + ulRawSize + ulBlocks * 5 + 4;
+    uint8_t *pubRaw = (uint8_t *)malloc(ulRawSize);
+    uint8_t *pubZ = (uint8_t *)malloc(ulZSize);
+
+    if(!pubRaw || !pubZ)
+    {
+        free(pubRaw);
+        free(pubZ);
+
+        return 0;
+    }
+
+    for(uint16_t usRow = 0; usRow < usHeight; usRow++)
+    {
+        pubRaw[usRow * ulStride] = 0x00; // No filter
+
+        memcpy(&pubRaw[usRow * ulStride + 1], &pubRGB[usRow * usWidth * 3], usWidth * 3);
+    }
+
+    // zlib stream made of stored blocks, no compressor needed
+    uint8_t *pubDst = pubZ;
+    uint32_t ulA = 1, ulB = 0;
+
+    *pubDst++ = 0x78;
+    *pubDst++ = 0x01;
+
+    for(uint32_t ulOffset = 0; ulOffset < ulRawSize; ulOffset += 65535)
+    {
+        uint16_t usLen = MIN(ulRawSize - ulOffset, 65535);
+
+        *pubDst++ = (ulOffset + usLen == ulRawSize) ? 0x01 : 0x00; // BFINAL on the last block
+        *pubDst++ = usLen & 0xFF;
+        *pubDst++ = usLen >> 8;
+        *pubDst++ = ~usLen & 0xFF;
+        *pubDst++ = (~usLen >> 8) & 0xFF;
+
+        memcpy(pubDst, &pubRaw[ulOffset], usLen);
+
+        pubDst += usLen;
+    }
+
+    for(uint32_t i = 0; i < ulRawSize; i++)
+    {
+        ulA = (ulA + pubRaw[i]) % 65521;
+        ulB = (ulB + ulA) % 65521;
+    }
+
+    host_png_u32(pubDst, (ulB << 16) | ulA);
+
+    FILE *pFile = fopen(pszFile, "wb");
+
+    if(pFile)
+    {
+        static const uint8_t pubSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        uint8_t pubHeader[13];
+
+        host_png_u32(&pubHeader[0], usWidth);
+        host_png_u32(&pubHeader[4], usHeight);
+        pubHeader[8] = 8; // Bit depth
+        pubHeader[9] = 2; // RGB
+        pubHeader[10] = 0;
+        pubHeader[11] = 0;
+        pubHeader[12] = 0;
+
+        fwrite(pubSignature, 1, sizeof(pubSignature), pFile);
+        host_png_chunk(pFile, "IHDR", pubHeader, sizeof(pubHeader));
+        host_png_chunk(pFile, "IDAT", pubZ, ulZSize);
+        host_png_chunk(pFile, "IEND", NULL, 0);
+
+        fclose(pFile);
+    }
+
+    free(pubRaw);
+    free(pubZ);
+
+    return pFile != NULL;
+}
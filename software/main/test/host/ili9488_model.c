@@ -0,0 +1,307 @@
+#include "ili9488_model.h"
+
+#define ILI9488_MODEL_WIDTH     ILI9488_TFTWIDTH
+#define ILI9488_MODEL_HEIGHT    ILI9488_TFTHEIGHT
+#define ILI9488_MODEL_MAX_PARAM 16
+#define ILI9488_MODEL_MAX_REPLY 4
+
+static uint8_t pubFrame[ILI9488_MODEL_WIDTH * ILI9488_MODEL_HEIGHT * 3];
+static ili9488_model_stats_t xStats;
+static uint8_t ubCommand;
+static uint8_t pubParam[ILI9488_MODEL_MAX_PARAM];
+static uint8_t ubParamCount;
+static uint8_t pubReply[ILI9488_MODEL_MAX_REPLY];
+static uint8_t ubReplyCount;
+static uint8_t ubReplyIndex;
+static uint8_t ubMADCTL;
+static uint8_t ubSleeping;
+static uint8_t ubDisplayOn;
+static uint16_t usColumnStart, usColumnEnd, usPageStart, usPageEnd;
+static uint16_t usColumn, usPage;
+static uint8_t pubPixel[3];
+static uint8_t ubPixelBytes;
+static uint16_t usScrollTop, usScrollHeight, usScrollStart;
+
+// The panel is mounted mirrored, rotation 0 sets MX to get an upright picture
+// Column and page are the addresses the host sends, the result is the frame memory location in panel native order
+static void ili9488_model_map(uint16_t usCol, uint16_t usRow, uint16_t *pusX, uint16_t *pusY)
+{
+    uint16_t usX = (ubMADCTL & ILI9488_MADCTL_MV) ? usRow : usCol;
+    uint16_t usY = (ubMADCTL & ILI9488_MADCTL_MV) ? usCol : usRow;
+
+    if(!(ubMADCTL & ILI9488_MADCTL_MX))
+        usX = ILI9488_MODEL_WIDTH - 1 - usX;
+
+    if(ubMADCTL & ILI9488_MADCTL_MY)
+        usY = ILI9488_MODEL_HEIGHT - 1 - usY;
+
+    *pusX = usX;
+    *pusY = usY;
+}
+static uint16_t ili9488_model_logical_width()
+{
+    return (ubMADCTL & ILI9488_MADCTL_MV) ? ILI9488_MODEL_HEIGHT : ILI9488_MODEL_WIDTH;
+}
+static uint16_t ili9488_model_logical_height()
+{
+    return (ubMADCTL & ILI9488_MADCTL_MV) ? ILI9488_MODEL_WIDTH : ILI9488_MODEL_HEIGHT;
+}
+static void ili9488_model_store_pixel()
+{
+    xStats.ulPixelWrites++;
+
+    if(usColumn < ili9488_model_logical_width() && usPage < ili9488_model_logical_height())
+    {
+        uint16_t usX, usY;
+
+        ili9488_model_map(usColumn, usPage, &usX, &usY);
+
+        uint8_t *pubDst = &pubFrame[(usY * ILI9488_MODEL_WIDTH + usX) * 3];
+
+        for(uint8_t i = 0; i < 3; i++)
+            pubDst[i] = pubPixel[i] & 0xFC; // 6 bits per component
+    }
+
+    if(++usColumn > usColumnEnd)
+    {
+        usColumn = usColumnStart;
+
+        if(++usPage > usPageEnd)
+            usPage = usPageStart;
+    }
+}
+static void ili9488_model_command(uint8_t ubCmd)
+{
+    ubCommand = ubCmd;
+    ubParamCount = 0;
+    ubPixelBytes = 0;
+    ubReplyCount = 0;
+    ubReplyIndex = 0;
+
+    xStats.ulCommands++;
+
+    switch(ubCmd)
+    {
+        case ILI9488_SW_RESET:
+        {
+            ubMADCTL = 0;
+            ubSleeping = 1;
+            ubDisplayOn = 0;
+        }
+        break;
+        case ILI9488_SLP_IN:
+        {
+            ubSleeping = 1;
+        }
+        break;
+        case ILI9488_SLP_OUT:
+        {
+            ubSleeping = 0;
+        }
+        break;
+        case ILI9488_DISP_ON:
+        {
+            ubDisplayOn = 1;
+        }
+        break;
+        case ILI9488_DISP_OFF:
+        {
+            ubDisplayOn = 0;
+        }
+        break;
+        case ILI9488_RAM_WR:
+        {
+            usColumn = usColumnStart;
+            usPage = usPageStart;
+        }
+        break;
+        case ILI9488_RD_ID_4:
+        {
+            pubReply[0] = 0x00; // Dummy
+            pubReply[1] = (ILI9488_MODEL_ID >> 16) & 0xFF;
+            pubReply[2] = (ILI9488_MODEL_ID >> 8) & 0xFF;
+            pubReply[3] = ILI9488_MODEL_ID & 0xFF;
+            ubReplyCount = 4;
+        }
+        break;
+    }
+}
+static void ili9488_model_param(uint8_t ubData)
+{
+    if(ubCommand == ILI9488_RAM_WR || ubCommand == ILI9488_RAM_WR_CONT)
+    {
+        pubPixel[ubPixelBytes++] = ubData;
+
+        if(ubPixelBytes == 3)
+        {
+            ubPixelBytes = 0;
+
+            ili9488_model_store_pixel();
+        }
+
+        return;
+    }
+
+    if(ubParamCount < ILI9488_MODEL_MAX_PARAM)
+        pubParam[ubParamCount++] = ubData;
+
+    switch(ubCommand)
+    {
+        case ILI9488_C_ADDR_SET:
+        {
+            if(ubParamCount != 4)
+                break;
+
+            usColumnStart = ((uint16_t)pubParam[0] << 8) | pubParam[1];
+            usColumnEnd = ((uint16_t)pubParam[2] << 8) | pubParam[3];
+        }
+        break;
+        case ILI9488_P_ADDR_SET:
+        {
+            if(ubParamCount != 4)
+                break;
+
+            usPageStart = ((uint16_t)pubParam[0] << 8) | pubParam[1];
+            usPageEnd = ((uint16_t)pubParam[2] << 8) | pubParam[3];
+
+            xStats.ulWindowSets++;
+        }
+        break;
+        case ILI9488_MEM_A_CTL:
+        {
+            if(ubParamCount == 1)
+                ubMADCTL = pubParam[0];
+        }
+        break;
+        case ILI9488_VSCRL_DEF:
+        {
+            if(ubParamCount != 6)
+                break;
+
+            usScrollTop = ((uint16_t)pubParam[0] << 8) | pubParam[1];
+            usScrollHeight = ((uint16_t)pubParam[2] << 8) | pubParam[3];
+        }
+        break;
+        case ILI9488_VSCRL_ADDR:
+        {
+            if(ubParamCount != 2)
+                break;
+
+            usScrollStart = ((uint16_t)pubParam[0] << 8) | pubParam[1];
+
+            xStats.ulScrollUpdates++;
+        }
+        break;
+    }
+}
+static uint8_t ili9488_model_spi(uint8_t ubData)
+{
+    if(gpio_host_read(GPIO_HOST_PIN_TFT_CS))
+        return 0xFF; // Not selected, MISO floats
+
+    xStats.ulBytes++;
+
+    if(!gpio_host_read(GPIO_HOST_PIN_TFT_DC))
+    {
+        ili9488_model_command(ubData);
+
+        return 0x00;
+    }
+
+    if(ubReplyIndex < ubReplyCount)
+        return pubReply[ubReplyIndex++];
+
+    ili9488_model_param(ubData);
+
+    return 0x00;
+}
+static void ili9488_model_reset_pin(uint8_t ubPin, uint8_t ubLevel)
+{
+    if(ubLevel)
+        return;
+
+    ili9488_model_command(ILI9488_SW_RESET); // Hardware reset leaves the same state
+
+    xStats.ulCommands--;
+}
+
+void ili9488_model_init()
+{
+    memset(pubFrame, 0, sizeof(pubFrame));
+    memset(&xStats, 0, sizeof(xStats));
+
+    ubCommand = ILI9488_NOP;
+    ubMADCTL = 0;
+    ubSleeping = 1;
+    ubDisplayOn = 0;
+    usColumnStart = 0;
+    usColumnEnd = ILI9488_MODEL_WIDTH - 1;
+    usPageStart = 0;
+    usPageEnd = ILI9488_MODEL_HEIGHT - 1;
+    usScrollTop = 0;
+    usScrollHeight = ILI9488_MODEL_HEIGHT;
+    usScrollStart = 0;
+
+    usart_host_attach(USART1, ili9488_model_spi);
+    gpio_host_set_listener(GPIO_HOST_PIN_TFT_RESET, ili9488_model_reset_pin);
+}
+
+void ili9488_model_get_stats(ili9488_model_stats_t *pStats)
+{
+    if(!pStats)
+        return;
+
+    *pStats = xStats;
+}
+void ili9488_model_reset_stats()
+{
+    memset(&xStats, 0, sizeof(xStats));
+}
+
+uint8_t ili9488_model_display_on()
+{
+    return ubDisplayOn;
+}
+uint8_t ili9488_model_sleeping()
+{
+    return ubSleeping;
+}
+
+void ili9488_model_snapshot(uint8_t *pubDst, uint16_t *pusWidth, uint16_t *pusHeight)
+{
+    uint16_t usWidth = ili9488_model_logical_width();
+    uint16_t usHeight = ili9488_model_logical_height();
+
+    for(uint16_t usRow = 0; usRow < usHeight; usRow++)
+    {
+        for(uint16_t usCol = 0; usCol < usWidth; usCol++)
+        {
+            uint16_t usX, usY;
+
+            ili9488_model_map(usCol, usRow, &usX, &usY);
+
+            // The panel shows memory line VSP on the first line of the scrolling area
+            if(usY >= usScrollTop && usY < usScrollTop + usScrollHeight && usScrollStart >= usScrollTop && usScrollStart < usScrollTop + usScrollHeight)
+                usY = usScrollTop + (usY - usScrollTop + usScrollStart - usScrollTop) % usScrollHeight;
+
+            memcpy(pubDst, &pubFrame[(usY * ILI9488_MODEL_WIDTH + usX) * 3], 3);
+
+            pubDst += 3;
+        }
+    }
+
+    if(pusWidth)
+        *pusWidth = usWidth;
+
+    if(pusHeight)
+        *pusHeight = usHeight;
+}
+uint8_t ili9488_model_write_png(const char *pszFile)
+{
+    static uint8_t pubImage[ILI9488_MODEL_WIDTH * ILI9488_MODEL_HEIGHT * 3];
+    uint16_t usWidth, usHeight;
+
+    ili9488_model_snapshot(pubImage, &usWidth, &usHeight);
+
+    return host_write_png(pszFile, pubImage, usWidth, usHeight);
+}
@@ -0,0 +1,58 @@
+#ifndef __ATOMIC_H__
+#define __ATOMIC_H__
+
+#include <em_device.h>
+
+// Same interface as the device version, interrupt masking only flips a flag
+// Simulated interrupts are only delivered between calls, the counter tells how often the code asked for a masked section
+
+extern volatile uint32_t g_ulHostMaskedSections;
+
+void host_irq_unmasked(); // Delivers whatever became pending while masked
+
+static inline uint32_t __iEnableIRQRetVal()
+{
+    g_ulHostPRIMASK = 0;
+
+    host_irq_unmasked();
+
+    return 1;
+}
+static inline uint32_t __iDisableIRQRetVal()
+{
+    g_ulHostPRIMASK = 1;
+    g_ulHostMaskedSections++;
+
+    return 1;
+}
+static inline void __iEnableIRQParam(const uint32_t *__s)
+{
+    g_ulHostPRIMASK = 0;
+
+    host_irq_unmasked();
+    (void)__s;
+}
+static inline void __iDisableIRQParam(const uint32_t *__s)
+{
+    g_ulHostPRIMASK = 1;
+    (void)__s;
+}
+static inline void __iRestore(const uint32_t *__s)
+{
+    if(*__s)
+        return;
+
+    g_ulHostPRIMASK = 0;
+
+    host_irq_unmasked();
+}
+
+#define ATOMIC_BLOCK(type) for (type, __ToDo = __iDisableIRQRetVal(); __ToDo; __ToDo = 0)
+#define NONATOMIC_BLOCK(type) for (type, __ToDo = __iEnableIRQRetVal(); __ToDo; __ToDo = 0)
+
+#define ATOMIC_RESTORESTATE uint32_t primask_save __attribute__((__cleanup__(__iRestore))) = __get_PRIMASK()
+#define ATOMIC_FORCEON uint32_t primask_save __attribute__((__cleanup__(__iEnableIRQParam))) = 0
+#define NONATOMIC_RESTORESTATE uint32_t primask_save __attribute__((__cleanup__(__iRestore))) = __get_PRIMASK()
+#define NONATOMIC_FORCEOFF uint32_t primask_save __attribute__((__cleanup__(__iDisableIRQParam))) = 0
+
+#endif  // __ATOMIC_H__
@@ -0,0 +1,14 @@
+#ifndef __DBG_H__
+#define __DBG_H__
+
+#include <em_device.h>
+#include "cmu.h"
+#include "utils.h"
+
+// No DWT on the host, the cycle counter runs off the monotonic clock in nanoseconds
+uint32_t host_cycle_counter();
+
+#define DEBUG_ENABLED() 0
+#define DBG_CYCLE_COUNTER() host_cycle_counter()
+
+#endif  // __DBG_H__
@@ -0,0 +1,196 @@
+#ifndef __EM_DEVICE_H__
+#define __EM_DEVICE_H__
+
+// Host stand-in for the Silicon Labs device header
+// Only the peripherals the host built modules touch are declared, they live in plain memory and the fakes in test/host drive them
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define __IM    volatile const
+#define __OM    volatile
+#define __IOM   volatile
+
+extern volatile uint32_t g_ulHostPRIMASK;
+
+static inline uint32_t __get_PRIMASK()
+{
+    return g_ulHostPRIMASK;
+}
+static inline void __DMB()
+{
+    __sync_synchronize();
+}
+
+// USART
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IOM uint32_t FRAME;
+    __IOM uint32_t TRIGCTRL;
+    __IOM uint32_t CMD;
+    __IM uint32_t STATUS;
+    __IOM uint32_t CLKDIV;
+    __IM uint32_t RXDATA;
+    __IOM uint32_t TXDATA;
+    __IOM uint32_t IF;
+    __IOM uint32_t IFC;
+    __IOM uint32_t IEN;
+    __IOM uint32_t ROUTEPEN;
+    __IOM uint32_t ROUTELOC0;
+} USART_TypeDef;
+
+extern USART_TypeDef g_xHostUSART1;
+extern USART_TypeDef g_xHostUSART3;
+
+#define USART1  (&g_xHostUSART1)
+#define USART3  (&g_xHostUSART3)
+
+#define USART_CMD_CLEARTX               (0x1UL << 10)
+#define USART_CMD_CLEARRX               (0x1UL << 11)
+#define USART_STATUS_TXC                (0x1UL << 5)
+#define USART_STATUS_TXBL               (0x1UL << 6)
+#define USART_STATUS_RXDATAV            (0x1UL << 7)
+#define _USART_STATUS_TXBUFCNT_MASK     0x3000000UL
+
+// LDMA
+#define DMA_CHAN_COUNT  24
+
+typedef struct
+{
+    __IOM uint32_t REQSEL;
+    __IOM uint32_t CFG;
+    __IOM uint32_t LOOP;
+    __IOM uint32_t CTRL;
+    __IOM uint32_t SRC;
+    __IOM uint32_t DST;
+    __IOM uint32_t LINK;
+} LDMA_CH_TypeDef;
+
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IM uint32_t STATUS;
+    __IOM uint32_t SYNC;
+    __IOM uint32_t CHEN;
+    __IM uint32_t CHBUSY;
+    __IOM uint32_t CHDONE;
+    __IOM uint32_t SWREQ;
+    __IOM uint32_t REQDIS;
+    __IOM uint32_t LINKLOAD;
+    __IOM uint32_t REQCLEAR;
+    __IM uint32_t IF;
+    __IOM uint32_t IFC;
+    __IOM uint32_t IEN;
+    LDMA_CH_TypeDef CH[DMA_CHAN_COUNT];
+} LDMA_TypeDef;
+
+extern LDMA_TypeDef g_xHostLDMA;
+
+#define LDMA    (&g_xHostLDMA)
+
+// Descriptor fields keep the device layout, the LDMA fake decodes them
+#define LDMA_CH_CTRL_STRUCTTYPE_TRANSFER    (0x0UL << 0)
+#define _LDMA_CH_CTRL_XFERCNT_SHIFT         4
+#define _LDMA_CH_CTRL_XFERCNT_MASK          0x7FF0UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_SHIFT       16
+#define _LDMA_CH_CTRL_BLOCKSIZE_MASK        0xF0000UL
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT1        (0x0UL << 16)
+#define LDMA_CH_CTRL_DONEIFSEN              (0x1UL << 20)
+#define LDMA_CH_CTRL_REQMODE_BLOCK          (0x0UL << 21)
+#define LDMA_CH_CTRL_DECLOOPCNT             (0x1UL << 22)
+#define _LDMA_CH_CTRL_SRCINC_SHIFT          24
+#define _LDMA_CH_CTRL_SRCINC_MASK           0x3000000UL
+#define LDMA_CH_CTRL_SRCINC_ONE             (0x0UL << 24)
+#define LDMA_CH_CTRL_SRCINC_NONE            (0x3UL << 24)
+#define _LDMA_CH_CTRL_SIZE_SHIFT            26
+#define _LDMA_CH_CTRL_SIZE_MASK             0xC000000UL
+#define LDMA_CH_CTRL_SIZE_BYTE              (0x0UL << 26)
+#define _LDMA_CH_CTRL_DSTINC_SHIFT          28
+#define _LDMA_CH_CTRL_DSTINC_MASK           0x30000000UL
+#define LDMA_CH_CTRL_DSTINC_ONE             (0x0UL << 28)
+#define LDMA_CH_CTRL_DSTINC_NONE            (0x3UL << 28)
+#define LDMA_CH_CTRL_SRCMODE_ABSOLUTE       (0x0UL << 30)
+#define LDMA_CH_CTRL_DSTMODE_ABSOLUTE       (0x0UL << 31)
+
+#define LDMA_CH_LINK_LINKMODE_ABSOLUTE      (0x0UL << 0)
+#define LDMA_CH_LINK_LINKMODE_RELATIVE      (0x1UL << 0)
+#define LDMA_CH_LINK_LINK                   (0x1UL << 1)
+#define _LDMA_CH_LINK_LINKADDR_MASK         0xFFFFFFFCUL
+
+#define _LDMA_CH_REQSEL_SIGSEL_MASK         0xFUL
+#define _LDMA_CH_REQSEL_SOURCESEL_MASK      0x3F0000UL
+#define LDMA_CH_REQSEL_SOURCESEL_USART1     (0x0DUL << 16)
+#define LDMA_CH_REQSEL_SOURCESEL_USART3     (0x0FUL << 16)
+#define LDMA_CH_REQSEL_SIGSEL_USART1RXDATAV (0x0UL << 0)
+#define LDMA_CH_REQSEL_SIGSEL_USART1TXBL    (0x1UL << 0)
+#define LDMA_CH_REQSEL_SIGSEL_USART3RXDATAV (0x0UL << 0)
+#define LDMA_CH_REQSEL_SIGSEL_USART3TXBL    (0x1UL << 0)
+
+#define LDMA_CH_CFG_ARBSLOTS_DEFAULT        (0x0UL << 16)
+#define LDMA_CH_CFG_SRCINCSIGN_DEFAULT      (0x0UL << 20)
+#define LDMA_CH_CFG_SRCINCSIGN_POSITIVE     (0x0UL << 20)
+#define LDMA_CH_CFG_DSTINCSIGN_DEFAULT      (0x0UL << 21)
+#define LDMA_CH_CFG_DSTINCSIGN_POSITIVE     (0x0UL << 21)
+
+#define LDMA_IF_ERROR                       (0x1UL << 31)
+
+// CMU and WTIMER, written by the backlight setup and never read back
+typedef struct
+{
+    __IOM uint32_t HFPERCLKEN0;
+    __IOM uint32_t HFPERCLKEN1;
+    __IOM uint32_t HFBUSCLKEN0;
+} CMU_TypeDef;
+
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IOM uint32_t CCV;
+    __IOM uint32_t CCVB;
+} TIMER_CC_TypeDef;
+
+typedef struct
+{
+    __IOM uint32_t CTRL;
+    __IOM uint32_t CMD;
+    __IOM uint32_t TOP;
+    __IOM uint32_t CNT;
+    __IOM uint32_t ROUTEPEN;
+    __IOM uint32_t ROUTELOC0;
+    TIMER_CC_TypeDef CC[4];
+} WTIMER_TypeDef;
+
+extern CMU_TypeDef g_xHostCMU;
+extern WTIMER_TypeDef g_xHostWTIMER2;
+
+#define CMU     (&g_xHostCMU)
+#define WTIMER2 (&g_xHostWTIMER2)
+
+#define CMU_HFPERCLKEN1_WTIMER2             (0x1UL << 2)
+#define WTIMER_CTRL_MODE_UP                 (0x0UL << 0)
+#define WTIMER_CTRL_RISEA_NONE              (0x0UL << 8)
+#define WTIMER_CTRL_FALLA_NONE              (0x0UL << 10)
+#define WTIMER_CTRL_CLKSEL_PRESCHFPERCLK    (0x0UL << 16)
+#define WTIMER_CTRL_PRESC_DIV1              (0x0UL << 24)
+#define WTIMER_CTRL_RSSCOIST                (0x1UL << 12)
+#define WTIMER_CC_CTRL_MODE_PWM             (0x3UL << 0)
+#define WTIMER_CC_CTRL_CMOA_CLEAR           (0x2UL << 10)
+#define WTIMER_CC_CTRL_COFOA_SET            (0x1UL << 12)
+#define WTIMER_CC_CTRL_CUFOA_NONE           (0x0UL << 14)
+#define WTIMER_CC_CTRL_PRSCONF_LEVEL        (0x1UL << 28)
+#define WTIMER_CMD_START                    (0x1UL << 0)
+#define WTIMER_ROUTEPEN_CC1PEN              (0x1UL << 1)
+#define WTIMER_ROUTELOC0_CC1LOC_LOC2        (0x2UL << 8)
+
+// QSPI flash, memory mapped on the device, a plain buffer on the host
+#define HOST_QSPI_FLASH_SIZE    0x100000UL
+
+extern uint8_t g_pubHostQSPIFlash[HOST_QSPI_FLASH_SIZE];
+
+#define QSPI0_MEM_BASE  ((uintptr_t)g_pubHostQSPIFlash)
+
+#endif  // __EM_DEVICE_H__
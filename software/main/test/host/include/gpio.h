@@ -0,0 +1,49 @@
+#ifndef __GPIO_H__
+#define __GPIO_H__
+
+#include <em_device.h>
+#include "cmu.h"
+#include "systick.h"
+#include "utils.h"
+#include "nvic.h"
+#include "rfm69.h"
+#include "ft6x36.h"
+#include "si7210.h"
+
+// Pins the host built modules drive, the fake hands every edge to whatever model listens on the pin
+#define GPIO_HOST_PIN_LED           0
+#define GPIO_HOST_PIN_RFM69_RESET   1
+#define GPIO_HOST_PIN_RFM69_CS      2
+#define GPIO_HOST_PIN_RFM69_DIO0    3
+#define GPIO_HOST_PIN_TFT_CS        4
+#define GPIO_HOST_PIN_TFT_DC        5
+#define GPIO_HOST_PIN_TFT_RESET     6
+#define GPIO_HOST_PIN_COUNT         7
+
+typedef void (* gpio_host_listener_fn_t)(uint8_t, uint8_t); // Pin, level
+
+void gpio_host_write(uint8_t ubPin, uint8_t ubLevel);
+uint8_t gpio_host_read(uint8_t ubPin);
+void gpio_host_set_listener(uint8_t ubPin, gpio_host_listener_fn_t pfListener);
+
+// LED MACROS
+#define LED_HIGH()          gpio_host_write(GPIO_HOST_PIN_LED, 1)
+#define LED_LOW()           gpio_host_write(GPIO_HOST_PIN_LED, 0)
+#define LED_TOGGLE()        gpio_host_write(GPIO_HOST_PIN_LED, !gpio_host_read(GPIO_HOST_PIN_LED))
+
+// RFM69 MACROS
+#define RFM69_UNRESET()     gpio_host_write(GPIO_HOST_PIN_RFM69_RESET, 0)
+#define RFM69_RESET()       gpio_host_write(GPIO_HOST_PIN_RFM69_RESET, 1)
+#define RFM69_SELECT()      gpio_host_write(GPIO_HOST_PIN_RFM69_CS, 0)
+#define RFM69_UNSELECT()    gpio_host_write(GPIO_HOST_PIN_RFM69_CS, 1)
+#define RFM69_IRQ()         gpio_host_read(GPIO_HOST_PIN_RFM69_DIO0)
+
+// TFT MACROS
+#define ILI9488_SELECT()    gpio_host_write(GPIO_HOST_PIN_TFT_CS, 0)
+#define ILI9488_UNSELECT()  gpio_host_write(GPIO_HOST_PIN_TFT_CS, 1)
+#define ILI9488_SETUP_DAT() gpio_host_write(GPIO_HOST_PIN_TFT_DC, 1)
+#define ILI9488_SETUP_CMD() gpio_host_write(GPIO_HOST_PIN_TFT_DC, 0)
+#define TFT_RESET()         gpio_host_write(GPIO_HOST_PIN_TFT_RESET, 0)
+#define TFT_UNRESET()       gpio_host_write(GPIO_HOST_PIN_TFT_RESET, 1)
+
+#endif  // __GPIO_H__
@@ -0,0 +1,56 @@
+#ifndef __HOST_H__
+#define __HOST_H__
+
+#include <em_device.h>
+#include "atomic.h"
+#include "utils.h"
+#include "systick.h"
+#include "gpio.h"
+#include "ldma.h"
+#include "usart.h"
+
+#define HOST_TICK_HOOKS     4
+#define HOST_IRQ_SOURCES    4
+
+typedef void (* host_tick_hook_fn_t)(); // Runs once per simulated millisecond, like the SysTick interrupt
+typedef void (* host_irq_source_fn_t)(); // Delivers the interrupts a model raised while they were masked
+
+void host_advance(uint32_t ulMilliseconds);
+uint8_t host_add_tick_hook(host_tick_hook_fn_t pfHook); // Adding a hook twice is a no-op
+void host_clear_tick_hooks();
+uint8_t host_add_irq_source(host_irq_source_fn_t pfSource); // Polled every time interrupts are unmasked, after the LDMA
+void host_clear_irq_sources();
+
+void host_trng_seed(uint32_t ulSeed);
+
+uint64_t host_time_ns(); // Wall clock of the host, for throughput figures
+
+uint8_t host_write_png(const char *pszFile, const uint8_t *pubRGB, uint16_t usWidth, uint16_t usHeight); // 8 bit RGB, stored deflate blocks
+
+// LDMA fake
+// Channels run to completion when loaded unless they are deferred, then they only move when stepped or when code polls an LDMA register
+void ldma_host_set_deferred(uint32_t ulChannelMask);
+uint32_t ldma_host_step(uint32_t ulUnits); // Returns the units moved
+uint8_t ldma_host_is_active(uint8_t ubChannel);
+void ldma_host_reset();
+void ldma_host_irq_unmasked();
+ldma_ch_isr_t ldma_host_get_isr(uint8_t ubChannel);
+
+// USART fake
+typedef uint8_t (* usart_host_spi_fn_t)(uint8_t); // Byte clocked out, returns the byte clocked in
+
+typedef struct
+{
+    uint32_t ulBytes;
+    uint32_t ulDMABytes;
+    uint32_t ulRXOverflows; // Bytes dropped because nobody read the RX buffer in time
+} usart_host_stats_t;
+
+void usart_host_attach(USART_TypeDef *pUSART, usart_host_spi_fn_t pfDevice);
+void usart_host_get_stats(USART_TypeDef *pUSART, usart_host_stats_t *pStats);
+uint8_t usart_host_dma_request(USART_TypeDef *pUSART, uint32_t ulSignal); // LDMA_CH_REQSEL_SIGSEL_*
+uint8_t usart_host_dma_read(volatile void *pAddress, uint8_t *pubData); // Returns 0 if the address is not a USART register
+uint8_t usart_host_dma_write(volatile void *pAddress, uint8_t ubData);
+USART_TypeDef* usart_host_from_source(uint32_t ulSource); // LDMA_CH_REQSEL_SOURCESEL_*
+
+#endif  // __HOST_H__
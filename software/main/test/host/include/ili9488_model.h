@@ -0,0 +1,35 @@
+#ifndef __ILI9488_MODEL_H__
+#define __ILI9488_MODEL_H__
+
+#include "host.h"
+#include "ili9488.h"
+
+// ILI9488 model on USART1, decodes the command stream into a frame memory like the panel does
+// Frame memory is kept in panel native order, 320 x 480, 3 bytes per pixel with the low 2 bits of every component dropped like on the 18 bit bus
+
+#define ILI9488_MODEL_ID 0x009488
+
+typedef struct ili9488_model_stats_t ili9488_model_stats_t;
+
+struct ili9488_model_stats_t
+{
+    uint32_t ulBytes; // Everything clocked in while selected
+    uint32_t ulCommands;
+    uint32_t ulWindowSets; // Column and page address pairs
+    uint32_t ulPixelWrites;
+    uint32_t ulScrollUpdates;
+};
+
+void ili9488_model_init();
+
+void ili9488_model_get_stats(ili9488_model_stats_t *pStats);
+void ili9488_model_reset_stats();
+
+uint8_t ili9488_model_display_on();
+uint8_t ili9488_model_sleeping();
+
+// Frame as the viewer sees it, scroll applied and memory access control undone, pubDst needs 320 * 480 * 3 bytes
+void ili9488_model_snapshot(uint8_t *pubDst, uint16_t *pusWidth, uint16_t *pusHeight);
+uint8_t ili9488_model_write_png(const char *pszFile);
+
+#endif  // __ILI9488_MODEL_H__
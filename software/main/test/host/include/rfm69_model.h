@@ -0,0 +1,91 @@
+#ifndef __RFM69_MODEL_H__
+#define __RFM69_MODEL_H__
+
+#include "host.h"
+#include "rfm69.h"
+
+// RFM69 (SX1231) model on USART3, register file, FIFO, operating modes and DIO0 the way the driver uses them
+// Several models can share the simulated air, only the selected one answers on the bus and follows the chip select and reset pins
+// Time comes from g_ullSystemTick, transmissions take the airtime the modem registers give and end in the tick hook
+
+#define RFM69_MODEL_FIFO_SIZE           66
+#define RFM69_MODEL_MAX_NODES           32
+#define RFM69_MODEL_VERSION             0x24
+#define RFM69_MODEL_DEFAULT_PATH_LOSS   80      // dB - Between the TX power and the RSSI at the receiver
+#define RFM69_MODEL_DEFAULT_NOISE       -115    // dBm - RSSI with nothing on air
+#define RFM69_MODEL_SENSITIVITY         -110    // dBm - Weaker frames are not received but still count for carrier sense
+
+typedef struct rfm69_model_t rfm69_model_t;
+typedef struct rfm69_model_stats_t rfm69_model_stats_t;
+typedef void (* rfm69_model_irq_fn_t)(rfm69_model_t *); // DIO0 rising edge, runs as the GPIO interrupt would
+typedef void (* rfm69_model_tx_fn_t)(rfm69_model_t *, const uint8_t *, uint8_t, int8_t); // Frame that left the antenna (after the length byte), TX power in dBm
+
+struct rfm69_model_stats_t
+{
+    uint32_t ulTransactions; // Chip select cycles with at least one byte
+    uint32_t ulBytes; // Clocked while selected, addresses included
+    uint32_t ulRegisterReads;
+    uint32_t ulRegisterWrites;
+    uint32_t ulFIFOReads;
+    uint32_t ulFIFOWrites;
+    uint32_t ulModeChanges;
+    uint32_t ulFramesSent;
+    uint32_t ulFramesReceived; // PayloadReady raised
+    uint32_t ulFramesMissed; // Arrived while not listening, with a stale FIFO or below sensitivity
+    uint32_t ulCollisions; // Frames lost to another one overlapping at this receiver
+    uint32_t ulIRQs; // DIO0 rising edges
+    uint64_t ullTXTime; // us
+};
+struct rfm69_model_t
+{
+    uint8_t pubRegisters[RFM69_REGISTER_COUNT];
+    uint8_t pubFIFO[RFM69_MODEL_FIFO_SIZE];
+    uint8_t ubFIFOHead;
+    uint8_t ubFIFOCount;
+    uint8_t ubFIFOOverrun;
+    uint8_t ubAddress; // Current transaction, auto-increments except on the FIFO
+    uint8_t ubWrite;
+    uint8_t ubAddressed; // Address byte seen in this transaction
+    uint8_t ubMode;
+    uint64_t ullModeReady; // us
+    uint8_t ubPacketSent;
+    uint8_t ubPayloadReady;
+    uint8_t ubDIO0;
+    uint8_t ubIRQPending; // Rising edge while interrupts were masked
+    uint64_t ullTXStart; // us - 0 if no frame is waiting to go on air
+    uint64_t ullTXEnd; // us - 0 if not transmitting
+    uint8_t pubTXFrame[RFM69_MODEL_FIFO_SIZE];
+    uint8_t ubTXFrameSize;
+    rfm69_model_t *pRXFrom; // Transmitter the receiver locked onto, NULL if none
+    uint8_t ubRXCorrupted;
+    int8_t bRXRSSI;
+    // Knobs, set after rfm69_model_init()
+    int8_t bNoise; // dBm
+    uint8_t ubPathLoss; // dB - From any transmitter to this receiver
+    uint32_t ulModeReadyDelay; // us - From a mode change until ModeReady
+    uint32_t ulWakeDelay; // us - ModeReady delay when leaving sleep
+    uint32_t ulTXStartDelay; // us - From a frame being ready in TX until it is on air, others sense a free channel meanwhile
+    uint8_t ubSuppressPacketSent; // Frames still go out but PacketSent never rises
+    rfm69_model_irq_fn_t pfIRQ;
+    rfm69_model_tx_fn_t pfTX;
+    void *pvUser;
+    rfm69_model_stats_t xStats;
+};
+
+void rfm69_model_air_reset(); // Detaches every model, also (re)installs the tick hook and the interrupt source
+void rfm69_model_init(rfm69_model_t *pModel); // Power on reset, joins the air
+void rfm69_model_select(rfm69_model_t *pModel); // Model wired to USART3 and the RFM69 pins
+rfm69_model_t* rfm69_model_get_selected();
+
+void rfm69_model_tick(); // Ends transmissions, done by the tick hook every simulated millisecond
+
+uint8_t rfm69_model_inject(rfm69_model_t *pModel, const uint8_t *pubPayload, uint8_t ubSize, int8_t bRSSI); // Frame from outside the air, received at once, 0 if the radio could not take it
+uint8_t rfm69_model_is_listening(rfm69_model_t *pModel); // In RX with an empty FIFO and no frame being received
+uint8_t rfm69_model_get_mode(rfm69_model_t *pModel); // RFM69_REG_OPMODE_*
+int8_t rfm69_model_get_tx_power(rfm69_model_t *pModel); // dBm, decoded from the PA registers
+uint32_t rfm69_model_get_airtime(rfm69_model_t *pModel, uint8_t ubPayloadSize); // us, at the current modem settings
+uint8_t rfm69_model_air_busy(); // Any model transmitting
+
+void rfm69_model_reset_stats(rfm69_model_t *pModel);
+
+#endif  // __RFM69_MODEL_H__
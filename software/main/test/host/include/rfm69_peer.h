@@ -0,0 +1,62 @@
+#ifndef __RFM69_PEER_H__
+#define __RFM69_PEER_H__
+
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69.h"
+
+// Scripted remote node for the radio stack under test, it speaks the packet format without running a second driver
+// Hears the frames the model transmits, answers ACK requests on its own and hands every message (aggregates split) to pfRX
+// Its own frames are queued and injected into the model once it listens, each direction has its own loss rate
+
+#define RFM69_PEER_QUEUE_SIZE   64
+#define RFM69_PEER_MAX_PEERS    8
+#define RFM69_PEER_LOSS_SCALE   1000    // Loss rates are per mille
+
+typedef struct rfm69_peer_t rfm69_peer_t;
+typedef struct rfm69_peer_stats_t rfm69_peer_stats_t;
+typedef void (* rfm69_peer_rx_fn_t)(rfm69_peer_t *, const rfm69_packet_header_t *, const uint8_t *, uint8_t); // Message addressed to the peer
+typedef int8_t (* rfm69_peer_rssi_fn_t)(rfm69_peer_t *, int8_t); // TX power of the model in dBm, returns the RSSI the peer hears it at, -128 to lose the frame
+
+struct rfm69_peer_stats_t
+{
+    uint32_t ulFramesHeard; // Addressed to the peer and not lost
+    uint32_t ulFramesLost; // Addressed to the peer, lost on the way in
+    uint32_t ulMessages; // Handed to pfRX
+    uint32_t ulACKsSent;
+    uint32_t ulFramesSent; // Reached the model
+    uint32_t ulFramesDropped; // Lost on the way out
+    uint32_t ulQueueFull;
+};
+struct rfm69_peer_t
+{
+    uint8_t ubNodeID;
+    uint16_t usNextID;
+    uint32_t ulRandom;
+    int8_t bLastRSSI; // Model frame as heard by the peer, reported back in the header
+    uint8_t pubQueue[RFM69_PEER_QUEUE_SIZE][RFM69_MAX_PAYLOAD_SIZE];
+    uint8_t pubQueueSize[RFM69_PEER_QUEUE_SIZE];
+    uint8_t ubQueueHead;
+    uint8_t ubQueueCount;
+    // Knobs, set after rfm69_peer_init()
+    uint16_t usLossIn; // Per mille, model to peer
+    uint16_t usLossOut; // Per mille, peer to model
+    int8_t bRSSI; // dBm - Peer frames at the model
+    uint8_t ubAutoACK; // Answer QoS 1 ACK requests
+    rfm69_peer_rx_fn_t pfRX;
+    rfm69_peer_rssi_fn_t pfRSSI;
+    void *pvUser;
+    rfm69_peer_stats_t xStats;
+};
+
+void rfm69_peer_attach(rfm69_model_t *pModel); // Model the peers talk to, takes over its pfTX and detaches every peer
+void rfm69_peer_init(rfm69_peer_t *pPeer, uint8_t ubNodeID, uint32_t ulSeed);
+
+void rfm69_peer_tick(); // Injects queued frames, done by the tick hook every simulated millisecond
+
+uint8_t rfm69_peer_send(rfm69_peer_t *pPeer, const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubSize); // Queues a frame as is, the header is packed like the driver does
+uint8_t rfm69_peer_send_data(rfm69_peer_t *pPeer, uint8_t ubReceiver, const void *pvData, uint8_t ubSize); // QoS 0 data frame with the next packet ID
+uint8_t rfm69_peer_chance(rfm69_peer_t *pPeer, uint16_t usPerMille); // 1 with the given probability, from the peer's own generator
+uint8_t rfm69_peer_pending(rfm69_peer_t *pPeer); // Frames still queued
+
+#endif  // __RFM69_PEER_H__
@@ -0,0 +1,44 @@
+#ifndef __UTILS_H__
+#define __UTILS_H__
+
+#include <em_device.h>
+
+// Memory sections & aliases, everything is ordinary code and data on the host
+#define RAM_CODE
+#define BOOT_CODE
+#define QSPI_CODE
+#define USER_DATA
+#define QSPI_DATA
+
+// Macro to make a dummy read
+#define REG_DISCARD(reg) __asm__ volatile ("" : : "r" (*(volatile uint32_t *)(reg)))
+
+// No bit band alias on the host, bit reads go through the fakes so polling a register lets the simulated hardware make progress
+uint8_t host_peri_reg_bit(volatile uint32_t *pulRegister, uint8_t ubBit);
+
+#define PERI_REG_BIT(reg, bit)              host_peri_reg_bit((volatile uint32_t *)(reg), (bit))
+
+// Macro to get the bit value
+#define BIT(x) (1 << (x))
+
+// Printf macros to print bits
+#define UINT8BITSTR         "%c%c%c%c%c%c%c%c"
+#define UINT16BITSTR        UINT8BITSTR UINT8BITSTR
+#define UINT32BITSTR        UINT16BITSTR UINT16BITSTR
+#define UINT64BITSTR        UINT32BITSTR UINT32BITSTR
+#define UINT82BITSTR(b)     ((b) & 0x80 ? '1' : '0'), ((b) & 0x40 ? '1' : '0'), ((b) & 0x20 ? '1' : '0'), ((b) & 0x10 ? '1' : '0'), ((b) & 0x08 ? '1' : '0'), ((b) & 0x04 ? '1' : '0'), ((b) & 0x02 ? '1' : '0'), ((b) & 0x01 ? '1' : '0')
+#define UINT162BITSTR(b)    UINT82BITSTR(((b) >> 8) & 0xFF), UINT82BITSTR(((b) >> 0) & 0xFF)
+#define UINT322BITSTR(b)    UINT162BITSTR(((b) >> 16) & 0xFFFF), UINT162BITSTR(((b) >> 0) & 0xFFFF)
+#define UINT642BITSTR(b)    UINT322BITSTR(((b) >> 32) & 0xFFFFFFFF), UINT322BITSTR(((b) >> 0) & 0xFFFFFFFF)
+
+// Absolute value of
+#define ABS(a)      ((a) < 0 ? (-(a)) : (a))
+
+// Minimum and maximum of
+#define MIN(a, b)   ((a) < (b) ? (a) : (b))
+#define MAX(a, b)   ((a) > (b) ? (a) : (b))
+
+// Swap two variables
+#define SWAP(a, b)  do{ typeof(a) SWAP = a; a = b; b = SWAP; }while(0)
+
+#endif  // __UTILS_H__
@@ -0,0 +1,378 @@
+#include "host.h"
+
+// LDMA fake, interprets the same descriptors the device would fetch
+// One unit moves per requesting channel per round, lower channel numbers first, so paired RX/TX channels interleave like on the bus
+
+typedef struct
+{
+    uint8_t ubEnabled;
+    uint8_t ubActive;
+    uint8_t ubLoopCount;
+    uint32_t ulRequest;
+    ldma_descriptor_t *pDescriptor;
+    uint32_t ulCtrl;
+    volatile uint8_t *pubSrc;
+    volatile uint8_t *pubDst;
+    uint32_t ulUnitsLeft;
+    ldma_ch_isr_t pfISR;
+} ldma_host_channel_t;
+
+LDMA_TypeDef g_xHostLDMA;
+
+static ldma_host_channel_t pChannels[DMA_CHAN_COUNT];
+static uint32_t ulDeferredMask = 0;
+static uint32_t ulPendingIRQ = 0;
+static uint8_t ubRunning = 0;
+
+static void ldma_host_fetch(uint8_t ubChannel, ldma_descriptor_t *pDescriptor)
+{
+    ldma_host_channel_t *pChannel = &pChannels[ubChannel];
+
+    if((pDescriptor->CTRL & 3) != LDMA_CH_CTRL_STRUCTTYPE_TRANSFER)
+    {
+        fprintf(stderr, "LDMA fake: channel %hhu only supports transfer descriptors\n", ubChannel);
+
+        abort();
+    }
+
+    pChannel->pDescriptor = pDescriptor;
+    pChannel->ulCtrl = pDescriptor->CTRL;
+    pChannel->pubSrc = (volatile uint8_t *)pDescriptor->SRC;
+    pChannel->pubDst = (volatile uint8_t *)pDescriptor->DST;
+    pChannel->ulUnitsLeft = ((pChannel->ulCtrl & _LDMA_CH_CTRL_XFERCNT_MASK) >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1;
+    pChannel->ubActive = 1;
+
+    LDMA->CH[ubChannel].CTRL = pChannel->ulCtrl;
+    LDMA->CH[ubChannel].LINK = pDescriptor->LINK;
+}
+static void ldma_host_descriptor_done(uint8_t ubChannel)
+{
+    ldma_host_channel_t *pChannel = &pChannels[ubChannel];
+    ldma_descriptor_t *pDescriptor = pChannel->pDescriptor;
+    uint32_t ulLink = pDescriptor->LINK;
+
+    if(pChannel->ulCtrl & LDMA_CH_CTRL_DONEIFSEN)
+    {
+        ulPendingIRQ |= BIT(ubChannel);
+        *(volatile uint32_t *)&LDMA->IF |= BIT(ubChannel);
+    }
+
+    if(pChannel->ulCtrl & LDMA_CH_CTRL_DECLOOPCNT)
+    {
+        if(!pChannel->ubLoopCount)
+        {
+            ldma_host_fetch(ubChannel, pDescriptor + 1); // Loop ran out, continue with the next descriptor in memory
+
+            return;
+        }
+
+        pChannel->ubLoopCount--;
+    }
+
+    if(!(ulLink & LDMA_CH_LINK_LINK))
+    {
+        pChannel->ubActive = 0;
+
+        LDMA->CHDONE |= BIT(ubChannel);
+        *(volatile uint32_t *)&LDMA->CHBUSY &= ~BIT(ubChannel);
+
+        return;
+    }
+
+    if(!(ulLink & LDMA_CH_LINK_LINKMODE_RELATIVE))
+    {
+        fprintf(stderr, "LDMA fake: channel %hhu uses an absolute link, descriptors above 4 GB cannot be addressed\n", ubChannel);
+
+        abort();
+    }
+
+    ldma_host_fetch(ubChannel, (ldma_descriptor_t *)((uint8_t *)pDescriptor + (int32_t)(ulLink & _LDMA_CH_LINK_LINKADDR_MASK)));
+}
+static uint8_t ldma_host_requesting(uint8_t ubChannel)
+{
+    ldma_host_channel_t *pChannel = &pChannels[ubChannel];
+
+    if(!pChannel->ubEnabled || !pChannel->ubActive)
+        return 0;
+
+    if(!pChannel->ulRequest)
+        return 1; // Memory to memory
+
+    if(LDMA->REQDIS & BIT(ubChannel))
+        return 0;
+
+    return usart_host_dma_request(usart_host_from_source(pChannel->ulRequest), pChannel->ulRequest & _LDMA_CH_REQSEL_SIGSEL_MASK);
+}
+static void ldma_host_move_unit(uint8_t ubChannel)
+{
+    ldma_host_channel_t *pChannel = &pChannels[ubChannel];
+    uint8_t ubSize = 1 << ((pChannel->ulCtrl & _LDMA_CH_CTRL_SIZE_MASK) >> _LDMA_CH_CTRL_SIZE_SHIFT);
+    uint8_t ubSrcInc = (pChannel->ulCtrl & _LDMA_CH_CTRL_SRCINC_MASK) >> _LDMA_CH_CTRL_SRCINC_SHIFT;
+    uint8_t ubDstInc = (pChannel->ulCtrl & _LDMA_CH_CTRL_DSTINC_MASK) >> _LDMA_CH_CTRL_DSTINC_SHIFT;
+
+    for(uint8_t i = 0; i < ubSize; i++)
+    {
+        uint8_t ubData;
+
+        if(!usart_host_dma_read(pChannel->pubSrc + i, &ubData))
+            ubData = pChannel->pubSrc[i];
+
+        if(!usart_host_dma_write(pChannel->pubDst + i, ubData))
+            pChannel->pubDst[i] = ubData;
+    }
+
+    if(ubSrcInc != 3)
+        pChannel->pubSrc += ubSize << ubSrcInc;
+
+    if(ubDstInc != 3)
+        pChannel->pubDst += ubSize << ubDstInc;
+
+    if(!--pChannel->ulUnitsLeft)
+        ldma_host_descriptor_done(ubChannel);
+}
+static uint32_t ldma_host_round(uint32_t ulChannelMask)
+{
+    uint32_t ulMoved = 0;
+
+    for(uint8_t ubChannel = 0; ubChannel < DMA_CHAN_COUNT; ubChannel++)
+    {
+        if(!(ulChannelMask & BIT(ubChannel)) || !ldma_host_requesting(ubChannel))
+            continue;
+
+        ldma_host_move_unit(ubChannel);
+
+        ulMoved++;
+    }
+
+    return ulMoved;
+}
+static uint8_t ldma_host_deliver_irq()
+{
+    if(g_ulHostPRIMASK || !ulPendingIRQ)
+        return 0;
+
+    while(ulPendingIRQ)
+    {
+        uint8_t ubChannel = __builtin_ctz(ulPendingIRQ);
+
+        ulPendingIRQ &= ~BIT(ubChannel);
+        *(volatile uint32_t *)&LDMA->IF &= ~BIT(ubChannel);
+
+        if(pChannels[ubChannel].pfISR)
+            pChannels[ubChannel].pfISR(0);
+    }
+
+    return 1;
+}
+static void ldma_host_run()
+{
+    if(ubRunning)
+        return; // Loaded from a completion interrupt, the outer run picks it up
+
+    ubRunning = 1;
+
+    uint8_t ubProgress;
+
+    do
+    {
+        ubProgress = 0;
+
+        while(ldma_host_round(~ulDeferredMask))
+            ubProgress = 1;
+
+        if(ldma_host_deliver_irq())
+            ubProgress = 1;
+    } while(ubProgress);
+
+    ubRunning = 0;
+}
+
+void ldma_host_irq_unmasked()
+{
+    ldma_host_run();
+}
+
+void ldma_host_set_deferred(uint32_t ulChannelMask)
+{
+    ulDeferredMask = ulChannelMask;
+}
+uint32_t ldma_host_step(uint32_t ulUnits)
+{
+    uint32_t ulMoved = 0;
+
+    while(ulMoved < ulUnits)
+    {
+        uint32_t ulRound = ldma_host_round(0xFFFFFFFF);
+
+        if(!ulRound)
+            break;
+
+        ulMoved += ulRound;
+    }
+
+    ldma_host_run();
+
+    return ulMoved;
+}
+uint8_t ldma_host_is_active(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return 0;
+
+    return pChannels[ubChannel].ubActive;
+}
+ldma_ch_isr_t ldma_host_get_isr(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return NULL;
+
+    return pChannels[ubChannel].pfISR;
+}
+void ldma_host_reset()
+{
+    memset(pChannels, 0, sizeof(pChannels));
+    memset(&g_xHostLDMA, 0, sizeof(g_xHostLDMA));
+
+    ulDeferredMask = 0;
+    ulPendingIRQ = 0;
+}
+
+void ldma_init()
+{
+    ldma_host_reset();
+}
+
+void ldma_sync_set(uint8_t ubMask)
+{
+    LDMA->SYNC |= ubMask;
+}
+void ldma_sync_clear(uint8_t ubMask)
+{
+    LDMA->SYNC &= ~ubMask;
+}
+
+void ldma_ch_config(uint8_t ubChannel, uint32_t ulSource, uint32_t ulSrcIncSign, uint32_t ulDstIncSign, uint32_t ulArbitrationSlots, uint8_t ubLoopCount)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    LDMA->CH[ubChannel].REQSEL = ulSource;
+    LDMA->CH[ubChannel].CFG = ulDstIncSign | ulSrcIncSign | ulArbitrationSlots;
+    LDMA->CH[ubChannel].LOOP = ubLoopCount;
+
+    pChannels[ubChannel].ulRequest = ulSource;
+    pChannels[ubChannel].ubLoopCount = ubLoopCount;
+}
+void ldma_ch_set_isr(uint8_t ubChannel, ldma_ch_isr_t pfISR)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    pChannels[ubChannel].pfISR = pfISR;
+}
+void ldma_ch_set_loop_count(uint8_t ubChannel, uint8_t ubLoopCount)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    LDMA->CH[ubChannel].LOOP = ubLoopCount;
+
+    pChannels[ubChannel].ubLoopCount = ubLoopCount;
+}
+void ldma_ch_load(uint8_t ubChannel, ldma_descriptor_t *pDescriptor)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    if(!pDescriptor)
+        return;
+
+    if((uintptr_t)pDescriptor & 3) // Descriptors must be word aligned
+        return;
+
+    LDMA->CHDONE &= ~BIT(ubChannel);
+    *(volatile uint32_t *)&LDMA->CHBUSY |= BIT(ubChannel);
+
+    ldma_host_fetch(ubChannel, pDescriptor);
+
+    if(!(ulDeferredMask & BIT(ubChannel)))
+        ldma_host_run();
+}
+void ldma_ch_sw_req(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    if(!(ulDeferredMask & BIT(ubChannel)))
+        ldma_host_run();
+}
+void ldma_ch_enable(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    LDMA->CHEN |= BIT(ubChannel);
+
+    pChannels[ubChannel].ubEnabled = 1;
+}
+void ldma_ch_disable(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    LDMA->CHEN &= ~BIT(ubChannel);
+
+    pChannels[ubChannel].ubEnabled = 0;
+    pChannels[ubChannel].ubActive = 0; // Disabling aborts the transfer in progress
+
+    *(volatile uint32_t *)&LDMA->CHBUSY &= ~BIT(ubChannel);
+}
+void ldma_ch_peri_req_enable(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    LDMA->REQDIS &= ~BIT(ubChannel);
+}
+void ldma_ch_peri_req_disable(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    LDMA->REQDIS |= BIT(ubChannel);
+}
+void ldma_ch_req_clear(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return;
+
+    LDMA->REQCLEAR = BIT(ubChannel);
+}
+uint8_t ldma_ch_get_busy(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return 0;
+
+    return pChannels[ubChannel].ubActive;
+}
+uint16_t ldma_ch_get_remaining_xfers(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT || !pChannels[ubChannel].ubActive)
+        return 0;
+
+    return pChannels[ubChannel].ulUnitsLeft;
+}
+void* ldma_ch_get_next_src_addr(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return NULL;
+
+    return (void *)pChannels[ubChannel].pubSrc;
+}
+void* ldma_ch_get_next_dst_addr(uint8_t ubChannel)
+{
+    if(ubChannel >= DMA_CHAN_COUNT)
+        return NULL;
+
+    return (void *)pChannels[ubChannel].pubDst;
+}
@@ -0,0 +1,688 @@
+#include "rfm69_model.h"
+
+// Reset values from the SX1231 datasheet, registers not listed reset to zero
+static const uint8_t pubResetValues[RFM69_REGISTER_COUNT] = {
+    [RFM69_REG_OPMODE] = RFM69_REG_OPMODE_STANDBY,
+    [RFM69_REG_BITRATEMSB] = 0x1A,
+    [RFM69_REG_BITRATELSB] = 0x0B,
+    [RFM69_REG_FDEVLSB] = 0x52,
+    [RFM69_REG_FRFMSB] = 0xE4,
+    [RFM69_REG_FRFMID] = 0xC0,
+    [RFM69_REG_OSC1] = 0x41,
+    [RFM69_REG_AFCCTRL] = 0x40,
+    [RFM69_REG_LOWBAT] = 0x02,
+    [RFM69_REG_LISTEN1] = 0x92,
+    [RFM69_REG_LISTEN2] = 0xF5,
+    [RFM69_REG_LISTEN3] = 0x20,
+    [RFM69_REG_VERSION] = RFM69_MODEL_VERSION,
+    [RFM69_REG_PALEVEL] = 0x9F,
+    [RFM69_REG_PARAMP] = 0x09,
+    [RFM69_REG_OCP] = 0x1A,
+    [RFM69_REG_AGCREF] = 0x40,
+    [RFM69_REG_AGCTHRESH1] = 0xB0,
+    [RFM69_REG_AGCTHRESH2] = 0x7B,
+    [RFM69_REG_AGCTHRESH3] = 0x9B,
+    [RFM69_REG_LNA] = 0x08,
+    [RFM69_REG_RXBW] = 0x86,
+    [RFM69_REG_AFCBW] = 0x8A,
+    [RFM69_REG_OOKPEAK] = 0x40,
+    [RFM69_REG_OOKAVG] = 0x80,
+    [RFM69_REG_OOKFIX] = 0x06,
+    [RFM69_REG_AFCFEI] = 0x10,
+    [RFM69_REG_RSSICONFIG] = 0x02,
+    [RFM69_REG_RSSIVALUE] = 0xFF,
+    [RFM69_REG_DIOMAPPING2] = 0x05,
+    [RFM69_REG_IRQFLAGS1] = RFM69_REG_IRQFLAGS1_MODEREADY,
+    [RFM69_REG_RSSITHRESH] = 0xE4,
+    [RFM69_REG_PREAMBLELSB] = 0x03,
+    [RFM69_REG_SYNCCONFIG] = 0x98,
+    [RFM69_REG_SYNCVALUE1] = 0x01,
+    [RFM69_REG_SYNCVALUE2] = 0x01,
+    [RFM69_REG_SYNCVALUE3] = 0x01,
+    [RFM69_REG_SYNCVALUE4] = 0x01,
+    [RFM69_REG_SYNCVALUE5] = 0x01,
+    [RFM69_REG_SYNCVALUE6] = 0x01,
+    [RFM69_REG_SYNCVALUE7] = 0x01,
+    [RFM69_REG_SYNCVALUE8] = 0x01,
+    [RFM69_REG_PACKETCONFIG1] = 0x10,
+    [RFM69_REG_PAYLOADLENGTH] = 0x40,
+    [RFM69_REG_FIFOTHRESH] = 0x0F,
+    [RFM69_REG_PACKETCONFIG2] = 0x02,
+    [RFM69_REG_TEMP1] = 0x01,
+    [RFM69_REG_TEMP2] = 0xB4,
+    [RFM69_REG_TESTLNA] = 0x1B,
+    [RFM69_REG_TESTPA1] = 0x55,
+    [RFM69_REG_TESTPA2] = 0x70,
+    [RFM69_REG_TESTDAGC] = 0x30
+};
+
+static rfm69_model_t *pModels[RFM69_MODEL_MAX_NODES];
+static uint8_t ubModelCount = 0;
+static rfm69_model_t *pSelected = NULL;
+
+static inline uint64_t rfm69_model_now()
+{
+    return g_ullSystemTick * 1000; // us
+}
+
+static void rfm69_model_fifo_clear(rfm69_model_t *pModel)
+{
+    pModel->ubFIFOHead = 0;
+    pModel->ubFIFOCount = 0;
+    pModel->ubFIFOOverrun = 0;
+}
+static void rfm69_model_fifo_push(rfm69_model_t *pModel, uint8_t ubData)
+{
+    if(pModel->ubFIFOCount == RFM69_MODEL_FIFO_SIZE)
+    {
+        pModel->ubFIFOOverrun = 1;
+
+        return;
+    }
+
+    pModel->pubFIFO[(pModel->ubFIFOHead + pModel->ubFIFOCount++) % RFM69_MODEL_FIFO_SIZE] = ubData;
+}
+static uint8_t rfm69_model_fifo_pop(rfm69_model_t *pModel)
+{
+    if(!pModel->ubFIFOCount)
+        return 0x00;
+
+    uint8_t ubData = pModel->pubFIFO[pModel->ubFIFOHead];
+
+    pModel->ubFIFOHead = (pModel->ubFIFOHead + 1) % RFM69_MODEL_FIFO_SIZE;
+    pModel->ubFIFOCount--;
+
+    return ubData;
+}
+
+static void rfm69_model_raise_irq(rfm69_model_t *pModel)
+{
+    pModel->xStats.ulIRQs++;
+
+    if(g_ulHostPRIMASK)
+    {
+        pModel->ubIRQPending = 1; // Latched like the GPIO interrupt flag, taken when interrupts are enabled again
+
+        return;
+    }
+
+    if(pModel->pfIRQ)
+        pModel->pfIRQ(pModel);
+}
+static void rfm69_model_irq_unmasked()
+{
+    for(uint8_t i = 0; i < ubModelCount && !g_ulHostPRIMASK; i++)
+    {
+        rfm69_model_t *pModel = pModels[i];
+
+        if(!pModel->ubIRQPending)
+            continue;
+
+        pModel->ubIRQPending = 0;
+
+        if(pModel->pfIRQ)
+            pModel->pfIRQ(pModel);
+    }
+}
+static void rfm69_model_update_dio0(rfm69_model_t *pModel)
+{
+    uint8_t ubMapping = pModel->pubRegisters[RFM69_REG_DIOMAPPING1] & RFM69_REG_DIOMAPPING1_DIO0_11;
+    uint8_t ubLevel = 0;
+
+    if(pModel->ubMode == RFM69_REG_OPMODE_TRANSMITTER)
+        ubLevel = ubMapping == RFM69_REG_DIOMAPPING1_DIO0_00 && pModel->ubPacketSent;
+    else if(pModel->ubMode == RFM69_REG_OPMODE_RECEIVER)
+        ubLevel = (ubMapping == RFM69_REG_DIOMAPPING1_DIO0_00 || ubMapping == RFM69_REG_DIOMAPPING1_DIO0_01) && pModel->ubPayloadReady; // CrcOk or PayloadReady, the CRC is always good here
+
+    uint8_t ubRising = ubLevel && !pModel->ubDIO0;
+
+    pModel->ubDIO0 = ubLevel;
+
+    if(ubRising)
+        rfm69_model_raise_irq(pModel);
+}
+
+static uint8_t rfm69_model_same_network(const rfm69_model_t *pFrom, const rfm69_model_t *pTo)
+{
+    // Bit rate and sync word have to match for the receiver to find the frame
+    if(pFrom->pubRegisters[RFM69_REG_BITRATEMSB] != pTo->pubRegisters[RFM69_REG_BITRATEMSB] || pFrom->pubRegisters[RFM69_REG_BITRATELSB] != pTo->pubRegisters[RFM69_REG_BITRATELSB])
+        return 0;
+
+    if(pFrom->pubRegisters[RFM69_REG_SYNCCONFIG] != pTo->pubRegisters[RFM69_REG_SYNCCONFIG])
+        return 0;
+
+    uint8_t ubSyncSize = ((pFrom->pubRegisters[RFM69_REG_SYNCCONFIG] >> 3) & 7) + 1;
+
+    return !memcmp(&pFrom->pubRegisters[RFM69_REG_SYNCVALUE1], &pTo->pubRegisters[RFM69_REG_SYNCVALUE1], ubSyncSize);
+}
+static int8_t rfm69_model_channel_rssi(rfm69_model_t *pModel)
+{
+    int16_t sRSSI = pModel->bNoise;
+
+    for(uint8_t i = 0; i < ubModelCount; i++)
+    {
+        rfm69_model_t *pOther = pModels[i];
+
+        if(pOther == pModel || !pOther->ullTXEnd)
+            continue;
+
+        int16_t sSignal = rfm69_model_get_tx_power(pOther) - pModel->ubPathLoss;
+
+        if(sSignal > sRSSI)
+            sRSSI = sSignal;
+    }
+
+    return sRSSI < -127 ? -127 : (sRSSI > 0 ? 0 : sRSSI);
+}
+static void rfm69_model_receive(rfm69_model_t *pModel, const uint8_t *pubPayload, uint8_t ubSize, int8_t bRSSI)
+{
+    rfm69_model_fifo_clear(pModel);
+    rfm69_model_fifo_push(pModel, ubSize);
+
+    for(uint8_t i = 0; i < ubSize; i++)
+        rfm69_model_fifo_push(pModel, pubPayload[i]);
+
+    pModel->bRXRSSI = bRSSI;
+    pModel->ubPayloadReady = 1;
+    pModel->xStats.ulFramesReceived++;
+
+    rfm69_model_update_dio0(pModel);
+}
+static void rfm69_model_tx_on_air(rfm69_model_t *pModel)
+{
+    if(!pModel->ubFIFOCount)
+        return;
+
+    // Variable length format, the length byte leads, whatever is missing at this point goes out as an underrun
+    uint8_t ubLength = rfm69_model_fifo_pop(pModel);
+    uint8_t ubSize = 0;
+
+    while(ubSize < ubLength && pModel->ubFIFOCount && ubSize < RFM69_MODEL_FIFO_SIZE)
+        pModel->pubTXFrame[ubSize++] = rfm69_model_fifo_pop(pModel);
+
+    uint32_t ulAirtime = rfm69_model_get_airtime(pModel, ubLength);
+
+    pModel->ubTXFrameSize = ubSize;
+    pModel->ullTXEnd = rfm69_model_now() + (ulAirtime ? ulAirtime : 1);
+    pModel->xStats.ullTXTime += ulAirtime;
+
+    // Receivers lock onto the first sync word they hear, a second frame overlapping it ruins both
+    for(uint8_t i = 0; i < ubModelCount; i++)
+    {
+        rfm69_model_t *pRX = pModels[i];
+
+        if(pRX == pModel || pRX->ubMode != RFM69_REG_OPMODE_RECEIVER || !rfm69_model_same_network(pModel, pRX))
+            continue;
+
+        if(pRX->pRXFrom)
+        {
+            pRX->ubRXCorrupted = 1;
+            pRX->xStats.ulCollisions++;
+
+            continue;
+        }
+
+        if(pRX->ubPayloadReady || pRX->ubFIFOCount)
+        {
+            pRX->xStats.ulFramesMissed++;
+
+            continue;
+        }
+
+        pRX->pRXFrom = pModel;
+        pRX->ubRXCorrupted = 0;
+    }
+}
+static void rfm69_model_tx_start(rfm69_model_t *pModel)
+{
+    if(pModel->ullTXEnd || pModel->ullTXStart || !pModel->ubFIFOCount)
+        return;
+
+    if(!pModel->ulTXStartDelay)
+    {
+        rfm69_model_tx_on_air(pModel);
+
+        return;
+    }
+
+    pModel->ullTXStart = rfm69_model_now() + pModel->ulTXStartDelay; // Goes on air from the tick, nobody can sense it until then
+}
+static void rfm69_model_tx_end(rfm69_model_t *pModel)
+{
+    int8_t bPower = rfm69_model_get_tx_power(pModel); // The driver sets the PA after entering TX, read it once the frame is out
+
+    pModel->ullTXEnd = 0;
+    pModel->xStats.ulFramesSent++;
+
+    for(uint8_t i = 0; i < ubModelCount; i++)
+    {
+        rfm69_model_t *pRX = pModels[i];
+
+        if(pRX->pRXFrom != pModel)
+            continue;
+
+        pRX->pRXFrom = NULL;
+
+        if(pRX->ubRXCorrupted)
+        {
+            pRX->xStats.ulCollisions++;
+
+            continue;
+        }
+
+        int16_t sRSSI = bPower - pRX->ubPathLoss;
+
+        if(sRSSI < RFM69_MODEL_SENSITIVITY)
+        {
+            pRX->xStats.ulFramesMissed++;
+
+            continue;
+        }
+
+        rfm69_model_receive(pRX, pModel->pubTXFrame, pModel->ubTXFrameSize, sRSSI);
+    }
+
+    if(pModel->pfTX)
+        pModel->pfTX(pModel, pModel->pubTXFrame, pModel->ubTXFrameSize, bPower);
+
+    if(pModel->ubSuppressPacketSent)
+        return;
+
+    pModel->ubPacketSent = 1;
+
+    rfm69_model_update_dio0(pModel);
+}
+static void rfm69_model_tx_abort(rfm69_model_t *pModel)
+{
+    pModel->ullTXEnd = 0;
+
+    for(uint8_t i = 0; i < ubModelCount; i++)
+    {
+        if(pModels[i]->pRXFrom != pModel)
+            continue;
+
+        pModels[i]->pRXFrom = NULL;
+        pModels[i]->xStats.ulFramesMissed++;
+    }
+}
+static void rfm69_model_set_mode(rfm69_model_t *pModel, uint8_t ubMode)
+{
+    if(ubMode == pModel->ubMode)
+        return;
+
+    uint8_t ubOldMode = pModel->ubMode;
+
+    pModel->ubMode = ubMode;
+    pModel->ullModeReady = rfm69_model_now() + (ubOldMode == RFM69_REG_OPMODE_SLEEP ? pModel->ulWakeDelay : pModel->ulModeReadyDelay);
+    pModel->xStats.ulModeChanges++;
+
+    if(ubOldMode == RFM69_REG_OPMODE_TRANSMITTER)
+    {
+        pModel->ullTXStart = 0;
+
+        if(pModel->ullTXEnd)
+            rfm69_model_tx_abort(pModel); // Cut short, nobody gets it
+
+        pModel->ubPacketSent = 0;
+    }
+
+    if(ubOldMode == RFM69_REG_OPMODE_RECEIVER && pModel->pRXFrom)
+    {
+        pModel->pRXFrom = NULL;
+        pModel->xStats.ulFramesMissed++;
+    }
+
+    if(ubMode == RFM69_REG_OPMODE_TRANSMITTER && (pModel->pubRegisters[RFM69_REG_FIFOTHRESH] & RFM69_REG_FIFOTHRESH_TXSTART_FIFONOTEMPTY))
+        rfm69_model_tx_start(pModel);
+
+    rfm69_model_update_dio0(pModel);
+}
+
+static uint8_t rfm69_model_read(rfm69_model_t *pModel, uint8_t ubRegister)
+{
+    if(ubRegister >= RFM69_REGISTER_COUNT)
+        return 0x00;
+
+    if(ubRegister == RFM69_REG_FIFO)
+    {
+        pModel->xStats.ulFIFOReads++;
+
+        uint8_t ubData = rfm69_model_fifo_pop(pModel);
+
+        if(!pModel->ubFIFOCount && pModel->ubPayloadReady)
+        {
+            pModel->ubPayloadReady = 0; // Cleared once the last byte is read
+
+            rfm69_model_update_dio0(pModel);
+        }
+
+        return ubData;
+    }
+
+    pModel->xStats.ulRegisterReads++;
+
+    switch(ubRegister)
+    {
+        case RFM69_REG_IRQFLAGS1:
+        {
+            uint8_t ubFlags = 0;
+
+            if(rfm69_model_now() < pModel->ullModeReady)
+                return 0x00;
+
+            ubFlags |= RFM69_REG_IRQFLAGS1_MODEREADY;
+
+            if(pModel->ubMode == RFM69_REG_OPMODE_RECEIVER)
+                ubFlags |= RFM69_REG_IRQFLAGS1_RXREADY;
+
+            if(pModel->ubMode == RFM69_REG_OPMODE_TRANSMITTER)
+                ubFlags |= RFM69_REG_IRQFLAGS1_TXREADY;
+
+            if(pModel->ubMode == RFM69_REG_OPMODE_SYNTHESIZER || pModel->ubMode == RFM69_REG_OPMODE_TRANSMITTER || pModel->ubMode == RFM69_REG_OPMODE_RECEIVER)
+                ubFlags |= RFM69_REG_IRQFLAGS1_PLLLOCK;
+
+            return ubFlags;
+        }
+        case RFM69_REG_IRQFLAGS2:
+        {
+            uint8_t ubFlags = 0;
+
+            if(pModel->ubFIFOCount == RFM69_MODEL_FIFO_SIZE)
+                ubFlags |= RFM69_REG_IRQFLAGS2_FIFOFULL;
+
+            if(pModel->ubFIFOCount)
+                ubFlags |= RFM69_REG_IRQFLAGS2_FIFONOTEMPTY;
+
+            if(pModel->ubFIFOCount > (pModel->pubRegisters[RFM69_REG_FIFOTHRESH] & 0x7F))
+                ubFlags |= RFM69_REG_IRQFLAGS2_FIFOLEVEL;
+
+            if(pModel->ubFIFOOverrun)
+                ubFlags |= RFM69_REG_IRQFLAGS2_FIFOOVERRUN;
+
+            if(pModel->ubPacketSent)
+                ubFlags |= RFM69_REG_IRQFLAGS2_PACKETSENT;
+
+            if(pModel->ubPayloadReady)
+                ubFlags |= RFM69_REG_IRQFLAGS2_PAYLOADREADY | RFM69_REG_IRQFLAGS2_CRCOK;
+
+            return ubFlags;
+        }
+        case RFM69_REG_RSSIVALUE:
+        {
+            int8_t bRSSI = pModel->ubPayloadReady ? pModel->bRXRSSI : rfm69_model_channel_rssi(pModel); // Latched with the frame, live otherwise
+
+            return (uint8_t)(-2 * bRSSI);
+        }
+        case RFM69_REG_TEMP1:
+        {
+            return pModel->pubRegisters[RFM69_REG_TEMP1] & ~RFM69_REG_TEMP1_MEAS_RUNNING; // Measurements finish instantly
+        }
+    }
+
+    return pModel->pubRegisters[ubRegister];
+}
+static void rfm69_model_write(rfm69_model_t *pModel, uint8_t ubRegister, uint8_t ubValue)
+{
+    if(ubRegister >= RFM69_REGISTER_COUNT)
+        return;
+
+    if(ubRegister == RFM69_REG_FIFO)
+    {
+        pModel->xStats.ulFIFOWrites++;
+
+        rfm69_model_fifo_push(pModel, ubValue);
+
+        if(pModel->ubMode == RFM69_REG_OPMODE_TRANSMITTER)
+            rfm69_model_tx_start(pModel);
+
+        return;
+    }
+
+    pModel->xStats.ulRegisterWrites++;
+
+    switch(ubRegister)
+    {
+        case RFM69_REG_OPMODE:
+        {
+            pModel->pubRegisters[RFM69_REG_OPMODE] = ubValue & ~RFM69_REG_OPMODE_LISTENABORT;
+
+            rfm69_model_set_mode(pModel, ubValue & 0x1C);
+        }
+        return;
+        case RFM69_REG_OSC1:
+        {
+            pModel->pubRegisters[RFM69_REG_OSC1] = (ubValue & ~RFM69_REG_OSC1_RCCAL_START) | RFM69_REG_OSC1_RCCAL_DONE; // Calibration finishes instantly
+        }
+        return;
+        case RFM69_REG_VERSION:
+        case RFM69_REG_IRQFLAGS1:
+        case RFM69_REG_RSSIVALUE:
+        return;
+        case RFM69_REG_IRQFLAGS2:
+        {
+            if(!(ubValue & RFM69_REG_IRQFLAGS2_FIFOOVERRUN))
+                return;
+
+            rfm69_model_fifo_clear(pModel); // Writing FifoOverrun clears the FIFO
+
+            pModel->ubPayloadReady = 0;
+
+            rfm69_model_update_dio0(pModel);
+        }
+        return;
+        case RFM69_REG_PACKETCONFIG2:
+        {
+            pModel->pubRegisters[RFM69_REG_PACKETCONFIG2] = ubValue & ~RFM69_REG_PACKET2_RXRESTART;
+
+            if((ubValue & RFM69_REG_PACKET2_RXRESTART) && pModel->pRXFrom)
+            {
+                pModel->pRXFrom = NULL;
+                pModel->xStats.ulFramesMissed++;
+            }
+        }
+        return;
+        case RFM69_REG_TEMP1:
+        {
+            pModel->pubRegisters[RFM69_REG_TEMP1] = ubValue & ~RFM69_REG_TEMP1_MEAS_START;
+        }
+        return;
+    }
+
+    pModel->pubRegisters[ubRegister] = ubValue;
+
+    if(ubRegister == RFM69_REG_DIOMAPPING1)
+        rfm69_model_update_dio0(pModel);
+}
+static void rfm69_model_reset(rfm69_model_t *pModel)
+{
+    if(pModel->ullTXEnd)
+        rfm69_model_tx_abort(pModel);
+
+    pModel->ullTXStart = 0;
+
+    memcpy(pModel->pubRegisters, pubResetValues, sizeof(pubResetValues));
+
+    rfm69_model_fifo_clear(pModel);
+
+    pModel->ubAddressed = 0;
+    pModel->ubMode = RFM69_REG_OPMODE_STANDBY;
+    pModel->ullModeReady = 0;
+    pModel->ubPacketSent = 0;
+    pModel->ubPayloadReady = 0;
+    pModel->ubDIO0 = 0;
+    pModel->ubIRQPending = 0;
+    pModel->pRXFrom = NULL;
+}
+
+static uint8_t rfm69_model_spi(uint8_t ubData)
+{
+    rfm69_model_t *pModel = pSelected;
+
+    if(!pModel || gpio_host_read(GPIO_HOST_PIN_RFM69_CS))
+        return 0xFF; // Not selected, MISO floats
+
+    pModel->xStats.ulBytes++;
+
+    if(!pModel->ubAddressed)
+    {
+        pModel->ubAddressed = 1;
+        pModel->ubAddress = ubData & 0x7F;
+        pModel->ubWrite = !!(ubData & 0x80);
+
+        return 0x00;
+    }
+
+    uint8_t ubReply = 0x00;
+
+    if(pModel->ubWrite)
+        rfm69_model_write(pModel, pModel->ubAddress, ubData);
+    else
+        ubReply = rfm69_model_read(pModel, pModel->ubAddress);
+
+    if(pModel->ubAddress != RFM69_REG_FIFO)
+        pModel->ubAddress++;
+
+    return ubReply;
+}
+static void rfm69_model_cs_pin(uint8_t ubPin, uint8_t ubLevel)
+{
+    rfm69_model_t *pModel = pSelected;
+
+    if(!pModel)
+        return;
+
+    if(ubLevel && pModel->ubAddressed)
+        pModel->xStats.ulTransactions++;
+
+    pModel->ubAddressed = 0;
+}
+static void rfm69_model_reset_pin(uint8_t ubPin, uint8_t ubLevel)
+{
+    if(!pSelected)
+        return;
+
+    rfm69_model_reset(pSelected); // Held in reset while high, starts from the reset values when released
+}
+
+void rfm69_model_air_reset()
+{
+    memset(pModels, 0, sizeof(pModels));
+
+    ubModelCount = 0;
+    pSelected = NULL;
+
+    host_add_tick_hook(rfm69_model_tick);
+    host_add_irq_source(rfm69_model_irq_unmasked);
+
+    usart_host_attach(USART3, rfm69_model_spi);
+    gpio_host_set_listener(GPIO_HOST_PIN_RFM69_CS, rfm69_model_cs_pin);
+    gpio_host_set_listener(GPIO_HOST_PIN_RFM69_RESET, rfm69_model_reset_pin);
+}
+void rfm69_model_init(rfm69_model_t *pModel)
+{
+    if(!pModel)
+        return;
+
+    memset(pModel, 0, sizeof(rfm69_model_t));
+
+    pModel->bNoise = RFM69_MODEL_DEFAULT_NOISE;
+    pModel->ubPathLoss = RFM69_MODEL_DEFAULT_PATH_LOSS;
+
+    rfm69_model_reset(pModel);
+
+    if(ubModelCount < RFM69_MODEL_MAX_NODES)
+        pModels[ubModelCount++] = pModel;
+
+    if(!pSelected)
+        pSelected = pModel;
+}
+void rfm69_model_select(rfm69_model_t *pModel)
+{
+    pSelected = pModel;
+}
+rfm69_model_t* rfm69_model_get_selected()
+{
+    return pSelected;
+}
+
+void rfm69_model_tick()
+{
+    uint64_t ullNow = rfm69_model_now();
+
+    for(uint8_t i = 0; i < ubModelCount; i++)
+    {
+        if(pModels[i]->ullTXEnd && ullNow >= pModels[i]->ullTXEnd)
+            rfm69_model_tx_end(pModels[i]);
+
+        if(pModels[i]->ullTXStart && ullNow >= pModels[i]->ullTXStart)
+        {
+            pModels[i]->ullTXStart = 0;
+
+            rfm69_model_tx_on_air(pModels[i]);
+        }
+    }
+}
+
+uint8_t rfm69_model_inject(rfm69_model_t *pModel, const uint8_t *pubPayload, uint8_t ubSize, int8_t bRSSI)
+{
+    if(!pModel || ubSize >= RFM69_MODEL_FIFO_SIZE)
+        return 0;
+
+    if(!rfm69_model_is_listening(pModel))
+    {
+        pModel->xStats.ulFramesMissed++;
+
+        return 0;
+    }
+
+    rfm69_model_receive(pModel, pubPayload, ubSize, bRSSI);
+
+    return 1;
+}
+uint8_t rfm69_model_is_listening(rfm69_model_t *pModel)
+{
+    if(!pModel || pModel->ubMode != RFM69_REG_OPMODE_RECEIVER || rfm69_model_now() < pModel->ullModeReady)
+        return 0;
+
+    return !pModel->ubPayloadReady && !pModel->ubFIFOCount && !pModel->pRXFrom;
+}
+uint8_t rfm69_model_get_mode(rfm69_model_t *pModel)
+{
+    return pModel ? pModel->ubMode : RFM69_REG_OPMODE_SLEEP;
+}
+int8_t rfm69_model_get_tx_power(rfm69_model_t *pModel)
+{
+    uint8_t ubPALevel = pModel->pubRegisters[RFM69_REG_PALEVEL];
+    int8_t bOutput = ubPALevel & 0x1F;
+
+    if(ubPALevel & RFM69_REG_PALEVEL_PA2_ON)
+        return pModel->pubRegisters[RFM69_REG_TESTPA1] == 0x5D ? bOutput - 11 : bOutput - 14; // High power boost on PA1 + PA2
+
+    return bOutput - 18; // PA0 or PA1 alone
+}
+uint32_t rfm69_model_get_airtime(rfm69_model_t *pModel, uint8_t ubPayloadSize)
+{
+    uint32_t ulPreamble = ((uint32_t)pModel->pubRegisters[RFM69_REG_PREAMBLEMSB] << 8) | pModel->pubRegisters[RFM69_REG_PREAMBLELSB];
+    uint32_t ulSync = (pModel->pubRegisters[RFM69_REG_SYNCCONFIG] & RFM69_REG_SYNC_ON) ? ((pModel->pubRegisters[RFM69_REG_SYNCCONFIG] >> 3) & 7) + 1 : 0;
+    uint32_t ulPayload = (pModel->pubRegisters[RFM69_REG_PACKETCONFIG2] & RFM69_REG_PACKET2_AES_ON) ? (ubPayloadSize + 15) & ~15 : ubPayloadSize;
+    uint32_t ulCRC = (pModel->pubRegisters[RFM69_REG_PACKETCONFIG1] & RFM69_REG_PACKET1_CRC_ON) ? 2 : 0;
+    uint32_t ulBitPeriod = ((uint32_t)pModel->pubRegisters[RFM69_REG_BITRATEMSB] << 8) | pModel->pubRegisters[RFM69_REG_BITRATELSB]; // 1/32 us
+
+    return (uint32_t)((uint64_t)(ulPreamble + ulSync + 1 + ulPayload + ulCRC) * 8 * ulBitPeriod / 32);
+}
+uint8_t rfm69_model_air_busy()
+{
+    for(uint8_t i = 0; i < ubModelCount; i++)
+        if(pModels[i]->ullTXEnd)
+            return 1;
+
+    return 0;
+}
+
+void rfm69_model_reset_stats(rfm69_model_t *pModel)
+{
+    if(!pModel)
+        return;
+
+    memset(&pModel->xStats, 0, sizeof(rfm69_model_stats_t));
+}
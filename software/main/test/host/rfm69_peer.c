@@ -0,0 +1,239 @@
+#include "rfm69_peer.h"
+
+static rfm69_model_t *pModel = NULL;
+static rfm69_peer_t *pPeers[RFM69_PEER_MAX_PEERS];
+static uint8_t ubPeerCount = 0;
+
+static uint32_t rfm69_peer_random(rfm69_peer_t *pPeer)
+{
+    pPeer->ulRandom ^= pPeer->ulRandom << 13;
+    pPeer->ulRandom ^= pPeer->ulRandom >> 17;
+    pPeer->ulRandom ^= pPeer->ulRandom << 5;
+
+    return pPeer->ulRandom;
+}
+static void rfm69_peer_pack_header(const rfm69_packet_header_t *pHeader, uint8_t *pubBuffer)
+{
+    pubBuffer[0] = (pHeader->ubACKRequested << RFM69_CTL_ACKR) | (pHeader->ubACKSent << RFM69_CTL_ACKS) | (pHeader->ubRELRequested << RFM69_CTL_RELR) | (pHeader->ubRELSent << RFM69_CTL_RELS) | (pHeader->ubQoSLevel << RFM69_CTL_QOS) | (pHeader->ubAggregated << RFM69_CTL_AGG);
+    pubBuffer[1] = pHeader->usID & 0xFF;
+    pubBuffer[2] = pHeader->usID >> 8;
+    pubBuffer[3] = (uint8_t)pHeader->bRemoteRSSI;
+    pubBuffer[4] = pHeader->ubReceiverNodeID;
+    pubBuffer[5] = pHeader->ubSenderNodeID;
+}
+static void rfm69_peer_unpack_header(rfm69_packet_header_t *pHeader, const uint8_t *pubBuffer)
+{
+    pHeader->ubACKRequested = !!(pubBuffer[0] & BIT(RFM69_CTL_ACKR));
+    pHeader->ubACKSent = !!(pubBuffer[0] & BIT(RFM69_CTL_ACKS));
+    pHeader->ubRELRequested = !!(pubBuffer[0] & BIT(RFM69_CTL_RELR));
+    pHeader->ubRELSent = !!(pubBuffer[0] & BIT(RFM69_CTL_RELS));
+    pHeader->ubQoSLevel = !!(pubBuffer[0] & BIT(RFM69_CTL_QOS));
+    pHeader->ubAggregated = !!(pubBuffer[0] & BIT(RFM69_CTL_AGG));
+    pHeader->usID = pubBuffer[1] | (pubBuffer[2] << 8);
+    pHeader->bRemoteRSSI = (int8_t)pubBuffer[3];
+    pHeader->ubReceiverNodeID = pubBuffer[4];
+    pHeader->ubSenderNodeID = pubBuffer[5];
+}
+static void rfm69_peer_deliver(rfm69_peer_t *pPeer, const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubSize)
+{
+    pPeer->xStats.ulMessages++;
+
+    if(pPeer->pfRX)
+        pPeer->pfRX(pPeer, pHeader, pubData, ubSize);
+}
+static void rfm69_peer_model_tx(rfm69_model_t *pFrom, const uint8_t *pubFrame, uint8_t ubSize, int8_t bPower)
+{
+    if(ubSize < RFM69_PACKET_HEADER_SIZE)
+        return;
+
+    rfm69_packet_header_t xHeader;
+
+    rfm69_peer_unpack_header(&xHeader, pubFrame);
+
+    for(uint8_t i = 0; i < ubPeerCount; i++)
+    {
+        rfm69_peer_t *pPeer = pPeers[i];
+
+        if(xHeader.ubReceiverNodeID != pPeer->ubNodeID)
+            continue;
+
+        int8_t bRSSI = pPeer->pfRSSI ? pPeer->pfRSSI(pPeer, bPower) : bPower - RFM69_MODEL_DEFAULT_PATH_LOSS;
+
+        if(bRSSI == -128 || rfm69_peer_chance(pPeer, pPeer->usLossIn))
+        {
+            pPeer->xStats.ulFramesLost++;
+
+            continue;
+        }
+
+        pPeer->bLastRSSI = bRSSI;
+        pPeer->xStats.ulFramesHeard++;
+
+        const uint8_t *pubData = pubFrame + RFM69_PACKET_HEADER_SIZE;
+        uint8_t ubDataSize = ubSize - RFM69_PACKET_HEADER_SIZE;
+
+        if(xHeader.ubACKRequested && !xHeader.ubQoSLevel && pPeer->ubAutoACK)
+        {
+            rfm69_packet_header_t xACK;
+
+            memset(&xACK, 0, sizeof(rfm69_packet_header_t));
+
+            xACK.usID = xHeader.usID;
+            xACK.ubACKSent = 1;
+            xACK.bRemoteRSSI = bRSSI;
+            xACK.ubReceiverNodeID = xHeader.ubSenderNodeID;
+            xACK.ubSenderNodeID = pPeer->ubNodeID;
+
+            if(rfm69_peer_send(pPeer, &xACK, NULL, 0))
+                pPeer->xStats.ulACKsSent++;
+        }
+
+        if(xHeader.ubACKSent || xHeader.ubRELSent || xHeader.ubRELRequested || !ubDataSize)
+            continue; // Responses carry no messages
+
+        if(!xHeader.ubAggregated)
+        {
+            rfm69_peer_deliver(pPeer, &xHeader, pubData, ubDataSize);
+
+            continue;
+        }
+
+        while(ubDataSize)
+        {
+            uint8_t ubMessageSize = *pubData++;
+
+            ubDataSize--;
+
+            if(!ubMessageSize || ubMessageSize > ubDataSize)
+                break;
+
+            rfm69_peer_deliver(pPeer, &xHeader, pubData, ubMessageSize);
+
+            pubData += ubMessageSize;
+            ubDataSize -= ubMessageSize;
+        }
+    }
+}
+
+void rfm69_peer_attach(rfm69_model_t *pNewModel)
+{
+    memset(pPeers, 0, sizeof(pPeers));
+
+    ubPeerCount = 0;
+    pModel = pNewModel;
+
+    if(pModel)
+        pModel->pfTX = rfm69_peer_model_tx;
+
+    host_add_tick_hook(rfm69_peer_tick);
+}
+void rfm69_peer_init(rfm69_peer_t *pPeer, uint8_t ubNodeID, uint32_t ulSeed)
+{
+    if(!pPeer)
+        return;
+
+    memset(pPeer, 0, sizeof(rfm69_peer_t));
+
+    pPeer->ubNodeID = ubNodeID;
+    pPeer->usNextID = 1;
+    pPeer->ulRandom = ulSeed ? ulSeed : 1;
+    pPeer->bLastRSSI = -128;
+    pPeer->bRSSI = -70;
+    pPeer->ubAutoACK = 1;
+
+    if(ubPeerCount < RFM69_PEER_MAX_PEERS)
+        pPeers[ubPeerCount++] = pPeer;
+}
+
+void rfm69_peer_tick()
+{
+    if(!pModel)
+        return;
+
+    // One frame per millisecond across all peers, only while the model listens and nothing else is on air
+    for(uint8_t i = 0; i < ubPeerCount; i++)
+    {
+        rfm69_peer_t *pPeer = pPeers[i];
+
+        if(!pPeer->ubQueueCount)
+            continue;
+
+        if(rfm69_model_air_busy() || !rfm69_model_is_listening(pModel))
+            return;
+
+        uint8_t *pubFrame = pPeer->pubQueue[pPeer->ubQueueHead];
+        uint8_t ubSize = pPeer->pubQueueSize[pPeer->ubQueueHead];
+
+        pPeer->ubQueueHead = (pPeer->ubQueueHead + 1) % RFM69_PEER_QUEUE_SIZE;
+        pPeer->ubQueueCount--;
+
+        if(rfm69_peer_chance(pPeer, pPeer->usLossOut))
+        {
+            pPeer->xStats.ulFramesDropped++;
+
+            continue;
+        }
+
+        if(rfm69_model_inject(pModel, pubFrame, ubSize, pPeer->bRSSI))
+            pPeer->xStats.ulFramesSent++;
+
+        return;
+    }
+}
+
+uint8_t rfm69_peer_send(rfm69_peer_t *pPeer, const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubSize)
+{
+    if(!pPeer || !pHeader || ubSize > RFM69_MAX_DATA_SIZE)
+        return 0;
+
+    if(pPeer->ubQueueCount == RFM69_PEER_QUEUE_SIZE)
+    {
+        pPeer->xStats.ulQueueFull++;
+
+        return 0;
+    }
+
+    uint8_t ubSlot = (pPeer->ubQueueHead + pPeer->ubQueueCount) % RFM69_PEER_QUEUE_SIZE;
+
+    rfm69_peer_pack_header(pHeader, pPeer->pubQueue[ubSlot]);
+
+    if(ubSize)
+        memcpy(pPeer->pubQueue[ubSlot] + RFM69_PACKET_HEADER_SIZE, pubData, ubSize);
+
+    pPeer->pubQueueSize[ubSlot] = RFM69_PACKET_HEADER_SIZE + ubSize;
+    pPeer->ubQueueCount++;
+
+    return 1;
+}
+uint8_t rfm69_peer_send_data(rfm69_peer_t *pPeer, uint8_t ubReceiver, const void *pvData, uint8_t ubSize)
+{
+    if(!pPeer)
+        return 0;
+
+    rfm69_packet_header_t xHeader;
+
+    memset(&xHeader, 0, sizeof(rfm69_packet_header_t));
+
+    xHeader.usID = pPeer->usNextID;
+    xHeader.bRemoteRSSI = pPeer->bLastRSSI;
+    xHeader.ubReceiverNodeID = ubReceiver;
+    xHeader.ubSenderNodeID = pPeer->ubNodeID;
+
+    if(!rfm69_peer_send(pPeer, &xHeader, (const uint8_t *)pvData, ubSize))
+        return 0;
+
+    pPeer->usNextID++;
+
+    return 1;
+}
+uint8_t rfm69_peer_chance(rfm69_peer_t *pPeer, uint16_t usPerMille)
+{
+    if(!usPerMille)
+        return 0;
+
+    return rfm69_peer_random(pPeer) % RFM69_PEER_LOSS_SCALE < usPerMille;
+}
+uint8_t rfm69_peer_pending(rfm69_peer_t *pPeer)
+{
+    return pPeer ? pPeer->ubQueueCount : 0;
+}
@@ -0,0 +1,163 @@
+#include "host.h"
+
+// USART fake, SPI master only
+// Bytes go straight to the attached device model, a transfer completes the moment it is written
+// Bytes the LDMA writes land their reply in a two deep RX buffer, like the real one it drops data when nobody reads it
+
+#define USART_HOST_RX_BUFFER_SIZE 2
+
+typedef struct
+{
+    USART_TypeDef *pUSART;
+    usart_host_spi_fn_t pfDevice;
+    uint8_t pubRXBuffer[USART_HOST_RX_BUFFER_SIZE];
+    uint8_t ubRXCount;
+    usart_host_stats_t xStats;
+} usart_host_port_t;
+
+USART_TypeDef g_xHostUSART1 = {.STATUS = USART_STATUS_TXC | USART_STATUS_TXBL};
+USART_TypeDef g_xHostUSART3 = {.STATUS = USART_STATUS_TXC | USART_STATUS_TXBL};
+
+static usart_host_port_t pPorts[2] = {{&g_xHostUSART1}, {&g_xHostUSART3}};
+
+static usart_host_port_t* usart_host_get_port(USART_TypeDef *pUSART)
+{
+    for(uint8_t i = 0; i < sizeof(pPorts) / sizeof(pPorts[0]); i++)
+        if(pPorts[i].pUSART == pUSART)
+            return &pPorts[i];
+
+    return NULL;
+}
+static uint8_t usart_host_clock(usart_host_port_t *pPort, uint8_t ubData)
+{
+    pPort->xStats.ulBytes++;
+
+    if(!pPort->pfDevice)
+        return 0xFF; // MISO pulled up
+
+    return pPort->pfDevice(ubData);
+}
+
+void usart_host_attach(USART_TypeDef *pUSART, usart_host_spi_fn_t pfDevice)
+{
+    usart_host_port_t *pPort = usart_host_get_port(pUSART);
+
+    if(!pPort)
+        return;
+
+    pPort->pfDevice = pfDevice;
+    pPort->ubRXCount = 0;
+
+    memset(&pPort->xStats, 0, sizeof(usart_host_stats_t));
+}
+void usart_host_get_stats(USART_TypeDef *pUSART, usart_host_stats_t *pStats)
+{
+    usart_host_port_t *pPort = usart_host_get_port(pUSART);
+
+    if(!pPort || !pStats)
+        return;
+
+    *pStats = pPort->xStats;
+}
+uint8_t usart_host_dma_request(USART_TypeDef *pUSART, uint32_t ulSignal)
+{
+    usart_host_port_t *pPort = usart_host_get_port(pUSART);
+
+    if(!pPort)
+        return 0;
+
+    if(ulSignal == LDMA_CH_REQSEL_SIGSEL_USART3TXBL) // Same signal number on every USART
+        return 1;
+
+    return pPort->ubRXCount > 0;
+}
+uint8_t usart_host_dma_read(volatile void *pAddress, uint8_t *pubData)
+{
+    for(uint8_t i = 0; i < sizeof(pPorts) / sizeof(pPorts[0]); i++)
+    {
+        usart_host_port_t *pPort = &pPorts[i];
+
+        if(pAddress != (volatile void *)&pPort->pUSART->RXDATA)
+            continue;
+
+        if(!pPort->ubRXCount)
+        {
+            *pubData = 0x00;
+
+            return 1;
+        }
+
+        *pubData = pPort->pubRXBuffer[0];
+
+        memmove(pPort->pubRXBuffer, pPort->pubRXBuffer + 1, --pPort->ubRXCount);
+
+        return 1;
+    }
+
+    return 0;
+}
+uint8_t usart_host_dma_write(volatile void *pAddress, uint8_t ubData)
+{
+    for(uint8_t i = 0; i < sizeof(pPorts) / sizeof(pPorts[0]); i++)
+    {
+        usart_host_port_t *pPort = &pPorts[i];
+
+        if(pAddress != (volatile void *)&pPort->pUSART->TXDATA)
+            continue;
+
+        uint8_t ubReply = usart_host_clock(pPort, ubData);
+
+        pPort->xStats.ulDMABytes++;
+
+        if(pPort->ubRXCount < USART_HOST_RX_BUFFER_SIZE)
+            pPort->pubRXBuffer[pPort->ubRXCount++] = ubReply;
+        else
+            pPort->xStats.ulRXOverflows++;
+
+        return 1;
+    }
+
+    return 0;
+}
+USART_TypeDef* usart_host_from_source(uint32_t ulSource)
+{
+    switch(ulSource & _LDMA_CH_REQSEL_SOURCESEL_MASK)
+    {
+        case LDMA_CH_REQSEL_SOURCESEL_USART1:
+            return USART1;
+        case LDMA_CH_REQSEL_SOURCESEL_USART3:
+            return USART3;
+    }
+
+    return NULL;
+}
+
+void usart1_init(uint32_t ulBaud, uint8_t ubMode, uint8_t ubBitMode, int8_t bMISOLocation, int8_t bMOSILocation, uint8_t ubCLKLocation)
+{
+    pPorts[0].ubRXCount = 0;
+}
+uint8_t usart1_spi_transfer_byte(const uint8_t ubData)
+{
+    pPorts[0].ubRXCount = 0; // CLEARRX
+
+    return usart_host_clock(&pPorts[0], ubData);
+}
+void usart1_spi_write_byte(const uint8_t ubData, const uint8_t ubWait)
+{
+    usart_host_clock(&pPorts[0], ubData);
+}
+
+void usart3_init(uint32_t ulBaud, uint8_t ubMode, uint8_t ubBitMode, int8_t bMISOLocation, int8_t bMOSILocation, uint8_t ubCLKLocation)
+{
+    pPorts[1].ubRXCount = 0;
+}
+uint8_t usart3_spi_transfer_byte(const uint8_t ubData)
+{
+    pPorts[1].ubRXCount = 0; // CLEARRX
+
+    return usart_host_clock(&pPorts[1], ubData);
+}
+void usart3_spi_write_byte(const uint8_t ubData, const uint8_t ubWait)
+{
+    usart_host_clock(&pPorts[1], ubData);
+}
@@ -0,0 +1,471 @@
+#include "host.h"
+#include "rfm69.h"
+#include "radio_protocol.h"
+#include "radio_transport.h"
+#include "radio_dispatch.h"
+
+// radio_dispatch over radio_transport with the radio replaced by a loopback stub, rfm69_send() hands requests to scripted nodes
+// A node decodes the request and queues the encoded response, delivered through the RX callback after its latency, unless it is silent
+// Requests get their response or exactly one timeout, the request table refuses duplicates and overflow and frees its slots again
+
+#define TEST_RADIO_DISPATCH_NODES           32
+#define TEST_RADIO_DISPATCH_QUEUE_SIZE      64
+#define TEST_RADIO_DISPATCH_STEP_LIMIT      10000   // ms
+#define TEST_RADIO_DISPATCH_RSSI            -70
+
+typedef struct
+{
+    uint64_t ullAt;
+    uint8_t ubNodeID;
+    uint8_t pubData[RFM69_MAX_DATA_SIZE];
+    uint8_t ubSize;
+} test_radio_dispatch_frame_t;
+
+typedef struct
+{
+    uint8_t ubSilent; // Requests go unanswered
+    uint8_t ubTrailingByte; // Responses carry a byte too many
+    uint16_t usLatency; // ms
+    uint32_t ulRequests;
+} test_radio_dispatch_node_t;
+
+// Loopback stub
+static rfm69_rx_callback_fn_t pfStubRX = NULL;
+static test_radio_dispatch_frame_t pStubQueue[TEST_RADIO_DISPATCH_QUEUE_SIZE];
+static uint8_t ubStubQueued = 0;
+static uint16_t usStubNextID = 1;
+static test_radio_dispatch_node_t pNodes[TEST_RADIO_DISPATCH_NODES];
+
+// Gateway side, what the callbacks saw
+static uint32_t ulResponses = 0;
+static uint32_t ulTimeouts = 0;
+static uint32_t ulWrongCallbacks = 0;
+static uint32_t pulNodeCallbacks[TEST_RADIO_DISPATCH_NODES];
+static uint64_t ullLastCallback = 0;
+static radio_cmd_uid_read_res_t xLastUID;
+static uint32_t ulHandled = 0;
+static uint8_t ubHandledNodeID = 0;
+static int8_t bHandledRSSI = 0;
+static uint8_t ubChainLeft = 0;
+
+void rfm69_set_rx_callback(rfm69_rx_callback_fn_t pfFunc)
+{
+    pfStubRX = pfFunc;
+}
+uint16_t rfm69_send(uint8_t ubReceiver, const void *pvPayload, uint8_t ubSize, uint8_t ubQoSLevel, uint16_t usRetryDelay, uint16_t usRetries)
+{
+    uint32_t pulRequest[RADIO_DISPATCH_MAX_MESSAGE_SIZE / sizeof(uint32_t)];
+    uint32_t pulResponse[RADIO_DISPATCH_MAX_MESSAGE_SIZE / sizeof(uint32_t)];
+
+    if(ubReceiver >= TEST_RADIO_DISPATCH_NODES || !ubSize || ubSize > RFM69_MAX_DATA_SIZE)
+        return 0;
+
+    test_radio_dispatch_node_t *pNode = &pNodes[ubReceiver];
+
+    if(!radio_protocol_decode(pulRequest, sizeof(pulRequest), (const uint8_t *)pvPayload, ubSize))
+        return usStubNextID++; // Not a request the node understands, it stays quiet
+
+    pNode->ulRequests++;
+
+    if(pNode->ubSilent || ubStubQueued == TEST_RADIO_DISPATCH_QUEUE_SIZE)
+        return usStubNextID++;
+
+    uint8_t ubCommand = *(uint8_t *)pulRequest & ~RADIO_CMD_REQUEST_FLAG;
+
+    memset(pulResponse, 0, sizeof(pulResponse));
+
+    *(uint8_t *)pulResponse = ubCommand;
+
+    if(ubCommand == RADIO_CMD_UID_READ)
+    {
+        radio_cmd_uid_read_res_t *pUID = (radio_cmd_uid_read_res_t *)pulResponse;
+
+        pUID->usID0_15 = 0x1000 | ubReceiver;
+        pUID->usID16_31 = 0x2000 | ubReceiver;
+        pUID->ulID32_63 = 0x30000000 | ubReceiver;
+        pUID->ulID64_96 = 0x40000000 | ubReceiver;
+    }
+
+    test_radio_dispatch_frame_t *pFrame = &pStubQueue[ubStubQueued];
+
+    pFrame->ubSize = radio_protocol_encode(pulResponse, pFrame->pubData, sizeof(pFrame->pubData) - 1);
+
+    if(!pFrame->ubSize)
+        return usStubNextID++; // No layout for the response
+
+    if(pNode->ubTrailingByte)
+        pFrame->pubData[pFrame->ubSize++] = 0x00;
+
+    pFrame->ullAt = g_ullSystemTick + pNode->usLatency;
+    pFrame->ubNodeID = ubReceiver;
+
+    ubStubQueued++;
+
+    return usStubNextID++;
+}
+static void test_radio_dispatch_stub_inject(uint8_t ubNodeID, const uint8_t *pubData, uint8_t ubSize)
+{
+    rfm69_packet_header_t xHeader;
+
+    if(!pfStubRX)
+        return;
+
+    memset(&xHeader, 0, sizeof(rfm69_packet_header_t));
+
+    xHeader.usID = usStubNextID++;
+    xHeader.ubReceiverNodeID = 1;
+    xHeader.ubSenderNodeID = ubNodeID;
+
+    pfStubRX(&xHeader, TEST_RADIO_DISPATCH_RSSI, pubData, ubSize);
+}
+static void test_radio_dispatch_stub_tick()
+{
+    // Due frames are taken out before delivery, callbacks may queue new ones
+    for(uint8_t i = 0; i < ubStubQueued;)
+    {
+        if(pStubQueue[i].ullAt > g_ullSystemTick)
+        {
+            i++;
+
+            continue;
+        }
+
+        test_radio_dispatch_frame_t xFrame = pStubQueue[i];
+
+        pStubQueue[i] = pStubQueue[--ubStubQueued];
+
+        test_radio_dispatch_stub_inject(xFrame.ubNodeID, xFrame.pubData, xFrame.ubSize);
+    }
+}
+
+static void test_radio_dispatch_response(uint8_t ubNodeID, uint8_t ubCommand, const void *pvResponse)
+{
+    ullLastCallback = g_ullSystemTick;
+
+    if(ubNodeID >= TEST_RADIO_DISPATCH_NODES || !(ubCommand & RADIO_CMD_REQUEST_FLAG))
+    {
+        ulWrongCallbacks++;
+
+        return;
+    }
+
+    pulNodeCallbacks[ubNodeID]++;
+
+    if(!pvResponse)
+    {
+        ulTimeouts++;
+
+        return;
+    }
+
+    if(*(const uint8_t *)pvResponse != (ubCommand & ~RADIO_CMD_REQUEST_FLAG))
+        ulWrongCallbacks++;
+
+    if(ubCommand == (RADIO_CMD_UID_READ | RADIO_CMD_REQUEST_FLAG))
+        memcpy(&xLastUID, pvResponse, sizeof(radio_cmd_uid_read_res_t));
+
+    ulResponses++;
+}
+static void test_radio_dispatch_chain_response(uint8_t ubNodeID, uint8_t ubCommand, const void *pvResponse)
+{
+    test_radio_dispatch_response(ubNodeID, ubCommand, pvResponse);
+
+    if(!ubChainLeft)
+        return;
+
+    ubChainLeft--;
+
+    radio_cmd_ping_req_t xPing = {RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG};
+
+    if(!radio_dispatch_request(ubNodeID, &xPing, 0, test_radio_dispatch_chain_response)) // Same node and command, the slot has to be free already
+        ulWrongCallbacks++;
+}
+static void test_radio_dispatch_handler(uint8_t ubNodeID, int8_t bRSSI, const void *pvMessage)
+{
+    ulHandled++;
+    ubHandledNodeID = ubNodeID;
+    bHandledRSSI = bRSSI;
+}
+
+static void test_radio_dispatch_setup()
+{
+    memset(pNodes, 0, sizeof(pNodes));
+    memset(pulNodeCallbacks, 0, sizeof(pulNodeCallbacks));
+    memset(&xLastUID, 0, sizeof(xLastUID));
+
+    for(uint8_t i = 0; i < TEST_RADIO_DISPATCH_NODES; i++)
+        pNodes[i].usLatency = 5;
+
+    ubStubQueued = 0;
+    ulResponses = 0;
+    ulTimeouts = 0;
+    ulWrongCallbacks = 0;
+    ulHandled = 0;
+    ubChainLeft = 0;
+
+    radio_transport_init();
+    radio_dispatch_init();
+}
+static void test_radio_dispatch_step()
+{
+    host_advance(1);
+    test_radio_dispatch_stub_tick();
+    radio_transport_tick();
+    radio_dispatch_tick();
+}
+static uint64_t test_radio_dispatch_run(uint32_t ulCallbacks)
+{
+    uint64_t ullStart = g_ullSystemTick;
+
+    while(ulResponses + ulTimeouts < ulCallbacks && g_ullSystemTick - ullStart < TEST_RADIO_DISPATCH_STEP_LIMIT)
+        test_radio_dispatch_step();
+
+    return g_ullSystemTick - ullStart;
+}
+static uint8_t test_radio_dispatch_report(const char *pszName, uint64_t ullTime, uint8_t ubFailed)
+{
+    radio_dispatch_stats_t xStats;
+
+    radio_dispatch_get_stats(&xStats);
+
+    printf("%-10s %8u %9u %8u %9u %10u %6llu\n", pszName, xStats.ulRequests, xStats.ulResponses, xStats.ulTimeouts, xStats.ulMalformed, xStats.ulUnhandled, (unsigned long long)ullTime);
+
+    return ubFailed;
+}
+
+static uint8_t test_radio_dispatch_ping()
+{
+    radio_cmd_ping_req_t xPing = {RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG};
+    radio_dispatch_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    test_radio_dispatch_setup();
+
+    pNodes[2].usLatency = 7;
+
+    uint64_t ullStart = g_ullSystemTick;
+
+    if(!radio_dispatch_request(2, &xPing, 0, test_radio_dispatch_response))
+    {
+        printf("  ping: request refused\n");
+
+        return 1;
+    }
+
+    uint64_t ullTime = test_radio_dispatch_run(1);
+
+    test_radio_dispatch_run(2); // Nothing else may come, not even a timeout
+
+    radio_dispatch_get_stats(&xStats);
+
+    if(ulResponses != 1 || ulTimeouts || ulWrongCallbacks || pulNodeCallbacks[2] != 1 || ullLastCallback - ullStart != 7 || xStats.ulResponses != 1 || xStats.ulTimeouts)
+    {
+        printf("  ping: %u responses, %u timeouts, %u wrong, answered after %llu ms\n", ulResponses, ulTimeouts, ulWrongCallbacks, (unsigned long long)(ullLastCallback - ullStart));
+
+        ubFailed = 1;
+    }
+
+    return test_radio_dispatch_report("ping", ullTime, ubFailed);
+}
+static uint8_t test_radio_dispatch_uid_read()
+{
+    radio_cmd_uid_read_req_t xRead = {RADIO_CMD_UID_READ | RADIO_CMD_REQUEST_FLAG};
+    uint8_t ubFailed = 0;
+
+    test_radio_dispatch_setup();
+
+    if(!radio_dispatch_request(3, &xRead, 0, test_radio_dispatch_response))
+    {
+        printf("  uid_read: request refused\n");
+
+        return 1;
+    }
+
+    uint64_t ullTime = test_radio_dispatch_run(1);
+
+    if(ulResponses != 1 || ulWrongCallbacks || xLastUID.ubCommand != RADIO_CMD_UID_READ || xLastUID.usID0_15 != 0x1003 || xLastUID.usID16_31 != 0x2003 || xLastUID.ulID32_63 != 0x30000003 || xLastUID.ulID64_96 != 0x40000003)
+    {
+        printf("  uid_read: %u responses, UID %04hX %04hX %08X %08X\n", ulResponses, xLastUID.usID0_15, xLastUID.usID16_31, xLastUID.ulID32_63, xLastUID.ulID64_96);
+
+        ubFailed = 1;
+    }
+
+    return test_radio_dispatch_report("uid_read", ullTime, ubFailed);
+}
+static uint8_t test_radio_dispatch_timeout()
+{
+    radio_cmd_ping_req_t xPing = {RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG};
+    radio_cmd_uid_read_req_t xRead = {RADIO_CMD_UID_READ | RADIO_CMD_REQUEST_FLAG};
+    radio_dispatch_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    test_radio_dispatch_setup();
+
+    pNodes[4].ubSilent = 1;
+
+    uint64_t ullStart = g_ullSystemTick;
+
+    radio_dispatch_request(4, &xPing, 100, test_radio_dispatch_response);
+
+    uint64_t ullTime = test_radio_dispatch_run(1);
+
+    if(ulTimeouts != 1 || ulResponses || ullLastCallback - ullStart != 100)
+    {
+        printf("  timeout: %u timeouts, %u responses, after %llu ms\n", ulTimeouts, ulResponses, (unsigned long long)(ullLastCallback - ullStart));
+
+        ubFailed = 1;
+    }
+
+    // Response arriving after the timeout is no longer matched, it goes to the handler table like any report
+    pNodes[4].ubSilent = 0;
+    pNodes[4].usLatency = 150;
+
+    radio_dispatch_request(4, &xRead, 100, test_radio_dispatch_response);
+
+    test_radio_dispatch_run(2);
+    test_radio_dispatch_run(3); // Up to the step limit, the late response lands meanwhile
+
+    radio_dispatch_get_stats(&xStats);
+
+    if(ulTimeouts != 2 || ulResponses || xStats.ulUnhandled != 1 || ulWrongCallbacks)
+    {
+        printf("  late: %u timeouts, %u responses, %u unhandled\n", ulTimeouts, ulResponses, xStats.ulUnhandled);
+
+        ubFailed = 1;
+    }
+
+    // Malformed responses are dropped, the request still ends in its timeout
+    pNodes[4].usLatency = 5;
+    pNodes[4].ubTrailingByte = 1;
+
+    radio_dispatch_request(4, &xPing, 100, test_radio_dispatch_response);
+
+    test_radio_dispatch_run(3);
+
+    radio_dispatch_get_stats(&xStats);
+
+    if(ulTimeouts != 3 || ulResponses || xStats.ulMalformed != 1)
+    {
+        printf("  malformed: %u timeouts, %u responses, %u malformed\n", ulTimeouts, ulResponses, xStats.ulMalformed);
+
+        ubFailed = 1;
+    }
+
+    return test_radio_dispatch_report("timeout", ullTime, ubFailed);
+}
+static uint8_t test_radio_dispatch_table()
+{
+    radio_cmd_ping_req_t xPing = {RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG};
+    radio_cmd_uid_read_req_t xRead = {RADIO_CMD_UID_READ | RADIO_CMD_REQUEST_FLAG};
+    uint8_t ubFailed = 0;
+
+    test_radio_dispatch_setup();
+
+    // One in flight per node and command
+    if(!radio_dispatch_request(2, &xPing, 0, test_radio_dispatch_response) || radio_dispatch_request(2, &xPing, 0, test_radio_dispatch_response) || !radio_dispatch_request(2, &xRead, 0, test_radio_dispatch_response))
+    {
+        printf("  table: duplicate request handling\n");
+
+        ubFailed = 1;
+    }
+
+    test_radio_dispatch_run(2);
+
+    // Every slot taken, answers come back in reverse order so bucket chains are unlinked from every position
+    for(uint8_t i = 0; i < RADIO_DISPATCH_REQUEST_SLOTS; i++)
+    {
+        pNodes[i + 1].usLatency = 2 * (RADIO_DISPATCH_REQUEST_SLOTS - i);
+
+        if(!radio_dispatch_request(i + 1, &xPing, 0, test_radio_dispatch_response))
+        {
+            printf("  table: request %hhu of %u refused\n", i, RADIO_DISPATCH_REQUEST_SLOTS);
+
+            ubFailed = 1;
+        }
+    }
+
+    if(radio_dispatch_request(RADIO_DISPATCH_REQUEST_SLOTS + 1, &xPing, 0, test_radio_dispatch_response))
+    {
+        printf("  table: request beyond the slots accepted\n");
+
+        ubFailed = 1;
+    }
+
+    uint64_t ullTime = test_radio_dispatch_run(2 + RADIO_DISPATCH_REQUEST_SLOTS);
+
+    for(uint8_t i = 1; i <= RADIO_DISPATCH_REQUEST_SLOTS; i++)
+    {
+        if(pulNodeCallbacks[i] != (i == 2 ? 3 : 1))
+        {
+            printf("  table: node %hhu got %u callbacks\n", i, pulNodeCallbacks[i]);
+
+            ubFailed = 1;
+        }
+    }
+
+    // Callbacks may issue the next request at once
+    ubChainLeft = 4;
+
+    radio_dispatch_request(9, &xPing, 0, test_radio_dispatch_chain_response);
+
+    test_radio_dispatch_run(2 + RADIO_DISPATCH_REQUEST_SLOTS + 5);
+
+    if(ulResponses != 2 + RADIO_DISPATCH_REQUEST_SLOTS + 5 || ulTimeouts || ulWrongCallbacks || ubChainLeft)
+    {
+        printf("  table: %u responses, %u timeouts, %u wrong, %hhu chained left\n", ulResponses, ulTimeouts, ulWrongCallbacks, ubChainLeft);
+
+        ubFailed = 1;
+    }
+
+    return test_radio_dispatch_report("table", ullTime, ubFailed);
+}
+static uint8_t test_radio_dispatch_requests_in()
+{
+    uint8_t pubBuffer[RFM69_MAX_DATA_SIZE];
+    radio_cmd_ping_req_t xPing = {RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG};
+    radio_dispatch_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    test_radio_dispatch_setup();
+
+    uint8_t ubSize = radio_protocol_encode(&xPing, pubBuffer, sizeof(pubBuffer));
+
+    test_radio_dispatch_stub_inject(6, pubBuffer, ubSize); // No handler yet
+
+    radio_dispatch_set_handler(RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG, test_radio_dispatch_handler);
+
+    test_radio_dispatch_stub_inject(6, pubBuffer, ubSize);
+
+    pubBuffer[0] = 0x7F; // No layout
+
+    test_radio_dispatch_stub_inject(6, pubBuffer, ubSize);
+
+    radio_dispatch_get_stats(&xStats);
+
+    if(ulHandled != 1 || ubHandledNodeID != 6 || bHandledRSSI != TEST_RADIO_DISPATCH_RSSI || xStats.ulDispatched != 1 || xStats.ulUnhandled != 1 || xStats.ulMalformed != 1)
+    {
+        printf("  requests_in: %u handled from node %hhu, %u dispatched, %u unhandled, %u malformed\n", ulHandled, ubHandledNodeID, xStats.ulDispatched, xStats.ulUnhandled, xStats.ulMalformed);
+
+        ubFailed = 1;
+    }
+
+    return test_radio_dispatch_report("requests_in", 0, ubFailed);
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("%-10s %8s %9s %8s %9s %10s %6s\n", "case", "requests", "responses", "timeouts", "malformed", "unhandled", "ms");
+
+    ubFailed |= test_radio_dispatch_ping();
+    ubFailed |= test_radio_dispatch_uid_read();
+    ubFailed |= test_radio_dispatch_timeout();
+    ubFailed |= test_radio_dispatch_table();
+    ubFailed |= test_radio_dispatch_requests_in();
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
@@ -0,0 +1,650 @@
+#include "host.h"
+#include "rfm69.h"
+#include "crypto.h"
+#include "radio_protocol.h"
+#include "radio_transport.h"
+#include "radio_dispatch.h"
+#include "radio_fota.h"
+
+// radio_fota over radio_dispatch with the radio replaced by a stub air, frames take their airtime one after the other and get lost at a set rate per direction
+// The far end is a node following the contract in radio_fota.h, it stores chunks, ACKs every few of them and on gaps, and hashes the image on FOTA_END
+// Crafted ACKs pin down the window shift and fast retransmit in radio_fota_ack_handler(), the other cases check the image the node ends up with
+
+#define TEST_RADIO_FOTA_NODE_ID         7
+#define TEST_RADIO_FOTA_IMAGE_ADDRESS   0x10000
+#define TEST_RADIO_FOTA_IMAGE_SIZE      20000   // Not a multiple of the chunk size, the last chunk is short
+#define TEST_RADIO_FOTA_MAX_IMAGE_SIZE  32768
+#define TEST_RADIO_FOTA_VERSION         0x00010200
+#define TEST_RADIO_FOTA_CHUNKS          ((TEST_RADIO_FOTA_IMAGE_SIZE + RADIO_PROTOCOL_FOTA_CHUNK_SIZE - 1) / RADIO_PROTOCOL_FOTA_CHUNK_SIZE)
+#define TEST_RADIO_FOTA_ACK_EVERY       4       // New chunks between node ACKs
+#define TEST_RADIO_FOTA_QUEUE_SIZE      64
+#define TEST_RADIO_FOTA_TX_FIFO         8       // Gateway frames the stub radio takes before it refuses
+#define TEST_RADIO_FOTA_STEP_LIMIT      600000  // ms
+#define TEST_RADIO_FOTA_LOG_SIZE        4096
+#define TEST_RADIO_FOTA_FRAME_TIME(s)   (1 + ((s) + 10) / 7) // ms - About 55 kbps with preamble, sync and CRC
+
+typedef struct
+{
+    uint64_t ullAt;
+    uint8_t ubToNode;
+    uint8_t pubData[RFM69_MAX_DATA_SIZE];
+    uint8_t ubSize;
+} test_radio_fota_frame_t;
+
+typedef struct
+{
+    const char *pszName;
+    uint16_t usLoss; // Per mille, both directions
+    uint32_t ulDropFirst; // Chunks lost the first time they are sent
+    uint8_t ubCorrupt; // Stored chunks damaged, 1 only on the first transfer, 2 always
+} test_radio_fota_case_t;
+
+static const test_radio_fota_case_t pCases[] = {
+    {"clean", 0, 0, 0},
+    {"fast", 0, BIT(3) | BIT(9) | BIT(20), 0},
+    {"lossy", 50, 0, 0},
+    {"lossy", 200, 0, 0},
+    {"mismatch", 0, 0, 1},
+    {"corrupt", 0, 0, 2},
+};
+
+// Stub air
+static rfm69_rx_callback_fn_t pfStubRX = NULL;
+static test_radio_fota_frame_t pStubQueue[TEST_RADIO_FOTA_QUEUE_SIZE];
+static uint8_t ubStubQueued = 0;
+static uint64_t ullStubAirFree = 0;
+static uint16_t usStubNextID = 1;
+static uint16_t usStubLoss = 0;
+static uint32_t ulStubRandom = 1;
+
+// Node
+static uint8_t pubNodeImage[TEST_RADIO_FOTA_MAX_IMAGE_SIZE];
+static uint8_t pubNodeStored[TEST_RADIO_FOTA_MAX_IMAGE_SIZE / RADIO_PROTOCOL_FOTA_CHUNK_SIZE + 1];
+static uint32_t ulNodeVersion = 0;
+static uint32_t ulNodeImageSize = 0;
+static uint32_t ulNodeNewChunks = 0;
+static uint8_t ubNodeACKs = 1;
+static uint8_t ubNodeCorrupt = 0;
+static uint8_t ubNodeTransfers = 0; // FOTA_BEGIN from offset 0
+
+// Gateway side
+static uint32_t ulDropFirst = 0;
+static uint8_t pubChunkSends[TEST_RADIO_FOTA_CHUNKS];
+static uint64_t pullChunkFirstSend[TEST_RADIO_FOTA_CHUNKS];
+static uint64_t pullChunkSecondSend[TEST_RADIO_FOTA_CHUNKS];
+static uint16_t pusSendLog[TEST_RADIO_FOTA_LOG_SIZE]; // Chunk index of every chunk frame the gateway sent
+static uint32_t ulSendLogCount = 0;
+static uint8_t ubDone = 0;
+static uint8_t ubSuccess = 0;
+
+static uint32_t test_radio_fota_random()
+{
+    ulStubRandom ^= ulStubRandom << 13;
+    ulStubRandom ^= ulStubRandom >> 17;
+    ulStubRandom ^= ulStubRandom << 5;
+
+    return ulStubRandom;
+}
+static uint8_t test_radio_fota_stub_queue(uint8_t ubToNode, const uint8_t *pubData, uint8_t ubSize)
+{
+    if(ubStubQueued == TEST_RADIO_FOTA_QUEUE_SIZE)
+        return 0;
+
+    // Half duplex, every frame waits for the air
+    if(ullStubAirFree < g_ullSystemTick)
+        ullStubAirFree = g_ullSystemTick;
+
+    ullStubAirFree += TEST_RADIO_FOTA_FRAME_TIME(ubSize);
+
+    if(usStubLoss && test_radio_fota_random() % 1000 < usStubLoss)
+        return 1; // Lost on air, the airtime is spent anyway
+
+    test_radio_fota_frame_t *pFrame = &pStubQueue[ubStubQueued++];
+
+    pFrame->ullAt = ullStubAirFree;
+    pFrame->ubToNode = ubToNode;
+    pFrame->ubSize = ubSize;
+
+    memcpy(pFrame->pubData, pubData, ubSize);
+
+    return 1;
+}
+static void test_radio_fota_stub_to_gateway(const uint8_t *pubData, uint8_t ubSize)
+{
+    rfm69_packet_header_t xHeader;
+
+    if(!pfStubRX)
+        return;
+
+    memset(&xHeader, 0, sizeof(rfm69_packet_header_t));
+
+    xHeader.usID = usStubNextID++;
+    xHeader.ubReceiverNodeID = 1;
+    xHeader.ubSenderNodeID = TEST_RADIO_FOTA_NODE_ID;
+
+    pfStubRX(&xHeader, -70, pubData, ubSize);
+}
+
+static uint32_t test_radio_fota_node_prefix()
+{
+    uint32_t ulChunks = (ulNodeImageSize + RADIO_PROTOCOL_FOTA_CHUNK_SIZE - 1) / RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+    uint32_t ulPrefix = 0;
+
+    while(ulPrefix < ulChunks && pubNodeStored[ulPrefix])
+        ulPrefix++;
+
+    ulPrefix *= RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+
+    return ulPrefix > ulNodeImageSize ? ulNodeImageSize : ulPrefix;
+}
+static void test_radio_fota_node_respond(const void *pvMessage)
+{
+    uint8_t pubBuffer[RFM69_MAX_DATA_SIZE];
+    uint8_t ubSize = radio_protocol_encode(pvMessage, pubBuffer, sizeof(pubBuffer));
+
+    if(ubSize)
+        test_radio_fota_stub_queue(0, pubBuffer, ubSize);
+}
+static void test_radio_fota_node_ack()
+{
+    radio_cmd_fota_send_chunk_res_t xACK;
+
+    if(!ubNodeACKs)
+        return;
+
+    xACK.ubCommand = RADIO_CMD_FOTA_SEND_CHUNK;
+    xACK.ulOffset = test_radio_fota_node_prefix();
+    xACK.ulReceivedMask = 0;
+
+    for(uint8_t i = 0; i < 32; i++)
+    {
+        uint32_t ulChunk = xACK.ulOffset / RADIO_PROTOCOL_FOTA_CHUNK_SIZE + i;
+
+        if(ulChunk * RADIO_PROTOCOL_FOTA_CHUNK_SIZE < ulNodeImageSize && pubNodeStored[ulChunk])
+            xACK.ulReceivedMask |= BIT(i);
+    }
+
+    test_radio_fota_node_respond(&xACK);
+}
+static void test_radio_fota_node_rx(const uint8_t *pubData, uint8_t ubSize)
+{
+    uint32_t pulMessage[RADIO_DISPATCH_MAX_MESSAGE_SIZE / sizeof(uint32_t)];
+
+    if(!radio_protocol_decode(pulMessage, sizeof(pulMessage), pubData, ubSize))
+        return;
+
+    switch(*(uint8_t *)pulMessage)
+    {
+        case RADIO_CMD_FOTA_BEGIN | RADIO_CMD_REQUEST_FLAG:
+        {
+            const radio_cmd_fota_begin_req_t *pBegin = (const radio_cmd_fota_begin_req_t *)pulMessage;
+            radio_cmd_fota_begin_res_t xResponse = {RADIO_CMD_FOTA_BEGIN, 0};
+
+            if(pBegin->ulImageSize > TEST_RADIO_FOTA_MAX_IMAGE_SIZE)
+                return;
+
+            if(pBegin->ulVersion != ulNodeVersion || pBegin->ulImageSize != ulNodeImageSize)
+            {
+                memset(pubNodeStored, 0, sizeof(pubNodeStored));
+
+                ulNodeVersion = pBegin->ulVersion;
+                ulNodeImageSize = pBegin->ulImageSize;
+            }
+
+            xResponse.ulOffset = test_radio_fota_node_prefix();
+            ulNodeNewChunks = 0;
+
+            if(!xResponse.ulOffset)
+                ubNodeTransfers++;
+
+            test_radio_fota_node_respond(&xResponse);
+        }
+        break;
+        case RADIO_CMD_FOTA_SEND_CHUNK | RADIO_CMD_REQUEST_FLAG:
+        {
+            const radio_cmd_fota_send_chunk_req_t *pChunk = (const radio_cmd_fota_send_chunk_req_t *)pulMessage;
+            uint32_t ulChunk = pChunk->ulOffset / RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+
+            if(!ulNodeImageSize || pChunk->ulOffset % RADIO_PROTOCOL_FOTA_CHUNK_SIZE || pChunk->ulOffset + pChunk->ubDataSize > ulNodeImageSize)
+                return;
+
+            if(pubNodeStored[ulChunk])
+            {
+                test_radio_fota_node_ack(); // Duplicate, the gateway missed an ACK
+
+                return;
+            }
+
+            uint32_t ulPrefix = test_radio_fota_node_prefix();
+
+            memcpy(pubNodeImage + pChunk->ulOffset, pChunk->pubData, pChunk->ubDataSize);
+
+            if(ulChunk == 5 && (ubNodeCorrupt == 2 || (ubNodeCorrupt == 1 && ubNodeTransfers == 1)))
+                pubNodeImage[pChunk->ulOffset] ^= 0x01; // Flash write gone wrong
+
+            pubNodeStored[ulChunk] = 1;
+            ulNodeNewChunks++;
+
+            uint8_t ubGap = pChunk->ulOffset > ulPrefix;
+            uint8_t ubFilled = pChunk->ulOffset == ulPrefix && pubNodeStored[ulChunk + 1];
+            uint8_t ubLast = pChunk->ulOffset + pChunk->ubDataSize == ulNodeImageSize;
+
+            if(ubGap || ubFilled || ubLast || !(ulNodeNewChunks % TEST_RADIO_FOTA_ACK_EVERY))
+                test_radio_fota_node_ack();
+        }
+        break;
+        case RADIO_CMD_FOTA_END | RADIO_CMD_REQUEST_FLAG:
+        {
+            const radio_cmd_fota_end_req_t *pEnd = (const radio_cmd_fota_end_req_t *)pulMessage;
+            radio_cmd_fota_end_res_t xResponse = {RADIO_CMD_FOTA_END, RADIO_FOTA_STATUS_OK};
+            uint8_t pubDigest[RADIO_PROTOCOL_FOTA_DIGEST_SIZE];
+
+            if(test_radio_fota_node_prefix() != ulNodeImageSize)
+            {
+                xResponse.ubStatus = RADIO_FOTA_STATUS_ERROR;
+            }
+            else
+            {
+                crypto_sha256(pubNodeImage, ulNodeImageSize, pubDigest);
+
+                if(pEnd->ubDigestSize != RADIO_PROTOCOL_FOTA_DIGEST_SIZE || memcmp(pubDigest, pEnd->pubDigest, RADIO_PROTOCOL_FOTA_DIGEST_SIZE))
+                {
+                    memset(pubNodeStored, 0, sizeof(pubNodeStored)); // Discarded, the next begin reports offset 0
+
+                    xResponse.ubStatus = RADIO_FOTA_STATUS_HASH_MISMATCH;
+                }
+            }
+
+            test_radio_fota_node_respond(&xResponse);
+        }
+        break;
+    }
+}
+
+void rfm69_set_rx_callback(rfm69_rx_callback_fn_t pfFunc)
+{
+    pfStubRX = pfFunc;
+}
+uint16_t rfm69_send(uint8_t ubReceiver, const void *pvPayload, uint8_t ubSize, uint8_t ubQoSLevel, uint16_t usRetryDelay, uint16_t usRetries)
+{
+    const uint8_t *pubPayload = (const uint8_t *)pvPayload;
+    uint8_t ubPending = 0;
+
+    for(uint8_t i = 0; i < ubStubQueued; i++)
+        ubPending += pStubQueue[i].ubToNode;
+
+    if(ubReceiver != TEST_RADIO_FOTA_NODE_ID || !ubSize || ubPending >= TEST_RADIO_FOTA_TX_FIFO)
+        return 0;
+
+    if(pubPayload[0] == (RADIO_CMD_FOTA_SEND_CHUNK | RADIO_CMD_REQUEST_FLAG))
+    {
+        radio_cmd_fota_send_chunk_req_t xChunk;
+
+        if(radio_protocol_decode(&xChunk, sizeof(xChunk), pubPayload, ubSize) && xChunk.ulOffset / RADIO_PROTOCOL_FOTA_CHUNK_SIZE < TEST_RADIO_FOTA_CHUNKS)
+        {
+            uint32_t ulChunk = xChunk.ulOffset / RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+
+            if(ulSendLogCount < TEST_RADIO_FOTA_LOG_SIZE)
+                pusSendLog[ulSendLogCount++] = ulChunk;
+
+            if(!pubChunkSends[ulChunk])
+                pullChunkFirstSend[ulChunk] = g_ullSystemTick;
+            else if(pubChunkSends[ulChunk] == 1)
+                pullChunkSecondSend[ulChunk] = g_ullSystemTick;
+
+            if(pubChunkSends[ulChunk]++ == 0 && ulChunk < 32 && (ulDropFirst & BIT(ulChunk)))
+                return usStubNextID++; // Scripted loss, taken by the radio and never heard
+        }
+    }
+
+    if(!test_radio_fota_stub_queue(1, pubPayload, ubSize))
+        return 0;
+
+    return usStubNextID++;
+}
+static void test_radio_fota_stub_tick()
+{
+    for(uint8_t i = 0; i < ubStubQueued;)
+    {
+        if(pStubQueue[i].ullAt > g_ullSystemTick)
+        {
+            i++;
+
+            continue;
+        }
+
+        test_radio_fota_frame_t xFrame = pStubQueue[i];
+
+        memmove(&pStubQueue[i], &pStubQueue[i + 1], (--ubStubQueued - i) * sizeof(test_radio_fota_frame_t)); // Keep air order
+
+        if(xFrame.ubToNode)
+            test_radio_fota_node_rx(xFrame.pubData, xFrame.ubSize);
+        else
+            test_radio_fota_stub_to_gateway(xFrame.pubData, xFrame.ubSize);
+    }
+}
+
+static void test_radio_fota_callback(uint8_t ubNodeID, uint8_t ubResult)
+{
+    ubDone = 1;
+    ubSuccess = ubResult;
+}
+static void test_radio_fota_setup(uint16_t usLoss, uint32_t ulDrop, uint8_t ubCorrupt)
+{
+    ulStubRandom = 0x9E3779B9 ^ usLoss;
+
+    for(uint32_t i = 0; i < TEST_RADIO_FOTA_IMAGE_SIZE; i++)
+        g_pubHostQSPIFlash[TEST_RADIO_FOTA_IMAGE_ADDRESS + i] = test_radio_fota_random();
+
+    memset(pubNodeImage, 0, sizeof(pubNodeImage));
+    memset(pubNodeStored, 0, sizeof(pubNodeStored));
+    memset(pubChunkSends, 0, sizeof(pubChunkSends));
+
+    ubStubQueued = 0;
+    ullStubAirFree = 0;
+    usStubLoss = usLoss;
+    ulNodeVersion = 0;
+    ulNodeImageSize = 0;
+    ubNodeACKs = 1;
+    ubNodeCorrupt = ubCorrupt;
+    ubNodeTransfers = 0;
+    ulDropFirst = ulDrop;
+    ulSendLogCount = 0;
+    ubDone = 0;
+    ubSuccess = 0;
+
+    radio_transport_init();
+    radio_dispatch_init();
+    radio_fota_init();
+}
+static void test_radio_fota_step()
+{
+    host_advance(1);
+    test_radio_fota_stub_tick();
+    radio_transport_tick();
+    radio_dispatch_tick();
+    radio_fota_tick();
+}
+static void test_radio_fota_run_for(uint32_t ulTime)
+{
+    for(uint32_t i = 0; i < ulTime && !ubDone; i++)
+        test_radio_fota_step();
+}
+static void test_radio_fota_run()
+{
+    uint64_t ullStart = g_ullSystemTick;
+
+    while(!ubDone && g_ullSystemTick - ullStart < TEST_RADIO_FOTA_STEP_LIMIT)
+        test_radio_fota_step();
+}
+static uint8_t test_radio_fota_image_ok()
+{
+    return ulNodeImageSize == TEST_RADIO_FOTA_IMAGE_SIZE && test_radio_fota_node_prefix() == TEST_RADIO_FOTA_IMAGE_SIZE && !memcmp(pubNodeImage, g_pubHostQSPIFlash + TEST_RADIO_FOTA_IMAGE_ADDRESS, TEST_RADIO_FOTA_IMAGE_SIZE);
+}
+static void test_radio_fota_report(const char *pszName, uint16_t usLoss)
+{
+    radio_fota_stats_t xStats;
+
+    radio_fota_get_stats(&xStats);
+
+    printf("%-9s %5hu %7u %7u %7u %6u %8u %8u %7u\n", pszName, usLoss, TEST_RADIO_FOTA_CHUNKS, xStats.ulChunksSent, xStats.ulChunksResent, xStats.ulAcks, xStats.ulTimeouts, xStats.ulHashMismatches, xStats.ulElapsed);
+}
+
+static uint8_t test_radio_fota_case(const test_radio_fota_case_t *pCase)
+{
+    radio_fota_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    test_radio_fota_setup(pCase->usLoss, pCase->ulDropFirst, pCase->ubCorrupt);
+
+    if(!radio_fota_start(TEST_RADIO_FOTA_NODE_ID, TEST_RADIO_FOTA_IMAGE_ADDRESS, TEST_RADIO_FOTA_IMAGE_SIZE, TEST_RADIO_FOTA_VERSION, test_radio_fota_callback))
+    {
+        printf("  %s: session refused\n", pCase->pszName);
+
+        return 1;
+    }
+
+    test_radio_fota_run();
+
+    radio_fota_get_stats(&xStats);
+
+    if(pCase->ubCorrupt == 2)
+    {
+        // Every transfer ends in a mismatch, the session gives up after its restarts
+        if(!ubDone || ubSuccess || xStats.ulHashMismatches != RADIO_FOTA_MAX_RESTARTS + 1 || ubNodeTransfers != RADIO_FOTA_MAX_RESTARTS + 1)
+        {
+            printf("  %s: done %hhu, success %hhu, %u mismatches over %hhu transfers\n", pCase->pszName, ubDone, ubSuccess, xStats.ulHashMismatches, ubNodeTransfers);
+
+            ubFailed = 1;
+        }
+
+        test_radio_fota_report(pCase->pszName, pCase->usLoss);
+
+        return ubFailed;
+    }
+
+    if(!ubDone || !ubSuccess || !test_radio_fota_image_ok())
+    {
+        printf("  %s: done %hhu, success %hhu, node image %s\n", pCase->pszName, ubDone, ubSuccess, test_radio_fota_image_ok() ? "intact" : "wrong");
+
+        ubFailed = 1;
+    }
+
+    if(pCase->ubCorrupt == 1 && (xStats.ulHashMismatches != 1 || ubNodeTransfers != 2))
+    {
+        printf("  %s: %u mismatches over %hhu transfers\n", pCase->pszName, xStats.ulHashMismatches, ubNodeTransfers);
+
+        ubFailed = 1;
+    }
+
+    if(!pCase->usLoss && !pCase->ubCorrupt && (xStats.ulTimeouts || xStats.ulChunksResent != __builtin_popcount(pCase->ulDropFirst)))
+    {
+        printf("  %s: %u timeouts, %u chunks resent\n", pCase->pszName, xStats.ulTimeouts, xStats.ulChunksResent);
+
+        ubFailed = 1;
+    }
+
+    // Fast retransmit, a lost chunk goes again on the first ACK past it, long before the ACK timeout
+    for(uint8_t i = 0; i < 32; i++)
+    {
+        if(!(pCase->ulDropFirst & BIT(i)))
+            continue;
+
+        if(pubChunkSends[i] != 2 || pullChunkSecondSend[i] - pullChunkFirstSend[i] >= RADIO_FOTA_ACK_TIMEOUT)
+        {
+            printf("  %s: chunk %hhu sent %hhu times, again after %llu ms\n", pCase->pszName, i, pubChunkSends[i], (unsigned long long)(pullChunkSecondSend[i] - pullChunkFirstSend[i]));
+
+            ubFailed = 1;
+        }
+    }
+
+    test_radio_fota_report(pCase->pszName, pCase->usLoss);
+
+    return ubFailed;
+}
+static void test_radio_fota_inject_ack(uint32_t ulOffset, uint32_t ulMask)
+{
+    radio_cmd_fota_send_chunk_res_t xACK = {RADIO_CMD_FOTA_SEND_CHUNK, ulOffset, ulMask};
+    uint8_t pubBuffer[RFM69_MAX_DATA_SIZE];
+    uint8_t ubSize = radio_protocol_encode(&xACK, pubBuffer, sizeof(pubBuffer));
+
+    test_radio_fota_stub_to_gateway(pubBuffer, ubSize);
+}
+static uint8_t test_radio_fota_log_is(const char *pszStep, uint32_t ulFrom, const uint16_t *pusExpected, uint8_t ubCount)
+{
+    uint8_t ubFailed = ulSendLogCount - ulFrom != ubCount;
+
+    for(uint8_t i = 0; i < ubCount && !ubFailed; i++)
+        ubFailed = pusSendLog[ulFrom + i] != pusExpected[i];
+
+    if(!ubFailed)
+        return 0;
+
+    printf("  window, %s: sent", pszStep);
+
+    for(uint32_t i = ulFrom; i < ulSendLogCount; i++)
+        printf(" %hu", pusSendLog[i]);
+
+    printf(", expected");
+
+    for(uint8_t i = 0; i < ubCount; i++)
+        printf(" %hu", pusExpected[i]);
+
+    printf("\n");
+
+    return 1;
+}
+static uint8_t test_radio_fota_window()
+{
+    static const uint16_t pusFirstWindow[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    static const uint16_t pusAfterShift[] = {4, 5, 16, 17, 18, 19}; // Holes below the highest ACKed chunk first, then the room the shift made
+    static const uint16_t pusAfterJump[] = {20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35};
+    radio_fota_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    test_radio_fota_setup(0, 0, 0);
+
+    ubNodeACKs = 0; // The node stores but stays quiet, the ACKs below are crafted
+
+    radio_fota_start(TEST_RADIO_FOTA_NODE_ID, TEST_RADIO_FOTA_IMAGE_ADDRESS, TEST_RADIO_FOTA_IMAGE_SIZE, TEST_RADIO_FOTA_VERSION, test_radio_fota_callback);
+
+    test_radio_fota_run_for(RADIO_FOTA_ACK_TIMEOUT / 2);
+
+    ubFailed |= test_radio_fota_log_is("first window", 0, pusFirstWindow, sizeof(pusFirstWindow) / sizeof(pusFirstWindow[0]));
+
+    // Cumulative ACK at chunk 4 with 6 and 7 held, 4 and 5 were lost
+    uint32_t ulFrom = ulSendLogCount;
+
+    test_radio_fota_inject_ack(4 * RADIO_PROTOCOL_FOTA_CHUNK_SIZE, BIT(2) | BIT(3));
+    test_radio_fota_run_for(50);
+
+    ubFailed |= test_radio_fota_log_is("shift", ulFrom, pusAfterShift, sizeof(pusAfterShift) / sizeof(pusAfterShift[0]));
+
+    radio_fota_get_stats(&xStats);
+
+    if(xStats.ulAckedBytes != 4 * RADIO_PROTOCOL_FOTA_CHUNK_SIZE || xStats.ulChunksResent != 2)
+    {
+        printf("  window, shift: %u bytes acked, %u resent\n", xStats.ulAckedBytes, xStats.ulChunksResent);
+
+        ubFailed = 1;
+    }
+
+    // The same ACK again, fast retransmit happens once per hole, a stale and a bogus offset change nothing
+    ulFrom = ulSendLogCount;
+
+    test_radio_fota_inject_ack(4 * RADIO_PROTOCOL_FOTA_CHUNK_SIZE, BIT(2) | BIT(3));
+    test_radio_fota_inject_ack(0, 0xFFFFFFFF);
+    test_radio_fota_inject_ack(TEST_RADIO_FOTA_IMAGE_SIZE + RADIO_PROTOCOL_FOTA_CHUNK_SIZE, 0);
+    test_radio_fota_run_for(50);
+
+    ubFailed |= test_radio_fota_log_is("repeat", ulFrom, NULL, 0);
+
+    radio_fota_get_stats(&xStats);
+
+    if(xStats.ulAckedBytes != 4 * RADIO_PROTOCOL_FOTA_CHUNK_SIZE || xStats.ulAcks != 4)
+    {
+        printf("  window, repeat: %u bytes acked, %u ACKs\n", xStats.ulAckedBytes, xStats.ulAcks);
+
+        ubFailed = 1;
+    }
+
+    // Cumulative ACK past the whole window, it moves by 16 chunks and fills again
+    ulFrom = ulSendLogCount;
+
+    test_radio_fota_inject_ack(20 * RADIO_PROTOCOL_FOTA_CHUNK_SIZE, 0);
+    test_radio_fota_run_for(RADIO_FOTA_ACK_TIMEOUT / 2);
+
+    ubFailed |= test_radio_fota_log_is("jump", ulFrom, pusAfterJump, sizeof(pusAfterJump) / sizeof(pusAfterJump[0]));
+
+    // No progress for the ACK timeout, everything past the cumulative ACK goes again
+    ulFrom = ulSendLogCount;
+
+    test_radio_fota_run_for(RADIO_FOTA_ACK_TIMEOUT);
+
+    ubFailed |= test_radio_fota_log_is("timeout", ulFrom, pusAfterJump, sizeof(pusAfterJump) / sizeof(pusAfterJump[0]));
+
+    radio_fota_get_stats(&xStats);
+
+    if(xStats.ulTimeouts != 1)
+    {
+        printf("  window, timeout: %u timeouts\n", xStats.ulTimeouts);
+
+        ubFailed = 1;
+    }
+
+    // The node speaks up again, the rest of the transfer has to finish from what it holds
+    ubNodeACKs = 1;
+
+    test_radio_fota_node_ack();
+    test_radio_fota_run();
+
+    if(!ubDone || !ubSuccess || !test_radio_fota_image_ok())
+    {
+        printf("  window: done %hhu, success %hhu, node image %s\n", ubDone, ubSuccess, test_radio_fota_image_ok() ? "intact" : "wrong");
+
+        ubFailed = 1;
+    }
+
+    test_radio_fota_report("window", 0);
+
+    return ubFailed;
+}
+static uint8_t test_radio_fota_resume()
+{
+    radio_fota_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    test_radio_fota_setup(0, 0, 0);
+
+    radio_fota_start(TEST_RADIO_FOTA_NODE_ID, TEST_RADIO_FOTA_IMAGE_ADDRESS, TEST_RADIO_FOTA_IMAGE_SIZE, TEST_RADIO_FOTA_VERSION, test_radio_fota_callback);
+
+    do
+    {
+        test_radio_fota_step();
+
+        radio_fota_get_stats(&xStats);
+    } while(xStats.ulAckedBytes < TEST_RADIO_FOTA_IMAGE_SIZE / 2);
+
+    radio_fota_abort();
+
+    test_radio_fota_run_for(RADIO_FOTA_ACK_TIMEOUT); // Whatever was on air lands
+
+    uint32_t ulHeld = test_radio_fota_node_prefix();
+
+    radio_fota_start(TEST_RADIO_FOTA_NODE_ID, TEST_RADIO_FOTA_IMAGE_ADDRESS, TEST_RADIO_FOTA_IMAGE_SIZE, TEST_RADIO_FOTA_VERSION, test_radio_fota_callback);
+
+    test_radio_fota_run();
+
+    radio_fota_get_stats(&xStats);
+
+    uint32_t ulRemaining = (TEST_RADIO_FOTA_IMAGE_SIZE - ulHeld + RADIO_PROTOCOL_FOTA_CHUNK_SIZE - 1) / RADIO_PROTOCOL_FOTA_CHUNK_SIZE;
+
+    if(!ubDone || !ubSuccess || !test_radio_fota_image_ok() || ubNodeTransfers != 1 || xStats.ulChunksSent != ulRemaining)
+    {
+        printf("  resume: done %hhu, success %hhu, %hhu transfers, %u chunks sent for %u remaining\n", ubDone, ubSuccess, ubNodeTransfers, xStats.ulChunksSent, ulRemaining);
+
+        ubFailed = 1;
+    }
+
+    test_radio_fota_report("resume", 0);
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("%-9s %5s %7s %7s %7s %6s %8s %8s %7s\n", "case", "loss", "chunks", "sent", "resent", "acks", "timeouts", "mismatch", "ms");
+
+    for(uint8_t i = 0; i < sizeof(pCases) / sizeof(pCases[0]); i++)
+        ubFailed |= test_radio_fota_case(&pCases[i]);
+
+    ubFailed |= test_radio_fota_window();
+    ubFailed |= test_radio_fota_resume();
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
@@ -0,0 +1,509 @@
+#include "host.h"
+#include "radio_protocol.h"
+
+// radio_protocol_encode() and radio_protocol_decode_message() over every message in the table, random contents plus the largest values each field takes
+// Every proper prefix, a wrong version, a wrong command, trailing bytes, a short buffer or struct and overlong varints have to be refused
+// Bytes on air of typical messages are compared with the old layout, where the struct went out as is
+
+#define TEST_RADIO_PROTOCOL_ROUNDS      2000
+#define TEST_RADIO_PROTOCOL_BUFFER_SIZE 128
+
+typedef struct
+{
+    uint8_t ubCommand;
+    const uint8_t *pubData;
+    uint8_t ubSize;
+    uint8_t ubAccepted;
+    uint32_t ulValue; // Decoded value of the varint when accepted
+} test_radio_protocol_varint_case_t;
+
+typedef struct
+{
+    const char *pszName;
+    uint8_t ubCommand;
+    uint8_t ubOldSize; // sizeof() of the struct on the node (ARM EABI alignment), what used to go on air
+} test_radio_protocol_air_case_t;
+
+static const uint8_t pubVarintMax32[] = {RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, RADIO_PROTOCOL_WIRE_VERSION, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F};
+static const uint8_t pubVarintOver32[] = {RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, RADIO_PROTOCOL_WIRE_VERSION, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F};
+static const uint8_t pubVarintSixBytes[] = {RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, RADIO_PROTOCOL_WIRE_VERSION, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+static const uint8_t pubVarintUnterminated[] = {RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, RADIO_PROTOCOL_WIRE_VERSION, 0x80, 0x80};
+static const uint8_t pubVarintMax16[] = {RADIO_CMD_LED_SET | RADIO_CMD_REQUEST_FLAG, RADIO_PROTOCOL_WIRE_VERSION, 0x01, 0xFF, 0xFF, 0x03};
+static const uint8_t pubVarintOver16[] = {RADIO_CMD_LED_SET | RADIO_CMD_REQUEST_FLAG, RADIO_PROTOCOL_WIRE_VERSION, 0x01, 0x80, 0x80, 0x04};
+
+static const test_radio_protocol_varint_case_t pVarintCases[] = {
+    {RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, pubVarintMax32, sizeof(pubVarintMax32), 1, 0xFFFFFFFF},
+    {RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, pubVarintOver32, sizeof(pubVarintOver32), 0, 0},
+    {RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, pubVarintSixBytes, sizeof(pubVarintSixBytes), 0, 0},
+    {RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, pubVarintUnterminated, sizeof(pubVarintUnterminated), 0, 0},
+    {RADIO_CMD_LED_SET | RADIO_CMD_REQUEST_FLAG, pubVarintMax16, sizeof(pubVarintMax16), 1, 0xFFFF},
+    {RADIO_CMD_LED_SET | RADIO_CMD_REQUEST_FLAG, pubVarintOver16, sizeof(pubVarintOver16), 0, 0},
+};
+static const test_radio_protocol_air_case_t pAirCases[] = {
+    {"ping_req", RADIO_CMD_PING | RADIO_CMD_REQUEST_FLAG, 1},
+    {"led_set_req", RADIO_CMD_LED_SET | RADIO_CMD_REQUEST_FLAG, 4},
+    {"uid_read_res", RADIO_CMD_UID_READ, 16},
+    {"temp_data_req", RADIO_CMD_TEMP_DATA | RADIO_CMD_REQUEST_FLAG, 8},
+    {"temp_data_res", RADIO_CMD_TEMP_DATA, 16},
+    {"bat_data_req", RADIO_CMD_BAT_DATA | RADIO_CMD_REQUEST_FLAG, 8},
+    {"bat_data_res", RADIO_CMD_BAT_DATA, 24},
+    {"power_cfg_req", RADIO_CMD_RADIO_POWER_CFG | RADIO_CMD_REQUEST_FLAG, 2},
+    {"report_cfg_req", RADIO_CMD_REPORT_CFG | RADIO_CMD_REQUEST_FLAG, 20},
+    {"sleep_cfg_req", RADIO_CMD_SLEEP_CFG | RADIO_CMD_REQUEST_FLAG, 8},
+    {"fota_info_res", RADIO_CMD_FOTA_QUERY_INFO, 32},
+};
+
+static uint32_t ulRandom = 1;
+
+static uint32_t test_radio_protocol_random()
+{
+    ulRandom ^= ulRandom << 13;
+    ulRandom ^= ulRandom >> 17;
+    ulRandom ^= ulRandom << 5;
+
+    return ulRandom;
+}
+
+// Valid contents for every field, random or the largest the field takes
+static void test_radio_protocol_fill(const radio_protocol_message_t *pMessage, uint8_t *pubMessage, uint8_t ubLargest)
+{
+    memset(pubMessage, 0, pMessage->ubStructSize);
+
+    pubMessage[0] = pMessage->ubCommand;
+
+    for(uint8_t i = 0; i < pMessage->ubFieldCount; i++)
+    {
+        const radio_protocol_field_t *pField = &pMessage->pFields[i];
+        uint8_t *pubDst = pubMessage + pField->ubOffset;
+        uint32_t ulValue = ubLargest ? 0xFFFFFFFF : test_radio_protocol_random();
+
+        switch(pField->ubType)
+        {
+            case RADIO_PROTOCOL_FIELD_BYTE:
+                *pubDst = ulValue;
+            break;
+            case RADIO_PROTOCOL_FIELD_U16:
+            {
+                uint16_t usValue = ulValue;
+
+                memcpy(pubDst, &usValue, sizeof(uint16_t));
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_U32:
+                memcpy(pubDst, &ulValue, sizeof(uint32_t));
+            break;
+            case RADIO_PROTOCOL_FIELD_VARINT:
+            {
+                if(!ubLargest)
+                    ulValue >>= test_radio_protocol_random() % 32; // Every encoded length shows up
+
+                if(pField->ubArg == sizeof(uint16_t))
+                {
+                    uint16_t usValue = ulValue;
+
+                    memcpy(pubDst, &usValue, sizeof(uint16_t));
+                }
+                else
+                {
+                    memcpy(pubDst, &ulValue, sizeof(uint32_t));
+                }
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_FLAG:
+                *pubDst = ulValue & 1;
+            break;
+            case RADIO_PROTOCOL_FIELD_STRING:
+            {
+                uint8_t ubLength = ubLargest ? pField->ubArg - 1U : ulValue % pField->ubArg;
+
+                for(uint8_t j = 0; j < ubLength; j++)
+                    pubDst[j] = ' ' + test_radio_protocol_random() % 95;
+            }
+            break;
+            case RADIO_PROTOCOL_FIELD_BYTES:
+            {
+                uint8_t ubLength = ubLargest ? pField->ubArg : ulValue % (pField->ubArg + 1);
+
+                *pubDst++ = ubLength;
+
+                for(uint8_t j = 0; j < ubLength; j++)
+                    pubDst[j] = test_radio_protocol_random();
+            }
+            break;
+        }
+    }
+}
+static uint8_t test_radio_protocol_check(const radio_protocol_message_t *pMessage, const uint8_t *pubMessage, uint8_t *pubBuffer, uint8_t *pubSize)
+{
+    uint32_t pulDecoded[TEST_RADIO_PROTOCOL_BUFFER_SIZE / 4];
+    uint8_t *pubDecoded = (uint8_t *)pulDecoded;
+    uint8_t ubMaxSize = radio_protocol_get_max_size(pMessage->ubCommand);
+    uint8_t ubSize = radio_protocol_encode(pubMessage, pubBuffer, TEST_RADIO_PROTOCOL_BUFFER_SIZE - 1);
+
+    *pubSize = ubSize;
+
+    if(!ubSize || ubSize > ubMaxSize)
+    {
+        printf("  0x%02X: encoded to %hhu bytes, at most %hhu\n", pMessage->ubCommand, ubSize, ubMaxSize);
+
+        return 1;
+    }
+
+    memset(pubDecoded, 0xA5, sizeof(pulDecoded));
+
+    if(!radio_protocol_decode_message(pMessage, pubDecoded, pMessage->ubStructSize, pubBuffer, ubSize) || memcmp(pubDecoded, pubMessage, pMessage->ubStructSize))
+    {
+        printf("  0x%02X: round trip changed the message\n", pMessage->ubCommand);
+
+        return 1;
+    }
+
+    if(!radio_protocol_decode(pubDecoded, pMessage->ubStructSize, pubBuffer, ubSize))
+    {
+        printf("  0x%02X: lookup by command failed\n", pMessage->ubCommand);
+
+        return 1;
+    }
+
+    for(uint8_t i = 0; i < ubSize; i++)
+    {
+        if(radio_protocol_decode_message(pMessage, pubDecoded, pMessage->ubStructSize, pubBuffer, i))
+        {
+            printf("  0x%02X: %hhu of %hhu bytes decoded\n", pMessage->ubCommand, i, ubSize);
+
+            return 1;
+        }
+
+        if(radio_protocol_encode(pubMessage, pubDecoded, i))
+        {
+            printf("  0x%02X: encoded into %hhu of %hhu bytes\n", pMessage->ubCommand, i, ubSize);
+
+            return 1;
+        }
+    }
+
+    pubBuffer[ubSize] = test_radio_protocol_random();
+
+    if(radio_protocol_decode_message(pMessage, pubDecoded, pMessage->ubStructSize, pubBuffer, ubSize + 1))
+    {
+        printf("  0x%02X: trailing byte accepted\n", pMessage->ubCommand);
+
+        return 1;
+    }
+
+    if(radio_protocol_decode_message(pMessage, pubDecoded, pMessage->ubStructSize - 1, pubBuffer, ubSize))
+    {
+        printf("  0x%02X: decoded into a short struct\n", pMessage->ubCommand);
+
+        return 1;
+    }
+
+    uint8_t ubVersion = pubBuffer[1];
+    uint8_t ubFailed = 0;
+
+    for(uint8_t i = 0; i < 2 && !ubFailed; i++)
+    {
+        pubBuffer[1] = i ? RADIO_PROTOCOL_WIRE_VERSION + 1 : RADIO_PROTOCOL_WIRE_VERSION - 1;
+
+        ubFailed = radio_protocol_decode_message(pMessage, pubDecoded, pMessage->ubStructSize, pubBuffer, ubSize);
+    }
+
+    pubBuffer[1] = ubVersion;
+    pubBuffer[0] ^= RADIO_CMD_REQUEST_FLAG;
+
+    ubFailed |= radio_protocol_decode_message(pMessage, pubDecoded, pMessage->ubStructSize, pubBuffer, ubSize);
+
+    pubBuffer[0] ^= RADIO_CMD_REQUEST_FLAG;
+
+    if(ubFailed)
+        printf("  0x%02X: wrong version or command accepted\n", pMessage->ubCommand);
+
+    return ubFailed;
+}
+
+static uint8_t test_radio_protocol_round_trip(const radio_protocol_message_t *pMessage)
+{
+    uint32_t pulMessage[TEST_RADIO_PROTOCOL_BUFFER_SIZE / 4];
+    uint8_t *pubMessage = (uint8_t *)pulMessage;
+    uint8_t pubBuffer[TEST_RADIO_PROTOCOL_BUFFER_SIZE];
+    uint8_t ubMinSize = 0xFF;
+    uint8_t ubLargestSize = 0;
+    uint8_t ubSize;
+
+    // Largest values first, the encoding has to hit the worst case exactly
+    test_radio_protocol_fill(pMessage, pubMessage, 1);
+
+    if(test_radio_protocol_check(pMessage, pubMessage, pubBuffer, &ubLargestSize))
+        return 1;
+
+    if(ubLargestSize != radio_protocol_get_max_size(pMessage->ubCommand))
+    {
+        printf("  0x%02X: largest message is %hhu bytes, worst case says %hhu\n", pMessage->ubCommand, ubLargestSize, radio_protocol_get_max_size(pMessage->ubCommand));
+
+        return 1;
+    }
+
+    for(uint16_t i = 0; i < TEST_RADIO_PROTOCOL_ROUNDS; i++)
+    {
+        test_radio_protocol_fill(pMessage, pubMessage, 0);
+
+        if(test_radio_protocol_check(pMessage, pubMessage, pubBuffer, &ubSize))
+            return 1;
+
+        if(ubSize < ubMinSize)
+            ubMinSize = ubSize;
+    }
+
+    printf("0x%02X %8hhu %6hhu %6hhu %8u\n", pMessage->ubCommand, pMessage->ubFieldCount, ubMinSize, ubLargestSize, TEST_RADIO_PROTOCOL_ROUNDS + 1);
+
+    return 0;
+}
+static uint8_t test_radio_protocol_varints()
+{
+    uint8_t ubFailed = 0;
+
+    for(uint8_t i = 0; i < sizeof(pVarintCases) / sizeof(pVarintCases[0]); i++)
+    {
+        const test_radio_protocol_varint_case_t *pCase = &pVarintCases[i];
+        const radio_protocol_message_t *pMessage = radio_protocol_get_message(pCase->ubCommand);
+        uint32_t pulDecoded[TEST_RADIO_PROTOCOL_BUFFER_SIZE / 4];
+        uint32_t ulValue = 0;
+        uint16_t usValue = 0;
+        uint8_t ubAccepted = radio_protocol_decode_message(pMessage, pulDecoded, pMessage->ubStructSize, pCase->pubData, pCase->ubSize);
+
+        if(ubAccepted && pCase->ubCommand == (RADIO_CMD_LED_SET | RADIO_CMD_REQUEST_FLAG))
+        {
+            memcpy(&usValue, (uint8_t *)pulDecoded + offsetof(radio_cmd_led_set_req_t, usValue), sizeof(uint16_t));
+
+            ulValue = usValue;
+        }
+        else if(ubAccepted)
+        {
+            memcpy(&ulValue, &((radio_cmd_sleep_cfg_req_t *)pulDecoded)->ulSleepTimeout, sizeof(uint32_t));
+        }
+
+        if(ubAccepted != pCase->ubAccepted || ulValue != pCase->ulValue)
+        {
+            printf("  varint %hhu: %s, value 0x%08X\n", i, ubAccepted ? "accepted" : "refused", ulValue);
+
+            ubFailed = 1;
+        }
+    }
+
+    return ubFailed;
+}
+static uint8_t test_radio_protocol_malformed()
+{
+    uint8_t pubBuffer[TEST_RADIO_PROTOCOL_BUFFER_SIZE];
+    uint8_t ubFailed = 0;
+
+    // Strings have to be terminated within their array
+    radio_cmd_fota_query_info_res_t xInfo;
+
+    memset(&xInfo, 'x', sizeof(xInfo));
+
+    xInfo.ubCommand = RADIO_CMD_FOTA_QUERY_INFO;
+    xInfo.ulCurrentVersion = 1;
+    xInfo.pszBuildTime[0] = '\0';
+
+    if(radio_protocol_encode(&xInfo, pubBuffer, sizeof(pubBuffer)))
+    {
+        printf("  unterminated string encoded\n");
+
+        ubFailed = 1;
+    }
+
+    // A string length that leaves no room for the terminator
+    uint8_t pubLongString[] = {RADIO_CMD_FOTA_QUERY_INFO, RADIO_PROTOCOL_WIRE_VERSION, 0x01, sizeof(xInfo.pszBuildDate), 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 0x00};
+
+    if(radio_protocol_decode(&xInfo, sizeof(xInfo), pubLongString, sizeof(pubLongString)))
+    {
+        printf("  oversized string decoded\n");
+
+        ubFailed = 1;
+    }
+
+    // Byte arrays longer than their field, both ways
+    radio_cmd_fota_end_req_t xEnd;
+
+    memset(&xEnd, 0, sizeof(xEnd));
+
+    xEnd.ubCommand = RADIO_CMD_FOTA_END | RADIO_CMD_REQUEST_FLAG;
+    xEnd.ubDigestSize = RADIO_PROTOCOL_FOTA_DIGEST_SIZE + 1;
+
+    if(radio_protocol_encode(&xEnd, pubBuffer, sizeof(pubBuffer)))
+    {
+        printf("  oversized byte array encoded\n");
+
+        ubFailed = 1;
+    }
+
+    memset(pubBuffer, 0, sizeof(pubBuffer));
+
+    pubBuffer[0] = RADIO_CMD_FOTA_END | RADIO_CMD_REQUEST_FLAG;
+    pubBuffer[1] = RADIO_PROTOCOL_WIRE_VERSION;
+    pubBuffer[2] = RADIO_PROTOCOL_FOTA_DIGEST_SIZE + 1;
+
+    if(radio_protocol_decode(&xEnd, sizeof(xEnd), pubBuffer, RADIO_PROTOCOL_FOTA_DIGEST_SIZE + 4))
+    {
+        printf("  oversized byte array decoded\n");
+
+        ubFailed = 1;
+    }
+
+    // Commands without a layout
+    uint8_t ubUnknown = RADIO_CMD_TRANSPORT_FRAGMENT;
+    uint8_t pubUnknown[] = {RADIO_CMD_TRANSPORT_FRAGMENT, RADIO_PROTOCOL_WIRE_VERSION};
+
+    if(radio_protocol_encode(&ubUnknown, pubBuffer, sizeof(pubBuffer)) || radio_protocol_decode(pubBuffer, sizeof(pubBuffer), pubUnknown, sizeof(pubUnknown)))
+    {
+        printf("  unknown command handled\n");
+
+        ubFailed = 1;
+    }
+
+    return ubFailed;
+}
+static void test_radio_protocol_typical(uint8_t ubCommand, void *pvMessage)
+{
+    const radio_protocol_message_t *pMessage = radio_protocol_get_message(ubCommand);
+
+    memset(pvMessage, 0, pMessage->ubStructSize);
+
+    *(uint8_t *)pvMessage = ubCommand;
+
+    switch(ubCommand & ~RADIO_CMD_REQUEST_FLAG)
+    {
+        case RADIO_CMD_LED_SET:
+        {
+            ((radio_cmd_led_set_req_t *)pvMessage)->ubMode = 1;
+            ((radio_cmd_led_set_req_t *)pvMessage)->usValue = 500;
+        }
+        break;
+        case RADIO_CMD_UID_READ:
+        {
+            ((radio_cmd_uid_read_res_t *)pvMessage)->usID0_15 = 0x1C4A;
+            ((radio_cmd_uid_read_res_t *)pvMessage)->usID16_31 = 0x0D2F;
+            ((radio_cmd_uid_read_res_t *)pvMessage)->ulID32_63 = 0x4B3C2D1E;
+            ((radio_cmd_uid_read_res_t *)pvMessage)->ulID64_96 = 0x000B57A0;
+        }
+        break;
+        case RADIO_CMD_TEMP_DATA:
+        {
+            if(ubCommand & RADIO_CMD_REQUEST_FLAG)
+                ((radio_cmd_temp_data_req_t *)pvMessage)->ulSamples = 16;
+            else
+                ((radio_cmd_temp_data_res_t *)pvMessage)->sWaterTemp = 2150;
+        }
+        break;
+        case RADIO_CMD_BAT_DATA:
+        {
+            if(ubCommand & RADIO_CMD_REQUEST_FLAG)
+            {
+                ((radio_cmd_bat_data_req_t *)pvMessage)->ulSamples = 16;
+            }
+            else
+            {
+                ((radio_cmd_bat_data_res_t *)pvMessage)->usBatteryVoltage = 3900;
+                ((radio_cmd_bat_data_res_t *)pvMessage)->ubChargerDetected = 1;
+            }
+        }
+        break;
+        case RADIO_CMD_RADIO_POWER_CFG:
+            ((radio_cmd_radio_power_cfg_req_t *)pvMessage)->bATCTargetRSSI = -80;
+        break;
+        case RADIO_CMD_REPORT_CFG:
+        {
+            ((radio_cmd_report_cfg_req_t *)pvMessage)->ulDataReportDelay = 60000;
+            ((radio_cmd_report_cfg_req_t *)pvMessage)->ulAccelSamples = 32;
+            ((radio_cmd_report_cfg_req_t *)pvMessage)->ulTempSamples = 16;
+            ((radio_cmd_report_cfg_req_t *)pvMessage)->ulBatterySamples = 8;
+        }
+        break;
+        case RADIO_CMD_SLEEP_CFG:
+            ((radio_cmd_sleep_cfg_req_t *)pvMessage)->ulSleepTimeout = 3600000;
+        break;
+        case RADIO_CMD_FOTA_QUERY_INFO:
+        {
+            ((radio_cmd_fota_query_info_res_t *)pvMessage)->ulCurrentVersion = 0x00010203;
+
+            strcpy(((radio_cmd_fota_query_info_res_t *)pvMessage)->pszBuildDate, "Oct 17 2026");
+            strcpy(((radio_cmd_fota_query_info_res_t *)pvMessage)->pszBuildTime, "12:34:56");
+        }
+        break;
+    }
+}
+static uint8_t test_radio_protocol_air()
+{
+    uint32_t pulMessage[TEST_RADIO_PROTOCOL_BUFFER_SIZE / 4];
+    uint8_t pubBuffer[TEST_RADIO_PROTOCOL_BUFFER_SIZE];
+    uint32_t ulOldTotal = 0;
+    uint32_t ulNewTotal = 0;
+
+    printf("%-15s %4s %4s\n", "message", "old", "new");
+
+    for(uint8_t i = 0; i < sizeof(pAirCases) / sizeof(pAirCases[0]); i++)
+    {
+        test_radio_protocol_typical(pAirCases[i].ubCommand, pulMessage);
+
+        uint8_t ubSize = radio_protocol_encode(pulMessage, pubBuffer, sizeof(pubBuffer));
+
+        if(!ubSize)
+        {
+            printf("  %s: not encoded\n", pAirCases[i].pszName);
+
+            return 1;
+        }
+
+        ulOldTotal += pAirCases[i].ubOldSize;
+        ulNewTotal += ubSize;
+
+        printf("%-15s %4hhu %4hhu\n", pAirCases[i].pszName, pAirCases[i].ubOldSize, ubSize);
+    }
+
+    printf("%-15s %4u %4u\n", "total", ulOldTotal, ulNewTotal);
+
+    if(ulNewTotal >= ulOldTotal)
+    {
+        printf("  wire encoding is no smaller than the old layout\n");
+
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+    uint8_t ubMessages = 0;
+
+    printf("%-4s %8s %6s %6s %8s\n", "cmd", "fields", "min", "max", "rounds");
+
+    for(uint16_t i = 0; i < 256; i++)
+    {
+        const radio_protocol_message_t *pMessage = radio_protocol_get_message(i);
+
+        if(!pMessage)
+            continue;
+
+        ubMessages++;
+        ubFailed |= test_radio_protocol_round_trip(pMessage);
+    }
+
+    if(!ubMessages)
+    {
+        printf("  no messages described\n");
+
+        ubFailed = 1;
+    }
+
+    ubFailed |= test_radio_protocol_varints();
+    ubFailed |= test_radio_protocol_malformed();
+    ubFailed |= test_radio_protocol_air();
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
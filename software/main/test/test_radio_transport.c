@@ -0,0 +1,666 @@
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69_peer.h"
+#include "rfm69.h"
+#include "radio_transport.h"
+
+// radio_transport on the real driver and register model, the far end is a scripted node speaking the fragment and status frames
+// The channel loses frames at a set rate in each direction, scripted drops pin down selective retransmission, status pokes and slot eviction
+// Every message carries a pattern derived from its number so corruption and duplicates are caught on both ends
+
+#define TEST_RADIO_TRANSPORT_NODE_ID        1
+#define TEST_RADIO_TRANSPORT_NET_ID         100
+#define TEST_RADIO_TRANSPORT_PEER_ID        5
+#define TEST_RADIO_TRANSPORT_SWEEP_MESSAGES 20
+#define TEST_RADIO_TRANSPORT_STEP_LIMIT     600000  // ms
+
+static const uint16_t pusLossRates[] = {0, 100, 200, 300, 500}; // Per mille, both directions
+
+static rfm69_model_t xRadio;
+static rfm69_peer_t xPeer;
+
+// Gateway side, what the application saw
+static uint32_t ulGatewayDelivered = 0;
+static uint32_t ulGatewayCorrupted = 0;
+static uint32_t ulGatewayDuplicates = 0;
+static uint32_t ulGatewayTXResults = 0;
+static uint8_t ubGatewayLastTXMessageID = 0;
+static uint8_t ubGatewayLastTXDelivered = 0;
+static uint32_t pulGatewaySeen[8]; // Message numbers delivered, one bit each
+
+// Peer receiver, one message at a time
+static uint8_t ubPeerRXMessageID = 0;
+static uint8_t ubPeerRXCount = 0;
+static uint32_t ulPeerRXMask = 0;
+static uint16_t usPeerRXSize = 0;
+static uint8_t ubPeerRXComplete = 0;
+static uint8_t pubPeerRXData[RADIO_TRANSPORT_MAX_MESSAGE_SIZE];
+static uint8_t pubPeerFragmentSends[RADIO_TRANSPORT_MAX_FRAGMENTS]; // Times each fragment of the current message was heard
+static uint32_t ulPeerDropFirst = 0; // Fragments lost the first time they are heard
+static uint8_t ubPeerDropStatuses = 0; // Complete statuses to lose
+static uint32_t ulPeerDelivered = 0;
+static uint32_t ulPeerCorrupted = 0;
+
+// Peer sender, one message at a time
+static uint8_t ubPeerTXMessageID = 0;
+static uint8_t ubPeerTXCount = 0;
+static uint16_t usPeerTXSize = 0;
+static uint8_t pubPeerTXData[RADIO_TRANSPORT_MAX_MESSAGE_SIZE];
+static uint8_t ubPeerTXActive = 0;
+static uint8_t ubPeerTXRetriesLeft = 0;
+static uint64_t ullPeerTXLastActivity = 0;
+static uint32_t ulPeerTXDropFirst = 0; // Own fragments lost the first time they go out
+static uint32_t ulPeerTXSent = 0; // Fragments, first time or not
+static uint32_t ulPeerTXSentMask = 0;
+static uint8_t ubPeerTXDone = 0;
+static uint8_t ubPeerTXFailed = 0;
+static uint64_t ullPeerTXLastFragment = 0;
+static uint64_t ullPeerTXStatusAt = 0;
+static uint32_t ulPeerTXStatusMissing = 0;
+
+static void test_radio_transport_irq(rfm69_model_t *pModel)
+{
+    rfm69_isr();
+}
+
+static void test_radio_transport_fill(uint8_t *pubData, uint16_t usSize, uint16_t usNumber)
+{
+    // First two bytes number the message, the rest follows from it
+    pubData[0] = usNumber & 0xFF;
+    pubData[1] = usNumber >> 8;
+
+    for(uint16_t i = 2; i < usSize; i++)
+        pubData[i] = usNumber * 31 + i * 7;
+}
+static uint8_t test_radio_transport_check(const uint8_t *pubData, uint16_t usSize, uint16_t *pusNumber)
+{
+    if(usSize < 2)
+        return 0;
+
+    uint16_t usNumber = pubData[0] | (pubData[1] << 8);
+
+    for(uint16_t i = 2; i < usSize; i++)
+        if(pubData[i] != (uint8_t)(usNumber * 31 + i * 7))
+            return 0;
+
+    *pusNumber = usNumber;
+
+    return 1;
+}
+
+static void test_radio_transport_rx_callback(uint8_t ubNodeID, int8_t bRSSI, const uint8_t *pubData, uint16_t usSize)
+{
+    uint16_t usNumber;
+
+    if(ubNodeID != TEST_RADIO_TRANSPORT_PEER_ID || !test_radio_transport_check(pubData, usSize, &usNumber) || usNumber >= sizeof(pulGatewaySeen) * 8)
+    {
+        ulGatewayCorrupted++;
+
+        return;
+    }
+
+    if(pulGatewaySeen[usNumber / 32] & BIT(usNumber % 32))
+    {
+        ulGatewayDuplicates++;
+
+        return;
+    }
+
+    pulGatewaySeen[usNumber / 32] |= BIT(usNumber % 32);
+    ulGatewayDelivered++;
+}
+static void test_radio_transport_tx_callback(uint8_t ubNodeID, uint8_t ubMessageID, uint8_t ubDelivered)
+{
+    ubGatewayLastTXMessageID = ubMessageID;
+    ubGatewayLastTXDelivered = ubDelivered;
+    ulGatewayTXResults++;
+}
+
+static void test_radio_transport_peer_status(uint8_t ubMessageID, uint32_t ulMissingMask)
+{
+    radio_cmd_transport_status_t xStatus;
+
+    memset(&xStatus, 0, sizeof(radio_cmd_transport_status_t));
+
+    xStatus.ubCommand = RADIO_CMD_TRANSPORT_STATUS;
+    xStatus.ubMessageID = ubMessageID;
+    xStatus.ulMissingMask = ulMissingMask;
+
+    if(!ulMissingMask && ubPeerDropStatuses)
+    {
+        ubPeerDropStatuses--;
+
+        return;
+    }
+
+    rfm69_peer_send_data(&xPeer, TEST_RADIO_TRANSPORT_NODE_ID, &xStatus, sizeof(radio_cmd_transport_status_t));
+}
+static void test_radio_transport_peer_fragment(const radio_cmd_transport_fragment_t *pFragment, uint8_t ubDataSize)
+{
+    if(pFragment->ubMessageID != ubPeerRXMessageID)
+    {
+        ubPeerRXMessageID = pFragment->ubMessageID;
+        ubPeerRXCount = pFragment->ubCount;
+        ulPeerRXMask = 0;
+        ubPeerRXComplete = 0;
+
+        memset(pubPeerFragmentSends, 0, sizeof(pubPeerFragmentSends));
+    }
+
+    uint8_t ubLast = pFragment->ubIndex == ubPeerRXCount - 1;
+
+    if(!pubPeerFragmentSends[pFragment->ubIndex]++ && (ulPeerDropFirst & BIT(pFragment->ubIndex)))
+        return;
+
+    if(ubPeerRXComplete)
+    {
+        test_radio_transport_peer_status(ubPeerRXMessageID, 0); // Poke on a message we have
+
+        return;
+    }
+
+    memcpy(pubPeerRXData + pFragment->ubIndex * RADIO_TRANSPORT_FRAGMENT_DATA_SIZE, pFragment->pubData, ubDataSize);
+
+    ulPeerRXMask |= BIT(pFragment->ubIndex);
+
+    if(ubLast)
+        usPeerRXSize = pFragment->ubIndex * RADIO_TRANSPORT_FRAGMENT_DATA_SIZE + ubDataSize;
+
+    uint32_t ulAll = 0xFFFFFFFF >> (32 - ubPeerRXCount);
+
+    if(ulPeerRXMask == ulAll)
+    {
+        uint16_t usNumber;
+
+        ubPeerRXComplete = 1;
+
+        if(test_radio_transport_check(pubPeerRXData, usPeerRXSize, &usNumber))
+            ulPeerDelivered++;
+        else
+            ulPeerCorrupted++;
+
+        test_radio_transport_peer_status(ubPeerRXMessageID, 0);
+    }
+    else if(ubLast)
+    {
+        test_radio_transport_peer_status(ubPeerRXMessageID, ulAll & ~ulPeerRXMask);
+    }
+}
+static void test_radio_transport_peer_send_fragment(uint8_t ubIndex)
+{
+    uint8_t pubBuffer[RFM69_MAX_DATA_SIZE];
+    radio_cmd_transport_fragment_t *pFragment = (radio_cmd_transport_fragment_t *)pubBuffer;
+    uint16_t usOffset = ubIndex * RADIO_TRANSPORT_FRAGMENT_DATA_SIZE;
+    uint16_t usRemaining = usPeerTXSize - usOffset;
+    uint8_t ubDataSize = MIN(usRemaining, RADIO_TRANSPORT_FRAGMENT_DATA_SIZE);
+
+    pFragment->ubCommand = RADIO_CMD_TRANSPORT_FRAGMENT;
+    pFragment->ubMessageID = ubPeerTXMessageID;
+    pFragment->ubIndex = ubIndex;
+    pFragment->ubCount = ubPeerTXCount;
+
+    memcpy(pFragment->pubData, pubPeerTXData + usOffset, ubDataSize);
+
+    ulPeerTXSent++;
+    ullPeerTXLastActivity = g_ullSystemTick;
+
+    if(!(ulPeerTXSentMask & BIT(ubIndex)) && (ulPeerTXDropFirst & BIT(ubIndex)))
+    {
+        ulPeerTXSentMask |= BIT(ubIndex);
+
+        return;
+    }
+
+    ulPeerTXSentMask |= BIT(ubIndex);
+
+    rfm69_peer_send_data(&xPeer, TEST_RADIO_TRANSPORT_NODE_ID, pubBuffer, sizeof(radio_cmd_transport_fragment_t) + ubDataSize);
+}
+static void test_radio_transport_peer_rx(rfm69_peer_t *pPeer, const rfm69_packet_header_t *pHeader, const uint8_t *pubData, uint8_t ubSize)
+{
+    if(pubData[0] == RADIO_CMD_TRANSPORT_FRAGMENT && ubSize > sizeof(radio_cmd_transport_fragment_t))
+    {
+        test_radio_transport_peer_fragment((const radio_cmd_transport_fragment_t *)pubData, ubSize - sizeof(radio_cmd_transport_fragment_t));
+
+        return;
+    }
+
+    if(pubData[0] != RADIO_CMD_TRANSPORT_STATUS || ubSize < sizeof(radio_cmd_transport_status_t))
+        return;
+
+    radio_cmd_transport_status_t xStatus;
+
+    memcpy(&xStatus, pubData, sizeof(radio_cmd_transport_status_t));
+
+    if(!ubPeerTXActive || xStatus.ubMessageID != ubPeerTXMessageID)
+        return;
+
+    ullPeerTXStatusAt = g_ullSystemTick;
+    ulPeerTXStatusMissing = xStatus.ulMissingMask;
+    ullPeerTXLastActivity = g_ullSystemTick;
+    ubPeerTXRetriesLeft = RADIO_TRANSPORT_TX_RETRIES;
+
+    if(!xStatus.ulMissingMask)
+    {
+        ubPeerTXActive = 0;
+        ubPeerTXDone = 1;
+
+        return;
+    }
+
+    for(uint8_t i = 0; i < ubPeerTXCount; i++)
+        if(xStatus.ulMissingMask & BIT(i))
+            test_radio_transport_peer_send_fragment(i);
+}
+static void test_radio_transport_peer_start(uint16_t usNumber, uint16_t usSize, uint8_t ubMessageID)
+{
+    test_radio_transport_fill(pubPeerTXData, usSize, usNumber);
+
+    usPeerTXSize = usSize;
+    ubPeerTXMessageID = ubMessageID;
+    ubPeerTXCount = (usSize + RADIO_TRANSPORT_FRAGMENT_DATA_SIZE - 1) / RADIO_TRANSPORT_FRAGMENT_DATA_SIZE;
+    ubPeerTXActive = 1;
+    ubPeerTXRetriesLeft = RADIO_TRANSPORT_TX_RETRIES;
+    ubPeerTXDone = 0;
+    ubPeerTXFailed = 0;
+    ulPeerTXSentMask = 0;
+
+    for(uint8_t i = 0; i < ubPeerTXCount; i++)
+        test_radio_transport_peer_send_fragment(i);
+
+    ullPeerTXLastFragment = g_ullSystemTick;
+}
+static void test_radio_transport_peer_tick()
+{
+    // Same poke rule as radio_transport, the last fragment again after a second of silence
+    if(!ubPeerTXActive || rfm69_peer_pending(&xPeer) || g_ullSystemTick - ullPeerTXLastActivity < RADIO_TRANSPORT_TX_TIMEOUT)
+        return;
+
+    if(!ubPeerTXRetriesLeft)
+    {
+        ubPeerTXActive = 0;
+        ubPeerTXFailed = 1;
+
+        return;
+    }
+
+    ubPeerTXRetriesLeft--;
+
+    test_radio_transport_peer_send_fragment(ubPeerTXCount - 1);
+}
+
+static uint8_t test_radio_transport_setup(uint16_t usLoss)
+{
+    host_trng_seed(usLoss + 1);
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = test_radio_transport_irq;
+
+    rfm69_peer_attach(&xRadio);
+    rfm69_peer_init(&xPeer, TEST_RADIO_TRANSPORT_PEER_ID, 0x5EED + usLoss);
+
+    xPeer.usLossIn = usLoss;
+    xPeer.usLossOut = usLoss;
+    xPeer.pfRX = test_radio_transport_peer_rx;
+
+    ldma_init();
+
+    if(!rfm69_init(TEST_RADIO_TRANSPORT_NODE_ID, TEST_RADIO_TRANSPORT_NET_ID, NULL))
+        return 0;
+
+    radio_transport_init();
+    radio_transport_set_rx_callback(test_radio_transport_rx_callback);
+    radio_transport_set_tx_callback(test_radio_transport_tx_callback);
+
+    ulGatewayDelivered = 0;
+    ulGatewayCorrupted = 0;
+    ulGatewayDuplicates = 0;
+    ulGatewayTXResults = 0;
+    memset(pulGatewaySeen, 0, sizeof(pulGatewaySeen));
+
+    ubPeerRXMessageID = 0;
+    ulPeerDropFirst = 0;
+    ubPeerDropStatuses = 0;
+    ulPeerDelivered = 0;
+    ulPeerCorrupted = 0;
+
+    ubPeerTXActive = 0;
+    ubPeerTXDone = 0;
+    ubPeerTXFailed = 0;
+    ulPeerTXDropFirst = 0;
+    ulPeerTXSent = 0;
+    ullPeerTXStatusAt = 0;
+
+    return 1;
+}
+static void test_radio_transport_step()
+{
+    host_advance(1);
+    rfm69_tick();
+    radio_transport_tick();
+    test_radio_transport_peer_tick();
+}
+
+// Gateway to peer with the given fragments lost on their first trip, only those may go out again
+static uint8_t test_radio_transport_selective()
+{
+    static const uint32_t ulDrop = BIT(3) | BIT(7) | BIT(8);
+    uint8_t pubMessage[RADIO_TRANSPORT_MAX_MESSAGE_SIZE];
+    radio_transport_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    if(!test_radio_transport_setup(0))
+        return 1;
+
+    test_radio_transport_fill(pubMessage, sizeof(pubMessage), 1);
+
+    ulPeerDropFirst = ulDrop;
+
+    uint8_t ubMessageID = radio_transport_send(TEST_RADIO_TRANSPORT_PEER_ID, pubMessage, sizeof(pubMessage));
+    uint64_t ullStart = g_ullSystemTick;
+
+    while(!ulGatewayTXResults && g_ullSystemTick - ullStart < TEST_RADIO_TRANSPORT_STEP_LIMIT)
+        test_radio_transport_step();
+
+    radio_transport_get_stats(&xStats);
+
+    if(ulGatewayTXResults != 1 || ubGatewayLastTXMessageID != ubMessageID || !ubGatewayLastTXDelivered || ulPeerDelivered != 1 || ulPeerCorrupted)
+    {
+        printf("  selective: %u results (delivered %hhu), peer got %u intact and %u corrupted\n", ulGatewayTXResults, ubGatewayLastTXDelivered, ulPeerDelivered, ulPeerCorrupted);
+
+        ubFailed = 1;
+    }
+
+    for(uint8_t i = 0; i < ubPeerRXCount; i++)
+    {
+        uint8_t ubExpected = (ulDrop & BIT(i)) ? 2 : 1;
+
+        if(pubPeerFragmentSends[i] != ubExpected)
+        {
+            printf("  selective: fragment %hhu heard %hhu times, expected %hhu\n", i, pubPeerFragmentSends[i], ubExpected);
+
+            ubFailed = 1;
+        }
+    }
+
+    if(xStats.ulFragmentsResent != (uint32_t)__builtin_popcount(ulDrop) || xStats.ulFragmentsSent != ubPeerRXCount + (uint32_t)__builtin_popcount(ulDrop))
+    {
+        printf("  selective: %u fragments sent, %u resent\n", xStats.ulFragmentsSent, xStats.ulFragmentsResent);
+
+        ubFailed = 1;
+    }
+
+    printf("%-14s %6u %9u %9u %9u %9llu\n", "selective", 0, xStats.ulFragmentsSent, xStats.ulFragmentsResent, xStats.ulMessagesSent, (unsigned long long)(g_ullSystemTick - ullStart));
+
+    return ubFailed;
+}
+
+// Peer loses the final status, the gateway pokes with the last fragment after RADIO_TRANSPORT_TX_TIMEOUT and the peer answers again
+static uint8_t test_radio_transport_tx_poke()
+{
+    uint8_t pubMessage[200];
+    radio_transport_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    if(!test_radio_transport_setup(0))
+        return 1;
+
+    test_radio_transport_fill(pubMessage, sizeof(pubMessage), 2);
+
+    ubPeerDropStatuses = 2;
+
+    radio_transport_send(TEST_RADIO_TRANSPORT_PEER_ID, pubMessage, sizeof(pubMessage));
+
+    uint64_t ullStart = g_ullSystemTick;
+
+    while(!ulGatewayTXResults && g_ullSystemTick - ullStart < TEST_RADIO_TRANSPORT_STEP_LIMIT)
+        test_radio_transport_step();
+
+    uint64_t ullTime = g_ullSystemTick - ullStart;
+
+    radio_transport_get_stats(&xStats);
+
+    if(ulGatewayTXResults != 1 || !ubGatewayLastTXDelivered || ulPeerDelivered != 1)
+    {
+        printf("  tx-poke: %u results (delivered %hhu), %u at the peer\n", ulGatewayTXResults, ubGatewayLastTXDelivered, ulPeerDelivered);
+
+        ubFailed = 1;
+    }
+
+    // Two pokes, each after a full timeout, nothing but the last fragment goes out again
+    if(xStats.ulFragmentsResent != 2 || pubPeerFragmentSends[ubPeerRXCount - 1] != 3 || ullTime < 2 * RADIO_TRANSPORT_TX_TIMEOUT || ullTime > 2 * RADIO_TRANSPORT_TX_TIMEOUT + 500)
+    {
+        printf("  tx-poke: %u resent, last fragment heard %hhu times, done after %llu ms\n", xStats.ulFragmentsResent, pubPeerFragmentSends[ubPeerRXCount - 1], (unsigned long long)ullTime);
+
+        ubFailed = 1;
+    }
+
+    printf("%-14s %6u %9u %9u %9u %9llu\n", "tx-poke", 0, xStats.ulFragmentsSent, xStats.ulFragmentsResent, xStats.ulMessagesSent, (unsigned long long)ullTime);
+
+    return ubFailed;
+}
+
+// Peer to gateway with the tail lost, the gateway asks for it after RADIO_TRANSPORT_STATUS_DELAY of silence
+// Then the gateway status is lost, the peer pokes and the complete slot answers without delivering twice
+static uint8_t test_radio_transport_rx_poke()
+{
+    radio_transport_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    if(!test_radio_transport_setup(0))
+        return 1;
+
+    ulPeerTXDropFirst = BIT(4) | BIT(5); // 6 fragments, last two lost
+
+    test_radio_transport_peer_start(3, 300, 0x40);
+
+    uint64_t ullStart = g_ullSystemTick;
+
+    while(!ullPeerTXStatusAt && g_ullSystemTick - ullStart < TEST_RADIO_TRANSPORT_STEP_LIMIT)
+        test_radio_transport_step();
+
+    uint64_t ullStatusDelay = ullPeerTXStatusAt - ullPeerTXLastFragment;
+
+    if(ulPeerTXStatusMissing != (BIT(4) | BIT(5)) || ullStatusDelay < RADIO_TRANSPORT_STATUS_DELAY || ullStatusDelay > RADIO_TRANSPORT_STATUS_DELAY + 100)
+    {
+        printf("  rx-poke: status after %llu ms asked for 0x%08X\n", (unsigned long long)ullStatusDelay, ulPeerTXStatusMissing);
+
+        ubFailed = 1;
+    }
+
+    while(!ubPeerTXDone && !ubPeerTXFailed && g_ullSystemTick - ullStart < TEST_RADIO_TRANSPORT_STEP_LIMIT)
+        test_radio_transport_step();
+
+    if(!ubPeerTXDone || ulGatewayDelivered != 1 || ulGatewayCorrupted)
+    {
+        printf("  rx-poke: peer %s, gateway delivered %u, %u corrupted\n", ubPeerTXDone ? "done" : "failed", ulGatewayDelivered, ulGatewayCorrupted);
+
+        ubFailed = 1;
+    }
+
+    // The status was heard, poke anyway as if it had been lost
+    uint32_t ulSent = ulPeerTXSent;
+
+    ubPeerTXActive = 1;
+    ubPeerTXDone = 0;
+    ubPeerTXRetriesLeft = 1;
+    ullPeerTXLastActivity = g_ullSystemTick - RADIO_TRANSPORT_TX_TIMEOUT;
+
+    while(!ubPeerTXDone && !ubPeerTXFailed && g_ullSystemTick - ullStart < TEST_RADIO_TRANSPORT_STEP_LIMIT)
+        test_radio_transport_step();
+
+    radio_transport_get_stats(&xStats);
+
+    if(!ubPeerTXDone || ulPeerTXSent != ulSent + 1 || ulGatewayDelivered != 1 || ulGatewayDuplicates || xStats.ulMessagesReceived != 1)
+    {
+        printf("  rx-poke: late poke %s, gateway delivered %u, %u duplicates\n", ubPeerTXDone ? "answered" : "unanswered", ulGatewayDelivered, ulGatewayDuplicates);
+
+        ubFailed = 1;
+    }
+
+    printf("%-14s %6u %9u %9u %9u %9llu\n", "rx-poke", 0, ulPeerTXSent, ulPeerTXSent - 6, xStats.ulMessagesReceived, (unsigned long long)(g_ullSystemTick - ullStart));
+
+    return ubFailed;
+}
+
+// More partial messages than RX slots, the stalest incomplete one goes, and those left without progress time out
+static uint8_t test_radio_transport_eviction()
+{
+    radio_transport_stats_t xStats;
+    uint8_t ubFailed = 0;
+
+    if(!test_radio_transport_setup(0))
+        return 1;
+
+    ulPeerTXDropFirst = ~BIT(0); // Only the first fragment of every message arrives
+
+    for(uint8_t i = 0; i <= RADIO_TRANSPORT_RX_SLOTS; i++)
+    {
+        test_radio_transport_peer_start(10 + i, 200, 0x50 + i);
+
+        ubPeerTXActive = 0; // No pokes, they would only refresh the slots
+
+        for(uint8_t j = 0; j < 20; j++)
+            test_radio_transport_step();
+    }
+
+    radio_transport_get_stats(&xStats);
+
+    uint32_t ulEvicted = xStats.ulEvictions;
+
+    for(uint32_t i = 0; i < RADIO_TRANSPORT_RX_TIMEOUT + 100; i++)
+        test_radio_transport_step();
+
+    radio_transport_get_stats(&xStats);
+
+    if(ulEvicted != 1 || xStats.ulEvictions != RADIO_TRANSPORT_RX_SLOTS + 1 || ulGatewayDelivered)
+    {
+        printf("  eviction: %u evicted for room, %u in total, expected 1 and %u\n", ulEvicted, xStats.ulEvictions, RADIO_TRANSPORT_RX_SLOTS + 1);
+
+        ubFailed = 1;
+    }
+
+    printf("%-14s %6u %9u %9u %9u %9llu\n", "eviction", 0, ulPeerTXSent, 0, xStats.ulEvictions, (unsigned long long)g_ullSystemTick);
+
+    return ubFailed;
+}
+
+// Random loss both ways, messages flow in both directions at once
+static uint8_t test_radio_transport_sweep(uint16_t usLoss)
+{
+    uint8_t pubMessage[RADIO_TRANSPORT_MAX_MESSAGE_SIZE];
+    radio_transport_stats_t xStats;
+    uint16_t usSent = 0;
+    uint16_t usPeerStarted = 0;
+    uint32_t ulGatewayConfirmed = 0;
+    uint32_t ulGatewayFailed = 0;
+    uint32_t ulPeerConfirmed = 0;
+    uint32_t ulPeerFailed = 0;
+    uint32_t ulPending = 0;
+    uint32_t ulRandom = 0xC0FFEE + usLoss;
+    uint8_t ubFailed = 0;
+
+    if(!test_radio_transport_setup(usLoss))
+        return 1;
+
+    uint64_t ullStart = g_ullSystemTick;
+
+    while((usSent < TEST_RADIO_TRANSPORT_SWEEP_MESSAGES || ulPending || usPeerStarted < TEST_RADIO_TRANSPORT_SWEEP_MESSAGES || ubPeerTXActive) && g_ullSystemTick - ullStart < TEST_RADIO_TRANSPORT_STEP_LIMIT)
+    {
+        if(ulGatewayTXResults)
+        {
+            if(ubGatewayLastTXDelivered)
+                ulGatewayConfirmed++;
+            else
+                ulGatewayFailed++;
+
+            ulGatewayTXResults = 0;
+            ulPending = 0;
+        }
+
+        if(!ulPending && usSent < TEST_RADIO_TRANSPORT_SWEEP_MESSAGES)
+        {
+            ulRandom = ulRandom * 1103515245 + 12345;
+
+            uint16_t usSize = 2 + (ulRandom >> 8) % (RADIO_TRANSPORT_MAX_MESSAGE_SIZE - 1);
+
+            test_radio_transport_fill(pubMessage, usSize, usSent);
+
+            if(radio_transport_send(TEST_RADIO_TRANSPORT_PEER_ID, pubMessage, usSize))
+            {
+                usSent++;
+                ulPending = 1;
+            }
+        }
+
+        if(ubPeerTXDone || ubPeerTXFailed)
+        {
+            ulPeerConfirmed += ubPeerTXDone;
+            ulPeerFailed += ubPeerTXFailed;
+            ubPeerTXDone = 0;
+            ubPeerTXFailed = 0;
+        }
+
+        if(!ubPeerTXActive && usPeerStarted < TEST_RADIO_TRANSPORT_SWEEP_MESSAGES)
+        {
+            ulRandom = ulRandom * 1103515245 + 12345;
+
+            uint16_t usSize = 2 + (ulRandom >> 8) % (RADIO_TRANSPORT_MAX_MESSAGE_SIZE - 1);
+
+            test_radio_transport_peer_start(usPeerStarted, usSize, 0x80 + usPeerStarted);
+
+            usPeerStarted++;
+        }
+
+        test_radio_transport_step();
+    }
+
+    if(ubPeerTXDone || ubPeerTXFailed)
+    {
+        ulPeerConfirmed += ubPeerTXDone;
+        ulPeerFailed += ubPeerTXFailed;
+    }
+
+    radio_transport_get_stats(&xStats);
+
+    uint64_t ullTime = g_ullSystemTick - ullStart;
+
+    // Confirmed means delivered, never the other way round, and nothing arrives damaged or twice
+    if(ulPeerCorrupted || ulGatewayCorrupted || ulGatewayDuplicates || ulPeerDelivered < ulGatewayConfirmed || ulGatewayDelivered < ulPeerConfirmed)
+    {
+        printf("  %hu: %u/%u corrupted, %u duplicates, peer has %u of %u confirmed, gateway has %u of %u confirmed\n", usLoss, ulPeerCorrupted, ulGatewayCorrupted, ulGatewayDuplicates, ulPeerDelivered, ulGatewayConfirmed, ulGatewayDelivered, ulPeerConfirmed);
+
+        ubFailed = 1;
+    }
+
+    if(usLoss <= 300 && (ulGatewayConfirmed != TEST_RADIO_TRANSPORT_SWEEP_MESSAGES || ulPeerConfirmed != TEST_RADIO_TRANSPORT_SWEEP_MESSAGES))
+    {
+        printf("  %hu: %u and %u of %u confirmed\n", usLoss, ulGatewayConfirmed, ulPeerConfirmed, TEST_RADIO_TRANSPORT_SWEEP_MESSAGES);
+
+        ubFailed = 1;
+    }
+
+    printf("%-14s %6hu %9u %9u %9u %9llu\n", "sweep", usLoss, xStats.ulFragmentsSent, xStats.ulFragmentsResent, ulGatewayConfirmed + ulPeerConfirmed, (unsigned long long)ullTime);
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("%-14s %6s %9s %9s %9s %9s\n", "case", "loss", "fragments", "resent", "messages", "ms");
+
+    ubFailed |= test_radio_transport_selective();
+    ubFailed |= test_radio_transport_tx_poke();
+    ubFailed |= test_radio_transport_rx_poke();
+    ubFailed |= test_radio_transport_eviction();
+
+    for(uint8_t i = 0; i < sizeof(pusLossRates) / sizeof(pusLossRates[0]); i++)
+        ubFailed |= test_radio_transport_sweep(pusLossRates[i]);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
@@ -0,0 +1,357 @@
+#include <pthread.h>
+#include <sched.h>
+#include "host.h"
+#include "record_fifo.h"
+
+// record_fifo against a plain reference queue under random writes, reads, peeks and commits
+// Then a real producer and consumer thread on one FIFO, the way rfm69_isr() and rfm69_tick() share the RX FIFO
+// Neither part may ask for a masked section, g_ulHostMaskedSections has to stay where it was
+
+#define TEST_RECORD_FIFO_OPERATIONS     200000
+#define TEST_RECORD_FIFO_MAX_RECORD     300
+#define TEST_RECORD_FIFO_REFERENCE_SIZE 8192    // Records in flight never exceed the largest FIFO
+#define TEST_RECORD_FIFO_THREAD_RECORDS 2000000
+
+typedef struct
+{
+    uint32_t ulBufferSize;
+    uint32_t ulStartIndex; // Head and tail start here, near the top to cover the 32 bit wrap
+} test_record_fifo_case_t;
+
+static const test_record_fifo_case_t pCases[] = {
+    {64, 0},
+    {256, 0},
+    {256, 0xFFFFFF00},
+    {4096, 0xFFFFF000},
+};
+
+// Reference, one record after the other in a linear buffer that is compacted when it fills
+static uint8_t pubReference[TEST_RECORD_FIFO_REFERENCE_SIZE * 2];
+static uint32_t ulReferenceHead = 0;
+static uint32_t ulReferenceTail = 0;
+
+static uint32_t ulRandom = 1;
+
+static uint32_t test_record_fifo_random()
+{
+    ulRandom ^= ulRandom << 13;
+    ulRandom ^= ulRandom >> 17;
+    ulRandom ^= ulRandom << 5;
+
+    return ulRandom;
+}
+
+static void test_record_fifo_reference_push(const uint8_t *pubData, uint32_t ulSize)
+{
+    if(ulReferenceHead + 2 + ulSize > sizeof(pubReference))
+    {
+        memmove(pubReference, pubReference + ulReferenceTail, ulReferenceHead - ulReferenceTail);
+
+        ulReferenceHead -= ulReferenceTail;
+        ulReferenceTail = 0;
+    }
+
+    pubReference[ulReferenceHead++] = ulSize & 0xFF;
+    pubReference[ulReferenceHead++] = ulSize >> 8;
+
+    memcpy(pubReference + ulReferenceHead, pubData, ulSize);
+
+    ulReferenceHead += ulSize;
+}
+static const uint8_t* test_record_fifo_reference_front(uint32_t *pulSize)
+{
+    if(ulReferenceHead == ulReferenceTail)
+        return NULL;
+
+    *pulSize = pubReference[ulReferenceTail] | (pubReference[ulReferenceTail + 1] << 8);
+
+    return pubReference + ulReferenceTail + 2;
+}
+static void test_record_fifo_reference_pop()
+{
+    uint32_t ulSize;
+
+    if(test_record_fifo_reference_front(&ulSize))
+        ulReferenceTail += 2 + ulSize;
+}
+
+static uint8_t test_record_fifo_random_case(const test_record_fifo_case_t *pCase)
+{
+    uint8_t pubData[TEST_RECORD_FIFO_MAX_RECORD];
+    uint8_t pubOut[TEST_RECORD_FIFO_MAX_RECORD];
+    uint32_t ulWrites = 0;
+    uint32_t ulReads = 0;
+    uint32_t ulRefused = 0;
+    record_fifo_t *pFIFO = record_fifo_init(NULL, pCase->ulBufferSize);
+
+    if(!pFIFO)
+    {
+        printf("  %u: FIFO not created\n", pCase->ulBufferSize);
+
+        return 1;
+    }
+
+    pFIFO->ulHead = pCase->ulStartIndex;
+    pFIFO->ulTail = pCase->ulStartIndex;
+
+    ulReferenceHead = 0;
+    ulReferenceTail = 0;
+    ulRandom = pCase->ulBufferSize ^ pCase->ulStartIndex ^ 0x9E3779B9;
+
+    uint32_t ulMaxRecord = pCase->ulBufferSize < TEST_RECORD_FIFO_MAX_RECORD ? pCase->ulBufferSize : TEST_RECORD_FIFO_MAX_RECORD;
+
+    for(uint32_t i = 0; i < TEST_RECORD_FIFO_OPERATIONS; i++)
+    {
+        uint32_t ulInFlight = ulReferenceHead - ulReferenceTail;
+        uint32_t ulOperation = test_record_fifo_random() % 8;
+        uint32_t ulSize = 0;
+        const uint8_t *pubExpected = test_record_fifo_reference_front(&ulSize);
+
+        if(record_fifo_get_free(pFIFO) != pCase->ulBufferSize - ulInFlight || record_fifo_is_empty(pFIFO) != !pubExpected)
+        {
+            printf("  %u@%08X: op %u, free %u, expected %u\n", pCase->ulBufferSize, pCase->ulStartIndex, i, record_fifo_get_free(pFIFO), pCase->ulBufferSize - ulInFlight);
+
+            record_fifo_delete(pFIFO);
+
+            return 1;
+        }
+
+        if(ulOperation < 4) // Write, sometimes too big for what is left
+        {
+            uint32_t ulWriteSize = 1 + test_record_fifo_random() % ulMaxRecord;
+
+            for(uint32_t j = 0; j < ulWriteSize; j++)
+                pubData[j] = test_record_fifo_random();
+
+            uint8_t ubFits = RECORD_FIFO_HEADER_SIZE + ulWriteSize <= pCase->ulBufferSize - ulInFlight;
+
+            if(record_fifo_write(pFIFO, pubData, ulWriteSize) != ubFits)
+            {
+                printf("  %u@%08X: op %u, write of %u with %u free returned %u\n", pCase->ulBufferSize, pCase->ulStartIndex, i, ulWriteSize, pCase->ulBufferSize - ulInFlight, !ubFits);
+
+                record_fifo_delete(pFIFO);
+
+                return 1;
+            }
+
+            if(ubFits)
+            {
+                test_record_fifo_reference_push(pubData, ulWriteSize);
+
+                ulWrites++;
+            }
+            else
+            {
+                ulRefused++;
+            }
+        }
+        else if(ulOperation < 6) // Read, sometimes into a buffer that is too small
+        {
+            uint32_t ulMaxSize = (test_record_fifo_random() & 7) ? TEST_RECORD_FIFO_MAX_RECORD : 1 + test_record_fifo_random() % ulMaxRecord;
+            uint32_t ulReadSize = 0;
+            uint8_t ubExpected = pubExpected && ulSize <= ulMaxSize;
+
+            if(record_fifo_read(pFIFO, pubOut, &ulReadSize, ulMaxSize) != ubExpected || (ubExpected && (ulReadSize != ulSize || memcmp(pubOut, pubExpected, ulSize))))
+            {
+                printf("  %u@%08X: op %u, read returned %u bytes, expected %u\n", pCase->ulBufferSize, pCase->ulStartIndex, i, ulReadSize, pubExpected ? ulSize : 0);
+
+                record_fifo_delete(pFIFO);
+
+                return 1;
+            }
+
+            if(ubExpected)
+            {
+                test_record_fifo_reference_pop();
+
+                ulReads++;
+            }
+        }
+        else // Peek, then commit most of the time
+        {
+            record_fifo_span_t pSpans[2];
+            uint32_t ulPeekSize = record_fifo_peek(pFIFO, pSpans);
+
+            if(ulPeekSize != (pubExpected ? ulSize : 0) || (ulPeekSize && pSpans[0].ulSize + pSpans[1].ulSize != ulPeekSize))
+            {
+                printf("  %u@%08X: op %u, peek returned %u bytes, expected %u\n", pCase->ulBufferSize, pCase->ulStartIndex, i, ulPeekSize, pubExpected ? ulSize : 0);
+
+                record_fifo_delete(pFIFO);
+
+                return 1;
+            }
+
+            if(!ulPeekSize)
+                continue;
+
+            if(memcmp(pSpans[0].pubData, pubExpected, pSpans[0].ulSize) || memcmp(pSpans[1].pubData, pubExpected + pSpans[0].ulSize, pSpans[1].ulSize))
+            {
+                printf("  %u@%08X: op %u, peeked data differs\n", pCase->ulBufferSize, pCase->ulStartIndex, i);
+
+                record_fifo_delete(pFIFO);
+
+                return 1;
+            }
+
+            if(ulOperation == 6)
+            {
+                record_fifo_commit(pFIFO);
+                test_record_fifo_reference_pop();
+
+                ulReads++;
+            }
+        }
+    }
+
+    record_fifo_delete(pFIFO);
+
+    printf("%-10s %10u %08X %9u %9u %9u\n", "random", pCase->ulBufferSize, pCase->ulStartIndex, ulWrites, ulReads, ulRefused);
+
+    return 0;
+}
+
+// Producer and consumer on their own threads, every record carries its sequence number and a pattern derived from it
+static record_fifo_t *pThreadFIFO;
+static volatile uint32_t ulThreadErrors;
+static volatile uint32_t ulThreadProducerRetries;
+
+static void* test_record_fifo_producer(void *pvArg)
+{
+    uint8_t pubData[64];
+
+    for(uint32_t i = 0; i < TEST_RECORD_FIFO_THREAD_RECORDS; i++)
+    {
+        uint32_t ulSize = 4 + i % (sizeof(pubData) - 4);
+
+        memcpy(pubData, &i, 4);
+
+        for(uint32_t j = 4; j < ulSize; j++)
+            pubData[j] = i + j;
+
+        while(!record_fifo_write(pThreadFIFO, pubData, ulSize))
+        {
+            ulThreadProducerRetries++;
+
+            sched_yield(); // Full, the host may have a single core
+        }
+    }
+
+    return NULL;
+}
+static void* test_record_fifo_consumer(void *pvArg)
+{
+    uint8_t pubData[64];
+    uint32_t ulSize;
+
+    for(uint32_t i = 0; i < TEST_RECORD_FIFO_THREAD_RECORDS;)
+    {
+        record_fifo_span_t pSpans[2];
+
+        if(i & 1) // Both ways out of the FIFO
+        {
+            if(!record_fifo_read(pThreadFIFO, pubData, &ulSize, sizeof(pubData)))
+            {
+                sched_yield(); // Empty
+
+                continue;
+            }
+        }
+        else
+        {
+            ulSize = record_fifo_peek(pThreadFIFO, pSpans);
+
+            if(!ulSize)
+            {
+                sched_yield();
+
+                continue;
+            }
+
+            memcpy(pubData, pSpans[0].pubData, pSpans[0].ulSize);
+            memcpy(pubData + pSpans[0].ulSize, pSpans[1].pubData, pSpans[1].ulSize);
+
+            record_fifo_commit(pThreadFIFO);
+        }
+
+        uint32_t ulSequence;
+
+        memcpy(&ulSequence, pubData, 4);
+
+        uint8_t ubBad = ulSequence != i || ulSize != 4 + i % (sizeof(pubData) - 4);
+
+        for(uint32_t j = 4; j < ulSize && !ubBad; j++)
+            ubBad = pubData[j] != (uint8_t)(i + j);
+
+        if(ubBad)
+            ulThreadErrors++;
+
+        i++;
+    }
+
+    return NULL;
+}
+
+static uint8_t test_record_fifo_threads(uint32_t ulBufferSize)
+{
+    pthread_t xProducer;
+    pthread_t xConsumer;
+
+    pThreadFIFO = record_fifo_init(NULL, ulBufferSize);
+    ulThreadErrors = 0;
+    ulThreadProducerRetries = 0;
+
+    if(!pThreadFIFO)
+    {
+        printf("  threads %u: FIFO not created\n", ulBufferSize);
+
+        return 1;
+    }
+
+    pthread_create(&xConsumer, NULL, test_record_fifo_consumer, NULL);
+    pthread_create(&xProducer, NULL, test_record_fifo_producer, NULL);
+    pthread_join(xProducer, NULL);
+    pthread_join(xConsumer, NULL);
+
+    uint8_t ubFailed = 0;
+
+    if(ulThreadErrors || !record_fifo_is_empty(pThreadFIFO))
+    {
+        printf("  threads %u: %u records out of order or corrupted\n", ulBufferSize, ulThreadErrors);
+
+        ubFailed = 1;
+    }
+
+    printf("%-10s %10u %8s %9u %9u %9u\n", "threads", ulBufferSize, "-", TEST_RECORD_FIFO_THREAD_RECORDS, TEST_RECORD_FIFO_THREAD_RECORDS - ulThreadErrors, ulThreadProducerRetries);
+
+    record_fifo_delete(pThreadFIFO);
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+    uint32_t ulMaskedSections = g_ulHostMaskedSections;
+
+    printf("%-10s %10s %8s %9s %9s %9s\n", "case", "size", "start", "writes", "reads", "refused");
+
+    for(uint8_t i = 0; i < sizeof(pCases) / sizeof(pCases[0]); i++)
+        ubFailed |= test_record_fifo_random_case(&pCases[i]);
+
+    ubFailed |= test_record_fifo_threads(128);
+    ubFailed |= test_record_fifo_threads(1024);
+
+    printf("masked sections: %u\n", g_ulHostMaskedSections - ulMaskedSections);
+
+    if(g_ulHostMaskedSections != ulMaskedSections)
+    {
+        printf("  record_fifo masked interrupts\n");
+
+        ubFailed = 1;
+    }
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
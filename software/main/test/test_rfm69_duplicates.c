@@ -0,0 +1,341 @@
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69_peer.h"
+#include "rfm69.h"
+
+// Duplicate suppression and loss accounting of the receive path, replaying lossy QoS 1 traces from a scripted sender into the real driver
+// The trace is drawn up front: every attempt of a message may lose the data frame or its ACK, a lost ACK makes the sender retry with the same packet ID
+// Each case also covers reordering, a sender restart or a packet ID counter the sender shares with other receivers, the last one shows ulRXIDGaps overstating loss
+
+#define TEST_RFM69_DUPLICATES_NODE_ID   1
+#define TEST_RFM69_DUPLICATES_NET_ID    100
+#define TEST_RFM69_DUPLICATES_PEER_ID   2
+#define TEST_RFM69_DUPLICATES_MESSAGES  10000
+#define TEST_RFM69_DUPLICATES_ATTEMPTS  4       // First transmission and 3 retries
+#define TEST_RFM69_DUPLICATES_ACK_LIMIT 100     // ms - For the driver to answer a frame
+
+typedef struct test_rfm69_duplicates_case_t test_rfm69_duplicates_case_t;
+typedef struct test_rfm69_duplicates_arrival_t test_rfm69_duplicates_arrival_t;
+
+struct test_rfm69_duplicates_case_t
+{
+    const char *pszName;
+    uint16_t usDataLoss; // Per mille
+    uint16_t usACKLoss; // Per mille
+    uint16_t usReorder; // Per mille, an arrival swapped with the next one
+    uint8_t ubRestart; // The sender restarts halfway, its packet IDs start over
+    uint8_t ubShared; // 0 to 3 frames to other receivers between messages, taking packet IDs from the same counter
+};
+struct test_rfm69_duplicates_arrival_t
+{
+    uint16_t usID;
+    uint16_t usMessage;
+};
+
+static const test_rfm69_duplicates_case_t pCases[] = {
+    {"loss 10/10", 100, 100, 0, 0, 0},
+    {"ack loss 30", 0, 300, 0, 0, 0},
+    {"loss 40/10", 400, 100, 0, 0, 0},
+    {"reorder", 0, 200, 50, 0, 0},
+    {"restart", 100, 200, 0, 1, 0},
+    {"shared id", 100, 200, 0, 0, 1},
+};
+
+static rfm69_model_t xRadio;
+static rfm69_peer_t xPeer;
+static uint32_t ulRandom;
+static test_rfm69_duplicates_arrival_t pArrivals[TEST_RFM69_DUPLICATES_MESSAGES * TEST_RFM69_DUPLICATES_ATTEMPTS];
+static uint32_t ulArrivals;
+static uint8_t pubArrived[TEST_RFM69_DUPLICATES_MESSAGES]; // Copies of each message in the trace
+static uint8_t pubDelivered[TEST_RFM69_DUPLICATES_MESSAGES]; // Copies of each message handed to the application
+static uint32_t ulCorrupted;
+
+static void test_rfm69_duplicates_irq(rfm69_model_t *pModel)
+{
+    rfm69_isr();
+}
+static uint32_t test_rfm69_duplicates_random()
+{
+    ulRandom ^= ulRandom << 13;
+    ulRandom ^= ulRandom >> 17;
+    ulRandom ^= ulRandom << 5;
+
+    return ulRandom;
+}
+static uint8_t test_rfm69_duplicates_chance(uint16_t usPerMille)
+{
+    return test_rfm69_duplicates_random() % RFM69_PEER_LOSS_SCALE < usPerMille;
+}
+static void test_rfm69_duplicates_rx_callback(const rfm69_packet_header_t *pHeader, int8_t bRSSI, const uint8_t *pubData, uint8_t ubSize)
+{
+    uint16_t usMessage = ubSize == 2 ? pubData[0] | (pubData[1] << 8) : 0xFFFF;
+
+    if(pHeader->ubSenderNodeID != TEST_RFM69_DUPLICATES_PEER_ID || usMessage >= TEST_RFM69_DUPLICATES_MESSAGES)
+    {
+        ulCorrupted++;
+
+        return;
+    }
+
+    if(pubDelivered[usMessage] < UINT8_MAX)
+        pubDelivered[usMessage]++;
+}
+
+static uint32_t test_rfm69_duplicates_trace(const test_rfm69_duplicates_case_t *pCase, uint32_t *pulOthers)
+{
+    // Fills pArrivals, returns the gaps the receiver is expected to count, IDs taken by other receivers included
+    uint16_t usID = 1;
+    uint32_t ulGaps = 0;
+    uint16_t usSegmentFirst = 0; // Lowest and highest ID that arrived since the last restart
+    uint16_t usSegmentLast = 0;
+    uint32_t ulSegmentIDs = 0; // Distinct IDs that arrived since the last restart
+    uint8_t ubSegmentStarted = 0;
+
+    ulArrivals = 0;
+    *pulOthers = 0;
+
+    for(uint16_t i = 0; i < TEST_RFM69_DUPLICATES_MESSAGES; i++)
+    {
+        if(pCase->ubRestart && i == TEST_RFM69_DUPLICATES_MESSAGES / 2)
+        {
+            // Back to the first ID, thousands below the last one, the receiver has to resync instead of counting it as old
+            if(ubSegmentStarted)
+                ulGaps += (uint16_t)(usSegmentLast - usSegmentFirst) + 1 - ulSegmentIDs;
+
+            ubSegmentStarted = 0;
+            ulSegmentIDs = 0;
+            usID = 1;
+        }
+
+        if(pCase->ubShared)
+        {
+            uint8_t ubOthers = test_rfm69_duplicates_random() % 4;
+
+            if(ubSegmentStarted)
+                *pulOthers += ubOthers;
+
+            usID += ubOthers;
+        }
+
+        uint8_t ubArrived = 0;
+
+        for(uint8_t j = 0; j < TEST_RFM69_DUPLICATES_ATTEMPTS; j++)
+        {
+            if(test_rfm69_duplicates_chance(pCase->usDataLoss))
+                continue; // Nothing reached the receiver, no ACK either
+
+            pArrivals[ulArrivals].usID = usID;
+            pArrivals[ulArrivals].usMessage = i;
+            ulArrivals++;
+
+            pubArrived[i]++;
+            ubArrived = 1;
+
+            if(!test_rfm69_duplicates_chance(pCase->usACKLoss))
+                break;
+        }
+
+        if(ubArrived)
+        {
+            if(!ubSegmentStarted)
+                usSegmentFirst = usID;
+
+            usSegmentLast = usID;
+            ulSegmentIDs++;
+            ubSegmentStarted = 1;
+        }
+
+        usID++;
+    }
+
+    if(ubSegmentStarted)
+        ulGaps += (uint16_t)(usSegmentLast - usSegmentFirst) + 1 - ulSegmentIDs;
+
+    for(uint32_t i = 0; i + 1 < ulArrivals; i++)
+    {
+        if(!test_rfm69_duplicates_chance(pCase->usReorder))
+            continue;
+
+        test_rfm69_duplicates_arrival_t xArrival = pArrivals[i];
+
+        pArrivals[i] = pArrivals[i + 1];
+        pArrivals[i + 1] = xArrival;
+
+        i++; // Each arrival moves one place at most
+    }
+
+    return ulGaps;
+}
+
+static uint8_t test_rfm69_duplicates_run(const test_rfm69_duplicates_case_t *pCase, uint32_t ulSeed)
+{
+    uint8_t ubFailed = 0;
+
+    ulRandom = ulSeed;
+    ulCorrupted = 0;
+
+    memset(pubArrived, 0, sizeof(pubArrived));
+    memset(pubDelivered, 0, sizeof(pubDelivered));
+
+    uint32_t ulOthers;
+    uint32_t ulGaps = test_rfm69_duplicates_trace(pCase, &ulOthers);
+
+    host_trng_seed(ulSeed);
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = test_rfm69_duplicates_irq;
+
+    rfm69_peer_attach(&xRadio);
+    rfm69_peer_init(&xPeer, TEST_RFM69_DUPLICATES_PEER_ID, ulSeed);
+
+    xPeer.ubAutoACK = 0;
+
+    ldma_init();
+
+    if(!rfm69_init(TEST_RFM69_DUPLICATES_NODE_ID, TEST_RFM69_DUPLICATES_NET_ID, NULL))
+    {
+        printf("  %s: RFM69 not detected\n", pCase->pszName);
+
+        return 1;
+    }
+
+    rfm69_set_rx_callback(test_rfm69_duplicates_rx_callback);
+
+    for(uint32_t i = 0; i < ulArrivals; i++)
+    {
+        rfm69_packet_header_t xHeader;
+        uint8_t pubData[2];
+
+        memset(&xHeader, 0, sizeof(rfm69_packet_header_t));
+
+        xHeader.ubACKRequested = 1; // QoS 1 data frame
+        xHeader.usID = pArrivals[i].usID;
+        xHeader.bRemoteRSSI = -128;
+        xHeader.ubReceiverNodeID = TEST_RFM69_DUPLICATES_NODE_ID;
+        xHeader.ubSenderNodeID = TEST_RFM69_DUPLICATES_PEER_ID;
+
+        pubData[0] = pArrivals[i].usMessage & 0xFF;
+        pubData[1] = pArrivals[i].usMessage >> 8;
+
+        uint32_t ulHeard = xPeer.xStats.ulFramesHeard;
+        uint64_t ullStart = g_ullSystemTick;
+
+        rfm69_peer_send(&xPeer, &xHeader, pubData, sizeof(pubData));
+
+        // Every copy gets answered, the ACK we sent before may be the one that got lost
+        while(xPeer.xStats.ulFramesHeard == ulHeard && g_ullSystemTick - ullStart < TEST_RFM69_DUPLICATES_ACK_LIMIT)
+        {
+            host_advance(1);
+            rfm69_tick();
+        }
+
+        if(xPeer.xStats.ulFramesHeard == ulHeard)
+        {
+            printf("  %s: arrival %u (ID %hu) not answered\n", pCase->pszName, i, pArrivals[i].usID);
+
+            return 1;
+        }
+    }
+
+    uint32_t ulUnique = 0;
+    uint32_t ulCopies = 0; // Arrivals of a message already received, all delivered before suppression
+    uint32_t ulDuplicatesDelivered = 0;
+    uint32_t ulUndelivered = 0; // Every attempt lost
+    uint32_t ulMisdelivered = 0;
+
+    for(uint16_t i = 0; i < TEST_RFM69_DUPLICATES_MESSAGES; i++)
+    {
+        if(pubArrived[i])
+        {
+            ulUnique++;
+            ulCopies += pubArrived[i] - 1;
+        }
+        else
+        {
+            ulUndelivered++;
+        }
+
+        if(pubDelivered[i] > 1)
+            ulDuplicatesDelivered += pubDelivered[i] - 1;
+
+        if(!!pubDelivered[i] != !!pubArrived[i])
+            ulMisdelivered++;
+    }
+
+    const rfm69_link_t *pLink = rfm69_find_link(TEST_RFM69_DUPLICATES_PEER_ID);
+
+    if(!pLink)
+    {
+        printf("  %s: no link record for the sender\n", pCase->pszName);
+
+        return 1;
+    }
+
+    printf("%-12s %8u %8u %8u %8u %8u %8u %8u %8u\n",
+        pCase->pszName,
+        ulArrivals,
+        ulCopies,
+        ulDuplicatesDelivered,
+        pLink->ulRXDuplicates,
+        ulUndelivered,
+        ulGaps - ulOthers,
+        ulGaps,
+        pLink->ulRXIDGaps);
+
+    if(ulDuplicatesDelivered || ulMisdelivered || ulCorrupted)
+    {
+        printf("  %s: %u duplicates delivered, %u messages delivered or withheld wrongly, %u corrupted\n", pCase->pszName, ulDuplicatesDelivered, ulMisdelivered, ulCorrupted);
+
+        ubFailed = 1;
+    }
+
+    if(pLink->ulRXDuplicates != ulCopies || pLink->ulRXPackets != ulUnique)
+    {
+        printf("  %s: driver counted %u received and %u duplicates, the trace has %u and %u\n", pCase->pszName, pLink->ulRXPackets, pLink->ulRXDuplicates, ulUnique, ulCopies);
+
+        ubFailed = 1;
+    }
+
+    // Reordered frames may arrive after the window moved past their loss, the exact count only holds in order
+    if(!pCase->usReorder && pLink->ulRXIDGaps != ulGaps)
+    {
+        printf("  %s: driver counted %u ID gaps, the trace has %u\n", pCase->pszName, pLink->ulRXIDGaps, ulGaps);
+
+        ubFailed = 1;
+    }
+
+    // Logged as an upper bound on loss, it may never come out below it
+    if(pLink->ulRXIDGaps < ulGaps - ulOthers)
+    {
+        printf("  %s: %u ID gaps counted, below the %u really lost\n", pCase->pszName, pLink->ulRXIDGaps, ulGaps - ulOthers);
+
+        ubFailed = 1;
+    }
+
+    // Frames to other receivers are gaps too, loss read from ulRXIDGaps alone is overstated whenever the counter is shared
+    if(pCase->ubShared && pLink->ulRXIDGaps <= ulGaps - ulOthers)
+    {
+        printf("  %s: %u ID gaps counted, %u really lost, expected an upper bound above it\n", pCase->pszName, pLink->ulRXIDGaps, ulGaps - ulOthers);
+
+        ubFailed = 1;
+    }
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("%u messages, %u attempts each\n", TEST_RFM69_DUPLICATES_MESSAGES, TEST_RFM69_DUPLICATES_ATTEMPTS);
+    printf("%-12s %8s %8s %8s %8s %8s %8s %8s %8s\n", "case", "arrivals", "copies", "dup dlv", "dup cnt", "undlv", "lost", "gaps", "IDGaps");
+
+    for(uint8_t i = 0; i < sizeof(pCases) / sizeof(pCases[0]); i++)
+        ubFailed |= test_rfm69_duplicates_run(&pCases[i], 1 + i);
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
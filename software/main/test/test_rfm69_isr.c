@@ -0,0 +1,426 @@
+#include "host.h"
+#include "rfm69_model.h"
+#include "rfm69.h"
+
+// Drives the real RFM69 driver against the register model with the interrupt timing of the chip
+// PacketSent and PayloadReady raise DIO0 from the model, the interrupt runs rfm69_isr() when unmasked and waits for the unmask otherwise
+// Covers the TX state machine, the TX timeout guard and what rfm69_isr() does while the LDMA is still draining the FIFO
+
+#define TEST_RFM69_ISR_NODE_ID      1
+#define TEST_RFM69_ISR_NET_ID       100
+#define TEST_RFM69_ISR_PEER_ID      5
+#define TEST_RFM69_ISR_STEP_LIMIT   5000 // ms
+
+static rfm69_model_t xRadio;
+static uint16_t usTXCallbackID = 0;
+static uint16_t usTXCallbackRetries = 0;
+static uint32_t ulTXCallbacks = 0;
+static uint16_t usTimeoutID = 0;
+static uint32_t ulTimeouts = 0;
+static uint8_t pubRXData[RFM69_MAX_DATA_SIZE];
+static uint8_t ubRXSize = 0;
+static uint32_t ulRXCallbacks = 0;
+static uint32_t ulISRCalls = 0;
+
+static void test_rfm69_isr_irq(rfm69_model_t *pModel)
+{
+    ulISRCalls++;
+
+    rfm69_isr();
+}
+static void test_rfm69_isr_tx_callback(uint16_t usID, uint16_t usRetriesLeft)
+{
+    usTXCallbackID = usID;
+    usTXCallbackRetries = usRetriesLeft;
+    ulTXCallbacks++;
+}
+static void test_rfm69_isr_timeout_callback(uint16_t usID)
+{
+    usTimeoutID = usID;
+    ulTimeouts++;
+}
+static void test_rfm69_isr_rx_callback(const rfm69_packet_header_t *pHeader, int8_t bRSSI, const uint8_t *pubData, uint8_t ubSize)
+{
+    memcpy(pubRXData, pubData, ubSize);
+
+    ubRXSize = ubSize;
+    ulRXCallbacks++;
+}
+
+static uint8_t test_rfm69_isr_setup()
+{
+    host_trng_seed(7);
+    rfm69_model_air_reset();
+    rfm69_model_init(&xRadio);
+
+    xRadio.pfIRQ = test_rfm69_isr_irq;
+
+    ldma_init();
+
+    if(!rfm69_init(TEST_RFM69_ISR_NODE_ID, TEST_RFM69_ISR_NET_ID, NULL))
+        return 0;
+
+    rfm69_set_aggregation_latency(0);
+    rfm69_set_tx_callback(test_rfm69_isr_tx_callback);
+    rfm69_set_timeout_callback(test_rfm69_isr_timeout_callback);
+    rfm69_set_rx_callback(test_rfm69_isr_rx_callback);
+
+    usTXCallbackID = 0;
+    ulTXCallbacks = 0;
+    usTimeoutID = 0;
+    ulTimeouts = 0;
+    ulRXCallbacks = 0;
+    ulISRCalls = 0;
+
+    rfm69_tick(); // Into RX
+
+    return rfm69_model_get_mode(&xRadio) == RFM69_REG_OPMODE_RECEIVER;
+}
+// Data frame from the peer as it comes out of the FIFO, header then data
+static uint8_t test_rfm69_isr_build_frame(uint8_t *pubFrame, uint16_t usID, const uint8_t *pubData, uint8_t ubSize)
+{
+    pubFrame[0] = 0x00; // QoS 0, no flags
+    pubFrame[1] = usID & 0xFF;
+    pubFrame[2] = usID >> 8;
+    pubFrame[3] = (uint8_t)-128; // No RSSI report
+    pubFrame[4] = TEST_RFM69_ISR_NODE_ID;
+    pubFrame[5] = TEST_RFM69_ISR_PEER_ID;
+
+    memcpy(pubFrame + RFM69_PACKET_HEADER_SIZE, pubData, ubSize);
+
+    return RFM69_PACKET_HEADER_SIZE + ubSize;
+}
+
+// One frame through IDLE -> BACKOFF -> STANDBY -> SENDING -> DONE -> IDLE
+// ModeReady is delayed so STANDBY lasts long enough to be seen, PacketSent must come after exactly the frame airtime
+static uint8_t test_rfm69_isr_transitions()
+{
+    static const uint8_t pubExpected[] = {RFM69_TX_STATE_IDLE, RFM69_TX_STATE_BACKOFF, RFM69_TX_STATE_STANDBY, RFM69_TX_STATE_SENDING, RFM69_TX_STATE_DONE, RFM69_TX_STATE_IDLE};
+    static const uint8_t pubExpectedMode[] = {RFM69_REG_OPMODE_RECEIVER, RFM69_REG_OPMODE_RECEIVER, RFM69_REG_OPMODE_STANDBY, RFM69_REG_OPMODE_TRANSMITTER, RFM69_REG_OPMODE_RECEIVER, RFM69_REG_OPMODE_RECEIVER};
+    static const uint8_t pubPayload[] = "transitions";
+    uint8_t pubStates[16];
+    uint8_t pubModes[16];
+    uint8_t ubStates = 0;
+    uint64_t ullSendingSince = 0;
+    uint64_t ullDoneAt = 0;
+    uint8_t ubFailed = 0;
+
+    if(!test_rfm69_isr_setup())
+    {
+        printf("  transitions: radio did not come up in RX\n");
+
+        return 1;
+    }
+
+    xRadio.ulModeReadyDelay = 1500; // us
+
+    pubStates[ubStates] = rfm69_get_tx_state();
+    pubModes[ubStates++] = rfm69_model_get_mode(&xRadio);
+
+    uint16_t usID = rfm69_send(TEST_RFM69_ISR_PEER_ID, pubPayload, sizeof(pubPayload), 0, 0, 0);
+
+    for(uint32_t i = 0; i < TEST_RFM69_ISR_STEP_LIMIT && ubStates < sizeof(pubStates); i++)
+    {
+        // The state is sampled after the interrupts of the millisecond (DONE comes from rfm69_isr()) and after the tick
+        for(uint8_t ubPhase = 0; ubPhase < 2 && ubStates < sizeof(pubStates); ubPhase++)
+        {
+            if(!ubPhase)
+                host_advance(1);
+            else
+                rfm69_tick();
+
+            uint8_t ubState = rfm69_get_tx_state();
+
+            if(ubState == pubStates[ubStates - 1])
+                continue;
+
+            if(ubState == RFM69_TX_STATE_SENDING)
+                ullSendingSince = g_ullSystemTick;
+
+            if(ubState == RFM69_TX_STATE_DONE)
+                ullDoneAt = g_ullSystemTick;
+
+            pubStates[ubStates] = ubState;
+            pubModes[ubStates++] = rfm69_model_get_mode(&xRadio);
+        }
+
+        if(ulTXCallbacks)
+            break;
+    }
+
+    if(ubStates != sizeof(pubExpected) || memcmp(pubStates, pubExpected, sizeof(pubExpected)))
+    {
+        printf("  transitions: states");
+
+        for(uint8_t i = 0; i < ubStates; i++)
+            printf(" %hhu", pubStates[i]);
+
+        printf(", expected 0 1 2 3 4 0\n");
+
+        ubFailed = 1;
+    }
+    else if(memcmp(pubModes, pubExpectedMode, sizeof(pubExpectedMode)))
+    {
+        printf("  transitions: radio modes do not follow the TX states\n");
+
+        ubFailed = 1;
+    }
+
+    uint32_t ulAirtime = (rfm69_model_get_airtime(&xRadio, RFM69_PACKET_HEADER_SIZE + sizeof(pubPayload)) + 999) / 1000;
+
+    if(ullDoneAt - ullSendingSince != ulAirtime)
+    {
+        printf("  transitions: PacketSent after %llu ms in SENDING, airtime is %u ms\n", (unsigned long long)(ullDoneAt - ullSendingSince), ulAirtime);
+
+        ubFailed = 1;
+    }
+
+    if(ulTXCallbacks != 1 || usTXCallbackID != usID || xRadio.xStats.ulFramesSent != 1 || ulISRCalls != 1)
+    {
+        printf("  transitions: %u TX callbacks (ID %hu, sent %hu), %u frames on air, %u interrupts\n", ulTXCallbacks, usTXCallbackID, usID, xRadio.xStats.ulFramesSent, ulISRCalls);
+
+        ubFailed = 1;
+    }
+
+    if((xRadio.pubRegisters[RFM69_REG_DIOMAPPING1] & RFM69_REG_DIOMAPPING1_DIO0_11) != RFM69_REG_DIOMAPPING1_DIO0_01)
+    {
+        printf("  transitions: DIO0 not mapped back to PayloadReady\n");
+
+        ubFailed = 1;
+    }
+
+    printf("%-12s %6u %8llu %8u %9u\n", "transitions", ubStates, (unsigned long long)(ullDoneAt - ullSendingSince), xRadio.xStats.ulFramesSent, ulISRCalls);
+
+    return ubFailed;
+}
+
+// PacketSent never comes, or ModeReady never comes, the guard must take the radio back to RX after RFM69_TX_TIMEOUT plus the longest frame airtime
+static uint8_t test_rfm69_isr_guard(uint8_t ubStuckInStandby)
+{
+    static const uint8_t pubPayload[] = "guard";
+    const char *pszName = ubStuckInStandby ? "guard-stby" : "guard-tx";
+    uint32_t ulGuard;
+    uint64_t ullGuardStart = 0;
+    uint64_t ullFirstGuard = 0;
+    uint8_t ubLastState = RFM69_TX_STATE_IDLE;
+    uint8_t ubFailed = 0;
+
+    if(!test_rfm69_isr_setup())
+    {
+        printf("  %s: radio did not come up in RX\n", pszName);
+
+        return 1;
+    }
+
+    ulGuard = RFM69_TX_TIMEOUT + rfm69_model_get_airtime(&xRadio, RFM69_MAX_PAYLOAD_SIZE) / 1000;
+
+    if(ubStuckInStandby)
+        xRadio.ulModeReadyDelay = 1000000000;
+    else
+        xRadio.ubSuppressPacketSent = 1;
+
+    uint16_t usID = rfm69_send(TEST_RFM69_ISR_PEER_ID, pubPayload, sizeof(pubPayload), 1, 200, 1);
+
+    for(uint32_t i = 0; i < TEST_RFM69_ISR_STEP_LIMIT && !ulTimeouts; i++)
+    {
+        uint32_t ulCallbacks = ulTXCallbacks + ulTimeouts;
+
+        host_advance(1);
+        rfm69_tick();
+
+        uint8_t ubState = rfm69_get_tx_state();
+
+        if(ubLastState == RFM69_TX_STATE_BACKOFF && ubState != RFM69_TX_STATE_BACKOFF)
+            ullGuardStart = g_ullSystemTick; // Leaving BACKOFF stamps the frame
+
+        if(ulTXCallbacks + ulTimeouts != ulCallbacks && !ullFirstGuard)
+            ullFirstGuard = g_ullSystemTick - ullGuardStart;
+
+        ubLastState = ubState;
+    }
+
+    if(ullFirstGuard != ulGuard)
+    {
+        printf("  %s: guard fired after %llu ms, expected %u ms\n", pszName, (unsigned long long)ullFirstGuard, ulGuard);
+
+        ubFailed = 1;
+    }
+
+    if(ulTXCallbacks != 1 || usTXCallbackRetries != 0 || ulTimeouts != 1 || usTimeoutID != usID)
+    {
+        printf("  %s: %u TX callbacks, %u timeouts (ID %hu, sent %hu), expected one retry then a timeout\n", pszName, ulTXCallbacks, ulTimeouts, usTimeoutID, usID);
+
+        ubFailed = 1;
+    }
+
+    if(xRadio.xStats.ulFramesSent != (ubStuckInStandby ? 0 : 2))
+    {
+        printf("  %s: %u frames on air\n", pszName, xRadio.xStats.ulFramesSent);
+
+        ubFailed = 1;
+    }
+
+    if(rfm69_get_tx_state() != RFM69_TX_STATE_IDLE || rfm69_model_get_mode(&xRadio) != RFM69_REG_OPMODE_RECEIVER)
+    {
+        printf("  %s: radio left in state %hhu, mode 0x%02X\n", pszName, rfm69_get_tx_state(), rfm69_model_get_mode(&xRadio));
+
+        ubFailed = 1;
+    }
+
+    printf("%-12s %6u %8llu %8u %9u\n", pszName, ulTXCallbacks + ulTimeouts, (unsigned long long)ullFirstGuard, xRadio.xStats.ulFramesSent, ulISRCalls);
+
+    xRadio.ulModeReadyDelay = 0;
+    xRadio.ubSuppressPacketSent = 0;
+
+    return ubFailed;
+}
+
+// PayloadReady starts an LDMA drain, with the LDMA held back the ISR must stay out of the way and a register access must finish the drain first
+static uint8_t test_rfm69_isr_dma_busy(uint8_t ubInline)
+{
+    static const uint8_t pubData[] = "drained by the LDMA";
+    const char *pszName = ubInline ? "dma-inline" : "dma-irq";
+    uint8_t pubFrame[RFM69_MAX_PAYLOAD_SIZE];
+    rfm69_isr_stats_t xISRStats;
+    uint8_t ubFailed = 0;
+
+    if(!test_rfm69_isr_setup())
+    {
+        printf("  %s: radio did not come up in RX\n", pszName);
+
+        return 1;
+    }
+
+    uint8_t ubFrameSize = test_rfm69_isr_build_frame(pubFrame, 0x1234, pubData, sizeof(pubData));
+
+    ldma_host_set_deferred(BIT(RFM69_DMA_RX_CHANNEL) | BIT(RFM69_DMA_TX_CHANNEL));
+
+    if(!rfm69_model_inject(&xRadio, pubFrame, ubFrameSize, -70))
+    {
+        printf("  %s: radio not listening\n", pszName);
+
+        ldma_host_set_deferred(0);
+
+        return 1;
+    }
+
+    // The ISR ran on the DIO0 edge, read the length and left the rest to the LDMA with chip select held
+    if(ulISRCalls != 1 || !ldma_host_is_active(RFM69_DMA_RX_CHANNEL) || gpio_host_read(GPIO_HOST_PIN_RFM69_CS))
+    {
+        printf("  %s: drain not started (%u interrupts)\n", pszName, ulISRCalls);
+
+        ldma_host_set_deferred(0);
+
+        return 1;
+    }
+
+    ldma_host_step(4);
+
+    uint32_t ulBytes = xRadio.xStats.ulBytes;
+
+    rfm69_isr(); // Another edge while draining, must not touch the bus
+
+    if(xRadio.xStats.ulBytes != ulBytes || gpio_host_read(GPIO_HOST_PIN_RFM69_CS))
+    {
+        printf("  %s: rfm69_isr() used the bus during a drain\n", pszName);
+
+        ubFailed = 1;
+    }
+
+    if(ubInline)
+        rfm69_tick(); // First register access finishes the drain on the spot
+    else
+        ldma_host_step(RFM69_MAX_PAYLOAD_SIZE * 2); // Completion interrupt finishes it
+
+    ldma_host_set_deferred(0);
+
+    rfm69_get_isr_stats(&xISRStats);
+
+    if(!gpio_host_read(GPIO_HOST_PIN_RFM69_CS) || xISRStats.ulDrains != 1 || xISRStats.ulDrainErrors || xISRStats.ulInlineFinishes != ubInline)
+    {
+        printf("  %s: %u drains, %u errors, %u inline finishes, chip select %s\n", pszName, xISRStats.ulDrains, xISRStats.ulDrainErrors, xISRStats.ulInlineFinishes, gpio_host_read(GPIO_HOST_PIN_RFM69_CS) ? "released" : "held");
+
+        ubFailed = 1;
+    }
+
+    rfm69_tick();
+
+    if(ulRXCallbacks != 1 || ubRXSize != sizeof(pubData) || memcmp(pubRXData, pubData, sizeof(pubData)))
+    {
+        printf("  %s: payload not delivered intact (%u callbacks, %hhu bytes)\n", pszName, ulRXCallbacks, ubRXSize);
+
+        ubFailed = 1;
+    }
+
+    if(!rfm69_model_is_listening(&xRadio))
+    {
+        printf("  %s: radio not back in RX\n", pszName);
+
+        ubFailed = 1;
+    }
+
+    printf("%-12s %6u %8s %8u %9u\n", pszName, xISRStats.ulDrains, "-", xRadio.xStats.ulFramesSent, ulISRCalls);
+
+    return ubFailed;
+}
+
+// PayloadReady while interrupts are masked is taken on the unmask, like the GPIO interrupt flag
+static uint8_t test_rfm69_isr_masked()
+{
+    static const uint8_t pubData[] = "masked";
+    uint8_t pubFrame[RFM69_MAX_PAYLOAD_SIZE];
+    uint8_t ubFailed = 0;
+
+    if(!test_rfm69_isr_setup())
+    {
+        printf("  masked: radio did not come up in RX\n");
+
+        return 1;
+    }
+
+    uint8_t ubFrameSize = test_rfm69_isr_build_frame(pubFrame, 0x2345, pubData, sizeof(pubData));
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        rfm69_model_inject(&xRadio, pubFrame, ubFrameSize, -70);
+
+        if(ulISRCalls)
+        {
+            printf("  masked: rfm69_isr() ran with interrupts masked\n");
+
+            ubFailed = 1;
+        }
+    }
+
+    rfm69_tick();
+
+    if(ulISRCalls != 1 || ulRXCallbacks != 1 || memcmp(pubRXData, pubData, sizeof(pubData)))
+    {
+        printf("  masked: %u interrupts, %u deliveries after the unmask\n", ulISRCalls, ulRXCallbacks);
+
+        ubFailed = 1;
+    }
+
+    printf("%-12s %6u %8s %8u %9u\n", "masked", ulRXCallbacks, "-", xRadio.xStats.ulFramesSent, ulISRCalls);
+
+    return ubFailed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t ubFailed = 0;
+
+    printf("%-12s %6s %8s %8s %9s\n", "case", "events", "ms", "on air", "ISR calls");
+
+    ubFailed |= test_rfm69_isr_transitions();
+    ubFailed |= test_rfm69_isr_guard(0);
+    ubFailed |= test_rfm69_isr_guard(1);
+    ubFailed |= test_rfm69_isr_dma_busy(1);
+    ubFailed |= test_rfm69_isr_dma_busy(0);
+    ubFailed |= test_rfm69_isr_masked();
+
+    if(ubFailed)
+        printf("FAILED\n");
+
+    return ubFailed;
+}
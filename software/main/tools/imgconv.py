@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+#
+# Converts images into C sources for src/assets/images, placed in QSPI flash (QSPI_DATA).
+#
+# Usage: imgconv.py [--raw] <input.png | input.c> <output.c> <symbol>
+# make images regenerates the QOI565 assets from the PNGs in tools/images.
+#
+# Inputs are 8 bit RGB/RGBA non-interlaced PNGs, or an older asset source with an RGB565 array.
+# By default the pixels are encoded with IMAGE_ENCODING_QOI565, a QOI-like byte stream tuned for RGB565
+# (the decoder is tft_image_decode() in tft.c). --raw keeps plain RGB565 pixels, needed for images
+# that are drawn inside tft frames, where each tile reads the pixels at random.
+#
+# QOI565 ops, decoder starts with a black previous pixel and a zeroed 64 entry index:
+#   00iiiiii                    Index, pixel from the recently seen color table
+#   01rrggbb                    Diff, -2..1 per channel from the previous pixel
+#   10gggggg rrrrbbbb           Luma, green -32..31, red and blue -8..7 relative to green
+#   11nnnnnn                    Run of 1..62 previous pixels (n < 62)
+#   11111110 hhhhhhhh llllllll  Raw RGB565 pixel, big endian
+#   11111111 hhhhhhhh llllllll  Run of 1..65536 previous pixels, count - 1 big endian
+# Every pixel that is not part of a run is stored in the index at (r * 3 + g * 5 + b * 7) % 64.
+
+import re
+import struct
+import sys
+import zlib
+
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('not a PNG file')
+
+    pos = 8
+    idat = b''
+
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+
+            if depth != 8 or color not in (2, 6) or interlace:
+                raise ValueError('only 8 bit RGB/RGBA non-interlaced PNGs are supported')
+
+            bpp = 3 if color == 2 else 4
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+
+    raw = zlib.decompress(idat)
+    stride = width * bpp
+    prev = bytearray(stride)
+    pixels = []
+
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+
+        for x in range(stride):
+            a = line[x - bpp] if x >= bpp else 0
+            b = prev[x]
+            c = prev[x - bpp] if x >= bpp else 0
+
+            if ftype == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif ftype == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif ftype == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[x] = (line[x] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+
+        for x in range(width):
+            r, g, b = line[x * bpp:x * bpp + 3]
+            pixels.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+
+        prev = line
+
+    return width, height, pixels
+
+def read_c(path):
+    with open(path) as f:
+        src = f.read()
+
+    array = re.search(r'pPixels\[\]\s*=\s*\{(.*?)\};', src, re.S)
+    size = re.search(r'\(rgb565_t \*\)pPixels,\s*(\d+),\s*(\d+)', src)
+
+    if not array or not size:
+        raise ValueError('no RGB565 pixel array found')
+
+    pixels = [int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]+)', array.group(1))]
+
+    return int(size.group(1)), int(size.group(2)), pixels
+
+def qoi565_encode(pixels):
+    def split(p):
+        return p >> 11, (p >> 5) & 0x3F, p & 0x1F
+
+    def wrap(v, bits):
+        v &= (1 << bits) - 1
+
+        return v - (1 << bits) if v >= (1 << (bits - 1)) else v
+
+    out = bytearray()
+    index = [0] * 64
+    prev = 0
+    run = 0
+
+    def flush_run(run):
+        while run:
+            if run <= 62:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            else:
+                n = min(run, 65536)
+                out.extend((0xFF, (n - 1) >> 8, (n - 1) & 0xFF))
+                run -= n
+
+    for p in pixels:
+        if p == prev:
+            run += 1
+            continue
+
+        flush_run(run)
+        run = 0
+
+        r, g, b = split(p)
+        pr, pg, pb = split(prev)
+        h = (r * 3 + g * 5 + b * 7) % 64
+        dr, dg, db = wrap(r - pr, 5), wrap(g - pg, 6), wrap(b - pb, 5)
+
+        if index[h] == p:
+            out.append(h)
+        elif -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+            out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+        elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+            out.extend((0x80 | (dg + 32), ((dr - dg + 8) << 4) | (db - dg + 8)))
+        else:
+            out.extend((0xFE, p >> 8, p & 0xFF))
+
+        index[h] = p
+        prev = p
+
+    flush_run(run)
+
+    return out
+
+def write_c(path, symbol, width, height, encoding, data, ctype, fmt, per_line):
+    with open(path, 'w') as f:
+        f.write('#include "images.h"\n\n')
+        f.write('static const %s pData[] QSPI_DATA =\n{\n' % ctype)
+
+        for i in range(0, len(data), per_line):
+            f.write('    ' + ' '.join((fmt % v) + ',' for v in data[i:i + per_line]) + '\n')
+
+        f.write('};\n\n')
+        f.write('const image_t %s =\n{\n' % symbol)
+        f.write('    pData,\n    sizeof(pData),\n    %d,\n    %d,\n    %s\n};\n' % (width, height, encoding))
+
+def main(argv):
+    raw = '--raw' in argv
+    argv = [a for a in argv if a != '--raw']
+
+    if len(argv) != 3:
+        print('Usage: imgconv.py [--raw] <input.png | input.c> <output.c> <symbol>', file=sys.stderr)
+
+        return 1
+
+    src, dst, symbol = argv
+    width, height, pixels = read_c(src) if src.endswith('.c') else read_png(src)
+
+    if len(pixels) < width * height:
+        print('%s: expected %d pixels, found %d' % (src, width * height, len(pixels)), file=sys.stderr)
+
+        return 1
+
+    pixels = pixels[:width * height] # Older sources may carry padding past the last row
+
+    if raw:
+        write_c(dst, symbol, width, height, 'IMAGE_ENCODING_RAW', pixels, 'rgb565_t', '0x%04X', 8)
+        size = len(pixels) * 2
+    else:
+        data = qoi565_encode(pixels)
+        write_c(dst, symbol, width, height, 'IMAGE_ENCODING_QOI565', data, 'uint8_t', '0x%02X', 16)
+        size = len(data)
+
+    print('%s: %dx%d, %d -> %d bytes' % (dst, width, height, len(pixels) * 2, size))
+
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))